@@ -138,6 +138,9 @@
 double galextinct_(double *RV, double *AV, double *WAVE, int *OPT, double *PARLIST, char *callFun ) {
   return GALextinct(*RV, *AV, *WAVE, *OPT, PARLIST, callFun);
 }
+double galextinct_cache__(double *RV, double *AV, double *WAVE, int *OPT, double *PARLIST, char *callFun ) {
+  return GALextinct_cache(*RV, *AV, *WAVE, *OPT, PARLIST, callFun);
+}
 void text_mwoption__(char *nameOpt, int  *OPT, char *TEXT, char *callFun) {
   text_MWoption(nameOpt,*OPT,TEXT, callFun);
 }
@@ -693,15 +696,53 @@ Returns :
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
   
-  //number of knots
-  int Nk;
-  // constants
-  double x02, gamma2, c1, c2, c3, c4, c5;
+  int    Nk;
+  double xF[MXKNOT_FITZ99], yF[MXKNOT_FITZ99], cFM[NPAR_FM90];
   // target wavenumber in inverse microns
   double x = 10000.0/WAVE;
   // spline result
   double y;
 
+  // Oct 2026: constants and spline knots moved to GALextinct_Fitz99_knots
+  //           so that GALextinct_array can compute them once per RV.
+  GALextinct_Fitz99_knots(RV, OPT, &Nk, xF, yF, cFM, callFun);
+
+  if (WAVE <= 2700.0) { //FM90 curve in UV
+    y = GALextinct_FM90(x, cFM[0], cFM[1], cFM[2], cFM[3], cFM[4], 
+			cFM[5], cFM[6]);
+    return AV * (1.0 + y/RV); 
+  } else { //spline for optical/IR
+    y = GALextinct_FM_spline(x, Nk, xF, yF, 0);
+    return AV*(1.0 + y/RV);
+  }
+
+} // end of GALextinct_Fitz99_exact
+
+// ==========================================================
+void GALextinct_Fitz99_knots(double RV, int OPT, int *Nk_out, 
+			     double *xF, double *yF, double *cFM, 
+			     char *callFun) {
+
+  // Created Oct 2026 
+  // [code moved from GALextinct_Fitz99_exact, S.Thorp Sep 2024]
+  //
+  // Return FM90 constants cFM[0:6] = c1,c2,c3,c4,c5,x02,gamma2
+  // and optical/IR spline knots xF,yF (Nk_out knots) for F99-like 
+  // curves. These depend only on RV and OPT, and therefore can be
+  // computed once for an entire wavelength array.
+
+  char fnam[60];
+  concat_callfun_plus_fnam(callFun, "GALextinct_Fitz99_knots", fnam); 
+
+  //number of knots
+  int Nk = 0;
+  // constants
+  double x02, gamma2, c1, c2, c3, c4, c5;
+  // powers of RV
+  double RV2, RV3, RV4;
+
+  // ------------ BEGIN ------------
+
   // constants
   c2 = -0.824 + 4.717/RV;
   c5 = 5.90;
@@ -733,92 +774,84 @@ Returns :
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
 
-  if (WAVE <= 2700.0) { //FM90 curve in UV
-    y = GALextinct_FM90(x, c1, c2, c3, c4, c5, x02, gamma2);
-    return AV * (1.0 + y/RV); 
-  } else { //spline for optical/IR
-    // powers of RV
-    double RV2, RV3, RV4;
-    
-    // spline knot locations in inverse microns
-    double xF[Nk];
-    xF[0] = 0.0; // always put an anchor at 1/lambda = 0
-    if ( OPT == OPT_MWCOLORLAW_GORD03 ) {
-      xF[1] = 1.0/2.198;
-      xF[2] = 1.0/1.65;
-      xF[3] = 1.0/1.25;
-      xF[4] = 1.0/0.81;
-      xF[5] = 1.0/0.65;
-      xF[6] = 1.0/0.55;
-      xF[7] = 1.0/0.44;
-      xF[8] = 1.0/0.37;
+  cFM[0] = c1;  cFM[1] = c2;  cFM[2] = c3;  cFM[3] = c4;  
+  cFM[4] = c5;  cFM[5] = x02; cFM[6] = gamma2 ;
+  *Nk_out = Nk;
+
+  // spline knot locations in inverse microns
+  xF[0] = 0.0; // always put an anchor at 1/lambda = 0
+  if ( OPT == OPT_MWCOLORLAW_GORD03 ) {
+    xF[1] = 1.0/2.198;
+    xF[2] = 1.0/1.65;
+    xF[3] = 1.0/1.25;
+    xF[4] = 1.0/0.81;
+    xF[5] = 1.0/0.65;
+    xF[6] = 1.0/0.55;
+    xF[7] = 1.0/0.44;
+    xF[8] = 1.0/0.37;
+  } else {
+    if ( OPT == OPT_MWCOLORLAW_FITZ04 ) {
+      // Use FM07 knots for Fitzpatrick (2004) curve
+      xF[1] = 0.5;
+      xF[2] = 0.75;
+      xF[3] = 1.0;
     } else {
-      if ( OPT == OPT_MWCOLORLAW_FITZ04 ) {
-	// Use FM07 knots for Fitzpatrick (2004) curve
-	xF[1] = 0.5;
-	xF[2] = 0.75;
-	xF[3] = 1.0;
-      } else {
-	xF[1] = 1.0/2.65;
-	xF[2] = 1.0/1.22;
-      }
-      xF[Nk-6] = 1.0/0.60;
-      xF[Nk-5] = 1.0/0.547;
-      xF[Nk-4] = 1.0/0.467; 
-      xF[Nk-3] = 1.0/0.411;
+      xF[1] = 1.0/2.65;
+      xF[2] = 1.0/1.22;
     }
-    // always anchor in the UV
-    xF[Nk-2] = 1.0/0.270;
-    xF[Nk-1] = 1.0/0.260;
-    // spline knot values
-    double yF[Nk];
-
-    // RV-dependent spline knot values
-    // polynomial coeffs match FM_UNRED.pro and extinction.py
-    // NOTE: the optical coefficients differ from Gordon 24 implementation
-    double yFNIR;
-    yF[0] = -RV;
-    if ( OPT == OPT_MWCOLORLAW_GORD03 ) {
-      // knot values have 1 subtracted and are multiplied by RV
-      yF[1] = -2.4386; //0.11*RV-RV
-      yF[2] = -2.27694; //0.169*RV-RV
-      yF[3] = -2.055; //0.25*RV-RV
-      yF[4] = -1.18642; //0.567*RV-RV
-      yF[5] = -0.54526; //0.801*RV-RV
-      yF[6] = 0.0;
-      yF[7] = 1.02476; //1.374*RV-RV 
-      yF[8] = 1.84128; //1.672*RV-RV
-    } else {
-      // powers of RV
-      RV2 = RV*RV;
-      RV3 = RV2*RV;
-      RV4 = RV2*RV2;
-      if ( OPT == OPT_MWCOLORLAW_FITZ04 ) {
-	yFNIR = (0.63*RV -0.84);
-	yF[1] = yFNIR*pow(xF[1], 1.84) - RV;
-	yF[2] = yFNIR*pow(xF[2], 1.84) - RV;
-	yF[3] = yFNIR*pow(xF[3], 1.84) - RV;
-      }
-      else {
-	yF[1] = -0.914616129*RV; // 0.26469*(RV/3.1) - RV
-	yF[2] = -0.7325*RV; // 0.82925*(RV/3.1) - RV
-      }
-      yF[Nk-6] = -0.422809 + 0.00270*RV +  2.13572e-04*RV2;
-      yF[Nk-5] = -5.13540e-02 + 0.00216*RV - 7.35778e-05*RV2;
-      yF[Nk-4] =  7.00127e-01 + 0.00184*RV - 3.32598e-05*RV2;
-      yF[Nk-3] =  1.19456 + 0.01707*RV - 5.46959e-03*RV2 +  
-	7.97809e-04*RV3 - 4.45636e-05*RV4;
+    xF[Nk-6] = 1.0/0.60;
+    xF[Nk-5] = 1.0/0.547;
+    xF[Nk-4] = 1.0/0.467; 
+    xF[Nk-3] = 1.0/0.411;
+  }
+  // always anchor in the UV
+  xF[Nk-2] = 1.0/0.270;
+  xF[Nk-1] = 1.0/0.260;
+
+  // RV-dependent spline knot values
+  // polynomial coeffs match FM_UNRED.pro and extinction.py
+  // NOTE: the optical coefficients differ from Gordon 24 implementation
+  double yFNIR;
+  yF[0] = -RV;
+  if ( OPT == OPT_MWCOLORLAW_GORD03 ) {
+    // knot values have 1 subtracted and are multiplied by RV
+    yF[1] = -2.4386; //0.11*RV-RV
+    yF[2] = -2.27694; //0.169*RV-RV
+    yF[3] = -2.055; //0.25*RV-RV
+    yF[4] = -1.18642; //0.567*RV-RV
+    yF[5] = -0.54526; //0.801*RV-RV
+    yF[6] = 0.0;
+    yF[7] = 1.02476; //1.374*RV-RV 
+    yF[8] = 1.84128; //1.672*RV-RV
+  } else {
+    // powers of RV
+    RV2 = RV*RV;
+    RV3 = RV2*RV;
+    RV4 = RV2*RV2;
+    if ( OPT == OPT_MWCOLORLAW_FITZ04 ) {
+      yFNIR = (0.63*RV -0.84);
+      yF[1] = yFNIR*pow(xF[1], 1.84) - RV;
+      yF[2] = yFNIR*pow(xF[2], 1.84) - RV;
+      yF[3] = yFNIR*pow(xF[3], 1.84) - RV;
     }
-    // UV knots using FM90
-    yF[Nk-2] = GALextinct_FM90(xF[Nk-2], c1, c2, c3, c4, c5, x02, gamma2);
-    yF[Nk-1] = GALextinct_FM90(xF[Nk-1], c1, c2, c3, c4, c5, x02, gamma2);
-    
-    y = GALextinct_FM_spline(x, Nk, xF, yF, 0);
-    
-    return AV*(1.0 + y/RV);
+    else {
+      yF[1] = -0.914616129*RV; // 0.26469*(RV/3.1) - RV
+      yF[2] = -0.7325*RV; // 0.82925*(RV/3.1) - RV
+    }
+    yF[Nk-6] = -0.422809 + 0.00270*RV +  2.13572e-04*RV2;
+    yF[Nk-5] = -5.13540e-02 + 0.00216*RV - 7.35778e-05*RV2;
+    yF[Nk-4] =  7.00127e-01 + 0.00184*RV - 3.32598e-05*RV2;
+    yF[Nk-3] =  1.19456 + 0.01707*RV - 5.46959e-03*RV2 +  
+      7.97809e-04*RV3 - 4.45636e-05*RV4;
   }
+  // UV knots using FM90
+  yF[Nk-2] = GALextinct_FM90(xF[Nk-2], c1, c2, c3, c4, c5, x02, gamma2);
+  yF[Nk-1] = GALextinct_FM90(xF[Nk-1], c1, c2, c3, c4, c5, x02, gamma2);
+
+  return ;
+
+} // end of GALextinct_Fitz99_knots
 
-} // end of GALextinct_Fitz99_exact
 
 // ============= MAIZ APELLANIZ ET AL. 2014 EXTINCTION LAW ==============
 double GALextinct_Maiz14(double RV, double AV, double WAVE, char *callFun) {
@@ -1346,6 +1379,219 @@ Returns :
     return y;
 } //end GALextinct_FM_spline
 
+
+// ====================================================
+void GALextinct_FM_spline_d2(int Nk, double *xk, double *yk, double *d2y) {
+
+  // Created Oct 2026
+  // Return 2nd derivatives d2y[0:Nk-1] of natural cubic spline
+  // through knots xk,yk. Same tridiagonal (Thomas) solve as in
+  // GALextinct_FM_spline, but back-substitution is done for all
+  // knots so that the solution can be re-used for many x.
+
+  int j;
+  double Kb[MXKNOT_FITZ99], Kc[MXKNOT_FITZ99], Vd[MXKNOT_FITZ99], wj ;
+
+  // ------------ BEGIN ------------
+
+  for (j=0; j<Nk-2; j++) {
+    Kb[j] = (xk[j+2] - xk[j])/3.0;
+    if (j<Nk-3) { Kc[j] = (xk[j+2] - xk[j+1])/6.0; }
+    Vd[j] = (yk[j+2] - yk[j+1])/(xk[j+2] - xk[j+1]) - 
+      (yk[j+1] - yk[j])/(xk[j+1] - xk[j]);
+  }
+  for (j=1; j<Nk-2; j++) {
+    wj     = Kc[j-1]/Kb[j-1]; 
+    Kb[j] -= wj*Kc[j-1]; 
+    Vd[j] -= wj*Vd[j-1]; 
+  }
+
+  // natural spline: zero 2nd derivative at end knots
+  d2y[0] = d2y[Nk-1] = 0.0 ;
+  d2y[Nk-2] = Vd[Nk-3]/Kb[Nk-3];
+  for (j=Nk-4; j >= 0; j-- ) 
+    { d2y[j+1] = (Vd[j] - Kc[j]*d2y[j+2])/Kb[j]; }
+
+  return ;
+
+} // end GALextinct_FM_spline_d2
+
+// ====================================================
+double GALextinct_FM_spline_eval(double x, int Nk, double *xk, double *yk,
+				 double *d2y) {
+
+  // Created Oct 2026
+  // Evaluate natural cubic spline at x using 2nd derivatives d2y
+  // from GALextinct_FM_spline_d2. Equivalent to 
+  // GALextinct_FM_spline(x,Nk,xk,yk,0) without re-solving for d2y.
+
+  char fnam[] = "GALextinct_FM_spline_eval" ;
+  int    q;
+  double A, B, C, D, deltax, deltax2, y ;
+
+  // ------------ BEGIN ------------
+
+  if (x < xk[0] || x > xk[Nk-1]) {
+    sprintf(c1err,"Spline interpolation out of bounds!");
+    sprintf(c2err,"Requested %.3f. Limits are [%.3f, %.3f].", 
+	    x, xk[0], xk[Nk-1]);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  q = 0; 
+  while ( q < Nk-2 && x >= xk[q+1] ) { q++ ; }
+
+  deltax  = xk[q+1] - xk[q];
+  deltax2 = deltax * deltax;
+  A = (xk[q+1] - x) / deltax;
+  B = 1.0 - A;
+  C = (A*A*A - A) * deltax2 / 6.0;
+  D = (B*B*B - B) * deltax2 / 6.0;
+  y = A*yk[q] + B*yk[q+1] + C*d2y[q] + D*d2y[q+1] ;
+  return y;
+
+} // end GALextinct_FM_spline_eval
+
+// ====================================================
+ATTR_TARGET_CLONES
+void GALextinct_array(double RV, double AV, int NWAVE, double *WAVE_LIST,
+		      int OPT, double *PARLIST, double *XT_LIST, 
+		      char *callFun) {
+
+  // Created Oct 2026
+  // Array version of GALextinct: return XT_LIST[i] = extinction (mag)
+  // for each WAVE_LIST[i] at fixed RV, AV, OPT.
+  // For F99-like laws (99, 203, 204), the RV-dependent constants
+  // and spline 2nd-derivatives are computed once for the entire 
+  // array instead of once per wavelength. All other options 
+  // call GALextinct for each wavelength.
+
+  int    i, Nk ;
+  double xF[MXKNOT_FITZ99], yF[MXKNOT_FITZ99], d2F[MXKNOT_FITZ99];
+  double cFM[NPAR_FM90], WAVE, x, y ;
+  char fnam[60];
+  concat_callfun_plus_fnam(callFun, "GALextinct_array", fnam); 
+
+  // ------------ BEGIN ------------
+
+  if ( AV == 0.0 ) {
+    for(i=0; i < NWAVE; i++ ) { XT_LIST[i] = 0.0 ; }
+    return ;
+  }
+
+  if ( OPT != OPT_MWCOLORLAW_FITZ99_EXACT && 
+       OPT != OPT_MWCOLORLAW_FITZ04       &&
+       OPT != OPT_MWCOLORLAW_GORD03          ) {
+    for(i=0; i < NWAVE; i++ ) 
+      { XT_LIST[i] = GALextinct(RV, AV, WAVE_LIST[i], OPT, PARLIST, callFun); }
+    return ;
+  }
+
+  // F99-like: same checks as GALextinct_Fitz99_exact
+  if ( OPT == OPT_MWCOLORLAW_GORD03 && RV != 2.74 ) {
+    sprintf(c1err,"Requested OPT=%d and RV=%.2f", OPT, RV);
+    sprintf(c2err,"Gordon et al. 2003 only valid for RV=2.74");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  GALextinct_Fitz99_knots(RV, OPT, &Nk, xF, yF, cFM, callFun);
+  GALextinct_FM_spline_d2(Nk, xF, yF, d2F);
+
+  for(i=0; i < NWAVE; i++ ) {
+    WAVE = WAVE_LIST[i];
+    if ( WAVE < WAVEMIN_FITZ99_EXACT || WAVE > WAVEMAX_FITZ99_EXACT ) {
+      sprintf(c1err,"Requested WAVE=%.3f Angstroms", WAVE);
+      sprintf(c2err,"F99-like curves only valid in [%.1f, %.1f]A",
+	      WAVEMIN_FITZ99_EXACT, WAVEMAX_FITZ99_EXACT);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+    }
+
+    x = 10000.0/WAVE;
+    if ( WAVE <= 2700.0 ) 
+      { y = GALextinct_FM90(x, cFM[0], cFM[1], cFM[2], cFM[3], cFM[4], 
+			    cFM[5], cFM[6]); }
+    else
+      { y = GALextinct_FM_spline_eval(x, Nk, xF, yF, d2F); }
+
+    XT_LIST[i] = AV*(1.0 + y/RV);
+  }
+
+  return ;
+
+} // end GALextinct_array
+
+
+// ==================================================
+// Oct 2026: XT/AV per (RV,OPT,PARLIST,WAVE); see GALextinct_cache
+#define MXSTORE_GALEXTINCT_CACHE 200  // max (RV,OPT,PAR,WAVE) cache entries
+static struct {
+  int    NSTORE ;
+  int    OPT[MXSTORE_GALEXTINCT_CACHE] ;
+  double RV[MXSTORE_GALEXTINCT_CACHE],   WAVE[MXSTORE_GALEXTINCT_CACHE] ;
+  double PAR0[MXSTORE_GALEXTINCT_CACHE], PAR1[MXSTORE_GALEXTINCT_CACHE] ;
+  int    LINEAR[MXSTORE_GALEXTINCT_CACHE] ;     // 1 -> XT is linear in AV
+  double XT_per_AV[MXSTORE_GALEXTINCT_CACHE] ;  // A(WAVE)/AV
+} GALEXTINCT_CACHE ;
+
+double GALextinct_cache(double RV, double AV, double WAVE, int OPT, 
+			double *PARLIST, char *callFun) {
+
+  // Created Oct 2026
+  // Same as GALextinct, but for repeated calls with a few fixed
+  // wavelengths (e.g., filter <lam>) and fixed RV,OPT,PARLIST such as
+  // per-event MW extinction corrections. First call for each
+  // (RV,OPT,PARLIST,WAVE) stores XT/AV; later calls return AV*XT/AV
+  // without evaluating the color law.
+  // Linearity in AV is checked when each entry is stored;
+  // color laws with AV-dependent shape (e.g., SOMM25) always call 
+  // GALextinct. Cache-overflow also falls back to GALextinct.
+
+  int    i, NSTORE = GALEXTINCT_CACHE.NSTORE ;
+  double PAR0 = 0.0, PAR1 = 0.0, XT1, XT2 ;
+
+  // ------------ BEGIN ------------
+
+  if ( AV == 0.0 ) { return 0.0 ; }
+
+  if ( PARLIST != NULL ) { PAR0 = PARLIST[0];  PAR1 = PARLIST[1]; }
+
+  for(i=0; i < NSTORE; i++ ) {
+    if ( GALEXTINCT_CACHE.WAVE[i] != WAVE ) { continue; }
+    if ( GALEXTINCT_CACHE.RV[i]   != RV   ) { continue; }
+    if ( GALEXTINCT_CACHE.OPT[i]  != OPT  ) { continue; }
+    if ( GALEXTINCT_CACHE.PAR0[i] != PAR0 ) { continue; }
+    if ( GALEXTINCT_CACHE.PAR1[i] != PAR1 ) { continue; }
+
+    if ( GALEXTINCT_CACHE.LINEAR[i] ) 
+      { return AV * GALEXTINCT_CACHE.XT_per_AV[i] ; }
+    else
+      { return GALextinct(RV, AV, WAVE, OPT, PARLIST, callFun); }
+  }
+
+  if ( NSTORE >= MXSTORE_GALEXTINCT_CACHE ) 
+    { return GALextinct(RV, AV, WAVE, OPT, PARLIST, callFun); }
+
+  // store new entry
+  XT1 = GALextinct(RV, 1.0, WAVE, OPT, PARLIST, callFun);
+  XT2 = GALextinct(RV, 2.0, WAVE, OPT, PARLIST, callFun);
+
+  GALEXTINCT_CACHE.WAVE[NSTORE]      = WAVE ;
+  GALEXTINCT_CACHE.RV[NSTORE]        = RV ;
+  GALEXTINCT_CACHE.OPT[NSTORE]       = OPT ;
+  GALEXTINCT_CACHE.PAR0[NSTORE]      = PAR0 ;
+  GALEXTINCT_CACHE.PAR1[NSTORE]      = PAR1 ;
+  GALEXTINCT_CACHE.XT_per_AV[NSTORE] = XT1 ;
+  GALEXTINCT_CACHE.LINEAR[NSTORE]    = 
+    ( fabs(XT2 - 2.0*XT1) <= 1.0E-9 * fabs(XT2) ) ;
+  GALEXTINCT_CACHE.NSTORE++ ;
+
+  if ( GALEXTINCT_CACHE.LINEAR[NSTORE] ) 
+    { return AV * XT1 ; }
+  else
+    { return GALextinct(RV, AV, WAVE, OPT, PARLIST, callFun); }
+
+} // end GALextinct_cache
+
 // ========== FUNCTION TO RETURN EBV(SFD) =================
 void MWgaldust(
 	       double RA          // (I) RA
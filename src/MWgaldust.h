@@ -19,6 +19,12 @@
 //
 //  Mar 06 2025 R.Kessler - add callFun args to better track aborts
 //
+//  Oct 15 2026: add GALextinct_array to evaluate a wavelength array
+//               with F99-like spline computed once per RV.
+//  Oct 15 2026: add GALextinct_cache to store XT/AV for each band
+//               (RV,OPT,PARLIST,WAVE) so that per-event MW corrections
+//               do not re-evaluate the color law.
+//
 // =======================================
 
 
@@ -69,6 +75,9 @@
 #define WAVEMIN_SOMM25 700.0 // based on the plot/text in the paper
 #define WAVEMAX_SOMM25 9134.0 // based on the plots in the paper
 
+#define MXKNOT_FITZ99  12  // max spline knots for F99-like curves
+#define NPAR_FM90       7  // c1,c2,c3,c4,c5,x02,gamma2
+
 // =======================================
 //      SNANA-interface functons
 // =======================================
@@ -78,9 +87,17 @@ void MWgaldust(double RA,double DEC, double *avgal, double *EBV );
 // functions moved from sntools.c (Sep 2013)
 double GALextinct (double  RV, double  AV, double  WAVE, int  OPT, double *PARLIST, char *callFun);
 double galextinct_(double *RV, double *AV, double *WAVE, int *OPT, double *PARLIST, char *callFun);
+void   GALextinct_array(double RV, double AV, int NWAVE, double *WAVE_LIST,
+			int OPT, double *PARLIST, double *XT_LIST, char *callFun);
+double GALextinct_cache (double  RV, double  AV, double  WAVE, int  OPT, double *PARLIST, char *callFun);
+double galextinct_cache__(double *RV, double *AV, double *WAVE, int *OPT, double *PARLIST, char *callFun);
 
 double GALextinct_Fitz99_exact(double RV, double AV, double WAVE, int OPT, char *callFun);
 double GALextinct_FM_spline(double x, int Nk, double *xk, double *yk, int lin);
+void   GALextinct_Fitz99_knots(double RV, int OPT, int *Nk, double *xF, double *yF,
+			       double *cFM, char *callFun);
+void   GALextinct_FM_spline_d2(int Nk, double *xk, double *yk, double *d2y);
+double GALextinct_FM_spline_eval(double x, int Nk, double *xk, double *yk, double *d2y);
 double GALextinct_Pei4(double x, double c1, double c2, double c3, double c4);
 double GALextinct_FM90(double x, double c1, double c2, double c3, double c4,
                         double c5, double x02, double g2);
@@ -315,6 +315,47 @@ For help, run code with no arguments
    + do NOT require pIa variable for biascor to avoid false abort on LOWZ biascor.
        (in function SNTABLE_READPREP_TABLEVAR)
 
+ Oct 14 2026: nthread>1 uses persistent thread pool (created on first
+              fcn call) with dynamic chunks of events; see FCN_POOL.
+              MXTHREAD -> 128 (was 20).
+ Oct 14 2026: cache INTERPWGT(alpha,beta,gammadm) in fcn data loop;
+              see get_INTERPWGT_abg_cache.
+ Oct 14 2026: cosmodl uses tabulated H0/H(z) integral (sntools_cosmology)
+              for INPUTS.COSPAR and COSPAR_UNBLIND; see COSMODL_TABLE.
+ Oct 14 2026: new input fcn_grad=1 passes gradient to MINUIT (SET GRAD):
+              analytic d(chi2)/dM0 for z-bins, and central-difference
+              derivatives for other floated params; see fcn_grad_numeric.
+ Oct 15 2026: CC prior with opt_ccprior update bit: per-event map cell
+              and dmu-independent terms are precomputed once, so that 
+              each fcn call only evaluates PDF(dmu); see 
+              prep_PROBDMU_CCprior_fast & prob_CCprior_fast.
+ Oct 15 2026: new input fcn_soa=1 evaluates fcn for common case
+              (Ia-only, no biasCor or 1D biasCor, SALT2) with a 
+              branch-free loop over packed arrays; see MNCHI2FUN_SOA.
+ Oct 15 2026: check_duplicates_util uses a hash table on the match key
+              (O(N)) instead of z-sort + scan; merged duplicate keeps
+              first event in file order.
+ Oct 15 2026: new input opt_sigint_iter for sigint fit iterations:
+              +=1 -> warm start refits (skip SIMPLEX after 1st fit),
+              +=2 -> next sigint from cheap chi2red scan at fixed
+                     params (predict_covFitPar).
+ Oct 15 2026: USE_MPI build: each MPI rank evaluates chi2 for a slice
+              of the data events, and fcn sums are reduced over ranks;
+              see init_FCN_MPI & reduce_FCN_MPI.
+ Oct 14 2026: new input datafile_batch=<listFile> to fit each data file
+              in <listFile> with biasCor read once; see fork_datafile_batch.
+ Oct 14 2026: new input cachefile_biascor=<file> to write prepared
+              biasCor maps to binary cache, and to load them 
+              (skip reading biasCor) in later jobs with same key.
+ Oct 14 2026: nthread>1 also prepares biasCor sub-samples 
+              (SURVEYGROUP/FIELDGROUP_biasCor) in parallel threads.
+ Oct 14 2026: MUCOVSCALE MAD lists are stored in contiguous blocks
+              sorted by cell (OFFSET_CELL) instead of 2000-element
+              per-cell lists grown with realloc.
+ Oct 14 2026: reduce TABLEVAR memory for biasCor/CCprior: name & field
+              strings are one contiguous block (no per-row malloc),
+              and zCMBERR is read & stored only for data.
+
  ******************************************************/
 
 #include "sntools.h" 
@@ -323,6 +364,7 @@ For help, run code with no arguments
 #include <gsl/gsl_fit.h>  // Jun 13 2016
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
 
 #define USE_THREAD   // Sep 2020 : used in SUBPROCESS mode
 
@@ -330,13 +372,17 @@ For help, run code with no arguments
 #include <pthread.h>
 #endif
 
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
+
 // ==============================================
 // define data types to track selection cuts
 
 //#define BBC_VERSION  2
 //#define BBC_VERSION  3   // Jul 3 2020: add SUBPROCESS functions
 #define BBC_VERSION  4     // Sep 2020: add pthread option
-#define MXTHREAD    20
+#define MXTHREAD    128  // Oct 2026: 128 (was 20)
 
 #define EVENT_TYPE_DATA     1
 #define EVENT_TYPE_BIASCOR  2
@@ -353,6 +399,7 @@ char STRING_MINUIT_ERROR[2][8] = { "MIGRAD", "MINOS" };
 #define MAXPAR_MINUIT 110  // limit for MINUIT params (Sep 10 2017)
 
 #define MXFILE_DATA     20  // max number of data files to read
+#define MXJOB_DATAFILE_BATCH 2000 // max number of jobs in datafile_batch
 #define MXFILE_BIASCOR  20  // max number of biasCor files to read
 #define MXFILE_CCPRIOR  20  // max number of CCprior files to read
 
@@ -577,10 +624,22 @@ double  M0_DEFAULT;
 #define FITFLAG_CHI2         1    // repeat fit with nominal chi2
 #define FITFLAG_2LOGSIGMA    2    // repeat fit with chi2 + 2log(sigma)
 
+// Oct 2026: opt_sigint_iter bit-mask for sigint fit iterations
+#define MASK_SIGINT_ITER_WARM     1  // skip SIMPLEX after 1st fit
+#define MASK_SIGINT_ITER_PREDICT  2  // next sigint from fixed-param scan
+
 #define MAXMUBIN 20
 
 #define NCOSPAR 4  // size of cosPar array (OL,Ok,w0,wa)
 
+// Oct 2026: tabulated distances for fixed cosPar sets (blind, unblind)
+#define MXTABLE_COSMODL 2
+struct {
+  int    NTABLE ;
+  double COSPAR[MXTABLE_COSMODL][NCOSPAR];
+  HzFUN_INFO_DEF HzFUN_INFO[MXTABLE_COSMODL];
+} COSMODL_TABLE ;
+
 #define MXNUM_SAMPLE  25  // max number of SURVEY/FIELD samples (max IDSAMPLE)
 #define MXCHAR_SAMPLE 100 // max string length of sample name
 #define USERFLAG_SURVEYGROUP_SAMPLE  1  // bookkeeping for biasCor IDSAMPLE
@@ -629,6 +688,12 @@ typedef struct {
   double *DMU, *PROB, *MUBIAS;
   double *MUMODEL;    // store to avoid re-computing
   double COSPAR[10];  // store cos params used to compute MUMODEL
+
+  // Oct 2026: per-event terms that do not depend on dmu (fixed map
+  // cell), so that only dmu changes in each fcn call.
+  bool   READY_FAST ;
+  double **PDF ;          // -> MUZMAP->DMUPDF[IDSAMPLE][I3D], or NULL
+  double *GAUSS_AVG, *GAUSS_INVRMS, *GAUSS_NORM ; // NORM=0 -> prob=0
 } PROB_CCPRIOR_DEF ;  // Jul 29 2025
 
 
@@ -653,6 +718,7 @@ typedef struct {
   // variables read directly from table file.
   // use float to save memory, particularly for biasCor.
   char   **name, **field ;
+  char   *name_block, *field_block ; // contiguous storage for name,field
   float  *fitpar[NLCPAR+1], *fitpar_err[NLCPAR+1], *x0, *x0err, *mu, *muerr ;
   float  *COV_x0x1, *COV_x0c, *COV_x1c ;
   float  *zhd,     *zcmb,    *zhel,    *zprior,    *vpec ;
@@ -726,6 +792,17 @@ typedef struct  {
   int ia_min, ia_max, ib_min, ib_max, ig_min, ig_max ;
   double WGT[MXa][MXb][MXg];
 } INTERPWGT_AlphaBetaGammaDM ;
+
+// Oct 2026: small cache of INTERPWGT vs. (alpha,beta,gammadm) used in
+// fcn data loop; alpha & beta are usually the same for every event,
+// and gammadm takes only a few values (e.g., step in logmass).
+#define MXCACHE_INTERPWGT 4
+typedef struct {
+  int    N, NEXT ;  // number of cached entries, next entry to replace
+  double abg[MXCACHE_INTERPWGT][3] ;
+  INTERPWGT_AlphaBetaGammaDM INTERPWGT[MXCACHE_INTERPWGT] ;
+  int    NCALL, NHIT ;
+} INTERPWGT_CACHE_DEF ;
  
 
 #define MX3DMAP_CCPRIOR MXz*6*4 // Max of Nz bins X Nc bins X Nstretch bins
@@ -781,6 +858,11 @@ typedef struct {
   double   **MURES; //used only for MUCOVSCALE MAD option
   double   **MUCOV; //used only for MUCOVSCALE MAD option
 
+  // Oct 2026: above per-cell lists point into contiguous blocks
+  // sorted by cell; list for cell i1d starts at OFFSET_CELL[i1d].
+  int      *OFFSET_CELL ;
+  double   *ABSPULL_BLOCK, *PULL_BLOCK, *MURES_BLOCK, *MUCOV_BLOCK ;
+
 } CELLINFO_DEF ;
 
 
@@ -923,6 +1005,8 @@ struct {
   // Jan 2025: store spare list of rows passing SNRMIN_SIGINT cut
   int NCUT_SNRMIN_SIGINT;
   int *IROW_SNRMIN_SIGINT ;
+
+  bool PRELOAD_SIMFILE; // Oct 2026: simFile read before fork (batch mode)
   
 } INFO_BIASCOR;
 
@@ -1108,6 +1192,8 @@ struct INPUTS {
   int    write_ccprior_status; // for internal use to open in write or append mode
 
   int    minos;  // 1 -> use minos for full fit (very slow)
+  int    fcn_grad; // 1 -> fcn computes gradient for MINUIT (Oct 2026)
+  int    fcn_soa;  // 1 -> SoA fast path for common-case fcn (Oct 2026)
   int    minos2; // 1 -> use minos only for repeat after crazy errors
 
   int    nmax_tot ;   // Nmax to fit for all
@@ -1166,6 +1252,7 @@ struct INPUTS {
 
   double dchi2red_dsigint;    // option to input slope instead of computing it
   double sigint_step1 ;        // size of first sigint step, OR ...
+  int    opt_sigint_iter;     // see MASK_SIGINT_ITER_* (Oct 2026)
   double scale_covint_step1;  // size of first scale_covint step
   double covint_param_step1;  // one of the above
 
@@ -1330,6 +1417,14 @@ struct INPUTS {
 
   char cidlist_debug_biascor[100];
 
+  // Oct 2026: optional cache of prepared biasCor maps
+  char cachefile_biasCor[MXPATHLEN];
+  unsigned long long HASH_INPUTS_biasCor; // hash of input keys (see ppar)
+
+  // Oct 2026: list of data files to fit after reading biasCor once
+  char datafile_batch[MXPATHLEN];
+  int  nproc_batch;  // number of simultaneous child processes
+
 } INPUTS ;
 
 
@@ -1400,6 +1495,8 @@ struct {
   int IPARMAP_MN[MAXPAR];  // map minuit ipar to user ipar
   int IPARMAPINV_MN[MAXPAR];
 
+  bool USE_GRAD ; // fcn computes gradient for MINUIT (Oct 2026)
+
 } FITINP ; 
 
 
@@ -1443,9 +1540,75 @@ typedef struct {
   double nsnfitIa, nsnfitcc ;   // note double for sum of BBC Probs
   int    nsnfit, nsnfit_truecc ;
   int    nsnspecIa ; // Dec 1 2024
+
+  int    nchunk ; // Oct 2026: number of chunks fetched in this fcn call
+  int    ichunk ; // Oct 2026: index of current chunk
+
+  double grad_M0[MXz]; // Oct 2026: d(chi2)/dM0 vs. z-bin for fcn_grad
+  bool   use_soa ;     // Oct 2026: loop over FCN_SOA arrays
   
 } thread_chi2sums_def ;
 
+// Oct 2026: structure-of-arrays copy of the data for the common fcn
+// path (Ia-only, no biasCor or 1D biasCor, SALT2). Only events passing
+// cuts are stored, so that the fcn loop has no branches and can be
+// vectorized. Arrays are filled by prep_FCN_SOA before each MINUIT fit;
+// M0 = M0C + W0*M0LIST[IZ0] + W1*M0LIST[IZ1] (see fcn_M0).
+struct {
+  bool   READY ;
+  int    NSN, NSN_ALLOC ;
+  int    *ISN ;          // index in INFO_DATA
+  int    *IZ0, *IZ1 ;    // M0 z-bin indices
+  double *W0,  *W1, *M0C ;
+  double *z, *logmass, *d, *s, *c ;
+  double *mu0 ;          // mumodel + muBias
+  double *C00, *C01, *C02, *C11, *C12, *C22 ; // symmetrized covmat_tot
+  double *ADDSQ ;        // vpec & lensing muerr^2, or MUERR_FITWGT0^2
+  double *muerrsq_last ;
+  double *gammaDM, *mures, *muerrsq ; // scratch filled in each fcn call
+} FCN_SOA ;
+
+// Oct 2026: for USE_MPI build, every rank reads the data & biasCor and
+// runs the same MINUIT sequence. In each fcn call, a rank evaluates
+// chi2 for a contiguous slice [ISN_MIN,ISN_MAX) of the data events
+// (with optional nthread threads), and partial sums are reduced over
+// ranks so that all ranks get the same fval. Only rank 0 writes output.
+struct {
+  int IRANK, NRANK ;      // NRANK=1 w/o USE_MPI
+  int ISN_MIN, ISN_MAX ;  // data slice for this rank in current fcn call
+} FCN_MPI ;
+
+// Oct 2026: persistent pool of fcn threads. Threads are created once;
+// for each fcn call they are woken up, and each thread fetches chunks
+// of NSN_CHUNK events from a shared counter (ICHUNK_NEXT) until all 
+// events are processed. Main thread processes chunks as id_thread=0.
+// Partial sums are stored per chunk and summed in chunk order so that
+// fval does not depend on which thread processed which chunk.
+#ifdef USE_THREAD
+typedef struct {
+  double chi2sum_tot, chi2sum_Ia ;
+  double nsnfitIa, nsnfitcc ;
+  int    nsnfit, nsnfit_truecc, nsnspecIa ;
+  double grad_M0[MXz];
+} chunk_chi2sums_def ;
+
+struct {
+  bool   INIT ;
+  int    NTHREAD ;
+  pthread_t            THREAD[MXTHREAD];
+  thread_chi2sums_def  CHI2SUMS[MXTHREAD];
+  int                  ID[MXTHREAD]; 
+  pthread_mutex_t MUTEX ;
+  pthread_cond_t  COND_START, COND_DONE ;
+  int    GENERATION ;  // incremented for each fcn call
+  int    NDONE ;       // number of worker threads done with this call
+  int    NSN, NSN_CHUNK, ISN_FIRST ;
+  int    NCHUNK, MXCHUNK ;
+  int    ICHUNK_NEXT ; // next chunk to process; updated atomically
+  chunk_chi2sums_def *CHUNKSUMS ; // partial sums per chunk
+} FCN_POOL ;
+#endif
+
 
 // define fit results
 struct {
@@ -1459,6 +1622,7 @@ struct {
   double CHI2RED_ALL;  // global reduced chi2
   double CHI2SUM_IA;   // chi2 sum for Ia subset
   double CHI2RED_IA;   // reduced chi2 for Ia subset
+  double CHI2RED_IA_FCN; // idem, from most recent fcn call (any iflag)
   double ALPHA, BETA, GAMMA;  
 
   // maybe replace these with CONTAMIN_INFO ??
@@ -1537,6 +1701,8 @@ int  SALT2mu_DRIVER_SUMMARY(void);
 
 void apply_blindpar(void);
 void check_duplicates_util(int EVENT_TYPE);
+unsigned int hash_duplicate_util(bool IS_DATA, char *name, 
+				 float z, float c, float s);
 void check_redshifts(void) ;
 void check_vpec_sign(void);
 void check_zhel(void) ;
@@ -1661,6 +1827,10 @@ void   prepare_CCprior(void);
 void   set_INTERPWGT_abg(INTERPWGT_AlphaBetaGammaDM *INTERPWGT, double VAL);
 void   get_INTERPWGT_abg(double alpha,double beta,double gammadm, int DUMPFLAG,
 			INTERPWGT_AlphaBetaGammaDM *INTERPWGT, char *callFun );
+void   get_INTERPWGT_abg_cache(double alpha,double beta,double gammadm, 
+			      INTERPWGT_CACHE_DEF *CACHE,
+			      INTERPWGT_AlphaBetaGammaDM *INTERPWGT, 
+			      char *callFun );
 
 void   fcnFetch_AlphaBetaGamma(double *xval, double z, double logmass,
 			       double *alpha, double *beta, double *gammadm );
@@ -1672,6 +1842,12 @@ int    storeBias_CCprior(int n) ;
 void  malloc_PROB_CCprior(TABLEVAR_DEF *TABLEVAR, MUZMAP_DEF *MUZMAP,  PROB_CCPRIOR_DEF *PROB_CCPRIOR);
 void  load_DMU_CCprior(TABLEVAR_DEF *TABLEVAR, double *ABGM, PROB_CCPRIOR_DEF *PROB_CCPRIOR);
 void  load_PROBDMU_CCprior(TABLEVAR_DEF *TABLEVAR, MUZMAP_DEF *MUZMAP, PROB_CCPRIOR_DEF *PROB_CCPRIOR);
+void  prep_PROBDMU_CCprior_fast(TABLEVAR_DEF *TABLEVAR, MUZMAP_DEF *MUZMAP,
+				PROB_CCPRIOR_DEF *PROB_CCPRIOR);
+double prob_CCprior_fast(MUZMAP_DEF *MUZMAP, PROB_CCPRIOR_DEF *PROB_CCPRIOR,
+			 int isn, double dmu);
+void  eval_PROBDMU_CCprior(MUZMAP_DEF *MUZMAP, PROB_CCPRIOR_DEF *PROB_CCPRIOR,
+			   int NSN, double *DMU, double *PROB);
 void  get_FITPAR_INDICES_CCprior(int icc, TABLEVAR_DEF *TABLEVAR, MUZMAP_DEF *MUZMAP, 
 				 int *i3list, int *i3d, int *i3d_nn);
 
@@ -1727,6 +1903,25 @@ void  get_BININFO_biasCor_abg(char *varName, double *VAL_MIN,
 void check_abg_minmax_biasCor(char *varName, double *valmin_list,
 			      double *valmax_list) ;				    
 void  makeMap_fitPar_biasCor(int ISAMPLE, int ipar_LCFIT);
+void  prepare_biasCor_sample(int IDSAMPLE);
+void  prepare_biasCor_threads(int nthread);
+
+void  fork_datafile_batch(void);
+int   read_datafile_batch(char *listFile, char **dataFile_list, 
+			  char **prefix_list);
+int   wait_datafile_batch(int NJOB, pid_t *PID_LIST, char **prefix_list);
+void  prep_datafile_batch(char *dataFile, char *prefix);
+
+void  update_HASH_INPUTS_biasCor(char *item);
+void  update_KEY_cache_biasCor(unsigned long long *KEY, char *string);
+unsigned long long get_KEY_cache_biasCor(void);
+bool  use_cache_biasCor(void);
+bool  read_cache_biasCor(void);
+void  write_cache_biasCor(void);
+void  io_cache_biasCor(int OPT, FILE *fp);
+void  io_block_cache_biasCor(int OPT, FILE *fp, void *ptr, size_t size, 
+			     size_t n);
+void  set_MAPCELL_MUCOV(CELLINFO_DEF *CELLINFO);
 void  makeMap_sigmu_biasCor(int ISAMPLE);   
 void  vpec_biasCor(void);
 
@@ -1832,12 +2027,16 @@ bool    crazy_M0_errors(void);
 void    compute_AVG_muCOVscale(double *AVG_muCOVscale);
 void    conflict_check(void);
 double  next_covFitPar(double redchi2, double orig_parval, double parstep);
+double  predict_covFitPar(double redchi2, double orig_parval, double parstep);
+double  eval_redchi2_covFitPar(double parval, double *xval);
 void    recalc_dataCov(void); 
 
 //Utility function definitions
 double cosmodl_forFit(double zhel, double zcmb, double *cosPar);
 double cosmodl(double zhel, double zcmb, double *cosPar);
 double inc    (double zcmb, double *cosPar);
+void   init_COSMODL_TABLE(double *cosPar);
+int    find_COSMODL_TABLE(double *cosPar);
 
 void ludcmp(double* a, const int n, const int ndim, int* indx, 
 	    double* d, int* icon);
@@ -1848,7 +2047,9 @@ double rombint(double f(double z, double *cosPar),
 
 double avemag0_calc(int opt_dump);
 void   M0dif_calc(void) ;
-double fcn_M0(int n, double *M0LIST );
+double fcn_M0(int n, double *M0LIST, int *IZ_DERIV, double *DERIV );
+bool   use_fcn_grad(void);
+void   fcn_grad_numeric(int *npar, double *grad, double *xval);
 
 void   muerr_renorm(void);
 void   printCOVMAT(FILE *fp, int NPAR, int NPARz_write);
@@ -1906,6 +2107,20 @@ void mnpout_(const int* num, char chnam[], double* val, double* error,
 
 
 void *MNCHI2FUN(void *thread);
+void *MNCHI2FUN_SOA(void *thread);
+bool  use_FCN_SOA(void);
+void  prep_FCN_SOA(void);
+void  init_FCN_POOL(int nthread);
+void *worker_FCN_POOL(void *arg);
+int   next_isn_FCN_POOL(thread_chi2sums_def *thread_chi2sums, int isn);
+void  store_chunk_FCN_POOL(thread_chi2sums_def *thread_chi2sums, int ichunk,
+			   double chi2sum_tot, double chi2sum_Ia,
+			   double nsnfitIa, double nsnfitcc, int nsnfit, 
+			   int nsnfit_truecc, int nsnspecIa);
+void  zero_chunk_FCN_POOL(chunk_chi2sums_def *CHUNK);
+void  init_FCN_MPI(void);
+void  reduce_FCN_MPI(double *SUMS, int NSUM);
+void  end_FCN_MPI(void);
 
 typedef void (mfcn)( int* npar, double grad[], double* fval,
 	 double xval[], int* iflag, void*);
@@ -1932,6 +2147,11 @@ int   malloc_TABLEVAR_CUTVAL(int LEN_MALLOC, int icut,
 float malloc_FITPARBIAS_ALPHABETA(int opt, int LEN_MALLOC, 
 				  FITPARBIAS_DEF *****FITPARBIAS );
 float malloc_MUCOV(int opt, int IDSAMPLE, CELLINFO_DEF *cellinfo);
+void  load_MADLIST_MUCOV(int NLIST, int *I1D_LIST, 
+			 double *ABSPULL_LIST, double *PULL_LIST,
+			 double *MURES_LIST, double *MUCOV_LIST,
+			 CELLINFO_DEF *CELLINFO);
+void  free_MADLIST_MUCOV(CELLINFO_DEF *CELLINFO);
 
 // ======================================================================
 // ==== GLOBALS AND FUNCTIONS TO USE SALT2mu as SUBPROCESS ==============
@@ -2102,6 +2322,8 @@ int main(int argc,char* argv[ ]) {
   if ( FLAG == FLAG_EXEC_REPEAT ) { goto DRIVER_EXEC; } // e.g., NSPLITRAN
 
   fprintf(FP_STDOUT, "\n Done. \n"); fflush(FP_STDOUT);
+
+  end_FCN_MPI();
   
   return(0) ;
 
@@ -2149,11 +2371,17 @@ void SALT2mu_DRIVER_INIT(int argc, char **argv) {
   // check for conflicts between input variables
   conflict_check();
 
+  // check for MPI ranks (USE_MPI build only)
+  init_FCN_MPI();
+
   TABLEFILE_INIT();  // call before prep_input_driver , 9.28.2020
 
   // prepare input (ISMODEL_LCFIT_SALT2/BAYESN determined here)
   prep_input_driver();
 
+  // check option to fit list of data files; only child processes return
+  if ( strlen(INPUTS.datafile_batch) > 0 ) { fork_datafile_batch(); }
+
   //  test_zmu_solve();
   //  test_muerrz(); // xxxx
 
@@ -2262,6 +2490,14 @@ void SALT2mu_DRIVER_EXEC(void) {
   // execuate minuit mnparm_ commands
   exec_mnparm(); 
 
+  // check option for fcn to compute gradient; MINUIT checks fcn 
+  // gradient and reverts to its own derivatives if they disagree
+  FITINP.USE_GRAD = use_fcn_grad();
+  if ( FITINP.USE_GRAD ) {
+    strcpy(mcom,"SET GRA");   len = strlen(mcom);
+    mncomd_(fcn, mcom, &icondn, &null, len);  fflush(FP_STDOUT);
+  }
+
   // use FCN call and make chi2-outlier cut (Jul 19 2019)
   applyCut_chi2max();
 
@@ -2277,9 +2513,17 @@ void SALT2mu_DRIVER_EXEC(void) {
   // Beginning of DOFIT loop
   while ( DOFIT_FLAG != FITFLAG_DONE  ) {
 
-    //Miniut MINIMIZE using SIMplex
-    strcpy(mcom,"SIM 1000");   len = strlen(mcom);
-    mncomd_(fcn, mcom, &icondn, &null, len);  fflush(FP_STDOUT);
+    // pack data for fast fcn path (covmat_tot changes each iteration)
+    prep_FCN_SOA();
+
+    //Miniut MINIMIZE using SIMplex; for warm start, refits begin
+    // at previous minimum and MIGRAD uses previous covariance.
+    bool SKIP_SIMPLEX = ( FITRESULT.NFIT_ITER > 0 && 
+			  (INPUTS.opt_sigint_iter & MASK_SIGINT_ITER_WARM) );
+    if ( !SKIP_SIMPLEX ) {
+      strcpy(mcom,"SIM 1000");   len = strlen(mcom);
+      mncomd_(fcn, mcom, &icondn, &null, len);  fflush(FP_STDOUT);
+    }
 
     // minimize with MIGRAD
     strcpy(mcom,"MINI");   len = strlen(mcom);
@@ -2294,6 +2538,7 @@ void SALT2mu_DRIVER_EXEC(void) {
     //Final call to FCN at minimum of chi-squared
     strcpy(mcom,"CALL FCN 3");  len = strlen(mcom);
     mncomd_(fcn, mcom, &icondn, &null, len);   fflush(FP_STDOUT);
+    FCN_SOA.READY = false ;
 
     mnstat_(&chi2min, &fedm, &errdef, &npari, &nparx, &istat);
     ndof = FITRESULT.NSNFIT - npari; 
@@ -2386,8 +2631,8 @@ int SALT2mu_DRIVER_SUMMARY(void) {
   muerr_renorm();
 
   // ------------------------------------------------
-  // check files to write
-  outFile_driver();
+  // check files to write (only rank 0 for MPI)
+  if ( FCN_MPI.IRANK == 0 ) { outFile_driver(); }
 
   //---------
   if ( NJOB_SPLITRAN < INPUTS.NSPLITRAN  &&  INPUTS.JOBID_SPLITRAN<0 ) 
@@ -2414,6 +2659,244 @@ int SALT2mu_DRIVER_SUMMARY(void) {
 
 } // end SALT2mu_DRIVER_SUMMARY
 
+
+// ********************************************
+void fork_datafile_batch(void) {
+
+  // Created Oct 2026
+  // For datafile_batch=<listFile>, fit each data file in <listFile>
+  // in a separate child process. The parent reads the biasCor
+  // simFile(s) once before the fork so that each child inherits
+  // (copy-on-write) the biasCor table without re-reading it; each
+  // child then reads its data, prepares biasCor maps & CCprior, and
+  // runs the fit with outputs [prefix].*  and log [prefix].LOG .
+  // Up to nproc_batch children run simultaneously.
+  // If cachefile_biascor is set, the first job runs alone to write
+  // the cache, and later jobs load maps from the cache.
+  // The parent waits for all children and exits; only child
+  // processes return from this function.
+
+  int   NPROC = INPUTS.nproc_batch ;
+  int   NJOB, ijob, NRUN = 0, NERR = 0 ;
+  char  *dataFile_list[MXJOB_DATAFILE_BATCH];
+  char  *prefix_list[MXJOB_DATAFILE_BATCH];
+  pid_t  pid, PID_LIST[MXJOB_DATAFILE_BATCH];
+  bool   USE_CACHE = use_cache_biasCor() ;
+  char fnam[] = "fork_datafile_batch" ;
+
+  // ------------ BEGIN -------------
+
+  if ( NPROC < 1 ) { NPROC = 1; }
+
+  if ( INPUTS.JOBID_SPLITRAN > 0 || INPUTS.NSPLITRAN > 1 || 
+       INPUTS.cat_only || SUBPROCESS.USE ) {
+    sprintf(c1err,"datafile_batch not compatible with NSPLITRAN, ");
+    sprintf(c2err,"cat_only  or SUBPROCESS mode.");
+    errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err); 
+  }
+
+  NJOB = read_datafile_batch(INPUTS.datafile_batch, 
+			     dataFile_list, prefix_list);
+
+  sprintf(BANNER,"%s: fit %d data files with %d simultaneous jobs", 
+	  fnam, NJOB, NPROC);
+  fprint_banner(FP_STDOUT,BANNER);
+
+  // read biasCor once; skip if maps are loaded from cache
+  if ( INPUTS.nfile_biasCor > 0 && !USE_CACHE &&
+       strcmp(INPUTS.simFile_biasCor[0],"datafile") != 0 ) {
+    USE_EVENT_TYPE[EVENT_TYPE_BIASCOR] = true;
+    SNTABLE_VERSION_PHOTOMETRY[0] = 0; 
+    read_simFile_biasCor();
+    INFO_BIASCOR.PRELOAD_SIMFILE = true ;
+  }
+
+  // flush before fork to avoid duplicate buffered output in children
+  fflush(FP_STDOUT);  fflush(stdout);
+
+  for(ijob=0; ijob < NJOB; ijob++ ) {
+
+    // wait for a free slot; first job runs alone to write cache
+    while ( NRUN >= NPROC || (USE_CACHE && ijob==1 && NRUN>0) ) 
+      { NERR += wait_datafile_batch(ijob, PID_LIST, prefix_list); NRUN--; }
+
+    pid = fork();
+    if ( pid < 0 ) {
+      sprintf(c1err,"fork failed for job %d", ijob );
+      sprintf(c2err,"dataFile = %s", dataFile_list[ijob] );
+      errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err); 
+    }
+    else if ( pid == 0 ) {
+      // child process
+      prep_datafile_batch(dataFile_list[ijob], prefix_list[ijob]);
+      return ;
+    }
+
+    PID_LIST[ijob] = pid ;  NRUN++ ;
+    fprintf(FP_STDOUT,"\t Start job %3d (pid=%d): %s -> %s \n",
+	    ijob, (int)pid, dataFile_list[ijob], prefix_list[ijob] );
+    fflush(FP_STDOUT);
+  }
+
+  // - - - - - - - - - - - - - - - - - - - - - 
+  // parent: wait for remaining children
+  while ( NRUN > 0 ) 
+    { NERR += wait_datafile_batch(NJOB, PID_LIST, prefix_list); NRUN--; }
+
+  print_cputime(t_start, "CPU(datafile_batch)", UNIT_TIME_MINUTE, 0);
+
+  if ( NERR > 0 ) {
+    sprintf(c1err,"%d of %d datafile_batch jobs failed", NERR, NJOB);
+    sprintf(c2err,"Check [prefix].LOG files");
+    errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err); 
+  }
+
+  fprintf(FP_STDOUT, "\n Done with %d datafile_batch jobs. \n", NJOB); 
+  fflush(FP_STDOUT);
+  exit(0);
+
+} // end fork_datafile_batch
+
+
+// ********************************************
+int wait_datafile_batch(int NJOB, pid_t *PID_LIST, char **prefix_list) {
+
+  // Created Oct 2026
+  // Wait for any child process among first NJOB jobs to finish,
+  // and print status. Returns 1 if child failed; else returns 0.
+
+  int   ijob, wstatus ;
+  pid_t pid ;
+
+  // ------------ BEGIN -------------
+
+  pid = wait(&wstatus);
+  if ( pid < 0 ) { return(1); }
+
+  for(ijob=0; ijob < NJOB; ijob++ ) {
+    if ( PID_LIST[ijob] != pid ) { continue; }
+    if ( !WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0 ) {
+      fprintf(FP_STDOUT," ERROR: job %d failed; see %s.LOG\n",
+	      ijob, prefix_list[ijob] );
+      fflush(FP_STDOUT);
+      return(1);
+    }
+    fprintf(FP_STDOUT,"\t Done with job %3d : %s \n", 
+	    ijob, prefix_list[ijob] );
+    fflush(FP_STDOUT);
+  }
+
+  return(0);
+
+} // end wait_datafile_batch
+
+
+// ********************************************
+int read_datafile_batch(char *listFile, char **dataFile_list, 
+			char **prefix_list) {
+
+  // Created Oct 2026
+  // Read datafile_batch list file: each line is
+  //    <dataFile>  [prefix]
+  // where dataFile can be comma-sep list as for datafile= input.
+  // Default prefix is [PREFIX]_NNN, where NNN is the job index.
+  // Blank lines and lines starting with # are ignored.
+  // Functions returns number of jobs.
+
+  int  NJOB = 0, NWD ;
+  char line[MXCHAR_DATAFILE_STRING+MXPATHLEN], 
+    dataFile[MXCHAR_DATAFILE_STRING], prefix[MXPATHLEN] ;
+  FILE *fp ;
+  char fnam[] = "read_datafile_batch" ;
+
+  // ------------ BEGIN -------------
+
+  fp = fopen(listFile,"rt");
+  if ( !fp ) {
+    sprintf(c1err,"Could not open datafile_batch list:");
+    sprintf(c2err,"%s", listFile);
+    errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err); 
+  }
+
+  while ( fgets(line, sizeof(line), fp) != NULL ) {
+    dataFile[0] = prefix[0] = 0 ;
+    NWD = sscanf(line, "%s %s", dataFile, prefix);
+    if ( NWD < 1 || dataFile[0] == '#' ) { continue; }
+
+    if ( NJOB >= MXJOB_DATAFILE_BATCH ) {
+      sprintf(c1err,"Number of jobs exceeds MXJOB_DATAFILE_BATCH=%d",
+	      MXJOB_DATAFILE_BATCH);
+      sprintf(c2err,"Check %s", listFile);
+      errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err); 
+    }
+
+    if ( NWD < 2 ) {
+      if ( IGNOREFILE(INPUTS.PREFIX) ) {
+	sprintf(c1err,"Must specify prefix= input, or prefix");
+	sprintf(c2err,"in 2nd column of %s", listFile);
+	errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err); 
+      }
+      sprintf(prefix,"%s_%3.3d", INPUTS.PREFIX, NJOB);
+    }
+
+    dataFile_list[NJOB] = (char*) malloc(strlen(dataFile)+1);
+    prefix_list[NJOB]   = (char*) malloc(strlen(prefix)+1);
+    sprintf(dataFile_list[NJOB], "%s", dataFile);
+    sprintf(prefix_list[NJOB],   "%s", prefix);
+    NJOB++ ;
+  }
+  fclose(fp);
+
+  if ( NJOB == 0 ) {
+    sprintf(c1err,"No data files found in datafile_batch list");
+    sprintf(c2err,"%s", listFile);
+    errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err); 
+  }
+
+  return(NJOB);
+
+} // end read_datafile_batch
+
+
+// ********************************************
+void prep_datafile_batch(char *dataFile, char *prefix) {
+
+  // Created Oct 2026
+  // Called by child process after fork to set data file(s) and
+  // prefix for this job, and to re-direct stdout to [prefix].LOG.
+
+  int  ifile ;
+  char logFile[MXPATHLEN+10];
+  char fnam[] = "prep_datafile_batch" ;
+
+  // ------------ BEGIN -------------
+
+  sprintf(logFile,"%s.LOG", prefix);
+  if ( freopen(logFile, "wt", stdout) == NULL ) {
+    sprintf(c1err,"Could not open log file for batch job:");
+    sprintf(c2err,"%s", logFile);
+    errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err); 
+  }
+  FP_STDOUT = stdout;
+
+  sprintf(INPUTS.PREFIX, "%s", prefix);
+  sprintf(INPUTS.dataFile_string, "%s", dataFile);
+  parse_commaSepList("DATAFILE", dataFile, MXFILE_DATA, MXCHAR_FILENAME, 
+		     &INPUTS.nfile_data, &INPUTS.dataFile );
+
+  for(ifile=0; ifile < INPUTS.nfile_data; ifile++ ) 
+    { ENVreplace(INPUTS.dataFile[ifile],fnam,1); }
+
+  fprintf(FP_STDOUT, "\n %s: datafile=%s  prefix=%s \n", 
+	  fnam, dataFile, prefix);
+  if ( INFO_BIASCOR.PRELOAD_SIMFILE ) {
+    fprintf(FP_STDOUT, " %s: use %d biasCor events read before fork.\n",
+	    fnam, INFO_BIASCOR.TABLEVAR.NSN_ALL);
+  }
+  fflush(FP_STDOUT);
+
+} // end prep_datafile_batch
+
 // ********************************************
 void exec_mnparm(void) {
 
@@ -3463,6 +3946,10 @@ void check_duplicates_util(int EVENT_TYPE) {
   //  (i.e., check for biasCor is interactive only)
   //
   // Apr 24 2024: Adapted for BayeSN
+  // Oct 15 2026: replace z-sort + scan of equal-z runs (quadratic when
+  //    many events share z) with open-addressing hash table keyed on
+  //    the same match variables: data -> (SNID,z), biasCor -> (z,c,s).
+  //    Each duplicate set is anchored on its first event in file order.
   
   char *STRTYPE     = STRING_EVENT_TYPE[EVENT_TYPE];
   bool IS_DATA      = EVENT_TYPE == EVENT_TYPE_DATA ;
@@ -3470,11 +3957,10 @@ void check_duplicates_util(int EVENT_TYPE) {
   int  MXSTORE      = MXSTORE_DUPLICATE ;
   int  debug_malloc = INPUTS.debug_malloc ;
 
-  int  isn, isn2, nsn, MEMD, MEMI, MEMB, IDSURVEY ;
-  int  unsort, unsort2, *unsortList, ORDER_SORT   ;
-  bool IS_SIM ;
+  int  isn, isn2, nsn, MEMI, IDSURVEY ;
+  int  unsort, *HASH_TABLE, *NEXT_DUPL, *LAST_DUPL ;
+  unsigned int NHASH, ihash ;
   float  *zList, *cList, *sList, z, s, c  ;
-  bool   *IS_DUPL;
   TABLEVAR_DEF *TABLEVAR;
   char string_match_varlist[60], str_SIM_prefix[12], str_SIM_ab[40];
   char fnam[] = "check_duplicates_util" ;
@@ -3500,12 +3986,17 @@ void check_duplicates_util(int EVENT_TYPE) {
   print_debug_malloc(+1*debug_malloc,fnam);
   nsn     = TABLEVAR->NSN_ALL ;
 
+  // hash table size is power of 2 with load factor <= 0.5
+  NHASH = 16;
+  while ( NHASH < 2*(unsigned int)nsn ) { NHASH *= 2; }
+
   MEMI = (nsn+1) * sizeof(int)   ;
-  MEMB = (nsn+1) * sizeof(bool)  ;
-  unsortList = (int    *)malloc(MEMI); // allocate sorted list
-  IS_DUPL    = (bool   *)malloc(MEMB);
+  HASH_TABLE = (int *)malloc(NHASH*sizeof(int)); // first event per key
+  NEXT_DUPL  = (int *)malloc(MEMI); // next duplicate in set, or -1
+  LAST_DUPL  = (int *)malloc(MEMI); // last event in set (for anchor)
 
-  for(isn=0; isn<nsn; isn++)  { IS_DUPL[isn] = false; }
+  for(ihash=0; ihash < NHASH; ihash++ ) { HASH_TABLE[ihash] = -1; }
+  for(isn=0; isn<nsn; isn++)  { NEXT_DUPL[isn] = LAST_DUPL[isn] = -1; }
 
   // B.P.Done - update parameter names to be more general
 
@@ -3521,13 +4012,9 @@ void check_duplicates_util(int EVENT_TYPE) {
     sList = TABLEVAR->SIM_FITPAR[INDEX_s] ;  
   }
 
-  ORDER_SORT = + 1 ; // increasing order
-  sortFloat( nsn, zList, ORDER_SORT, unsortList ) ;
-
-  bool  SAME, FOUND_DUPL ;
+  bool  SAME ;
   int   NTMP, idup, evt ;
-  float s2, c2, z2 ;
-  char *snid, *snid2, *survey, snid_plus_survey[60] ;
+  char *snid, *survey, snid_plus_survey[60] ;
   int  **UNSORT_DUPL;
   int  *NDUPL_LIST; // how many duplicates per set
   int  NDUPL_SET ; // number of duplicate sets
@@ -3547,65 +4034,44 @@ void check_duplicates_util(int EVENT_TYPE) {
   NDUPL_SET = NDUPL_TOT = NDUPL_SN = 0 ;
 
   // - - - - - - - - - - - - - - - -
+  // pass 1: insert each event; if key already exists, chain this
+  // event onto the set anchored by the first event with that key.
+  for ( isn=0; isn < nsn; isn++ ) {
+    z     = zList[isn];  c = cList[isn];  s = sList[isn];
+    snid  = TABLEVAR->name[isn];
+    ihash = hash_duplicate_util(IS_DATA, snid, z, c, s) & (NHASH-1) ;
+
+    while ( (isn2 = HASH_TABLE[ihash]) >= 0 ) {
+      if ( IS_DATA ) 
+	{ SAME = ( z == zList[isn2] && strcmp(snid,TABLEVAR->name[isn2])==0 ); }
+      else
+	{ SAME = ( z == zList[isn2] && c == cList[isn2] && s == sList[isn2] ); }
+      if ( SAME ) { break; }
+      ihash = (ihash+1) & (NHASH-1) ; // linear probe
+    }
 
-  for ( isn=0; isn < nsn-1; isn++ ) {
-    unsort  = unsortList[isn];
-    z = zList[unsort];
-    c = cList[unsort]; 
-    s = sList[unsort]; 
-    snid   = TABLEVAR->name[unsort];    
-
-    NDUPL_PER_SET = 0 ;
-
-    if ( IS_DUPL[isn] ) { continue; }  else { N_UNIQUE++ ; }
-
-    isn2 = isn  ;      z2 = z; c2=c; s2=s;   FOUND_DUPL=false;
-
-    while ( z == z2 && isn2 < nsn-1 ) {
-      isn2++ ;
-      unsort2    = unsortList[isn2];
-      z2         = zList[unsort2];
-      c2         = cList[unsort2];
-      s2         = sList[unsort2];
-      snid2      = TABLEVAR->name[unsort2];
+    if ( isn2 < 0 ) 
+      { HASH_TABLE[ihash] = isn;  LAST_DUPL[isn] = isn;  N_UNIQUE++ ; }
+    else
+      { NEXT_DUPL[LAST_DUPL[isn2]] = isn;  LAST_DUPL[isn2] = isn; }
+  }
 
-      if ( IS_DATA ) 
-	{ SAME  = ( strcmp(snid,snid2) == 0 ); }
-      else if ( IS_BIASCOR ) 
-	{ SAME  = ( z==z2 && c == c2 && s2==s ); }
-
-      if ( IS_DUPL[isn2] ) { continue; }
-      if ( !SAME         ) { continue; }
-
-      // we have a duplicate
-      NDUPL_TOT++ ; 
-      IS_DUPL[isn] = IS_DUPL[isn2] = true; 
-
-      // store this duplicate
-      if ( !FOUND_DUPL ) {
-	// first duplicate for isn; store isn info
-	FOUND_DUPL = true;
-	NDUPL_SET++ ;  // increment number of duplicate sets
-	NDUPL_SN++ ;
-	NDUPL_PER_SET++ ;
-	if ( NDUPL_SET <= MXSTORE ) {
-	  NTMP = NDUPL_LIST[NDUPL_SET-1] ;
-	  UNSORT_DUPL[NDUPL_SET-1][NTMP] = unsort ;
-	  NDUPL_LIST[NDUPL_SET-1]++ ;
-	}
-      }
+  // pass 2: store each set in file order of its anchor event
+  for ( isn=0; isn < nsn; isn++ ) {
+    if ( LAST_DUPL[isn] < 0 || NEXT_DUPL[isn] < 0 ) { continue; }
 
-      // always store isn2 info
-      NDUPL_PER_SET++ ;
+    NDUPL_SET++ ;  // increment number of duplicate sets
+    NDUPL_PER_SET = 0 ;
+    for ( unsort = isn; unsort >= 0; unsort = NEXT_DUPL[unsort] ) {
+      NDUPL_PER_SET++ ;  NDUPL_SN++ ;
       if ( NDUPL_SET <= MXSTORE ) {
 	NTMP = NDUPL_LIST[NDUPL_SET-1] ;
 	if( NTMP < MXSET_DUPLICATE ) 
-	  { UNSORT_DUPL[NDUPL_SET-1][NTMP] = unsort2 ; }
+	  { UNSORT_DUPL[NDUPL_SET-1][NTMP] = unsort ; }
 	NDUPL_LIST[NDUPL_SET-1]++ ;
       }
-      NDUPL_SN++ ;
-     
-    }  // end z==z2 (isn2 loop)
+    }
+    NDUPL_TOT += (NDUPL_PER_SET-1);
     if ( NDUPL_PER_SET > MXDUPL_PER_SET ) { MXDUPL_PER_SET = NDUPL_PER_SET; }
 
   } // end loop over isn
@@ -3699,7 +4165,7 @@ void check_duplicates_util(int EVENT_TYPE) {
 
  DONE:
   print_debug_malloc(-1*debug_malloc,fnam);
-  free(unsortList); free(IS_DUPL);
+  free(HASH_TABLE); free(NEXT_DUPL); free(LAST_DUPL);
   
   free(NDUPL_LIST);
   for(idup=0; idup < MXSTORE; idup++ )  { free(UNSORT_DUPL[idup]); }
@@ -3711,6 +4177,41 @@ void check_duplicates_util(int EVENT_TYPE) {
 
 } // end of check_duplicates_util
 
+// =============================================
+unsigned int hash_duplicate_util(bool IS_DATA, char *name, 
+				 float z, float c, float s) {
+
+  // Created Oct 2026
+  // FNV-1a hash of duplicate-match key for check_duplicates_util:
+  //   data    -> SNID string and z
+  //   biasCor -> bits of SIM z,c,s
+  // Caller must still compare keys since different keys can collide.
+
+  unsigned int  h = 2166136261u ;
+  unsigned char *ptr;
+  float   xlist[3] = { z, c, s } ;
+  int     nbyte, i ;
+
+  // ------------ BEGIN ------------
+
+  // -0 == +0 in key comparison, so hash them the same
+  for ( i=0; i < 3; i++ ) { if ( xlist[i] == 0.0 ) { xlist[i] = 0.0; } }
+
+  if ( IS_DATA ) {
+    for ( ptr = (unsigned char*)name; *ptr != 0 ; ptr++ )
+      { h ^= *ptr;  h *= 16777619u ; }
+    nbyte = sizeof(float);    // z only
+  }
+  else
+    { nbyte = 3*sizeof(float); }
+
+  ptr = (unsigned char*)xlist;
+  for ( i=0; i < nbyte; i++ ) { h ^= ptr[i];  h *= 16777619u ; }
+
+  return h ;
+
+} // end hash_duplicate_util
+
 
 
 
@@ -3866,6 +4367,8 @@ int prepNextFit(void) {
   // Feb 22 2022: fix bug to recalc_dataCov if sigint=0
   // Dec 07 2022: require NCALL_SALT2mu_DRIVER_EXEC=1 to force STOP_TOL=0
   // Aug 28 2024: implement restore_bug to undo Feb 22 2022 fix.
+  // Oct 15 2026: opt_sigint_iter & MASK_SIGINT_ITER_PREDICT -> 
+  //    next sigint from predict_covFitPar
   //
   double redchi2, covParam ;
   double step1 = INPUTS.covint_param_step1 ;
@@ -3935,6 +4438,10 @@ int prepNextFit(void) {
     bool do_recalc_dataCov = true;    
     covParam = FITINP.COVINT_PARAM_FIX ;
     FITINP.COVINT_PARAM_FIX = next_covFitPar(redchi2,covParam,step1); 
+    if ( INPUTS.opt_sigint_iter & MASK_SIGINT_ITER_PREDICT ) {
+      double covParam_pred = predict_covFitPar(redchi2,covParam,step1);
+      if ( covParam_pred >= 0.0 ) { FITINP.COVINT_PARAM_FIX = covParam_pred; }
+    }
     if ( FITINP.COVINT_PARAM_FIX < COVINT_PARAM_MIN )  {
       FITINP.COVINT_PARAM_FIX = COVINT_PARAM_MIN ;
       if ( INPUTS.restore_bug_sigint0 > 0 ) {
@@ -4123,14 +4630,24 @@ void printmsg_repeatFit(char *msg) {
 void fcn(int *npar, double grad[], double *fval, double xval[],
 	 int *iflag, void *not_used) {
 
+  // Oct 14 2026: for nthread>1, use persistent FCN_POOL threads with
+  //   dynamic chunks instead of pthread_create/join with static
+  //   chunks for each call.
+  // Oct 14 2026: for iflag=2 and fcn_grad, return grad[] for MINUIT.
+  // Oct 15 2026: use MNCHI2FUN_SOA fast path if FCN_SOA is READY.
+  // Oct 15 2026: for MPI, evaluate slice of data and reduce sums.
+  // Oct 15 2026: for nthread>1, sum partial sums in chunk order
+  //   so that fval is bit-reproducible.
+
   int  NSN_DATA    = INFO_DATA.TABLEVAR.NSN_ALL ;
   int  nthread     = INPUTS.nthread ;
   int  NFITPAR_ALL = FITINP.NFITPAR_ALL ; // Ncospar + Nzbin
-  int  ipar, t, rc, NERR, NSN_per_thread, isn_min, isn_max ;
+  int  ipar, t, NSN_CHUNK, ISN_MIN, ISN_MAX, ichunk, NCHUNK=1 ;
+  bool use_soa, use_mpi ;
 
-  pthread_t thread[MXTHREAD];
-  thread_chi2sums_def  thread_chi2sums[MXTHREAD];
-  char fnam[] = "fcn";
+  thread_chi2sums_def  thread_chi2sums_local[1];
+  thread_chi2sums_def  *thread_chi2sums ;
+  // char fnam[] = "fcn";
 
   // ----------- BEGIN ----------------
 
@@ -4142,77 +4659,157 @@ void fcn(int *npar, double grad[], double *fval, double xval[],
     if ( isinf(xval[ipar]) ) { *fval = 1.0E14; return; }
   }
 
-  if ( nthread == 1 ) 
-    { NSN_per_thread = NSN_DATA; }
+  // numerical derivatives (non-M0 params) before nominal chi2 so that
+  // stored INFO_DATA quantities correspond to xval.
+  if ( *iflag == 2 && FITINP.USE_GRAD ) 
+    { fcn_grad_numeric(npar, grad, xval); }
+
+  if ( nthread > 1 ) 
+    { init_FCN_POOL(nthread);  thread_chi2sums = FCN_POOL.CHI2SUMS; }
   else
-    { NSN_per_thread = (int)( (float)NSN_DATA/(float)nthread )  + 1 ; } 
+    { thread_chi2sums = thread_chi2sums_local; }
+
+  // fast path loops over packed events; iflag=1,3 use full MNCHI2FUN
+  // to store per-event diagnostics in INFO_DATA.
+  use_soa = ( FCN_SOA.READY && *iflag != 1 && *iflag != 3 ) ;
+  if ( use_soa ) { NSN_DATA = FCN_SOA.NSN ; }
+
+  // MPI rank evaluates a slice of the data, except for iflag=1,3
+  // where every rank needs per-event diagnostics for all events.
+  ISN_MIN = 0;  ISN_MAX = NSN_DATA;
+  use_mpi = ( FCN_MPI.NRANK > 1 && *iflag != 1 && *iflag != 3 );
+  if ( use_mpi ) {
+    ISN_MIN = (int)( (long long)NSN_DATA * FCN_MPI.IRANK / FCN_MPI.NRANK);
+    ISN_MAX = (int)( (long long)NSN_DATA * (FCN_MPI.IRANK+1) / 
+		     FCN_MPI.NRANK );
+  }
+  FCN_MPI.ISN_MIN = ISN_MIN ;
+  FCN_MPI.ISN_MAX = ISN_MAX ;
+
+  // small chunks absorb load imbalance from cut & CC-prior events;
+  // for nthread=1, one chunk is the entire data sample (or slice).
+  NSN_CHUNK = ISN_MAX - ISN_MIN ;
+  if ( nthread > 1 ) {
+    NSN_CHUNK = (ISN_MAX - ISN_MIN + 16*nthread - 1) / (16*nthread) ;
+    if ( NSN_CHUNK < 32 ) { NSN_CHUNK = 32; }
+    NCHUNK = (ISN_MAX - ISN_MIN + NSN_CHUNK - 1) / NSN_CHUNK ;
+  }
 
   // - - - - - - - - - - - - - - - - - - -
   for ( t = 0; t < nthread; t++ ) {
-
-    isn_min = t    * NSN_per_thread;
-    isn_max = (t+1)* NSN_per_thread;
-    if ( isn_max > NSN_DATA ) { isn_max = NSN_DATA; }
-
     thread_chi2sums[t].nthread   = nthread;
     thread_chi2sums[t].id_thread = t ;
-    thread_chi2sums[t].isn_min   = isn_min ;
-    thread_chi2sums[t].isn_max   = isn_max ;
-    
+    thread_chi2sums[t].isn_min   = 0 ;
+    thread_chi2sums[t].isn_max   = 0 ;
+    thread_chi2sums[t].nchunk    = 0 ;
+    thread_chi2sums[t].ichunk    = -1 ;
+    thread_chi2sums[t].use_soa   = use_soa ;
 
     // load fcn args to typedef struct
     thread_chi2sums[t].npar_fcn  = *npar ;
     thread_chi2sums[t].iflag_fcn = *iflag ;
     for(ipar=0; ipar < NFITPAR_ALL ; ipar++ ) 
       { thread_chi2sums[t].xval_fcn[ipar] = xval[ipar];   }
+  }
 
-    if ( nthread == 1 )
-      {  MNCHI2FUN(&thread_chi2sums);  } 
-#ifdef USE_THREAD
-    else  { 
-      rc = pthread_create(&thread[t], NULL, MNCHI2FUN, 
-			  &thread_chi2sums[t] ) ; 
-    }
-#endif
-  }  // end t loop over threads
-
-  // - - - - - - - 
-#ifdef USE_THREAD
-  // for threads, wait for them all to finish
-  if ( nthread > 1 ) {
-    NERR = 0 ;
-    for ( t = 0; t < nthread; t++ ) { 
-      rc = pthread_join(thread[t], NULL); 
-      if ( rc != 0 ) {
-	NERR++; 
-	printf(" ERROR: thread return errcode=%d for t=%d\n", rc,t); }
-    }
-
-    if ( NERR > 0 ) {
-      sprintf(c1err,"%d thread return code errors", NERR);
-      sprintf(c2err,"NCALL_FCN=%d", FITRESULT.NCALL_FCN );
-      errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err);  
-    }  
-  } // end ntrhread>1
-#endif
+  if ( nthread == 1 ) {
+    thread_chi2sums[0].isn_min = ISN_MIN ; 
+    thread_chi2sums[0].isn_max = ISN_MAX ; 
+    MNCHI2FUN(thread_chi2sums);
+  }
+  else {
+    // wake up pool threads, process chunks here, and wait for pool
+    if ( NCHUNK > FCN_POOL.MXCHUNK ) {
+      sprintf(c1err,"NCHUNK=%d exceeds MXCHUNK=%d", 
+	      NCHUNK, FCN_POOL.MXCHUNK);
+      sprintf(c2err,"NSN_CHUNK=%d  nthread=%d", NSN_CHUNK, nthread);
+      errlog(FP_STDOUT, SEV_FATAL, "fcn", c1err, c2err);  
+    }
+    for(ichunk=0; ichunk < NCHUNK; ichunk++ ) 
+      { zero_chunk_FCN_POOL(&FCN_POOL.CHUNKSUMS[ichunk]); }
+
+    pthread_mutex_lock(&FCN_POOL.MUTEX);
+    FCN_POOL.NSN         = ISN_MAX ;
+    FCN_POOL.NSN_CHUNK   = NSN_CHUNK ;
+    FCN_POOL.ISN_FIRST   = ISN_MIN ;
+    FCN_POOL.NCHUNK      = NCHUNK ;
+    FCN_POOL.ICHUNK_NEXT = 0 ;
+    FCN_POOL.NDONE     = 0 ;
+    FCN_POOL.GENERATION++ ;
+    pthread_cond_broadcast(&FCN_POOL.COND_START);
+    pthread_mutex_unlock(&FCN_POOL.MUTEX);
+
+    MNCHI2FUN(&thread_chi2sums[0]);
+
+    pthread_mutex_lock(&FCN_POOL.MUTEX);
+    while ( FCN_POOL.NDONE < nthread-1 ) 
+      { pthread_cond_wait(&FCN_POOL.COND_DONE, &FCN_POOL.MUTEX); }
+    pthread_mutex_unlock(&FCN_POOL.MUTEX);
+  } 
 
   // ===============================================
   // ============= WRAP UP =========================
   // ===============================================
 
-  // sum each thread
+  // sum each chunk in chunk order (independent of thread scheduling);
+  // for nthread=1, single thread has the sums for entire sample.
   int nsnfit = 0, nsnfit_truecc=0;
   double chi2sum_Ia=0.0, chi2sum_tot=0.0;
   double nsnfitIa=0.0, nsnfitcc=0.0, nsnspecIa=0.0 ;
-  //  double alpha, beta, gamma, logmass  ;
-  for ( t = 0; t < nthread; t++ ) { 
-    nsnfit        += thread_chi2sums[t].nsnfit ;
-    nsnfit_truecc += thread_chi2sums[t].nsnfit_truecc ;
-    nsnfitIa      += thread_chi2sums[t].nsnfitIa ;
-    nsnfitcc      += thread_chi2sums[t].nsnfitcc ;
-    nsnspecIa     += thread_chi2sums[t].nsnspecIa ;
-    chi2sum_Ia    += thread_chi2sums[t].chi2sum_Ia ;
-    chi2sum_tot   += thread_chi2sums[t].chi2sum_tot ;
+  int iz, NZBIN = INPUTS.nzbin ;
+  double grad_M0[MXz];
+  bool USE_GRAD_M0 = ( *iflag == 2 && FITINP.USE_GRAD );
+  chunk_chi2sums_def *CHUNK ;
+
+  for(iz=0; iz < NZBIN; iz++ ) { grad_M0[iz] = 0.0 ; }
+
+  if ( nthread == 1 ) {
+    nsnfit        = thread_chi2sums[0].nsnfit ;
+    nsnfit_truecc = thread_chi2sums[0].nsnfit_truecc ;
+    nsnfitIa      = thread_chi2sums[0].nsnfitIa ;
+    nsnfitcc      = thread_chi2sums[0].nsnfitcc ;
+    nsnspecIa     = thread_chi2sums[0].nsnspecIa ;
+    chi2sum_Ia    = thread_chi2sums[0].chi2sum_Ia ;
+    chi2sum_tot   = thread_chi2sums[0].chi2sum_tot ;
+    if ( USE_GRAD_M0 ) {
+      for(iz=0; iz < NZBIN; iz++ ) 
+	{ grad_M0[iz] = thread_chi2sums[0].grad_M0[iz]; }
+    }
+  }
+  else {
+    for ( ichunk = 0; ichunk < NCHUNK; ichunk++ ) { 
+      CHUNK = &FCN_POOL.CHUNKSUMS[ichunk] ;
+      nsnfit        += CHUNK->nsnfit ;
+      nsnfit_truecc += CHUNK->nsnfit_truecc ;
+      nsnfitIa      += CHUNK->nsnfitIa ;
+      nsnfitcc      += CHUNK->nsnfitcc ;
+      nsnspecIa     += CHUNK->nsnspecIa ;
+      chi2sum_Ia    += CHUNK->chi2sum_Ia ;
+      chi2sum_tot   += CHUNK->chi2sum_tot ;
+      if ( USE_GRAD_M0 ) {
+	for(iz=0; iz < NZBIN; iz++ ) { grad_M0[iz] += CHUNK->grad_M0[iz]; }
+      }
+    }
+  }
+
+  // sum over MPI ranks; every rank gets the same sums
+  if ( use_mpi ) {
+    double SUMS[7+MXz];
+    int    NSUM = 7 ;
+    SUMS[0] = (double)nsnfit ;    SUMS[1] = (double)nsnfit_truecc ;
+    SUMS[2] = nsnfitIa ;          SUMS[3] = nsnfitcc ;
+    SUMS[4] = nsnspecIa ;         SUMS[5] = chi2sum_Ia ;
+    SUMS[6] = chi2sum_tot ;
+    if ( USE_GRAD_M0 ) 
+      { for(iz=0; iz < NZBIN; iz++ ) { SUMS[NSUM++] = grad_M0[iz]; } }
+
+    reduce_FCN_MPI(SUMS, NSUM);
+
+    nsnfit   = (int)(SUMS[0]+0.5);  nsnfit_truecc = (int)(SUMS[1]+0.5);
+    nsnfitIa = SUMS[2];  nsnfitcc = SUMS[3];  nsnspecIa = SUMS[4];
+    chi2sum_Ia = SUMS[5];  chi2sum_tot = SUMS[6];
+    if ( USE_GRAD_M0 ) 
+      { for(iz=0; iz < NZBIN; iz++ ) { grad_M0[iz] = SUMS[7+iz]; } }
   }
 
 
@@ -4221,8 +4818,10 @@ void fcn(int *npar, double grad[], double *fval, double xval[],
   FITRESULT.NSNFIT_TRUECC = nsnfit_truecc ;
   FITRESULT.NSNFIT_SPLITRAN[NJOB_SPLITRAN] = nsnfit ;
     
+  double xdof = nsnfitIa - (double)FITINP.NFITPAR_FLOAT ;
+  FITRESULT.CHI2RED_IA_FCN = chi2sum_Ia/xdof ;
+
   if ( *iflag == 3 )  {   // done with fit
-    double xdof = nsnfitIa - (double)FITINP.NFITPAR_FLOAT ;
     FITRESULT.CHI2SUM_IA = chi2sum_Ia ;
     FITRESULT.CHI2RED_IA = chi2sum_Ia/xdof ;
     FITRESULT.NSNFIT_IA  = nsnfitIa ; 
@@ -4237,10 +4836,90 @@ void fcn(int *npar, double grad[], double *fval, double xval[],
   
   *fval = chi2sum_tot;
 
+  // analytic gradient for M0 z-bins
+  if ( USE_GRAD_M0 ) {
+    for(iz=0; iz < NZBIN; iz++ ) { grad[MXCOSPAR+iz] = grad_M0[iz]; }
+  }
+
   return ;
     
 } // end fcn for pthread
 
+
+// =================================================================
+bool use_fcn_grad(void) {
+
+  // Created Oct 2026
+  // Return true if fcn_grad is set and the analytic d(chi2)/dM0 
+  // in MNCHI2FUN is valid; i.e., muerr and CC prob must not depend
+  // on M0. CC prior is allowed only if PROB_CC is pre-computed 
+  // during init (REFAC, no update, no H11).
+
+  char fnam[] = "use_fcn_grad" ;
+
+  // ----------- BEGIN ----------------
+
+  if ( INPUTS.fcn_grad == 0 ) { return(false); }
+
+  if ( INFO_CCPRIOR.USE ) {
+    if ( INFO_CCPRIOR.USEH11 || INPUTS.REFAC_CCPRIOR == 0 ||
+	 INPUTS.DO_CCPRIOR_UPDATE ) {
+      fprintf(FP_STDOUT, "\t %s: WARNING: ignore fcn_grad for "
+	      "this CC prior option.\n", fnam);
+      fflush(FP_STDOUT);
+      return(false);
+    }
+  }
+
+  return(true);
+
+} // end use_fcn_grad
+
+
+// =================================================================
+void fcn_grad_numeric(int *npar, double *grad, double *xval) {
+
+  // Created Oct 2026
+  // Compute d(chi2)/dpar with central difference for floated params
+  // that are not M0 z-bins; M0 z-bin derivatives are computed 
+  // analytically in MNCHI2FUN. Step is 1.0E-3 x initial MINUIT step,
+  // and is one-sided if a step crosses a parameter bound.
+  // Each derivative costs 2 fcn calls, compared with 2 or more
+  // calls per param (including M0 z-bins) for MINUIT derivatives.
+
+  int    NFITPAR_ALL = FITINP.NFITPAR_ALL ;
+  int    ipar, iflag_num = 4 ;
+  double xval_tmp[MAXPAR], grad_tmp[MAXPAR] ;
+  double val, h, x_lo, x_hi, chi2_lo, chi2_hi ;
+
+  // ----------- BEGIN ----------------
+
+  for(ipar=0; ipar < NFITPAR_ALL; ipar++ ) { xval_tmp[ipar] = xval[ipar]; }
+
+  for(ipar=0; ipar < MXCOSPAR; ipar++ ) {
+    grad[ipar] = 0.0 ;
+    if ( !FITINP.ISFLOAT[ipar] ) { continue; }
+
+    val  = xval[ipar];
+    h    = 1.0E-3 * INPUTS.parstep[ipar] ;
+    x_lo = val - h;   x_hi = val + h ;
+    if ( x_lo < INPUTS.parbndmin[ipar] ) { x_lo = val; }
+    if ( x_hi > INPUTS.parbndmax[ipar] ) { x_hi = val; }
+    if ( x_hi <= x_lo ) { continue; }
+
+    xval_tmp[ipar] = x_lo ;
+    fcn(npar, grad_tmp, &chi2_lo, xval_tmp, &iflag_num, NULL);
+    xval_tmp[ipar] = x_hi ;
+    fcn(npar, grad_tmp, &chi2_hi, xval_tmp, &iflag_num, NULL);
+    xval_tmp[ipar] = val ;
+
+    grad[ipar] = (chi2_hi - chi2_lo) / (x_hi - x_lo) ;
+  }
+
+  return ;
+
+} // end fcn_grad_numeric
+
 // =================================================================
 void *MNCHI2FUN(void *thread) {
 
@@ -4255,6 +4934,9 @@ void *MNCHI2FUN(void *thread) {
   // Sep 24 2021: abort on muerrsq < 0
   // Sep 27 2021: require muCOVadd>0 to implement; fixes rare muerrsq<0 problem.
   // May 05 2025: abort if PIa < 0 or > 1
+  // Oct 14 2026: for iflag=2 and fcn_grad, sum analytic d(chi2)/dM0
+  // Oct 15 2026: call MNCHI2FUN_SOA for fcn_soa fast path.
+  // Oct 15 2026: for nthread>1, store partial sums for each chunk.
 
   thread_chi2sums_def *thread_chi2sums = (thread_chi2sums_def *)thread;
   //  int  npar      = thread_chi2sums->npar_fcn ;
@@ -4262,8 +4944,7 @@ void *MNCHI2FUN(void *thread) {
   double *xval   = thread_chi2sums->xval_fcn ;
   int  nthread   = thread_chi2sums->nthread;
   int  id_thread = thread_chi2sums->id_thread ;
-  int  isn_min   = thread_chi2sums->isn_min ;
-  int  isn_max   = thread_chi2sums->isn_max ;
+  int  ichunk    = -1 ;
   char fnam[]    = "MNCHI2FUN" ;
   char *name ;
 
@@ -4303,6 +4984,7 @@ void *MNCHI2FUN(void *thread) {
 
   BIASCORLIST_DEF     BIASCORLIST ;
   INTERPWGT_AlphaBetaGammaDM INTERPWGT ;
+  INTERPWGT_CACHE_DEF        INTERPWGT_CACHE ; // Oct 2026
   FITPARBIAS_DEF FITPARBIAS_ALPHABETA[MXa][MXb][MXg]; // bias at each a,b
   double   MUCOVSCALE_ALPHABETA[MXa][MXb][MXg]; // (I) muCOVscale at each a,b
   double   MUCOVADD_ALPHABETA[MXa][MXb][MXg]; // (I) muCOVadd at each a,b
@@ -4310,9 +4992,15 @@ void *MNCHI2FUN(void *thread) {
 
   bool REFAC  = (INPUTS.REFAC_CCPRIOR > 0) ; 
   bool LDMP   = ISMODEL_LCFIT_SALT2 ;
+
+  bool   DO_GRAD = ( iflag == 2 && FITINP.USE_GRAD );
+  int    IZ_DERIV_M0[2], k ;
+  double DERIV_M0[2], dchi2_dM0 ;
   
   // -------------- BEGIN ------------
 
+  if ( thread_chi2sums->use_soa ) { return MNCHI2FUN_SOA(thread); }
+
   //Set input cosmology parameters
   //  alpha0       = xval[IPAR_ALPHA0] ;
   //  beta0        = xval[IPAR_BETA0] ;
@@ -4369,9 +5057,33 @@ void *MNCHI2FUN(void *thread) {
   nsnfit      = nsnfit_truecc = 0 ;
   nsnfitIa    = nsnfitcc      = 0.0 ;
   nsnspecIa   = 0 ;
+  INTERPWGT_CACHE.N = INTERPWGT_CACHE.NEXT = 0 ;
+  INTERPWGT_CACHE.NCALL = INTERPWGT_CACHE.NHIT = 0 ;
+
+  if ( DO_GRAD ) {
+    for(k=0; k < INPUTS.nzbin; k++ ) { thread_chi2sums->grad_M0[k] = 0.0; }
+  }
 
   // - - - - - - - - - - - - - - - - -
-  for ( n = isn_min; n < isn_max; n++ ) {
+  // Oct 2026: with thread pool, next_isn_FCN_POOL fetches chunks of
+  //   events until all events are processed. Without threads,
+  //   loop is from isn_min to isn_max-1.
+  for ( n = next_isn_FCN_POOL(thread_chi2sums,-1); n >= 0; 
+	n = next_isn_FCN_POOL(thread_chi2sums, n) ) {
+
+    // store partial sums of previous chunk, and reset sums
+    if ( thread_chi2sums->ichunk != ichunk ) {
+      if ( ichunk >= 0 ) {
+	store_chunk_FCN_POOL(thread_chi2sums, ichunk, 
+			     chi2sum_tot, chi2sum_Ia, nsnfitIa, nsnfitcc,
+			     nsnfit, nsnfit_truecc, nsnspecIa);
+	chi2sum_tot = chi2sum_Ia    = 0.0;
+	nsnfit      = nsnfit_truecc = 0 ;
+	nsnfitIa    = nsnfitcc      = 0.0 ;
+	nsnspecIa   = 0 ;
+      }
+      ichunk = thread_chi2sums->ichunk ;
+    }
 
     cutmask  = INFO_DATA.TABLEVAR.CUTMASK[n] ; 
     if ( cutmask ) { continue; }
@@ -4465,13 +5177,19 @@ void *MNCHI2FUN(void *thread) {
 
     DUMPFLAG = 0 ; // ( strcmp(name,"93018")==0 ) ; 
     if ( INTERPFLAG_abg ) {
-      get_INTERPWGT_abg(alpha, beta, gammaDM, DUMPFLAG, &INTERPWGT, name);
+      // Oct 2026: re-use cached weights when a,b,gDM are unchanged
+      if ( DUMPFLAG ) 
+	{ get_INTERPWGT_abg(alpha, beta, gammaDM, DUMPFLAG, &INTERPWGT, name); }
+      else {
+	get_INTERPWGT_abg_cache(alpha, beta, gammaDM, &INTERPWGT_CACHE, 
+				&INTERPWGT, name);
+      }
     }
 
     DUMPFLAG = 0 ;
 
     // get mag offset for this z-bin
-    M0    = fcn_M0(n, &xval[MXCOSPAR] );
+    M0    = fcn_M0(n, &xval[MXCOSPAR], IZ_DERIV_M0, DERIV_M0 );
 
     // compute distance modulus from cosmology params
     if ( INPUTS.FLOAT_COSPAR ) {
@@ -4690,9 +5408,17 @@ void *MNCHI2FUN(void *thread) {
 	  // pre-computed during init with user-input alpha,beta
 	  if ( INPUTS.DO_CCPRIOR_UPDATE ) {
 	    // re-compute prior with updated alpha, beta
-	    i3d = INFO_DATA.PROB_CCPRIOR.I3D[n];
-	    dPdmu_CC = prob_CCprior_sim(idsample, CCPRIOR_MUZMAP, 
-					i3d, z, mures, DUMPFLAG, fnam );
+	    if ( INFO_DATA.PROB_CCPRIOR.READY_FAST && !DUMPFLAG &&
+		 INFO_DATA.PROB_CCPRIOR.PDF[n] != NULL ) {
+	      // Oct 2026: map cell & dmu-independent terms are pre-computed
+	      dPdmu_CC = prob_CCprior_fast(CCPRIOR_MUZMAP, 
+					   &INFO_DATA.PROB_CCPRIOR, n, mures);
+	    }
+	    else {
+	      i3d = INFO_DATA.PROB_CCPRIOR.I3D[n];
+	      dPdmu_CC = prob_CCprior_sim(idsample, CCPRIOR_MUZMAP, 
+					  i3d, z, mures, DUMPFLAG, fnam );
+	    }
 	  }
 	  else {
 	    // use pre-computed PROB(DMU) based on user-defined alpha, beta
@@ -4761,6 +5487,21 @@ void *MNCHI2FUN(void *thread) {
     chi2sum_tot      += chi2evt;
     INFO_DATA.chi2[n] = chi2evt; // store each chi2 to allow for outlier cut
 
+    // d(chi2evt)/dM0; mures depends on -M0, and muerr and 
+    // PROB_CC do not depend on M0 (see use_fcn_grad)
+    if ( DO_GRAD ) {
+      dchi2_dM0 = 0.0 ;
+      if ( !USE_CCPRIOR ) 
+	{ dchi2_dM0 = -2.0 * mures / muerrsq ; }
+      else if ( Prob_SUM > 0.0 ) 
+	{ dchi2_dM0 = -2.0 * ProbRatio_Ia * mures / muerrsq ; }
+
+      for(k=0; k < 2; k++ ) {
+	thread_chi2sums->grad_M0[IZ_DERIV_M0[k]] += 
+	  ( dchi2_dM0 * DERIV_M0[k] ) ;
+      }
+    }
+
     // check things on final pass
     if (  iflag==3 ) {	
 
@@ -4808,6 +5549,12 @@ void *MNCHI2FUN(void *thread) {
 	  
   } // end loop over SN
 
+  if ( nthread > 1 && ichunk >= 0 ) {
+    store_chunk_FCN_POOL(thread_chi2sums, ichunk, 
+			 chi2sum_tot, chi2sum_Ia, nsnfitIa, nsnfitcc,
+			 nsnfit, nsnfit_truecc, nsnspecIa);
+  }
+
   // - - - - - - - - - - - - - - - - - - - - 
   // load sums in output typedef  
  
@@ -4820,10 +5567,18 @@ void *MNCHI2FUN(void *thread) {
   thread_chi2sums->chi2sum_tot   = chi2sum_tot ;
   thread_chi2sums->chi2sum_Ia    = chi2sum_Ia  ;
 
+  if ( FITRESULT.NCALL_FCN == 1 && INTERPWGT_CACHE.NCALL > 0 && id_thread==0 ) {
+    printf("\t %s-%3.3d: INTERPWGT cache hits: %d of %d \n", 
+	   fnam, FITRESULT.NCALL_FCN, INTERPWGT_CACHE.NHIT, 
+	   INTERPWGT_CACHE.NCALL );
+    fflush(stdout);
+  }
+
   // check CPU-load balance on first FCN call
   if ( FITRESULT.NCALL_FCN == 1 && nthread > 1 ) {
-    printf("\t %s-%3.3d: id_thread = %d of %d  nsnfit=%d \n", 
-	   fnam, FITRESULT.NCALL_FCN, id_thread, nthread, nsnfit );
+    printf("\t %s-%3.3d: id_thread = %d of %d  nchunk=%d\n", 
+	   fnam, FITRESULT.NCALL_FCN, id_thread, nthread,
+	   thread_chi2sums->nchunk );
     fflush(stdout);
   }
 
@@ -4831,15 +5586,525 @@ void *MNCHI2FUN(void *thread) {
 
 } // end MNCHI2FUN
 
-#endif 
 
+// =================================================================
+ATTR_TARGET_CLONES
+void *MNCHI2FUN_SOA(void *thread) {
+
+  // Created Oct 2026
+  // Fast version of MNCHI2FUN for the common case selected by 
+  // use_FCN_SOA: Ia-only (no CC prior), no biasCor or 1D biasCor
+  // (so muCOVscale=1), SALT2, and cosmology params fixed.
+  // Loops over packed FCN_SOA arrays for events passing cuts;
+  // inner loop has no branches or function calls so that it can be
+  // vectorized. Per-event INFO_DATA quantities (mu, mures, chi2 ...)
+  // are NOT stored here; they are stored by MNCHI2FUN for iflag=1,3.
 
-// ==============================================
-void  fcnFetch_AlphaBetaGamma(double *xval, double z, double logmass, 
-			      double *alpha, double *beta, double *gamma) {
+  thread_chi2sums_def *thread_chi2sums = (thread_chi2sums_def *)thread;
+  int    iflag   = thread_chi2sums->iflag_fcn ;
+  double *xval   = thread_chi2sums->xval_fcn ;
+  int    nthread = thread_chi2sums->nthread ;
+  double *M0LIST = &xval[MXCOSPAR] ;
+
+  double a0          = xval[IPAR_ALPHA0] ;
+  double b0          = xval[IPAR_BETA0] ;
+  double da_dz       = xval[3] ;
+  double db_dz       = xval[4] ;
+  double aHost       = xval[15];
+  double bHost       = xval[16];
+  double logmass_cen = xval[7];
+  double *hostPar    = &xval[IPAR_GAMMA0];
+  double g0          = hostPar[0];
+  double g1          = hostPar[1];
+  double gcen        = hostPar[2];
+  double gtau        = hostPar[3];
+  double goff        = INFO_BIASCOR.GAMMADM_OFFSET ;
+
+  double OPT_SLOPE = 0.0, OPT_SPLIT = 0.0 ;
+  bool   DO_GRAD   = ( iflag == 2 && FITINP.USE_GRAD );
+  bool   DO_LOGSIG = ( INPUTS.fitflag_sigmb == 2 );
+
+  double *z  = FCN_SOA.z,  *logmass = FCN_SOA.logmass ;
+  double *d  = FCN_SOA.d,  *s = FCN_SOA.s,  *c = FCN_SOA.c ;
+  double *W0 = FCN_SOA.W0, *W1 = FCN_SOA.W1, *M0C = FCN_SOA.M0C ;
+  int    *IZ0 = FCN_SOA.IZ0, *IZ1 = FCN_SOA.IZ1 ;
+  double *C00 = FCN_SOA.C00, *C01 = FCN_SOA.C01, *C02 = FCN_SOA.C02 ;
+  double *C11 = FCN_SOA.C11, *C12 = FCN_SOA.C12, *C22 = FCN_SOA.C22 ;
+  double *ADDSQ = FCN_SOA.ADDSQ, *mu0 = FCN_SOA.mu0 ;
+  double *GDM = FCN_SOA.gammaDM ;
+  double *MURES = FCN_SOA.mures, *MUERRSQ = FCN_SOA.muerrsq ;
+
+  double chi2sum_Ia = 0.0, chi2sum_log = 0.0, dchi2_dM0 ;
+  double dlm, alpha, beta, M0, mures, muerrsq ;
+  int    nsnfit = 0, i, i_min, i_max = 0, n ;
 
-  // Apr 2 2018
-  // Return alpha and beta for fcn fit function
+  // -------------- BEGIN ------------
+
+  // same alpha,beta host options as fcnFetch_AlphaBetaGamma
+  if ( INPUTS.ipar[15]<=1 || INPUTS.ipar[16]<=1 ) { OPT_SLOPE = 1.0; }
+  if ( INPUTS.ipar[15]==2 || INPUTS.ipar[16]==2 ) { OPT_SPLIT = 1.0; }
+
+  if ( DO_GRAD ) {
+    for(i=0; i < INPUTS.nzbin; i++ ) { thread_chi2sums->grad_M0[i] = 0.0; }
+  }
+
+  for ( n = next_isn_FCN_POOL(thread_chi2sums,-1); n >= 0; 
+	n = next_isn_FCN_POOL(thread_chi2sums, i_max-1) ) {
+
+    i_min = n;  i_max = thread_chi2sums->isn_max ;
+
+    // gammaDM as in get_gammadm_host; GDM=0 from prep if not used
+    if ( INPUTS.USE_GAMMA0 ) {
+      for ( i = i_min; i < i_max; i++ ) {
+	GDM[i] = (g0 + z[i]*g1) * 
+	  ( 0.5 - 1.0/(1.0 + exp(-(logmass[i]-gcen)/gtau)) ) - goff ;
+      }
+    }
+
+    for ( i = i_min; i < i_max; i++ ) {
+      dlm   = logmass[i] - logmass_cen ;
+      alpha = a0 + z[i]*da_dz + 
+	aHost * ( OPT_SLOPE*dlm + OPT_SPLIT*(dlm > 0.0 ? 0.5 : -0.5) );
+      beta  = b0 + z[i]*db_dz + 
+	bHost * ( OPT_SLOPE*dlm + OPT_SPLIT*(dlm > 0.0 ? 0.5 : -0.5) );
+
+      M0 = M0C[i] + W0[i]*M0LIST[IZ0[i]] + W1[i]*M0LIST[IZ1[i]] ;
+
+      // (1,alpha,-beta) x COV x (1,alpha,-beta) + vpec & lensing
+      muerrsq = ADDSQ[i] + C00[i] + alpha*C01[i] - beta*C02[i] +
+	alpha*alpha*C11[i] - alpha*beta*C12[i] + beta*beta*C22[i] ;
+
+      mures   = d[i] + alpha*s[i] - beta*c[i] - GDM[i] - M0 - mu0[i] ;
+
+      MURES[i]    = mures ;
+      MUERRSQ[i]  = muerrsq ;
+      chi2sum_Ia += mures*mures/muerrsq ;
+    }
+    nsnfit += (i_max - i_min);
+
+    // add log(sigma) term for 5D biasCor
+    if ( DO_LOGSIG ) {
+      for ( i = i_min; i < i_max; i++ ) 
+	{ chi2sum_log += log(MUERRSQ[i]/FCN_SOA.muerrsq_last[i]); }
+    }
+
+    // d(chi2)/dM0 ; see MNCHI2FUN
+    if ( DO_GRAD ) {
+      for ( i = i_min; i < i_max; i++ ) {
+	dchi2_dM0 = -2.0 * MURES[i] / MUERRSQ[i] ;
+	thread_chi2sums->grad_M0[IZ0[i]] += dchi2_dM0 * W0[i] ;
+	thread_chi2sums->grad_M0[IZ1[i]] += dchi2_dM0 * W1[i] ;
+      }
+    }
+
+    // store partial sums for this chunk, and reset sums
+    if ( nthread > 1 ) {
+      store_chunk_FCN_POOL(thread_chi2sums, thread_chi2sums->ichunk,
+			   chi2sum_Ia + chi2sum_log, chi2sum_Ia, 
+			   (double)nsnfit, 0.0, nsnfit, 0, 0);
+      chi2sum_Ia = chi2sum_log = 0.0 ;  nsnfit = 0 ;
+    }
+  } // end chunk loop
+
+  thread_chi2sums->nsnfit        = nsnfit ;
+  thread_chi2sums->nsnfit_truecc = 0 ;
+  thread_chi2sums->nsnfitIa      = (double)nsnfit ;
+  thread_chi2sums->nsnfitcc      = 0.0 ;
+  thread_chi2sums->nsnspecIa     = 0 ;
+  thread_chi2sums->chi2sum_Ia    = chi2sum_Ia ;
+  thread_chi2sums->chi2sum_tot   = chi2sum_Ia + chi2sum_log ;
+
+  return(void *) 0 ;
+
+} // end MNCHI2FUN_SOA
+
+
+// =================================================================
+bool use_FCN_SOA(void) {
+
+  // Created Oct 2026
+  // Return true if fcn_soa is set and the fit is the common case
+  // handled by MNCHI2FUN_SOA.
+
+  int  NDIM_BIASCOR = INFO_BIASCOR.NDIM ;
+
+  // ----------- BEGIN ----------------
+
+  if ( INPUTS.fcn_soa == 0          ) { return(false); }
+  if ( INFO_CCPRIOR.USE             ) { return(false); }
+  if ( NDIM_BIASCOR > 1             ) { return(false); }
+  if ( INPUTS.FLOAT_COSPAR          ) { return(false); }
+  if ( !INPUTS.ISMODEL_LCFIT_SALT2  ) { return(false); }
+  if ( INPUTS.opt_biasCor & MASK_BIASCOR_MUCOVADD ) { return(false); }
+
+  return(true);
+
+} // end use_FCN_SOA
+
+
+// =================================================================
+void prep_FCN_SOA(void) {
+
+  // Created Oct 2026
+  // Pack data passing cuts into FCN_SOA arrays for MNCHI2FUN_SOA.
+  // Called before each MINUIT fit because cuts, covmat_tot (sigint)
+  // and muerrsq_last change between fit iterations.
+  // M0 weights are evaluated with fcn_M0 and a zero M0 list, so that
+  // M0C is the fixed part of M0 (e.g., INPUTS.M0 for fixed bins).
+
+  int  NSN_DATA     = INFO_DATA.TABLEVAR.NSN_ALL ;
+  int  NDIM_BIASCOR = INFO_BIASCOR.NDIM ;
+  int  n, i, MEMD, MEMI, IZ[2] ;
+  double M0LIST_ZERO[MXz], DERIV[2], z, zmuerr, muerr_z, dmuLens ;
+  bool   set_fitwgt0 ;
+  float  **COV ;
+  char fnam[] = "prep_FCN_SOA" ;
+
+  // ----------- BEGIN ----------------
+
+  FCN_SOA.READY = false ;
+  if ( !use_FCN_SOA() ) { return; }
+
+  if ( NSN_DATA > FCN_SOA.NSN_ALLOC ) {
+    MEMD = NSN_DATA * sizeof(double);
+    MEMI = NSN_DATA * sizeof(int);
+    if ( FCN_SOA.NSN_ALLOC > 0 ) {
+      free(FCN_SOA.ISN); free(FCN_SOA.IZ0); free(FCN_SOA.IZ1); 
+      free(FCN_SOA.W0);  free(FCN_SOA.W1);  free(FCN_SOA.M0C);
+      free(FCN_SOA.z);   free(FCN_SOA.logmass);
+      free(FCN_SOA.d);   free(FCN_SOA.s);   free(FCN_SOA.c);
+      free(FCN_SOA.mu0); free(FCN_SOA.ADDSQ);
+      free(FCN_SOA.C00); free(FCN_SOA.C01); free(FCN_SOA.C02);
+      free(FCN_SOA.C11); free(FCN_SOA.C12); free(FCN_SOA.C22);
+      free(FCN_SOA.muerrsq_last); free(FCN_SOA.gammaDM);
+      free(FCN_SOA.mures);        free(FCN_SOA.muerrsq);
+    }
+    FCN_SOA.ISN = (int*)malloc(MEMI);
+    FCN_SOA.IZ0 = (int*)malloc(MEMI);
+    FCN_SOA.IZ1 = (int*)malloc(MEMI);
+    FCN_SOA.W0  = (double*)malloc(MEMD);
+    FCN_SOA.W1  = (double*)malloc(MEMD);
+    FCN_SOA.M0C = (double*)malloc(MEMD);
+    FCN_SOA.z   = (double*)malloc(MEMD);
+    FCN_SOA.logmass = (double*)malloc(MEMD);
+    FCN_SOA.d   = (double*)malloc(MEMD);
+    FCN_SOA.s   = (double*)malloc(MEMD);
+    FCN_SOA.c   = (double*)malloc(MEMD);
+    FCN_SOA.mu0 = (double*)malloc(MEMD);
+    FCN_SOA.ADDSQ = (double*)malloc(MEMD);
+    FCN_SOA.C00 = (double*)malloc(MEMD);
+    FCN_SOA.C01 = (double*)malloc(MEMD);
+    FCN_SOA.C02 = (double*)malloc(MEMD);
+    FCN_SOA.C11 = (double*)malloc(MEMD);
+    FCN_SOA.C12 = (double*)malloc(MEMD);
+    FCN_SOA.C22 = (double*)malloc(MEMD);
+    FCN_SOA.muerrsq_last = (double*)malloc(MEMD);
+    FCN_SOA.gammaDM = (double*)malloc(MEMD);
+    FCN_SOA.mures   = (double*)malloc(MEMD);
+    FCN_SOA.muerrsq = (double*)malloc(MEMD);
+    FCN_SOA.NSN_ALLOC = NSN_DATA ;
+  }
+
+  for(i=0; i < MXz; i++ ) { M0LIST_ZERO[i] = 0.0; }
+
+  i = 0 ;
+  for ( n=0; n < NSN_DATA; n++ ) {
+    if ( INFO_DATA.TABLEVAR.CUTMASK[n] ) { continue; }
+    z = (double)INFO_DATA.TABLEVAR.zhd[n] ;
+    if ( z < 1.0E-8 ) { continue; }
+
+    zmuerr      = (double)INFO_DATA.TABLEVAR.zmuerr[n] ;
+    set_fitwgt0 = ( NDIM_BIASCOR > 0 && INFO_DATA.set_fitwgt0[n] ) ;
+    COV         = INFO_DATA.TABLEVAR.covmat_tot[n] ;
+
+    FCN_SOA.ISN[i]     = n ;
+    FCN_SOA.z[i]       = z ;
+    FCN_SOA.logmass[i] = (double)INFO_DATA.TABLEVAR.host_logmass[n];
+    FCN_SOA.d[i]       = (double)INFO_DATA.TABLEVAR.fitpar[INDEX_d][n] ;
+    FCN_SOA.s[i]       = (double)INFO_DATA.TABLEVAR.fitpar[INDEX_s][n] ;
+    FCN_SOA.c[i]       = (double)INFO_DATA.TABLEVAR.fitpar[INDEX_c][n] ;
+    FCN_SOA.muerrsq_last[i] = INFO_DATA.muerrsq_last[n] ;
+    FCN_SOA.gammaDM[i] = 0.0 ;
+
+    FCN_SOA.mu0[i] = (double)INFO_DATA.TABLEVAR.mumodel[n] ;
+    if ( NDIM_BIASCOR == 1 ) { FCN_SOA.mu0[i] += INFO_DATA.muBias_zinterp[n]; }
+
+    FCN_SOA.M0C[i] = fcn_M0(n, M0LIST_ZERO, IZ, DERIV);
+    FCN_SOA.IZ0[i] = IZ[0];     FCN_SOA.IZ1[i] = IZ[1];
+    FCN_SOA.W0[i]  = DERIV[0];  FCN_SOA.W1[i]  = DERIV[1];
+
+    if ( set_fitwgt0 ) {
+      FCN_SOA.ADDSQ[i] = MUERR_FITWGT0 * MUERR_FITWGT0 ;
+      FCN_SOA.C00[i] = FCN_SOA.C01[i] = FCN_SOA.C02[i] = 0.0 ;
+      FCN_SOA.C11[i] = FCN_SOA.C12[i] = FCN_SOA.C22[i] = 0.0 ;
+    }
+    else {
+      muerr_z = 0.0 ;
+      if ( zmuerr > 0.0 ) { muerr_z = fcn_muerrz(1, z, zmuerr); }
+      dmuLens = INPUTS.lensing_zpar * z;
+      FCN_SOA.ADDSQ[i] = muerr_z*muerr_z + dmuLens*dmuLens ;
+
+      FCN_SOA.C00[i] = (double)COV[INDEX_d][INDEX_d] ;
+      FCN_SOA.C11[i] = (double)COV[INDEX_s][INDEX_s] ;
+      FCN_SOA.C22[i] = (double)COV[INDEX_c][INDEX_c] ;
+      FCN_SOA.C01[i] = (double)COV[INDEX_d][INDEX_s] + 
+	(double)COV[INDEX_s][INDEX_d] ;
+      FCN_SOA.C02[i] = (double)COV[INDEX_d][INDEX_c] + 
+	(double)COV[INDEX_c][INDEX_d] ;
+      FCN_SOA.C12[i] = (double)COV[INDEX_s][INDEX_c] + 
+	(double)COV[INDEX_c][INDEX_s] ;
+    }
+    i++ ;
+  }
+
+  FCN_SOA.NSN   = i ;
+  FCN_SOA.READY = true ;
+
+  fprintf(FP_STDOUT, "  %s: packed %d of %d events for fast fcn.\n",
+	  fnam, FCN_SOA.NSN, NSN_DATA );
+  fflush(FP_STDOUT);
+
+  return ;
+
+} // end prep_FCN_SOA
+
+
+// =================================================================
+int next_isn_FCN_POOL(thread_chi2sums_def *thread_chi2sums, int isn) {
+
+  // Created Oct 2026
+  // Return next data index after isn for MNCHI2FUN loop;
+  // isn = -1 on first call. Return -1 when there are no more events.
+  // If current chunk [isn_min,isn_max) is done, then
+  //   nthread=1 -> done (only one chunk)
+  //   nthread>1 -> atomically fetch next chunk index from FCN_POOL.
+
+  int nthread = thread_chi2sums->nthread ;
+  int isn_min, isn_max, ichunk ;
+
+  // ---------- BEGIN ----------
+
+  if ( isn >= 0 && isn+1 < thread_chi2sums->isn_max ) { return(isn+1); }
+
+  if ( nthread == 1 ) {
+    if ( isn < 0 && thread_chi2sums->isn_max > thread_chi2sums->isn_min ) 
+      { thread_chi2sums->nchunk++ ;  return(thread_chi2sums->isn_min); }
+    return(-1);
+  }
+
+  ichunk = __atomic_fetch_add(&FCN_POOL.ICHUNK_NEXT, 1, __ATOMIC_RELAXED);
+  if ( ichunk >= FCN_POOL.NCHUNK ) { return(-1); }
+
+  isn_min = FCN_POOL.ISN_FIRST + ichunk * FCN_POOL.NSN_CHUNK ;
+  isn_max = isn_min + FCN_POOL.NSN_CHUNK ;
+  if ( isn_max > FCN_POOL.NSN ) { isn_max = FCN_POOL.NSN; }
+
+  thread_chi2sums->isn_min = isn_min ;
+  thread_chi2sums->isn_max = isn_max ;
+  thread_chi2sums->ichunk  = ichunk ;
+  thread_chi2sums->nchunk++ ;
+  return(isn_min);
+
+} // end next_isn_FCN_POOL
+
+// =================================================================
+void store_chunk_FCN_POOL(thread_chi2sums_def *thread_chi2sums, int ichunk,
+			  double chi2sum_tot, double chi2sum_Ia,
+			  double nsnfitIa, double nsnfitcc, int nsnfit, 
+			  int nsnfit_truecc, int nsnspecIa) {
+
+  // Created Oct 2026
+  // Store partial chi2 sums for chunk index ichunk, so that fcn can
+  // sum chunks in fixed order regardless of which thread processed
+  // each chunk. Also move d(chi2)/dM0 sums from thread to chunk.
+
+  chunk_chi2sums_def *CHUNK = &FCN_POOL.CHUNKSUMS[ichunk] ;
+  int iz ;
+
+  // ---------- BEGIN ----------
+
+  CHUNK->chi2sum_tot   = chi2sum_tot ;
+  CHUNK->chi2sum_Ia    = chi2sum_Ia ;
+  CHUNK->nsnfitIa      = nsnfitIa ;
+  CHUNK->nsnfitcc      = nsnfitcc ;
+  CHUNK->nsnfit        = nsnfit ;
+  CHUNK->nsnfit_truecc = nsnfit_truecc ;
+  CHUNK->nsnspecIa     = nsnspecIa ;
+
+  for(iz=0; iz < INPUTS.nzbin; iz++ ) {
+    CHUNK->grad_M0[iz] = thread_chi2sums->grad_M0[iz] ;
+    thread_chi2sums->grad_M0[iz] = 0.0 ;
+  }
+
+  return ;
+
+} // end store_chunk_FCN_POOL
+
+void zero_chunk_FCN_POOL(chunk_chi2sums_def *CHUNK) {
+  int iz ;
+  CHUNK->chi2sum_tot = CHUNK->chi2sum_Ia = 0.0 ;
+  CHUNK->nsnfitIa    = CHUNK->nsnfitcc   = 0.0 ;
+  CHUNK->nsnfit      = CHUNK->nsnfit_truecc = CHUNK->nsnspecIa = 0 ;
+  for(iz=0; iz < INPUTS.nzbin; iz++ ) { CHUNK->grad_M0[iz] = 0.0 ; }
+} // end zero_chunk_FCN_POOL
+
+
+// =================================================================
+void init_FCN_MPI(void) {
+
+  // Created Oct 2026
+  // For USE_MPI build, init MPI and store rank & size in FCN_MPI.
+  // Ranks > 0 send FP_STDOUT to /dev/null so that the log is
+  // written only once. Abort on options that cannot be shared.
+  // Without USE_MPI, FCN_MPI keeps NRANK=1 from set_defaults.
+
+#ifdef USE_MPI
+  int  IRANK, NRANK ;
+  char fnam[] = "init_FCN_MPI" ;
+
+  // ----------- BEGIN -------------
+
+  MPI_Init(NULL, NULL);
+  MPI_Comm_rank(MPI_COMM_WORLD, &IRANK);
+  MPI_Comm_size(MPI_COMM_WORLD, &NRANK);
+  FCN_MPI.IRANK = IRANK ;
+  FCN_MPI.NRANK = NRANK ;
+
+  fprintf(FP_STDOUT, "\t %s: NRANK = %d (nthread=%d per rank)\n", 
+	  fnam, NRANK, INPUTS.nthread );
+  fflush(FP_STDOUT);
+
+  if ( NRANK == 1 ) { return; }
+
+  if ( SUBPROCESS.USE || strlen(INPUTS.datafile_batch) > 0 ) {
+    sprintf(c1err,"MPI NRANK=%d not supported with SUBPROCESS", NRANK);
+    sprintf(c2err,"or with datafile_batch.");
+    errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err); 
+  }
+
+  if ( IRANK > 0 ) { FP_STDOUT = fopen("/dev/null", "wt"); }
+#endif
+
+  return ;
+
+} // end init_FCN_MPI
+
+// =================================================================
+void reduce_FCN_MPI(double *SUMS, int NSUM) {
+
+  // Created Oct 2026
+  // Replace SUMS[0:NSUM-1] with sum over MPI ranks.
+
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, SUMS, NSUM, MPI_DOUBLE, MPI_SUM,
+		MPI_COMM_WORLD);
+#endif
+
+  return ;
+
+} // end reduce_FCN_MPI
+
+// =================================================================
+void end_FCN_MPI(void) {
+
+  // Created Oct 2026
+#ifdef USE_MPI
+  MPI_Finalize();
+#endif
+  return ;
+} // end end_FCN_MPI
+
+// =================================================================
+void init_FCN_POOL(int nthread) {
+
+  // Created Oct 2026
+  // On first call, create nthread-1 persistent worker threads that
+  // wait for each fcn call; main thread works as id_thread=0.
+
+  int t, rc ;
+  char fnam[] = "init_FCN_POOL" ;
+
+  // ---------- BEGIN ----------
+
+  if ( FCN_POOL.INIT ) { return ; }
+
+  FCN_POOL.NTHREAD    = nthread ;
+  FCN_POOL.GENERATION = 0 ;
+  FCN_POOL.NDONE      = 0 ;
+
+  // fcn uses at most 16 chunks per thread
+  FCN_POOL.MXCHUNK    = 16*nthread ;
+  FCN_POOL.CHUNKSUMS  = (chunk_chi2sums_def*)
+    malloc(FCN_POOL.MXCHUNK * sizeof(chunk_chi2sums_def));
+  pthread_mutex_init(&FCN_POOL.MUTEX, NULL);
+  pthread_cond_init(&FCN_POOL.COND_START, NULL);
+  pthread_cond_init(&FCN_POOL.COND_DONE,  NULL);
+
+  for ( t = 1; t < nthread; t++ ) {
+    FCN_POOL.ID[t] = t ;
+    rc = pthread_create(&FCN_POOL.THREAD[t], NULL, worker_FCN_POOL, 
+			&FCN_POOL.ID[t] ) ; 
+    if ( rc != 0 ) {
+      sprintf(c1err,"pthread_create returns errcode=%d for t=%d", rc, t);
+      sprintf(c2err,"nthread=%d", nthread );
+      errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err);  
+    }
+    pthread_detach(FCN_POOL.THREAD[t]);
+  }
+
+  FCN_POOL.INIT = true ;
+
+  fprintf(FP_STDOUT, "  %s: created pool of %d fcn threads.\n",
+	  fnam, nthread );
+  fflush(FP_STDOUT);
+
+  return ;
+
+} // end init_FCN_POOL
+
+
+// =================================================================
+void *worker_FCN_POOL(void *arg) {
+
+  // Created Oct 2026
+  // Persistent worker thread: wait for next fcn call (GENERATION),
+  // evaluate chi2 sums for fetched chunks, and notify fcn when done.
+  // Thread lives until program exit.
+
+  int t = *(int*)arg ;
+  int GENERATION_LAST = 0 ;
+
+  // ---------- BEGIN ----------
+
+  while ( 1 ) {
+    pthread_mutex_lock(&FCN_POOL.MUTEX);
+    while ( FCN_POOL.GENERATION == GENERATION_LAST ) 
+      { pthread_cond_wait(&FCN_POOL.COND_START, &FCN_POOL.MUTEX); }
+    GENERATION_LAST = FCN_POOL.GENERATION ;
+    pthread_mutex_unlock(&FCN_POOL.MUTEX);
+
+    MNCHI2FUN(&FCN_POOL.CHI2SUMS[t]);
+
+    pthread_mutex_lock(&FCN_POOL.MUTEX);
+    FCN_POOL.NDONE++ ;
+    if ( FCN_POOL.NDONE == FCN_POOL.NTHREAD-1 ) 
+      { pthread_cond_signal(&FCN_POOL.COND_DONE); }
+    pthread_mutex_unlock(&FCN_POOL.MUTEX);
+  }
+
+  return(void *) 0 ;
+
+} // end worker_FCN_POOL
+
+#endif 
+
+
+// ==============================================
+void  fcnFetch_AlphaBetaGamma(double *xval, double z, double logmass, 
+			      double *alpha, double *beta, double *gamma) {
+
+  // Apr 2 2018
+  // Return alpha and beta for fcn fit function
   //
   // Aug 19 2018: set OPT_LOGMASS_SLOPE if either ipar<=1 (instead of ==1)
   //              Allows fixing dalpha/dmass & dbeta/dmass wihtout floating.
@@ -4890,12 +6155,14 @@ void  fcnFetch_AlphaBetaGamma(double *xval, double z, double logmass,
 } // end fcnFetch_AlphaBetaGamma
 
 // ================================
-double fcn_M0(int n, double *M0LIST) {
+double fcn_M0(int n, double *M0LIST, int *IZ_DERIV, double *DERIV) {
 
   // return model M0 for this data index 'n'
   // and list of M0LIST in each z bin
   // Jun 27 2017: REFACTOR z bins
   // Jan 29 2019: if no iz1 bin, return(M0) instead of retrn(M0bin0)
+  // Oct 14 2026: return dM0/dM0LIST[IZ_DERIV[0,1]] = DERIV[0,1] 
+  //              for analytic fcn gradient (DERIV=0 -> no dependence)
 
   int LDMP=0;
   int iz, iz0, iz1, NBINz, NSN_BIASCOR ;
@@ -4905,6 +6172,8 @@ double fcn_M0(int n, double *M0LIST) {
   // ----------- BEGIN ----------
 
   M0      = INPUTS.M0 ;
+  IZ_DERIV[0] = IZ_DERIV[1] = 0 ;
+  DERIV[0]    = DERIV[1]    = 0.0 ;
 
   iz0     = INFO_DATA.TABLEVAR.IZBIN[n];
   zdata   = INFO_DATA.TABLEVAR.zhd[n];
@@ -4915,6 +6184,7 @@ double fcn_M0(int n, double *M0LIST) {
        INPUTS.uM0 == M0FITFLAG_ZBINS_FLAT ) {
     iz    = iz0;
     M0    = M0LIST[iz] ;
+    IZ_DERIV[0] = iz;   DERIV[0] = 1.0 ;
   }
   else if ( INPUTS.uM0 == M0FITFLAG_ZBINS_INTERP ) {
     // linear interp
@@ -4957,6 +6227,8 @@ double fcn_M0(int n, double *M0LIST) {
 
     zfrac = ( zdata - zbin0 ) / ( zbin1 - zbin0) ;
     M0    = M0bin0 + (M0bin1-M0bin0) * zfrac ;
+    IZ_DERIV[0] = iz0;   DERIV[0] = 1.0 - zfrac ;
+    IZ_DERIV[1] = iz1;   DERIV[1] = zfrac ;
 
     LDMP = (n == -95 ); // xxx REMOVE
     if ( LDMP ) {    
@@ -5223,6 +6495,50 @@ void get_INTERPWGT_abg(double alpha, double beta, double gammadm, int DUMPFLAG,
 } // end get_INTERPWGT_abg
 
 
+// ===========================================================
+void get_INTERPWGT_abg_cache(double alpha, double beta, double gammadm, 
+			     INTERPWGT_CACHE_DEF *CACHE,
+			     INTERPWGT_AlphaBetaGammaDM *INTERPWGT, 
+			     char *callFun ) {
+
+  // Created Oct 2026
+  // Same output as get_INTERPWGT_abg, but first check *CACHE for
+  // exact match of alpha,beta,gammadm from previous event(s).
+  // If there is no match, call get_INTERPWGT_abg and store result
+  // in CACHE (replace oldest entry when CACHE is full).
+  // CACHE is local to caller, so this is thread-safe.
+
+  int i ;
+
+  // ------------ BEGIN -------------
+
+  CACHE->NCALL++ ;
+
+  for(i=0; i < CACHE->N; i++ ) {
+    if ( CACHE->abg[i][0] == alpha && 
+	 CACHE->abg[i][1] == beta  && 
+	 CACHE->abg[i][2] == gammadm ) {
+      *INTERPWGT = CACHE->INTERPWGT[i];
+      CACHE->NHIT++ ;
+      return ;
+    }
+  }
+
+  get_INTERPWGT_abg(alpha, beta, gammadm, 0, INTERPWGT, callFun);
+
+  i = CACHE->NEXT ;
+  CACHE->abg[i][0]    = alpha ;
+  CACHE->abg[i][1]    = beta ;
+  CACHE->abg[i][2]    = gammadm ;
+  CACHE->INTERPWGT[i] = *INTERPWGT ;
+  if ( CACHE->N < MXCACHE_INTERPWGT ) { CACHE->N++ ; }
+  CACHE->NEXT = (i+1) % MXCACHE_INTERPWGT ;
+
+  return ;
+
+} // end get_INTERPWGT_abg_cache
+
+
 // ===========================================================
 double fcn_muerrsq(char *name, double alpha, double beta, double gamma,
 		   double (*COV)[NLCPAR], 
@@ -5605,6 +6921,9 @@ void set_defaults(void) {
   INPUTS.write_chi2grid  = 0 ;
 
   INPUTS.minos      = 0 ; // disable default minos, Apr 22 2022
+  INPUTS.fcn_grad   = 0 ; 
+  INPUTS.fcn_soa    = 0 ; 
+  INPUTS.opt_sigint_iter = 0 ;
   INPUTS.nfile_data = 0 ;
   INPUTS.nfile_data_override = 0 ;
   sprintf(INPUTS.PREFIX,     "NONE" );
@@ -5848,9 +7167,17 @@ void set_defaults(void) {
   INPUTS.restore_bug_mumodel_zhel = 0; 
 
   INPUTS.nthread           = 1 ; // 1 -> no thread
+  FCN_MPI.IRANK = 0;  FCN_MPI.NRANK = 1;  // see init_FCN_MPI
 
   INPUTS.cidlist_debug_biascor[0] = 0 ;
 
+  INPUTS.cachefile_biasCor[0]  = 0 ;
+  INPUTS.HASH_INPUTS_biasCor   = 0 ;
+
+  INPUTS.datafile_batch[0]     = 0 ;
+  INPUTS.nproc_batch           = 1 ;
+  INFO_BIASCOR.PRELOAD_SIMFILE = false ;
+
   // === set blind-par values to be used if blindflag=2 (Aug 2017)
   for(ipar=0; ipar < MAXPAR; ipar++ )  {   
     INPUTS.blind_cosinePar[ipar][0] = 0.0 ;
@@ -6018,6 +7345,10 @@ void read_data(void) {
   // apply parameter blinding (after we know if DATA are real or sim)
   apply_blindpar();
 
+  // Oct 2026: tabulate distances for fixed cosmology params
+  init_COSMODL_TABLE(INPUTS.COSPAR);
+  init_COSMODL_TABLE(INPUTS.COSPAR_UNBLIND);
+
   store_output_varnames(); // May 2020
   
   // compute more table variables
@@ -6064,11 +7395,10 @@ float malloc_MUCOV(int opt, int IDSAMPLE, CELLINFO_DEF *CELLINFO ) {
   // Input opt not used,.
   // Sep 14 2021: malloc USE element
   // Jan 12 2023: changed hard-coded logmass binning values to use inputs.logmass_min and inputs.logmass_max
+  // Oct 14 2026: do not malloc per-cell MAD lists here; 
+  //              see load_MADLIST_MUCOV.
 
   int debug_malloc = INPUTS.debug_malloc ;
-  bool DO_MAD      = (INPUTS.opt_biasCor & MASK_BIASCOR_MAD) > 0;
-  bool DO_COVSCALE = (INPUTS.opt_biasCor & MASK_BIASCOR_MUCOVSCALE) > 0;
-  bool DO_COVADD   = (INPUTS.opt_biasCor & MASK_BIASCOR_MUCOVADD) > 0;
 
   float f_MEMORY = 0.0;
   int NCELL;
@@ -6076,9 +7406,8 @@ float malloc_MUCOV(int opt, int IDSAMPLE, CELLINFO_DEF *CELLINFO ) {
   int NBINa,NBINb,NBINg,NBINm,NBINz,NBINc ;
   double cmin,cmax,cbin,c_lo,c_hi,c_avg;
   double mmin,mmax,mbin,m_lo,m_hi,m_avg;
-  int ic,im,i1d;
+  int ic,im;
 
-  int NPERCELL_REALLOC=2000;
   char fnam[] = "malloc_MUCOV";
 
   // ------------- BEGIN --------------
@@ -6166,26 +7495,14 @@ float malloc_MUCOV(int opt, int IDSAMPLE, CELLINFO_DEF *CELLINFO ) {
     CELLINFO->BININFO_m.avg[im] = m_avg ;
   }
 
-  if (DO_MAD) {
-    if (DO_COVSCALE || DO_COVADD) {
-	CELLINFO->ABSPULL =  (double **) malloc(sizeof(double*)*NCELL);
-	CELLINFO->PULL    =  (double **) malloc(sizeof(double*)*NCELL);
-	int MEMD_REALLOC = sizeof(double)*NPERCELL_REALLOC ;
-	for (i1d=0; i1d<NCELL; i1d++) { 
-	  CELLINFO->ABSPULL[i1d] = (double *) malloc(MEMD_REALLOC);
-	  CELLINFO->PULL[i1d]    = (double *) malloc(MEMD_REALLOC);
-	}
-    }
-    if (DO_COVADD) {
-      CELLINFO->MURES =  (double **) malloc(sizeof(double*)*NCELL);
-      CELLINFO->MUCOV =  (double **) malloc(sizeof(double*)*NCELL);
-      for (i1d=0; i1d<NCELL; i1d++){
-	CELLINFO->MURES[i1d] = (double *) malloc(sizeof(double)*NPERCELL_REALLOC);
-	CELLINFO->MUCOV[i1d] = (double *) malloc(sizeof(double)*NPERCELL_REALLOC);
-      }
-    }
-  }
-
+  // Oct 2026: MAD lists are loaded into contiguous blocks after
+  //   all events are processed; see load_MADLIST_MUCOV. 
+  //   Here just init pointers.
+  CELLINFO->ABSPULL = CELLINFO->PULL = NULL ;
+  CELLINFO->MURES   = CELLINFO->MUCOV = NULL ;
+  CELLINFO->OFFSET_CELL   = NULL ;
+  CELLINFO->ABSPULL_BLOCK = CELLINFO->PULL_BLOCK = NULL ;
+  CELLINFO->MURES_BLOCK   = CELLINFO->MUCOV_BLOCK = NULL ;
 
   return f_MEMORY;
 } // end malloc_MUCOV
@@ -6979,6 +8296,10 @@ float malloc_TABLEVAR(int opt, int LEN_MALLOC, TABLEVAR_DEF *TABLEVAR) {
   // Jun 30 2021: fix bug summing memory from malloc_float3D; see f_MEM
   // Nov 17 2022: check REQUIRE_pIa to allocate pIa memory
   //     (for biasCor and CCprior, read pIa only if cutwin(pIa) is defined)
+  // Oct 14 2026: 
+  //   + name and field strings point into one contiguous block
+  //     to avoid per-row malloc overhead (~2x less string memory).
+  //   + zcmberr only for data (not used for biasCor or CCprior)
 
   int  EVENT_TYPE   = TABLEVAR->EVENT_TYPE;
   bool IS_DATA      = (EVENT_TYPE == EVENT_TYPE_DATA);
@@ -6992,6 +8313,7 @@ float malloc_TABLEVAR(int opt, int LEN_MALLOC, TABLEVAR_DEF *TABLEVAR) {
   int MEMB    = LEN_MALLOC  * sizeof(bool);
   int MEMC    = LEN_MALLOC  * sizeof(char*);
   int MEMC2   = MXCHAR_CCID * sizeof(char);
+  size_t MEMC_BLOCK = (size_t)(LEN_MALLOC+1) * (size_t)MEMC2 ;
 
   bool DOBIAS_MU = ( INPUTS.opt_biasCor & MASK_BIASCOR_MU     ) ;
   bool IDEAL     = ( INPUTS.opt_biasCor & MASK_BIASCOR_COVINT ) ;
@@ -7013,17 +8335,20 @@ float malloc_TABLEVAR(int opt, int LEN_MALLOC, TABLEVAR_DEF *TABLEVAR) {
 
   if ( opt > 0 ) {   
     
-    TABLEVAR->name =  (char**)malloc(MEMC);
+    TABLEVAR->name       = (char**)malloc(MEMC);
+    TABLEVAR->name_block = (char* )malloc(MEMC_BLOCK); 
+    MEMTOT += MEMC + MEMC_BLOCK ;
     for(i=0; i<LEN_MALLOC; i++ )  { 
-      TABLEVAR->name[i] = (char*)malloc(MEMC2); 
-      MEMTOT += MEMC2; 
+      TABLEVAR->name[i] = &TABLEVAR->name_block[i*MEMC2] ;
       TABLEVAR->name[i][0] = 0 ;
     }
 
     if ( USE_FIELD ) {
-      TABLEVAR->field =  (char**)malloc(MEMC);
+      TABLEVAR->field       = (char**)malloc(MEMC);
+      TABLEVAR->field_block = (char* )malloc(MEMC_BLOCK); 
+      MEMTOT += MEMC + MEMC_BLOCK ;
       for(i=0; i<LEN_MALLOC; i++ ) 
-	{ TABLEVAR->field[i] = (char*)malloc(MEMC2); MEMTOT+=MEMC2; }  
+	{ TABLEVAR->field[i] = &TABLEVAR->field_block[i*MEMC2] ; }  
     }
 
 
@@ -7070,7 +8395,8 @@ float malloc_TABLEVAR(int opt, int LEN_MALLOC, TABLEVAR_DEF *TABLEVAR) {
     TABLEVAR->zhd           = (float *) malloc(MEMF); MEMTOT+=MEMF;
     TABLEVAR->zhderr        = (float *) malloc(MEMF); MEMTOT+=MEMF;
     TABLEVAR->zcmb          = (float *) malloc(MEMF); MEMTOT+=MEMF;
-    TABLEVAR->zcmberr       = (float *) malloc(MEMF); MEMTOT+=MEMF;
+    if ( IS_DATA ) 
+      { TABLEVAR->zcmberr   = (float *) malloc(MEMF); MEMTOT+=MEMF; }
     TABLEVAR->zhel          = (float *) malloc(MEMF); MEMTOT+=MEMF;
     TABLEVAR->zhelerr       = (float *) malloc(MEMF); MEMTOT+=MEMF;
 
@@ -7136,11 +8462,11 @@ float malloc_TABLEVAR(int opt, int LEN_MALLOC, TABLEVAR_DEF *TABLEVAR) {
   }
   else {
     // free memory
-    for(i=0; i<LEN_MALLOC; i++ ) { free(TABLEVAR->name[i]); }
+    free(TABLEVAR->name_block);
     free(TABLEVAR->name);
 
     if ( USE_FIELD ) {
-      for(i=0; i<LEN_MALLOC; i++ ) { free(TABLEVAR->field[i]) ; }
+      free(TABLEVAR->field_block);
       free(TABLEVAR->field);
     }
 
@@ -7169,7 +8495,8 @@ float malloc_TABLEVAR(int opt, int LEN_MALLOC, TABLEVAR_DEF *TABLEVAR) {
     }
 
     free(TABLEVAR->zhd);      free(TABLEVAR->zhderr);
-    free(TABLEVAR->zcmb);     free(TABLEVAR->zcmberr);
+    free(TABLEVAR->zcmb);     
+    if ( IS_DATA ) { free(TABLEVAR->zcmberr); }
     free(TABLEVAR->zhel);     free(TABLEVAR->zhelerr);
     free(TABLEVAR->vpec);     free(TABLEVAR->vpecerr);
     free(TABLEVAR->zmuerr);
@@ -7534,7 +8861,7 @@ void SNTABLE_READPREP_TABLEVAR(int IFILE, int ISTART, int LEN,
     TABLEVAR->zhderr[irow]     = -9.0 ;
     TABLEVAR->zmuerr[irow]     = -9.0 ;
     TABLEVAR->zcmb[irow]       = -9.0 ;
-    TABLEVAR->zcmberr[irow]    = -9.0 ;
+    if ( IS_DATA ) { TABLEVAR->zcmberr[irow] = -9.0 ; }
     TABLEVAR->zhel[irow]       = -9.0 ;
     TABLEVAR->zhelerr[irow]    = -9.0 ;
     TABLEVAR->host_logmass[irow] = -9.0 ;
@@ -7613,9 +8940,11 @@ void SNTABLE_READPREP_TABLEVAR(int IFILE, int ISTART, int LEN,
   sprintf(vartmp,"zCMB:F"); 
   SNTABLE_READPREP_VARDEF(vartmp, &TABLEVAR->zcmb[ISTART], 
 			  LEN, OPTMASK_VBOSE);
-  sprintf(vartmp,"zCMBERR:F"); 
-  SNTABLE_READPREP_VARDEF(vartmp, &TABLEVAR->zcmberr[ISTART], 
-			  LEN, OPTMASK_VBOSE);
+  if ( IS_DATA ) {
+    sprintf(vartmp,"zCMBERR:F"); 
+    SNTABLE_READPREP_VARDEF(vartmp, &TABLEVAR->zcmberr[ISTART], 
+			    LEN, OPTMASK_VBOSE);
+  }
 
   sprintf(vartmp,"zHEL:F");   // Dec 11 2020
   SNTABLE_READPREP_VARDEF(vartmp, &TABLEVAR->zhel[ISTART], 
@@ -10042,8 +11371,12 @@ void prepare_biasCor(void) {
   // Feb 5 2020: if > 5 SIM_gammaDM bins, do NOT add another dimension
   // Jun 25 2020: if INPUTS.fitflag_sigmb=0, leave it at zero
   // Dec 21 2020: check option to NOT require valid biasCor 
+  // Oct 14 2026: move sub-sample prep to prepare_biasCor_sample,
+  //              and use nthread>1 to prepare sub-samples in parallel.
+  // Oct 14 2026: check cachefile_biascor option to load prepared maps
+  //              instead of reading & processing the biasCor sample.
 
-  int INDX, IDSAMPLE, SKIP, NSN_DATA, CUTMASK, ievt ;
+  int IDSAMPLE, NSN_DATA, CUTMASK, ievt ;
   int  NBINm = INPUTS.nbin_logmass;
   int  NBINg = 0; // is set below 
   int  OPTMASK        = INPUTS.opt_biasCor ;
@@ -10064,15 +11397,17 @@ void prepare_biasCor(void) {
   char txt_biasCor[40], *name  ;
   
   bool USEDIM_GAMMADM, USEDIM_LOGMASS;
-  int NDIM_BIASCOR=0, ILCPAR_MIN, ILCPAR_MAX ;
+  int NDIM_BIASCOR=0 ;
   char fnam[] = "prepare_biasCor" ;
 
   // ------------- BEGIN -------------
   
   INFO_BIASCOR.NDIM = 0;
-  INFO_BIASCOR.TABLEVAR.NSN_ALL       = 0 ;
-  INFO_BIASCOR.TABLEVAR.NSN_PASSCUTS  = 0 ;
-  INFO_BIASCOR.TABLEVAR.NSN_REJECT    = 0 ;
+  if ( !INFO_BIASCOR.PRELOAD_SIMFILE ) {
+    INFO_BIASCOR.TABLEVAR.NSN_ALL       = 0 ;
+    INFO_BIASCOR.TABLEVAR.NSN_PASSCUTS  = 0 ;
+    INFO_BIASCOR.TABLEVAR.NSN_REJECT    = 0 ;
+  }
   INFO_BIASCOR.GAMMADM_OFFSET         = 0.0 ;
   INFO_BIASCOR.DUST_FLAG          = false ;
 
@@ -10092,8 +11427,6 @@ void prepare_biasCor(void) {
     { INFO_BIASCOR.ILCPAR_MIN = INDEX_mu; INFO_BIASCOR.ILCPAR_MAX = INDEX_mu;}
   else
     { INFO_BIASCOR.ILCPAR_MIN = 0; INFO_BIASCOR.ILCPAR_MAX = NLCPAR-1; }
-  ILCPAR_MIN = INFO_BIASCOR.ILCPAR_MIN ;
-  ILCPAR_MAX = INFO_BIASCOR.ILCPAR_MAX ;
 
   if ( nfile_biasCor == 0 ) { return ; }
 
@@ -10104,14 +11437,24 @@ void prepare_biasCor(void) {
 
   print_biascor_options(); // print info for each bit, July 2022
 
-  // read biasCor file
-  read_simFile_biasCor();
+  // load prepared biasCor maps from cache (if cache key matches)
+  bool LOAD_CACHE = read_cache_biasCor();
+
+  if ( !LOAD_CACHE ) {
+    // read biasCor file (unless already read before fork in batch mode)
+    if ( !INFO_BIASCOR.PRELOAD_SIMFILE ) { read_simFile_biasCor(); }
 
-  // check for BS21 model which has AV > 0
-  set_DUST_FLAG_biasCor();
+    // check for BS21 model which has AV > 0
+    set_DUST_FLAG_biasCor();
+  }
+
+  if ( LOAD_CACHE || INFO_BIASCOR.PRELOAD_SIMFILE ) {
+    sprintf(SNTABLE_VERSION_PHOTOMETRY, "%s",
+	    VERSION_PHOTOMETRY_EVENT_TYPE[EVENT_TYPE_BIASCOR] );
+  }
 
   // setup 5D bins 
-  if ( DOCOR_5D || DOCOR_1D5DCUT ) {
+  if ( (DOCOR_5D || DOCOR_1D5DCUT) && !LOAD_CACHE ) {
     for(IDSAMPLE=0; IDSAMPLE < NSAMPLE_BIASCOR ; IDSAMPLE++ ) 
       { setup_CELLINFO_biasCor(IDSAMPLE); }
   }
@@ -10212,6 +11555,12 @@ void prepare_biasCor(void) {
   }
   
 
+  // with cache, skip directly to storing bias for each data event
+  if ( LOAD_CACHE ) {
+    if ( IDEAL ) { write_COVINT_biasCor(); }
+    goto STORE_BIAS_DATA ;
+  }
+
   // count number of biasCor events passing cuts (after setup_BININFO calls)
   for(ievt=0; ievt < INFO_BIASCOR.TABLEVAR.NSN_ALL; ievt++ )  { 
     compute_more_TABLEVAR(ievt, &INFO_BIASCOR.TABLEVAR ); // from prepare_biasCor
@@ -10246,145 +11595,716 @@ void prepare_biasCor(void) {
   // -------- START LOOP OVER SURVEY/FIELDGROUP SUB-SAMPLES ---------
   // ----------------------------------------------------------------
 
-  char *NAME_SAMPLE;
+  // Oct 2026: sub-samples are independent, so distribute them
+  //   over nthread threads.
+  int nthread = INPUTS.nthread ;
+  if ( INPUTS.debug_mucovscale > 0 ) { nthread = 1; } // shared debug arrays
+  if ( nthread > NSAMPLE_BIASCOR   ) { nthread = NSAMPLE_BIASCOR; }
+
+  if ( nthread > 1 ) 
+    { prepare_biasCor_threads(nthread); }
+  else {
+    for( IDSAMPLE=0; IDSAMPLE < NSAMPLE_BIASCOR ; IDSAMPLE++ ) 
+      { prepare_biasCor_sample(IDSAMPLE); }
+  }
+
+  // -------------------------------------------------------------
+  // -------- END LOOP OVER SURVEY/FIELDGROUP SUB-SAMPLES --------
+  // -------------------------------------------------------------
+
+  // write prepared maps to cache for next job
+  write_cache_biasCor();
+
+  // compute and store bias(mB,x1,c) for each data event.
+  // If data event lies in undefined biasBin(z,x1,c) then reject event.
+  int n, istore ;
+  int NSKIP_TOT=0, NUSE_TOT=0;
+  int NSKIP[MXNUM_SAMPLE] ;
+  int NUSE[MXNUM_SAMPLE];
+
+ STORE_BIAS_DATA:
+  for(IDSAMPLE=0; IDSAMPLE<MXNUM_SAMPLE; IDSAMPLE++ ) {
+    NSKIP[IDSAMPLE] = 0 ;
+    NUSE[IDSAMPLE]  = 0 ;
+  }
+
+  fprintf(FP_STDOUT, "\n");
+  fprintf(FP_STDOUT, " For each DATA event before fit, store \n");
+  fprintf(FP_STDOUT, "   * mb,x1,c-bias at each alpha,beta,gammaDM \n");
+  if ( DOCOR_MUCOVSCALE) 
+    { fprintf(FP_STDOUT, "   * muCOVscale   at each alpha,beta,gammaDM \n"); }
+
+
+  int  DUMPFLAG = 0 ;
+  char *cidlist_debug  = INPUTS.cidlist_debug_biascor;
+  bool CHECK_DUMPFLAG  = ( strlen(cidlist_debug) > 0 ) ;
+  int ndump_nobiasCor = INPUTS.ndump_nobiasCor;
+
+  for (n=0; n < NSN_DATA; ++n) {
+
+    CUTMASK  = INFO_DATA.TABLEVAR.CUTMASK[n]; 
+    IDSAMPLE = INFO_DATA.TABLEVAR.IDSAMPLE[n]; 
+    if ( CUTMASK ) { continue ; }
+
+    if ( CHECK_DUMPFLAG ) {
+      name     = INFO_DATA.TABLEVAR.name[n];
+      DUMPFLAG = ( strstr(cidlist_debug,name) != NULL ); 
+    }
+
+    istore = storeBias_data(n,DUMPFLAG);
+    
+    NUSE[IDSAMPLE]++ ; NUSE_TOT++ ;
+    if ( istore == 0 && REQUIRE_VALID_BIASCOR )  { 
+      NSKIP_TOT++; NSKIP[IDSAMPLE]++ ;  
+      setbit_CUTMASK(n, CUTBIT_BIASCOR, &INFO_DATA.TABLEVAR); 
+      if( NSKIP_TOT < ndump_nobiasCor ) 
+	{ storeBias_data(n,1); } 
+    }    
+  }
+
+
+  for(IDSAMPLE=0; IDSAMPLE < NSAMPLE_BIASCOR; IDSAMPLE++ ) {
+
+    // store NSKIP and NUSE for later to print warning about excess loss
+    NREJECT_BIASCOR_BYSAMPLE[IDSAMPLE] = NSKIP[IDSAMPLE];
+
+    if ( SAMPLE_BIASCOR[IDSAMPLE].DOFLAG_SELECT == 0 ) { continue; }
+    fprintf(FP_STDOUT,
+	    "  Rejected %d (of %d) DATA events with no %dD biasCor (%s).\n",
+	   NSKIP[IDSAMPLE], NUSE[IDSAMPLE], 
+	   NDIM_BIASCOR, SAMPLE_BIASCOR[IDSAMPLE].NAME );
+  }
+  fprintf(FP_STDOUT, "\n");
+  fflush(FP_STDOUT);
+
+
+  // ------------
+  // free memory used to hold each simBias event;
+  // we only need to keep the small map made in makeMap_fitPar_biasCor.
+
+  if ( NSKIP_TOT == NUSE_TOT ) {
+    sprintf(c1err,"Could not compute biasCor");
+    sprintf(c2err,"Something is messed up.");
+    errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err); 
+  }
+
+  // check option for JLA-like correction
+ CHECK_1DCOR:
+  
+  if ( NDIM_BIASCOR == 1 ) {
+    INPUTS.opt_biasCor |= MASK_BIASCOR_1DZ ; // set OR-bit (AVG or WGT)
+    prepare_biasCor_zinterp();  
+  }
+
+  INFO_BIASCOR.NDIM = NDIM_BIASCOR ;
+
+
+  // print prep time AFTER reading biasCor
+  char str_cputime[60];
+  sprintf(str_cputime,"%s(prep_BIASCOR)", STRING_CPUTIME_INIT);
+  print_cputime(t_read_biasCor[1], str_cputime, UNIT_TIME_MINUTE, 0);
+
+
+  return ;
+
+} // end prepare_biasCor
+
+
+// ======================================================
+void prepare_biasCor_sample(int IDSAMPLE) {
+
+  // Created Oct 2026 (moved from prepare_biasCor)
+  // Prepare biasCor maps for one sub-sample IDSAMPLE; each sub-sample
+  // only fills its own maps, so this function can run in a thread.
+
+  int  OPTMASK            = INPUTS.opt_biasCor ;
+  bool DOCOR_MUCOVSCALE   = ( OPTMASK & MASK_BIASCOR_MUCOVSCALE);
+  int  ILCPAR_MIN         = INFO_BIASCOR.ILCPAR_MIN ;
+  int  ILCPAR_MAX         = INFO_BIASCOR.ILCPAR_MAX ;
+  char *NAME_SAMPLE       = SAMPLE_BIASCOR[IDSAMPLE].NAME ; 
   char borderLine[] = 
     "@=@=@=@=@=@=@=@=@=@=@=@=@=@=@=@=@=@=@=@=@=@=@=@=@=@=@=@=@" ;
+  int  INDX, SKIP ;
+
+  // ---------- BEGIN -----------
+
+  fprintf(FP_STDOUT, "\n %s\n", borderLine);   
 
-  for( IDSAMPLE=0; IDSAMPLE < NSAMPLE_BIASCOR ; IDSAMPLE++ ) {
+  SKIP = 0 ;
+  if ( SAMPLE_BIASCOR[IDSAMPLE].DOFLAG_SELECT  == 0 ) { SKIP = 1; }
+  if ( SAMPLE_BIASCOR[IDSAMPLE].DOFLAG_BIASCOR == 0 ) { SKIP = 1; }
 
-    fprintf(FP_STDOUT, "\n %s\n", borderLine);   
+  if ( SKIP ) {
+    fprintf(FP_STDOUT, "\t SKIP BIASCOR PREP for %s\n", NAME_SAMPLE);
+    return ;
+  }
+  else  {
+    fprintf(FP_STDOUT, "\t START BIASCOR PREP for SAMPLE = %s\n", 
+	    NAME_SAMPLE);
+  }
+  fflush(FP_STDOUT);
 
-    // print ISAMPLE info to screen
-    NAME_SAMPLE  = SAMPLE_BIASCOR[IDSAMPLE].NAME ; 
+  // get wgted avg in each bin to use for interpolation 
+  makeMap_binavg_biasCor(IDSAMPLE);
 
-    SKIP = 0 ;
-    if ( SAMPLE_BIASCOR[IDSAMPLE].DOFLAG_SELECT  == 0 ) { SKIP = 1; }
-    if ( SAMPLE_BIASCOR[IDSAMPLE].DOFLAG_BIASCOR == 0 ) { SKIP = 1; }
+  // prepare 3D bias maps need to interpolate bias
+  for(INDX = ILCPAR_MIN; INDX <= ILCPAR_MAX ; INDX++ ) 
+    { makeMap_fitPar_biasCor(IDSAMPLE,INDX); }
 
-    if ( SKIP ) {
-      fprintf(FP_STDOUT, "\t SKIP BIASCOR PREP for %s\n", NAME_SAMPLE);
-      continue ;
-    }
-    else  {
-      fprintf(FP_STDOUT, "\t START BIASCOR PREP for SAMPLE = %s\n", 
-	      NAME_SAMPLE);
+  fprintf(FP_STDOUT,"\n");  fflush(FP_STDOUT);   
+
+  // make map of sigma_mu bias
+  if ( DOCOR_MUCOVSCALE ) { makeMap_sigmu_biasCor(IDSAMPLE); }
+
+  fprintf(FP_STDOUT, "\n\t END BIASCOR PREP for %s\n", NAME_SAMPLE);
+  fprintf(FP_STDOUT, " %s\n", borderLine);       
+  fflush(FP_STDOUT);
+
+  return ;
+
+} // end prepare_biasCor_sample
+
+
+// ======================================================
+#ifdef USE_THREAD
+struct {
+  pthread_mutex_t MUTEX ;
+  int IDSAMPLE_NEXT ;   // next sub-sample to prepare
+} BIASCOR_POOL ;
+
+void *worker_biasCor_threads(void *arg) {
+  // Created Oct 2026
+  // Fetch next IDSAMPLE until all sub-samples are prepared.
+  int IDSAMPLE;
+  while ( 1 ) {
+    pthread_mutex_lock(&BIASCOR_POOL.MUTEX);
+    IDSAMPLE = BIASCOR_POOL.IDSAMPLE_NEXT++ ;
+    pthread_mutex_unlock(&BIASCOR_POOL.MUTEX);
+    if ( IDSAMPLE >= NSAMPLE_BIASCOR ) { break; }
+    prepare_biasCor_sample(IDSAMPLE);
+  }
+  return(void *) 0 ;
+} // end worker_biasCor_threads
+#endif
+
+
+void prepare_biasCor_threads(int nthread) {
+
+  // Created Oct 2026
+  // Prepare biasCor sub-samples with nthread threads; each thread
+  // fetches the next IDSAMPLE from a shared counter. Main thread
+  // works as thread 0. Printed output from different sub-samples
+  // may be interleaved.
+
+  char fnam[] = "prepare_biasCor_threads" ;
+
+  // ---------- BEGIN -----------
+
+#ifdef USE_THREAD
+  int t, rc ;
+  pthread_t THREAD[MXTHREAD];
+
+  fprintf(FP_STDOUT, "\n  %s: prepare %d sub-samples with %d threads\n",
+	  fnam, NSAMPLE_BIASCOR, nthread);
+  fflush(FP_STDOUT);
+
+  BIASCOR_POOL.IDSAMPLE_NEXT = 0 ;
+  pthread_mutex_init(&BIASCOR_POOL.MUTEX, NULL);
+
+  for ( t = 1; t < nthread; t++ ) {
+    rc = pthread_create(&THREAD[t], NULL, worker_biasCor_threads, NULL);
+    if ( rc != 0 ) {
+      sprintf(c1err,"pthread_create returns errcode=%d for t=%d", rc, t);
+      sprintf(c2err,"nthread=%d", nthread );
+      errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err);  
     }
+  }
+
+  worker_biasCor_threads(NULL);
+
+  for ( t = 1; t < nthread; t++ ) { pthread_join(THREAD[t], NULL); }
+  pthread_mutex_destroy(&BIASCOR_POOL.MUTEX);
+
+#else
+  int IDSAMPLE ;
+  for( IDSAMPLE=0; IDSAMPLE < NSAMPLE_BIASCOR ; IDSAMPLE++ ) 
+    { prepare_biasCor_sample(IDSAMPLE); }
+#endif
+
+  return ;
+
+} // end prepare_biasCor_threads
+
+
+// ======================================================
+// Oct 2026: cache of prepared biasCor maps.
+//   First job (no cache file or key mismatch) prepares maps as usual
+//   and writes them to cachefile_biascor; later jobs with the same key
+//   load the maps and skip reading & processing the biasCor sample.
+//   The key is a hash of the input keys (excluding data-file and
+//   output keys), biasCor file names/sizes/mod-times, and the 
+//   SURVEY/FIELDGROUP sub-sample definitions. The file is raw binary
+//   intended for the same SALT2mu build and platform.
+
+#define MAGIC_CACHE_BIASCOR "BBCBCOR1"
+
+void update_HASH_INPUTS_biasCor(char *item) {
+
+  // Created Oct 2026
+  // Update hash of input items used for biasCor cache key.
+  // Skip input keys that cannot change the biasCor maps.
+
+  int  NKEY_SKIP = 12, ikey ;
+  char keyList_skip[12][24] = {
+    "file=", "datafile=", "prefix=",  "cachefile_biascor=", "nthread=",
+    "write_yaml=", "write_csv=", "write_chi2grid=", 
+    "cat_file_out=", "catfile_out=", "datafile_batch=", "nproc_batch="
+  } ;
+
+  // ---------- BEGIN -----------
+  
+  for(ikey=0; ikey < NKEY_SKIP; ikey++ ) {
+    if ( strncmp(item,keyList_skip[ikey],strlen(keyList_skip[ikey]))==0 )
+      { return; }
+  }
+
+  update_KEY_cache_biasCor(&INPUTS.HASH_INPUTS_biasCor, item);
+
+} // end update_HASH_INPUTS_biasCor
+
+void update_KEY_cache_biasCor(unsigned long long *KEY, char *string) {
+  // Created Oct 2026: combine hash of string with current KEY
+  *KEY = ( (*KEY) * 1099511628211ULL ) ^ hash(string) ;
+} // end update_KEY_cache_biasCor
+
+
+// ======================================================
+unsigned long long get_KEY_cache_biasCor(void) {
+
+  // Created Oct 2026
+  // Return key for biasCor cache; see comments above.
+  // Returns 0 if any biasCor file cannot be found.
+
+  unsigned long long KEY = INPUTS.HASH_INPUTS_biasCor ;
+  int  NFILE = INPUTS.nfile_biasCor ;
+  int  ifile, idsample, i ;
+  struct stat statbuf ;
+  SAMPLE_INFO_DEF *S ;
+  char line[MXPATHLEN+200], *simFile ;
+
+  // ---------- BEGIN -----------
+
+  sprintf(line,"BBC_VERSION=%d  SNANA_VERSION=%s  SIZES=%d,%d,%d,%d",
+	  BBC_VERSION, SNANA_VERSION_CURRENT, 
+	  (int)sizeof(BININFO_DEF), (int)sizeof(FITPARBIAS_DEF),
+	  (int)sizeof(INFO_BIASCOR.COVINT), NSAMPLE_BIASCOR );
+  update_KEY_cache_biasCor(&KEY, line);
+
+  for(ifile=0; ifile < NFILE; ifile++ ) {
+    simFile = INPUTS.simFile_biasCor[ifile];
+    if ( stat(simFile,&statbuf) != 0 ) { return(0); }
+    sprintf(line,"%s %lld %lld", simFile,
+	    (long long)statbuf.st_size, (long long)statbuf.st_mtime);
+    update_KEY_cache_biasCor(&KEY, line);
+  }
+
+  // sub-sample info from data
+  for(idsample=0; idsample < NSAMPLE_BIASCOR; idsample++ ) {
+    S = &SAMPLE_BIASCOR[idsample];
+    sprintf(line,"%s %s %d %d %d "
+	    "%.6e %.6e %.6e %.6e %.6e %.6e %.6e %.6e %.6e %.6e %.6e",
+	    S->NAME, S->STRINGOPT, S->IDSURVEY, 
+	    S->DOFLAG_SELECT, S->DOFLAG_BIASCOR,
+	    S->zMIN_DATA, S->zMAX_DATA, 
+	    S->BINSIZE_REDSHIFT, S->RANGE_REDSHIFT[0], S->RANGE_REDSHIFT[1],
+	    S->BINSIZE_LOGMASS,  S->RANGE_LOGMASS[0],  S->RANGE_LOGMASS[1],
+	    S->BINSIZE_FITPAR[0], S->BINSIZE_FITPAR[1], S->BINSIZE_FITPAR[2]);
+    update_KEY_cache_biasCor(&KEY, line);
+  }
+
+  // BBC redshift bins (for zM0)
+  for(i=0; i < INPUTS.BININFO_z.nbin; i++ ) {
+    sprintf(line,"z %.6e %.6e", INPUTS.BININFO_z.lo[i], 
+	    INPUTS.BININFO_z.hi[i]);
+    update_KEY_cache_biasCor(&KEY, line);
+  }
+
+  if ( KEY == 0 ) { KEY = 1; } // 0 is reserved for invalid key
+  return(KEY) ;
+
+} // end get_KEY_cache_biasCor
+
+
+// ======================================================
+bool use_cache_biasCor(void) {
+
+  // Created Oct 2026
+  // Return true if cachefile_biascor is set and the biasCor options
+  // are supported by the cache. Options that need the biasCor rows
+  // after the maps are prepared are not supported.
+
+  int  OPTMASK = INPUTS.opt_biasCor ;
+  char fnam[] = "use_cache_biasCor" ;
+
+  // ---------- BEGIN -----------
+
+  if ( IGNOREFILE(INPUTS.cachefile_biasCor) ) { return(false); }
+
+  if ( (OPTMASK & MASK_BIASCOR_5D)  == 0    ||
+       INPUTS.write_biascor > 0             ||
+       INPUTS.prescale_biasCor[2] > 0       ||
+       INPUTS.debug_mucovscale > 0          ||
+       SUBPROCESS.USE                       ||
+       strcmp(INPUTS.simFile_biasCor[0],"datafile") == 0 ) {
+    fprintf(FP_STDOUT, "\t %s: WARNING: ignore %s for these options.\n",
+	    fnam, INPUTS.cachefile_biasCor);
     fflush(FP_STDOUT);
+    return(false);
+  }
+
+  return(true);
+
+} // end use_cache_biasCor
+
 
-    // get wgted avg in each bin to use for interpolation 
-    makeMap_binavg_biasCor(IDSAMPLE);
+// ======================================================
+bool read_cache_biasCor(void) {
 
-    // prepare 3D bias maps need to interpolate bias
-    for(INDX = ILCPAR_MIN; INDX <= ILCPAR_MAX ; INDX++ ) 
-      { makeMap_fitPar_biasCor(IDSAMPLE,INDX); }
+  // Created Oct 2026
+  // If cachefile_biascor exists with matching key, load prepared
+  // biasCor maps and return true. Otherwise return false so that
+  // biasCor is read and prepared (and cache is written later).
 
-    fprintf(FP_STDOUT,"\n");  fflush(FP_STDOUT);   
+  char *cacheFile = INPUTS.cachefile_biasCor ;
+  int  EVENT_TYPE = EVENT_TYPE_BIASCOR ;
+  unsigned long long KEY, KEY_FILE;
+  char MAGIC[12];
+  FILE *fp ;
+  char fnam[] = "read_cache_biasCor" ;
 
-    // make map of sigma_mu bias
-    if ( DOCOR_MUCOVSCALE ) { makeMap_sigmu_biasCor(IDSAMPLE); }
+  // ---------- BEGIN -----------
 
-    fprintf(FP_STDOUT, "\n\t END BIASCOR PREP for %s\n", NAME_SAMPLE);
-    fprintf(FP_STDOUT, " %s\n", borderLine);       
+  if ( !use_cache_biasCor() ) { return(false); }
+
+  KEY = get_KEY_cache_biasCor();
+  if ( KEY == 0 ) { return(false); }
+
+  fp = fopen(cacheFile,"rb");
+  if ( !fp ) {
+    fprintf(FP_STDOUT, "\t %s: no cache yet; will write %s\n",
+	    fnam, cacheFile);
     fflush(FP_STDOUT);
+    return(false);
   }
 
+  MAGIC[0] = 0;  KEY_FILE = 0;
+  if ( fread(MAGIC, sizeof(char), 8, fp) != 8                ||
+       fread(&KEY_FILE, sizeof(KEY_FILE), 1, fp) != 1         ||
+       strncmp(MAGIC,MAGIC_CACHE_BIASCOR,8) != 0 || KEY_FILE != KEY ) {
+    fprintf(FP_STDOUT, "\t %s: key mismatch; will overwrite %s\n",
+	    fnam, cacheFile);
+    fflush(FP_STDOUT);
+    fclose(fp);
+    return(false);
+  }
 
-  // -------------------------------------------------------------
-  // -------- END LOOP OVER SURVEY/FIELDGROUP SUB-SAMPLES --------
-  // -------------------------------------------------------------
+  t_read_biasCor[0] = time(NULL); 
 
-  // compute and store bias(mB,x1,c) for each data event.
-  // If data event lies in undefined biasBin(z,x1,c) then reject event.
-  int n, istore ;
-  int NSKIP_TOT=0, NUSE_TOT=0;
-  int NSKIP[MXNUM_SAMPLE] ;
-  int NUSE[MXNUM_SAMPLE];
+  fprintf(FP_STDOUT, "\t %s: load biasCor maps from %s (key=%016llx)\n",
+	  fnam, cacheFile, KEY );
+  fflush(FP_STDOUT);
 
-  for(IDSAMPLE=0; IDSAMPLE<MXNUM_SAMPLE; IDSAMPLE++ ) {
-    NSKIP[IDSAMPLE] = 0 ;
-    NUSE[IDSAMPLE]  = 0 ;
+  // pointers for event stats (biasCor rows are not read)
+  NALL_CUTMASK_POINTER[EVENT_TYPE]    = &INFO_BIASCOR.TABLEVAR.NSN_ALL;
+  NPASS_CUTMASK_POINTER[EVENT_TYPE]   = &INFO_BIASCOR.TABLEVAR.NSN_PASSCUTS;
+  NREJECT_CUTMASK_POINTER[EVENT_TYPE] = &INFO_BIASCOR.TABLEVAR.NSN_REJECT ;
+
+  io_cache_biasCor(-1, fp);
+  fclose(fp);
+
+  t_read_biasCor[1] = time(NULL); 
+
+  fprintf(FP_STDOUT, "\t %s: loaded maps for %d biasCor events "
+	  "passing cuts.\n", fnam, INFO_BIASCOR.TABLEVAR.NSN_PASSCUTS);
+  fflush(FP_STDOUT);
+
+  return(true);
+
+} // end read_cache_biasCor
+
+
+// ======================================================
+void write_cache_biasCor(void) {
+
+  // Created Oct 2026
+  // Write prepared biasCor maps to cachefile_biascor.
+  // Write to temporary file and rename so that other jobs never
+  // read a partially written cache.
+
+  char *cacheFile = INPUTS.cachefile_biasCor ;
+  unsigned long long KEY ;
+  char tmpFile[MXPATHLEN+20];
+  FILE *fp ;
+  char fnam[] = "write_cache_biasCor" ;
+
+  // ---------- BEGIN -----------
+
+  if ( FCN_MPI.IRANK > 0 ) { return; } // MPI ranks share rank 0 cache
+  if ( !use_cache_biasCor() ) { return; }
+
+  KEY = get_KEY_cache_biasCor();
+  if ( KEY == 0 ) { return; }
+
+  sprintf(tmpFile,"%s.tmp%d", cacheFile, (int)getpid() );
+  fp = fopen(tmpFile,"wb");
+  if ( !fp ) {
+    sprintf(c1err,"Could not open biasCor cache file:");
+    sprintf(c2err,"%s", tmpFile);
+    errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err); 
   }
 
-  fprintf(FP_STDOUT, "\n");
-  fprintf(FP_STDOUT, " For each DATA event before fit, store \n");
-  fprintf(FP_STDOUT, "   * mb,x1,c-bias at each alpha,beta,gammaDM \n");
-  if ( DOCOR_MUCOVSCALE) 
-    { fprintf(FP_STDOUT, "   * muCOVscale   at each alpha,beta,gammaDM \n"); }
+  fwrite(MAGIC_CACHE_BIASCOR, sizeof(char), 8, fp);
+  fwrite(&KEY, sizeof(KEY), 1, fp);
+  io_cache_biasCor(+1, fp);
+  fclose(fp);
+
+  if ( rename(tmpFile,cacheFile) != 0 ) {
+    sprintf(c1err,"Could not rename biasCor cache file");
+    sprintf(c2err,"%s -> %s", tmpFile, cacheFile);
+    errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err); 
+  }
+
+  fprintf(FP_STDOUT, "\n\t %s: wrote biasCor maps to %s (key=%016llx)\n",
+	  fnam, cacheFile, KEY );
+  fflush(FP_STDOUT);
+
+  return ;
+
+} // end write_cache_biasCor
+
+
+// ======================================================
+void io_cache_biasCor(int OPT, FILE *fp) {
+
+  // Created Oct 2026
+  // OPT = +1 -> write prepared biasCor maps to fp
+  // OPT = -1 -> read maps from fp and malloc arrays as needed.
+  // Same function for both so that file layout is always the same.
+  //
+  // For read, cell arrays are malloced by the same functions that
+  // malloc them when preparing maps (set_MAPCELL_biasCor, 
+  // malloc_MUCOV), and MAPCELL is re-computed from the bins.
 
+  int  EVENT_TYPE = EVENT_TYPE_BIASCOR ;
+  int  NSAMPLE    = NSAMPLE_BIASCOR ;
+  bool DOCOR_MUCOVSCALE = ( INPUTS.opt_biasCor & MASK_BIASCOR_MUCOVSCALE);
+  TABLEVAR_DEF *TABLEVAR = &INFO_BIASCOR.TABLEVAR;
+  CELLINFO_DEF *CELL, *CELL_LIST[2] ;
+  int  idsample, ipar, NCELL, NCELL_FILE, icell ;
+  char fnam[] = "io_cache_biasCor" ;
 
-  int  DUMPFLAG = 0 ;
-  char *cidlist_debug  = INPUTS.cidlist_debug_biascor;
-  bool CHECK_DUMPFLAG  = ( strlen(cidlist_debug) > 0 ) ;
-  int ndump_nobiasCor = INPUTS.ndump_nobiasCor;
+  // ---------- BEGIN -----------
 
-  for (n=0; n < NSN_DATA; ++n) {
+  io_block_cache_biasCor(OPT, fp, VERSION_PHOTOMETRY_EVENT_TYPE[EVENT_TYPE],
+			 sizeof(char), MXCHAR_FILENAME*2 );
+
+  // event stats
+  io_block_cache_biasCor(OPT, fp, &TABLEVAR->NSN_ALL,      sizeof(int), 1);
+  io_block_cache_biasCor(OPT, fp, &TABLEVAR->NSN_PASSCUTS, sizeof(int), 1);
+  io_block_cache_biasCor(OPT, fp, &TABLEVAR->NSN_REJECT,   sizeof(int), 1);
+  io_block_cache_biasCor(OPT, fp, NSTORE_CUTBIT[EVENT_TYPE], 
+			 sizeof(int), MXCUTBIT);
+  io_block_cache_biasCor(OPT, fp, NPASS_CUTMASK_BYSAMPLE[EVENT_TYPE], 
+			 sizeof(int), MXNUM_SAMPLE);
+  io_block_cache_biasCor(OPT, fp, NREJECT_CUTWIN_BYSAMPLE[EVENT_TYPE], 
+			 sizeof(int), MXNUM_SAMPLE);
+
+  // global biasCor info
+  io_block_cache_biasCor(OPT, fp, &INFO_BIASCOR.DUST_FLAG, sizeof(bool), 1);
+  io_block_cache_biasCor(OPT, fp, &INFO_BIASCOR.GAMMADM_OFFSET, 
+			 sizeof(double), 1);
+  io_block_cache_biasCor(OPT, fp, &INFO_BIASCOR.BININFO_SIM_ALPHA, 
+			 sizeof(BININFO_DEF), 1);
+  io_block_cache_biasCor(OPT, fp, &INFO_BIASCOR.BININFO_SIM_BETA, 
+			 sizeof(BININFO_DEF), 1);
+  io_block_cache_biasCor(OPT, fp, &INFO_BIASCOR.BININFO_SIM_GAMMADM, 
+			 sizeof(BININFO_DEF), 1);
+  io_block_cache_biasCor(OPT, fp, INFO_BIASCOR.SIGINT_ABGRID, 
+			 sizeof(INFO_BIASCOR.SIGINT_ABGRID), 1);
+  io_block_cache_biasCor(OPT, fp, &INFO_BIASCOR.SIGINT_AVG, 
+			 sizeof(double), 1);
+  io_block_cache_biasCor(OPT, fp, INFO_BIASCOR.NEVT_COVINT, 
+			 sizeof(INFO_BIASCOR.NEVT_COVINT), 1);
+  io_block_cache_biasCor(OPT, fp, INFO_BIASCOR.SUMWGT_COVINT, 
+			 sizeof(INFO_BIASCOR.SUMWGT_COVINT), 1);
+  io_block_cache_biasCor(OPT, fp, INFO_BIASCOR.COVINT, 
+			 sizeof(INFO_BIASCOR.COVINT), 1);
+  io_block_cache_biasCor(OPT, fp, INFO_BIASCOR.COVINT_AVG, 
+			 sizeof(INFO_BIASCOR.COVINT_AVG), 1);
+  io_block_cache_biasCor(OPT, fp, &INFO_BIASCOR.zCOVINT, 
+			 sizeof(BININFO_DEF), 1);
+  io_block_cache_biasCor(OPT, fp, INFO_BIASCOR.zM0, 
+			 sizeof(INFO_BIASCOR.zM0), 1);
 
-    CUTMASK  = INFO_DATA.TABLEVAR.CUTMASK[n]; 
-    IDSAMPLE = INFO_DATA.TABLEVAR.IDSAMPLE[n]; 
-    if ( CUTMASK ) { continue ; }
+  // - - - - - - - - 
+  // biasCor maps for each sub-sample
+  if ( OPT < 0 ) {
+    int MEMCELL  = NSAMPLE * sizeof(CELLINFO_DEF);
+    CELLINFO_BIASCOR    = (CELLINFO_DEF*) malloc ( MEMCELL );
+    CELLINFO_MUCOVSCALE = (CELLINFO_DEF*) malloc ( MEMCELL );
+    CELLINFO_MUCOVADD   = (CELLINFO_DEF*) malloc ( MEMCELL );
+    INFO_BIASCOR.FITPARBIAS = 
+      (FITPARBIAS_DEF**) malloc ( NSAMPLE * sizeof(FITPARBIAS_DEF*) );
+    INFO_BIASCOR.MUCOVSCALE = (float**) malloc ( NSAMPLE*sizeof(float*) );
+    INFO_BIASCOR.MUCOVADD   = (float**) malloc ( NSAMPLE*sizeof(float*) );
+  }
 
-    if ( CHECK_DUMPFLAG ) {
-      name     = INFO_DATA.TABLEVAR.name[n];
-      DUMPFLAG = ( strstr(cidlist_debug,name) != NULL ); 
+  for(idsample=0; idsample < NSAMPLE; idsample++ ) {
+
+    io_block_cache_biasCor(OPT, fp, 
+			   &SAMPLE_BIASCOR[idsample].NSN[EVENT_TYPE], 
+			   sizeof(int), 1);
+    io_block_cache_biasCor(OPT, fp,
+			   &SAMPLE_BIASCOR[idsample].NBIASCOR_CUTS,
+			   sizeof(int), 1);
+
+    CELL = &CELLINFO_BIASCOR[idsample] ;
+    io_block_cache_biasCor(OPT, fp, &CELL->BININFO_z, sizeof(BININFO_DEF),1);
+    io_block_cache_biasCor(OPT, fp, &CELL->BININFO_m, sizeof(BININFO_DEF),1);
+    io_block_cache_biasCor(OPT, fp, CELL->BININFO_LCFIT, 
+			   sizeof(BININFO_DEF), NLCPAR );
+    io_block_cache_biasCor(OPT, fp, &CELL->NCELL, sizeof(int), 1);
+
+    NCELL = CELL->NCELL ;
+    if ( NCELL <= 0 ) { continue; }
+
+    if ( OPT < 0 ) { 
+      set_MAPCELL_biasCor(idsample); 
+      if ( CELL->NCELL != NCELL ) {
+	sprintf(c1err,"NCELL=%d from set_MAPCELL, but NCELL=%d in cache",
+		CELL->NCELL, NCELL);
+	sprintf(c2err,"IDSAMPLE=%d; remove cache file", idsample);
+	errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err); 
+      }
     }
 
-    istore = storeBias_data(n,DUMPFLAG);
-    
-    NUSE[IDSAMPLE]++ ; NUSE_TOT++ ;
-    if ( istore == 0 && REQUIRE_VALID_BIASCOR )  { 
-      NSKIP_TOT++; NSKIP[IDSAMPLE]++ ;  
-      setbit_CUTMASK(n, CUTBIT_BIASCOR, &INFO_DATA.TABLEVAR); 
-      if( NSKIP_TOT < ndump_nobiasCor ) 
-	{ storeBias_data(n,1); } 
-    }    
+    io_block_cache_biasCor(OPT, fp, CELL->NperCell, sizeof(int),    NCELL);
+    io_block_cache_biasCor(OPT, fp, CELL->WperCell, sizeof(double), NCELL);
+    io_block_cache_biasCor(OPT, fp, CELL->AVG_z,    sizeof(double), NCELL);
+    io_block_cache_biasCor(OPT, fp, CELL->AVG_m,    sizeof(double), NCELL);
+    for(ipar=0; ipar < NLCPAR; ipar++ ) {
+      io_block_cache_biasCor(OPT, fp, CELL->AVG_LCFIT[ipar], 
+			     sizeof(double), NCELL);
+    }
+    io_block_cache_biasCor(OPT, fp, INFO_BIASCOR.FITPARBIAS[idsample], 
+			   sizeof(FITPARBIAS_DEF), NCELL);
+    io_block_cache_biasCor(OPT, fp, INFO_BIASCOR.MUCOVSCALE[idsample], 
+			   sizeof(float), NCELL);
+    io_block_cache_biasCor(OPT, fp, INFO_BIASCOR.MUCOVADD[idsample], 
+			   sizeof(float), NCELL);
   }
 
+  // - - - - - - - - 
+  // muCOVscale & muCOVadd cells; same logic as in prepare_biasCor_sample
+  if ( !DOCOR_MUCOVSCALE ) { return; }
 
-  for(IDSAMPLE=0; IDSAMPLE < NSAMPLE_BIASCOR; IDSAMPLE++ ) {
+  for(idsample=0; idsample < NSAMPLE; idsample++ ) {
+    if ( SAMPLE_BIASCOR[idsample].DOFLAG_SELECT  == 0 ) { continue; }
+    if ( SAMPLE_BIASCOR[idsample].DOFLAG_BIASCOR == 0 ) { continue; }
+
+    CELL_LIST[0] = &CELLINFO_MUCOVSCALE[idsample] ;
+    CELL_LIST[1] = &CELLINFO_MUCOVADD[idsample] ;
+    for(icell=0; icell < 2; icell++ ) {
+      CELL = CELL_LIST[icell];
+      if ( OPT < 0 ) { malloc_MUCOV(+1, idsample, CELL); }
+
+      NCELL = NCELL_FILE = CELL->NCELL ;
+      io_block_cache_biasCor(OPT, fp, &NCELL_FILE, sizeof(int), 1);
+      if ( NCELL_FILE != NCELL ) {
+	sprintf(c1err,"NCELL=%d from malloc_MUCOV, but NCELL=%d in cache",
+		NCELL, NCELL_FILE);
+	sprintf(c2err,"IDSAMPLE=%d; remove cache file", idsample);
+	errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err); 
+      }
 
-    // store NSKIP and NUSE for later to print warning about excess loss
-    NREJECT_BIASCOR_BYSAMPLE[IDSAMPLE] = NSKIP[IDSAMPLE];
+      io_block_cache_biasCor(OPT, fp, CELL->USE,      sizeof(bool),   NCELL);
+      io_block_cache_biasCor(OPT, fp, CELL->NperCell, sizeof(int),    NCELL);
+      io_block_cache_biasCor(OPT, fp, CELL->WperCell, sizeof(double), NCELL);
+      io_block_cache_biasCor(OPT, fp, CELL->AVG_z,    sizeof(double), NCELL);
+      io_block_cache_biasCor(OPT, fp, CELL->AVG_m,    sizeof(double), NCELL);
+      io_block_cache_biasCor(OPT, fp, CELL->AVG_LCFIT[INDEX_c], 
+			     sizeof(double), NCELL);
 
-    if ( SAMPLE_BIASCOR[IDSAMPLE].DOFLAG_SELECT == 0 ) { continue; }
-    fprintf(FP_STDOUT,
-	    "  Rejected %d (of %d) DATA events with no %dD biasCor (%s).\n",
-	   NSKIP[IDSAMPLE], NUSE[IDSAMPLE], 
-	   NDIM_BIASCOR, SAMPLE_BIASCOR[IDSAMPLE].NAME );
+      if ( OPT < 0 ) { set_MAPCELL_MUCOV(CELL); }
+    }
   }
-  fprintf(FP_STDOUT, "\n");
-  fflush(FP_STDOUT);
 
+  return ;
+
+} // end io_cache_biasCor
 
-  // ------------
-  // free memory used to hold each simBias event;
-  // we only need to keep the small map made in makeMap_fitPar_biasCor.
 
-  if ( NSKIP_TOT == NUSE_TOT ) {
-    sprintf(c1err,"Could not compute biasCor");
-    sprintf(c2err,"Something is messed up.");
+// ======================================================
+void io_block_cache_biasCor(int OPT, FILE *fp, void *ptr, size_t size, 
+			    size_t n) {
+
+  // Created Oct 2026
+  // Write (OPT>0) or read (OPT<0) n items of size bytes; abort on error.
+
+  size_t nio ;
+  char fnam[] = "io_block_cache_biasCor" ;
+
+  // ---------- BEGIN -----------
+
+  if ( OPT > 0 ) 
+    { nio = fwrite(ptr, size, n, fp); }
+  else
+    { nio = fread(ptr, size, n, fp); }
+
+  if ( nio != n ) {
+    sprintf(c1err,"%s %d of %d items (size=%d) in biasCor cache", 
+	    (OPT>0 ? "wrote" : "read"), (int)nio, (int)n, (int)size );
+    sprintf(c2err,"Check %s", INPUTS.cachefile_biasCor);
     errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err); 
   }
 
-  // check option for JLA-like correction
- CHECK_1DCOR:
-  
-  if ( NDIM_BIASCOR == 1 ) {
-    INPUTS.opt_biasCor |= MASK_BIASCOR_1DZ ; // set OR-bit (AVG or WGT)
-    prepare_biasCor_zinterp();  
-  }
+} // end io_block_cache_biasCor
 
-  INFO_BIASCOR.NDIM = NDIM_BIASCOR ;
 
+// ======================================================
+void set_MAPCELL_MUCOV(CELLINFO_DEF *CELLINFO) {
 
-  // print prep time AFTER reading biasCor
-  char str_cputime[60];
-  sprintf(str_cputime,"%s(prep_BIASCOR)", STRING_CPUTIME_INIT);
-  print_cputime(t_read_biasCor[1], str_cputime, UNIT_TIME_MINUTE, 0);
+  // Created Oct 2026
+  // Set MAPCELL for muCOVscale/muCOVadd cells, using the same
+  // 1D ordering as in makeMap_sigmu_biasCor. Used to restore
+  // maps from biasCor cache.
 
+  int NBINa  = INFO_BIASCOR.BININFO_SIM_ALPHA.nbin ;
+  int NBINb  = INFO_BIASCOR.BININFO_SIM_BETA.nbin ;
+  int NBINg  = INFO_BIASCOR.BININFO_SIM_GAMMADM.nbin ;
+  int NBINz  = CELLINFO->BININFO_z.nbin ;
+  int NBINm  = CELLINFO->BININFO_m.nbin ;
+  int NBINc  = CELLINFO->BININFO_LCFIT[INDEX_c].nbin ;
+  int ia, ib, ig, iz, im, ic, N1D = 0 ;
 
-  return ;
+  // ---------- BEGIN -----------
 
-} // end prepare_biasCor
+  for(ia=0; ia < NBINa; ia++ ) {
+    for(ib=0; ib < NBINb; ib++ ) {
+      for(ig=0; ig < NBINg; ig++ ) {
+	for(iz=0; iz < NBINz; iz++ ) {
+	  for(im=0; im < NBINm; im++ ) {
+	    for(ic=0; ic < NBINc; ic++ ) {
+	      CELLINFO->MAPCELL[ia][ib][ig][iz][im][0][ic] = N1D;
+	      N1D++ ;
+	    }
+	  }
+	}
+      }
+    }
+  }
+
+} // end set_MAPCELL_MUCOV
 
 
 // =====================================
@@ -11784,6 +13704,8 @@ void makeMap_sigmu_biasCor(int IDSAMPLE) {
   // Sep 14 2021: little cleanup/refac 
   // Sep 16 2021: add dump utils; see i1d_dump_mucovscale and OPTMASK
   // Jun 05 2022: write SALT2 fit params in abort msg for crazy muErr
+  // Oct 14 2026: for MAD, store event lists in contiguous arrays
+  //              and sort by cell after event loop (load_MADLIST_MUCOV)
 
   int NBIASCOR_CUTS    = SAMPLE_BIASCOR[IDSAMPLE].NBIASCOR_CUTS ;
   int NBIASCOR_ALL     = INFO_BIASCOR.TABLEVAR.NSN_ALL ;
@@ -11791,7 +13713,6 @@ void makeMap_sigmu_biasCor(int IDSAMPLE) {
   int debug_malloc     = INPUTS.debug_malloc ;
   int debug_mucovscale = INPUTS.debug_mucovscale ;
 
-  bool DO_COVSCALE = (INPUTS.opt_biasCor & MASK_BIASCOR_MUCOVSCALE) > 0;
   bool DO_COVADD   = (INPUTS.opt_biasCor & MASK_BIASCOR_MUCOVADD) > 0;
 
   int    NBINa, NBINb, NBINg, NBINz, NBINm, NBINc, NperCell ;
@@ -11813,8 +13734,11 @@ void makeMap_sigmu_biasCor(int IDSAMPLE) {
 
   // Declare lists for debug_mucovscale
   double *muErr_list, *muErr_raw_list, *muDif_list;
-  int NPERCELL_REALLOC=2000;
-  int N_REALLOC=0;
+
+  // Oct 2026: event-ordered MAD lists; sorted by cell after event loop
+  int     NMAD = 0, *I1D_MAD = NULL ;
+  double *ABSPULL_MAD = NULL, *PULL_MAD = NULL;
+  double *MURES_MAD = NULL, *MUCOV_MAD = NULL ;
 
   double    UNDEFINED = 9999.0, WGT_MUCOV_IGNORE ;
   float    *ptr_MUCOVSCALE;
@@ -11887,6 +13811,17 @@ void makeMap_sigmu_biasCor(int IDSAMPLE) {
   SIG_PULL_STD   = (double*) malloc(MEMD);
   ig = 0 ;
 
+  if ( DO_MAD ) {
+    int MEMD_MAD = (NBIASCOR_CUTS+1) * sizeof(double);
+    I1D_MAD      = (int   *) malloc((NBIASCOR_CUTS+1) * sizeof(int));
+    ABSPULL_MAD  = (double*) malloc(MEMD_MAD);
+    PULL_MAD     = (double*) malloc(MEMD_MAD);
+    if ( DO_COVADD ) {
+      MURES_MAD  = (double*) malloc(MEMD_MAD);
+      MUCOV_MAD  = (double*) malloc(MEMD_MAD);
+    }
+  }
+
 
   int N1D=0;
   for(ia=0; ia< NBINa; ia++ ) {
@@ -12067,29 +14002,14 @@ void makeMap_sigmu_biasCor(int IDSAMPLE) {
 
 
     if (DO_MAD) {
-      NperCell = CELL_MUCOVSCALE->NperCell[i1d];
-      int  newmem = (NperCell+1+NPERCELL_REALLOC) * sizeof(double);
-      bool DO_REALLOC = (NperCell+1)%NPERCELL_REALLOC == 0 && NperCell > 0;
-      CELL_MUCOVSCALE->ABSPULL[i1d][NperCell] = fabs(pull);
-      CELL_MUCOVSCALE->PULL[i1d][NperCell]    = pull ;
+      I1D_MAD[NMAD]     = i1d ;
+      ABSPULL_MAD[NMAD] = fabs(pull);
+      PULL_MAD[NMAD]    = pull ;
       if ( DO_COVADD ) {
-	CELL_MUCOVADD->MURES[i1d][NperCell] = muDif;
-	CELL_MUCOVADD->MUCOV[i1d][NperCell] = muErrsq;
+	MURES_MAD[NMAD] = muDif;
+	MUCOV_MAD[NMAD] = muErrsq;
       }
-      if ( DO_REALLOC ){
-	CELL_MUCOVSCALE->ABSPULL[i1d] = 
-	  (double *)realloc(CELL_MUCOVSCALE->ABSPULL[i1d], newmem);
-	CELL_MUCOVSCALE->PULL[i1d] = 
-	  (double *)realloc(CELL_MUCOVSCALE->PULL[i1d], newmem);
-
-	if (DO_COVADD) {
-	  CELL_MUCOVADD->MURES[i1d] = 
-	    (double *)realloc(CELL_MUCOVADD->MURES[i1d], newmem);
-	  CELL_MUCOVADD->MUCOV[i1d] = 
-	    (double *)realloc(CELL_MUCOVADD->MUCOV[i1d], newmem);
-        }
-	N_REALLOC++;
-      } // end DO_REALLOC
+      NMAD++ ;
     } // end USE_MAD_MUCOVSCALE
 
 
@@ -12102,6 +14022,17 @@ void makeMap_sigmu_biasCor(int IDSAMPLE) {
 
   } // end ievt
 
+  // sort MAD lists by cell into contiguous blocks (Oct 2026)
+  if ( DO_MAD ) {
+    load_MADLIST_MUCOV(NMAD, I1D_MAD, ABSPULL_MAD, PULL_MAD, NULL, NULL,
+		       CELL_MUCOVSCALE);
+    if ( DO_COVADD ) {
+      load_MADLIST_MUCOV(NMAD, I1D_MAD, NULL, NULL, MURES_MAD, MUCOV_MAD,
+			 CELL_MUCOVADD);
+      free(MURES_MAD); free(MUCOV_MAD);
+    }
+    free(I1D_MAD); free(ABSPULL_MAD); free(PULL_MAD);
+  }
 
   // -------------------------------------------------
   double WN, SQSTD, AVG=-9.0, STD=-9.0, MAD=-9.0 ;
@@ -12310,18 +14241,108 @@ void makeMap_sigmu_biasCor(int IDSAMPLE) {
   free(SUM_PULL);    free(SUM_SQPULL);
  
   if ( DO_MAD ) {
-    for (i1d=0; i1d<NCELL; i1d++) { 
-      free(CELL_MUCOVSCALE->ABSPULL[i1d]); 
-      free(CELL_MUCOVSCALE->PULL[i1d]); 
-    }
-    free(CELL_MUCOVSCALE->ABSPULL);
-    free(CELL_MUCOVSCALE->PULL);
+    free_MADLIST_MUCOV(CELL_MUCOVSCALE);
+    free_MADLIST_MUCOV(CELL_MUCOVADD);
   }
   return;
 
 } // end makeMap_sigmu_biasCor
 
 
+// ======================================================
+void load_MADLIST_MUCOV(int NLIST, int *I1D_LIST, 
+			double *ABSPULL_LIST, double *PULL_LIST,
+			double *MURES_LIST, double *MUCOV_LIST,
+			CELLINFO_DEF *CELLINFO) {
+
+  // Created Oct 2026
+  // Counting-sort event-ordered lists by cell index I1D_LIST into 
+  // contiguous blocks, and set per-cell pointers, e.g.,
+  //   CELLINFO->ABSPULL[i1d][0 : NperCell-1] 
+  //     = CELLINFO->ABSPULL_BLOCK[OFFSET_CELL[i1d] : ...]
+  // Events keep their original order within each cell.
+  // Input lists that are NULL are not loaded.
+  // Replaces previous 2000-element per-cell lists grown by realloc.
+
+  int NCELL = CELLINFO->NCELL ;
+  int i1d, n, *NFILL ;
+  int MEMD  = (NLIST+1) * sizeof(double);
+  int MEMP  = NCELL * sizeof(double*);
+
+  // ---------- BEGIN -----------
+
+  CELLINFO->OFFSET_CELL = (int*) malloc( (NCELL+1) * sizeof(int) );
+  NFILL                 = (int*) malloc( (NCELL+1) * sizeof(int) );
+  for(i1d=0; i1d <= NCELL; i1d++ ) 
+    { CELLINFO->OFFSET_CELL[i1d] = 0 ; NFILL[i1d] = 0 ; }
+
+  for(n=0; n < NLIST; n++ ) { CELLINFO->OFFSET_CELL[I1D_LIST[n]+1]++ ; }
+  for(i1d=0; i1d < NCELL; i1d++ ) 
+    { CELLINFO->OFFSET_CELL[i1d+1] += CELLINFO->OFFSET_CELL[i1d]; }
+
+  if ( ABSPULL_LIST ) {
+    CELLINFO->ABSPULL_BLOCK = (double*)  malloc(MEMD);
+    CELLINFO->PULL_BLOCK    = (double*)  malloc(MEMD);
+    CELLINFO->ABSPULL       = (double**) malloc(MEMP);
+    CELLINFO->PULL          = (double**) malloc(MEMP);
+  }
+  if ( MURES_LIST ) {
+    CELLINFO->MURES_BLOCK   = (double*)  malloc(MEMD);
+    CELLINFO->MUCOV_BLOCK   = (double*)  malloc(MEMD);
+    CELLINFO->MURES         = (double**) malloc(MEMP);
+    CELLINFO->MUCOV         = (double**) malloc(MEMP);
+  }
+
+  for(n=0; n < NLIST; n++ ) {
+    i1d = I1D_LIST[n];
+    int j = CELLINFO->OFFSET_CELL[i1d] + NFILL[i1d] ;  NFILL[i1d]++ ;
+    if ( ABSPULL_LIST ) {
+      CELLINFO->ABSPULL_BLOCK[j] = ABSPULL_LIST[n];
+      CELLINFO->PULL_BLOCK[j]    = PULL_LIST[n];
+    }
+    if ( MURES_LIST ) {
+      CELLINFO->MURES_BLOCK[j]   = MURES_LIST[n];
+      CELLINFO->MUCOV_BLOCK[j]   = MUCOV_LIST[n];
+    }
+  }
+
+  for(i1d=0; i1d < NCELL; i1d++ ) {
+    int j0 = CELLINFO->OFFSET_CELL[i1d] ;
+    if ( ABSPULL_LIST ) {
+      CELLINFO->ABSPULL[i1d] = &CELLINFO->ABSPULL_BLOCK[j0] ;
+      CELLINFO->PULL[i1d]    = &CELLINFO->PULL_BLOCK[j0] ;
+    }
+    if ( MURES_LIST ) {
+      CELLINFO->MURES[i1d]   = &CELLINFO->MURES_BLOCK[j0] ;
+      CELLINFO->MUCOV[i1d]   = &CELLINFO->MUCOV_BLOCK[j0] ;
+    }
+  }
+
+  free(NFILL);
+  return ;
+
+} // end load_MADLIST_MUCOV
+
+void free_MADLIST_MUCOV(CELLINFO_DEF *CELLINFO) {
+  // Created Oct 2026: free memory from load_MADLIST_MUCOV
+  if ( CELLINFO->ABSPULL_BLOCK ) {
+    free(CELLINFO->ABSPULL_BLOCK); free(CELLINFO->PULL_BLOCK);
+    free(CELLINFO->ABSPULL);       free(CELLINFO->PULL);
+  }
+  if ( CELLINFO->MURES_BLOCK ) {
+    free(CELLINFO->MURES_BLOCK);   free(CELLINFO->MUCOV_BLOCK);
+    free(CELLINFO->MURES);         free(CELLINFO->MUCOV);
+  }
+  if ( CELLINFO->OFFSET_CELL ) { free(CELLINFO->OFFSET_CELL); }
+
+  CELLINFO->ABSPULL = CELLINFO->PULL = CELLINFO->MURES = NULL;
+  CELLINFO->MUCOV   = NULL ;
+  CELLINFO->OFFSET_CELL   = NULL ;
+  CELLINFO->ABSPULL_BLOCK = CELLINFO->PULL_BLOCK = NULL ;
+  CELLINFO->MURES_BLOCK   = CELLINFO->MUCOV_BLOCK = NULL ;
+} // end free_MADLIST_MUCOV
+
+
 // ======================================================
 void  store_index_abg_biasCor(void) {
 
@@ -15548,6 +17569,7 @@ void prepare_CCprior(void) {
     }
 
     malloc_PROB_CCprior(TABLEVAR_DATA, MUZMAP, PROB_DATA);
+    prep_PROBDMU_CCprior_fast(TABLEVAR_DATA, MUZMAP, PROB_DATA);
     if ( !INPUTS.DO_CCPRIOR_UPDATE ) {
       // data prior is fixed during init
       load_DMU_CCprior(TABLEVAR_DATA, ABGM, PROB_DATA);
@@ -16588,6 +18610,9 @@ void load_PROBDMU_CCprior(TABLEVAR_DEF *TABLEVAR, MUZMAP_DEF *MUZMAP, PROB_CCPRI
   // Created July 29 2025
   // Loop over events in TABLEVAR and use MUZMAP and PROB_CCPRIOR to compute
   // PROB(DMU) for each event; store PROB in PROB_CCPRIOR.PROB.
+  //
+  // Oct 15 2026: if prep_PROBDMU_CCprior_fast was called, evaluate
+  //   all events with eval_PROBDMU_CCprior.
 
   int NSN_ALL  = TABLEVAR->NSN_ALL;
   double *DMU  = PROB_CCPRIOR->DMU ; // already loaded
@@ -16600,6 +18625,19 @@ void load_PROBDMU_CCprior(TABLEVAR_DEF *TABLEVAR, MUZMAP_DEF *MUZMAP, PROB_CCPRI
 
   // ------------- BEGIN ----------
 
+  if ( PROB_CCPRIOR->READY_FAST ) {
+    eval_PROBDMU_CCprior(MUZMAP, PROB_CCPRIOR, NSN_ALL, DMU, PROB);
+    // events passing cuts with invalid map cell -> abort
+    for(isn=0; isn < NSN_ALL; isn++ ) {
+      if ( TABLEVAR->CUTMASK[isn] )          { continue; }
+      if ( PROB_CCPRIOR->PDF[isn] != NULL )  { continue; }
+      PROB[isn] = prob_CCprior_sim(TABLEVAR->IDSAMPLE[isn], MUZMAP, 
+				   PROB_CCPRIOR->I3D[isn], TABLEVAR->zhd[isn],
+				   DMU[isn], DUMPFLAG, fnam );
+    }
+    return ;
+  }
+
   for(isn=0; isn < NSN_ALL; isn++ ) {
     if ( TABLEVAR->CUTMASK[isn] ) { continue; }
 
@@ -16620,6 +18658,160 @@ void load_PROBDMU_CCprior(TABLEVAR_DEF *TABLEVAR, MUZMAP_DEF *MUZMAP, PROB_CCPRI
 }  // load_PROBDMU_CCprior
 
 
+// ============================================
+void prep_PROBDMU_CCprior_fast(TABLEVAR_DEF *TABLEVAR, MUZMAP_DEF *MUZMAP,
+			       PROB_CCPRIOR_DEF *PROB_CCPRIOR) {
+
+  // Created Oct 2026
+  // For each event, store the parts of prob_CCprior_sim that do not
+  // depend on dmu: pointer to PDF(dmu) in the event's 3D map cell,
+  // and Gaussian avg, 1/rms and norm. The map cell (I3D) depends only
+  // on z,c,s, and the maps are fixed after init, so this is called 
+  // once; each fcn call then needs only prob_CCprior_fast(dmu).
+  //
+  // All events are prepared (cuts can change between fit iterations).
+  // Events with invalid I3D get PDF=NULL and NORM=0; callers use
+  // prob_CCprior_sim for them, which aborts with diagnostics.
+
+  int  NSN_ALL = TABLEVAR->NSN_ALL;
+  int  MEMD    = (NSN_ALL+1) * sizeof(double);
+  int  isn, IDSAMPLE, i3d ;
+  double RMS ;
+  // char fnam[] = "prep_PROBDMU_CCprior_fast" ;
+
+  // ------------- BEGIN ----------
+
+  if ( INPUTS.REFAC_CCPRIOR == 0 ) { return; }
+
+  PROB_CCPRIOR->PDF          = (double**)malloc((NSN_ALL+1)*sizeof(double*));
+  PROB_CCPRIOR->GAUSS_AVG    = (double*) malloc(MEMD);
+  PROB_CCPRIOR->GAUSS_INVRMS = (double*) malloc(MEMD);
+  PROB_CCPRIOR->GAUSS_NORM   = (double*) malloc(MEMD);
+
+  for(isn=0; isn < NSN_ALL; isn++ ) {
+
+    PROB_CCPRIOR->PDF[isn]          = NULL ;
+    PROB_CCPRIOR->GAUSS_AVG[isn]    = 0.0 ;
+    PROB_CCPRIOR->GAUSS_INVRMS[isn] = 0.0 ;
+    PROB_CCPRIOR->GAUSS_NORM[isn]   = 0.0 ;
+
+    IDSAMPLE = TABLEVAR->IDSAMPLE[isn];
+    i3d      = PROB_CCPRIOR->I3D[isn] ;
+    if ( IDSAMPLE < 0 || IDSAMPLE >= MXNUM_SAMPLE ) { continue; }
+    if ( i3d < 0 || i3d >= MUZMAP->NBIN3D )         { continue; }
+
+    PROB_CCPRIOR->PDF[isn] = MUZMAP->DMUPDF[IDSAMPLE][i3d] ;
+
+    RMS = MUZMAP->DMURMS[IDSAMPLE][i3d] ;
+    if ( RMS > 0.0000001 ) {
+      PROB_CCPRIOR->GAUSS_AVG[isn]    = MUZMAP->DMUAVG[IDSAMPLE][i3d];
+      PROB_CCPRIOR->GAUSS_INVRMS[isn] = 1.0/RMS ;
+      PROB_CCPRIOR->GAUSS_NORM[isn]   = PIFAC/RMS ;
+    }
+  }
+
+  PROB_CCPRIOR->READY_FAST = true ;
+
+  return ;
+
+} // end prep_PROBDMU_CCprior_fast
+
+
+// ============================================
+double prob_CCprior_fast(MUZMAP_DEF *MUZMAP, PROB_CCPRIOR_DEF *PROB_CCPRIOR,
+			 int isn, double dmu) {
+
+  // Created Oct 2026
+  // Same as prob_CCprior_sim (REFAC), but uses per-event terms from
+  // prep_PROBDMU_CCprior_fast: no index checks or string handling.
+
+  int    NBMU, imu ;
+  double dmumin, dmumax, dmubin, dmu_local, frac, resid ;
+  double *PDF  = PROB_CCPRIOR->PDF[isn] ;
+  double prob  = 0.0 ;
+
+  if ( PDF == NULL ) { return prob; }
+
+  if ( INPUTS.DO_CCPRIOR_INTERP ) {
+    NBMU   = MUZMAP->DMUBIN.nbin ;  
+    dmumin = MUZMAP->DMUBIN.avg[0];
+    dmumax = MUZMAP->DMUBIN.avg[NBMU-1];
+    dmubin = MUZMAP->DMUBIN.binSize ;
+
+    if ( dmu < dmumin ) 
+      { dmu_local = dmumin + 0.0001 ; }
+    else if ( dmu > dmumax ) 
+      { dmu_local = dmumax - 0.0001 ; }
+    else
+      { dmu_local = dmu ; }
+
+    imu = (int)((dmu_local - dmumin)/dmubin) ;
+    if (imu == NBMU - 1) { imu-- ; }
+    frac  = (dmu_local - MUZMAP->DMUBIN.avg[imu]) / dmubin ;
+    prob  = PDF[imu] + frac * ( PDF[imu+1] - PDF[imu] );  
+  }
+  else if ( INPUTS.DO_CCPRIOR_GAUSS ) {
+    resid = (dmu - PROB_CCPRIOR->GAUSS_AVG[isn]) * 
+      PROB_CCPRIOR->GAUSS_INVRMS[isn] ;
+    prob  = PROB_CCPRIOR->GAUSS_NORM[isn] * exp(-0.5*resid*resid) ;
+  }
+
+  return prob ;
+
+} // end prob_CCprior_fast
+
+
+// ============================================
+void eval_PROBDMU_CCprior(MUZMAP_DEF *MUZMAP, PROB_CCPRIOR_DEF *PROB_CCPRIOR,
+			  int NSN, double *DMU, double *PROB) {
+
+  // Created Oct 2026
+  // Evaluate PROB[isn] = PDF(DMU[isn]) for all NSN events with terms 
+  // from prep_PROBDMU_CCprior_fast. The Gaussian and interpolation
+  // options each have a separate loop with no per-event branching
+  // on options, so that the loops can be auto-vectorized.
+  // Events with invalid map cell (PDF=NULL) have PROB=0.
+
+  int    NBMU   = MUZMAP->DMUBIN.nbin ;  
+  double dmumin = MUZMAP->DMUBIN.avg[0];
+  double dmumax = MUZMAP->DMUBIN.avg[NBMU-1];
+  double dmubin = MUZMAP->DMUBIN.binSize ;
+  double *AVG    = PROB_CCPRIOR->GAUSS_AVG ;
+  double *INVRMS = PROB_CCPRIOR->GAUSS_INVRMS ;
+  double *NORM   = PROB_CCPRIOR->GAUSS_NORM ;
+  double dmu, frac, resid, *PDF ;
+  int    isn, imu ;
+
+  // ------------- BEGIN ----------
+
+  if ( INPUTS.DO_CCPRIOR_INTERP ) {
+    for(isn=0; isn < NSN; isn++ ) {
+      PDF = PROB_CCPRIOR->PDF[isn] ;
+      if ( PDF == NULL ) { PROB[isn] = 0.0 ; continue; }
+      dmu = DMU[isn] ;
+      if ( dmu < dmumin ) { dmu = dmumin + 0.0001 ; }
+      if ( dmu > dmumax ) { dmu = dmumax - 0.0001 ; }
+      imu = (int)((dmu - dmumin)/dmubin) ;
+      if (imu == NBMU - 1) { imu-- ; }
+      frac = (dmu - MUZMAP->DMUBIN.avg[imu]) / dmubin ;
+      PROB[isn] = PDF[imu] + frac * ( PDF[imu+1] - PDF[imu] );
+    }
+  }
+  else if ( INPUTS.DO_CCPRIOR_GAUSS ) {
+    for(isn=0; isn < NSN; isn++ ) {
+      resid     = (DMU[isn] - AVG[isn]) * INVRMS[isn] ;
+      PROB[isn] = NORM[isn] * exp(-0.5*resid*resid) ;
+    }
+  }
+  else {
+    for(isn=0; isn < NSN; isn++ ) { PROB[isn] = 0.0 ; }
+  }
+
+  return ;
+
+} // end eval_PROBDMU_CCprior
+
+
 // ============================================
 void  dump_DMUPDF_CCprior(int IDSAMPLE, int I3D, MUZMAP_DEF *MUZMAP) {
 
@@ -18176,6 +20368,9 @@ int ppar(char* item) {
   if ( !INPUTS.KEYNAME_DUMPFLAG ) 
     { fprintf(FP_STDOUT, " Parse '%s' \n",item);  fflush(FP_STDOUT); }
 
+  // Oct 2026: hash inputs for biasCor cache key
+  update_HASH_INPUTS_biasCor(item);
+
   if ( uniqueOverlap(item,"prefix=") )
     { sscanf(&item[7],"%s",INPUTS.PREFIX); return(1); }
 
@@ -18274,6 +20469,12 @@ int ppar(char* item) {
   if ( uniqueOverlap(item,"minos2=") ) 
     { sscanf(&item[7],"%i", &INPUTS.minos2 ); return(1); }  
 
+  if ( uniqueOverlap(item,"fcn_grad=") ) 
+    { sscanf(&item[9],"%i", &INPUTS.fcn_grad ); return(1); }  
+
+  if ( uniqueOverlap(item,"fcn_soa=") ) 
+    { sscanf(&item[8],"%i", &INPUTS.fcn_soa ); return(1); }  
+
 
   // - - - - - -
   // allow two different keys for data file name
@@ -18539,6 +20740,8 @@ int ppar(char* item) {
   if ( uniqueOverlap(item,"sigmb=")) 
     { sscanf(&item[6],"%lf",&INPUTS.sigmB); return(1); }
 
+  if ( uniqueOverlap(item,"opt_sigint_iter=")) 
+    { sscanf(&item[16],"%i",&INPUTS.opt_sigint_iter); return(1); }
   if ( uniqueOverlap(item,"sigint_step1=")) 
     { sscanf(&item[13],"%lf",&INPUTS.sigint_step1); return(1); }
   if ( uniqueOverlap(item,"dchi2red_dsigint=")) 
@@ -18839,6 +21042,15 @@ int ppar(char* item) {
   if ( uniqueOverlap(item,"nthread=")) 
     { sscanf(&item[8],"%d", &INPUTS.nthread); return(1); }
 
+  if ( uniqueOverlap(item,"cachefile_biascor=")) 
+    { sscanf(&item[18],"%s", INPUTS.cachefile_biasCor); return(1); }
+
+  if ( uniqueOverlap(item,"datafile_batch=")) 
+    { sscanf(&item[15],"%s", INPUTS.datafile_batch); return(1); }
+
+  if ( uniqueOverlap(item,"nproc_batch=")) 
+    { sscanf(&item[12],"%d", &INPUTS.nproc_batch); return(1); }
+
   return(0);
   
 } // end ppar
@@ -20622,7 +22834,10 @@ void prep_input_driver(void) {
   ENVreplace("init",fnam,1); 
 
   // substitute ENV for filenames
-  if ( INPUTS.nfile_data <= 0 ) {
+  // (for batch mode, datafile(s) are set later in prep_datafile_batch)
+  if ( strlen(INPUTS.datafile_batch) > 0 ) 
+    { ENVreplace(INPUTS.datafile_batch,fnam,1); }
+  else if ( INPUTS.nfile_data <= 0 ) {
     sprintf(c1err,"No input data (fitres files) !!!");
     sprintf(c2err,"Check datafile=%s", INPUTS.dataFile_string); 
     errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err);
@@ -21847,6 +24062,84 @@ double next_covFitPar(double redchi2, double parval_orig, double parval_step) {
 } // end next_covFitPar
 
 
+// *******************************************************
+double predict_covFitPar(double redchi2, double parval_orig, 
+			 double parval_step) {
+
+  // Created Oct 2026
+  // Predict next covFitPar (sigint or covScale) by solving
+  // chi2red(Ia)=1 with all fit params fixed at the current minimum.
+  // Each trial is one fcn call (threaded for nthread>1) instead of
+  // a full MINUIT fit, so the secant search is cheap, and the next
+  // refit typically lands within redchi2_tol. 
+  // MINUIT is not re-entrant, so trial values cannot be refit in 
+  // parallel; the fixed-param scan is the serial substitute.
+  //
+  // Returns -1 if search fails; caller then uses next_covFitPar.
+
+  int    NFITPAR_ALL = FITINP.NFITPAR_ALL ;
+  int    MXITER      = 12 ;
+  int    LEN_VARNAME = 10 ;
+  double TOL         = 0.25 * INPUTS.redchi2_tol ;
+  double PARVAL_MAX  = 100.0 ;
+  int    ipar, iMN, iv, iter ;
+  double xval[MAXPAR], err, bnd1, bnd2 ;
+  double s0, f0, s1, f1, s2, parval_pred = -1.0 ;
+  char   text[100];
+  char   fnam[] = "predict_covFitPar" ;
+
+  // ------------- BEGIN ------------
+
+  // fetch current MINUIT params (external values)
+  for ( ipar=0; ipar < NFITPAR_ALL; ipar++ ) {
+    iMN = ipar + 1 ;  text[0] = 0 ;
+    mnpout_(&iMN, text, &xval[ipar], &err, &bnd1,&bnd2, &iv, LEN_VARNAME);
+  }
+
+  s0 = parval_orig ;  f0 = redchi2 - 1.0 ;
+  s1 = parval_orig + ( f0 > 0.0 ? parval_step : -parval_step );
+  if ( s1 < 0.0 ) { s1 = 0.0 ; }
+  f1 = eval_redchi2_covFitPar(s1,xval) - 1.0 ;
+
+  for ( iter=0; iter < MXITER; iter++ ) {
+    if ( fabs(f1) < TOL ) { parval_pred = s1 ; break; }
+    if ( f1 == f0       ) { break; }
+    s2 = s1 - f1*(s1-s0)/(f1-f0) ;
+    if ( isnan(s2) || s2 > PARVAL_MAX ) { break; }
+    if ( s2 < 0.0 ) { 
+      s2 = 0.0 ; 
+      // chi2red < 1 even without covint: return 0 to stop on next fit
+      if ( s1 == 0.0 ) { parval_pred = 0.0 ; break; }
+    }
+    s0 = s1;  f0 = f1;  s1 = s2 ;
+    f1 = eval_redchi2_covFitPar(s1,xval) - 1.0 ;
+  }
+
+  fprintf(FP_STDOUT, "\t %s: predict %s=%.4f after %d fcn calls\n",
+	  fnam, FITRESULT.PARNAME[IPAR_COVINT_PARAM], parval_pred, iter+1);
+  fflush(FP_STDOUT);
+
+  // restore; caller sets next value and calls recalc_dataCov
+  FITINP.COVINT_PARAM_FIX = parval_orig ;
+  return(parval_pred);
+
+} // end predict_covFitPar
+
+// *******************************************************
+double eval_redchi2_covFitPar(double parval, double *xval) {
+
+  // Created Oct 2026
+  // Return chi2red(Ia) for covint param = parval, at fixed xval.
+  int    npar = FITINP.NFITPAR_ALL, iflag = 4 ;
+  double fval, grad[MAXPAR];
+  // ------------- BEGIN ------------
+  FITINP.COVINT_PARAM_FIX = parval ;
+  recalc_dataCov();
+  fcn(&npar, grad, &fval, xval, &iflag, NULL);
+  return(FITRESULT.CHI2RED_IA_FCN);
+} // end eval_redchi2_covFitPar
+
+
 
 // ******************************************
 void conflict_check() {
@@ -24161,6 +26454,9 @@ double cosmodl(double zhel, double zhd, double *cosPar)
 {
   // Dec 11 2020: 
   // pass both zhel and zhd, where zhd has both cmb and vpec corrections.
+  //
+  // Oct 14 2026: if cosPar matches a COSMODL_TABLE entry, interpolate 
+  //    tabulated integral instead of rombint.
  
   const double  cvel = LIGHT_km; // 2.99792458e5;
   const double  tol  = 1.e-6;
@@ -24179,6 +26475,14 @@ double cosmodl(double zhel, double zhd, double *cosPar)
     return (dl);
   }
 
+  // - - - - - - - -
+  int itab = find_COSMODL_TABLE(cosPar);
+  if ( itab >= 0 ) {
+    distance = Hzinv_integral_table(zhd, &COSMODL_TABLE.HzFUN_INFO[itab]);
+    dl       = (1.0+zhel)*distance ;
+    return( dl );
+  }
+
   // - - - - - - - -
   //  omega_l = cosPar[0];  // not used
   omega_k = cosPar[1];
@@ -24206,6 +26510,62 @@ double cosmodl(double zhel, double zhd, double *cosPar)
 } // end cosmodl
 
 
+// ==========================================
+void init_COSMODL_TABLE(double *cosPar) {
+
+  // Created Oct 2026
+  // Store HzFUN_INFO and tabulated H0/H(z) integral for cosPar
+  // (OL,Ok,w0,wa) so that cosmodl is a fast table lookup. 
+  // Must be called before fcn threads start since COSMODL_TABLE
+  // is only read in cosmodl.
+
+  int    NTABLE = COSMODL_TABLE.NTABLE ;
+  double COSPAR_LIST[NCOSPAR_HzFUN];
+  double OK ;
+  int    ipar ;
+
+  // ------------- BEGIN --------------
+
+  if ( find_COSMODL_TABLE(cosPar) >= 0 ) { return; } // already stored
+  if ( NTABLE >= MXTABLE_COSMODL       ) { return; } // use rombint
+
+  OK = cosPar[1];
+  if ( fabs(OK) < 1.0E-6 ) { OK = 0.0 ; } // same as in inc()
+
+  COSPAR_LIST[ICOSPAR_HzFUN_H0] = INPUTS.H0 ;
+  COSPAR_LIST[ICOSPAR_HzFUN_OM] = 1.0 - cosPar[0] - OK ;
+  COSPAR_LIST[ICOSPAR_HzFUN_OL] = cosPar[0] ;
+  COSPAR_LIST[ICOSPAR_HzFUN_w0] = cosPar[2] ;
+  COSPAR_LIST[ICOSPAR_HzFUN_wa] = cosPar[3] ;
+
+  init_HzFUN_INFO(0, COSPAR_LIST, "", &COSMODL_TABLE.HzFUN_INFO[NTABLE]);
+  init_HzINV_TABLE(ZMAX_SNANA, &COSMODL_TABLE.HzFUN_INFO[NTABLE]);
+
+  for(ipar=0; ipar < NCOSPAR; ipar++ ) 
+    { COSMODL_TABLE.COSPAR[NTABLE][ipar] = cosPar[ipar]; }
+  COSMODL_TABLE.NTABLE++ ;
+
+  return ;
+
+} // end init_COSMODL_TABLE
+
+int find_COSMODL_TABLE(double *cosPar) {
+
+  // Created Oct 2026
+  // Return COSMODL_TABLE index matching cosPar; -1 if not found.
+
+  int itab, ipar, nmatch ;
+  for(itab=0; itab < COSMODL_TABLE.NTABLE; itab++ ) {
+    nmatch = 0 ;
+    for(ipar=0; ipar < NCOSPAR; ipar++ ) 
+      { if ( COSMODL_TABLE.COSPAR[itab][ipar] == cosPar[ipar] ) { nmatch++; } }
+    if ( nmatch == NCOSPAR ) { return itab; }
+  }
+  return -1 ;
+
+} // end find_COSMODL_TABLE
+
+
 double rombint(double f(double z, double *cosPar),
 	       double a, double b, double *cosPar, double tol) {
 
@@ -24556,6 +26916,14 @@ void print_SALT2mu_HELP(void) {
     "prescale_biascor=<subset>,<prescale> ! select <subset> from <prescale>",
     "                                     ! <subset> can be 0,1,2 .. <prescale>-1",
     "",
+    "datafile_batch=<listFile> # fit each datafile in <listFile> (one per line,",
+    "                          #   optional 2nd column = prefix); biasCor file",
+    "                          #   is read once and shared by forked jobs",
+    "nproc_batch=<n>           # number of simultaneous datafile_batch jobs",
+    "cachefile_biascor=<file>  # binary cache of prepared biasCor maps (5D only):",
+    "                          # load if key matches simfiles & inputs; ",
+    "                          # else prepare maps and write cache.",
+    "",
     "fieldGroup_biascor='SHALLOW,MEDIUM,DEEP'     #  generic field names",
     "fieldGroup_biascor='C3+X3,X1+E1+S1,C2,X2+E2+S2+C2'   # DES ",
     "fieldGroup_biascor='WFD(zbin=.05),DDF(zbin=0.10)'    # LSST ",
@@ -24773,6 +27141,9 @@ void print_SALT2mu_HELP(void) {
     "",
     "minos=0          #  1 --> MINUIT minos errors (warning: very slow)",
     "minos2=0         #  1 --> use minos on repeat fit after crazy errors",    
+    "fcn_grad=1       #  fcn gives MINUIT gradient: analytic for M0 z-bins,",
+    "                 #  numerical for other params (fewer fcn calls)",
+    "fcn_soa=1        #  fast fcn loop for Ia-only & 1D/no biasCor fits",
     "fitflag_sigmb=1  #  find sigmB giving chi2(Ia)/N = 1 (or sig1fit=1)",
     "fitflag_sigmb=2  #  idem, with extra fit adding 2log(sigma)",
     "redchi2_tol=0.02 #  tolerance on chi2/dof-1",
@@ -24782,6 +27153,9 @@ void print_SALT2mu_HELP(void) {
     "sigint_fix=0.11,0.09,0.08 # comma-sep list of sigint_fix for each IDSAMPLE",
     "",
     "sigint_step1=0.01  # size of first sigint step to measure chi2/sigint slope",
+    "opt_sigint_iter=1  # warm-start sigint refits (no SIMPLEX after 1st fit)",
+    "opt_sigint_iter=2  # next sigint from scan of chi2(Ia) at fixed params",
+    "opt_sigint_iter=3  # both of the above",
     "dchi2red_dsigint   # user-input slope instead of auto-compute (for speed)",
     "",
     " - - - - -  blinding params - - - - - ",
@@ -46,6 +46,11 @@
    LDUMP                   use this to have debugging lines dumped to screen
 
    OPT_ZEROFLUX           use ZFLUXVAL = 1e-20 for computing fluxerror in cases where flux is zero
+   --plist_file <file>     file with many parameter points (NPAR values
+                           per line, '#' = comment); all points and all
+                           epochs are written to one binary cube file.
+   --cube <cubeFile>       name of binary cube file 
+                           (default SIMSED_extractSpec.CUBE)
 
  The extracted spectrum is written to a text file
  with format "wavelength  flux" and optional "dflux"
@@ -184,6 +189,14 @@ Nov 21, 2011 JLM:
 
  Jun 4 2020: call init_random_seed(...)
 
+ Oct 15 2026: 
+   + new batch options --plist_file <file> and --cube <cubeFile> to
+     extract many parameter points x epochs in one job, and write
+     a single binary spectral cube (see wrCube for format).
+   + corner SEDs are cached by ISED (and trimmed to NDAY*NLAM) so that
+     neighboring parameter points do not re-read the same SED files.
+   + TEMP_SEDMODEL is allocated once instead of once per corner.
+
 **************************************/
 
 #include "genmag_SIMSED.c"
@@ -208,6 +221,10 @@ void  fudgeSNR(int ep);
 void init_getSNR(int *wsnr, int *wlam, double lam, int ep);
 double getSNR(int *wsnr, int *wlam, double lam, int ep);
 void  wrSpec(int ep);
+void  parse_plist_file(char *plistFile);
+void  extract_cube(void);
+void  wrCube(FILE *fp, int ipoint, int ep);
+void  flush_SEDCACHE(void);
 
 int ISED_MATCH(double *parval);
 
@@ -220,6 +237,7 @@ int ISED_MATCH(double *parval);
 #define MXCHAR_LINE 600 // max length of EPOCHFILE lines
 
 #define MXEPOCH_SIMSED 2000
+#define MXMEM_SEDCACHE 4000.0 // max MB of cached corner SEDs
 
 struct INPUTS {
   char   SIMSED_VERSION[200];
@@ -257,6 +275,12 @@ struct INPUTS {
 
   int    DEBUG ;
 
+  // batch mode (Oct 2026)
+  char   PLIST_FILE[200]; // optional file with many parameter points
+  char   CUBE_FILE[200];  // output binary cube
+  int    NPOINT ;         // number of parameter points
+  double *PARAM_POINTS ;  // [ipoint*MXPARAM + ipar]
+
 } INPUTS ;
 
 // char SIMSED_PATHMODEL[200];
@@ -291,6 +315,14 @@ struct CORNER {
 
 int FLUX_ERRFLAG ;
 
+// cache of corner SEDs, indexed by ISED; shared by all parameter
+// points in batch mode so that each SED file is read only once.
+struct SEDCACHE {
+  double **FLUX, **FLUXERR ;  // [ISED] -> NDAY*NLAM array
+  double MEMTOT_MB ;
+  int    NREAD ;
+} SEDCACHE ;
+
 // ====================================
 int main(int argc, char **argv) {
 
@@ -317,6 +349,13 @@ int main(int argc, char **argv) {
 
   init_random_seed(INPUTS.ISEED, 1);
 
+  // batch mode: all parameter points & epochs -> one binary cube
+  if ( strcmp(INPUTS.CUBE_FILE,"NULL") != 0 ) {
+    extract_cube();
+    printf(" PROGRAM ENDING GRACEFULLY \n");
+    exit(0);
+  }
+
   // prepare the corners and SEDs needed to interpolate
   // the SEDs in SED-parameter space
   interp_prep();
@@ -404,6 +443,11 @@ void init_inputs(void) {
 
   INPUTS.LAMDUMP = -999. ;
 
+  sprintf(INPUTS.PLIST_FILE, "%s", "NULL");
+  sprintf(INPUTS.CUBE_FILE,  "%s", "NULL");
+  INPUTS.NPOINT       = 0 ;
+  INPUTS.PARAM_POINTS = NULL ;
+
 } // end of init_inputs
 
 
@@ -466,6 +510,20 @@ void parse_args(int argc, char **argv) {
       }
     } // --plist
 
+    if ( strcmp(ARGV_LIST[i],"--plist_file") == 0 ) {
+      if ( SEDMODEL.NPAR == 0 ) {
+        sprintf(c1err,"Cannot read plist_file before SIMSED version is set.");
+        sprintf(c2err,"Check syntax at top of SIMSED_extractSpec.c");
+        errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+      }
+      i++ ; sscanf(ARGV_LIST[i], "%s",  INPUTS.PLIST_FILE) ;
+      parse_plist_file(INPUTS.PLIST_FILE);
+    }
+
+    if ( strcmp(ARGV_LIST[i],"--cube") == 0 ) {
+      i++ ; sscanf(ARGV_LIST[i], "%s",  INPUTS.CUBE_FILE) ;
+    }
+
 
     // now check optionalargs
 
@@ -550,6 +608,24 @@ void parse_args(int argc, char **argv) {
 
   // -------------
 
+  // batch mode always writes a cube; single --plist with --cube
+  // is treated as a one-point batch.
+  if ( INPUTS.NPOINT > 0 && strcmp(INPUTS.CUBE_FILE,"NULL") == 0 ) 
+    { sprintf(INPUTS.CUBE_FILE, "%s", "SIMSED_extractSpec.CUBE"); }
+
+  if ( INPUTS.NPOINT == 0 && strcmp(INPUTS.CUBE_FILE,"NULL") != 0 ) {
+    INPUTS.NPOINT = 1 ;
+    INPUTS.PARAM_POINTS = (double*)malloc(MXPARAM*sizeof(double));
+    for ( ipar=0; ipar < SEDMODEL.NPAR; ipar++ ) 
+      { INPUTS.PARAM_POINTS[ipar] = INPUTS.PARAM_LIST[ipar]; }
+  }
+
+  if ( INPUTS.NEPOCH == 0 ) {
+    sprintf(c1err,"No epochs defined.");
+    sprintf(c2err,"Use --t <Trest> or --tlist <file>");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+  }
+
   if ( strcmp(INPUTS.TYPE,"SNANA") == 0 && INPUTS.PEAKMJD == -1 ) {
     sprintf(c1err,"Must include option --T0 <peakmjd> with SNANA argument.");
     sprintf(c2err,"Fix input parameters ");
@@ -586,11 +662,17 @@ void parse_args(int argc, char **argv) {
   }
  
 
-  for ( ipar=0; ipar < SEDMODEL.NPAR; ipar++ ) {
-    printf("\t %s   \t = %f ",
-           SEDMODEL.PARNAMES[ipar], INPUTS.PARAM_LIST[ipar] );
-    if ( INPUTS.USEPAR[ipar] == 0 ) { printf(" ==> IGNORE"); }
-    printf("\n");
+  if ( strcmp(INPUTS.PLIST_FILE,"NULL") != 0 ) {
+    printf("\t %d parameter points from %s \n", 
+	   INPUTS.NPOINT, INPUTS.PLIST_FILE );
+  }
+  else {
+    for ( ipar=0; ipar < SEDMODEL.NPAR; ipar++ ) {
+      printf("\t %s   \t = %f ",
+	     SEDMODEL.PARNAMES[ipar], INPUTS.PARAM_LIST[ipar] );
+      if ( INPUTS.USEPAR[ipar] == 0 ) { printf(" ==> IGNORE"); }
+      printf("\n");
+    }
   }
 
   printf("\t Rest-frame wavelength \t = %6.0f to %6.0f \n",
@@ -619,7 +701,10 @@ void parse_args(int argc, char **argv) {
       ZFLUXVAL);
   }
 
-  printf("\t Ouput spectra in %s format. \n\n", INPUTS.TYPE);
+  if ( strcmp(INPUTS.CUBE_FILE,"NULL") != 0 ) 
+    { printf("\t Output spectra in binary cube %s \n\n", INPUTS.CUBE_FILE); }
+  else
+    { printf("\t Ouput spectra in %s format. \n\n", INPUTS.TYPE); }
 
 
 } // end of parse_args
@@ -761,6 +846,72 @@ void parse_epochs(char *epFile) {
 
 } // end of parse_epochs
 
+
+// ********************************
+void parse_plist_file(char *plistFile) {
+
+  // Created Oct 2026
+  // Read batch list of SED parameter points; each line has
+  // SEDMODEL.NPAR values in the same order as --plist
+  // (-999 => ignore parameter). Blank lines and lines starting
+  // with '#' are skipped. Store values in INPUTS.PARAM_POINTS.
+
+  FILE *fp;
+  int  MXPOINT = 1000, ipar, NPAR = SEDMODEL.NPAR, NPOINT = 0 ;
+  char line[MXCHAR_LINE], *ptrtok ;
+  double *ptrpar ;
+  char fnam[] = "parse_plist_file" ;
+
+  // ------------- BEGIN --------------
+
+  fp = fopen(plistFile, "rt") ;
+  if ( !fp ) {
+    sprintf(c1err,"Could not open plist file: %s", plistFile);
+    sprintf(c2err,"Check --plist_file argument");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  INPUTS.PARAM_POINTS = (double*)malloc(MXPOINT*MXPARAM*sizeof(double));
+
+  while ( fgets(line, MXCHAR_LINE, fp) != NULL ) {
+
+    ptrtok = strtok(line, " \t\n");
+    if ( ptrtok == NULL  ) { continue ; }
+    if ( ptrtok[0] == '#') { continue ; }
+
+    if ( NPOINT == MXPOINT ) {
+      MXPOINT *= 2 ;
+      INPUTS.PARAM_POINTS = (double*)
+	realloc(INPUTS.PARAM_POINTS, MXPOINT*MXPARAM*sizeof(double));
+    }
+
+    ptrpar = &INPUTS.PARAM_POINTS[NPOINT*MXPARAM] ;
+    for ( ipar=0; ipar < NPAR; ipar++ ) {
+      if ( ptrtok == NULL ) {
+	sprintf(c1err,"Found %d parameters for point %d", ipar, NPOINT+1);
+	sprintf(c2err,"but expected NPAR=%d in %s", NPAR, plistFile);
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+      }
+      sscanf(ptrtok, "%le", &ptrpar[ipar] );
+      ptrtok = strtok(NULL, " \t\n");
+    }
+    NPOINT++ ;
+  }
+
+  fclose(fp);
+
+  if ( NPOINT == 0 ) {
+    sprintf(c1err,"No parameter points found in");
+    sprintf(c2err,"%s", plistFile);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  INPUTS.NPOINT = NPOINT ;
+  printf("   Read %d parameter points from %s \n", NPOINT, plistFile);
+  fflush(stdout);
+
+} // end of parse_plist_file
+
 // ********************************
 void write_banner(int ep) {
   
@@ -979,7 +1130,7 @@ void interp_prep(void) {
     ,NCORNERS
     ,NSTORE
     ,MSK, J01
-    ,LDMP_CORNER = 1
+    ,LDMP_CORNER = ( INPUTS.NPOINT <= 1 || INPUTS.DEBUG )
     ;
 
   double 
@@ -1137,9 +1288,11 @@ void prep_gal(void) {
     return;
   }
 
-  // Get galaxy SED
-  rd2columnFile(INPUTS.GALFILE, MXBIN_LAMSED_SEDMODEL, &NBIN_GALLAM , GALLAM , GALFLUX, 0 );
-  printf(" Read %d rows of galaxy SED \n\n", NBIN_GALLAM );
+  // Get galaxy SED (only once in batch mode)
+  if ( NBIN_GALLAM == 0 ) {
+    rd2columnFile(INPUTS.GALFILE, MXBIN_LAMSED_SEDMODEL, &NBIN_GALLAM , GALLAM , GALFLUX, 0 );
+    printf(" Read %d rows of galaxy SED \n\n", NBIN_GALLAM );
+  }
 
   // Get peak SN spectrum
   // use negative epoch to force peak 
@@ -1169,10 +1322,13 @@ void read_simsed(void) {
   // Read simsed spectral surface (lambda vs. Trest) corresponding
   // to --plist.  Store results in TEMP_SEDMODEL struct.
   //
+  // Oct 15 2026: each corner SED is read once and stored in
+  //   SEDCACHE; CORNER.FLUX[icorner] points to the cached SED.
+  //
   // This function needs modification to propery interpolate
   // from SIMSED parameters
 
-  int ised, icorner, nflux_nan ;
+  int ised, icorner, nflux_nan, nbin ;
 
   double TREST_RANGE[2] ;
 
@@ -1195,29 +1351,56 @@ void read_simsed(void) {
   }
  
 
-  for ( icorner = 0; icorner < CORNER.NSTORE ; icorner++ ) {
-
-    ised = CORNER.ISED[icorner];
+  // allocate cache pointers and TEMP_SEDMODEL on first call
+  if ( SEDCACHE.FLUX == NULL ) {
+    int MEMP = (SEDMODEL.NSURFACE+1) * sizeof(double*) ;
+    SEDCACHE.FLUX    = (double**)malloc(MEMP);
+    SEDCACHE.FLUXERR = (double**)malloc(MEMP);
+    for ( ised=0; ised <= SEDMODEL.NSURFACE; ised++ ) 
+      { SEDCACHE.FLUX[ised] = SEDCACHE.FLUXERR[ised] = NULL ; }
+    SEDCACHE.MEMTOT_MB = 0.0 ;
+    SEDCACHE.NREAD     = 0 ;
+    malloc_SEDFLUX_SEDMODEL(&TEMP_SEDMODEL,0,0,0);
+  }
 
-    sprintf(sedFile_full,"%s/%s", 
-	    SIMSED_PATHMODEL, SEDMODEL.FILENAME[ised] );
+  // if cache is too big, start over; current corners are re-read below
+  if ( SEDCACHE.MEMTOT_MB > MXMEM_SEDCACHE ) { flush_SEDCACHE(); }
 
-    sprintf(sedcomment,"(ised=%d/%d)", ised, SEDMODEL.NSURFACE );
+  for ( icorner = 0; icorner < CORNER.NSTORE ; icorner++ ) {
 
-    // allocate memory for this SED
-    CORNER.FLUX[icorner]    = (double *)malloc(8*MXBIN_SED_SEDMODEL);
-    CORNER.FLUXERR[icorner] = (double *)malloc(8*MXBIN_SED_SEDMODEL);
+    ised = CORNER.ISED[icorner];
 
-    malloc_SEDFLUX_SEDMODEL(&TEMP_SEDMODEL,0,0,0);
+    if ( SEDCACHE.FLUX[ised] == NULL ) {
+
+      sprintf(sedFile_full,"%s/%s", 
+	      SIMSED_PATHMODEL, SEDMODEL.FILENAME[ised] );
+
+      sprintf(sedcomment,"(ised=%d/%d)", ised, SEDMODEL.NSURFACE );
+
+      // allocate max memory for this SED, then trim after reading
+      SEDCACHE.FLUX[ised]    = (double *)malloc(8*MXBIN_SED_SEDMODEL);
+      SEDCACHE.FLUXERR[ised] = (double *)malloc(8*MXBIN_SED_SEDMODEL);
+
+      rd_sedFlux(sedFile_full, sedcomment
+		 ,TREST_RANGE, INPUTS.LAM_RANGE
+		 ,MXBIN_DAYSED_SEDMODEL, MXBIN_LAMSED_SEDMODEL
+		 ,SEDMODEL.OPTMASK
+		 ,&TEMP_SEDMODEL.NDAY, TEMP_SEDMODEL.DAY, &TEMP_SEDMODEL.DAYSTEP
+		 ,&TEMP_SEDMODEL.NLAM, TEMP_SEDMODEL.LAM, &TEMP_SEDMODEL.LAMSTEP
+		 ,SEDCACHE.FLUX[ised], SEDCACHE.FLUXERR[ised]
+		 ,&nflux_nan);
+
+      nbin = TEMP_SEDMODEL.NDAY * TEMP_SEDMODEL.NLAM ;
+      SEDCACHE.FLUX[ised]    = 
+	(double*)realloc(SEDCACHE.FLUX[ised],    nbin*sizeof(double));
+      SEDCACHE.FLUXERR[ised] = 
+	(double*)realloc(SEDCACHE.FLUXERR[ised], nbin*sizeof(double));
+      SEDCACHE.MEMTOT_MB += (double)(2*nbin*sizeof(double)) / 1.0E6 ;
+      SEDCACHE.NREAD++ ;
+    }
 
-    rd_sedFlux(sedFile_full, sedcomment
-	       ,TREST_RANGE, INPUTS.LAM_RANGE
-	       ,MXBIN_DAYSED_SEDMODEL, MXBIN_LAMSED_SEDMODEL
-	       ,SEDMODEL.OPTMASK
-	       ,&TEMP_SEDMODEL.NDAY, TEMP_SEDMODEL.DAY, &TEMP_SEDMODEL.DAYSTEP
-	       ,&TEMP_SEDMODEL.NLAM, TEMP_SEDMODEL.LAM, &TEMP_SEDMODEL.LAMSTEP
-	       ,CORNER.FLUX[icorner], CORNER.FLUXERR[icorner]
-	       ,&nflux_nan);
+    CORNER.FLUX[icorner]    = SEDCACHE.FLUX[ised] ;
+    CORNER.FLUXERR[icorner] = SEDCACHE.FLUXERR[ised] ;
   }
 
   
@@ -1227,6 +1410,26 @@ void read_simsed(void) {
 } // end of read_simsed
 
 
+// =====================================
+void flush_SEDCACHE(void) {
+
+  // Created Oct 2026
+  // Free all cached corner SEDs (batch mode memory limit).
+
+  int ised ;
+
+  for ( ised=0; ised <= SEDMODEL.NSURFACE; ised++ ) {
+    if ( SEDCACHE.FLUX[ised] == NULL ) { continue ; }
+    free(SEDCACHE.FLUX[ised]);
+    free(SEDCACHE.FLUXERR[ised]);
+    SEDCACHE.FLUX[ised] = SEDCACHE.FLUXERR[ised] = NULL ;
+  }
+
+  SEDCACHE.MEMTOT_MB = 0.0 ;
+
+} // end of flush_SEDCACHE
+
+
 
 // =====================================
 int ISED_MATCH(double *parval) {
@@ -1751,3 +1954,143 @@ double getSNR(int *wsnr, int *wlam, double lam, int ep) {
 
 
 
+// ************************************
+void extract_cube(void) {
+
+  // Created Oct 2026
+  // Batch mode: extract spectra for all INPUTS.NPOINT parameter
+  // points and all INPUTS.NEPOCH epochs, and write them to one
+  // binary cube. Epoch list, SIMSED.INFO and corner-SED cache are 
+  // shared by all points; only interp_prep and getSpec are 
+  // repeated per point.
+
+  FILE *fp;
+  int  ipoint, ipar, ep ;
+  double *ptrpar, parval ;
+  time_t t0, t1 ;
+  char fnam[] = "extract_cube" ;
+
+  // ------------- BEGIN --------------
+
+  fp = fopen(INPUTS.CUBE_FILE, "wb");
+  if ( !fp ) {
+    sprintf(c1err,"Could not open cube file: %s", INPUTS.CUBE_FILE);
+    sprintf(c2err,"Check --cube argument");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  t0 = time(NULL);
+
+  for ( ipoint=0; ipoint < INPUTS.NPOINT; ipoint++ ) {
+
+    ptrpar = &INPUTS.PARAM_POINTS[ipoint*MXPARAM] ;
+    for ( ipar=0; ipar < SEDMODEL.NPAR; ipar++ ) {
+      parval = ptrpar[ipar];
+      INPUTS.PARAM_LIST[ipar] = parval ;
+      INPUTS.USEPAR[ipar]     = ( parval != -999. ) ;
+    }
+
+    interp_prep();
+    read_simsed();
+    prep_gal();
+
+    for ( ep = 1; ep <= INPUTS.NEPOCH; ep++ ) {
+      getSpec(ep);
+      add_gal();
+      obsSpec();
+      fudgeSNR(ep);
+      wrCube(fp, ipoint, ep);
+    }
+
+    if ( (ipoint+1) % 100 == 0 ) {
+      printf("\t Finished %6d of %d parameter points (%d SEDs read)\n",
+	     ipoint+1, INPUTS.NPOINT, SEDCACHE.NREAD );
+      fflush(stdout);
+    }
+  }
+
+  fclose(fp);
+  t1 = time(NULL);
+
+  printf("\n Wrote %d points x %d epochs to %s \n", 
+	 INPUTS.NPOINT, INPUTS.NEPOCH, INPUTS.CUBE_FILE );
+  printf(" Read %d SED files (%.1f MB cached) in %d sec \n",
+	 SEDCACHE.NREAD, SEDCACHE.MEMTOT_MB, (int)(t1-t0) );
+  fflush(stdout);
+
+} // end of extract_cube
+
+
+// ************************************
+void wrCube(FILE *fp, int ipoint, int ep) {
+
+  // Created Oct 2026
+  // Write current spectrum (SPECLAM, SPECFLUX, SPECFLUXERR) to
+  // binary cube *fp. Cube format is a text header ending with
+  // 'END_HEADER:', followed by float32 arrays:
+  //    LAM[NLAM]
+  //    for each point: PARVAL[NPAR] 
+  //       for each epoch: FLUX[NLAM] and FLUXERR[NLAM] if ERRFLAG=1
+  // Unlike wrSpec, the per-epoch lambda range from --tlist is not
+  // applied; every spectrum uses the full lambda grid.
+
+  static int NLAM_CUBE = -9, ERRFLAG ;
+  static float ARRAY[MXBIN_LAMSED_SEDMODEL] ;
+  int ilam, ipar, e ;
+  double *ptrpar ;
+  char fnam[] = "wrCube" ;
+
+  // ------------- BEGIN --------------
+
+  if ( NLAM_CUBE < 0 ) {
+    NLAM_CUBE = NBIN_LAM ;
+    ERRFLAG   = (FLUX_ERRFLAG  || INPUTS.SNR > 1.0E-9 ) ;
+
+    fprintf(fp, "SIMSED_VERSION: %s\n", INPUTS.SIMSED_VERSION );
+    fprintf(fp, "NPAR:      %d\n", SEDMODEL.NPAR );
+    fprintf(fp, "PARNAMES: ");
+    for ( ipar=0; ipar < SEDMODEL.NPAR; ipar++ ) 
+      { fprintf(fp, " %s", SEDMODEL.PARNAMES[ipar] ); }
+    fprintf(fp, "\n");
+    fprintf(fp, "NPOINT:    %d\n", INPUTS.NPOINT );
+    fprintf(fp, "NEPOCH:    %d\n", INPUTS.NEPOCH );
+    fprintf(fp, "EPOCHS:   ");
+    for ( e=1; e <= INPUTS.NEPOCH; e++ ) 
+      { fprintf(fp, " %.3f", INPUTS.EPOCH[e] ); }
+    fprintf(fp, "\n");
+    fprintf(fp, "NLAM:      %d\n", NLAM_CUBE );
+    fprintf(fp, "REDSHIFT:  %.5f\n", INPUTS.REDSHIFT );
+    fprintf(fp, "DISTMOD:   %.4f\n", INPUTS.DLMAG );
+    fprintf(fp, "ERRFLAG:   %d\n", ERRFLAG );
+    fprintf(fp, "END_HEADER:\n");
+
+    for ( ilam=0; ilam < NLAM_CUBE; ilam++ ) 
+      { ARRAY[ilam] = (float)SPECLAM[ilam] ; }
+    fwrite(ARRAY, sizeof(float), NLAM_CUBE, fp);
+  }
+
+  if ( NBIN_LAM != NLAM_CUBE ) {
+    sprintf(c1err,"NBIN_LAM=%d for point %d, epoch %d", 
+	    NBIN_LAM, ipoint, ep);
+    sprintf(c2err,"but cube has NLAM=%d", NLAM_CUBE);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  if ( ep == 1 ) {
+    ptrpar = &INPUTS.PARAM_POINTS[ipoint*MXPARAM] ;
+    for ( ipar=0; ipar < SEDMODEL.NPAR; ipar++ ) 
+      { ARRAY[ipar] = (float)ptrpar[ipar] ; }
+    fwrite(ARRAY, sizeof(float), SEDMODEL.NPAR, fp);
+  }
+
+  for ( ilam=0; ilam < NLAM_CUBE; ilam++ ) 
+    { ARRAY[ilam] = (float)SPECFLUX[ilam] ; }
+  fwrite(ARRAY, sizeof(float), NLAM_CUBE, fp);
+
+  if ( ERRFLAG ) {
+    for ( ilam=0; ilam < NLAM_CUBE; ilam++ ) 
+      { ARRAY[ilam] = (float)SPECFLUXERR[ilam] ; }
+    fwrite(ARRAY, sizeof(float), NLAM_CUBE, fp);
+  }
+
+} // end of wrCube
@@ -194,6 +194,12 @@
 
  Aug 28 2019: add zRange argument to init_genSmear_SALT2()
 
+ Oct 15 2026: read-ahead of the next SED in a pthread (sedRead_thread)
+              while the current SED is smoothed, fudged and written;
+              text read of each SED overlaps with processing of the 
+              previous one. Disable with input key PREFETCH_SED: 0 .
+              Also malloc TEMP_SEDMODEL (was never allocated here).
+
 **************************************/
 
 #include <stdio.h>
@@ -202,6 +208,7 @@
 #include <string.h>
 #include <time.h>
 #include <math.h>
+#include <pthread.h>
 
 #include "sntools.h"
 #include "sntools_genSmear.h"
@@ -236,6 +243,10 @@ void  update_SEDINFO_file(FILE *fp, char *sed_outFile, int ised,
 			  double MB0cor, double DM15cor );
 
 void  sedRead(int ised);
+void  sedRead_exec(int ised, SEDMODEL_FLUX_DEF *SEDFLUX);
+void  *sedRead_thread(void *arg);
+int   next_ised(int ised);
+void  init_PREFETCH_SED(void);
 void  sedSmooth_driver(int ised);
 void  sedFudge_color(int ised);
 void  sedFudge_smear(int ised, int ismear);
@@ -575,6 +586,15 @@ char shapeFudge_datFile[60] = "shapeFudge.dat" ;
 
 char CTAGNTUP[20][8], *ptr_CTAGNTUP[20] ;
 
+// Oct 2026: next SED is read by a thread into PREFETCH_SED.SEDFLUX
+// while the current one (TEMP_SEDMODEL) is processed; then swap.
+struct {
+  int  USE ;          // input key PREFETCH_SED (default=1)
+  int  ISED ;         // SED index being read by thread (-9 => none)
+  pthread_t THREAD ;
+  SEDMODEL_FLUX_DEF SEDFLUX ;
+} PREFETCH_SED ;
+
 // Rahul's stuff for smoothing.
 
 #define pi 3.1415926535
@@ -608,6 +628,8 @@ int main(int argc, char **argv) {
 
   set_SIMSED_PATH();
 
+  malloc_SEDFLUX_SEDMODEL(&TEMP_SEDMODEL,0,0,0); // Oct 2026
+
   if ( strcmp(INPUTS.SIMSED_VERSION_INPUT,"NULL") != 0 ) {
     read_SIMSED_INFO(SIMSED_PATHMODEL_INPUT);
   }
@@ -631,6 +653,7 @@ int main(int argc, char **argv) {
 
   open_SEDINFO_file();
 
+  init_PREFETCH_SED();
 
   printf("\n");
   NSED_OUTPUT = NCALL_SMOOTH = 0 ;
@@ -986,6 +1009,8 @@ void read_input(void) {
 
   sprintf(INPUTS.SIMSED_MODELPATH,"NULL");
 
+  PREFETCH_SED.USE = 1 ;
+
   // read input file
 
   while( (fscanf(fp, "%s", c_get)) != EOF) {
@@ -1007,6 +1032,9 @@ void read_input(void) {
     if ( strcmp(c_get,"LAMPOLY_FLUX:") == 0 )
       { readdouble(fp, 4, INPUTS.LAMPOLY_FLUX ); }
 
+    if ( strcmp(c_get,"PREFETCH_SED:") == 0 )
+      { readint(fp, 1, &PREFETCH_SED.USE); }
+
     if ( strcmp(c_get,"DEBUG_SIMSED:") == 0 )
       { readdouble(fp, 1, &FLAG_DEBUG_SIMSED); }
 
@@ -2314,8 +2342,54 @@ void init_REMOVE(void) {
 // ********************************
 void sedRead(int ised) {
 
+  // Oct 2026: if this SED was prefetched, wait for the read thread
+  // and swap buffers into TEMP_SEDMODEL; else read now. Then start
+  // reading the next SED in a thread.
+
+  SEDMODEL_FLUX_DEF SEDTMP ;
+  int  ised_next, rc ;
+  char fnam[] = "sedRead" ;
+
+  // ------------ BEGIN ------------
+
+  if ( PREFETCH_SED.ISED == ised ) {
+    pthread_join(PREFETCH_SED.THREAD, NULL);
+    SEDTMP                = TEMP_SEDMODEL ;
+    TEMP_SEDMODEL         = PREFETCH_SED.SEDFLUX ;
+    PREFETCH_SED.SEDFLUX  = SEDTMP ;
+    PREFETCH_SED.ISED     = -9 ;
+  }
+  else {
+    sedRead_exec(ised, &TEMP_SEDMODEL);
+  }
+
+  if ( !PREFETCH_SED.USE ) { return ; }
+
+  ised_next = next_ised(ised);
+  if ( ised_next < 0 ) { return ; }
+
+  PREFETCH_SED.ISED = ised_next ;
+  rc = pthread_create(&PREFETCH_SED.THREAD, NULL, sedRead_thread, 
+		      (void*)&PREFETCH_SED.ISED );
+  if ( rc != 0 ) {
+    sprintf(c1err,"pthread_create returns errcode=%d for ised=%d", 
+	    rc, ised_next);
+    sprintf(c2err,"Try PREFETCH_SED: 0");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+} // end of sedRead
+
+
+// ========================================
+void sedRead_exec(int ised, SEDMODEL_FLUX_DEF *SEDFLUX) {
+
+  // Read SED file for ised into SEDFLUX struct.
+  // Oct 2026: moved from sedRead, and pass output struct so that
+  //           read-ahead thread can fill a separate buffer.
+
   char
-    fnam[] = "sedRead"
+    fnam[] = "sedRead_exec"
     ,sed_inFile_full[200]  
     ,sedcomment[100] 
     ;
@@ -2332,21 +2406,59 @@ void sedRead(int ised) {
 	     ,INPUTS.SIMSED_TREST_RANGE, INPUTS.SIMSED_LAM_RANGE
 	     ,MXBIN_DAYSED_SEDMODEL, MXBIN_LAMSED_SEDMODEL
 	     ,SEDMODEL.OPTMASK
-             ,&TEMP_SEDMODEL.NDAY, TEMP_SEDMODEL.DAY, &TEMP_SEDMODEL.DAYSTEP
-             ,&TEMP_SEDMODEL.NLAM, TEMP_SEDMODEL.LAM, &TEMP_SEDMODEL.LAMSTEP
-             ,TEMP_SEDMODEL.FLUX, TEMP_SEDMODEL.FLUXERR
+             ,&SEDFLUX->NDAY, SEDFLUX->DAY, &SEDFLUX->DAYSTEP
+             ,&SEDFLUX->NLAM, SEDFLUX->LAM, &SEDFLUX->LAMSTEP
+             ,SEDFLUX->FLUX, SEDFLUX->FLUXERR
 	     ,&nflux_nan );
   
-  N = TEMP_SEDMODEL.NDAY ;
-  TEMP_SEDMODEL.DAYMIN  = TEMP_SEDMODEL.DAY[0] ;
-  TEMP_SEDMODEL.DAYMAX  = TEMP_SEDMODEL.DAY[N-1] ;
+  N = SEDFLUX->NDAY ;
+  SEDFLUX->DAYMIN  = SEDFLUX->DAY[0] ;
+  SEDFLUX->DAYMAX  = SEDFLUX->DAY[N-1] ;
 
-  N = TEMP_SEDMODEL.NLAM ;
-  TEMP_SEDMODEL.LAMMIN  = TEMP_SEDMODEL.LAM[0] ;
-  TEMP_SEDMODEL.LAMMAX  = TEMP_SEDMODEL.LAM[N-1] ;
+  N = SEDFLUX->NLAM ;
+  SEDFLUX->LAMMIN  = SEDFLUX->LAM[0] ;
+  SEDFLUX->LAMMAX  = SEDFLUX->LAM[N-1] ;
 
+} // end of sedRead_exec
 
-} // end of sedRead
+
+// ========================================
+void *sedRead_thread(void *arg) {
+  // Created Oct 2026: pthread entry to read SED into prefetch buffer
+  int ised = *(int*)arg ;
+  sedRead_exec(ised, &PREFETCH_SED.SEDFLUX);
+  return NULL ;
+} // end sedRead_thread
+
+
+// ========================================
+int next_ised(int ised) {
+  // Created Oct 2026: return next SED index that is not skipped,
+  // or -9 if there are no more SEDs.
+  int i;
+  for ( i = ised+1 ; i <= SEDMODEL.NSURFACE ; i++ ) 
+    { if ( SKIPSED[i] == 0 ) { return i ; } }
+  return -9 ;
+} // end next_ised
+
+
+// ========================================
+void init_PREFETCH_SED(void) {
+
+  // Created Oct 2026
+  // Allocate SED flux buffer for read-ahead thread.
+
+  // ------------ BEGIN ------------
+
+  PREFETCH_SED.ISED = -9 ;
+
+  if ( PREFETCH_SED.USE ) {
+    malloc_SEDFLUX_SEDMODEL(&PREFETCH_SED.SEDFLUX,0,0,0);
+    printf("\t Read next SED in separate thread (PREFETCH_SED) \n");
+    fflush(stdout);
+  }
+
+} // end init_PREFETCH_SED
 
 
 
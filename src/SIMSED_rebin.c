@@ -25,11 +25,22 @@
     SIMSED_rebin.exe <inpDir>  -lamwin 2000 12000
       --> only keep wavelengths 2000 to 12000 A
 
+    SIMSED_rebin.exe <inpDir>  -rebin_day 2  -nthread 8
+      --> process 8 SEDs at a time in separate threads
+
   BEWARE NOTES:
     + day rebinning can be a function of day,
       by LAM rebinning must be uniform.
     + must use single quotes around arguments with ()
 
+  HISTORY
+  Oct 15 2026: 
+    + new arg -nthread <n> to read/rebin/write SEDs in n pthreads.
+      SED.INFO is copied first and SED list is stored, so output
+      SED.INFO is identical for any nthread.
+    + rebin_SED and write_rebinned_SED take SED struct args 
+      instead of using globals.
+
  ***********/
 
 
@@ -39,6 +50,7 @@
 #include <string.h>
 #include <time.h>
 #include <math.h>
+#include <pthread.h>
 
 #include "sntools.h"
 //#include "sntools_cosmology.h"
@@ -68,8 +80,21 @@ struct {
   double CUTWIN_LAM[2];
   int REBIN_LAM;
 
+  int NTHREAD ;   // number of pthreads to process SEDs (Oct 2026)
+
 } INPUTS;
 
+// Oct 2026: list of SED files from SED.INFO, processed by 1 or more
+// threads; each thread grabs next ISED under MUTEX.
+#define MXSED_REBIN  MXSEDMODEL
+#define MXTHREAD_REBIN 64
+struct {
+  int    NSED ;
+  char   **SED_FILENAME ;
+  int    ISED_NEXT ;
+  pthread_mutex_t MUTEX ;
+} SEDLIST_REBIN ;
+
 
 char SEDINFO_FILE_INP[MXPATHLEN];
 char SEDINFO_FILE_OUT[MXPATHLEN];
@@ -85,8 +110,13 @@ void  parse_REBIN_DAY(char *string, int rebin);
 void  print_rebin_info(FILE *fp);
 void  make_OUTDIR_SIMSED(void);
 void  SIMSED_DRIVER(void);
-void  write_rebinned_SED(char *sed_fileName);
-void  rebin_SED(void);
+void  write_rebinned_SED(char *sed_fileName, SEDMODEL_FLUX_DEF *SEDOUT);
+void  rebin_SED(SEDMODEL_FLUX_DEF *SEDINP, SEDMODEL_FLUX_DEF *SEDOUT);
+void  read_SEDINFO_rebin(void);
+void  rebin_SEDLIST(void);
+void  *rebin_SEDLIST_thread(void *arg);
+void  rebin_SED_exec(int ised, SEDMODEL_FLUX_DEF *SEDINP, 
+		     SEDMODEL_FLUX_DEF *SEDOUT);
 
 // ====================================
 int main(int argc, char **argv) {
@@ -108,15 +138,6 @@ int main(int argc, char **argv) {
   // create output directory and open new SED.INFO file
   make_OUTDIR_SIMSED();
 
-  // allocate TEMP array to read SED 
-  malloc_SEDFLUX_SEDMODEL(&TEMP_SEDMODEL_INP,
-			  MXBIN_DAY_REBIN, MXBIN_LAM_REBIN, MXBIN_SED_REBIN);
-
-  // malloc rebinned array
-  malloc_SEDFLUX_SEDMODEL(&TEMP_SEDMODEL_OUT,
-			  MXBIN_DAY_REBIN, MXBIN_LAM_REBIN, MXBIN_SED_REBIN);
-
-
   SIMSED_DRIVER();
 
   fclose(FP_SEDINFO_INP);
@@ -143,6 +164,7 @@ void parse_args(int argc, char **argv) {
   
   INPUTS.REBIN_LAM = 1;
   INPUTS.NREBIN_DAY = 0 ;
+  INPUTS.NTHREAD    = 1 ;
   INPUTS.CUTWIN_LAM[0] = 0.0 ;
   INPUTS.CUTWIN_LAM[1] = LAMMAX_REBIN ;
 
@@ -163,6 +185,17 @@ void parse_args(int argc, char **argv) {
       i++;  sscanf(ARGV_LIST[i], "%le", &INPUTS.CUTWIN_LAM[1] );
     }
 
+    if ( strcmp(ARGV_LIST[i],"-nthread") == 0 ) {
+      i++;  sscanf(ARGV_LIST[i], "%d", &INPUTS.NTHREAD );
+      if ( INPUTS.NTHREAD < 1 ) { INPUTS.NTHREAD = 1; }
+      if ( INPUTS.NTHREAD > MXTHREAD_REBIN ) {
+	sprintf(c1err,"nthread=%d exceeds bound of %d", 
+		INPUTS.NTHREAD, MXTHREAD_REBIN);
+	sprintf(c2err,"Reduce -nthread argument.");
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+      }
+    }
+
     if ( strstr(ARGV_LIST[i],"-rebin_day") != NULL ) {
       i++ ; sscanf(ARGV_LIST[i], "%d",  &rebin_tmp );
       parse_REBIN_DAY(ARGV_LIST[i-1], rebin_tmp);
@@ -310,17 +343,35 @@ void  make_OUTDIR_SIMSED(void) {
 // ****************************
 void  SIMSED_DRIVER(void) {
 
+  // Oct 2026: 
+  //  read SED.INFO & store SED list (read_SEDINFO_rebin), 
+  //  then rebin each SED (rebin_SEDLIST) with 1 or more threads.
+
+  // ---------- BEGIN -------
+
+  read_SEDINFO_rebin();
+  rebin_SEDLIST();
+
+  printf("  Done rebinning %d SEDs.\n", SEDLIST_REBIN.NSED );
+
+  return ;
+
+} // end void  SIMSED_DRIVER
+
+
+// ****************************
+void  read_SEDINFO_rebin(void) {
+
+  // Created Oct 2026 [code moved from SIMSED_DRIVER]
+  // Copy each line of input SED.INFO to output SED.INFO, 
+  // and store SED file names in SEDLIST_REBIN.
+
 #define MXCHAR_LINE 200
 
-  int NLINE=0, NSED=0, nflux_nan=0 ;
+  int NLINE=0, NSED=0 ;
   char LINE[MXCHAR_LINE];
-  char *ptrtok, KEY[40], sed_fileName[100], SED_FILENAME[200];
-  char sedComment[] = "";
-  char fnam[] = "SIMSED_DRIVER" ;
-
-  int    SEDMODEL_OPTMASK = 2;  // allow non-uniform day bins
-  double Trange_SIMSED[2] = { -1000.0, 1000.0 } ;
-  double Lrange_SIMSED[2] = {  100.0,  LAMMAX_REBIN } ;
+  char *ptrtok, KEY[40], sed_fileName[100];
+  char fnam[] = "read_SEDINFO_rebin" ;
 
   // ---------- BEGIN -------
 
@@ -331,6 +382,8 @@ void  SIMSED_DRIVER(void) {
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
   }
 
+  SEDLIST_REBIN.SED_FILENAME = (char**)malloc(MXSED_REBIN*sizeof(char*));
+
   printf(" Begin reading input SED.INFO file: \n");
 
   while ( fgets(LINE, MXCHAR_LINE, FP_SEDINFO_INP) != NULL ) {
@@ -345,44 +398,156 @@ void  SIMSED_DRIVER(void) {
 
     ptrtok = strtok(NULL," " );
     if ( ptrtok != NULL ) { sprintf(sed_fileName, "%s", ptrtok); }
-    
-    sprintf(SED_FILENAME, "%s/%s", INPUTS.INPDIR_SIMSED, sed_fileName);
-    rd_sedFlux(SED_FILENAME, sedComment
-	       ,Trange_SIMSED, Lrange_SIMSED
-	       ,MXBIN_DAY_REBIN, MXBIN_LAM_REBIN
-	       ,SEDMODEL_OPTMASK
-	       ,&TEMP_SEDMODEL_INP.NDAY, 
-	       TEMP_SEDMODEL_INP.DAY, &TEMP_SEDMODEL_INP.DAYSTEP
-	       ,&TEMP_SEDMODEL_INP.NLAM, 
-	       TEMP_SEDMODEL_INP.LAM, &TEMP_SEDMODEL_INP.LAMSTEP
-	       ,TEMP_SEDMODEL_INP.FLUX,  TEMP_SEDMODEL_INP.FLUXERR
-	       ,&nflux_nan);  
 
+    if ( NSED >= MXSED_REBIN ) {
+      sprintf(c1err,"NSED exceeds bound of MXSED_REBIN=%d", MXSED_REBIN);
+      sprintf(c2err,"Check %s", SEDINFO_FILE_INP);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+    SEDLIST_REBIN.SED_FILENAME[NSED] = 
+      (char*)malloc( (strlen(sed_fileName)+1)*sizeof(char) );
+    sprintf(SEDLIST_REBIN.SED_FILENAME[NSED], "%s", sed_fileName);
+    NSED++ ;
+  }
+
+  SEDLIST_REBIN.NSED = NSED ;
 
-    // do the dirty work of rebinng and modify TEMP_SEDMODEL
-    rebin_SED();
+  printf("  Done reading %d lines and %d SEDs from SED.INFO file.\n", 
+	 NLINE, NSED );
+  fflush(stdout);
 
-    write_rebinned_SED(sed_fileName);
+  return ;
 
-    NSED++ ;
+} // end read_SEDINFO_rebin
+
+
+// ****************************
+void  rebin_SEDLIST(void) {
+
+  // Created Oct 2026
+  // Rebin all SEDs in SEDLIST_REBIN. For NTHREAD=1, use global
+  // TEMP_SEDMODEL_[INP,OUT]; else launch NTHREAD pthreads that
+  // each allocate their own SED arrays and grab the next SED.
+
+  int NTHREAD = INPUTS.NTHREAD ;
+  int ised, t, rc ;
+  pthread_t THREAD[MXTHREAD_REBIN];
+  char fnam[] = "rebin_SEDLIST" ;
+
+  // ---------- BEGIN -------
+
+  if ( NTHREAD == 1 ) {
+    malloc_SEDFLUX_SEDMODEL(&TEMP_SEDMODEL_INP,
+			    MXBIN_DAY_REBIN, MXBIN_LAM_REBIN, MXBIN_SED_REBIN);
+    malloc_SEDFLUX_SEDMODEL(&TEMP_SEDMODEL_OUT,
+			    MXBIN_DAY_REBIN, MXBIN_LAM_REBIN, MXBIN_SED_REBIN);
+    for(ised=0; ised < SEDLIST_REBIN.NSED; ised++ ) 
+      { rebin_SED_exec(ised, &TEMP_SEDMODEL_INP, &TEMP_SEDMODEL_OUT); }
+    return ;
   }
 
-  printf("  Done readig %d lines and %d SEDs from SED.INFO file.\n", 
-	 NLINE, NSED );
+  printf("  Rebin SEDs with %d threads.\n", NTHREAD);
+  fflush(stdout);
+
+  SEDLIST_REBIN.ISED_NEXT = 0 ;
+  pthread_mutex_init(&SEDLIST_REBIN.MUTEX, NULL);
+
+  for(t=0; t < NTHREAD; t++ ) {
+    rc = pthread_create(&THREAD[t], NULL, rebin_SEDLIST_thread, NULL);
+    if ( rc != 0 ) {
+      sprintf(c1err,"pthread_create returns errcode=%d for t=%d", rc, t);
+      sprintf(c2err,"Try smaller -nthread");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+  }
+  for(t=0; t < NTHREAD; t++ ) { pthread_join(THREAD[t], NULL); }
+
+  pthread_mutex_destroy(&SEDLIST_REBIN.MUTEX);
 
   return ;
 
-} // end void  SIMSED_DRIVER
+} // end rebin_SEDLIST
+
+
+// ****************************
+void *rebin_SEDLIST_thread(void *arg) {
+
+  // Created Oct 2026: pthread worker; grab next SED until none left.
+
+  SEDMODEL_FLUX_DEF SEDINP, SEDOUT ;
+  int ised ;
+
+  // ---------- BEGIN -------
+
+  malloc_SEDFLUX_SEDMODEL(&SEDINP,
+			  MXBIN_DAY_REBIN, MXBIN_LAM_REBIN, MXBIN_SED_REBIN);
+  malloc_SEDFLUX_SEDMODEL(&SEDOUT,
+			  MXBIN_DAY_REBIN, MXBIN_LAM_REBIN, MXBIN_SED_REBIN);
+
+  while ( 1 ) {
+    pthread_mutex_lock(&SEDLIST_REBIN.MUTEX);
+    ised = SEDLIST_REBIN.ISED_NEXT++ ;
+    pthread_mutex_unlock(&SEDLIST_REBIN.MUTEX);
+    if ( ised >= SEDLIST_REBIN.NSED ) { break; }
+    rebin_SED_exec(ised, &SEDINP, &SEDOUT);
+  }
+
+  free(SEDINP.DAY);  free(SEDINP.LAM);  
+  free(SEDINP.FLUX); free(SEDINP.FLUXERR);
+  free(SEDOUT.DAY);  free(SEDOUT.LAM);  
+  free(SEDOUT.FLUX); free(SEDOUT.FLUXERR);
+
+  return NULL;
+
+} // end rebin_SEDLIST_thread
+
+
+// ****************************
+void  rebin_SED_exec(int ised, SEDMODEL_FLUX_DEF *SEDINP, 
+		     SEDMODEL_FLUX_DEF *SEDOUT) {
+
+  // Created Oct 2026 [code moved from SIMSED_DRIVER]
+  // read, rebin and write SED with index ised in SEDLIST_REBIN.
+
+  int nflux_nan=0 ;
+  char *sed_fileName = SEDLIST_REBIN.SED_FILENAME[ised] ;
+  char SED_FILENAME[MXPATHLEN];
+  char sedComment[] = "";
+
+  int    SEDMODEL_OPTMASK = 2;  // allow non-uniform day bins
+  double Trange_SIMSED[2] = { -1000.0, 1000.0 } ;
+  double Lrange_SIMSED[2] = {  100.0,  LAMMAX_REBIN } ;
+
+  // ---------- BEGIN -------
+
+  sprintf(SED_FILENAME, "%s/%s", INPUTS.INPDIR_SIMSED, sed_fileName);
+  rd_sedFlux(SED_FILENAME, sedComment
+	     ,Trange_SIMSED, Lrange_SIMSED
+	     ,MXBIN_DAY_REBIN, MXBIN_LAM_REBIN
+	     ,SEDMODEL_OPTMASK
+	     ,&SEDINP->NDAY, SEDINP->DAY, &SEDINP->DAYSTEP
+	     ,&SEDINP->NLAM, SEDINP->LAM, &SEDINP->LAMSTEP
+	     ,SEDINP->FLUX,  SEDINP->FLUXERR
+	     ,&nflux_nan);  
+
+  // do the dirty work of rebinng
+  rebin_SED(SEDINP, SEDOUT);
+
+  write_rebinned_SED(sed_fileName, SEDOUT);
+
+  return ;
+
+} // end rebin_SED_exec
 
 
 // **********************************************
-void  rebin_SED(void) {
+void  rebin_SED(SEDMODEL_FLUX_DEF *SEDINP, SEDMODEL_FLUX_DEF *SEDOUT) {
 
-  // Do the rebinning here and modify global TEMP_SEDMODEL
-  //
+  // Do the rebinning here: SEDINP -> SEDOUT
+  // Oct 2026: pass SED structs instead of using globals.
 
-  int NDAY_INP = TEMP_SEDMODEL_INP.NDAY;
-  int NLAM_INP = TEMP_SEDMODEL_INP.NLAM;
+  int NDAY_INP = SEDINP->NDAY;
+  int NLAM_INP = SEDINP->NLAM;
 
   int *KEEP_DAY, *KEEP_LAM ;
   int NDAY_OUT, NLAM_OUT;
@@ -403,7 +568,7 @@ void  rebin_SED(void) {
   nskip = 0 ;
   for(iday=0; iday < NDAY_INP; iday++ ) {
       KEEP_DAY[iday] = 0;
-      DAY   = TEMP_SEDMODEL_INP.DAY[iday];
+      DAY   = SEDINP->DAY[iday];
 
       // find rebin factor based on DAY
       REBIN=1;  // default is keep every DAY
@@ -423,14 +588,14 @@ void  rebin_SED(void) {
       KEEP_DAY[iday] = 1;  NDAY_OUT++ ;
 
   }
-  TEMP_SEDMODEL_OUT.NDAY = NDAY_OUT ;
+  SEDOUT->NDAY = NDAY_OUT ;
 
 
   // select lam bins to keep
   nskip = 0 ;
   for (ilam=0; ilam < NLAM_INP; ilam++ ) {
     KEEP_LAM[ilam] = 0;
-    LAM   = TEMP_SEDMODEL_INP.LAM[ilam];
+    LAM   = SEDINP->LAM[ilam];
     if ( LAM < INPUTS.CUTWIN_LAM[0] ) { continue ; }
     if ( LAM > INPUTS.CUTWIN_LAM[1] ) { continue ; }
 
@@ -440,7 +605,7 @@ void  rebin_SED(void) {
 
     KEEP_LAM[ilam] = 1;  NLAM_OUT++ ;
   }
-  TEMP_SEDMODEL_OUT.NLAM = NLAM_OUT ;
+  SEDOUT->NLAM = NLAM_OUT ;
 
   // ------------------------------------------
   // transfer SEDMODEL_INP to SEDMODEL_OUT
@@ -455,14 +620,14 @@ void  rebin_SED(void) {
       if ( KEEP_LAM[ilam] == 0 ) { continue ; }
 
       jflux = NLAM_INP*iday + ilam;
-      DAY   = TEMP_SEDMODEL_INP.DAY[iday] ;
-      LAM   = TEMP_SEDMODEL_INP.LAM[ilam] ;
-      FLUX  = TEMP_SEDMODEL_INP.FLUX[jflux];
+      DAY   = SEDINP->DAY[iday] ;
+      LAM   = SEDINP->LAM[ilam] ;
+      FLUX  = SEDINP->FLUX[jflux];
       
       jflux = NLAM_OUT*iday_out + ilam_out ;
-      TEMP_SEDMODEL_OUT.DAY[iday_out] = DAY ;
-      TEMP_SEDMODEL_OUT.LAM[ilam_out] = LAM ;
-      TEMP_SEDMODEL_OUT.FLUX[jflux]   = FLUX ;
+      SEDOUT->DAY[iday_out] = DAY ;
+      SEDOUT->LAM[ilam_out] = LAM ;
+      SEDOUT->FLUX[jflux]   = FLUX ;
       
       ilam_out++ ;
     } // end ilam
@@ -478,12 +643,12 @@ void  rebin_SED(void) {
 } // end rebin_SED
 
 // **********************************************
-void  write_rebinned_SED(char *sed_fileName) {
+void  write_rebinned_SED(char *sed_fileName, SEDMODEL_FLUX_DEF *SEDOUT) {
 
-  // write TEMP_SEDMODEL_OUT array to sed_fileName in output directory.
+  // write SEDOUT array to sed_fileName in output directory.
 
-  int NDAY = TEMP_SEDMODEL_OUT.NDAY;
-  int NLAM = TEMP_SEDMODEL_OUT.NLAM;
+  int NDAY = SEDOUT->NDAY;
+  int NLAM = SEDOUT->NLAM;
   
   int  iday, ilam, jflux;
   char SED_FILENAME[MXPATHLEN];
@@ -507,9 +672,9 @@ void  write_rebinned_SED(char *sed_fileName) {
   for(iday=0; iday < NDAY; iday++ ) {
     for (ilam=0; ilam < NLAM; ilam++ ) {
       jflux = NLAM*iday + ilam;
-      DAY   = TEMP_SEDMODEL_OUT.DAY[iday];
-      LAM   = TEMP_SEDMODEL_OUT.LAM[ilam];
-      FLUX  = TEMP_SEDMODEL_OUT.FLUX[jflux];
+      DAY   = SEDOUT->DAY[iday];
+      LAM   = SEDOUT->LAM[ilam];
+      FLUX  = SEDOUT->FLUX[jflux];
       fprintf(fp,"%7.3f  %8.3f  %10.4E \n", DAY, LAM, FLUX );
     }
   }
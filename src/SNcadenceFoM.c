@@ -36,6 +36,16 @@
               Removes chance that some random arrays are the same.
 
  Jun 1 2014  MXRAN_MJDARRAY -> 2000 (was 1000)
+
+ Oct 15 2026 
+   + replace O(N^2) bubble sorts with insertion sort (cadence_sortMJD),
+     which is linear for already-sorted MJDs and gives the same 
+     (stable) order; random MJDs are sorted with qsort.
+   + cadence_chi2total: evaluate chi2 with one epoch removed in place
+     (cadence_chi2time_skip) instead of copying the MJD array per epoch.
+     Results are unchanged.
+   + new SNcadenceFoM_batch to evaluate many MJD lists (e.g., LIBIDs) 
+     in one call.
 ************************/
 
 #define MAXRAN_MJDARRAY 2000   // max length of internal MJD arrays
@@ -67,6 +77,7 @@
 
 #include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 //char MSGERR1[80];
 //char MSGERR2[80];
@@ -76,6 +87,9 @@ double cadence_randMJD (double MJDMIN, double MJDMAX);
 double cadence_eqMJD (int k, int N, double MJDMIN, double MJDMAX);
 
 double cadence_chi2time (int N, double *MJDMIN, double MJDMAX);
+double cadence_chi2time_skip (int N, double *MJDLIST, int ISKIP, double CUTOFF);
+void   cadence_sortMJD(int N, double *MJD, double *M5SIG, int *ind);
+int    cadence_compare_double(const void *a, const void *b);
 
 double cadence_m5sigRAND (double M5AVER, double M5SIG3, double QUALITY);
 
@@ -93,6 +107,11 @@ double SNcadenceFoM (int OPTMASK,
 		     int Nobs, double *MJDLIST, double *M5SIGLIST, 
 		     double *parList, char *SIMLIB_IDENTIFIER );
 
+void SNcadenceFoM_batch (int OPTMASK, int NLIST, int *NobsLIST,
+			 double **MJDLIST, double **M5SIGLIST, 
+			 double *parList, char **SIMLIB_IDENTIFIER,
+			 double *FoMLIST );
+
 
 double GaussRan_FOM(void) ; // does NOT use RANLIST
 
@@ -203,6 +222,70 @@ double cadence_chi2time (int N, double *MJDLIST, double CUTOFF) {
   return tchi2;
 } // end of function 'chi2time'
 
+// =====================================================
+double cadence_chi2time_skip (int N, double *MJDLIST, int ISKIP, 
+			      double CUTOFF) {
+
+  // Created Oct 2026
+  // Same as cadence_chi2time(N-1, ...) for MJDLIST[N] with element 
+  // ISKIP removed, but without copying the array.
+
+  int    NRED = N - 1 ;  // size of reduced list
+  int    i, k ;
+  double MJDMIN, MJDMAX, temp, tchi2 = 0.0 ;
+
+  MJDMIN = ( ISKIP == 0   ) ? MJDLIST[1]   : MJDLIST[0] ;
+  MJDMAX = ( ISKIP == N-1 ) ? MJDLIST[N-2] : MJDLIST[N-1] ;
+
+  for ( i=0; i < N; i++ ) {
+    if ( i == ISKIP ) { continue; }
+    k    = ( i < ISKIP ) ? i : i-1 ;  // index in reduced list
+    temp = MJDLIST[i] - ( MJDMIN + ( MJDMAX - MJDMIN ) * (double) k / (double) (NRED-1) );
+    if ( fabs(temp) > CUTOFF ) {
+        tchi2 += (temp - CUTOFF) * (temp - CUTOFF) / (CUTOFF * CUTOFF);
+    }
+  }
+
+  return tchi2;
+} // end of function 'chi2time_skip'
+
+// =====================================================
+void cadence_sortMJD(int N, double *MJD, double *M5SIG, int *ind) {
+
+  // Created Oct 2026
+  // Stable insertion sort of MJD[N] in increasing order; apply same 
+  // permutation to optional M5SIG and ind arrays (NULL -> ignore).
+  // Gives the same order as the original bubble sort, but is linear
+  // for the usual case of already-sorted MJDs.
+
+  int    i, j, itmp = 0 ;
+  double tmp, m5tmp = 0.0 ;
+
+  for ( i=1; i < N; i++ ) {
+    tmp = MJD[i];
+    if ( MJD[i-1] <= tmp ) { continue; }
+    if ( M5SIG ) { m5tmp = M5SIG[i]; }
+    if ( ind   ) { itmp  = ind[i];   }
+    j = i - 1 ;
+    while ( j >= 0 && MJD[j] > tmp ) {
+      MJD[j+1] = MJD[j];
+      if ( M5SIG ) { M5SIG[j+1] = M5SIG[j]; }
+      if ( ind   ) { ind[j+1]   = ind[j];   }
+      j-- ;
+    }
+    MJD[j+1] = tmp;
+    if ( M5SIG ) { M5SIG[j+1] = m5tmp; }
+    if ( ind   ) { ind[j+1]   = itmp;  }
+  }
+
+  return ;
+} // end cadence_sortMJD
+
+int cadence_compare_double(const void *a, const void *b) {
+  double x = *(const double*)a, y = *(const double*)b;
+  return (x > y) - (x < y);
+}
+
 
 // ====================================================================
 // ====================================================================
@@ -226,12 +309,11 @@ double cadence_chi2total( int FirstItem, int N, double *MJDLIST,
     ,deltaChi2Mag_grid // from grid spacing
     ,mjd_array[MAXRAN_MJDARRAY]
     ,m5sig_array[MAXRAN_MJDARRAY]
-    ,mjd_copy[MAXRAN_MJDARRAY]
-    ,temp, temp0, temp1, temp2, arg
+    ,temp0, temp1, temp2, arg
     ;
 
   int ind[MAXRAN_MJDARRAY];   // array for indexes of sorted elements
-  int i,j,it;
+  int i;
 
   // Copy the values into local arrays
   for ( i=0; i < N; i++ ) {
@@ -241,18 +323,7 @@ double cadence_chi2total( int FirstItem, int N, double *MJDLIST,
   }
 
   // Sort the arrays and the indexes according to the sorted MJDs
-  for ( i=0; i < N-1; i++ ) {
-    for ( j=0; j < N-1; j++ ) {
-      if ( mjd_array[j] > mjd_array[j+1] ) {
-        temp = mjd_array[j+1]; 
-	mjd_array[j+1] = mjd_array[j]; 
-	mjd_array[j]   = temp;
-        it        = ind[j+1]; 
-	ind[j+1] = ind[j]; 
-	ind[j]   = it;
-      }
-    }
-  }
+  cadence_sortMJD(N, mjd_array, NULL, ind);
 
   // Define min and max values of MJDs
   MJDMIN = mjd_array[0];
@@ -264,6 +335,9 @@ double cadence_chi2total( int FirstItem, int N, double *MJDLIST,
   temp0 = cadence_chi2time( N, mjd_array, CUTOFF );
   chi2Tot = temp0;
 
+  // optimal grid spacing does not depend on removed epoch
+  temp2 = ( MJDMAX - MJDMIN ) / (double) ( N - 1 );
+
   // Loop over all epochs
   for ( i=0; i < N; i++ ) {
 
@@ -271,16 +345,8 @@ double cadence_chi2total( int FirstItem, int N, double *MJDLIST,
     // add contribution from one epoch removed from the cadence.
     //  otherwise: no extra penalty for total chi2.
 
-      // Create the array without one epoch
-      for ( j=0;   j < i; j++ ) {
-        mjd_copy[j] = mjd_array[j];
-      }
-      for ( j=i+1; j < N; j++ ) {
-        mjd_copy[j-1] = mjd_array[j];
-      }
-
-      // chi2 of the MJD array with N-1 epochs
-      temp1 = cadence_chi2time( N-1, mjd_copy, CUTOFF );
+      // chi2 of the MJD array with N-1 epochs (epoch i removed)
+      temp1 = cadence_chi2time_skip( N, mjd_array, i, CUTOFF );
 
       // calulate $\Delta \chi^2_{m^i}$ from the note:
       deltaChi2Mag      = 0.0;
@@ -294,7 +360,6 @@ double cadence_chi2total( int FirstItem, int N, double *MJDLIST,
       }
 
       // Now get contribution due to increased optimal grid spacing:
-      temp2 = ( MJDMAX - MJDMIN ) / (double) ( N - 1 );
       if ( temp2 > CUTOFF ) {
 	arg = ( temp2 / CUTOFF - 1.0 );
 	//        deltaChi2Mag_grid += pow(arg,2.0);
@@ -332,23 +397,16 @@ int cadence_gen_RANDMJD (int FirstItem, int N, double *MJDRAND,
 			 double MJDMIN, double MJDMAX) {
   // function generates the random MJD array
 
-  int i,j;
+  int i;
   double arrayMJD[MAXRAN_MJDARRAY];
-  double temp;
 
   // Generate MJD array
   for ( i=0; i < N; i++ ) {
     arrayMJD[i] = cadence_randMJD(MJDMIN,MJDMAX);
   }
   
-  // Sort
-  for ( i=0; i < N-1; i++ ) {
-    for ( j=0; j < N-1; j++ ) {
-      if ( arrayMJD[j] > arrayMJD[j+1] ) {
-        temp = arrayMJD[j+1]; arrayMJD[j+1] = arrayMJD[j]; arrayMJD[j] = temp;
-      }
-    }
-  }
+  // Sort (values only, so any sort gives the same result)
+  qsort(arrayMJD, N, sizeof(double), cadence_compare_double);
 
   // Write new array over previous
   for ( i=0; i < N; i++ ) {
@@ -449,7 +507,7 @@ double SNcadenceFoM( int OPTMASK, int Nobs, double *MJDLIST, double *M5SIGLIST,
 
   int 
     OPT_PARAM, OPT_DUMP 
-    ,i,j,k,it
+    ,i,j,k
     ,belowBins    // Number of FoMs of random arrays below the given FoM
     ,ind[MAXRAN_MJDARRAY]    // array for indexes of sorted elements
     ,NRAN_t      // temp for NRAN_MJDARRAY
@@ -510,21 +568,7 @@ double SNcadenceFoM( int OPTMASK, int Nobs, double *MJDLIST, double *M5SIGLIST,
   }
 
   // Sort
-  for ( i=0; i < Nobs-1; i++ ) {
-    for ( j=0; j < Nobs-1; j++ ) {
-      if ( mjd_array[j] > mjd_array[j+1] ) {
-        temp           = mjd_array[j+1]; 
-	mjd_array[j+1] = mjd_array[j]; 
-	mjd_array[j]   = temp;
-	temp = m5sig_array[j+1];
-	m5sig_array[j+1] = m5sig_array[j];
-	m5sig_array[j] = temp;
-        it       = ind[j+1]; 
-	ind[j+1] = ind[j]; 
-	ind[j]   = it;
-      }
-    }
-  }
+  cadence_sortMJD(Nobs, mjd_array, m5sig_array, ind);
 
   MJDMIN     = mjd_array[0] ;
   MJDMAX     = mjd_array[Nobs-1] ;
@@ -681,14 +725,14 @@ double SNcadenceFoM( int OPTMASK, int Nobs, double *MJDLIST, double *M5SIGLIST,
       // calculate random FoMs
       for ( j=0; j < NRAN_t; j++ ) {
 
-          it = cadence_gen_RANDMJD ( MJDMIN_PIECE,
+          cadence_gen_RANDMJD ( MJDMIN_PIECE,
           			     MJD_PIECE,
 			             mjd_rand_array,
 			             mjd_array[MJDMIN_PIECE],
 			             mjd_array[MJDMIN_PIECE+MJD_PIECE-1]
 			             ) ;
 
-          it = cadence_gen_RANDM5SIG ( MJDMIN_PIECE,
+          cadence_gen_RANDM5SIG ( MJDMIN_PIECE,
           			       MJD_PIECE,
 				       m5sig_rand_array,
 				       M5SIG_AVG_t,
@@ -760,3 +804,34 @@ double SNcadenceFoM( int OPTMASK, int Nobs, double *MJDLIST, double *M5SIGLIST,
 
 } // end of SNcadenceFoM
 
+
+// ====================================================================
+void SNcadenceFoM_batch(int OPTMASK, int NLIST, int *NobsLIST,
+			double **MJDLIST, double **M5SIGLIST, 
+			double *parList, char **SIMLIB_IDENTIFIER,
+			double *FoMLIST ) {
+
+  // Created Oct 2026
+  // Evaluate SNcadenceFoM for NLIST cadences (e.g., one per LIBID, or
+  // one per survey strategy) with the same OPTMASK and parList.
+  // Inputs for cadence i are NobsLIST[i], MJDLIST[i], M5SIGLIST[i],
+  // and optional SIMLIB_IDENTIFIER[i] (NULL -> use index).
+  // Output FoM for cadence i is FoMLIST[i].
+
+  int  i ;
+  char ident[40], *ptr_ident ;
+
+  for ( i=0; i < NLIST; i++ ) {
+    if ( SIMLIB_IDENTIFIER ) 
+      { ptr_ident = SIMLIB_IDENTIFIER[i]; }
+    else
+      { sprintf(ident,"CADENCE-%d", i);  ptr_ident = ident; }
+
+    FoMLIST[i] = SNcadenceFoM(OPTMASK, NobsLIST[i], MJDLIST[i], 
+			      M5SIGLIST[i], parList, ptr_ident );
+  }
+
+  return ;
+
+} // end SNcadenceFoM_batch
+
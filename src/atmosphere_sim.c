@@ -66,6 +66,17 @@
 
  Apr 2024: fix few compilier bugs
 
+ Oct 15 2026:
+   - raw mags: filter-trans and atmos-ratio arrays are computed once
+     per (ichange,ifilt) and reused for all SEDs and redshifts
+     (were re-computed for each SED and redshift). Nominal mags
+     (SYNMAG_sansXT, SYNMAG_avecXT) are computed once instead of
+     once per ichange.
+   - new input key NTHREAD: <n> distributes (ichange,ifilt) grid
+     among n pthreads.
+   - new input key TABLE_OUTFILE: <file> writes binary SNBIN table
+     of synthetic mags & mag-shifts (see wr_table_bin).
+
 *****************************************/
 
 #include <stdio.h>
@@ -75,6 +86,8 @@
 #include <time.h>
 #include <math.h>
 
+#include <pthread.h>
+
 #include "sntools.h"
 #include "sntools_output.h"
 
@@ -110,7 +123,9 @@ double SYNMAG( double z,  double *ptrLam, double *ptrTrans
 
 void loopShell(char *copt);
 
-void get_SYNMAG_raw(int ised, int ichange, int ifilt, int iz) ;
+void  loopShell_raw(void);
+void *loopShell_raw_thread(void *arg);
+void  get_SYNMAG_raw(int ichange, int ifilt) ;
 void get_SYNMAG_colorcor(int ised, int ichange, int ifilt, int iz) ;
 
 void GET_FILTER_TRANS ( int ifilt, int imod, int ifrac, double *ftrans ) ; 
@@ -121,6 +136,7 @@ void fitColorcor(int ichange, int NREF, double *mref, double *mxt,
 
 void filter_extinct(void);
 void mkplots(void); 
+void wr_table_bin(void);
 
 // =======================================
 //   declare global variables
@@ -135,6 +151,8 @@ void mkplots(void);
 #define MXZBIN        102   // max # bins for Z
 #define FNU_AB  3.631E-20 // flat Fnu for AB, erg/cm^2*s*Hz
 #define MXCHANGES  10       // max number of atmos changes to define
+#define MXTHREAD_ATMOS 64   // max number of pthreads (Oct 2026)
+#define TABLEID_ATMOS  7200 // binary table ID (Oct 2026)
 
 #define SEDTYPE_REF  1
 #define SEDTYPE_SN   2
@@ -212,8 +230,17 @@ struct {
   int OPT_COLORCOR; // see OPT_COLORCOR_XXX parameters
   int OPT_FILTCOR;  // which atmosTrans to use
 
+  int  NTHREAD ;            // number of pthreads (Oct 2026)
+  char TABLE_OUTFILE[200];  // optional SNBIN table (Oct 2026)
+
 } INPUTS ;
 
+// Oct 2026: task counter for pthreads in loopShell_raw
+struct {
+  int NTASK, ITASK_NEXT ;
+  pthread_mutex_t MUTEX ;
+} RAW_GRID ;
+
 
 
 // define lambda vs. bin (defined by LAMINT_BINSISE)  
@@ -365,6 +392,8 @@ int main(int argc, char **argv) {
 
   mkplots();
 
+  wr_table_bin();
+
   atmosphere_end();
 
   return(0);
@@ -404,6 +433,9 @@ void atmoshpere_init(void) {
 
   INPUTS.NREPLACE_Modtran = 0;
 
+  INPUTS.NTHREAD          = 1 ;
+  INPUTS.TABLE_OUTFILE[0] = 0 ;
+
   sprintf(INPUTS.inputFile,      "NULL" );
   sprintf(INPUTS.hbook_outFile,  "atmosphere.his" );
 
@@ -505,6 +537,20 @@ void  read_input(void) {
     if ( strcmp(c_get,"HBOOK_OUTFILE:") == 0 )
       readchar(fp, INPUTS.hbook_outFile );
 
+    if ( strcmp(c_get,"TABLE_OUTFILE:") == 0 )
+      readchar(fp, INPUTS.TABLE_OUTFILE );
+
+    if ( strcmp(c_get,"NTHREAD:") == 0 ) {
+      readint(fp, 1, &INPUTS.NTHREAD );
+      if ( INPUTS.NTHREAD < 1 ) { INPUTS.NTHREAD = 1; }
+      if ( INPUTS.NTHREAD > MXTHREAD_ATMOS ) {
+	sprintf(c1err,"NTHREAD=%d exceeds bound of %d", 
+		INPUTS.NTHREAD, MXTHREAD_ATMOS);
+	sprintf(c2err,"Reduce NTHREAD in input file.");
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+      }
+    }
+
     if ( strcmp(c_get,"FILTER_MODTRAN_FLAG:") == 0 )
       readint(fp, 1, &INPUTS.FILTER_MODTRAN_FLAG );
 
@@ -1012,6 +1058,9 @@ void loopShell(char *copt) {
 
   // ------------ BEGIN -----------
 
+  // Oct 2026: raw mags are evaluated per (ichange,ifilt) task
+  if ( strcmp(copt,"raw") == 0 ) { loopShell_raw(); return; }
+
   for ( ichange=1; ichange <= INPUTS.NCHANGES; ichange++ ) {
     for ( ised=1; ised <= INPUTS.NSED; ised++ ) {
  
@@ -1028,9 +1077,7 @@ void loopShell(char *copt) {
       for ( ifilt=1; ifilt <= INPUTS.NFILT; ifilt++ ) {
 	for ( iz=1; iz <= NZ ; iz++ ) {
 
-	  if ( strcmp(copt,"raw") == 0 ) 
-	    get_SYNMAG_raw(ised,ichange,ifilt,iz); 
-	  else if ( strcmp(copt,"colorcor") == 0 ) 
+	  if ( strcmp(copt,"colorcor") == 0 ) 
 	    get_SYNMAG_colorcor(ised,ichange,ifilt,iz); 
 	  else {
 	    sprintf(c1err,"Invalid option '%s' ", copt);
@@ -1046,7 +1093,84 @@ void loopShell(char *copt) {
 } // end of loopShell
 
 // ****************************************************************
-void get_SYNMAG_raw(int ised, int ichange, int ifilt, int iz) {
+void loopShell_raw(void) {
+
+  // Created Oct 2026
+  // Evaluate raw mags for each (ichange,ifilt) task. For NTHREAD > 1,
+  // tasks are distributed among pthreads that each grab next task.
+
+  int NTHREAD = INPUTS.NTHREAD ;
+  int ichange, ifilt, t, rc ;
+  pthread_t THREAD[MXTHREAD_ATMOS];
+  char fnam[] = "loopShell_raw" ;
+
+  // ------------ BEGIN -----------
+
+  RAW_GRID.NTASK = INPUTS.NCHANGES * INPUTS.NFILT ;
+
+  printf("\t Process %d SEDs x %d filters x %d changes with %d thread(s)\n",
+	 INPUTS.NSED, INPUTS.NFILT, INPUTS.NCHANGES, NTHREAD );
+  fflush(stdout) ;
+
+  if ( NTHREAD == 1 ) {
+    for ( ichange=1; ichange <= INPUTS.NCHANGES; ichange++ ) {
+      for ( ifilt=1; ifilt <= INPUTS.NFILT; ifilt++ ) 
+	{ get_SYNMAG_raw(ichange,ifilt); }
+    }
+    return ;
+  }
+
+  RAW_GRID.ITASK_NEXT = 0 ;
+  pthread_mutex_init(&RAW_GRID.MUTEX, NULL);
+
+  for(t=0; t < NTHREAD; t++ ) {
+    rc = pthread_create(&THREAD[t], NULL, loopShell_raw_thread, NULL);
+    if ( rc != 0 ) {
+      sprintf(c1err,"pthread_create returns errcode=%d for t=%d", rc, t);
+      sprintf(c2err,"Try smaller NTHREAD");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+  }
+  for(t=0; t < NTHREAD; t++ ) { pthread_join(THREAD[t], NULL); }
+
+  pthread_mutex_destroy(&RAW_GRID.MUTEX);
+
+  return ;
+
+} // end of loopShell_raw
+
+
+// ****************************************************************
+void *loopShell_raw_thread(void *arg) {
+
+  // Created Oct 2026: pthread worker; grab next task until none left.
+
+  int itask, ichange, ifilt ;
+
+  // ------------ BEGIN -----------
+
+  while ( 1 ) {
+    pthread_mutex_lock(&RAW_GRID.MUTEX);
+    itask = RAW_GRID.ITASK_NEXT++ ;
+    pthread_mutex_unlock(&RAW_GRID.MUTEX);
+    if ( itask >= RAW_GRID.NTASK ) { break; }
+    ichange = itask / INPUTS.NFILT + 1 ;
+    ifilt   = itask % INPUTS.NFILT + 1 ;
+    get_SYNMAG_raw(ichange,ifilt);
+  }
+
+  return NULL;
+
+} // end of loopShell_raw_thread
+
+// ****************************************************************
+void get_SYNMAG_raw(int ichange, int ifilt) {
+
+  // Oct 15 2026: evaluate all SEDs and redshifts for this ichange
+  //   and ifilt; atmRatio & tmpTrans do not depend on SED or z, so
+  //   compute them once here instead of once per SED and z.
+  //   Nominal mags (sansXT, avecXT) do not depend on ichange, so
+  //   compute them only for ichange=1.
 
   double 
     *ptrFlux, *ptrTrans
@@ -1057,36 +1181,12 @@ void get_SYNMAG_raw(int ised, int ichange, int ifilt, int iz) {
     ,tmpTrans[MXLAMINT]
     ;
 
-  int ilam ;
+  int ilam, ised, iz, NZ ;
 
   char fnam[] = "get_SYNMAG_raw" ;
 
   // ------------ BEGIN ------------
 
-  // first evaluate mags with/without atmos extinction
-  // just to see the net effect.
-
-  z         = INPUTS.ARRAY_REDSHIFT[iz];
-  ptrFlux   = SED[ised].FLUX_REBIN ;  // rest-frame SED
-
-  // mag with no atmos extinction
-  ptrTrans  = FILTER[ifilt].TRANS_REBIN ;
-  mag       = SYNMAG( z,  ptrlam_rebin, ptrTrans, ptrFlux, ONEARRAY );
-
-  // mag with nominal atmos extinction
-  ptrTrans  = FILTER[ifilt].TRANSTOT_REBIN ;
-  magxt     = SYNMAG( z, ptrlam_rebin, ptrTrans, ptrFlux, ONEARRAY );
-
-  SYNMAG_sansXT[ifilt][ised][iz] = mag;    // without atmos extinction
-  SYNMAG_avecXT[ifilt][ised][iz] = magxt;  // with atmos extinction
-
-  /*
-  printf("\t mag(%s-%s, z=%4.2f) = %7.4f  -> %7.4f (with AtmosXtinc)\n",
-	 INPUTS.sedName[ised], INPUTS.filterName[ifilt], z, mag, magxt );
-  */
-
-  // --------------
-
   for ( ilam=0; ilam < MXLAMINT; ilam++ ) {     
     lam = LAMBDA_REBIN[ilam] ;
 
@@ -1118,11 +1218,42 @@ void get_SYNMAG_raw(int ised, int ichange, int ifilt, int iz) {
       errmsg(SEV_FATAL, 0, fnam, c1err, "" ); 
     }
   }   // ilam 
-  
-  magxt = SYNMAG( z, ptrlam_rebin, tmpTrans, ptrFlux, atmRatio ) ;
-  SYNMAG_change_raw[ichange][ifilt][ised][iz] = magxt ;
 
+  // --------------
+
+  for ( ised=1; ised <= INPUTS.NSED; ised++ ) {
+
+    if ( INPUTS.sedType[ised] == SEDTYPE_REF ) 
+      { NZ = 1; }
+    else
+      { NZ = INPUTS.NBIN_REDSHIFT ; }
+
+    ptrFlux   = SED[ised].FLUX_REBIN ;  // rest-frame SED
+
+    for ( iz=1; iz <= NZ ; iz++ ) {
+
+      z = INPUTS.ARRAY_REDSHIFT[iz];
+
+      // first evaluate mags with/without atmos extinction
+      // just to see the net effect.
+      if ( ichange == 1 ) {
+	// mag with no atmos extinction
+	ptrTrans  = FILTER[ifilt].TRANS_REBIN ;
+	mag       = SYNMAG( z,  ptrlam_rebin, ptrTrans, ptrFlux, ONEARRAY );
+
+	// mag with nominal atmos extinction
+	ptrTrans  = FILTER[ifilt].TRANSTOT_REBIN ;
+	magxt     = SYNMAG( z, ptrlam_rebin, ptrTrans, ptrFlux, ONEARRAY );
 
+	SYNMAG_sansXT[ifilt][ised][iz] = mag;    // without atmos extinction
+	SYNMAG_avecXT[ifilt][ised][iz] = magxt;  // with atmos extinction
+      }
+
+      magxt = SYNMAG( z, ptrlam_rebin, tmpTrans, ptrFlux, atmRatio ) ;
+      SYNMAG_change_raw[ichange][ifilt][ised][iz] = magxt ;
+
+    } // iz
+  } // ised
 
 } // end of get_SYNMAG_raw
 
@@ -1920,3 +2051,71 @@ void  mkplots(void) {
 
 } // end of   mkplots
 
+
+// *************************************
+void wr_table_bin(void) {
+
+  // Created Oct 2026
+  // If TABLE_OUTFILE is set, write binary (SNBIN) table with one row
+  // per (ichange, ised, ifilt, z) so that large grids of atmospheric
+  // conditions can be analyzed without histogram binning.
+
+  char *ptrFile = INPUTS.TABLE_OUTFILE ;
+  int   ichange, ised, ifilt, iz ;
+  double magref ;
+
+  struct {
+    int   ICHANGE, ISED, SEDTYPE, IFILT ;
+    float Z, MAG_SANSXT, MAG_AVECXT, DMAG_RAW, DMAG_COR ;
+  } ROW ;
+
+  // ------------- BEGIN -------------
+
+  if ( strlen(ptrFile) == 0 ) { return; }
+
+  TABLEFILE_INIT();
+  TABLEFILE_OPEN(ptrFile, "new bin");
+  SNTABLE_CREATE(TABLEID_ATMOS, "ATMOS", "KEY");
+
+  SNTABLE_ADDCOL(TABLEID_ATMOS, "VAR", &ROW.ICHANGE,    "ICHANGE:I",    1);
+  SNTABLE_ADDCOL(TABLEID_ATMOS, "VAR", &ROW.ISED,       "ISED:I",       1);
+  SNTABLE_ADDCOL(TABLEID_ATMOS, "VAR", &ROW.SEDTYPE,    "SEDTYPE:I",    1);
+  SNTABLE_ADDCOL(TABLEID_ATMOS, "VAR", &ROW.IFILT,      "IFILT:I",      1);
+  SNTABLE_ADDCOL(TABLEID_ATMOS, "VAR", &ROW.Z,          "Z:F",          1);
+  SNTABLE_ADDCOL(TABLEID_ATMOS, "VAR", &ROW.MAG_SANSXT, "MAG_SANSXT:F", 1);
+  SNTABLE_ADDCOL(TABLEID_ATMOS, "VAR", &ROW.MAG_AVECXT, "MAG_AVECXT:F", 1);
+  SNTABLE_ADDCOL(TABLEID_ATMOS, "VAR", &ROW.DMAG_RAW,   "DMAG_RAW:F",   1);
+  SNTABLE_ADDCOL(TABLEID_ATMOS, "VAR", &ROW.DMAG_COR,   "DMAG_COR:F",   1);
+
+  for ( ichange = 1; ichange <= INPUTS.NCHANGES; ichange++ ) {
+    for ( ised=1; ised <= INPUTS.NSED; ised++ ) {
+      for ( ifilt=1; ifilt <= INPUTS.NFILT; ifilt++ ) {
+	for ( iz=1; iz <= INPUTS.NBIN_REDSHIFT; iz++ ) {
+
+	  if ( INPUTS.sedType[ised] == SEDTYPE_REF && iz > 1 ) continue ;
+
+	  magref         = SYNMAG_avecXT[ifilt][ised][iz] ;
+	  ROW.ICHANGE    = ichange ;
+	  ROW.ISED       = ised ;
+	  ROW.SEDTYPE    = INPUTS.sedType[ised] ;
+	  ROW.IFILT      = ifilt ;
+	  ROW.Z          = (float)INPUTS.ARRAY_REDSHIFT[iz];
+	  ROW.MAG_SANSXT = (float)SYNMAG_sansXT[ifilt][ised][iz] ;
+	  ROW.MAG_AVECXT = (float)magref ;
+	  ROW.DMAG_RAW   = (float)
+	    (SYNMAG_change_raw[ichange][ifilt][ised][iz] - magref) ;
+	  ROW.DMAG_COR   = (float)
+	    (SYNMAG_change_colorcor[ichange][ifilt][ised][iz] - magref) ;
+	  SNTABLE_FILL(TABLEID_ATMOS);
+	}
+      }
+    }
+  }
+
+  TABLEFILE_CLOSE(ptrFile);
+
+  printf("\n Results written to binary table:  %s \n", ptrFile );
+  fflush(stdout);
+
+} // end of wr_table_bin
+
@@ -62,6 +62,10 @@
   >  combine_fitres.exe  <fitres1> <fitres2> ... --nullval_float -12345
          (override default nullval_float = -888)
 
+  >  combine_fitres.exe <fitres1> <fitres2> ... --stream
+       (out-of-core merge-join: inputs must be row-aligned or sorted
+        by CID; text output only; only one row per file in memory)
+
  WARNINGS/NOTES:
  * If fitres files contain different SN, then first
    fitres file determines the list of SN; extra SN
@@ -95,6 +99,17 @@
               Inernally translate to temp-keyed file. Original motivation is for
               integration into submit_batch_jobs to replace 4_AGG and 5_MERGE in pippin.
 
+ Oct 15 2026: 
+   + allocate each string column as one contiguous block instead of
+     one malloc per cell (MXSTRLEN x NROW small mallocs per column).
+   + for appended files, size the new _ALL columns by the number of
+     rows in the first file (the only isn index used) rather than by
+     the row count of the appended file.
+   + reset USEDCID once per file instead of once per variable.
+   + new --stream option for out-of-core merge-join of text files
+     that are row-aligned or sorted by CID (see STREAM_FITRES).
+   + hash-match whole CID column with match_cid_hash_load/list.
+
 ******************************/
 
 #include <stdio.h>
@@ -144,6 +159,12 @@ void malloc_NMATCH_PER_EVT(int N);
 
 void  relabel_rownum(int ifile);
 
+void  STREAM_FITRES(void); // out-of-core merge-join (Oct 2026)
+void  stream_open_file(int ifile);
+bool  stream_read_row(int ifile);
+int   stream_cmp_cid(char *cid0, char *cid1);
+int   SKIP_VARNAME_STRING(int ifile, int ivar, char *VARNAME);
+
 void WRITE_YAML(void) ; // for submit_batch only
 bool is_csv_file(char *file_name);
 
@@ -208,6 +229,7 @@ struct INPUTS {
   char VARLIST_KEEP[MXPATHLEN];
 
   int DO_ROWMATCH;
+  int DO_STREAM;  // Oct 2026: out-of-core merge-join
 
 } INPUTS ;
 
@@ -231,6 +253,23 @@ char *ptrSuffix_root  = suffix_root ;
 char *ptrSuffix_text  = suffix_text ;
 bool USEDCID[MXSN];
 
+// Oct 2026: streaming mode holds only the current row of each file
+#define MXCHAR_LINE_STREAM  (40*MXVAR_TOT)
+struct {
+  FILE *FP[MXFFILE];
+  int   GZIPFLAG[MXFFILE];
+  int   NVAR[MXFFILE];           // number of columns per file
+  int   NWD[MXFFILE];            // number of words in current row
+  bool  KEEP[MXFFILE][MXVAR_TOT];// true -> write column to output
+  int   ICAST[MXFFILE][MXVAR_TOT];
+  bool  DONE[MXFFILE];           // true -> reached end of file
+  bool  USED[MXFFILE];           // true -> current row already merged
+  char *LINE[MXFFILE];           // current row
+  char *WORDS[MXFFILE][MXVAR_TOT+1]; // ptr into LINE; [0] is row key
+  char  CID_LAST[MXFFILE][MXSTRLEN]; // to check CID ordering
+  int   IVAR_zHD;                // column index of zHD in 1st file
+} STREAM ;
+
 int IVARSTR_STORE[MXVAR_TOT] ; // keep track of string vars
 int IVAR_zHD;
 
@@ -310,6 +349,12 @@ int main(int argc, char **argv) {
 
   print_banner("Begin Reading Fitres Files.\n");
 
+  if ( INPUTS.DO_STREAM ) {
+    // Oct 2026: read, match and write one row at a time
+    STREAM_FITRES();
+    goto DONE_COMBINE ;
+  }
+
   TABLEFILE_INIT(); // Oct 27 2014
 
   for ( ifile = 0; ifile < INPUTS.NFFILE; ifile++ ) {
@@ -327,6 +372,7 @@ int main(int argc, char **argv) {
 
   WRITE_SNTABLE() ;
 
+ DONE_COMBINE:
   t_end = time(NULL);
   WRITE_YAML() ; // for submit_batch only
 
@@ -407,6 +453,8 @@ void  print_combine_fitres_help(void) {
     " --nullval_float -12345  # override default nullval of -888",
     "",
     "--rowmatch       # force match for each row, regardless of CID",
+    "--stream         # merge-join row-aligned or CID-sorted text files",
+    "                 #   without holding tables in memory",
     0
   };
 
@@ -470,6 +518,7 @@ void  PARSE_ARGV(int argc, char **argv) {
   INPUTS.NVARNAMES_KEEP  = 0 ;
   INPUTS.VARLIST_KEEP[0] = 0 ;
   INPUTS.DO_ROWMATCH     = 0 ;
+  INPUTS.DO_STREAM       = 0 ;
 
   printf("\n Full command: ");
   for ( i = 0; i < NARGV_LIST ; i++ ) {  printf("%s ", argv[i]);   }
@@ -549,6 +598,11 @@ void  PARSE_ARGV(int argc, char **argv) {
       continue ;
     }
 
+    if ( keyarg_match(argv[i],"stream") )  {
+      INPUTS.DO_STREAM = 1;
+      continue ;
+    }
+
     // parse FITRES file(s) and add to INPUTS.FFILE list
     parse_FFILE(argv[i]);
 
@@ -568,6 +622,12 @@ void  PARSE_ARGV(int argc, char **argv) {
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
 
+  if ( INPUTS.DO_STREAM ) {
+    printf("   Stream mode: merge-join one row at a time; text output only.\n");
+    CREATEFILE_HBOOK = CREATEFILE_ROOT = 0 ;
+    CREATEFILE_TEXT  = 1 ;
+  }
+
   // idiot checks for file type
 
 #ifndef USE_ROOT
@@ -696,7 +756,7 @@ void ADD_FITRES(int ifile) {
   bool is_csv ;
   char FFILE[2*MXPATHLEN];
   char *VARNAME, VARNAME_F[MXCHAR_VARNAME], VARNAME_C[MXCHAR_VARNAME] ;
-  char *ptr_CTAG, ccid[60],  cmd[2*MXPATHLEN];
+  char *ptr_CTAG, cmd[2*MXPATHLEN];
   char fnam[] = "ADD_FITRES" ;
 
   // ----------- BEGIN -----------
@@ -880,13 +940,23 @@ void ADD_FITRES(int ifile) {
 
   NMATCH2 = 0 ;
 
+  // Oct 2026: load or match the whole CID column with one call
+  int *ISN_MATCH = NULL ;
+  if ( INPUTS.MATCHFLAG == MATCHFLAG_HASH_UTIL ) {
+    char **CCID_LIST = FITRES_VALUES.STR_TMP[IVARSTR_CCID] ;
+    ISN_MATCH = (int*)malloc( (NLIST2_FITRES+1) * sizeof(int) );
+    if ( ifile == 0 ) {
+      match_cid_hash_load(NLIST2_FITRES, CCID_LIST, 0);
+      for(isn2=0; isn2 < NLIST2_FITRES; isn2++ ) { ISN_MATCH[isn2] = isn2; }
+    }
+    else
+      { match_cid_hash_list(NLIST2_FITRES, CCID_LIST, ISN_MATCH); }
+  }
+
   for(isn2=0; isn2 < NLIST2_FITRES; isn2++ ) {
     
-
-    if ( INPUTS.MATCHFLAG == MATCHFLAG_HASH_UTIL ) {
-      sprintf(ccid, "%s", FITRES_VALUES.STR_TMP[IVARSTR_CCID][isn2]);
-      isn = match_cid_hash(ccid,ifile,isn2);   // isn is for ifile=0
-    }
+    if ( INPUTS.MATCHFLAG == MATCHFLAG_HASH_UTIL ) 
+      { isn = ISN_MATCH[isn2];  }   // isn is for ifile=0
     else 
       { isn = match_CID_orig(ifile,isn2);  }
 
@@ -899,6 +969,7 @@ void ADD_FITRES(int ifile) {
   }
 
   NEVT_MISSING[ifile] = NLIST_FIRST_FITRES - NMATCH2 ;
+  if ( ISN_MATCH != NULL ) { free(ISN_MATCH); }
 
   fflush(stdout);
 
@@ -1018,8 +1089,8 @@ void ADD_FITRES_VARLIST(int ifile, int isn, int isn2) {
       IVARSTR = NVARSTR_FITRES_LAST + ivarstr ;
       IVARSTR_STORE[IVARTOT] = IVARSTR ;
       
-      sprintf(FITRES_VALUES.STR_ALL[IVARSTR][isn],"%s", 
-	      FITRES_VALUES.STR_TMP[ivarstr][isn2] ); 
+      strcpy(FITRES_VALUES.STR_ALL[IVARSTR][isn],
+	     FITRES_VALUES.STR_TMP[ivarstr][isn2] ); 
       
       ivarstr++ ;
     }
@@ -1033,12 +1104,18 @@ void ADD_FITRES_VARLIST(int ifile, int isn, int isn2) {
  
 // =====================================
 int SKIP_VARNAME(int ifile, int ivar) {
+  char *VARNAME = READTABLE_POINTERS.VARNAME[ivar] ;
+  return SKIP_VARNAME_STRING(ifile, ivar, VARNAME);
+} 
+
+int SKIP_VARNAME_STRING(int ifile, int ivar, char *VARNAME) {
 
   // Dec 8 2014
   // Return 1 if this variable should be ignored.
   // Dec 2020: check KEEP_VARNAMES 
+  // Oct 2026: pass VARNAME so that stream mode can use it without
+  //           READTABLE_POINTERS.
 
-  char *VARNAME = READTABLE_POINTERS.VARNAME[ivar] ;
   bool KEEP = false;
   int  j, k ;
 
@@ -1063,7 +1140,7 @@ int SKIP_VARNAME(int ifile, int ivar) {
 
   return(0);
 
-} // end of SKIP_VARNAME
+} // end of SKIP_VARNAME_STRING
 
 
 // ====================================
@@ -1073,16 +1150,15 @@ void freeVar_TMP(int ifile, int NVARTOT, int NVARSTR, int MAXLEN) {
   // Free _TMP arrays so that they can be re-allocated
   // with a different number of variables and SN.
 
-  int ivar, isn ;
+  int ivar ;
 
   for ( ivar=0; ivar < NVARTOT; ivar++ ) {
 
     if ( ivar < NVARSTR ) {
 
-      for ( isn=0; isn < MAXLEN; isn++ ) 
-	{ free(FITRES_VALUES.STR_TMP[ivar][isn]) ; }
-
-      free( FITRES_VALUES.STR_TMP[ivar]  ) ;
+      // all cells point into one block starting at isn=0 (Oct 2026)
+      free( FITRES_VALUES.STR_TMP[ivar][0] ) ;
+      free( FITRES_VALUES.STR_TMP[ivar]    ) ;
     }
 
     free( FITRES_VALUES.FLT_TMP[ivar] ) ;
@@ -1102,8 +1178,11 @@ void  fitres_malloc_flt(int ifile, int NVAR, int MAXLEN) {
   // to store all fitres values.
   // NVAR is the number of variables to read from this fitres file.
   // MAXLEN is an estimate of the max array length to allocate.
+  //
+  // Oct 15 2026: _ALL columns for ifile>0 are indexed by isn of the
+  //   first file, so allocate NLIST_FIRST_FITRES rows (not MAXLEN).
 
-  int ivar, isn, IVAR_ALL, NTOT, MEMF ;
+  int ivar, isn, IVAR_ALL, NTOT, MEMF, MEMF_ALL, MAXLEN_ALL ;
   //  char fnam[] = "fitres_malloc_flt" ;
 
   // ---------- BEGIN ------------
@@ -1115,6 +1194,11 @@ void  fitres_malloc_flt(int ifile, int NVAR, int MAXLEN) {
   MEMF      = (NVAR+1) * sizeof(float*) ;
   FITRES_VALUES.FLT_TMP = (float **)malloc(MEMF) ;
 
+  for ( isn=0; isn < MAXLEN; isn++ ) { USEDCID[isn] = false ; }
+
+  MAXLEN_ALL = MAXLEN ;
+  if ( ifile > 0 ) { MAXLEN_ALL = NLIST_FIRST_FITRES ; }
+
   // -----------------------------------
   NTOT = NVARALL_FITRES + NVAR + 1 ;
   MEMF = sizeof(float*) * NTOT ;
@@ -1127,17 +1211,17 @@ void  fitres_malloc_flt(int ifile, int NVAR, int MAXLEN) {
   
   for ( ivar=0; ivar < NVAR; ivar++ ) {
 
-    MEMF = sizeof(float  ) * MAXLEN ;
+    MEMF     = sizeof(float  ) * MAXLEN ;
+    MEMF_ALL = sizeof(float  ) * MAXLEN_ALL ;
     IVAR_ALL = NVARALL_FITRES + ivar ;
 
     FITRES_VALUES.FLT_TMP[ivar]     = (float  *)malloc(MEMF);
-    FITRES_VALUES.FLT_ALL[IVAR_ALL] = (float  *)malloc(MEMF);    
+    FITRES_VALUES.FLT_ALL[IVAR_ALL] = (float  *)malloc(MEMF_ALL);    
 
-    for ( isn=0; isn < MAXLEN; isn++ ) {
-      USEDCID[isn] = false ;
-      FITRES_VALUES.FLT_TMP[ivar][isn]     = INPUTS.NULLVAL_FLOAT ;
-      FITRES_VALUES.FLT_ALL[IVAR_ALL][isn] = INPUTS.NULLVAL_FLOAT ;
-    }
+    for ( isn=0; isn < MAXLEN; isn++ ) 
+      { FITRES_VALUES.FLT_TMP[ivar][isn]     = INPUTS.NULLVAL_FLOAT ; }
+    for ( isn=0; isn < MAXLEN_ALL; isn++ ) 
+      { FITRES_VALUES.FLT_ALL[IVAR_ALL][isn] = INPUTS.NULLVAL_FLOAT ; }
   }
 
 
@@ -1155,9 +1239,15 @@ void  fitres_malloc_str(int ifile, int NVAR, int MAXLEN) {
   // be there.
   //
   // Apr 27 2020: init STR_ALL and STR_TMP to 'NULL'
+  //
+  // Oct 15 2026: 
+  //  + malloc one contiguous char block per column; cell isn points
+  //    to block + isn*MXSTRLEN. freeVar_TMP frees the block via [0].
+  //  + _ALL columns for ifile>0 use NLIST_FIRST_FITRES rows.
 
   //  char fnam[] = "fitres_malloc_str" ;
-  int ivar, IVAR_ALL, isn, MEMC, NTOT ;
+  int ivar, IVAR_ALL, isn, MEMC, NTOT, MAXLEN_ALL ;
+  char *BLOCK_TMP, *BLOCK_ALL ;
   
   // ---------- BEGIN ------------
 
@@ -1169,6 +1259,9 @@ void  fitres_malloc_str(int ifile, int NVAR, int MAXLEN) {
   MEMC                    = (NVAR+1) * sizeof(char**) ;
   FITRES_VALUES.STR_TMP   = (char***)malloc(MEMC) ; 
 
+  MAXLEN_ALL = MAXLEN ;
+  if ( ifile > 0 ) { MAXLEN_ALL = NLIST_FIRST_FITRES ; }
+
   // -----------------------------------
   NTOT = NVARSTR_FITRES + NVAR + 1 ;
   MEMC = NTOT * sizeof(char**);
@@ -1186,16 +1279,20 @@ void  fitres_malloc_str(int ifile, int NVAR, int MAXLEN) {
     // allocate SN-dimension
     MEMC = sizeof(char*) * MAXLEN ;
     FITRES_VALUES.STR_TMP[ivar]      = (char**)malloc(MEMC);
+    MEMC = sizeof(char*) * MAXLEN_ALL ;
     FITRES_VALUES.STR_ALL[IVAR_ALL]  = (char**)malloc(MEMC);    
 
-    // allocate chars for each string argument
-    MEMC = MXSTRLEN * sizeof(char)  ;
+    // allocate one char block per column for all string cells
+    BLOCK_TMP = (char*)malloc( MAXLEN     * MXSTRLEN * sizeof(char) );
+    BLOCK_ALL = (char*)malloc( MAXLEN_ALL * MXSTRLEN * sizeof(char) );
+
     for ( isn=0; isn < MAXLEN; isn++ ) {
-      FITRES_VALUES.STR_TMP[ivar][isn]     = (char*)malloc(MEMC);
-      FITRES_VALUES.STR_ALL[IVAR_ALL][isn] = (char*)malloc(MEMC);
-      sprintf(FITRES_VALUES.STR_TMP[ivar][isn],"%s"    , DEFAULT_NULLVAL_STRING) ;
-      sprintf(FITRES_VALUES.STR_ALL[IVAR_ALL][isn],"%s", DEFAULT_NULLVAL_STRING) ;
-   
+      FITRES_VALUES.STR_TMP[ivar][isn]     = &BLOCK_TMP[isn*MXSTRLEN] ;
+      strcpy(FITRES_VALUES.STR_TMP[ivar][isn], DEFAULT_NULLVAL_STRING) ;
+    }
+    for ( isn=0; isn < MAXLEN_ALL; isn++ ) {
+      FITRES_VALUES.STR_ALL[IVAR_ALL][isn] = &BLOCK_ALL[isn*MXSTRLEN] ;
+      strcpy(FITRES_VALUES.STR_ALL[IVAR_ALL][isn], DEFAULT_NULLVAL_STRING) ;
     } // isn
   }  // ivar
 
@@ -1263,7 +1360,8 @@ void  print_stats(void) {
 
 
   if ( NFFILE > 1 ) {
-    for(isn=0; isn < NLIST_FIRST_FITRES; isn++ ) {
+    // stream mode counts NEVT_COMMON on the fly
+    for(isn=0; isn < NLIST_FIRST_FITRES && !INPUTS.DO_STREAM; isn++ ) {
       if ( NMATCH_PER_EVT[isn] == NFFILE ) { NEVT_COMMON++; }
     }
     printf("%s NEVT_COMMON: %d  (%d missing in at least one file)\n\n", 
@@ -1617,6 +1715,365 @@ void relabel_rownum(int ifile) {
 } // end relabel_rownum
 
 
+// =========================================
+void STREAM_FITRES(void) {
+
+  // Created Oct 2026
+  // Out-of-core alternative to ADD_FITRES + WRITE_SNTABLE.
+  // Each input file is read one row at a time, and the combined
+  // row is written immediately, so memory does not scale with
+  // table size. Rows are matched by merge-join, which requires
+  // each file to be sorted by CID in the same order as the
+  // first file (integer CIDs compared numerically); with
+  // --rowmatch, rows are matched by position instead.
+  // As with the default mode, the first file defines the list
+  // of events, and unmatched columns are filled with NULL values.
+
+  int  NFFILE = INPUTS.NFFILE ;
+  int  ifile, ivar, isn, NMATCH, ICAST, CIDint, GZIPFLAG = 0;
+  int  NMATCH_FILE[MXFFILE];
+  bool MATCH[MXFFILE], CIDint_EXISTS = false, STOP = false ;
+  double zHD;
+  char OUTFILE[MXPATHLEN], CCIDint[40], *cid0, *cid ;
+  FILE *FP_OUT ;
+  char fnam[] = "STREAM_FITRES" ;
+
+  // --------------- BEGIN ------------
+
+  print_banner("Begin Streaming Fitres Files.\n");
+
+  STREAM.IVAR_zHD = -9 ;
+  for(ifile=0; ifile < NFFILE; ifile++ ) {
+    stream_open_file(ifile);
+    NMATCH_FILE[ifile] = 0 ;
+  }
+
+  if ( INPUTS.DOzCUT && STREAM.IVAR_zHD < 0 ) {
+    sprintf(c1err,"Cannot apply cut on zHD (%.2f to %.2f).",
+	    INPUTS.CUTWIN_zHD[0], INPUTS.CUTWIN_zHD[1] );
+    sprintf(c2err,"Could not find zHD column in %s", INPUTS.FFILE[0]);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  for ( ivar=0; ivar < NVARALL_FITRES; ivar++ ) {
+    if ( strcmp(VARNAME_COMBINE[ivar],"CIDint")==0 ) { CIDint_EXISTS=true; }
+  }
+
+  // open output text file
+  sprintf(OUTFILE, "%s.%s", INPUTS.OUTPREFIX_COMBINE, ptrSuffix_text ); 
+  outFile_text_override(OUTFILE, &GZIPFLAG); 
+  FP_OUT = fopen(OUTFILE, "wt");
+  if ( !FP_OUT ) {
+    sprintf(c1err,"Could not open output file");
+    sprintf(c2err,"%s", OUTFILE);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  fprintf(FP_OUT,"# Created by combine_fitres.exe (--stream) \n");
+  fprintf(FP_OUT,"# Number of combined files: %d \n", NFFILE);
+  for(ifile=0; ifile < NFFILE; ifile++ ) 
+    { fprintf(FP_OUT,"#    + %s \n", INPUTS.FFILE[ifile] ); }
+  fprintf(FP_OUT,"# \n" );
+
+  fprintf(FP_OUT,"VARNAMES: CID");
+  if ( !CIDint_EXISTS ) { fprintf(FP_OUT," CIDint"); }
+  for ( ivar=1; ivar < NVARALL_FITRES; ivar++ ) 
+    { fprintf(FP_OUT," %s", VARNAME_COMBINE[ivar]); }
+  fprintf(FP_OUT," \n#\n");
+
+  printf("   Stream combined table with %d variables to %s\n", 
+	 NVAR_WRITE_COMBINED, OUTFILE );
+  fflush(stdout);
+
+  // - - - - - - - - - - - - - - - - - - - - - -
+  // read 1st file one row at a time
+
+  while ( !STOP && stream_read_row(0) ) {
+
+    isn  = NEVT_READ[0] - 1 ;
+    cid0 = STREAM.WORDS[0][1] ;
+    MATCH[0] = true;  NMATCH = 1;
+
+    for(ifile=1; ifile < NFFILE; ifile++ ) {
+
+      if ( INPUTS.DO_ROWMATCH ) {
+	if ( !stream_read_row(ifile) ) {
+	  sprintf(c1err,"--rowmatch option requires same NSN per file, but");
+	  sprintf(c2err,"ifile=%d ends after %d rows", 
+		  ifile, NEVT_READ[ifile] );
+	  errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+	}
+	MATCH[ifile] = true ;
+      }
+      else {
+	// advance until CID >= CID of 1st file
+	while ( !STREAM.DONE[ifile] ) {
+	  if ( !STREAM.USED[ifile] ) {
+	    cid = STREAM.WORDS[ifile][1] ;
+	    if ( stream_cmp_cid(cid,cid0) >= 0 ) { break; }
+	  }
+	  stream_read_row(ifile);
+	}
+	MATCH[ifile] = ( !STREAM.DONE[ifile] && 
+			 stream_cmp_cid(STREAM.WORDS[ifile][1],cid0) == 0 );
+      }
+
+      if ( MATCH[ifile] ) 
+	{ STREAM.USED[ifile] = true;  NMATCH++ ;  NMATCH_FILE[ifile]++ ; }
+    }
+
+    if ( NMATCH == NFFILE ) { NEVT_COMMON++ ; }
+
+    if ( INPUTS.DOzCUT ) {
+      zHD = atof(STREAM.WORDS[0][STREAM.IVAR_zHD+1]);
+      if ( zHD < INPUTS.CUTWIN_zHD[0] ) { continue ; }
+      if ( zHD > INPUTS.CUTWIN_zHD[1] ) { continue ; }
+    }
+
+    // write combined row
+    fprintf(FP_OUT,"SN: %s", cid0);
+    if ( !CIDint_EXISTS ) {
+      CIDint = atoi(cid0);   sprintf(CCIDint,"%d", CIDint);
+      if ( strcmp(CCIDint,cid0) != 0 ) { CIDint = isn; }
+      fprintf(FP_OUT," %d", CIDint);
+    }
+
+    for(ifile=0; ifile < NFFILE; ifile++ ) {
+      for(ivar=0; ivar < STREAM.NVAR[ifile]; ivar++ ) {
+	if ( !STREAM.KEEP[ifile][ivar] ) { continue; }
+	if ( ifile == 0 && ivar == IVARSTR_CCID ) { continue; }
+	if ( MATCH[ifile] ) 
+	  { fprintf(FP_OUT," %s", STREAM.WORDS[ifile][ivar+1]); }
+	else {
+	  ICAST = STREAM.ICAST[ifile][ivar];
+	  if ( ICAST == ICAST_C ) 
+	    { fprintf(FP_OUT," %s", DEFAULT_NULLVAL_STRING); }
+	  else
+	    { fprintf(FP_OUT," %g", INPUTS.NULLVAL_FLOAT); }
+	}
+      }
+    }
+    fprintf(FP_OUT,"\n");
+    NWRITE_SNTABLE++ ;
+
+    if ( NWRITE_SNTABLE >= INPUTS.MXROW_READ ) {
+      printf("\n\t STOP AFTER WRITING %d ROWS. \n\n", NWRITE_SNTABLE);
+      fflush(stdout);  STOP = true;
+    }
+
+  } // end while
+
+  fclose(FP_OUT);
+
+  // count remaining rows for stats, then close inputs
+  for(ifile=0; ifile < NFFILE; ifile++ ) {
+    while ( !STOP && !STREAM.DONE[ifile] ) { stream_read_row(ifile); }
+    if ( ifile > 0 ) 
+      { NEVT_MISSING[ifile] = NEVT_READ[0] - NMATCH_FILE[ifile]; }
+
+    if ( STREAM.GZIPFLAG[ifile] ) 
+      { pclose(STREAM.FP[ifile]); }
+    else
+      { fclose(STREAM.FP[ifile]); }
+    free(STREAM.LINE[ifile]);
+  }
+
+  NLIST_FIRST_FITRES = NEVT_READ[0];
+
+  if ( GZIPFLAG )  { 
+    char cmd[2*MXPATHLEN];
+    sprintf(cmd,"gzip %s", OUTFILE);
+    system(cmd); 
+  }
+
+  return;
+
+} // end STREAM_FITRES
+
+// =========================================
+void stream_open_file(int ifile) {
+
+  // Created Oct 2026
+  // Open input file for STREAM_FITRES, read header up to VARNAMES,
+  // and append output column names to VARNAME_COMBINE using the
+  // same skip and rename rules as ADD_FITRES.
+
+  char *FFILE = INPUTS.FFILE[ifile] ;
+  char *LINE, *VARNAME, *ptr_CTAG, *tok, *saveptr ;
+  int  ivar, j, NVAR = 0, NTAG_DEJA, OPTMASK_NOFILE = 1 ;
+  bool FOUND_VARNAMES = false ;
+  char varList[MXVAR_TOT][MXCHAR_VARNAME];
+  char fnam[] = "stream_open_file" ;
+
+  // ------------- BEGIN -------------
+
+  if ( is_csv_file(FFILE) ) {
+    sprintf(c1err,"csv input is not supported with --stream");
+    sprintf(c2err,"Check %s", FFILE);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  STREAM.FP[ifile] = open_TEXTgz(FFILE, "rt", OPTMASK_NOFILE,
+				 &STREAM.GZIPFLAG[ifile], fnam);
+  STREAM.LINE[ifile] = (char*)malloc(MXCHAR_LINE_STREAM*sizeof(char));
+  STREAM.DONE[ifile] = false ;
+  STREAM.USED[ifile] = true ;  // force read of first row
+  STREAM.CID_LAST[ifile][0] = 0 ;
+  LINE = STREAM.LINE[ifile] ;
+
+  while ( fgets(LINE, MXCHAR_LINE_STREAM, STREAM.FP[ifile]) != NULL ) {
+    tok = strtok_r(LINE, " \t\n", &saveptr);
+    if ( tok == NULL ) { continue; }
+    if ( strcmp(tok,"VARNAMES:") != 0 ) { continue; }
+
+    while ( (tok = strtok_r(NULL, " \t\n", &saveptr)) != NULL ) {
+      if ( NVAR >= MXVAR_TOT ) {
+	sprintf(c1err,"NVAR exceeds MXVAR_TOT=%d", MXVAR_TOT);
+	sprintf(c2err,"Check %s", FFILE);
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+      }
+      sprintf(varList[NVAR], "%s", tok);   NVAR++ ;
+    }
+    FOUND_VARNAMES = true;  break;
+  }
+
+  if ( !FOUND_VARNAMES ) {
+    sprintf(c1err,"Could not find VARNAMES key");
+    sprintf(c2err,"Check %s", FFILE);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  if ( ICAST_for_textVar(varList[IVARSTR_CCID]) != ICAST_C ) {
+    sprintf(c1err,"Unrecognized first column: %s", varList[IVARSTR_CCID]);
+    sprintf(c2err,"Check %s", FFILE );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err );       
+  }
+
+  STREAM.NVAR[ifile]  = NVAR ;
+  NVARALL_FILE[ifile] = NVAR ;
+  printf("   Stream %s (NVAR=%d) \n", FFILE, NVAR);
+  fflush(stdout);
+
+  // mark first SNANA file
+  for ( ivar=0; ivar < NVAR && IFILE_FIRST_SNANA < 0; ivar++ ) {    
+    for(j=0; j < NVARNAME_1ONLY; j++ ) {
+      if ( strcmp(varList[ivar],VARNAME_1ONLY[j])==0 ) 
+	{  IFILE_FIRST_SNANA = ifile; }	
+    }
+  }
+
+  for ( ivar=0; ivar < NVAR; ivar++ ) {
+    VARNAME = varList[ivar] ;
+    STREAM.ICAST[ifile][ivar] = ICAST_for_textVar(VARNAME);
+    STREAM.KEEP[ifile][ivar]  = false ;
+
+    if ( SKIP_VARNAME_STRING(ifile, ivar, VARNAME) ) { continue ; }
+    if ( ifile > 0 && ivar == IVARSTR_CCID )  { continue ; }
+    if ( ifile == 0 && strcmp(VARNAME,"zHD") == 0 ) 
+      { STREAM.IVAR_zHD = ivar; }
+
+    if ( NVARALL_FITRES >= MXVAR_TOT ) {
+      sprintf(c1err,"NVARALL_COMBINE=%d exceeds bound of", NVARALL_FITRES);
+      sprintf(c2err,"MXVAR_TOT = %d ", MXVAR_TOT ) ;
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+    }      
+
+    STREAM.KEEP[ifile][ivar] = true ;
+    ptr_CTAG = VARNAME_COMBINE[NVARALL_FITRES] ;
+    sprintf(ptr_CTAG, "%s", VARNAME );
+    NTAG_DEJA = NMATCH_VARNAME(ptr_CTAG, NVARALL_FITRES) ;
+    if ( NTAG_DEJA > 0 ) 
+      { sprintf(ptr_CTAG, "%s_%d", VARNAME, ifile+1 ); }
+
+    NVARALL_FITRES++ ;  NVAR_WRITE_COMBINED++ ;
+  }
+
+  return;
+
+} // end stream_open_file
+
+// =========================================
+bool stream_read_row(int ifile) {
+
+  // Created Oct 2026
+  // Read next data row of ifile into STREAM.LINE and split into
+  // STREAM.WORDS. Return false at end of file.
+  // Abort if row has wrong number of words, or if CIDs are not
+  // sorted (unless --rowmatch).
+
+  FILE *FP    = STREAM.FP[ifile] ;
+  char *LINE  = STREAM.LINE[ifile] ;
+  int  NVAR   = STREAM.NVAR[ifile] ;
+  int  NWD ;
+  char *tok, *saveptr ;
+  char fnam[] = "stream_read_row" ;
+
+  // ------------- BEGIN -------------
+
+  if ( STREAM.DONE[ifile] ) { return false; }
+
+  while ( fgets(LINE, MXCHAR_LINE_STREAM, FP) != NULL ) {
+
+    NWD = 0 ;
+    tok = strtok_r(LINE, " \t\n", &saveptr);
+    if ( tok == NULL || tok[0] == '#' ) { continue; }
+    if ( tok[strlen(tok)-1] != ':'    ) { continue; }
+
+    while ( tok != NULL && NWD <= NVAR ) {
+      STREAM.WORDS[ifile][NWD++] = tok ;
+      tok = strtok_r(NULL, " \t\n", &saveptr);
+    }
+
+    if ( NWD != NVAR+1 || tok != NULL ) {
+      sprintf(c1err,"Expected %d values after row key %s", 
+	      NVAR, STREAM.WORDS[ifile][0]);
+      sprintf(c2err,"in row %d of %s", 
+	      NEVT_READ[ifile]+1, INPUTS.FFILE[ifile]);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+    }
+
+    tok = STREAM.WORDS[ifile][1] ; // CID
+    if ( !INPUTS.DO_ROWMATCH && NEVT_READ[ifile] > 0 &&
+	 stream_cmp_cid(tok,STREAM.CID_LAST[ifile]) <= 0 ) {
+      sprintf(c1err,"--stream requires sorted unique CIDs, but CID=%s",
+	      tok);
+      sprintf(c2err,"follows CID=%s in %s", 
+	      STREAM.CID_LAST[ifile], INPUTS.FFILE[ifile]);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+    }
+    sprintf(STREAM.CID_LAST[ifile], "%.*s", MXSTRLEN-1, tok);
+
+    STREAM.NWD[ifile]  = NWD ;
+    STREAM.USED[ifile] = false ;
+    NEVT_READ[ifile]++ ;
+    return true ;
+  }
+
+  STREAM.DONE[ifile] = true ;
+  return false ;
+
+} // end stream_read_row
+
+// =========================================
+int stream_cmp_cid(char *cid0, char *cid1) {
+
+  // Created Oct 2026
+  // Compare CIDs for merge-join: integer CIDs are compared
+  // numerically, otherwise use strcmp. Returns <0, 0, >0.
+
+  char *end0, *end1 ;
+  long long int i0 = strtoll(cid0, &end0, 10);
+  long long int i1 = strtoll(cid1, &end1, 10);
+
+  if ( end0 != cid0 && *end0 == 0 && end1 != cid1 && *end1 == 0 ) 
+    { return ( (i0 > i1) - (i0 < i1) ); }
+
+  return strcmp(cid0, cid1);
+
+} // end stream_cmp_cid
+
+
+
 
 void WRITE_YAML(void) {
   
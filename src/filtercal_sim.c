@@ -21,6 +21,14 @@
   HISTORY
   ~~~~~~~~~~~~~
 
+  Oct 15 2026: 
+    - measured filter curve for each (filter, sigma, step, offset) is
+      computed & rebinned once and reused for all SEDs and redshifts
+      (was re-computed for every SED and redshift).
+    - new input key NTHREAD: <n> distributes (filter,sigma,step)
+      grid points among n pthreads; output order is unchanged.
+    - new input key OUTFILE_FORMAT: BIN writes SNBIN table
+      (sntools_output) instead of text file (default is TEXT).
 
 *****************************************/
 
@@ -31,7 +39,10 @@
 #include <time.h>
 #include <math.h>
 
+#include <pthread.h>
+
 #include "sntools.h"
+#include "sntools_output.h"
 
 // =======================================
 //   declare function prototypes
@@ -51,10 +62,15 @@ void filtercal_rebin(int NBIN, double *ptrlam, double *ptrfun,
 void filtercal_lampspec(void);  // init LAMP spectrum
 
 void open_output(void);
+void write_output(void);
 
 double SYNMAG( double z, double *ptrlam, double *ptrtrans, double *ptrflux );
 
-void MAGEVAL(int ised, int ifilt, int iz, int isig, int istp, int ioff);
+void  filtercal_grid(void);
+void *filtercal_grid_thread(void *arg);
+void  filtercal_task(int itask);
+long  IGRID_MAGDIF(int ised, int ifilt, int iz, int isig, int istp, int ioff);
+long  IGRID_LAMAVG(int ifilt, int isig, int istp, int ioff);
 
 void FILTCAL_CURVE (
 		    int ifilt, 
@@ -76,6 +92,11 @@ void   DUMP_FILTER(int ifilt, int isig, int istp,  double *TRANS_REBIN );
 #define MXLAM_SED    4000  // max # input lambda bins for SED
 #define MXLAMINT    20000  // max # lambda bins for integration
 #define MXBIN         100  // max # bins for Z, LAMSTEP, LAMSIGMA
+#define MXTHREAD_FILTCAL 64  // max # pthreads (Oct 2026)
+
+#define OUTFORMAT_TEXT  1    // OUTFILE_FORMAT: TEXT (default)
+#define OUTFORMAT_BIN   2    // OUTFILE_FORMAT: BIN -> SNBIN table
+#define TABLEID_FILTCAL 7100
 
 // xxx mark #define FNU_AB  3.631E-20 // flat Fnu for AB, erg/cm^2*s*Hz
 
@@ -84,7 +105,6 @@ double GLOBAL_LAMBDA_MAX; //  used to limit SED range that is read
 
 
 FILE *fpout ;
-double  MAGDIF_MAX ;
 
 
 struct INPUTS {
@@ -118,6 +138,9 @@ struct INPUTS {
 
   int LAMINT_BINSIZE ;   // integration bin-size (A)
 
+  int NTHREAD ;          // number of pthreads for grid (Oct 2026)
+  int OUTFORMAT ;        // OUTFORMAT_TEXT or OUTFORMAT_BIN
+
 
   // redshift range & binning
   float REDSHIFT_RANGE[2] ;
@@ -177,12 +200,30 @@ struct SED {
 } SED[MXSEDCAL] ;
 
 
+// Oct 2026: results for full grid. Each task is one (ifilt,isig,istp);
+// all offsets, SEDs and redshifts for a task are computed with the
+// same measured filter curves. Output is written after all tasks
+// are done, in the legacy (ised,ifilt,iz,isig,istp,ioff) order.
+struct {
+  int     NTASK, ITASK_NEXT ;
+  pthread_mutex_t MUTEX ;
+  double *MAGDIF ;   // see IGRID_MAGDIF
+  double *LAM_AVG ;  // see IGRID_LAMAVG
+} FILTCAL_GRID ;
+
+// one output row for OUTFILE_FORMAT: BIN
+struct {
+  int   IFILT, ISED ;
+  float Z, LAMSIGMA, LAMSTEP, LAMOFF, LAMAVG, MAGDIF ;
+} FILTCAL_ROW ;
+
+
 
 
 // ******************************************
 int main(int argc, char **argv) {
 
-  int i, ifilt, ised, iz, ioff, isig, istp, NBIN ;
+  int i, ifilt, ised, iz, NBIN ;
   //  char fnam[] = "main" ;
 
   double *ptrlam, *ptrfun, *ptrfun_integ ;
@@ -283,34 +324,12 @@ int main(int argc, char **argv) {
   printf("\n");
 
   // -----------------------------------------------------------
-  // BIG LOOP over each filter, sed & filter-calib properties
-
-  for ( ised=1; ised <= INPUTS.NSED; ised++ ) {
-    for ( ifilt=1; ifilt <= INPUTS.NFILT; ifilt++ ) {
-
-      printf("   Process filtercal for %s-%s  Z = ",
-	     INPUTS.sedName[ised], INPUTS.filterName[ifilt] );
-
-      for ( iz=1; iz <= INPUTS.NBIN_REDSHIFT; iz++ ) {
+  // evaluate each filter, sed & filter-calib properties,
+  // then write results
 
-	printf(" %4.2f", INPUTS.ARRAY_REDSHIFT[iz] ); 
-	fflush(stdout);
+  filtercal_grid();
 
-	for ( isig=1; isig <= INPUTS.NBIN_LAMCAL_SIGMA; isig++ ) {
-	  for ( istp=1; istp <= INPUTS.NBIN_LAMCAL_STEP;  istp++ ) {
-	    for ( ioff=1; ioff <= INPUTS.NBIN_LAMCAL_OFFSETFRAC+1; ioff++ ) {
-
-	      MAGEVAL(ised,ifilt,iz,isig,istp,ioff);
-
-	    }// LAM OFFSET-FRAC
-	  }  // LAM STEP
-	}   // LAM SIGMA
-      }     // REDSHIFT
-
-        printf("\n");
-
-    }       // filter
-  }         // SED
+  write_output();
 
 
   filtercal_end();
@@ -357,6 +376,9 @@ void filtercal_init(void) {
 
   INPUTS.NDUMP_FILTER = 0;
 
+  INPUTS.NTHREAD   = 1 ;
+  INPUTS.OUTFORMAT = OUTFORMAT_TEXT ;
+
   sprintf(INPUTS.inputFile, "NULL" );
   sprintf(INPUTS.outFile,   "filtercal_sim.out" );
 
@@ -374,7 +396,10 @@ void filtercal_init(void) {
 // ****************************
 void filtercal_end(void) {
 
-  fclose(fpout);
+  if ( INPUTS.OUTFORMAT == OUTFORMAT_BIN ) 
+    { TABLEFILE_CLOSE(INPUTS.outFile); }
+  else
+    { fclose(fpout); }
 
   printf("\n GRACEFULL FINISH.  \n");
   printf(" Results written to   %s \n", INPUTS.outFile );
@@ -389,7 +414,7 @@ void  read_input(void) {
   char *ptrFile ;
   char fnam[] = "read_input";
 
-  char c_get[60];
+  char c_get[60], c_format[60];
   int N;
 
   // -------- BEGIN --------
@@ -439,6 +464,30 @@ void  read_input(void) {
     if ( strcmp(c_get,"OUTFILE:") == 0 )
       readchar(fp, INPUTS.outFile );
 
+    if ( strcmp(c_get,"OUTFILE_FORMAT:") == 0 ) {
+      readchar(fp, c_format );
+      if ( strcmp(c_format,"TEXT") == 0 ) 
+	{ INPUTS.OUTFORMAT = OUTFORMAT_TEXT ; }
+      else if ( strcmp(c_format,"BIN") == 0 ) 
+	{ INPUTS.OUTFORMAT = OUTFORMAT_BIN ; }
+      else {
+	sprintf(c1err,"Invalid OUTFILE_FORMAT: %s", c_format);
+	sprintf(c2err,"Valid formats are TEXT and BIN");
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+      }
+    }
+
+    if ( strcmp(c_get,"NTHREAD:") == 0 ) {
+      readint ( fp, 1, &INPUTS.NTHREAD );
+      if ( INPUTS.NTHREAD < 1 ) { INPUTS.NTHREAD = 1; }
+      if ( INPUTS.NTHREAD > MXTHREAD_FILTCAL ) {
+	sprintf(c1err,"NTHREAD=%d exceeds bound of %d", 
+		INPUTS.NTHREAD, MXTHREAD_FILTCAL);
+	sprintf(c2err,"Reduce NTHREAD in input file.");
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+      }
+    }
+
     if ( strcmp(c_get,"LAMCAL_SIGMA_RANGE:") == 0 )
       readint ( fp, 2, INPUTS.LAMCAL_SIGMA_RANGE );
 
@@ -759,7 +808,30 @@ void open_output(void) {
 
   // open standard output file
   cout  = INPUTS.outFile ;
-  fpout = fopen(cout, "wt");
+  if ( INPUTS.OUTFORMAT == OUTFORMAT_BIN ) {
+    // Oct 2026: binary table with same columns as text file
+    TABLEFILE_INIT();
+    TABLEFILE_OPEN(cout, "new bin");
+    SNTABLE_CREATE(TABLEID_FILTCAL, "FILTCAL", "KEY");
+    SNTABLE_ADDCOL(TABLEID_FILTCAL, "VAR", &FILTCAL_ROW.IFILT, 
+		   "IFILT:I",    1);
+    SNTABLE_ADDCOL(TABLEID_FILTCAL, "VAR", &FILTCAL_ROW.ISED, 
+		   "ISED:I",     1);
+    SNTABLE_ADDCOL(TABLEID_FILTCAL, "VAR", &FILTCAL_ROW.Z, 
+		   "Z:F",        1);
+    SNTABLE_ADDCOL(TABLEID_FILTCAL, "VAR", &FILTCAL_ROW.LAMSIGMA, 
+		   "LAMSIGMA:F", 1);
+    SNTABLE_ADDCOL(TABLEID_FILTCAL, "VAR", &FILTCAL_ROW.LAMSTEP, 
+		   "LAMSTEP:F",  1);
+    SNTABLE_ADDCOL(TABLEID_FILTCAL, "VAR", &FILTCAL_ROW.LAMOFF, 
+		   "LAMOFF:F",   1);
+    SNTABLE_ADDCOL(TABLEID_FILTCAL, "VAR", &FILTCAL_ROW.LAMAVG, 
+		   "LAMAVG:F",   1);
+    SNTABLE_ADDCOL(TABLEID_FILTCAL, "VAR", &FILTCAL_ROW.MAGDIF, 
+		   "MAGDIF:F",   1);
+  }
+  else
+    { fpout = fopen(cout, "wt"); }
 
   // open readme file and write relevant info
 
@@ -1054,15 +1126,110 @@ double SYNMAG( double z, double *ptrlam, double *ptrtrans, double *ptrflux ) {
 } // end of SYNMAG
 
 // ****************************************************************
-void MAGEVAL(int ised, int ifilt, int iz, int isig, int istp, int ioff) {
+void filtercal_grid(void) {
+
+  // Created Oct 2026
+  // Evaluate mag-shifts for full grid. Replaces legacy loop in main
+  // that called MAGEVAL for each (ised,ifilt,iz,isig,istp,ioff) and
+  // re-computed the measured filter curve for each SED and redshift.
+  // Each (ifilt,isig,istp) is a task; for NTHREAD > 1 the tasks are
+  // distributed among pthreads that each grab the next task.
+
+  int  NTHREAD = INPUTS.NTHREAD ;
+  int  NOFF    = INPUTS.NBIN_LAMCAL_OFFSETFRAC ;
+  int  NSIG    = INPUTS.NBIN_LAMCAL_SIGMA ;
+  int  NSTP    = INPUTS.NBIN_LAMCAL_STEP ;
+  long NMAGDIF, NLAMAVG ;
+  int  itask, t, rc ;
+  pthread_t THREAD[MXTHREAD_FILTCAL];
+  char fnam[] = "filtercal_grid" ;
+
+  // --------- BEGIN ----------
+
+  FILTCAL_GRID.NTASK = INPUTS.NFILT * NSIG * NSTP ;
+
+  NLAMAVG = (long)FILTCAL_GRID.NTASK * (long)NOFF ;
+  NMAGDIF = NLAMAVG * (long)INPUTS.NSED * (long)INPUTS.NBIN_REDSHIFT ;
+  FILTCAL_GRID.MAGDIF  = (double*)malloc(NMAGDIF * sizeof(double) );
+  FILTCAL_GRID.LAM_AVG = (double*)malloc(NLAMAVG * sizeof(double) );
+  if ( FILTCAL_GRID.MAGDIF == NULL || FILTCAL_GRID.LAM_AVG == NULL ) {
+    sprintf(c1err,"Cannot malloc grid with %ld mag-shifts", NMAGDIF);
+    sprintf(c2err,"Reduce size of LAMCAL or REDSHIFT grid.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  printf("   Process filtercal for %d (filter,sigma,step) grid points "
+	 "with %d thread(s)\n", FILTCAL_GRID.NTASK, NTHREAD );
+  fflush(stdout);
+
+  if ( NTHREAD == 1 ) {
+    for(itask=0; itask < FILTCAL_GRID.NTASK; itask++ ) 
+      { filtercal_task(itask); }
+    return ;
+  }
+
+  FILTCAL_GRID.ITASK_NEXT = 0 ;
+  pthread_mutex_init(&FILTCAL_GRID.MUTEX, NULL);
+
+  for(t=0; t < NTHREAD; t++ ) {
+    rc = pthread_create(&THREAD[t], NULL, filtercal_grid_thread, NULL);
+    if ( rc != 0 ) {
+      sprintf(c1err,"pthread_create returns errcode=%d for t=%d", rc, t);
+      sprintf(c2err,"Try smaller NTHREAD");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+  }
+  for(t=0; t < NTHREAD; t++ ) { pthread_join(THREAD[t], NULL); }
+
+  pthread_mutex_destroy(&FILTCAL_GRID.MUTEX);
+
+  return ;
+
+} // end filtercal_grid
+
+
+// ****************************************************************
+void *filtercal_grid_thread(void *arg) {
+
+  // Created Oct 2026: pthread worker; grab next task until none left.
+
+  int itask ;
+
+  // --------- BEGIN ----------
+
+  while ( 1 ) {
+    pthread_mutex_lock(&FILTCAL_GRID.MUTEX);
+    itask = FILTCAL_GRID.ITASK_NEXT++ ;
+    pthread_mutex_unlock(&FILTCAL_GRID.MUTEX);
+    if ( itask >= FILTCAL_GRID.NTASK ) { break; }
+    filtercal_task(itask);
+  }
+
+  return NULL;
+
+} // end filtercal_grid_thread
+
+
+// ****************************************************************
+void filtercal_task(int itask) {
 
   /****
-   Use input indices to extract parameters for measuring
-   filter response and measuring synthetic mag.
+   Created Oct 2026 [code moved from MAGEVAL]
+   For grid task 'itask' -> (ifilt,isig,istp), loop over offsets and
+   measure filter response, rebin it, and then use the same measured 
+   curve to compute synthetic mag for each SED and redshift.
+   Results are stored in FILTCAL_GRID; only globals that are fixed
+   after init are read here, so that tasks can run in parallel.
   ***/
 
+  int NSIG = INPUTS.NBIN_LAMCAL_SIGMA ;
+  int NSTP = INPUTS.NBIN_LAMCAL_STEP ;
+  int NOFF = INPUTS.NBIN_LAMCAL_OFFSETFRAC ;
+  int istp  = itask % NSTP + 1 ;
+  int isig  = (itask / NSTP) % NSIG + 1 ;
+  int ifilt = itask / (NSTP*NSIG) + 1 ;
 
-  int       NBIN_FILTCAL    ;
+  int       NBIN_FILTCAL, ioff, ised, iz ;
 
   double 
     Z
@@ -1072,77 +1239,146 @@ void MAGEVAL(int ised, int ifilt, int iz, int isig, int istp, int ioff) {
     ,LAM_SIGMA
     ,LAM_STEP
     ,LAM_AVG
-    ,mag, magdif, absmagdif, magref
+    ,mag, magref
     ,FILTCAL_LAMBDA[MXLAM_FILT]
     ,FILTCAL_TRANS[MXLAM_FILT]
     ,FILTCAL_REBIN[MXLAMINT]
-    , *ptrlam
-    , *ptrtrans
-    , *ptrflux 
     ;
 
   // --------- BEGIN ---------
 
-
-  Z          = INPUTS.ARRAY_REDSHIFT[iz];
-  OFFSETFRAC = INPUTS.ARRAY_LAMOFFSETFRAC[ioff];
   LAM_SIGMA  = INPUTS.ARRAY_LAMSIGMA[isig];
   LAM_STEP   = INPUTS.ARRAY_LAMSTEP[istp];
-  LAM_OFF    = OFFSETFRAC * LAM_STEP ;
-  LAM_START  = FILTER[ifilt].LAMBDA_MEAN + LAM_OFF ;
 
-  // check special ioff bin that means to store max magdif
-  if ( ioff == 1 )  MAGDIF_MAX = 0.0 ;
+  for ( ioff=1; ioff <= NOFF; ioff++ ) {
 
-  if (  ioff == INPUTS.NBIN_LAMCAL_OFFSETFRAC+1 ) {
-    LAM_OFF  = OFFSETFRAC ;
-    magdif   = MAGDIF_MAX ;
-    goto UPDATE_OUTFILE ;
-  }
+    OFFSETFRAC = INPUTS.ARRAY_LAMOFFSETFRAC[ioff];
+    LAM_OFF    = OFFSETFRAC * LAM_STEP ;
+    LAM_START  = FILTER[ifilt].LAMBDA_MEAN + LAM_OFF ;
 
-  FILTCAL_CURVE(ifilt, LAM_STEP, LAM_SIGMA, LAM_START           // inputs
-		,&NBIN_FILTCAL    // (O) Number of filter bin
-		,FILTCAL_LAMBDA   // (O) array of lambdas
-		,FILTCAL_TRANS    // (O) array of transmission
-		,&LAM_AVG );      // (O) average lambda
+    FILTCAL_CURVE(ifilt, LAM_STEP, LAM_SIGMA, LAM_START     // inputs
+		  ,&NBIN_FILTCAL    // (O) Number of filter bin
+		  ,FILTCAL_LAMBDA   // (O) array of lambdas
+		  ,FILTCAL_TRANS    // (O) array of transmission
+		  ,&LAM_AVG );      // (O) average lambda
 
-  /***
-  for ( i=0; i < NBIN_FILTCAL;  i++ ) {
-    printf(" xxxxx  FILTER_CURVE point %2d LAM=%6.0f  TRANS=%6.3f \n",
-	   i, FILTCAL_LAMBDA[i], FILTCAL_TRANS[i] );
-  }
-  ***/
+    // rebin measured curve to prepare for integration
+    filtercal_rebin(NBIN_FILTCAL, FILTCAL_LAMBDA, FILTCAL_TRANS, // inputs 
+		    FILTCAL_REBIN );  // output
+
+    FILTCAL_GRID.LAM_AVG[IGRID_LAMAVG(ifilt,isig,istp,ioff)] = LAM_AVG ;
+
+    // check for filter dump
+    if ( ioff == 1 ) { DUMP_FILTER ( ifilt, isig, istp, FILTCAL_REBIN ); }
 
-  // rebin measured curve to prepare for integration
+    // use measured curve to compute synthetic mag for each SED & z
+    for ( ised=1; ised <= INPUTS.NSED; ised++ ) {
+      for ( iz=1; iz <= INPUTS.NBIN_REDSHIFT; iz++ ) {
+	Z      = INPUTS.ARRAY_REDSHIFT[iz];
+	mag    = SYNMAG( Z, LAMBDA_INTEG, FILTCAL_REBIN, 
+			 SED[ised].FLUX_INTEG );
+	magref = MAGREF[ifilt][ised][iz] ;
+	FILTCAL_GRID.MAGDIF[IGRID_MAGDIF(ised,ifilt,iz,isig,istp,ioff)] 
+	  = mag - magref ;
+      }
+    }
 
-  filtercal_rebin(NBIN_FILTCAL, FILTCAL_LAMBDA, FILTCAL_TRANS,  // inputs 
-		  FILTCAL_REBIN );  // output
+  } // end ioff
 
-  // use measured curve to compute synthetic mag for this SED
+} // end of filtercal_task
 
-  ptrlam   = LAMBDA_INTEG ;
-  ptrtrans = FILTCAL_REBIN ;
-  ptrflux  = SED[ised].FLUX_INTEG ;
- 
-  mag    = SYNMAG( Z, ptrlam, ptrtrans, ptrflux );
-  magref = MAGREF[ifilt][ised][iz] ;
-  magdif = mag - magref ;
 
-  absmagdif = fabs(magdif) ;
-  if ( absmagdif > MAGDIF_MAX )  MAGDIF_MAX = absmagdif ;
+// ****************************************************************
+long IGRID_MAGDIF(int ised, int ifilt, int iz, int isig, int istp, int ioff) {
+  // Created Oct 2026: index for FILTCAL_GRID.MAGDIF; inputs start at 1.
+  long i = IGRID_LAMAVG(ifilt,isig,istp,ioff) ;
+  i = i * (long)INPUTS.NSED          + (long)(ised-1) ;
+  i = i * (long)INPUTS.NBIN_REDSHIFT + (long)(iz-1) ;
+  return i ;
+} // end IGRID_MAGDIF
+
+long IGRID_LAMAVG(int ifilt, int isig, int istp, int ioff) {
+  // Created Oct 2026: index for FILTCAL_GRID.LAM_AVG; inputs start at 1.
+  long i = (long)(ifilt-1) ;
+  i = i * (long)INPUTS.NBIN_LAMCAL_SIGMA      + (long)(isig-1) ;
+  i = i * (long)INPUTS.NBIN_LAMCAL_STEP       + (long)(istp-1) ;
+  i = i * (long)INPUTS.NBIN_LAMCAL_OFFSETFRAC + (long)(ioff-1) ;
+  return i ;
+} // end IGRID_LAMAVG
+
 
- UPDATE_OUTFILE:
+// ****************************************************************
+void write_output(void) {
+
+  /****
+   Created Oct 2026 [code moved from MAGEVAL]
+   Write FILTCAL_GRID results in legacy order. For each
+   (ised,ifilt,iz,isig,istp), the extra offset bin NOFF+1 
+   stores the max |magdif| over all offsets.
+  ***/
 
-  fprintf(fpout,"%2d  %2d  %4.2f  %4.0f  %4.0f  %4.0f %6.0f %7.4f \n"
-	  ,ifilt, ised, Z, LAM_SIGMA, LAM_STEP, LAM_OFF, LAM_AVG, magdif );
+  int NOFF = INPUTS.NBIN_LAMCAL_OFFSETFRAC ;
+  int ised, ifilt, iz, isig, istp, ioff ;
+  double Z, LAM_SIGMA, LAM_STEP, LAM_OFF, LAM_AVG=0.0 ;
+  double magdif, absmagdif, MAGDIF_MAX ;
 
+  // --------- BEGIN ---------
 
-  // check for filter dump
-  if ( iz == 1 && ised == 1 && ioff == 1 ) 
-    DUMP_FILTER ( ifilt, isig, istp, ptrtrans );
+  for ( ised=1; ised <= INPUTS.NSED; ised++ ) {
+    for ( ifilt=1; ifilt <= INPUTS.NFILT; ifilt++ ) {
+      for ( iz=1; iz <= INPUTS.NBIN_REDSHIFT; iz++ ) {
+	Z = INPUTS.ARRAY_REDSHIFT[iz];
+	for ( isig=1; isig <= INPUTS.NBIN_LAMCAL_SIGMA; isig++ ) {
+	  LAM_SIGMA = INPUTS.ARRAY_LAMSIGMA[isig];
+	  for ( istp=1; istp <= INPUTS.NBIN_LAMCAL_STEP;  istp++ ) {
+	    LAM_STEP   = INPUTS.ARRAY_LAMSTEP[istp];
+	    MAGDIF_MAX = 0.0 ;
+	    for ( ioff=1; ioff <= NOFF+1; ioff++ ) {
+
+	      if ( ioff <= NOFF ) {
+		LAM_OFF = INPUTS.ARRAY_LAMOFFSETFRAC[ioff] * LAM_STEP ;
+		LAM_AVG = 
+		  FILTCAL_GRID.LAM_AVG[IGRID_LAMAVG(ifilt,isig,istp,ioff)];
+		magdif  = FILTCAL_GRID.MAGDIF
+		  [IGRID_MAGDIF(ised,ifilt,iz,isig,istp,ioff)];
+		absmagdif = fabs(magdif) ;
+		if ( absmagdif > MAGDIF_MAX )  MAGDIF_MAX = absmagdif ;
+	      }
+	      else {
+		// special ioff bin to store max magdif
+		LAM_OFF  = INPUTS.ARRAY_LAMOFFSETFRAC[ioff] ;
+		magdif   = MAGDIF_MAX ;
+	      }
+
+	      if ( INPUTS.OUTFORMAT == OUTFORMAT_BIN ) {
+		FILTCAL_ROW.IFILT    = ifilt ;
+		FILTCAL_ROW.ISED     = ised ;
+		FILTCAL_ROW.Z        = (float)Z ;
+		FILTCAL_ROW.LAMSIGMA = (float)LAM_SIGMA ;
+		FILTCAL_ROW.LAMSTEP  = (float)LAM_STEP ;
+		FILTCAL_ROW.LAMOFF   = (float)LAM_OFF ;
+		FILTCAL_ROW.LAMAVG   = (float)LAM_AVG ;
+		FILTCAL_ROW.MAGDIF   = (float)magdif ;
+		SNTABLE_FILL(TABLEID_FILTCAL);
+	      }
+	      else {
+		fprintf(fpout,
+			"%2d  %2d  %4.2f  %4.0f  %4.0f  %4.0f %6.0f %7.4f \n"
+			,ifilt, ised, Z, LAM_SIGMA, LAM_STEP, LAM_OFF, 
+			LAM_AVG, magdif );
+	      }
+
+	    }// LAM OFFSET-FRAC
+	  }  // LAM STEP
+	}   // LAM SIGMA
+      }     // REDSHIFT
+    }       // filter
+  }         // SED
 
+  free(FILTCAL_GRID.MAGDIF);
+  free(FILTCAL_GRID.LAM_AVG);
 
-} // end of MAGEVAL
+} // end of write_output
 
 
 // ************************************************
@@ -30,6 +30,9 @@ Each sample counts as 0.01 seconds.
 
   Oct 29 2025 RK - 2D error map model is now default; impacts LC fitting (no impact on sim)
 
+  Oct 15 2026 - genmag_BAYESN: dgemm for spline basis over all filter
+                wavelengths & epochs; no per-element GSL accessors.
+
 ********************************************/
 
 #include "stdio.h"
@@ -677,6 +680,10 @@ void genmag_BAYESN(
   //
   //  Jul 28 2025:  pass parList_HOST which contains duplicate AV and RV.
   //    RK           Later should perhaps remove AV,RV from parList_SN.
+  //
+  //  Oct 15 2026:  replace per-wavelength gsl_blas_dgemv with one cblas
+  //                dgemm over the J_lam rows in the filter; W and WJ are
+  //                raw arrays, and S0 day-interp is computed once per obs.
 
   double DLMAG   = parList_SN[0] ;
   double THETA   = parList_SN[1] ;
@@ -686,7 +693,7 @@ void genmag_BAYESN(
   int      OPT_COLORLAW     = MWXT_SEDMODEL.OPT_COLORLAW;
   double * PARLIST_COLORLAW = MWXT_SEDMODEL.PARLIST_COLORLAW;
   double   z1, meanlam_obs, meanlam_rest, ZP, PARDUM=0.0 ; 
-  double   t0, t1, f0, f1, flux ;
+  double   t0, t1, f0, f1 ;
 
   int      MEMD        = sizeof(double)*Nobs;
   double * flux_list   = malloc(MEMD); // RK
@@ -697,13 +704,13 @@ void genmag_BAYESN(
   char   * cfilt ;
   int      ifilt = 0, i, o ; 
   
-  // allocate matrices for the spline operations
-  gsl_vector_view j_lam;
+  // allocate matrices for the spline operations; W and WJ are
+  // contiguous row-major arrays for cblas (Oct 2026)
   gsl_matrix    * J_tau;
-  gsl_matrix    * W   = gsl_matrix_alloc(BAYESN_MODEL_INFO.n_lam_knots,
-					 BAYESN_MODEL_INFO.n_tau_knots);
-  gsl_matrix    * WJ  = gsl_matrix_alloc(BAYESN_MODEL_INFO.n_lam_knots, Nobs);
-  gsl_vector    * jWJ = gsl_vector_alloc(Nobs);
+  double        * W   = malloc(sizeof(double) * BAYESN_MODEL_INFO.n_lam_knots *
+			       BAYESN_MODEL_INFO.n_tau_knots);
+  double        * WJ  = malloc(sizeof(double) * BAYESN_MODEL_INFO.n_lam_knots *
+			       Nobs);
   
   int     nlam_filt, ilam_filt;
   int     nday_model, nlam_model, ilam_model_blue, ilam_model_red ;
@@ -781,34 +788,70 @@ void genmag_BAYESN(
 			    BAYESN_MODEL_INFO.tau_knots, BAYESN_MODEL_INFO.KD_tau, 
                 TIME_EXTRAP_MODE_BAYESN/OPTMASK_BAYESN_TIME_EXTRAP_0);
 
-  // compute W0 + THETA*W1 + EPSILON
+  // compute W0 + THETA*W1 + EPSILON on raw arrays (Oct 2026)
   int wx, wy;
   int nx = BAYESN_MODEL_INFO.n_lam_knots;
   int ny = BAYESN_MODEL_INFO.n_tau_knots;
+  gsl_matrix *W0 = BAYESN_MODEL_INFO.W0 ;
+  gsl_matrix *W1 = BAYESN_MODEL_INFO.W1 ;
+  gsl_matrix *EP = BAYESN_MODEL_INFO.EPSILON ;
   for (wx=0; wx < nx; wx++) {
     for (wy=0; wy < ny; wy++) {
-      double W0_val = gsl_matrix_get(BAYESN_MODEL_INFO.W0, wx, wy) ;
-      double W1_val = gsl_matrix_get(BAYESN_MODEL_INFO.W1, wx, wy) ;
-      double EP_val = gsl_matrix_get(BAYESN_MODEL_INFO.EPSILON, wx, wy);
-      double W_val  = W0_val + THETA * W1_val + EP_val;
-      gsl_matrix_set(W, wx,wy, W_val);
+      W[wx*ny + wy] = W0->data[wx*W0->tda + wy] 
+	+ THETA * W1->data[wx*W1->tda + wy] 
+	+ EP->data[wx*EP->tda + wy] ;
     }
   }
 
-  // compute W * J_tau^T
-  gsl_matrix_set_zero(WJ);
-  gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, W, J_tau, 0.0, WJ);
+  // compute W * J_tau^T  (nx x Nobs)
+  cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasTrans, nx, Nobs, ny,
+	      1.0, W, ny, J_tau->data, J_tau->tda, 0.0, WJ, Nobs);
+
+  // j_lam * W * J_tau^T for all model wavelengths in the filter:
+  // one dgemm with the block of J_lam rows [ilam_model_blue,red)
+  int this_nlam = ilam_model_red - ilam_model_blue ;
+  double *jWJ = NULL ;
+  if ( this_nlam > 0 ) {
+    gsl_matrix *J_lam = BAYESN_MODEL_INFO.J_lam ;
+    jWJ = malloc(sizeof(double) * this_nlam * Nobs);
+    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, 
+		this_nlam, Nobs, nx,
+		1.0, &J_lam->data[ilam_model_blue*J_lam->tda], J_lam->tda, 
+		WJ, Nobs, 0.0, jWJ, Nobs);
+  }
+
+  // day index and interp weights for each obs; independent of lambda.
+  int     q_day ;
+  int    *q_day_list = malloc(sizeof(int)*Nobs) ;
+  double *wday_list  = malloc(MEMD) ;
+  for (o = 0; o < Nobs; o++) {
+    q_day_list[o] = -9 ;  wday_list[o] = 0.0 ;
+
+    // compute day index instead of brute force search (RK)
+    dday_tmp = Trest_list[o] - day_model_array[0] ;
+    if ( dday_tmp < 0.0 ) 
+      { preexp_flag[o] = true;  continue; } // ST - zero flux pre-explosion
+    
+    q_day = (int)( dday_tmp / daystep_model) + 1;
+    if ( q_day >= BAYESN_MODEL_INFO.S0.NDAY ) // RK
+      { extrap_flag[o] = true;  continue; } // ST - undefined beyond Hsiao
+
+    t1 = BAYESN_MODEL_INFO.S0.DAY[q_day];
+    t0 = BAYESN_MODEL_INFO.S0.DAY[q_day-1];
+    q_day_list[o] = q_day ;
+    wday_list[o]  = (Trest_list[o] - t0)/(t1 - t0) ;
+  }
   
   // interpolate the filter wavelengths on to the model in the observer frame
   // usually this is OK because the filters are more coarsely defined than the model
   // that may not be the case with future surveys and we should revisit
-  int    this_nlam  = ilam_model_red - ilam_model_blue + 1;
   int    OPT_INTERP = 1 ;         // 1=linear, 2=quadratic
-  int    q_lam, q_day;
+  int    q_lam;
   double this_lam, lam_model ;
-  double this_trans, tr0, tr1, frac ;
+  double this_trans, tr0, tr1, frac, flux_lam ;
   double eA_lam_MW, eA_lam_host ; // store MW and host dust law at current wl
-  double eW, S0_lam ;             // store other SED  bits
+  double eW, S0_lam, *jWJ_row ;   // store other SED  bits
+  double *S0_FLUX = BAYESN_MODEL_INFO.S0.FLUX ;
   
   // loop over model wavelengths within the filter
   for (q_lam = ilam_model_blue; q_lam < ilam_model_red; q_lam++) {
@@ -837,10 +880,7 @@ void genmag_BAYESN(
       this_trans = trans_filt_array[ilam_filt];
     }
       
-    // j_lam * W * J_tau^T
-    gsl_vector_set_zero(jWJ);
-    j_lam = gsl_matrix_row(BAYESN_MODEL_INFO.J_lam, q_lam);
-    gsl_blas_dgemv(CblasTrans, 1.0, WJ, &j_lam.vector, 0.0, jWJ);
+    jWJ_row = &jWJ[(q_lam-ilam_model_blue)*Nobs] ;
     
     // get MW extinction
     if ( USE_TABLE_XTMW  ) {
@@ -861,45 +901,31 @@ void genmag_BAYESN(
 				     ,OPT_COLORLAW, PARLIST_COLORLAW, fnam);
       eA_lam_host       = pow(10.0, -0.4*XTMAG_host);
     }
+
+    flux_lam = this_trans * this_lam * lamstep_model * eA_lam_MW * eA_lam_host;
     
     // loop over observations and accumulate the contribution of the
     // current wavelength to the fluxof each observation
     for (o = 0; o < Nobs; o++) {
-      eW = pow(10.0, -0.4*gsl_vector_get(jWJ, o));
-      
-      // compute day index instead of brute force search (RK)
-      dday_tmp = Trest_list[o] - day_model_array[0] ;
-      if ( dday_tmp >= 0.0 ) {
-	q_day = (int)( dday_tmp / daystep_model) + 1;
-      } else {
-	preexp_flag[o] = true;
-	continue;
-      } // ST - updated logic to add zero flux at pre-explosion 
-      
-      if ( q_day >= BAYESN_MODEL_INFO.S0.NDAY ) { // RK
-	extrap_flag[o] = true;
-	continue;
-      } // ST - update logic to give undefined mag beyond Hsiao
-      
-      t1 = BAYESN_MODEL_INFO.S0.DAY[q_day];
-      t0 = BAYESN_MODEL_INFO.S0.DAY[q_day-1];
-      f1 = BAYESN_MODEL_INFO.S0.FLUX[nlam_model*q_day + q_lam];
-      f0 = BAYESN_MODEL_INFO.S0.FLUX[nlam_model*(q_day-1) + q_lam];
+      q_day = q_day_list[o];
+      if ( q_day < 0 ) { continue; } // pre-explosion or beyond Hsiao
       
-      S0_lam = (f0*(t1 - Trest_list[o]) + f1*(Trest_list[o] - t0))/(t1 - t0);
+      eW = pow(10.0, -0.4*jWJ_row[o]);
+      f1 = S0_FLUX[nlam_model*q_day + q_lam];
+      f0 = S0_FLUX[nlam_model*(q_day-1) + q_lam];
+      S0_lam = f0 + (f1-f0)*wday_list[o] ;
       
       //Increment flux with contribution from this wl
-      flux = this_trans * this_lam * lamstep_model * eA_lam_MW * eA_lam_host * eW * S0_lam;         
-      flux_list[o] += flux ;
+      flux_list[o] += ( flux_lam * eW * S0_lam );
       
     } // end o loop over Nobs bins
   } // end q loop over lam bins
 
     // free up the spline matrices
   gsl_matrix_free(J_tau);
-  gsl_matrix_free(W);
-  gsl_matrix_free(WJ);
-  gsl_vector_free(jWJ);
+  free(W);  free(WJ);  
+  if ( jWJ != NULL ) { free(jWJ); }
+  free(q_day_list);  free(wday_list);
 
   if (VERBOSE_BAYESN > 0) {
     printf("DEBUG: BAYESN_MODEL_INFO.M0: %.2f   DLMAG: %.2f   ZP: %.2f  "
@@ -45,6 +45,12 @@
  Aug 19 2022: in ranPhase_PERIODIC_LCLIB, disable phase shift if day grid
               is not uniform, and print warning message.
 
+ Oct 15 2026: GENMODEL_MSKOPT += 1024 -> use binary event index
+              [LCLIB_FILE].INDEX (built and written on first use) with
+              file offset and PARVAL columns per event. PARVAL cuts are
+              applied once to index, and readNext_LCLIB fseeks to next
+              accepted event. See init_INDEX_LCLIB().
+
 *************************************************/
 
 #include "sntools.h"           // community tools
@@ -53,6 +59,7 @@
 
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
+#include <sys/stat.h>
 
 // ==========================================================
 void init_genmag_LCLIB(char *lcLibFile, char *STRING_TEMPLATE_EPOCHS, 
@@ -79,6 +86,7 @@ void init_genmag_LCLIB(char *lcLibFile, char *STRING_TEMPLATE_EPOCHS,
   //     += 1   --> ignore ANGLEMATCH cut 
   //     += 8   --> use LCLIB coordinates (Feb 2021)
   //     += 512 --> DEGUB/REFACTOR flag
+  //     +=1024 --> use binary event index (Oct 2026)
   //
   //  If LCLIBFILE's SURVEY and FILTERLIST does not match input,
   //  abort on error.
@@ -116,6 +124,8 @@ void init_genmag_LCLIB(char *lcLibFile, char *STRING_TEMPLATE_EPOCHS,
   check_LCLIB(SURVEY,FILTERS);
   fflush(stdout);
 
+  init_INDEX_LCLIB(); // optional event index (Oct 2026)
+
   // - - - - - - 
 
   LCLIB_EVENT.LAST_EXTERNAL_ID  = -999. ;
@@ -597,6 +607,8 @@ void set_randomStart_LCLIB(void) {
   // If NEVENT(header) > NEVENT_MIN, then pick randon event 
   // and move to that event in the library.
 
+  // Oct 2026: if LCLIB_INDEX is used, jump to random accepted event.
+
   int NEVENT_MIN = 20 ; // at least this many to set random start
   int NEVENT = LCLIB_INFO.NEVENT ;
   
@@ -608,6 +620,8 @@ void set_randomStart_LCLIB(void) {
 
   // -------------- BEGIN ---------------
 
+  if ( LCLIB_INDEX.USE ) { NEVENT = LCLIB_INDEX.NKEEP ; }
+
   if ( NEVENT < NEVENT_MIN ) { return ; }
 
   XEVT_START = unix_getRan_Flat1(0) * (double)(NEVENT-NEVENT_MIN) ;
@@ -616,6 +630,12 @@ void set_randomStart_LCLIB(void) {
   printf("\t Skip to random LCLIB event %d of %d ... ",
 	 IEVT_START, NEVENT ); fflush(stdout);
 
+  if ( LCLIB_INDEX.USE ) {
+    LCLIB_INDEX.IKEEP_NEXT = IEVT_START ;
+    printf("arrived (index).\n");  fflush(stdout);
+    return ;
+  }
+
   // start reading until reading IEVT_START'th event
   ievt=0;
 
@@ -630,6 +650,406 @@ void set_randomStart_LCLIB(void) {
 
 } // end set_randomStart_LCLIB
 
+// ============================================ 
+void init_INDEX_LCLIB(void) {
+
+  // Created Oct 2026
+  // For GENMODEL_MSKOPT += 1024, read binary event index from
+  // [LCLIB_FILE].INDEX ; if it does not exist or is stale, make one
+  // fast pass thru the LCLIB file to build the index, and write it
+  // so that next sim job reads it directly.
+  // Then apply PARVAL cuts to the index so that readNext_LCLIB
+  // can fseek to accepted events without parsing rejected events.
+  //
+  // Index is disabled for gzipped LCLIB since popen cannot fseek.
+
+  int  USE = ( LCLIB_INFO.OPTMASK & OPTMASK_LCLIB_INDEX ) ;
+  char fnam[] = "init_INDEX_LCLIB" ;
+
+  // ----------- BEGIN ---------
+
+  LCLIB_INDEX.USE    = false ;
+  LCLIB_INDEX.NEVENT = LCLIB_INDEX.NKEEP = LCLIB_INDEX.IKEEP_NEXT = 0 ;
+  LCLIB_INDEX.NPAR   = LCLIB_INFO.NPAR_MODEL ;
+
+  if ( !USE ) { return ; }
+  if ( LCLIB_INFO.DEBUGFLAG_RANMAG ) { return; } // nothing to read
+
+  print_banner(fnam);
+
+  if ( LCLIB_INFO.GZIPFLAG ) {
+    printf("\t WARNING: cannot index gzipped LCLIB -> "
+	   "ignore GENMODEL_MSKOPT=%d bit\n", OPTMASK_LCLIB_INDEX );
+    fflush(stdout);
+    return ;
+  }
+
+  sprintf(LCLIB_INDEX.FILENAME, "%s%s", 
+	  LCLIB_INFO.FILENAME, SUFFIX_INDEX_LCLIB);
+
+  if ( read_INDEX_LCLIB() == 0 ) {
+    build_INDEX_LCLIB();
+    write_INDEX_LCLIB();
+  }
+
+  if ( LCLIB_INDEX.NEVENT == 0 ) {
+    sprintf(c1err,"Found zero START_EVENT keys in LCLIB file");
+    sprintf(c2err,"%s", LCLIB_INFO.FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ) ;
+  }
+
+  if ( LCLIB_INFO.NEVENT <= 0 ) { LCLIB_INFO.NEVENT = LCLIB_INDEX.NEVENT; }
+
+  select_INDEX_LCLIB();
+  LCLIB_INDEX.USE = true ;
+
+  fflush(stdout);
+  return ;
+
+} // end init_INDEX_LCLIB
+
+
+// ============================================ 
+void build_INDEX_LCLIB(void) {
+
+  // Created Oct 2026
+  // Single fgets/ftell pass thru LCLIB file (starting after global
+  // header) to store file offset, Galactic latitude, ANGLEMATCH_b
+  // and PARVAL for each event. T: and S: rows are not parsed.
+  // File pointer is returned to the start location.
+
+  FILE *fp   = LCLIB_INFO.FP ;
+  int  NPAR  = LCLIB_INFO.NPAR_MODEL ;
+  int  MXWD  = 20 ;
+  int  NALLOC = 0, NEVENT = 0, ievt = -1, ipar, NWD, iwd ;
+  long OFFSET, OFFSET_BEGIN ;
+  bool NEWLINE = true ;
+  double RA = 999.0, DEC = 999.0, GLON, GLAT = 999.0 ;
+  char LINE[200], tmpLINE[200], WDLIST[20][100], *ptrWDLIST[20];
+  char *ptr, *WD0, *WD1 ;
+  time_t t0 = time(NULL) ;
+
+  // ----------- BEGIN ---------
+
+  printf("\t Build LCLIB event index (one pass thru LCLIB file) ... \n");
+  fflush(stdout);
+
+  for(iwd=0; iwd < MXWD; iwd++ )  { ptrWDLIST[iwd] = WDLIST[iwd] ; }
+
+  OFFSET_BEGIN = ftell(fp);
+  OFFSET       = OFFSET_BEGIN ;
+
+  while ( fgets(LINE, 200, fp) != NULL ) {
+
+    // only check start of line; skip continuation of very long line
+    if ( !NEWLINE ) { goto NEXT_LINE; }
+
+    ptr = LINE ;
+    while ( *ptr == ' ' || *ptr == '\t' ) { ptr++ ; }
+
+    // skip light curve rows (vast majority of file) without parsing
+    if ( (*ptr == 'T' || *ptr == 'S') && ptr[1] == ':' ) 
+      { goto NEXT_LINE; }
+    if ( commentchar(LINE) ) { goto NEXT_LINE; }
+
+    sprintf(tmpLINE, "%s", LINE);
+    splitString2(tmpLINE, " ", MXWD, &NWD, ptrWDLIST);
+    if ( NWD < 2 ) { goto NEXT_LINE; }
+
+    if ( strcmp(WDLIST[0],"START_EVENT:") == 0 ) {
+      if ( NEVENT == NALLOC ) 
+	{ NALLOC += 10000 ; malloc_INDEX_LCLIB(NALLOC); }
+      ievt = NEVENT ;  NEVENT++ ;
+      sscanf(WDLIST[1],"%lld", &LCLIB_EVENT.ID); 
+      LCLIB_INDEX.OFFSET[ievt]       = (long long)OFFSET ;
+      LCLIB_INDEX.GLAT[ievt]         = 999.0 ;
+      LCLIB_INDEX.ANGLEMATCH_b[ievt] = 99999. ;
+      for(ipar=0; ipar < NPAR; ipar++ ) 
+	{ LCLIB_INDEX.PARVAL[ipar][ievt] = -999.0 ; }
+      RA = DEC = GLAT = 999.0 ;
+      goto NEXT_LINE ;
+    }
+
+    if ( ievt < 0 ) { goto NEXT_LINE; }
+
+    for(iwd=0; iwd < NWD-1; iwd++ ) {
+      WD0 = WDLIST[iwd+0];
+      WD1 = WDLIST[iwd+1];
+
+      if ( strcmp(WD0,"RA:") == 0 ) 
+	{ sscanf(WD1,"%le", &RA);  iwd++ ; }
+      else if ( strcmp(WD0,"DEC:") == 0 ) 
+	{ sscanf(WD1,"%le", &DEC); iwd++ ; }
+      else if ( strcmp(WD0,"b:") == 0  || strcmp(WD0,"GLAT:")==0  ) 
+	{ sscanf(WD1,"%le", &GLAT); iwd++ ; }
+      else if ( strcmp(WD0,"ANGLEMATCH_b:") == 0 ) { 
+	sscanf(WD1,"%f", &LCLIB_INDEX.ANGLEMATCH_b[ievt]); iwd++ ; 
+      }
+      else if ( strcmp(WD0,"PARVAL:") == 0 ) { 
+	read_PARVAL_LCLIB(LINE);
+	for(ipar=0; ipar < NPAR; ipar++ ) {
+	  LCLIB_INDEX.PARVAL[ipar][ievt] = 
+	    (float)LCLIB_EVENT.PARVAL_MODEL[ipar];
+	}
+	break ;
+      }
+      else if ( strcmp(WD0,"END_EVENT:") == 0 ) {
+	// same coordinate logic as coord_translate_LCLIB
+	if ( RA < 900.0 && DEC < 900.0 ) 
+	  { slaEqgal(RA, DEC, &GLON, &GLAT); }
+	LCLIB_INDEX.GLAT[ievt] = (float)GLAT ;
+	ievt = -1 ;
+	break ;
+      }
+    }
+
+  NEXT_LINE:
+    NEWLINE = ( strchr(LINE,'\n') != NULL );
+    OFFSET  = ftell(fp);
+  }
+
+  LCLIB_INDEX.NEVENT   = NEVENT ;
+  LCLIB_INDEX.FILESIZE = (long long)OFFSET ;
+
+  // return to location just after global header
+  clearerr(fp);
+  fseek(fp, OFFSET_BEGIN, SEEK_SET);
+
+  printf("\t Stored index for %d LCLIB events (%d seconds)\n",
+	 NEVENT, (int)(time(NULL)-t0) );
+  fflush(stdout);
+
+  return ;
+
+} // end build_INDEX_LCLIB
+
+
+// ============================================ 
+int read_INDEX_LCLIB(void) {
+
+  // Created Oct 2026
+  // Read binary LCLIB_INDEX.FILENAME written by write_INDEX_LCLIB.
+  // Returns 1 if index is read; returns 0 if index file does not
+  // exist or does not match LCLIB file, so that caller builds index.
+
+  char *FILENAME = LCLIB_INDEX.FILENAME ;
+  int  NPAR = LCLIB_INFO.NPAR_MODEL ;
+  int  VERSION, NPAR_FILE, NEVENT, ipar, NRD=0 ;
+  long long FILESIZE ;
+  char KEY[12];
+  FILE *fp ;
+  struct stat statbuf ;
+  char fnam[] = "read_INDEX_LCLIB" ;
+
+  // ----------- BEGIN ---------
+
+  if ( stat(LCLIB_INFO.FILENAME, &statbuf) != 0 ) { return 0; }
+  FILESIZE = (long long)statbuf.st_size ;
+
+  fp = fopen(FILENAME, "rb");
+  if ( fp == NULL ) { return 0; }
+
+  KEY[8] = 0 ;
+  fread(KEY,       sizeof(char),      8, fp);
+  fread(&VERSION,  sizeof(int),       1, fp);
+  fread(&NPAR_FILE,sizeof(int),       1, fp);
+  fread(&NEVENT,   sizeof(int),       1, fp);
+  fread(&LCLIB_INDEX.FILESIZE, sizeof(long long), 1, fp);
+
+  if ( strcmp(KEY,KEY_INDEX_LCLIB) != 0  || 
+       VERSION   != VERSION_INDEX_LCLIB  ||
+       NPAR_FILE != NPAR                 ||
+       LCLIB_INDEX.FILESIZE != FILESIZE  ||  NEVENT <= 0 ) {
+    printf("\t Ignore stale LCLIB index %s\n", FILENAME);
+    fclose(fp);
+    return 0 ;
+  }
+
+  malloc_INDEX_LCLIB(NEVENT);
+  NRD += fread(LCLIB_INDEX.OFFSET, sizeof(long long), NEVENT, fp);
+  NRD += fread(LCLIB_INDEX.GLAT,   sizeof(float),     NEVENT, fp);
+  NRD += fread(LCLIB_INDEX.ANGLEMATCH_b, sizeof(float), NEVENT, fp);
+  for(ipar=0; ipar < NPAR; ipar++ ) 
+    { NRD += fread(LCLIB_INDEX.PARVAL[ipar], sizeof(float), NEVENT, fp); }
+  fclose(fp);
+
+  if ( NRD != NEVENT*(3+NPAR) ) {
+    sprintf(c1err,"Read %d of %d values from LCLIB index", 
+	    NRD, NEVENT*(3+NPAR) );
+    sprintf(c2err,"Remove corrupt %s", FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ) ;
+  }
+
+  LCLIB_INDEX.NEVENT = NEVENT ;
+  printf("\t Read index for %d LCLIB events from \n\t %s\n", 
+	 NEVENT, FILENAME);
+  fflush(stdout);
+
+  return 1 ;
+
+} // end read_INDEX_LCLIB
+
+
+// ============================================ 
+void write_INDEX_LCLIB(void) {
+
+  // Created Oct 2026
+  // Write binary index so that subsequent sim jobs skip 
+  // build_INDEX_LCLIB. If LCLIB directory is not writable,
+  // give warning and continue with index in memory.
+  // Column order per event array: OFFSET, GLAT, ANGLEMATCH_b, PARVAL.
+
+  char *FILENAME = LCLIB_INDEX.FILENAME ;
+  int  NEVENT = LCLIB_INDEX.NEVENT ;
+  int  NPAR   = LCLIB_INFO.NPAR_MODEL ;
+  int  VERSION = VERSION_INDEX_LCLIB, ipar ;
+  FILE *fp ;
+
+  // ----------- BEGIN ---------
+
+  if ( NEVENT == 0 ) { return; }
+
+  fp = fopen(FILENAME, "wb");
+  if ( fp == NULL ) {
+    printf("\t WARNING: cannot write LCLIB index to\n\t %s\n", FILENAME);
+    fflush(stdout);
+    return ;
+  }
+
+  fwrite(KEY_INDEX_LCLIB, sizeof(char), 8, fp);
+  fwrite(&VERSION,  sizeof(int), 1, fp);
+  fwrite(&NPAR,     sizeof(int), 1, fp);
+  fwrite(&NEVENT,   sizeof(int), 1, fp);
+  fwrite(&LCLIB_INDEX.FILESIZE,    sizeof(long long), 1, fp);
+  fwrite(LCLIB_INDEX.OFFSET,       sizeof(long long), NEVENT, fp);
+  fwrite(LCLIB_INDEX.GLAT,         sizeof(float),     NEVENT, fp);
+  fwrite(LCLIB_INDEX.ANGLEMATCH_b, sizeof(float),     NEVENT, fp);
+  for(ipar=0; ipar < NPAR; ipar++ ) 
+    { fwrite(LCLIB_INDEX.PARVAL[ipar], sizeof(float), NEVENT, fp); }
+  fclose(fp);
+
+  printf("\t Wrote LCLIB index to\n\t %s\n", FILENAME);
+  fflush(stdout);
+
+  return ;
+
+} // end write_INDEX_LCLIB
+
+
+// ============================================ 
+void malloc_INDEX_LCLIB(int NEVENT) {
+
+  // Created Oct 2026
+  // malloc (first call) or realloc LCLIB_INDEX arrays for NEVENT events.
+
+  int  NPAR = LCLIB_INFO.NPAR_MODEL ;
+  int  MEMLL = NEVENT * sizeof(long long);
+  int  MEMF  = NEVENT * sizeof(float);
+  int  ipar ;
+  bool FIRST = ( LCLIB_INDEX.NEVENT == 0 && LCLIB_INDEX.OFFSET == NULL );
+
+  // ----------- BEGIN ---------
+
+  if ( FIRST ) {
+    LCLIB_INDEX.PARVAL = (float**) malloc( (NPAR+1)*sizeof(float*) );
+    for(ipar=0; ipar < NPAR; ipar++ ) { LCLIB_INDEX.PARVAL[ipar] = NULL; }
+  }
+
+  LCLIB_INDEX.OFFSET = (long long*)realloc(LCLIB_INDEX.OFFSET, MEMLL);
+  LCLIB_INDEX.GLAT   = (float*)realloc(LCLIB_INDEX.GLAT, MEMF);
+  LCLIB_INDEX.ANGLEMATCH_b = (float*)realloc(LCLIB_INDEX.ANGLEMATCH_b,MEMF);
+  for(ipar=0; ipar < NPAR; ipar++ ) {
+    LCLIB_INDEX.PARVAL[ipar] = 
+      (float*)realloc(LCLIB_INDEX.PARVAL[ipar], MEMF);
+  }
+
+  return ;
+
+} // end malloc_INDEX_LCLIB
+
+
+// ============================================ 
+void select_INDEX_LCLIB(void) {
+
+  // Created Oct 2026
+  // Apply PARVAL cuts (keep_PARVAL_LCLIB) to index columns
+  // and store list of accepted events in LCLIB_INDEX.IEVT_KEEP.
+
+  int NEVENT = LCLIB_INDEX.NEVENT ;
+  int NPAR   = LCLIB_INFO.NPAR_MODEL ;
+  int NKEEP  = 0, ievt, ipar ;
+  char fnam[] = "select_INDEX_LCLIB" ;
+
+  // ----------- BEGIN ---------
+
+  LCLIB_INDEX.IEVT_KEEP = (int*) malloc( NEVENT * sizeof(int) );
+
+  for(ievt=0; ievt < NEVENT; ievt++ ) {
+    for(ipar=0; ipar < NPAR; ipar++ ) 
+      { LCLIB_EVENT.PARVAL_MODEL[ipar] = LCLIB_INDEX.PARVAL[ipar][ievt]; }
+    if ( keep_PARVAL_LCLIB() ) 
+      { LCLIB_INDEX.IEVT_KEEP[NKEEP] = ievt;  NKEEP++ ; }
+  }
+
+  if ( NKEEP == 0 ) {
+    sprintf(c1err,"Zero of %d LCLIB events pass PARVAL cuts.", NEVENT);
+    sprintf(c2err,"Check LCLIB_CUTWIN inputs.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ) ;
+  }
+
+  LCLIB_INDEX.NKEEP      = NKEEP ;
+  LCLIB_INDEX.IKEEP_NEXT = 0 ;
+
+  printf("\t %d of %d LCLIB events pass PARVAL cuts.\n", NKEEP, NEVENT);
+  fflush(stdout);
+
+  return ;
+
+} // end select_INDEX_LCLIB
+
+
+// ============================================ 
+void seek_INDEX_LCLIB(double GalLat) {
+
+  // Created Oct 2026
+  // Position LCLIB file pointer at START_EVENT line of next
+  // accepted event that also passes ANGLEMATCH_b cut for
+  // sim Galactic latitude GalLat. Wraps around to the first
+  // accepted event, so no rewind is needed.
+
+  int  NKEEP = LCLIB_INDEX.NKEEP ;
+  int  ikeep = LCLIB_INDEX.IKEEP_NEXT ;
+  int  NTRY, ievt ;
+  double b_SIM = fabs(GalLat), b_LCLIB, ANGLEMATCH_b ;
+  char fnam[] = "seek_INDEX_LCLIB" ;
+
+  // ----------- BEGIN ---------
+
+  for(NTRY=0; NTRY < NKEEP; NTRY++ ) {
+    ievt = LCLIB_INDEX.IEVT_KEEP[ikeep];
+    ikeep = (ikeep+1) % NKEEP ;
+
+    // same logic as keep_ANGLEMATCH_LCLIB
+    ANGLEMATCH_b = (double)LCLIB_INDEX.ANGLEMATCH_b[ievt] ;
+    b_LCLIB      = fabs((double)LCLIB_INDEX.GLAT[ievt]) ;
+    if ( LCLIB_INFO.DO_ANGLEMATCH && ANGLEMATCH_b < 500.0 ) {
+      if ( fabs(b_SIM - b_LCLIB) > ANGLEMATCH_b ) { continue; }
+    }
+
+    LCLIB_INDEX.IKEEP_NEXT = ikeep ;
+    clearerr(LCLIB_INFO.FP);
+    fseek(LCLIB_INFO.FP, (long)LCLIB_INDEX.OFFSET[ievt], SEEK_SET);
+    return ;
+  }
+
+  sprintf(c1err,"Unable to find b-angle match among %d LCLIB events",
+	  NKEEP);
+  sprintf(c2err,"Sim b=%.2f deg", GalLat );
+  errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+
+} // end seek_INDEX_LCLIB
+
+
 // ============================================ 
 void set_TobsRange_LCLIB(double *TobsRange) {
 
@@ -874,6 +1294,9 @@ void readNext_LCLIB(double *RA, double *DEC) {
   // init local var
   NROW_FOUND = NROW_EXPECT = 0 ;
 
+  // Oct 2026: jump to next accepted event if LCLIB_INDEX exists
+  if ( LCLIB_INDEX.USE ) { seek_INDEX_LCLIB(GalLat); }
+
   //  - - - - - - - - 
   while ( END_EVENT == 0 ) {
     
@@ -19,6 +19,11 @@
 #define OPTMASK_LCLIB_IGNORE_ANGLEMATCH 1 // option to ignore ANGLEMATCH cut
 #define OPTMASK_LCLIB_useRADEC          8 // use RA,DEC from LCLIB
 #define OPTMASK_LCLIB_DEBUG           512 // debug/refactor
+#define OPTMASK_LCLIB_INDEX          1024 // use binary event index (Oct 2026)
+
+#define SUFFIX_INDEX_LCLIB   ".INDEX"   // binary index = LCLIB file + suffix
+#define KEY_INDEX_LCLIB      "LCLIBIDX" // first 8 bytes of binary index
+#define VERSION_INDEX_LCLIB  1
 
 #define DAYBACK_TEMPLATE_LCLIB 30.0 // used in forceTemplateRows
 #define MODEL_RANMAG_LCLIB  "RANMAG" 
@@ -156,6 +161,28 @@ struct {
 } LCLIB_EVENT ;
 
 
+// Oct 2026: optional binary index (GENMODEL_MSKOPT += 1024) with the
+//   file offset and parameter columns of each LCLIB event. PARVAL cuts
+//   are applied once to the index, and readNext_LCLIB jumps with fseek
+//   to the next accepted event instead of parsing rejected events.
+//   Only for un-compressed LCLIB because popen (gzip) cannot fseek.
+struct {
+  bool   USE;
+  char   FILENAME[MXPATHLEN]; // binary index file
+  int    NEVENT ;        // number of events in LCLIB file
+  int    NPAR ;          // number of PARVAL columns
+  long long FILESIZE ;   // size of LCLIB text file (to detect stale index)
+  long long *OFFSET ;    // file offset of START_EVENT line, per event
+  float  *GLAT ;         // Galactic latitude, per event (999 if none)
+  float  *ANGLEMATCH_b ; // ANGLEMATCH_b cut, per event (99999 if none)
+  float  **PARVAL ;      // PARVAL[ipar][ievt] columns
+
+  int    NKEEP ;         // number of events passing PARVAL cuts
+  int    *IEVT_KEEP ;    // list of ievt passing PARVAL cuts
+  int    IKEEP_NEXT ;    // next IEVT_KEEP entry to read
+} LCLIB_INDEX ;
+
+
 // for Poisson generator (non-recurring)
 //const gsl_rng_type *T_LCLIB;
 //gsl_rng *r_LCLIB;
@@ -174,6 +201,14 @@ void parse_TEMPLATE_EPOCHS_LCLIB(char *STRING_TEMPLATE_EPOCHS);
 void check_LCLIB(char *SURVEY, char *FILTERS) ;
 void set_randomStart_LCLIB(void);
 
+void init_INDEX_LCLIB(void);
+void build_INDEX_LCLIB(void);
+int  read_INDEX_LCLIB(void);
+void write_INDEX_LCLIB(void);
+void malloc_INDEX_LCLIB(int NEVENT);
+void select_INDEX_LCLIB(void);
+void seek_INDEX_LCLIB(double GalLat);
+
 void parse_PARNAMES_LCLIB(char *parNameString);
 void read_PARVAL_LCLIB(char *LINE);
 void coord_translate_LCLIB(double *RA, double *DEC);
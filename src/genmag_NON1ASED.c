@@ -13,6 +13,12 @@
     + read and apply index-dependent FLUXSCALE_NON1ASED (default SCALE=1)
       in NON1A.LIST file.
 
+  Oct 15 2026
+    + if $SNANA_NON1A_CACHE_DIR is set, all NON1A templates are read
+      once and written to a binary bank that is mmap'ed (shared) by
+      all sim jobs; init_genmag_NON1ASED copies each template from 
+      the bank instead of reading SED text file. See init_NON1A_BANK.
+
 ****************************************************/
 
 #include <sys/stat.h>
@@ -28,6 +34,10 @@
 #include "genmag_NON1ASED.h"
 #include "genmag_SEDtools.h"
 
+// after snlc_sim.h since sys/mman.h defines MAP_FILE
+#include <sys/mman.h>
+#include <fcntl.h>
+
 #define MODELGRID_GEN
 
 // *************************************
@@ -54,6 +64,7 @@ void init_genmag_NON1ASED(int isparse, INPUTS_NON1ASED_DEF *INP_NON1ASED,
   // 
   // Sep 5 2022: call print_ranges_SEDMODEL() to see Trest coverage warnings 
   // Aug 31 2023: pass OPTMASK argument
+  // Oct 15 2026: load template from NON1A_BANK if available.
 
   double UVLAM     = INPUTS_SEDMODEL.UVLAM_EXTRAPFLUX ;
   int   DO_GENGRID = ( INP_NON1ASED->IFLAG_GEN == IFLAG_GENGRID ) ;
@@ -64,6 +75,9 @@ void init_genmag_NON1ASED(int isparse, INPUTS_NON1ASED_DEF *INP_NON1ASED,
 
   // ------------- BEGIN -------------
 
+  Trange[0] =  -150. ;  // widen Trange Apr 2 2018 
+  Trange[1] =   500. ;  
+
   if ( isparse < 0 ) {          // one-time init
 
     // summarize filter info
@@ -106,26 +120,31 @@ void init_genmag_NON1ASED(int isparse, INPUTS_NON1ASED_DEF *INP_NON1ASED,
 
     init_NEGFLAM_SEDMODEL(OPTMASK);
 
+    // Oct 2026: optional binary template bank shared by sim jobs
+    Lrange[0] = SEDMODEL.RESTLAMMIN_FILTERCEN ;
+    Lrange[1] = SEDMODEL.RESTLAMMAX_FILTERCEN ;
+    init_NON1A_BANK(INP_NON1ASED, Trange, Lrange);
+
     return;
   }
 
   NON1A_INDEX = INP_NON1ASED->INDEX[isparse];
   sedFile     = INP_NON1ASED->SED_FILE[isparse] ;
 
-  Trange[0] =  -150. ;  // widen Trange Apr 2 2018 
-  Trange[1] =   500. ;  
   Lrange[0] = SEDMODEL.RESTLAMMIN_FILTERCEN ;
   Lrange[1] = SEDMODEL.RESTLAMMAX_FILTERCEN ;
 
   sprintf(sedcomment,"NON1A-%3.3d", NON1A_INDEX );
 
-  rd_sedFlux(sedFile, sedcomment, Trange, Lrange
-	     ,MXBIN_DAYSED_SEDMODEL, MXBIN_LAMSED_SEDMODEL
-	     ,SEDMODEL.OPTMASK
-	     ,&TEMP_SEDMODEL.NDAY, TEMP_SEDMODEL.DAY, &TEMP_SEDMODEL.DAYSTEP
-	     ,&TEMP_SEDMODEL.NLAM, TEMP_SEDMODEL.LAM, &TEMP_SEDMODEL.LAMSTEP
-	     ,TEMP_SEDMODEL.FLUX,  TEMP_SEDMODEL.FLUXERR
-	     ,&nflux_nan );
+  if ( !load_NON1A_BANK(isparse) ) {
+    rd_sedFlux(sedFile, sedcomment, Trange, Lrange
+	       ,MXBIN_DAYSED_SEDMODEL, MXBIN_LAMSED_SEDMODEL
+	       ,SEDMODEL.OPTMASK
+	       ,&TEMP_SEDMODEL.NDAY, TEMP_SEDMODEL.DAY, &TEMP_SEDMODEL.DAYSTEP
+	       ,&TEMP_SEDMODEL.NLAM, TEMP_SEDMODEL.LAM, &TEMP_SEDMODEL.LAMSTEP
+	       ,TEMP_SEDMODEL.FLUX,  TEMP_SEDMODEL.FLUXERR
+	       ,&nflux_nan );
+  }
 
   if ( UVLAM > 0.0 ) { UVLAM_EXTRAPFLUX_SEDMODEL(UVLAM, &TEMP_SEDMODEL); } 
 
@@ -162,6 +181,295 @@ void init_genmag_NON1ASED(int isparse, INPUTS_NON1ASED_DEF *INP_NON1ASED,
 
 } // end of init_genmag_NON1ASED
 
+// ********************************************
+void init_NON1A_BANK(INPUTS_NON1ASED_DEF *INP_NON1ASED, double *Trange, 
+		     double *Lrange) {
+
+  // Created Oct 2026
+  // If ENV_CACHE_NON1A_BANK is defined, mmap binary bank of all
+  // NON1A templates from 
+  //    [cacheDir]/NON1A_BANK_[hash].bin
+  // where hash is computed from SED file names, sizes, mod-times
+  // and read options. If bank does not exist, read all SED files
+  // once and write bank for this and subsequent jobs.
+  // Bank is mapped read-only & shared, so that concurrent jobs on
+  // a node share one copy of the templates in the page cache.
+
+  char *cacheDir = getenv(ENV_CACHE_NON1A_BANK);
+  int  NINDEX = INP_NON1ASED->NINDEX ;
+  unsigned long long hash ;
+  char fnam[] = "init_NON1A_BANK" ;
+
+  // ----------- BEGIN ------------
+
+  NON1A_BANK.USE = false ;
+  if ( cacheDir == NULL    ) { return ; }
+  if ( strlen(cacheDir)==0 ) { return ; }
+  if ( NINDEX <= 0         ) { return ; }
+
+  hash = hash_NON1A_BANK(INP_NON1ASED, Trange, Lrange);
+  sprintf(NON1A_BANK.FILENAME,"%s/NON1A_BANK_%016llx.bin", cacheDir, hash);
+
+  if ( !read_NON1A_BANK(NON1A_BANK.FILENAME, NINDEX) ) {
+    write_NON1A_BANK(NON1A_BANK.FILENAME, INP_NON1ASED, Trange, Lrange);
+    read_NON1A_BANK(NON1A_BANK.FILENAME, NINDEX) ;
+  }
+
+  if ( NON1A_BANK.USE ) {
+    printf("\t %s: mmap %d NON1A templates (%.1f MB) from\n\t   %s\n",
+	   fnam, NINDEX, 1.0E-6*(double)NON1A_BANK.SIZE, NON1A_BANK.FILENAME);
+  }
+  else {
+    printf("\t %s: WARNING cannot use bank -> read SED text files\n", fnam);
+  }
+  fflush(stdout);
+
+  return ;
+
+} // end init_NON1A_BANK
+
+
+// ********************************************
+unsigned long long hash_NON1A_BANK(INPUTS_NON1ASED_DEF *INP_NON1ASED,
+				   double *Trange, double *Lrange) {
+
+  // Created Oct 2026
+  // Return 64-bit FNV-1a hash of SED file names, sizes & mod-times,
+  // and of options that affect rd_sedFlux output.
+
+  unsigned long long hash  = 14695981039346656037ULL ;
+  unsigned long long prime = 1099511628211ULL ;
+  int    NINDEX = INP_NON1ASED->NINDEX ;
+  int    isp, opt_list[5];
+  long long stat_list[2];
+  struct stat statbuf ;
+  char  *sedFile ;
+
+#define HASH_BYTES_NON1A(ptr,n) {					\
+    const unsigned char *b = (const unsigned char*)(ptr); size_t j;	\
+    for(j=0; j < (size_t)(n); j++ ) { hash ^= b[j]; hash *= prime; } }
+
+  // ----------- BEGIN ------------
+
+  opt_list[0] = VERSION_NON1A_BANK ;
+  opt_list[1] = NINDEX ;
+  opt_list[2] = SEDMODEL.OPTMASK ;
+  opt_list[3] = MXBIN_DAYSED_SEDMODEL ;
+  opt_list[4] = MXBIN_LAMSED_SEDMODEL ;
+  HASH_BYTES_NON1A(opt_list, sizeof(opt_list) );
+  HASH_BYTES_NON1A(Trange, 2*sizeof(double) );
+  HASH_BYTES_NON1A(Lrange, 2*sizeof(double) );
+
+  for(isp=1; isp <= NINDEX; isp++ ) {
+    sedFile = INP_NON1ASED->SED_FILE[isp] ;
+    stat_list[0] = stat_list[1] = -1 ;
+    if ( stat(sedFile, &statbuf) == 0 ) {
+      stat_list[0] = (long long)statbuf.st_size ;
+      stat_list[1] = (long long)statbuf.st_mtime ;
+    }
+    HASH_BYTES_NON1A(sedFile, strlen(sedFile) );
+    HASH_BYTES_NON1A(stat_list, sizeof(stat_list) );
+  }
+
+  if ( hash == 0 ) { hash = 1; } 
+  return hash ;
+
+} // end hash_NON1A_BANK
+
+
+// ********************************************
+bool read_NON1A_BANK(char *bankFile, int NINDEX) {
+
+  // Created Oct 2026
+  // mmap bankFile and check header. Returns true on success;
+  // returns false if bank does not exist or is invalid.
+
+  struct stat st;
+  long long SIZE, *HEAD ;
+  char *MAPBUF ;
+  int   fd ;
+  char fnam[] = "read_NON1A_BANK" ;
+
+  // ----------- BEGIN ------------
+
+  fd = open(bankFile, O_RDONLY);
+  if ( fd < 0 ) { return false; }
+
+  if ( fstat(fd, &st) != 0 ) { close(fd); return false; }
+  SIZE = (long long)st.st_size ;
+  if ( SIZE < (long long)(NHEAD_NON1A_BANK*sizeof(long long)) ) 
+    { close(fd); return false; }
+
+  MAPBUF = (char*)mmap(NULL, (size_t)SIZE, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if ( MAPBUF == MAP_FAILED ) { return false; }
+
+  HEAD = (long long*)MAPBUF;
+  if ( memcmp(MAPBUF, MAGIC_NON1A_BANK, 8) != 0 ||
+       HEAD[1] != VERSION_NON1A_BANK || HEAD[2] != NINDEX ) {
+    printf("\t %s: WARNING invalid bank -> ignore\n", fnam);
+    fflush(stdout);
+    munmap(MAPBUF, (size_t)SIZE);
+    return false;
+  }
+
+  NON1A_BANK.MAPBUF    = MAPBUF ;
+  NON1A_BANK.SIZE      = SIZE ;
+  NON1A_BANK.NTEMPLATE = NINDEX ;
+  NON1A_BANK.TOC       = HEAD + NHEAD_NON1A_BANK ;
+  NON1A_BANK.USE       = true ;
+
+  return true ;
+
+} // end read_NON1A_BANK
+
+
+// ********************************************
+void write_NON1A_BANK(char *bankFile, INPUTS_NON1ASED_DEF *INP_NON1ASED,
+		      double *Trange, double *Lrange) {
+
+  // Created Oct 2026
+  // Read each SED file with rd_sedFlux (into TEMP_SEDMODEL) and write
+  // binary bank. Layout:
+  //   HEAD[NHEAD]  : MAGIC, VERSION, NINDEX, spare
+  //   TOC[NINDEX+1][NTOC] : OFFSET, NDAY, NLAM, INDEX  (isparse=1..NINDEX)
+  //   per template : META[NMETA], DAY[NDAY], LAM[NLAM], 
+  //                  FLUX[NDAY*NLAM], FLUXERR[NDAY*NLAM]
+  // A template with missing SED file has NDAY=0 and is read later
+  // from text (to abort with usual message).
+  // Bank is written to temp file and renamed, so that concurrent
+  // jobs never mmap a partially written bank.
+
+  int  NINDEX = INP_NON1ASED->NINDEX ;
+  int  NTOC   = (NINDEX+1) * NTOC_NON1A_BANK ;
+  int  isp, index, NDAY, NLAM, NFLUX, nflux_nan ;
+  long long HEAD[NHEAD_NON1A_BANK], *TOC, OFFSET ;
+  double META[NMETA_NON1A_BANK];
+  struct stat statbuf ;
+  char tmpFile[MXPATHLEN+40], sedcomment[40], *sedFile ;
+  FILE *fp ;
+  char fnam[] = "write_NON1A_BANK" ;
+
+  // ----------- BEGIN ------------
+
+  sprintf(tmpFile, "%s.tmp%d", bankFile, (int)getpid() );
+  fp = fopen(tmpFile, "wb");
+  if ( fp == NULL ) {
+    printf("\t %s: WARNING cannot write %s\n", fnam, tmpFile);
+    fflush(stdout);
+    return ;
+  }
+
+  printf("\t %s: write %d NON1A templates to bank ... \n", fnam, NINDEX);
+  fflush(stdout);
+
+  TOC = (long long*)calloc(NTOC, sizeof(long long) );
+  memcpy(HEAD, MAGIC_NON1A_BANK, 8);
+  HEAD[1] = VERSION_NON1A_BANK ;
+  HEAD[2] = NINDEX ;
+  HEAD[3] = 0 ;
+  fwrite(HEAD, sizeof(long long), NHEAD_NON1A_BANK, fp);
+  fwrite(TOC,  sizeof(long long), NTOC,             fp); // placeholder
+  OFFSET = (long long)(NHEAD_NON1A_BANK + NTOC) * sizeof(long long) ;
+
+  for(isp=1; isp <= NINDEX; isp++ ) {
+    index   = INP_NON1ASED->INDEX[isp];
+    sedFile = INP_NON1ASED->SED_FILE[isp] ;
+    TOC[isp*NTOC_NON1A_BANK+3] = index ;
+    if ( stat(sedFile, &statbuf) != 0 ) { continue; }
+
+    sprintf(sedcomment,"NON1A-%3.3d", index );
+    rd_sedFlux(sedFile, sedcomment, Trange, Lrange
+	       ,MXBIN_DAYSED_SEDMODEL, MXBIN_LAMSED_SEDMODEL
+	       ,SEDMODEL.OPTMASK
+	       ,&TEMP_SEDMODEL.NDAY, TEMP_SEDMODEL.DAY, &TEMP_SEDMODEL.DAYSTEP
+	       ,&TEMP_SEDMODEL.NLAM, TEMP_SEDMODEL.LAM, &TEMP_SEDMODEL.LAMSTEP
+	       ,TEMP_SEDMODEL.FLUX,  TEMP_SEDMODEL.FLUXERR
+	       ,&nflux_nan );
+
+    NDAY  = TEMP_SEDMODEL.NDAY ;
+    NLAM  = TEMP_SEDMODEL.NLAM ;
+    NFLUX = NDAY * NLAM ;
+    META[0] = TEMP_SEDMODEL.DAYSTEP ;
+    META[1] = TEMP_SEDMODEL.LAMSTEP ;
+    META[2] = INP_NON1ASED->MAGOFF[isp] ;
+    META[3] = INP_NON1ASED->MAGSMEAR[isp][0] ;
+    META[4] = INP_NON1ASED->MAGSMEAR[isp][1] ;
+    META[5] = INP_NON1ASED->FLUXSCALE[index] ;
+
+    TOC[isp*NTOC_NON1A_BANK+0] = OFFSET ;
+    TOC[isp*NTOC_NON1A_BANK+1] = NDAY ;
+    TOC[isp*NTOC_NON1A_BANK+2] = NLAM ;
+
+    fwrite(META, sizeof(double), NMETA_NON1A_BANK,   fp);
+    fwrite(TEMP_SEDMODEL.DAY,     sizeof(double), NDAY,  fp);
+    fwrite(TEMP_SEDMODEL.LAM,     sizeof(double), NLAM,  fp);
+    fwrite(TEMP_SEDMODEL.FLUX,    sizeof(double), NFLUX, fp);
+    fwrite(TEMP_SEDMODEL.FLUXERR, sizeof(double), NFLUX, fp);
+    OFFSET += (long long)(NMETA_NON1A_BANK+NDAY+NLAM+2*NFLUX)*sizeof(double);
+  }
+
+  // fill table of contents
+  fseek(fp, NHEAD_NON1A_BANK*sizeof(long long), SEEK_SET);
+  fwrite(TOC, sizeof(long long), NTOC, fp);
+  fclose(fp);
+  free(TOC);
+
+  if ( rename(tmpFile, bankFile) != 0 ) {
+    printf("\t %s: WARNING cannot rename %s\n", fnam, tmpFile);
+    remove(tmpFile);
+  }
+  fflush(stdout);
+
+  return ;
+
+} // end write_NON1A_BANK
+
+
+// ********************************************
+bool load_NON1A_BANK(int isparse) {
+
+  // Created Oct 2026
+  // Copy template isparse from mmap'ed bank into TEMP_SEDMODEL,
+  // i.e., same output as rd_sedFlux. Returns false if bank is not
+  // used, or template is not in bank (caller then reads SED file).
+
+  long long *TOC ;
+  double *DPTR ;
+  int    NDAY, NLAM, NFLUX ;
+
+  // ----------- BEGIN ------------
+
+  if ( !NON1A_BANK.USE ) { return false; }
+  if ( isparse < 1 || isparse > NON1A_BANK.NTEMPLATE ) { return false; }
+
+  TOC  = &NON1A_BANK.TOC[isparse*NTOC_NON1A_BANK] ;
+  NDAY = (int)TOC[1] ;
+  NLAM = (int)TOC[2] ;
+  if ( NDAY <= 0 || NLAM <= 0 ) { return false; }
+  NFLUX = NDAY * NLAM ;
+
+  DPTR = (double*)(NON1A_BANK.MAPBUF + TOC[0]) ;
+  TEMP_SEDMODEL.NDAY    = NDAY ;
+  TEMP_SEDMODEL.NLAM    = NLAM ;
+  TEMP_SEDMODEL.DAYSTEP = DPTR[0] ;
+  TEMP_SEDMODEL.LAMSTEP = DPTR[1] ;
+  DPTR += NMETA_NON1A_BANK ;
+
+  memcpy(TEMP_SEDMODEL.DAY,     DPTR, NDAY *sizeof(double));  DPTR += NDAY;
+  memcpy(TEMP_SEDMODEL.LAM,     DPTR, NLAM *sizeof(double));  DPTR += NLAM;
+  memcpy(TEMP_SEDMODEL.FLUX,    DPTR, NFLUX*sizeof(double));  DPTR += NFLUX;
+  memcpy(TEMP_SEDMODEL.FLUXERR, DPTR, NFLUX*sizeof(double));
+
+  printf("  Load NON1A-%3.3d from bank (NDAY=%d, NLAM=%d)\n",
+	 (int)TOC[3], NDAY, NLAM);
+  fflush(stdout);
+
+  return true ;
+
+} // end load_NON1A_BANK
+
+
 
 // *****************************************
 void genmag_NON1ASED (
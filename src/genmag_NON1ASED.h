@@ -2,6 +2,7 @@
 //  genmag_NON1ASED.h
 //  
 //  Mar 14 2016: add prep_NON1ASED & pick_NON1ASED
+//  Oct 15 2026: add NON1A_BANK (binary template bank, mmap'ed)
 // ==============================
 
 void  prep_NON1ASED(INPUTS_NON1ASED_DEF *INP_NON1ASED, 
@@ -29,7 +30,37 @@ void genmag_NON1ASED ( int index, int ifilt_obs,
 		       double *ptr_genmag, double *ptr_generr );
 
 void shift_NON1A_DAY(void);
+
+void init_NON1A_BANK(INPUTS_NON1ASED_DEF *INP_NON1ASED, double *Trange, 
+		     double *Lrange);
+unsigned long long hash_NON1A_BANK(INPUTS_NON1ASED_DEF *INP_NON1ASED,
+				   double *Trange, double *Lrange);
+bool read_NON1A_BANK(char *bankFile, int NINDEX);
+void write_NON1A_BANK(char *bankFile, INPUTS_NON1ASED_DEF *INP_NON1ASED,
+		      double *Trange, double *Lrange);
+bool load_NON1A_BANK(int isparse);
 		   
 // global var
 #define  ISED_NON1A  1
 #define  MODELNAME_NON1ASED  "NON1ASED" 
+
+// Oct 2026: optional binary bank of all NON1A templates (output of
+// rd_sedFlux) written once to [$SNANA_NON1A_CACHE_DIR]/NON1A_BANK_[hash].bin
+// and mmap'ed (read-only, shared page cache) by all sim jobs, so that
+// jobs skip reading/parsing the text SED files.
+#define ENV_CACHE_NON1A_BANK   "SNANA_NON1A_CACHE_DIR" // cache dir from ENV
+#define MAGIC_NON1A_BANK       "NON1ABNK"
+#define VERSION_NON1A_BANK     1
+#define NHEAD_NON1A_BANK       4   // long long words in header
+#define NTOC_NON1A_BANK        4   // OFFSET, NDAY, NLAM, INDEX per template
+#define NMETA_NON1A_BANK       6   // DAYSTEP, LAMSTEP, MAGOFF, MAGSMEAR[2], FLUXSCALE
+
+struct {
+  bool      USE ;
+  char      FILENAME[MXPATHLEN];
+  char      *MAPBUF ;     // mmap'ed bank
+  long long SIZE ;        // size of bank, bytes
+  int       NTEMPLATE ;   // number of templates (=NINDEX)
+  long long *TOC ;        // table of contents [isparse*NTOC_NON1A_BANK]
+} NON1A_BANK ;
+
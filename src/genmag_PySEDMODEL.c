@@ -54,12 +54,28 @@
       model, and aborts if MODEL_NAME is not found. This forces a human
       check for new PySEDMODELs.
 
+  Oct 15 2026
+    + genmag_PySEDMODEL fetches SEDs for all epochs in one python call
+      (_fetchSED_batch): Trest values are passed in a preallocated numpy
+      array, and the returned NOBS x NLAM array is read in place via
+      the buffer protocol. Parameter values are fetched with one call
+      (_fetchParVals_all). See fetchSED_BATCH_PySEDMODEL.
+    + INTEG_zSED_PySEDMODEL uses filter-to-SED lambda map cached vs.
+      redshift (get_ZMAP_SEDMODEL) for broadband filters.
+    + optional SED cache keyed on quantized {Trest, PARVAL, HOSTPAR}
+      with memory tier and optional disk tier shared among jobs;
+      see init_SEDCACHE_PySEDMODEL. Enabled with sim-input keys
+        GENMODEL_SEDCACHE:      <DTREST> <DPAR>
+        GENMODEL_SEDCACHE_MXMB: <MB>     ! default 500
+        GENMODEL_SEDCACHE_DIR:  <dir>    ! optional disk tier
+
  *****************************************/
 
 #include  <stdio.h>
 #include  <math.h>
 #include  <stdlib.h>
 #include  <sys/stat.h>
+#include  <unistd.h>
 
 #include  "sntools.h"           // SNANA community tools
 #include  "sntools_genSmear.h"
@@ -69,6 +85,7 @@
 #include  "genmag_SEDtools.h"
 #include  "genmag_SIMSED.h"
 #include  "genmag_PySEDMODEL.h"
+#include  "uthash.h"
 
 #ifdef USE_PYTHON
 #include  <Python.h>
@@ -78,6 +95,15 @@ PyObject *numpy_empty, *numpy_double; // numpy.empty, numpy.double
 
 PyObject *geninit_PySEDMODEL ;
 
+// Oct 2026: objects for batched SED and parameter fetch; methods
+// are looked up once during init.
+PyObject *pmeth_fetchSED_batch, *pmeth_fetchSED_LAM, *pmeth_fetchParVals_all;
+PyObject *pTREST_BATCH ;    // preallocated numpy array of Trest
+PyObject *pSED_BATCH ;      // last SED array returned by _fetchSED_batch
+PyObject *pPARNAMES ;       // tuple of parameter names
+Py_buffer bufTREST_BATCH = {NULL, NULL};
+Py_buffer bufSED_BATCH   = {NULL, NULL};
+
 //int init_numpy(){
 //  import_array(); // PyError if not successful
 //  return 0;
@@ -180,6 +206,8 @@ void init_genmag_PySEDMODEL(char *MODEL_NAME, char *PATH_VERSION, int OPTMASK,
 
   splitString(NAMES_HOSTPAR, comma, fnam, MXHOSTPAR_PySEDMODEL,
 	      &NPAR, INPUTS_PySEDMODEL.NAME_ARRAY_HOSTPAR );
+  INPUTS_PySEDMODEL.NHOSTPAR = NPAR ;
+  SEDCACHE_PySEDMODEL.USE    = false ; // see init_SEDCACHE_PySEDMODEL
 
   // - - - - - - - - - - -
   // print summary of filter info
@@ -294,6 +322,18 @@ void init_genmag_PySEDMODEL(char *MODEL_NAME, char *PATH_VERSION, int OPTMASK,
   Py_DECREF(genclass);
   Py_DECREF(pargs);
 
+  // look up batch methods once (Oct 2026)
+  pmeth_fetchSED_batch = 
+    PyObject_GetAttrString(geninit_PySEDMODEL, "_fetchSED_batch");
+  handle_python_exception(fnam, "getting _fetchSED_batch method");
+  pmeth_fetchSED_LAM = 
+    PyObject_GetAttrString(geninit_PySEDMODEL, "_fetchSED_LAM");
+  handle_python_exception(fnam, "getting _fetchSED_LAM method");
+  pmeth_fetchParVals_all = 
+    PyObject_GetAttrString(geninit_PySEDMODEL, "_fetchParVals_all");
+  handle_python_exception(fnam, "getting _fetchParVals_all method");
+  pTREST_BATCH = pSED_BATCH = NULL ;
+
   printf("\t Finished %s python-init from C code \n", PyMODEL_NAME );
   fflush(stdout);
 #endif
@@ -314,6 +354,17 @@ void init_genmag_PySEDMODEL(char *MODEL_NAME, char *PATH_VERSION, int OPTMASK,
 #endif
 
   Event_PySEDMODEL.NPAR = NPAR;
+  Event_PySEDMODEL.MXOBS_BATCH = 0 ;
+  Event_PySEDMODEL.TREST_BATCH = NULL ;
+  Event_PySEDMODEL.SED_BATCH   = NULL ;
+#ifdef USE_PYTHON
+  pPARNAMES = PyTuple_New(NPAR);
+  for(ipar=0; ipar < NPAR; ipar++ ) {
+    PyTuple_SetItem(pPARNAMES, ipar, 
+		    PyUnicode_FromString(Event_PySEDMODEL.PARNAME[ipar]) );
+  }
+#endif
+
   printf("\t %s parameters to store in data files:\n", PyMODEL_NAME);
   for(ipar=0; ipar < NPAR; ipar++ )
     { printf("\t\t %s \n", Event_PySEDMODEL.PARNAME[ipar] ); }
@@ -570,6 +621,10 @@ void genmag_PySEDMODEL(int EXTERNAL_ID, double zHEL, double zCMB, double MU,
   //
   // May 5 2023 RK - add MJDOFF arg (for defining AGN t_transition as MJD)
   //
+  // Oct 15 2026: with python, fetch SEDs for all epochs in one call
+  //              (fetchSED_BATCH_PySEDMODEL) instead of one per epoch.
+  //              If SED cache is used, call fetchSED_BATCH_SEDCACHE.
+  //
 
   int   MXLAM      = MXLAM_PySEDMODEL;
   char *MODEL_NAME = INPUTS_PySEDMODEL.MODEL_NAME ;
@@ -587,12 +642,11 @@ void genmag_PySEDMODEL(int EXTERNAL_ID, double zHEL, double zCMB, double MU,
   double  ZP  = FILTER_SEDMODEL[ifilt].ZP ;    // ZP for flux->mag
   double x0   = pow(10.0,-0.4*MU);             // dimming from dist. mod.
   int    NEWEVT_FLAG = 0 ;
-  int    NEWEVT_FLAG_TMP ;
   int    DUMPFLAG_HOSTPAR = 0 ;
   int    FLAG_Finteg;
 
   int    NLAM, o, ipar ;
-  double Tobs, Trest, FLUXSUM_OBS, FspecDUM[2], magobs ;
+  double Tobs, FLUXSUM_OBS, FspecDUM[2], magobs ;
   char fnam[] = "genmag_PySEDMODEL" ;
 
    #ifdef USE_PYTHON
@@ -642,6 +696,37 @@ void genmag_PySEDMODEL(int EXTERNAL_ID, double zHEL, double zCMB, double MU,
   int NOBS_LOCAL = NOBS;
   if ( DO_TEMPLATE ) { NOBS_LOCAL++ ; }
 
+  // Oct 2026: Trest for all epochs to fetch SEDs in one batch
+  if ( NOBS_LOCAL > Event_PySEDMODEL.MXOBS_BATCH ) {
+    Event_PySEDMODEL.MXOBS_BATCH = NOBS_LOCAL + 100 ;
+    Event_PySEDMODEL.TREST_BATCH = (double*)
+      realloc(Event_PySEDMODEL.TREST_BATCH, 
+	      Event_PySEDMODEL.MXOBS_BATCH * sizeof(double) );
+  }
+  for(o=0; o < NOBS_LOCAL; o++ ) {
+    if ( o < NOBS ) 
+      { Tobs = TOBS_list[o]; }
+    else
+      { Tobs =  Event_PySEDMODEL.Tobs_template; }
+    Event_PySEDMODEL.TREST_BATCH[o] = Tobs * z1inv ;
+  }
+
+#ifdef USE_PYTHON
+  if ( SEDCACHE_PySEDMODEL.USE ) {
+    fetchSED_BATCH_SEDCACHE(EXTERNAL_ID, NEWEVT_FLAG, 
+			    NOBS_LOCAL, Event_PySEDMODEL.TREST_BATCH, MXLAM, 
+			    NHOSTPAR, HOSTPAR_LIST, 
+			    &NLAM, LAM, &Event_PySEDMODEL.SED_BATCH);
+  }
+  else {
+    fetchSED_BATCH_PySEDMODEL(EXTERNAL_ID, NEWEVT_FLAG, 
+			      NOBS_LOCAL, Event_PySEDMODEL.TREST_BATCH, MXLAM,
+			      NHOSTPAR, HOSTPAR_LIST, 
+			      &NLAM, LAM, &Event_PySEDMODEL.SED_BATCH);
+  }
+  Event_PySEDMODEL.NLAM = NLAM ;
+#endif
+
   for(o=0; o < NOBS_LOCAL; o++ ) {
 
     if ( o < NOBS ) 
@@ -649,7 +734,11 @@ void genmag_PySEDMODEL(int EXTERNAL_ID, double zHEL, double zCMB, double MU,
     else
       { Tobs =  Event_PySEDMODEL.Tobs_template; }
 
-    Trest = Tobs * z1inv;
+#ifdef USE_PYTHON
+    SED = &Event_PySEDMODEL.SED_BATCH[o*NLAM] ;
+#else
+    int    NEWEVT_FLAG_TMP ;
+    double Trest = Event_PySEDMODEL.TREST_BATCH[o] ;
     if (o == 0 )
       { NEWEVT_FLAG_TMP = NEWEVT_FLAG; }
     else
@@ -658,6 +747,7 @@ void genmag_PySEDMODEL(int EXTERNAL_ID, double zHEL, double zCMB, double MU,
     fetchSED_PySEDMODEL(EXTERNAL_ID, NEWEVT_FLAG_TMP, Trest,
 			MXLAM, HOSTPAR_LIST, &NLAM, LAM, SED);
     Event_PySEDMODEL.NLAM = NLAM ;
+#endif
 
     // integrate redshifted SED to get observer-frame flux in IFILT_OBS band.
     // FLUXSUM_OBS is returned (ignore FspecDUM)
@@ -775,43 +865,46 @@ void fetchParVal_PySEDMODEL(double *parVal) {
   // data files.
   //
   // Called once per event.
+  //
+  // Oct 2026: single python call for all parameters (_fetchParVals_all)
 
 #ifdef USE_PYTHON
-  PyObject *parvalmeth,*pParVal,*pargs;
+  PyObject *pParVal;
 #endif
   char *MODEL_NAME = INPUTS_PySEDMODEL.MODEL_NAME ;
-  double val;
-  char **parNameList ;
   int NPAR, ipar;
   char fnam[] = "fetchParVal_PySEDMODEL" ;
 
   // ------------- BEGIN ------------------
 
   NPAR = Event_PySEDMODEL.NPAR;
-  parNameList = Event_PySEDMODEL.PARNAME;
   // David: need python function to return these values.
 #ifdef USE_PYTHON
 
-  parvalmeth  = PyObject_GetAttrString(geninit_PySEDMODEL, "fetchParVals");
-  handle_python_exception(fnam, "getting fetchParVals attribute of the class");
+  // Oct 2026: one call returns float64 array of all NPAR values
+  Py_buffer bufParVal = {NULL, NULL};
+  pParVal = PyObject_CallFunctionObjArgs(pmeth_fetchParVals_all, 
+					 pPARNAMES, NULL);
+  handle_python_exception(fnam, "calling _fetchParVals_all method");
 
-  for(ipar=0; ipar < NPAR; ipar++ ) {
-    pParVal  = PyObject_CallFunction(parvalmeth, "(s)", parNameList[ipar]);
-    handle_python_exception(fnam, "fetching a parameter value");
-    val          = PyFloat_AsDouble(pParVal);
-    parVal[ipar] = val;
-    // printf("   PARVAL    = '%d' \n",  val);
+  if (PyObject_GetBuffer(pParVal, &bufParVal, PyBUF_C_CONTIGUOUS) != 0) {
+    handle_python_exception(fnam, "setting buffer from pParVal");
+  }
+  if ( bufParVal.len != NPAR*(Py_ssize_t)sizeof(double) ) {
+    sprintf(c1err,"_fetchParVals_all must return %d float64 values", NPAR);
+    sprintf(c2err,"but buffer has %d bytes", (int)bufParVal.len);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
   }
+  for(ipar=0; ipar < NPAR; ipar++ ) 
+    { parVal[ipar] = ((double*)bufParVal.buf)[ipar]; }
 
+  PyBuffer_Release(&bufParVal);
   Py_DECREF(pParVal);
-  Py_DECREF(parvalmeth);
 #endif
 
 #ifndef USE_PYTHON
-  for(ipar=0; ipar < NPAR; ipar++ ) {
-    val = (double)Event_PySEDMODEL.EXTERNAL_ID + 0.1*(double)ipar ;
-    parVal[ipar] = val;
-  }
+  for(ipar=0; ipar < NPAR; ipar++ ) 
+    { parVal[ipar] = (double)Event_PySEDMODEL.EXTERNAL_ID + 0.1*(double)ipar; }
 #endif
 
   return ;
@@ -837,14 +930,31 @@ void fetchSED_PySEDMODEL(int EXTERNAL_ID, int NEWEVT_FLAG, double Trest, int MXL
   //  *FLUX_SED  : SED flux in each wave bin (erg/s/cm^2/A)
   //               Note that this is flux, not dF/dLam
   //
+  // Oct 15 2026: if SED cache is used, return cached SED for
+  //    quantized Trest; otherwise evaluate at quantized Trest and store.
+  //
 
   char *MODEL_NAME = INPUTS_PySEDMODEL.MODEL_NAME ;
+  bool USE_CACHE   = SEDCACHE_PySEDMODEL.USE ;
+  long long KEY[MXKEY_SEDCACHE];
+  int  NKEY ;
+  double Trest_eval ;
   char fnam[] = "fetchSED_PySEDMODEL" ;
 
   // ------------ BEGIN -----------
 
   *NLAM_SED = 0 ; // init output
 
+  if ( USE_CACHE ) {
+    NKEY = key_SEDCACHE(Trest, HOSTPAR_LIST, KEY, &Trest_eval);
+    if ( !NEWEVT_FLAG && lookup_SEDCACHE(NKEY, KEY, FLUX_SED) ) {
+      *NLAM_SED = SEDCACHE_PySEDMODEL.NLAM ;
+      memcpy(LAM_SED, SEDCACHE_PySEDMODEL.LAM, *NLAM_SED*sizeof(double));
+      return ;
+    }
+    Trest = Trest_eval ;
+  }
+
 #ifdef USE_PYTHON
   PyObject *pmeth, *pargs, *pargs2, *pLAM, *pFLUX, *plammeth;
   Py_buffer bufLAM = {NULL, NULL};
@@ -964,11 +1074,554 @@ void fetchSED_PySEDMODEL(int EXTERNAL_ID, int NEWEVT_FLAG, double Trest, int MXL
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
   }
 
+  if ( USE_CACHE ) {
+    // new event: key needs the new model params
+    if ( NEWEVT_FLAG ) { fetchParVal_PySEDMODEL(Event_PySEDMODEL.PARVAL); }
+    NKEY = key_SEDCACHE(Trest, HOSTPAR_LIST, KEY, &Trest_eval);
+    store_SEDCACHE(NKEY, KEY, NLAM, LAM_SED, FLUX_SED);
+  }
+
   return;
 
 } // end fetchSED_PySEDMODEL
 
 
+// =================================================
+void fetchSED_BATCH_PySEDMODEL(int EXTERNAL_ID, int NEWEVT_FLAG, 
+			       int NOBS, double *TREST_LIST, int MXLAM, 
+			       int NHOSTPAR, double *HOSTPAR_LIST, 
+			       int *NLAM_SED, double *LAM_SED, 
+			       double **SED_BATCH) {
+
+  // Created Oct 2026
+  // Return rest-frame SEDs for all NOBS epochs with one python call.
+  // Trest values are written into a preallocated numpy array, and
+  // python method _fetchSED_batch returns a C-contiguous float64
+  // array with shape (NOBS, NLAM). *SED_BATCH points directly to this
+  // python buffer (no copy); the buffer is valid until the next call.
+  // NEWEVT_FLAG applies to the first epoch, as in fetchSED_PySEDMODEL.
+  //
+  // Inputs:
+  //   EXTERNAL_ID  :  SNID passed from main program
+  //   NEWEVT_FLAG  :  logical flag: True for new event
+  //   NOBS         :  number of epochs
+  //   TREST_LIST   :  rest frame epochs (Trest=0 at peak)
+  //   MXLAM        :  abort if *NLAM > MXLAM
+  //   NHOSTPAR, HOSTPAR_LIST : RV, AV, LOGMAS ...
+  //
+  // Output
+  //  *NLAM_SED  : number of wavelenth bins for SED
+  //  *LAM_SED   : array of wavelengths for SED
+  //  *SED_BATCH : pointer to NOBS x NLAM fluxes 
+
+  char fnam[] = "fetchSED_BATCH_PySEDMODEL" ;
+
+  // ------------ BEGIN -----------
+
+  *NLAM_SED = 0 ; 
+
+#ifdef USE_PYTHON
+  PyObject *pLAM, *pTrest, *pHOSTPARS ;
+  Py_buffer bufLAM = {NULL, NULL};
+  int NLAM, o, ihost, MXOBS ;
+
+  // release SED buffer from previous call
+  if ( pSED_BATCH != NULL ) {
+    PyBuffer_Release(&bufSED_BATCH);
+    Py_DECREF(pSED_BATCH);
+    pSED_BATCH = NULL ;
+  }
+
+  // (re)allocate numpy array for Trest
+  if ( pTREST_BATCH == NULL || bufTREST_BATCH.len < NOBS*sizeof(double) ) {
+    if ( pTREST_BATCH != NULL ) 
+      { PyBuffer_Release(&bufTREST_BATCH);  Py_DECREF(pTREST_BATCH); }
+    MXOBS = NOBS + 100 ;
+    pTREST_BATCH = PyObject_CallFunction(numpy_empty, "(iO)", 
+					 MXOBS, numpy_double);
+    handle_python_exception(fnam, "creating numpy array for Trest");
+    if (PyObject_GetBuffer(pTREST_BATCH, &bufTREST_BATCH, PyBUF_CONTIG) != 0)
+      { handle_python_exception(fnam, "setting buffer from pTREST_BATCH"); }
+  }
+  for(o=0; o < NOBS; o++ ) 
+    { ((double*)bufTREST_BATCH.buf)[o] = TREST_LIST[o]; }
+  pTrest = PySequence_GetSlice(pTREST_BATCH, 0, NOBS);
+
+  pHOSTPARS = PyTuple_New(NHOSTPAR);
+  for(ihost=0; ihost < NHOSTPAR; ihost++ ) 
+    { PyTuple_SetItem(pHOSTPARS,ihost,PyFloat_FromDouble(HOSTPAR_LIST[ihost])); }
+
+  // wavelengths
+  pLAM = PyObject_CallObject(pmeth_fetchSED_LAM, NULL);
+  handle_python_exception(fnam, "calling _fetchSED_LAM method");
+  if (PyObject_GetBuffer(pLAM, &bufLAM, PyBUF_C_CONTIGUOUS) != 0) 
+    { handle_python_exception(fnam, "setting buffer from pLAM"); }
+  NLAM = bufLAM.len / sizeof(double);
+  if (NLAM >= MXLAM ) {
+    sprintf(c1err,"NLAM=%d exceeds bound of %d", NLAM, MXLAM);
+    sprintf(c2err,"NOBS=%d  Trest[0]=%.2f ", NOBS, TREST_LIST[0] );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+  memcpy(LAM_SED, bufLAM.buf, NLAM*sizeof(double));
+  PyBuffer_Release(&bufLAM);
+  Py_DECREF(pLAM);
+
+  // SEDs for all epochs
+  pSED_BATCH = PyObject_CallFunction(pmeth_fetchSED_batch, "(OiiiO)", 
+				     pTrest, MXLAM, EXTERNAL_ID, NEWEVT_FLAG,
+				     pHOSTPARS);
+  handle_python_exception(fnam, "calling _fetchSED_batch method");
+  if (PyObject_GetBuffer(pSED_BATCH, &bufSED_BATCH, PyBUF_C_CONTIGUOUS) != 0) 
+    { handle_python_exception(fnam, "setting buffer from pSED_BATCH"); }
+
+  if ( bufSED_BATCH.len != (Py_ssize_t)NOBS*NLAM*sizeof(double) ) {
+    sprintf(c1err,"_fetchSED_batch returned %d bytes", (int)bufSED_BATCH.len);
+    sprintf(c2err,"Expected NOBS x NLAM = %d x %d float64", NOBS, NLAM);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  *SED_BATCH = (double*)bufSED_BATCH.buf ;
+  *NLAM_SED  = NLAM ;
+
+  Py_DECREF(pTrest);
+  Py_DECREF(pHOSTPARS);
+#endif
+
+  return ;
+
+} // end fetchSED_BATCH_PySEDMODEL
+
+
+// =======================================================
+//
+//   SED CACHE  (Oct 2026)
+//
+// =======================================================
+
+// entry in memory tier; hash handle for uthash
+typedef struct SEDCACHE_ENTRY {
+  unsigned long long HASH ;
+  int       NKEY ;
+  long long *KEY ;
+  double    *SED ;
+  UT_hash_handle hh;
+} SEDCACHE_ENTRY ;
+
+SEDCACHE_ENTRY *SEDCACHE_TABLE = NULL ;
+
+// =================================================
+void init_SEDCACHE_PySEDMODEL(double DTREST, double DPAR, double MXMB,
+			      char *DIR) {
+
+  // Created Oct 2026
+  // Init optional SED cache; called after init_genmag_PySEDMODEL.
+  // Inputs:
+  //   DTREST : Trest quantum (days); DTREST <= 0 -> no cache
+  //   DPAR   : quantum for model & host params; 0 -> exact match
+  //   MXMB   : memory limit (MB); oldest entries are evicted
+  //   DIR    : optional directory for disk tier shared among jobs;
+  //            blank or NULL -> memory tier only.
+  //
+  // SEDs are evaluated at the quantized Trest (Trest_eval), so the
+  // cached SED is exact for the key and the phase error is below
+  // DTREST/2. The model must be deterministic given PARVAL, HOSTPAR
+  // and Trest; e.g., AGN has a time-correlated state, and thus no cache.
+  // Note that ARGLIST is not part of the key so that jobs with
+  // different RANSEED share the disk tier; ARGLIST options that change
+  // the SED model require a separate DIR.
+
+  char *MODEL_NAME = INPUTS_PySEDMODEL.MODEL_NAME ;
+  unsigned long long h ;
+  int  i ;
+  char fnam[] = "init_SEDCACHE_PySEDMODEL" ;
+
+  // ------------ BEGIN -----------
+
+  SEDCACHE_PySEDMODEL.USE         = false ;
+  SEDCACHE_PySEDMODEL.NLAM        = 0 ;
+  SEDCACHE_PySEDMODEL.LAM         = NULL ;
+  SEDCACHE_PySEDMODEL.MXOBS_BATCH = 0 ;
+  SEDCACHE_PySEDMODEL.SED_BATCH   = NULL ;
+  SEDCACHE_PySEDMODEL.MEM_MB      = 0.0 ;
+  SEDCACHE_PySEDMODEL.NLOOKUP     = 0 ;
+  SEDCACHE_PySEDMODEL.NHIT_MEM    = 0 ;
+  SEDCACHE_PySEDMODEL.NHIT_DISK   = 0 ;
+  SEDCACHE_PySEDMODEL.NEVICT      = 0 ;
+  SEDCACHE_PySEDMODEL.NWRITE_DISK = 0 ;
+  SEDCACHE_PySEDMODEL.DIR[0]      = 0 ;
+
+  if ( DTREST <= 0.0 ) { return; }
+
+  if ( strcmp(MODEL_NAME,MODEL_NAME_AGN) == 0 ) {
+    printf("\n   WARNING: %s SED cache disabled for %s "
+	   "(time-correlated model)\n", MODEL_NAME, MODEL_NAME);
+    fflush(stdout);
+    return ;
+  }
+
+  SEDCACHE_PySEDMODEL.USE    = true ;
+  SEDCACHE_PySEDMODEL.DTREST = DTREST ;
+  SEDCACHE_PySEDMODEL.DPAR   = DPAR ;
+  SEDCACHE_PySEDMODEL.MXMB   = MXMB ;
+
+  if ( DIR != NULL && strlen(DIR) > 0 && !IGNOREFILE(DIR) ) {
+    sprintf(SEDCACHE_PySEDMODEL.DIR, "%s", DIR);
+    ENVreplace(SEDCACHE_PySEDMODEL.DIR, fnam, 1);
+    mkdir(SEDCACHE_PySEDMODEL.DIR, 0775);  // ok if it already exists
+    if ( access(SEDCACHE_PySEDMODEL.DIR, W_OK) != 0 ) {
+      sprintf(c1err,"Cannot write to SED cache dir");
+      sprintf(c2err,"%s", SEDCACHE_PySEDMODEL.DIR);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+  }
+
+  // model hash defines the meaning of each key; it is the
+  // first word hashed for each entry, and is stored in disk files.
+  h = 1469598103934665603ULL ;
+  for(i=0; i < strlen(MODEL_NAME); i++ ) 
+    { h = (h ^ (unsigned char)MODEL_NAME[i]) * 1099511628211ULL ; }
+  for(i=0; i < strlen(INPUTS_PySEDMODEL.PATH); i++ ) 
+    { h = (h ^ (unsigned char)INPUTS_PySEDMODEL.PATH[i]) * 1099511628211ULL; }
+  SEDCACHE_PySEDMODEL.HASH_MODEL = h ;
+  {
+    long long KEYMODEL[4] ;
+    memcpy(&KEYMODEL[0], &DTREST, sizeof(double));
+    memcpy(&KEYMODEL[1], &DPAR,   sizeof(double));
+    KEYMODEL[2] = Event_PySEDMODEL.NPAR ;
+    KEYMODEL[3] = INPUTS_PySEDMODEL.NHOSTPAR ;
+    SEDCACHE_PySEDMODEL.HASH_MODEL = hash_SEDCACHE(4, KEYMODEL);
+  }
+
+  printf("\n   %s SED cache: DTREST=%.4f  DPAR=%g  MXMB=%.0f \n",
+	 MODEL_NAME, DTREST, DPAR, MXMB );
+  if ( strlen(SEDCACHE_PySEDMODEL.DIR) > 0 ) 
+    { printf("   %s SED cache dir: %s\n", 
+	     MODEL_NAME, SEDCACHE_PySEDMODEL.DIR ); }
+  fflush(stdout);
+
+  return ;
+
+} // end init_SEDCACHE_PySEDMODEL
+
+
+// =================================================
+int key_SEDCACHE(double Trest, double *HOSTPAR_LIST, 
+		 long long *KEY, double *Trest_eval) {
+
+  // Created Oct 2026
+  // Load cache KEY for this Trest, current Event_PySEDMODEL.PARVAL,
+  // and HOSTPAR_LIST. Return number of KEY elements.
+  // Output *Trest_eval is the quantized Trest to evaluate SED.
+
+  double DTREST = SEDCACHE_PySEDMODEL.DTREST ;
+  double DPAR   = SEDCACHE_PySEDMODEL.DPAR ;
+  int    NPAR     = Event_PySEDMODEL.NPAR ;
+  int    NHOSTPAR = INPUTS_PySEDMODEL.NHOSTPAR ;
+  int    NKEY = 0, ipar ;
+  double val ;
+
+  // ------------ BEGIN -----------
+
+  KEY[NKEY] = llround(Trest/DTREST) ;
+  *Trest_eval = (double)KEY[NKEY] * DTREST ;
+  NKEY++ ;
+
+  for(ipar=0; ipar < NPAR + NHOSTPAR; ipar++ ) {
+    if ( ipar < NPAR ) 
+      { val = Event_PySEDMODEL.PARVAL[ipar]; }
+    else
+      { val = HOSTPAR_LIST[ipar-NPAR]; }
+
+    if ( DPAR > 0.0 ) 
+      { KEY[NKEY] = llround(val/DPAR); }
+    else
+      { memcpy(&KEY[NKEY], &val, sizeof(double)); } // exact bits
+    NKEY++ ;
+  }
+
+  return NKEY ;
+
+} // end key_SEDCACHE
+
+
+// =================================================
+unsigned long long hash_SEDCACHE(int NKEY, long long *KEY) {
+
+  // Created Oct 2026
+  // Return 64-bit hash of HASH_MODEL and KEY[0:NKEY-1]
+  // (splitmix64 finalizer applied to each word).
+
+  unsigned long long h = SEDCACHE_PySEDMODEL.HASH_MODEL ;
+  unsigned long long z ;
+  int i;
+
+  for(i=0; i < NKEY; i++ ) {
+    z  = h + (unsigned long long)KEY[i] + 0x9E3779B97F4A7C15ULL ;
+    z  = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL ;
+    z  = (z ^ (z >> 27)) * 0x94D049BB133111EBULL ;
+    h  = z ^ (z >> 31) ;
+  }
+  return h ;
+
+} // end hash_SEDCACHE
+
+
+// =================================================
+int lookup_SEDCACHE(int NKEY, long long *KEY, double *SED) {
+
+  // Created Oct 2026
+  // If KEY is found in memory tier (or disk tier), load SED and
+  // return 1; else return 0. A disk hit is also stored in memory.
+  // Full KEY is compared to protect against hash collisions.
+
+  int  NLAM = SEDCACHE_PySEDMODEL.NLAM ;
+  unsigned long long HASH = hash_SEDCACHE(NKEY,KEY);
+  SEDCACHE_ENTRY *e ;
+  FILE *fp ;
+  int  NTMP[2], FOUND = 0 ;
+  unsigned long long HASH_MODEL ;
+  long long KEYTMP[MXKEY_SEDCACHE];
+  char file[MXPATHLEN] ;
+
+  // ------------ BEGIN -----------
+
+  SEDCACHE_PySEDMODEL.NLOOKUP++ ;
+  if ( NLAM == 0 ) { return 0; }
+
+  HASH_FIND(hh, SEDCACHE_TABLE, &HASH, sizeof(unsigned long long), e);
+  if ( e != NULL && e->NKEY == NKEY &&
+       memcmp(e->KEY, KEY, NKEY*sizeof(long long)) == 0 ) {
+    memcpy(SED, e->SED, NLAM*sizeof(double));
+    SEDCACHE_PySEDMODEL.NHIT_MEM++ ;
+    return 1 ;
+  }
+
+  if ( strlen(SEDCACHE_PySEDMODEL.DIR) == 0 ) { return 0; }
+
+  sprintf(file, "%s/%016llx.SED", SEDCACHE_PySEDMODEL.DIR, HASH);
+  fp = fopen(file, "rb");
+  if ( !fp ) { return 0; }
+
+  if ( fread(&HASH_MODEL, sizeof(HASH_MODEL), 1, fp)  == 1 &&
+       fread(NTMP, sizeof(int), 2, fp)                 == 2 &&
+       HASH_MODEL == SEDCACHE_PySEDMODEL.HASH_MODEL       &&
+       NTMP[0] == NKEY && NTMP[1] == NLAM                 &&
+       fread(KEYTMP, sizeof(long long), NKEY, fp) == NKEY &&
+       memcmp(KEYTMP, KEY, NKEY*sizeof(long long)) == 0   &&
+       fread(SED, sizeof(double), NLAM, fp) == NLAM ) 
+    { FOUND = 1; }
+  fclose(fp);
+
+  if ( FOUND ) {
+    SEDCACHE_PySEDMODEL.NHIT_DISK++ ;
+    store_SEDCACHE(-NKEY, KEY, NLAM, NULL, SED); // memory tier only
+  }
+  return FOUND ;
+
+} // end lookup_SEDCACHE
+
+
+// =================================================
+void store_SEDCACHE(int NKEY, long long *KEY, int NLAM, double *LAM, 
+		    double *SED) {
+
+  // Created Oct 2026
+  // Store SED in memory tier, and also in disk tier if NKEY > 0.
+  // NKEY < 0 -> store |NKEY| key elements in memory tier only.
+  // LAM is stored with the first SED; LAM=NULL is ok after that.
+  // If memory exceeds MXMB, the oldest entries are evicted.
+  // Disk file is written to a temp file and renamed, so that jobs 
+  // sharing DIR never read a partial file.
+
+  bool  WR_DISK = ( NKEY > 0 && strlen(SEDCACHE_PySEDMODEL.DIR) > 0 );
+  unsigned long long HASH ;
+  double MEM_MB ;
+  SEDCACHE_ENTRY *e ;
+  FILE *fp ;
+  int  NTMP[2] ;
+  char file[MXPATHLEN], file_tmp[MXPATHLEN] ;
+  char fnam[] = "store_SEDCACHE" ;
+
+  // ------------ BEGIN -----------
+
+  if ( NKEY < 0 ) { NKEY = -NKEY; }
+
+  if ( SEDCACHE_PySEDMODEL.NLAM == 0 ) {
+    if ( LAM == NULL ) { return; }
+    SEDCACHE_PySEDMODEL.NLAM = NLAM ;
+    SEDCACHE_PySEDMODEL.LAM  = (double*) malloc(NLAM*sizeof(double));
+    memcpy(SEDCACHE_PySEDMODEL.LAM, LAM, NLAM*sizeof(double));
+  }
+  else if ( NLAM != SEDCACHE_PySEDMODEL.NLAM ) {
+    sprintf(c1err,"NLAM=%d differs from first cached SED (NLAM=%d)",
+	    NLAM, SEDCACHE_PySEDMODEL.NLAM);
+    sprintf(c2err,"SED cache requires fixed wavelength bins.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  HASH = hash_SEDCACHE(NKEY,KEY);
+  HASH_FIND(hh, SEDCACHE_TABLE, &HASH, sizeof(unsigned long long), e);
+  if ( e != NULL ) { return; }  // already stored (or collision)
+
+  MEM_MB = (double)( sizeof(SEDCACHE_ENTRY) + NKEY*sizeof(long long) +
+		     NLAM*sizeof(double) ) * 1.0E-6 ;
+
+  // evict oldest entries (uthash keeps insertion order)
+  while ( SEDCACHE_TABLE != NULL && 
+	  SEDCACHE_PySEDMODEL.MEM_MB + MEM_MB > SEDCACHE_PySEDMODEL.MXMB ) {
+    e = SEDCACHE_TABLE ;
+    HASH_DEL(SEDCACHE_TABLE, e);
+    free(e->KEY);  free(e->SED);  free(e);
+    SEDCACHE_PySEDMODEL.MEM_MB -= MEM_MB ;
+    SEDCACHE_PySEDMODEL.NEVICT++ ;
+  }
+
+  if ( MEM_MB <= SEDCACHE_PySEDMODEL.MXMB ) {
+    e       = (SEDCACHE_ENTRY*) malloc(sizeof(SEDCACHE_ENTRY));
+    e->HASH = HASH ;
+    e->NKEY = NKEY ;
+    e->KEY  = (long long*) malloc(NKEY*sizeof(long long));
+    e->SED  = (double   *) malloc(NLAM*sizeof(double));
+    memcpy(e->KEY, KEY, NKEY*sizeof(long long));
+    memcpy(e->SED, SED, NLAM*sizeof(double));
+    HASH_ADD(hh, SEDCACHE_TABLE, HASH, sizeof(unsigned long long), e);
+    SEDCACHE_PySEDMODEL.MEM_MB += MEM_MB ;
+  }
+
+  if ( !WR_DISK ) { return; }
+
+  sprintf(file,     "%s/%016llx.SED", SEDCACHE_PySEDMODEL.DIR, HASH);
+  sprintf(file_tmp, "%s.%d.TMP", file, (int)getpid() );
+  fp = fopen(file_tmp, "wb");
+  if ( !fp ) { return; }  // disk tier is optional; don't abort
+  NTMP[0] = NKEY;  NTMP[1] = NLAM;
+  fwrite(&SEDCACHE_PySEDMODEL.HASH_MODEL, 
+	 sizeof(unsigned long long), 1, fp);
+  fwrite(NTMP, sizeof(int),       2,    fp);
+  fwrite(KEY,  sizeof(long long), NKEY, fp);
+  fwrite(SED,  sizeof(double),    NLAM, fp);
+  fclose(fp);
+  if ( rename(file_tmp, file) == 0 ) 
+    { SEDCACHE_PySEDMODEL.NWRITE_DISK++ ; }
+  else
+    { remove(file_tmp); }
+
+  return ;
+
+} // end store_SEDCACHE
+
+
+// =================================================
+void fetchSED_BATCH_SEDCACHE(int EXTERNAL_ID, int NEWEVT_FLAG, 
+			     int NOBS, double *TREST_LIST, int MXLAM, 
+			     int NHOSTPAR, double *HOSTPAR_LIST, 
+			     int *NLAM_SED, double *LAM_SED, 
+			     double **SED_BATCH) {
+
+  // Created Oct 2026
+  // Same as fetchSED_BATCH_PySEDMODEL, but each SED is first looked
+  // up in the SED cache; python is called only for the missing
+  // epochs. For a new event, the first epoch always calls python 
+  // (new_event=1) to generate the model params (PARVAL) that are
+  // needed for the cache key.
+  // Output *SED_BATCH points to a C-owned array (NOBS x NLAM).
+
+  int  NLAM, NLAM_PY, o, o_start = 0, m, NMISS = 0, NKEY ;
+  long long KEY[MXKEY_SEDCACHE];
+  double Trest_eval, *SED_PY, *SED ;
+  double *TREST_MISS = (double*) malloc( (NOBS+1)*sizeof(double) );
+  int    *IOBS_MISS  = (int   *) malloc( (NOBS+1)*sizeof(int)    );
+
+  // ------------ BEGIN -----------
+
+  if ( NEWEVT_FLAG ) {
+    key_SEDCACHE(TREST_LIST[0], HOSTPAR_LIST, KEY, &Trest_eval);
+    fetchSED_BATCH_PySEDMODEL(EXTERNAL_ID, NEWEVT_FLAG, 1, &Trest_eval, 
+			      MXLAM, NHOSTPAR, HOSTPAR_LIST, 
+			      &NLAM_PY, LAM_SED, &SED_PY);
+    fetchParVal_PySEDMODEL(Event_PySEDMODEL.PARVAL);
+    NKEY = key_SEDCACHE(TREST_LIST[0], HOSTPAR_LIST, KEY, &Trest_eval);
+    store_SEDCACHE(NKEY, KEY, NLAM_PY, LAM_SED, SED_PY);
+    SEDCACHE_PySEDMODEL.NLOOKUP++ ;  // count as lookup that missed
+    o_start = 1;
+  }
+
+  NLAM = SEDCACHE_PySEDMODEL.NLAM ;
+  if ( NLAM == 0 ) {
+    // wavelengths not yet known; nothing to look up
+    fetchSED_BATCH_PySEDMODEL(EXTERNAL_ID, NEWEVT_FLAG, NOBS, TREST_LIST, 
+			      MXLAM, NHOSTPAR, HOSTPAR_LIST, 
+			      NLAM_SED, LAM_SED, SED_BATCH);
+    free(TREST_MISS); free(IOBS_MISS);
+    return ;
+  }
+
+  if ( NOBS > SEDCACHE_PySEDMODEL.MXOBS_BATCH ) {
+    SEDCACHE_PySEDMODEL.MXOBS_BATCH = NOBS + 100 ;
+    SEDCACHE_PySEDMODEL.SED_BATCH = (double*)
+      realloc(SEDCACHE_PySEDMODEL.SED_BATCH, 
+	      (size_t)SEDCACHE_PySEDMODEL.MXOBS_BATCH*NLAM*sizeof(double));
+  }
+  SED = SEDCACHE_PySEDMODEL.SED_BATCH ;
+
+  if ( o_start == 1 ) { memcpy(SED, SED_PY, NLAM*sizeof(double)); }
+
+  for(o=o_start; o < NOBS; o++ ) {
+    NKEY = key_SEDCACHE(TREST_LIST[o], HOSTPAR_LIST, KEY, &Trest_eval);
+    if ( lookup_SEDCACHE(NKEY, KEY, &SED[o*NLAM]) ) { continue; }
+    TREST_MISS[NMISS] = Trest_eval ;
+    IOBS_MISS[NMISS]  = o ;
+    NMISS++ ;
+  }
+
+  if ( NMISS > 0 ) {
+    fetchSED_BATCH_PySEDMODEL(EXTERNAL_ID, 0, NMISS, TREST_MISS, 
+			      MXLAM, NHOSTPAR, HOSTPAR_LIST, 
+			      &NLAM_PY, LAM_SED, &SED_PY);
+    for(m=0; m < NMISS; m++ ) {
+      o = IOBS_MISS[m];
+      memcpy(&SED[o*NLAM], &SED_PY[m*NLAM], NLAM*sizeof(double));
+      NKEY = key_SEDCACHE(TREST_LIST[o], HOSTPAR_LIST, KEY, &Trest_eval);
+      store_SEDCACHE(NKEY, KEY, NLAM_PY, LAM_SED, &SED[o*NLAM]);
+    }
+  }
+
+  memcpy(LAM_SED, SEDCACHE_PySEDMODEL.LAM, NLAM*sizeof(double));
+  *NLAM_SED  = NLAM ;
+  *SED_BATCH = SED ;
+
+  free(TREST_MISS); free(IOBS_MISS);
+  return ;
+
+} // end fetchSED_BATCH_SEDCACHE
+
+
+// =================================================
+void end_SEDCACHE_PySEDMODEL(void) {
+
+  // Created Oct 2026
+  // Print SED cache statistics.
+
+  long long NLOOKUP = SEDCACHE_PySEDMODEL.NLOOKUP ;
+  long long NHIT    = 
+    SEDCACHE_PySEDMODEL.NHIT_MEM + SEDCACHE_PySEDMODEL.NHIT_DISK ;
+
+  if ( !SEDCACHE_PySEDMODEL.USE ) { return; }
+
+  printf("\n   %s SED cache: %lld lookups, %lld memory hits, "
+	 "%lld disk hits (%.1f%%)\n", 
+	 INPUTS_PySEDMODEL.MODEL_NAME, NLOOKUP, 
+	 SEDCACHE_PySEDMODEL.NHIT_MEM, SEDCACHE_PySEDMODEL.NHIT_DISK,
+	 100.0*(double)NHIT/(double)(NLOOKUP > 0 ? NLOOKUP : 1) );
+  printf("   %s SED cache: %.1f MB in memory, %lld evicted, "
+	 "%lld written to disk\n", 
+	 INPUTS_PySEDMODEL.MODEL_NAME, SEDCACHE_PySEDMODEL.MEM_MB, 
+	 SEDCACHE_PySEDMODEL.NEVICT, SEDCACHE_PySEDMODEL.NWRITE_DISK );
+  fflush(stdout);
+
+} // end end_SEDCACHE_PySEDMODEL
+
+
 // =====================================================
 void INTEG_zSED_PySEDMODEL(int OPT_SPEC, int ifilt_obs, double Tobs,
 			   double zHEL, double x0,
@@ -1016,6 +1669,8 @@ void INTEG_zSED_PySEDMODEL(int OPT_SPEC, int ifilt_obs, double Tobs,
   //    use GENSMEAR.MAGSMEAR_LIST[ilamobs] instead of 
   //    undefined/obsolsete magSmear[ilamobs]
   //
+  // Oct 15 2026: use cached get_ZMAP_SEDMODEL for broadband filters.
+  //
 
   int    ifilt          = IFILTMAP_SEDMODEL[ifilt_obs] ;
   int    NLAMFILT       = FILTER_SEDMODEL[ifilt].NLAM ;
@@ -1033,8 +1688,9 @@ void INTEG_zSED_PySEDMODEL(int OPT_SPEC, int ifilt_obs, double Tobs,
   double MODELNORM_Fspec   = lamstep_filt ;
   double FLUXSUM_MIN       = 1.0E-30 ;
 
-  int    ilamobs, ilamsed, ISTAT_SMEAR ;
+  int    ilamobs, ilamsed, imap, ISTAT_SMEAR ;
   double TRANS, MWXT_FRAC, HOSTXT_FRAC;
+  ZMAP_SEDMODEL_DEF *ZMAP ;
   double LAMOBS, LAMSED, LAMSED_MIN, LAMSED_MAX;
   double LAMSED_STEP, LAMSPEC_STEP, LAMRATIO ;
   double TMPLAM[3], TMPSED[3];
@@ -1086,6 +1742,40 @@ void INTEG_zSED_PySEDMODEL(int OPT_SPEC, int ifilt_obs, double Tobs,
 
   LAMSED_STEP = lamstep_filt ;
 
+  // Oct 15 2026: broadband filter uses lambda-bin map cached vs. 
+  //    redshift; avoids quickBinSearch for each bin and epoch.
+  if ( !OPT_SPEC && !DO_SPECTROGRAPH ) {
+    ZMAP = get_ZMAP_SEDMODEL(ifilt, zHEL, minlam_SED, maxlam_SED,
+			     NLAM, LAM, 0.0);
+    for ( imap=0; imap < ZMAP->NLAM; imap++ ) {
+      ilamobs = ZMAP->ILAMOBS[imap] ;
+      ilamsed = ZMAP->ILAMSED[imap] ;
+      LAMSED  = ZMAP->LAMSED[imap] ;
+      TRANS   = ZMAP->TRANS[imap] ;
+      if ( ilamsed >= NLAM-2 ) { ilamsed=NLAM-3; }
+
+      MWXT_FRAC  = SEDMODEL_TABLE_MWXT_FRAC[ifilt][ilamobs] ;
+      if( RV_host > 1.0E-9 && AV_host > 1.0E-9 )
+	{ HOSTXT_FRAC = SEDMODEL_TABLE_HOSTXT_FRAC[ifilt][ilamobs] ; }
+      else
+	{ HOSTXT_FRAC = 1.0 ; } 
+
+      TMPLAM[0]=LAM[ilamsed+0];  TMPSED[0]=SED[ilamsed+0];
+      TMPLAM[1]=LAM[ilamsed+1];  TMPSED[1]=SED[ilamsed+1];
+      TMPLAM[2]=LAM[ilamsed+2];  TMPSED[2]=SED[ilamsed+2];
+      FTMP = quadInterp( LAMSED, TMPLAM, TMPSED, fnam);
+
+      if ( ISTAT_SMEAR ) {
+	arg     = -0.4*GENSMEAR.MAGSMEAR_LIST[ilamobs];
+	FSMEAR  =  pow(TEN,arg)  ;
+	FTMP   *=  FSMEAR;
+      }
+
+      Finteg_filter += (FTMP * HOSTXT_FRAC*MWXT_FRAC * LAMSED*TRANS);
+    }
+    goto STORE_FINTEG ;
+  }
+
   for ( ilamobs=0; ilamobs < NLAMFILT; ilamobs++ ) {
 
     TRANS  = FILTER_SEDMODEL[ifilt].transSN[ilamobs] ;
@@ -1163,6 +1853,7 @@ void INTEG_zSED_PySEDMODEL(int OPT_SPEC, int ifilt_obs, double Tobs,
 
   // - - - - - - -
   // store integrated flux in passband
+ STORE_FINTEG:
   *Finteg = (Finteg_filter * x0 * MODELNORM_Finteg);
 
   if ( *Finteg < FLUXSUM_MIN ) { *FLAG_Finteg = (int)MAG_ZEROFLUX; }
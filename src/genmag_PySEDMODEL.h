@@ -2,6 +2,8 @@
 // Sep 30 2022: MXPAR_PySEDMODEL -> 100 (was 20) for BAYESN
 // Nov 20 2020: MXPAR_PySEDMODEL -> 20 (was 10) for SNEMO
 // Nov 11 2021: Add BayeSN
+// Oct 15 2026: add batched SED fetch (Event_PySEDMODEL.SED_BATCH)
+// Oct 15 2026: add optional SED cache (SEDCACHE_PySEDMODEL)
 
 // define pre-processor command to use python interface
 
@@ -22,6 +24,7 @@ struct {
   char *PATH, *ARGLIST, *NAMES_HOSTPAR ;
   char *NAME_ARRAY_HOSTPAR[MXHOSTPAR_PySEDMODEL] ;
   int  OPTMASK;
+  int  NHOSTPAR ;  // number of names in NAMES_HOSTPAR
 
   // stuff determined from inputs above
   char  MODEL_NAME[40] ; // e.g., BYOSED, SNEMO ....
@@ -39,9 +42,40 @@ struct {
   int    NPAR ;
   char   **PARNAME;    // par names set during init stage
   double *PARVAL;      // par values update for each SED
+
+  // Oct 2026: batched SEDs for all epochs of one genmag call
+  int    MXOBS_BATCH ;   // size of TREST_BATCH
+  double *TREST_BATCH ;  // Trest for each epoch
+  double *SED_BATCH ;    // NOBS x NLAM; points to python buffer (no copy)
 } Event_PySEDMODEL ;
 
 
+// Oct 2026: optional SED cache keyed on quantized
+//   { Trest, model params (PARVAL), host params }.
+// Memory tier is a hash table in this process; optional disk tier
+// is a directory with one file per key, shared by jobs (e.g., biasCor
+// splits). Only valid for models whose SED is fully determined by
+// PARVAL, HOSTPAR and Trest.
+#define MXKEY_SEDCACHE  (1 + MXPAR_PySEDMODEL + MXHOSTPAR_PySEDMODEL)
+
+struct {
+  bool   USE ;
+  double DTREST ;         // Trest quantum (days) 
+  double DPAR ;           // param quantum; 0 -> exact match
+  double MXMB ;           // memory limit (MB) for memory tier
+  char   DIR[MXPATHLEN] ; // optional directory for disk tier
+  unsigned long long HASH_MODEL ; // hash of model name, path, quanta
+
+  int    NLAM ;           // same wavelength bins for all SEDs
+  double *LAM ;
+  int    MXOBS_BATCH ;
+  double *SED_BATCH ;     // NOBS x NLAM, C-owned (cf. Event_PySEDMODEL)
+
+  double MEM_MB ;
+  long long NLOOKUP, NHIT_MEM, NHIT_DISK, NEVICT, NWRITE_DISK ;
+} SEDCACHE_PySEDMODEL ;
+
+
 // ===========================================
 // function declarations
 void load_PySEDMODEL_CHOICE_LIST(void);
@@ -68,6 +102,24 @@ void fetchParVal_PySEDMODEL(double *parVal);
 void fetchSED_PySEDMODEL(int EXTERNAL_ID, int NEWEVT_FLAG, double Tobs,
 			 int MXLAM, double *HOSTPAR_LIST, int *NLAM,
 			 double *LAM, double *FLUX);
+void fetchSED_BATCH_PySEDMODEL(int EXTERNAL_ID, int NEWEVT_FLAG, 
+			       int NOBS, double *TREST_LIST, int MXLAM, 
+			       int NHOSTPAR, double *HOSTPAR_LIST, 
+			       int *NLAM, double *LAM, double **SED_BATCH);
+
+void init_SEDCACHE_PySEDMODEL(double DTREST, double DPAR, double MXMB,
+			      char *DIR);
+void fetchSED_BATCH_SEDCACHE(int EXTERNAL_ID, int NEWEVT_FLAG, 
+			     int NOBS, double *TREST_LIST, int MXLAM, 
+			     int NHOSTPAR, double *HOSTPAR_LIST, 
+			     int *NLAM, double *LAM, double **SED_BATCH);
+int  key_SEDCACHE(double Trest, double *HOSTPAR_LIST, 
+		  long long *KEY, double *Trest_eval);
+unsigned long long hash_SEDCACHE(int NKEY, long long *KEY);
+int  lookup_SEDCACHE(int NKEY, long long *KEY, double *SED);
+void store_SEDCACHE(int NKEY, long long *KEY, int NLAM, double *LAM, 
+		    double *SED);
+void end_SEDCACHE_PySEDMODEL(void);
 
 void INTEG_zSED_PySEDMODEL(int OPT_SPEC, int IFILT_OBS, double Tobs,
 			   double zHEL, double x0,
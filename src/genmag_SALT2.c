@@ -41,6 +41,36 @@
 
  Oct 01 2021: no longer set magerr=5.0 -> avoid LC fit discontinuity.
 
+ Oct 14 2026: new INTEG_zSED_SALT2_BATCH integrates all epochs of a
+              filter using precomputed SoA arrays (vectorizable loops).
+              Color-law & extinction products are cached per filter
+              and event key (z,c,RV,AV,MWEBV); genSmear handled in batch.
+              New genmag_SALT2_BATCH for all filters & epochs of an event.
+
+ Oct 15 2026: prep_INTEG_zSED_SALT2_BATCH uses lambda-bin map cached
+              vs. redshift (get_ZMAP_SEDMODEL in genmag_SEDtools.c).
+
+ Oct 15 2026: INTEG_zSED_SALT2_BATCH caches filter-integrated surfaces
+              per epoch; x0/x1 fit steps reuse them (see get_COMP_SALT2_BATCH).
+
+ Oct 15 2026: new dlnflux_SALT2 returns analytic dln(flux)/d(x0,x1,c,Tobs)
+              for the fitter's MINUIT gradient (snlc_fit OPT_SALT2_GRADIENT).
+
+ Oct 15 2026: optional node-local shared memory for template & error-map
+              tables (rd_sedFlux output); see rd_sedFlux_SALT2.
+              Enable with ENV SNANA_SALT2_SHM=1.
+
+ Oct 15 2026: new INTEG_zSED_SALT2_SPEC evaluates spectra (genSpec_SALT2,
+              getSpec_band_SALT2) with cached color-law/extinction 
+              sub-bin arrays and the same kernel as photometry.
+
+ Oct 15 2026: SALT2magerr uses error-map table pre-interpolated in
+              rest-lambda per filter & z (get_SALT2_ERRTABLE), so each
+              lookup is a 1D interpolation in Trest.
+
+ Oct 15 2026: INTEG_zSED_SALT2[_BATCH] are built with ATTR_TARGET_CLONES
+              (AVX2/AVX-512 versions selected at load; see sntools.h).
+
 *************************************/
 
 #include "sntools.h"           // community tools
@@ -52,6 +82,11 @@
 #include "genmag_SALT2.h" 
 #include "MWgaldust.h"
 
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
 // =======================================================
 // define mangled functions with underscore (for fortran)
 
@@ -74,6 +109,13 @@ void genmag_salt2__(int *OPTMASK, int *ifilt,
 }
 
 
+int dlnflux_salt2__(int *ifilt_obs, double *parList_SN, 
+		    double *parList_HOST, double *mwebv, double *z, 
+		    double *Tobs, double *DLNF) {
+  return dlnflux_SALT2(*ifilt_obs, parList_SN, parList_HOST, *mwebv,
+		       *z, *Tobs, DLNF);
+}
+
 double salt2x0calc_(double *alpha, double *beta, double *x1,   
 		    double *c, double *dlmag ) {
   double x0;
@@ -296,6 +338,8 @@ int init_genmag_SALT2(char *MODEL_VERSION, char *MODEL_EXTRAP_LATETIME,
   malloc_METADATA_SEDMODEL(SEDMODEL.NSURFACE, 0); 
   malloc_SEDFLUX_SEDMODEL(&TEMP_SEDMODEL,0,0,0);
 
+  init_SHM_SALT2();
+
   // ------- Now read the spectral templates -----------
 
   for ( ised = 0 ; ised < SEDMODEL.NSURFACE ; ised++ ) {
@@ -307,8 +351,7 @@ int init_genmag_SALT2(char *MODEL_VERSION, char *MODEL_EXTRAP_LATETIME,
 
     sprintf(sedcomment,"SALT%d-%d", IMODEL_SALT, ised);
 
-    rd_sedFlux(tmpFile, sedcomment, Trange, Lrange
-	       ,MXBIN_DAYSED_SEDMODEL, MXBIN_LAMSED_SEDMODEL, 0
+    rd_sedFlux_SALT2(tmpFile, sedcomment, Trange, Lrange
 	       ,&TEMP_SEDMODEL.NDAY, TEMP_SEDMODEL.DAY, &TEMP_SEDMODEL.DAYSTEP
 	       ,&TEMP_SEDMODEL.NLAM, TEMP_SEDMODEL.LAM, &TEMP_SEDMODEL.LAMSTEP
 	       ,TEMP_SEDMODEL.FLUX,  TEMP_SEDMODEL.FLUXERR
@@ -343,6 +386,8 @@ int init_genmag_SALT2(char *MODEL_VERSION, char *MODEL_EXTRAP_LATETIME,
   // abort if any ERRMAP has invalid wavelength range (Sep 2019)
   if ( ABORT_on_LAMRANGE_ERROR ) { check_lamRange_SALT2errmap(-1); }
   if ( ABORT_on_BADVALUE_ERROR ) { check_BADVAL_SALT2errmap(-1); }
+
+  init_SALT2_ERRTABLE();
   
 
   // fill/calculate color-law table vs. color and rest-lambda
@@ -467,6 +512,289 @@ int NSURFACE_SALT2(void) {
 
 } // NSURFACE_SALT2
 
+// ***********************************************
+void init_SHM_SALT2(void) {
+
+  // Created Oct 2026
+  // Check ENV to enable node-local shared memory for SALT2 tables.
+  // When many split jobs (e.g., snlc_fit) start on the same node,
+  // only the first job parses the text templates & error maps;
+  // the other jobs mmap the published tables.
+
+  char *ENVval = getenv(ENV_SHM_SALT2);
+  char fnam[] = "init_SHM_SALT2" ;
+
+  // ----------- BEGIN ------------
+
+  SALT2_SHM.USE   = false ;
+  SALT2_SHM.NLOAD = SALT2_SHM.NPUBLISH = 0 ;
+
+  if ( ENVval == NULL ) { return; }
+  if ( atoi(ENVval) <= 0 ) { return; }
+
+  SALT2_SHM.USE = true ;
+  printf("\t %s: share SALT2 tables via %s/%s_[hash] \n",
+	 fnam, DIR_SHM_SALT2, PREFIX_SHM_SALT2 );
+  fflush(stdout);
+
+  return ;
+
+} // end init_SHM_SALT2
+
+
+// ***********************************************
+void rd_sedFlux_SALT2(char *sedFile, char *sedcomment,
+		      double *Trange, double *Lrange,
+		      int *NDAY, double *DAY, double *DAYSTEP,
+		      int *NLAM, double *LAM, double *LAMSTEP,
+		      double *FLUX, double *FLUXERR, int *nflux_nan) {
+
+  // Created Oct 2026
+  // Wrapper for rd_sedFlux (OPTMASK=0) with same outputs.
+  // If SALT2_SHM.USE is set, the first job on a node to open
+  // shm file exclusively reads sedFile and publishes the table; 
+  // other jobs mmap the shm file and copy table (no text parsing).
+  // Shm file name includes hash of sedFile name, size, mod-time
+  // and read ranges, so that a modified model is never re-used.
+  // Any shm problem -> fall back to reading sedFile.
+
+  unsigned long long hash ;
+  char shmFile[MXPATHLEN];
+  int  fd ;
+
+  // ----------- BEGIN ------------
+
+  if ( SALT2_SHM.USE ) {
+    hash = hash_SHM_SALT2(sedFile, Trange, Lrange);
+    sprintf(shmFile, "%s/%s_%16.16llx", 
+	    DIR_SHM_SALT2, PREFIX_SHM_SALT2, hash);
+
+    fd = open(shmFile, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if ( fd < 0 ) {
+      if ( load_SHM_SALT2(shmFile, sedcomment, NDAY, DAY, DAYSTEP, 
+			  NLAM, LAM, LAMSTEP, FLUX, nflux_nan) ) 
+	{ return; }
+    }
+    else {
+      // this job publishes
+      rd_sedFlux(sedFile, sedcomment, Trange, Lrange
+		 ,MXBIN_DAYSED_SEDMODEL, MXBIN_LAMSED_SEDMODEL, 0
+		 ,NDAY, DAY, DAYSTEP, NLAM, LAM, LAMSTEP
+		 ,FLUX, FLUXERR, nflux_nan );
+      publish_SHM_SALT2(fd, shmFile, *NDAY, DAY, *DAYSTEP, 
+			*NLAM, LAM, *LAMSTEP, FLUX, *nflux_nan);
+      close(fd);
+      return ;
+    }
+  }
+
+  rd_sedFlux(sedFile, sedcomment, Trange, Lrange
+	     ,MXBIN_DAYSED_SEDMODEL, MXBIN_LAMSED_SEDMODEL, 0
+	     ,NDAY, DAY, DAYSTEP, NLAM, LAM, LAMSTEP
+	     ,FLUX, FLUXERR, nflux_nan );
+
+  return ;
+
+} // end rd_sedFlux_SALT2
+
+
+// ***********************************************
+unsigned long long hash_SHM_SALT2(char *sedFile, 
+				  double *Trange, double *Lrange) {
+
+  // Created Oct 2026
+  // Return 64-bit FNV-1a hash of sedFile name, size & mod-time,
+  // and of options that affect rd_sedFlux output.
+
+  unsigned long long hash  = 14695981039346656037ULL ;
+  unsigned long long prime = 1099511628211ULL ;
+  int    opt_list[3];
+  long long stat_list[2];
+  struct stat statbuf ;
+
+#define HASH_BYTES_SALT2(ptr,n) {					\
+    const unsigned char *b = (const unsigned char*)(ptr); size_t j;	\
+    for(j=0; j < (size_t)(n); j++ ) { hash ^= b[j]; hash *= prime; } }
+
+  // ----------- BEGIN ------------
+
+  opt_list[0] = VERSION_SHM_SALT2 ;
+  opt_list[1] = MXBIN_DAYSED_SEDMODEL ;
+  opt_list[2] = MXBIN_LAMSED_SEDMODEL ;
+  HASH_BYTES_SALT2(opt_list, sizeof(opt_list) );
+  HASH_BYTES_SALT2(Trange, 2*sizeof(double) );
+  HASH_BYTES_SALT2(Lrange, 2*sizeof(double) );
+
+  stat_list[0] = stat_list[1] = -1 ;
+  if ( stat(sedFile, &statbuf) == 0 ) {
+    stat_list[0] = (long long)statbuf.st_size ;
+    stat_list[1] = (long long)statbuf.st_mtime ;
+  }
+  HASH_BYTES_SALT2(sedFile, strlen(sedFile) );
+  HASH_BYTES_SALT2(stat_list, sizeof(stat_list) );
+
+  if ( hash == 0 ) { hash = 1; } 
+  return hash ;
+
+} // end hash_SHM_SALT2
+
+
+// ***********************************************
+void publish_SHM_SALT2(int fd, char *shmFile,
+		       int NDAY, double *DAY, double DAYSTEP,
+		       int NLAM, double *LAM, double LAMSTEP,
+		       double *FLUX, int nflux_nan) {
+
+  // Created Oct 2026
+  // Write rd_sedFlux table into shm file opened (exclusively) by
+  // this job. Layout:
+  //   HEAD[NHEAD] : MAGIC, VERSION, READY, NDAY, NLAM, nflux_nan, spare
+  //   DAYSTEP, LAMSTEP, DAY[NDAY], LAM[NLAM], FLUX[NDAY*NLAM]
+  // READY is set last so that readers never copy a partial table.
+  // On failure, shm file is removed and readers fall back to text.
+
+  long long NFLUX = (long long)NDAY * (long long)NLAM ;
+  long long SIZE, *HEAD ;
+  double *DPTR ;
+  char   *MAPBUF ;
+  char fnam[] = "publish_SHM_SALT2" ;
+
+  // ----------- BEGIN ------------
+
+  SIZE = NHEAD_SHM_SALT2*sizeof(long long) + 
+    (2 + NDAY + NLAM + NFLUX)*sizeof(double) ;
+
+  MAPBUF = MAP_FAILED ;
+  if ( ftruncate(fd, (off_t)SIZE) == 0 ) {
+    MAPBUF = (char*)mmap(NULL, (size_t)SIZE, PROT_READ | PROT_WRITE, 
+			 MAP_SHARED, fd, 0);
+  }
+
+  if ( MAPBUF == MAP_FAILED ) {
+    printf("\t %s: WARNING cannot write %s\n", fnam, shmFile);
+    fflush(stdout);
+    unlink(shmFile);
+    return ;
+  }
+
+  HEAD = (long long*)MAPBUF;
+  memcpy(MAPBUF, MAGIC_SHM_SALT2, 8);
+  HEAD[1] = VERSION_SHM_SALT2 ;
+  HEAD[3] = NDAY ;
+  HEAD[4] = NLAM ;
+  HEAD[5] = nflux_nan ;
+
+  DPTR = (double*)(HEAD + NHEAD_SHM_SALT2) ;
+  DPTR[0] = DAYSTEP ;
+  DPTR[1] = LAMSTEP ;   DPTR += 2 ;
+  memcpy(DPTR, DAY,  NDAY *sizeof(double));  DPTR += NDAY;
+  memcpy(DPTR, LAM,  NLAM *sizeof(double));  DPTR += NLAM;
+  memcpy(DPTR, FLUX, NFLUX*sizeof(double));
+
+  __sync_synchronize();
+  HEAD[2] = 1 ;  // READY
+  munmap(MAPBUF, (size_t)SIZE);
+
+  SALT2_SHM.NPUBLISH++ ;
+
+  return ;
+
+} // end publish_SHM_SALT2
+
+
+// ***********************************************
+bool load_SHM_SALT2(char *shmFile, char *sedcomment,
+		    int *NDAY, double *DAY, double *DAYSTEP,
+		    int *NLAM, double *LAM, double *LAMSTEP,
+		    double *FLUX, int *nflux_nan) {
+
+  // Created Oct 2026
+  // mmap shmFile published by another job, wait (up to TWAIT_SHM_SALT2
+  // seconds) for READY, check header, and copy table to output args.
+  // Returns false if shm table is not available or invalid.
+
+  int  NWAIT_MAX = 10*TWAIT_SHM_SALT2 ; // 0.1 sec per wait
+  int  nwait = 0, fd, NDAY_SHM, NLAM_SHM;
+  long long SIZE, SIZE_EXPECT, NFLUX ;
+  volatile long long *HEAD ;
+  struct stat st ;
+  double *DPTR ;
+  char   *MAPBUF ;
+  char fnam[] = "load_SHM_SALT2" ;
+
+  // ----------- BEGIN ------------
+
+  fd = open(shmFile, O_RDONLY);
+  if ( fd < 0 ) { return false; }
+
+  // wait for publisher to set size
+  SIZE = 0 ;
+  while ( nwait < NWAIT_MAX ) {
+    if ( fstat(fd, &st) != 0 ) { break; }
+    SIZE = (long long)st.st_size ;
+    if ( SIZE >= (long long)(NHEAD_SHM_SALT2*sizeof(long long)) ) { break; }
+    usleep(100000); nwait++ ;
+  }
+  if ( SIZE < (long long)(NHEAD_SHM_SALT2*sizeof(long long)) ) 
+    { close(fd); goto TIMEOUT; }
+
+  MAPBUF = (char*)mmap(NULL, (size_t)SIZE, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if ( MAPBUF == MAP_FAILED ) { return false; }
+
+  // wait for publisher to set READY
+  HEAD = (volatile long long*)MAPBUF;
+  while ( HEAD[2] == 0 && nwait < NWAIT_MAX ) 
+    { usleep(100000); nwait++ ; }
+  if ( HEAD[2] == 0 ) 
+    { munmap(MAPBUF, (size_t)SIZE); goto TIMEOUT; }
+  __sync_synchronize();
+
+  NDAY_SHM = (int)HEAD[3];
+  NLAM_SHM = (int)HEAD[4];
+  NFLUX    = (long long)NDAY_SHM * (long long)NLAM_SHM ;
+  SIZE_EXPECT = NHEAD_SHM_SALT2*sizeof(long long) + 
+    (2 + NDAY_SHM + NLAM_SHM + NFLUX)*sizeof(double) ;
+
+  if ( memcmp(MAPBUF, MAGIC_SHM_SALT2, 8) != 0      || 
+       HEAD[1] != VERSION_SHM_SALT2                  ||
+       NDAY_SHM <= 0 || NDAY_SHM > MXBIN_DAYSED_SEDMODEL ||
+       NLAM_SHM <= 0 || NLAM_SHM > MXBIN_LAMSED_SEDMODEL ||
+       SIZE != SIZE_EXPECT ) {
+    printf("\t %s: WARNING invalid %s -> ignore\n", fnam, shmFile);
+    fflush(stdout);
+    munmap(MAPBUF, (size_t)SIZE);
+    return false;
+  }
+
+  *NDAY      = NDAY_SHM ;
+  *NLAM      = NLAM_SHM ;
+  *nflux_nan = (int)HEAD[5] ;
+
+  DPTR = (double*)(MAPBUF + NHEAD_SHM_SALT2*sizeof(long long)) ;
+  *DAYSTEP = DPTR[0];
+  *LAMSTEP = DPTR[1];   DPTR += 2 ;
+  memcpy(DAY,  DPTR, NDAY_SHM*sizeof(double));  DPTR += NDAY_SHM;
+  memcpy(LAM,  DPTR, NLAM_SHM*sizeof(double));  DPTR += NLAM_SHM;
+  memcpy(FLUX, DPTR, NFLUX*sizeof(double));
+  munmap(MAPBUF, (size_t)SIZE);
+
+  printf("  Load  %s  SED from shared memory (NDAY=%d, NLAM=%d)\n",
+	 sedcomment, NDAY_SHM, NLAM_SHM );
+  fflush(stdout);
+  SALT2_SHM.NLOAD++ ;
+
+  return true ;
+
+ TIMEOUT:
+  printf("\t %s: WARNING %s not ready after %d sec -> read text\n",
+	 fnam, shmFile, TWAIT_SHM_SALT2 );
+  fflush(stdout);
+  return false ;
+
+} // end load_SHM_SALT2
+
+
 // ***********************************************
 void fill_SALT2_TABLE_SED(int ISED) {
 
@@ -484,6 +812,9 @@ void fill_SALT2_TABLE_SED(int ISED) {
   // Jul 30, 2016: call check_uniform_bins( ... )
   // May 05 2022: add abort protection when  F_orig=0.0 
   //          (for SALT2 surfaces computed with Jacobian method)
+  // Oct 15 2026: for spline option, quad-interp across lambda once for
+  //          each original DAY row (FLAM_ROW) instead of once per 
+  //          fine-binned DAY; table values are unchanged.
   //
 #define N1DBIN_SPLINE 3
 
@@ -498,7 +829,7 @@ void fill_SALT2_TABLE_SED(int ISED) {
     ,F2D_orig[N1DBIN_SPLINE][N1DBIN_SPLINE]
     ,F_interp, F_orig, FDIF, FSUM, FRATIO
     ,FDAY[N1DBIN_SPLINE],FRATIO_CHECK
-    ,*ptrLAM, *ptrDAY
+    ,*ptrLAM, *ptrDAY, *FLAM_ROW = NULL
     ;
 
   char 
@@ -586,6 +917,37 @@ void fill_SALT2_TABLE_SED(int ISED) {
   }
 
 
+  // --------------------------------------
+  // for spline option, interpolate each original DAY row across
+  // lambda onto fine LAM grid. Row depends only on IDAY_ORIG, so
+  // this is done once per row rather than for each fine DAY bin.
+
+  if ( INTERP_OPT == SALT2_INTERP_SPLINE ) {
+    FLAM_ROW = (double*)malloc(I8*NDAY_ORIG*NLAM_TABLE);
+    for ( ILAM=0; ILAM < NLAM_TABLE; ILAM++ ) {
+
+      // get lam-index on original grid
+      LAM       = SALT2_TABLE.LAMSED[ILAM]; // fine-binned lambda
+      DIF       = LAM - SALT2_TABLE.LAMMIN + 0.0001 ;
+      ILAM_ORIG = (int)(DIF/LAMSTEP_ORIG);
+
+      FRAC  = (LAM - TEMP_SEDMODEL.LAM[ILAM_ORIG])/LAMSTEP_ORIG ;
+      if ( FRAC < 0.5  &&  ILAM_ORIG > 0 ) { ILAM_ORIG-- ; }
+      if ( ILAM_ORIG > NLAM_ORIG - N1DBIN_SPLINE ) 
+	{ ILAM_ORIG = NLAM_ORIG - N1DBIN_SPLINE ; }
+
+      ptrLAM = &TEMP_SEDMODEL.LAM[ILAM_ORIG] ;
+      for ( iday=0; iday < NDAY_ORIG; iday++ ) {
+	for ( ilam=0; ilam < N1DBIN_SPLINE; ilam++ ) {
+	  jflux_orig  = NLAM_ORIG*iday + (ILAM_ORIG+ilam) ;
+	  F2D_orig[0][ilam] = TEMP_SEDMODEL.FLUX[jflux_orig] ;
+	}
+	FLAM_ROW[NLAM_TABLE*iday + ILAM] = 
+	  quadInterp( LAM, ptrLAM, F2D_orig[0], tagLAM);
+      }
+    }
+  }
+
   // --------------------------------------
   // store SED table.
 
@@ -615,29 +977,10 @@ void fill_SALT2_TABLE_SED(int ISED) {
 
       // the code below is for the spline option
 
-      // get lam-index on original grid
-      LAM       = SALT2_TABLE.LAMSED[ILAM]; // fine-binned lambda
-      DIF       = LAM - SALT2_TABLE.LAMMIN + 0.0001 ;
-      ILAM_ORIG = (int)(DIF/LAMSTEP_ORIG);
-
-      FRAC  = (LAM - TEMP_SEDMODEL.LAM[ILAM_ORIG])/LAMSTEP_ORIG ;
-      if ( FRAC < 0.5  &&  ILAM_ORIG > 0 ) { ILAM_ORIG-- ; }
-      if ( ILAM_ORIG > NLAM_ORIG - N1DBIN_SPLINE ) 
-	{ ILAM_ORIG = NLAM_ORIG - N1DBIN_SPLINE ; }
-
-      // build temp flux-grid around point to interpolate
-
-      ptrLAM = &TEMP_SEDMODEL.LAM[ILAM_ORIG] ;
+      // fetch lambda-interpolated flux for 3 DAY rows around DAY
       ptrDAY = &TEMP_SEDMODEL.DAY[IDAY_ORIG] ;
-
-      for ( iday=0; iday < N1DBIN_SPLINE; iday++ ) {
-	for ( ilam=0; ilam < N1DBIN_SPLINE; ilam++ ) {
-	  jflux_orig  = NLAM_ORIG*(IDAY_ORIG+iday) + (ILAM_ORIG+ilam) ;
-	  F2D_orig[iday][ilam] = TEMP_SEDMODEL.FLUX[jflux_orig] ;
-	}
-	// interpolate across lambda to get FDAY
-	FDAY[iday] = quadInterp( LAM, ptrLAM, F2D_orig[iday], tagLAM);
-      }
+      for ( iday=0; iday < N1DBIN_SPLINE; iday++ ) 
+	{ FDAY[iday] = FLAM_ROW[NLAM_TABLE*(IDAY_ORIG+iday) + ILAM] ; }
 
       // Now interpolate across DAY
       F_interp = quadInterp( DAY, ptrDAY, FDAY, tagDAY);
@@ -662,6 +1005,8 @@ void fill_SALT2_TABLE_SED(int ISED) {
     } // ILAM
   } // IDAY
 
+  if ( FLAM_ROW != NULL ) { free(FLAM_ROW); }
+
 
 
   // Now an idiot check.
@@ -929,8 +1274,7 @@ void read_SALT2errmaps(double Trange[2], double Lrange[2] ) {
     sprintf(tmpFile, "%s/%s", SALT2_MODELPATH, SALT2_ERRMAP_FILES[imap] );
     sprintf(sedcomment, "SALT%d-%s", IMODEL_SALT, SALT2_ERRMAP_COMMENT[imap] );
 
-    rd_sedFlux(tmpFile, sedcomment, Trange, Lrange
-	       ,MXBIN_DAYSED_SEDMODEL, MXBIN_LAMSED_SEDMODEL, 0   // inputs
+    rd_sedFlux_SALT2(tmpFile, sedcomment, Trange, Lrange   // inputs
 	       ,&SALT2_ERRMAP[imap].NDAY    // outputs
 	       ,SALT2_ERRMAP[imap].DAY      // idem ...
 	       ,&SALT2_ERRMAP[imap].DAYSTEP
@@ -2075,6 +2419,8 @@ void genmag_SALT2(
 
  Dec 28 2023: pass x2 = parlist_SN[4] if SALT3 model includes M2 component.
 
+ Oct 14 2026: integrate all epochs with INTEG_zSED_SALT2_BATCH.
+
   ***/
 
   double x0        = parList_SN[0];
@@ -2089,7 +2435,7 @@ void genmag_SALT2(
 
   double 
     meanlam_obs,  meanlam_rest, ZP, z1
-    ,Tobs, Tobs_interp, Trest, Trest_interp, flux, flux_interp
+    ,Tobs, Trest, Trest_interp, flux, flux_interp
     ,arg, magerr, Finteg, Finteg_errPar, FspecDum[10]
     ,lamrest_forErr, Trest_forErr, z1_forErr, magobs_tmp, magobs
     ;
@@ -2142,19 +2488,23 @@ void genmag_SALT2(
   fill_TABLE_MWXT_SEDMODEL(MWXT_SEDMODEL.RV, mwebv);
   fill_TABLE_HOSTXT_SEDMODEL(RV_host, AV_host, z);   // July 2016
 
-  //determine integer times which sandwich the times in Tobs
+  // determine Trest_interp for each epoch, and then integrate
+  // all epochs of this filter in one batch call (Oct 2026)
+  int     MEMD = (Nobs+1) * sizeof(double);
+  double *Tobs_interp_list   = (double*) malloc(MEMD);
+  double *Finteg_list        = (double*) malloc(MEMD);
+  double *Finteg_errPar_list = (double*) malloc(MEMD);
+  bool   *DO_EXTRAP_LIST     = (bool  *) malloc((Nobs+1)*sizeof(bool));
+  double DAYMIN_EXTRAP = INPUT_EXTRAP_LATETIME_Ia.DAYMIN ;
 
   for ( epobs=0; epobs < Nobs; epobs++ ) {
 
-    Tobs = Tobs_list[epobs];
+    Tobs  = Tobs_list[epobs];
     Trest = Tobs / z1 ;
 
     DO_EXTRAP_LOCAL = false;
     Trest_interp = Trest; 
 
-    flux = FLUX_UNDEFINED ;
-
-    // - - - - - -
     // check for phase extrapolation
     if ( Trest <= SALT2_TABLE.DAYMIN+epsT )
       { DO_EXTRAP_LOCAL = true;  Trest_interp = SALT2_TABLE.DAYMIN+epsT ; }
@@ -2165,17 +2515,31 @@ void genmag_SALT2(
       { DO_EXTRAP_LOCAL = true;  Trest_interp = SALT2_TABLE.DAYMAX-epsT ; }
 
     // check mag-extrap option for late times (June 25 2018)
-    double DAYMIN_EXTRAP = INPUT_EXTRAP_LATETIME_Ia.DAYMIN ;
     if ( EXTRAP_METHOD_MAG && Trest > DAYMIN_EXTRAP  )    // legacy method
       { DO_EXTRAP_LOCAL = true; Trest_interp = DAYMIN_EXTRAP ; }
 
-    // - - - - - - -
+    DO_EXTRAP_LIST[epobs]   = DO_EXTRAP_LOCAL ;
+    Tobs_interp_list[epobs] = Trest_interp * z1 ;
+  }
+
+  // brute force integration
+  INTEG_zSED_SALT2_BATCH(ifilt_obs, z, Nobs, Tobs_interp_list, 
+			 parList_SN, parList_HOST,
+			 Finteg_list, Finteg_errPar_list); // returned
+
+  for ( epobs=0; epobs < Nobs; epobs++ ) {
+
+    Tobs  = Tobs_list[epobs];
+    Trest = Tobs / z1 ;
 
-    // brute force integration
-    Tobs_interp = Trest_interp * z1 ;
-    INTEG_zSED_SALT2(0,ifilt_obs, z, Tobs_interp, parList_SN, parList_HOST,
-		     &Finteg, &Finteg_errPar, FspecDum); // returned
-    flux_interp = Finteg ;
+    DO_EXTRAP_LOCAL = DO_EXTRAP_LIST[epobs];
+    Trest_interp    = Tobs_interp_list[epobs] / z1 ;
+
+    flux = FLUX_UNDEFINED ;
+
+    Finteg        = Finteg_list[epobs];
+    Finteg_errPar = Finteg_errPar_list[epobs];
+    flux_interp   = Finteg ;
 
     flux = flux_interp;
 
@@ -2286,12 +2650,62 @@ void genmag_SALT2(
 
   } // end epobs loop over epochs
 
+  free(Tobs_interp_list);  free(Finteg_list);  free(Finteg_errPar_list);
+  free(DO_EXTRAP_LIST);
 
   return ;
 
 } // end of genmag_SALT2
 
 
+// ***********************************************
+void genmag_SALT2_BATCH(int OPTMASK, GENMAG_BATCH_DEF *GENMAG_BATCH,
+			double *parList_SN, double *parList_HOST, 
+			double mwebv, double z, double z_forErr ) {
+
+  // Created Oct 2026
+  // Batch version of genmag_SALT2 for all filters and epochs of
+  // one event. Event-level setup (lambda-range checks, Galactic and
+  // host extinction tables) is done once here before the filter 
+  // loop; each filter then calls genmag_SALT2 which integrates all
+  // of its epochs in one INTEG_zSED_SALT2_BATCH call. Since the 
+  // extinction tables are cached on their inputs, the table fills
+  // inside genmag_SALT2 are no-ops.
+  //
+  // Inputs are the same as genmag_SALT2, except that filter & epoch
+  // lists are in *GENMAG_BATCH, and outputs are returned via
+  // GENMAG_BATCH->MAG and MAGERR pointers.
+
+  double RV_host = parList_HOST[0];
+  double AV_host = parList_HOST[1];
+  int    NFILT   = GENMAG_BATCH->NFILT ;
+  int    i, ifilt_obs, ifilt ;
+  char   fnam[] = "genmag_SALT2_BATCH" ;
+
+  // ----------- BEGIN -----------
+
+  for(i=0; i < NFILT; i++ ) {
+    ifilt_obs = GENMAG_BATCH->IFILT_OBS[i];
+    ifilt     = IFILTMAP_SEDMODEL[ifilt_obs] ;
+    checkLamRange_SEDMODEL(ifilt,z,fnam);
+  }
+
+  fill_TABLE_MWXT_SEDMODEL(MWXT_SEDMODEL.RV, mwebv);
+  fill_TABLE_HOSTXT_SEDMODEL(RV_host, AV_host, z);
+
+  for(i=0; i < NFILT; i++ ) {
+    if ( GENMAG_BATCH->NEP[i] <= 0 ) { continue; }
+    genmag_SALT2(OPTMASK, GENMAG_BATCH->IFILT_OBS[i], 
+		 parList_SN, parList_HOST, mwebv, z, z_forErr,
+		 GENMAG_BATCH->NEP[i],  GENMAG_BATCH->TOBS[i],
+		 GENMAG_BATCH->MAG[i],  GENMAG_BATCH->MAGERR[i] );
+  }
+
+  return ;
+
+} // end genmag_SALT2_BATCH
+
+
 // *****************************************
 double SALT2magerr(double Trest, double lamRest, double z,
 		   double x1, double x2, double Finteg_errPar, int LDMP ) {
@@ -2322,6 +2736,9 @@ double SALT2magerr(double Trest, double lamRest, double z,
   //   + vartot_flux for SALT3 (relative for SALT2)
   //
   // Oct 01 2021: no longer set magerr=5.0 to avoid discontinuity in LC fit.
+  //
+  // Oct 15 2026: use pre-interpolated table (get_SALT2_ERRTABLE) for
+  //   ERRMAP and color dispersion.
 
   int NSED = SEDMODEL.NSURFACE;
   int i, i2 ;
@@ -2348,7 +2765,12 @@ double SALT2magerr(double Trest, double lamRest, double z,
   else
     { Trest_tmp = Trest ; }
 
-  get_SALT2_ERRMAP(Trest_tmp, lamRest, ERRMAP ) ;
+  if ( SALT2_ERRTABLE.USE ) 
+    { get_SALT2_ERRTABLE(Trest_tmp, lamRest, ERRMAP, &fracerr_kcor); }
+  else {
+    get_SALT2_ERRMAP(Trest_tmp, lamRest, ERRMAP ) ;
+    fracerr_kcor = SALT2colorDisp(lamRest,fnam); 
+  }
 
   // strip off the goodies
   for(i=0; i < NSED; i++ ) {
@@ -2393,8 +2815,7 @@ double SALT2magerr(double Trest, double lamRest, double z,
     fracerr_snake = sqrt(vartot_flux) / flux_train ;
   }
 
-  // kcor/color error is the same for SALT2,SALT3
-  fracerr_kcor = SALT2colorDisp(lamRest,fnam); 
+  // kcor/color error (fracerr_kcor from above) is the same for SALT2,SALT3
 
   // get total fractional  error.
   fracerr_TOT  = sqrt(fracerr_snake*fracerr_snake + fracerr_kcor*fracerr_kcor) ;
@@ -2493,6 +2914,7 @@ double magerrFudge_SALT2(double magerr_model,
 
 
 // **********************************************
+ATTR_TARGET_CLONES
 void INTEG_zSED_SALT2(int OPT_SPEC, int ifilt_obs, double z, double Tobs, 
 		      double *parList_SN, double *parList_HOST,
 		      double *Finteg, double *Finteg_errPar, 
@@ -2908,6 +3330,860 @@ void INTEG_zSED_SALT2(int OPT_SPEC, int ifilt_obs, double z, double Tobs,
 
 } // end of INTEG_zSED_SALT2
 
+// **********************************************
+int prep_INTEG_zSED_SALT2_BATCH(int ifilt_obs, double z, 
+				double *parList_SN, double *parList_HOST) {
+
+  // Created Oct 2026
+  // Fill epoch-independent SoA arrays in SALT2_BATCH for one filter:
+  // SED lambda-bin index & interp-fraction, and the product of
+  // color law, host & MW extinction, LAMSED and TRANS.
+  // Only lambda bins used by INTEG_zSED_SALT2 are packed, so the
+  // per-epoch loop in INTEG_zSED_SALT2_BATCH has no branches.
+  //
+  // Arrays are cached per filter and refilled only when the event 
+  // key (z, c, host RV & AV, MW E(B-V)) changes, so that repeated
+  // calls for the same event (e.g., peak mags, search-eff, spectra
+  // synthetic mags) reuse the color law and extinction products.
+  //
+  // Returns 1 on success; returns 0 if any lambda bin is out of
+  // SED bounds so that caller uses INTEG_zSED_SALT2 (which aborts
+  // with full diagnostics).
+  //
+  // Oct 15 2026: get lambda-bin map from get_ZMAP_SEDMODEL, which is
+  //   cached vs. redshift and thus reused when only color changes
+  //   (e.g., fit iterations).
+
+  double c        = parList_SN[2];
+  double RV_host  = parList_HOST[0];
+  double AV_host  = parList_HOST[1];
+  bool   USE_HOSTXT = ( RV_host > 1.0E-9 && AV_host > 1.0E-9 );
+
+  int    ifilt    = IFILTMAP_SEDMODEL[ifilt_obs] ;
+  int    NLAMFILT = FILTER_SEDMODEL[ifilt].NLAM ;
+  double LAMSED_STEP = SALT2_TABLE.LAMSTEP ;
+  double KEY[NKEY_BATCH_SALT2] = 
+    { z, c, RV_host, AV_host, SEDMODEL_MWEBV_LAST } ;
+  int    ilamobs, ilamsed, ic, ikey, imap, MEMI, MEMD, NLAM = 0 ;
+  bool   SAME_KEY ;
+  double LAMOBS, LAMSED, TRANS, FRAC, CDIF, FRAC_INTERP_COLOR ;
+  double VAL0, VAL1, CCOR_LAM0, CCOR_LAM1, CCOR, XT ;
+  double DCCOR_LAM0, DCCOR_LAM1, DCCOR ;
+  double FNORM = 0.0 ;
+  SALT2_BATCH_FILTER_DEF *BATCH ;
+  ZMAP_SEDMODEL_DEF      *ZMAP ;
+  // char fnam[] = "prep_INTEG_zSED_SALT2_BATCH" ;
+
+  // ----------- BEGIN ------------
+
+  BATCH = &SALT2_BATCH.FILTER[ifilt] ;
+
+  // allocate memory only once per filter
+  if ( BATCH->NLAM_MALLOC == 0 ) {
+    MEMI = (NLAMFILT+1) * sizeof(int);
+    MEMD = (NLAMFILT+1) * sizeof(double);
+    BATCH->ILAMOBS     = (int   *)malloc(MEMI);
+    BATCH->ILAMSED     = (int   *)malloc(MEMI);
+    BATCH->FRAC_LAMSED = (double*)malloc(MEMD);
+    BATCH->WGT_FLUX    = (double*)malloc(MEMD);
+    BATCH->WGT_ERR     = (double*)malloc(MEMD);
+    BATCH->DLNCCOR_DC  = (double*)malloc(MEMD);
+    BATCH->NLAM_MALLOC = NLAMFILT ;
+    BATCH->ISTAT       = -1 ;
+  }
+
+  // check cache
+  SAME_KEY = ( BATCH->ISTAT >= 0 ) ;
+  for(ikey=0; ikey < NKEY_BATCH_SALT2; ikey++ ) 
+    { if ( KEY[ikey] != BATCH->KEY[ikey] ) { SAME_KEY = false; } }
+  if ( SAME_KEY ) { SALT2_BATCH.NCALL_REUSE++ ;  return BATCH->ISTAT; }
+
+  SALT2_BATCH.NCALL_FILL++ ;
+  for(ikey=0; ikey < NKEY_BATCH_SALT2; ikey++ ) 
+    { BATCH->KEY[ikey] = KEY[ikey]; }
+  BATCH->ISTAT    = 0 ;
+  BATCH->NEP_COMP = 0 ; // invalidate epoch components (Oct 15 2026)
+
+  // color-index for interpolation of table; same as INTEG_zSED_SALT2
+  CDIF  = c - SALT2_TABLE.CMIN ;
+  ic    = (int)(CDIF / SALT2_TABLE.CSTEP) ;
+  if ( ic < 0 )                       { ic = 0 ; }
+  if ( ic > SALT2_TABLE.NCBIN - 2 )   { ic = SALT2_TABLE.NCBIN - 2 ; }
+  FRAC_INTERP_COLOR = (c - SALT2_TABLE.COLOR[ic])/SALT2_TABLE.CSTEP ;
+
+  // Oct 15 2026: filter-to-SED lambda map is cached vs. redshift
+  ZMAP = get_ZMAP_SEDMODEL(ifilt, z, SALT2_TABLE.LAMMIN, SALT2_TABLE.LAMMAX,
+			   SALT2_TABLE.NLAMSED, SALT2_TABLE.LAMSED, 
+			   LAMSED_STEP);
+  if ( ZMAP->ISTAT == 0 ) { return 0; }
+
+  for ( imap=0; imap < ZMAP->NLAM; imap++ ) {
+
+    LAMSED = ZMAP->LAMSED[imap] ;
+    if ( LAMSED <= SALT2_TABLE.LAMMIN ) { continue ; }
+    if ( LAMSED >= SALT2_TABLE.LAMMAX ) { continue ; } 
+
+    ilamobs = ZMAP->ILAMOBS[imap] ;
+    ilamsed = ZMAP->ILAMSED[imap] ;
+    LAMOBS  = ZMAP->LAMOBS[imap] ;
+    TRANS   = ZMAP->TRANS[imap] ;
+    FRAC    = ZMAP->FRAC[imap] ;
+    if ( FRAC < -1.0E-8 || FRAC > 1.0000000001 ) { return 0; }
+
+    VAL0  = SALT2_TABLE.COLORLAW[ic+0][ilamsed];
+    VAL1  = SALT2_TABLE.COLORLAW[ic+1][ilamsed];
+    CCOR_LAM0  = VAL0 + (VAL1-VAL0) * FRAC_INTERP_COLOR ;
+    DCCOR_LAM0 = (VAL1-VAL0) / SALT2_TABLE.CSTEP ;
+    VAL0  = SALT2_TABLE.COLORLAW[ic+0][ilamsed+1];
+    VAL1  = SALT2_TABLE.COLORLAW[ic+1][ilamsed+1];
+    CCOR_LAM1  = VAL0 + (VAL1-VAL0) * FRAC_INTERP_COLOR ;
+    DCCOR_LAM1 = (VAL1-VAL0) / SALT2_TABLE.CSTEP ;
+    CCOR  = CCOR_LAM0 + (CCOR_LAM1-CCOR_LAM0)*FRAC ;
+    DCCOR = DCCOR_LAM0 + (DCCOR_LAM1-DCCOR_LAM0)*FRAC ; // dCCOR/dc
+
+    XT = 1.0 ;
+    if ( USE_HOSTXT ) { XT = SEDMODEL_TABLE_HOSTXT_FRAC[ifilt][ilamobs]; }
+
+    BATCH->ILAMOBS[NLAM]     = ilamobs ;
+    BATCH->ILAMSED[NLAM]     = ilamsed ;
+    BATCH->FRAC_LAMSED[NLAM] = FRAC ;
+    BATCH->WGT_ERR[NLAM]     = CCOR * XT * LAMSED * TRANS ;
+    BATCH->WGT_FLUX[NLAM]    = BATCH->WGT_ERR[NLAM] * 
+      SEDMODEL_TABLE_MWXT_FRAC[ifilt][ilamobs] ;
+    BATCH->DLNCCOR_DC[NLAM]  = ( CCOR != 0.0 ) ? DCCOR/CCOR : 0.0 ;
+    NLAM++ ;
+
+    FNORM += (TRANS * LAMOBS) ;
+  }
+
+  BATCH->NLAM        = NLAM ;
+  BATCH->FNORM_SALT3 = FNORM ;
+  BATCH->ISTAT       = 1 ;
+
+  return 1 ;
+
+} // end prep_INTEG_zSED_SALT2_BATCH
+
+
+// **********************************************
+ATTR_TARGET_CLONES
+void INTEG_zSED_SALT2_BATCH(int ifilt_obs, double z, 
+			    int NEP, double *Tobs_list,
+			    double *parList_SN, double *parList_HOST,
+			    double *Finteg_list, double *Finteg_errPar_list) {
+
+  // Created Oct 2026
+  // Batched version of INTEG_zSED_SALT2 (OPT_SPEC=0) that integrates
+  // all NEP epochs of one filter. Epoch-independent quantities 
+  // (color law, extinction, lambda-bin indices) are computed once by 
+  // prep_INTEG_zSED_SALT2_BATCH; the inner lambda loops are simple
+  // unit-stride loops over SoA arrays so that the compiler can
+  // auto-vectorize them.
+  //
+  // Intrinsic-scatter (genSmear) is evaluated per epoch exactly as
+  // in INTEG_zSED_SALT2. Each epoch falls back to INTEG_zSED_SALT2 for 
+  // FLAM late-time extrapolation and for negative-flux zeroing.
+  //
+  // Oct 15 2026: without genSmear and x2, the filter-integrated 
+  //   surfaces are cached per epoch for the current event key. If Tobs
+  //   is unchanged (e.g., fit step in x0 or x1), flux is a linear 
+  //   combination of cached surfaces; only t0 or color (or z, host,
+  //   MWEBV) changes force the lambda integration.
+
+  int    NSED   = SEDMODEL.NSURFACE;
+  double x0     = parList_SN[0];
+  double x_loop[3] = { 1.0, parList_SN[1], parList_SN[4] } ;
+  int    ifilt  = IFILTMAP_SEDMODEL[ifilt_obs] ;
+  int    NLAMFILT = FILTER_SEDMODEL[ifilt].NLAM ;
+  double z1     = 1.0 + z ;
+  double MODELNORM_Finteg = 
+    FILTER_SEDMODEL[ifilt].lamstep * SEDMODEL.FLUXSCALE / (double)hc ;
+  bool   EXTRAP_METHOD_FLAM = (EXTRAP_PHASE_METHOD == EXTRAP_PHASE_FLAM);
+  double DAYMIN_EXTRAP      = INPUT_EXTRAP_LATETIME_Ia.DAYMIN ;
+  double DAYSTEP = SALT2_TABLE.DAYSTEP ;
+  int    ISTAT_GENSMEAR = istat_genSmear();
+
+  int    NLAM, ep, ised, j, IDAY, NNEG, ilamobs, NLAMTMP ;
+  bool   USE_BATCH, USE_COMP ;
+  double Trest, DAYDIF, FDAY, FSUM, ESUM, Fcheck, FspecDum[10] ;
+  double LAMOBS, TRANS, parList_genSmear[10], *lam = NULL ;
+  double Finteg_filter[MXSURFACE_SALT2], Finteg_forErr[MXSURFACE_SALT2] ;
+  SALT2_BATCH_FILTER_DEF *BATCH ;
+  // char fnam[] = "INTEG_zSED_SALT2_BATCH" ;
+
+  // ----------- BEGIN ------------
+
+  USE_BATCH = prep_INTEG_zSED_SALT2_BATCH(ifilt_obs, z, 
+					  parList_SN, parList_HOST); 
+
+  BATCH = &SALT2_BATCH.FILTER[ifilt] ;
+  NLAM  = BATCH->NLAM ;
+  const int    *ILAM    = BATCH->ILAMSED ;
+  const double *FLAMSED = BATCH->FRAC_LAMSED ;
+  const double *WFLUX   = BATCH->WGT_FLUX ;
+  const double *WERR    = BATCH->WGT_ERR ;
+  double       *SMEAR   = SALT2_BATCH.SMEAR ;
+
+  USE_COMP = ( USE_BATCH && ISTAT_GENSMEAR == 0 && NSED <= 2 );
+  if ( USE_COMP ) { malloc_COMP_SALT2_BATCH(BATCH, NEP); }
+
+  // rest-frame lambda list for genSmear; same as INTEG_zSED_SALT2
+  NLAMTMP = 0 ;
+  if ( USE_BATCH && ISTAT_GENSMEAR ) {
+    lam = (double*) malloc(NLAMFILT*sizeof(double) );
+    for ( ilamobs=0; ilamobs < NLAMFILT; ilamobs++ ) {
+      get_LAMTRANS_SEDMODEL(ifilt,ilamobs, &LAMOBS, &TRANS);
+      if ( LAMOBS/z1 >= SALT2_TABLE.LAMMAX ) { continue ; }  
+      lam[ilamobs] = LAMOBS/z1 ;
+      NLAMTMP++ ;
+    }
+  }
+  for ( j=0; j < NLAM; j++ ) { SMEAR[j] = 1.0 ; }
+
+  for ( ep=0; ep < NEP; ep++ ) {
+
+    Trest = Tobs_list[ep] / z1 ;
+
+    if ( !USE_BATCH || (EXTRAP_METHOD_FLAM && Trest > DAYMIN_EXTRAP) ) {
+      INTEG_zSED_SALT2(0, ifilt_obs, z, Tobs_list[ep], 
+		       parList_SN, parList_HOST,
+		       &Finteg_list[ep], &Finteg_errPar_list[ep], FspecDum);
+      continue ;
+    }
+
+    // check cached surfaces for this epoch (Oct 15 2026)
+    if ( USE_COMP && 
+	 get_COMP_SALT2_BATCH(BATCH, ep, Tobs_list[ep], x_loop[1],
+			      Finteg_filter, Finteg_forErr) ) 
+      { SALT2_BATCH.NEP_COMP_REUSE++ ;  goto SUM_SURFACES ; }
+
+    DAYDIF  = Trest - SALT2_TABLE.DAY[0] ;
+    IDAY    = (int)(DAYDIF/DAYSTEP);  
+    DAYDIF  = Trest - SALT2_TABLE.DAY[IDAY] ;
+    FDAY    = DAYDIF/DAYSTEP ;
+
+    // intrinsic scatter for this epoch
+    if ( ISTAT_GENSMEAR ) {
+      parList_genSmear[0] = Trest ;
+      parList_genSmear[1] = parList_SN[1];  // x1
+      parList_genSmear[2] = parList_SN[2];  // c
+      parList_genSmear[3] = parList_HOST[2] ; // logMass
+      get_genSmear(parList_genSmear, NLAMTMP, lam, GENSMEAR.MAGSMEAR_LIST) ;
+      for ( j=0; j < NLAM; j++ ) 
+	{ SMEAR[j] = pow(TEN, -0.4*GENSMEAR.MAGSMEAR_LIST[BATCH->ILAMOBS[j]]); }
+    }
+
+    // interpolate each SED surface in lambda and day,
+    // then sum lambda bins.
+    for(ised=0; ised < NSED; ised++ ) {
+      interp_SEDFLUX_SALT2_BATCH(NLAM, ILAM, FLAMSED, FDAY,
+				 SALT2_TABLE.SEDFLUX[ised][IDAY],
+				 SALT2_TABLE.SEDFLUX[ised][IDAY+1],
+				 SMEAR, WFLUX, WERR,
+				 SALT2_BATCH.FLAM[ised], SALT2_BATCH.FERR[ised]);
+      FSUM = ESUM = 0.0 ;
+      for ( j=0; j < NLAM; j++ ) { 
+	FSUM += SALT2_BATCH.FLAM[ised][j];  
+	ESUM += SALT2_BATCH.FERR[ised][j]; 
+      }
+      Finteg_filter[ised] = FSUM ;
+      Finteg_forErr[ised] = ESUM ;
+    }
+
+    if ( USE_COMP ) {
+      store_COMP_SALT2_BATCH(BATCH, ep, Tobs_list[ep], 
+			     Finteg_filter, Finteg_forErr);
+      SALT2_BATCH.NEP_COMP_FILL++ ;
+    }
+
+    // count negative flux bins; if any must be zeroed -> scalar version
+    NNEG = 0 ;
+    if ( !NEGFLAM_SEDMODEL.ALLOW ) {
+      for ( j=0; j < NLAM; j++ ) {
+	Fcheck = 0.0 ;
+	for(ised=0; ised < NSED; ised++ ) 
+	  { Fcheck += x_loop[ised] * SALT2_BATCH.FLAM[ised][j]; }
+	NNEG += ( Fcheck < 0.0 );
+      }
+    }
+    if ( NNEG > 0 ) {
+      INTEG_zSED_SALT2(0, ifilt_obs, z, Tobs_list[ep], 
+		       parList_SN, parList_HOST,
+		       &Finteg_list[ep], &Finteg_errPar_list[ep], FspecDum);
+      continue ;
+    }
+
+  SUM_SURFACES:
+
+    // total flux in filter
+    Finteg_list[ep] = 0.0 ;
+    for(ised=0; ised < NSED; ised++ ) 
+      { Finteg_list[ep] += ( x_loop[ised] * Finteg_filter[ised]) ; }
+    Finteg_list[ep] *= ( x0 * MODELNORM_Finteg );
+
+    // Finteg_errPar; same as in INTEG_zSED_SALT2
+    Finteg_errPar_list[ep] = 0.0 ;
+    if ( ISMODEL_SALT2 ) {
+      if ( Finteg_filter[0] != 0.0 ) 
+	{ Finteg_errPar_list[ep] = Finteg_forErr[1] / Finteg_forErr[0] ; }
+    }
+    else if ( ISMODEL_SALT3 ) {
+      for(ised=0; ised < NSED; ised++ )
+	{ Finteg_errPar_list[ep] += ( x_loop[ised] * Finteg_forErr[ised] ); }
+      Finteg_errPar_list[ep] /= BATCH->FNORM_SALT3 ;
+    }
+
+  } // end ep loop
+
+  if ( USE_COMP && NEP > BATCH->NEP_COMP ) { BATCH->NEP_COMP = NEP; }
+  if ( lam != NULL ) { free(lam); }
+
+  return ;
+
+} // end INTEG_zSED_SALT2_BATCH
+
+
+// **********************************************
+int dlnflux_SALT2(int ifilt_obs, double *parList_SN, double *parList_HOST,
+		  double mwebv, double z, double Tobs, double *DLNF) {
+
+  // Created Oct 2026
+  // Analytic partial derivatives of the model flux in filter ifilt_obs
+  // at one epoch, returned as logarithmic derivatives so that they 
+  // apply to any flux normalization (ZP, FLUXCAL) used by the caller:
+  //   DLNF[0] = dlnF/dx0  = 1/x0
+  //   DLNF[1] = dlnF/dx1  = F1/(F0 + x1*F1 + x2*F2)
+  //   DLNF[2] = dlnF/dc   from slope of color-law table vs. c
+  //   DLNF[3] = dlnF/dTobs from slope of SED vs. phase
+  //   DLNF[4] = dlnF/dx2  (SALT3 with M2 surface; else 0)
+  // where Fi are the filter-integrated surfaces from the same batch
+  // arrays as INTEG_zSED_SALT2_BATCH.
+  //
+  // Returns 1 on success. Returns 0 (caller must use numerical 
+  // derivatives) for cases where flux is not a smooth function of
+  // the surfaces: genSmear, phase extrapolation, negative-flux 
+  // zeroing, forced-zero flux, or non-positive flux.
+
+  int    NSED   = SEDMODEL.NSURFACE;
+  double x0     = parList_SN[0];
+  double x_loop[3] = { 1.0, parList_SN[1], parList_SN[4] } ;
+  double RV_host  = parList_HOST[0];
+  double AV_host  = parList_HOST[1];
+  int    ifilt  = IFILTMAP_SEDMODEL[ifilt_obs] ;
+  double z1     = 1.0 + z ;
+  double Trest  = Tobs / z1 ;
+  double DAYSTEP = SALT2_TABLE.DAYSTEP ;
+  double epsT    = 1.0E-5 ;
+  double meanlam_rest = FILTER_SEDMODEL[ifilt].mean / z1 ;
+  double DAYMIN_EXTRAP = INPUT_EXTRAP_LATETIME_Ia.DAYMIN ;
+
+  int    NLAM, ised, j, IDAY, ipar ;
+  double DAYDIF, FDAY, F0, F1, FLAM, FCHECK, FTOT ;
+  double SUMF[MXSURFACE_SALT2], SUMC[MXSURFACE_SALT2] ;
+  double SUMT[MXSURFACE_SALT2] ;
+  const  double *S0, *S1 ;
+  SALT2_BATCH_FILTER_DEF *BATCH ;
+  char fnam[] = "dlnflux_SALT2" ;
+
+  // ----------- BEGIN ------------
+
+  for(ipar=0; ipar < 5; ipar++ ) { DLNF[ipar] = 0.0 ; }
+
+  if ( x0 == 0.0 )                         { return 0; }
+  if ( istat_genSmear() )                  { return 0; }
+  if ( Trest <= SALT2_TABLE.DAYMIN+epsT )  { return 0; }
+  if ( Trest >= SALT2_TABLE.DAYMAX-epsT )  { return 0; }
+  if ( EXTRAP_PHASE_METHOD != EXTRAP_PHASE_SEDFLUX && 
+       Trest > DAYMIN_EXTRAP )             { return 0; }
+  if ( meanlam_rest > INPUT_SALT2_INFO.RESTLAM_FORCEZEROFLUX[0] &&
+       meanlam_rest < INPUT_SALT2_INFO.RESTLAM_FORCEZEROFLUX[1] ) 
+    { return 0; }
+
+  // same table fills as genmag_SALT2 (no-op if already filled)
+  checkLamRange_SEDMODEL(ifilt,z,fnam);
+  fill_TABLE_MWXT_SEDMODEL(MWXT_SEDMODEL.RV, mwebv);
+  fill_TABLE_HOSTXT_SEDMODEL(RV_host, AV_host, z); 
+
+  if ( !prep_INTEG_zSED_SALT2_BATCH(ifilt_obs, z, 
+				    parList_SN, parList_HOST) ) 
+    { return 0; }
+
+  BATCH  = &SALT2_BATCH.FILTER[ifilt] ;
+  NLAM   = BATCH->NLAM ;
+
+  DAYDIF = Trest - SALT2_TABLE.DAY[0] ;
+  IDAY   = (int)(DAYDIF/DAYSTEP);  
+  DAYDIF = Trest - SALT2_TABLE.DAY[IDAY] ;
+  FDAY   = DAYDIF/DAYSTEP ;
+
+  for(ised=0; ised < NSED; ised++ ) {
+    S0 = SALT2_TABLE.SEDFLUX[ised][IDAY] ;
+    S1 = SALT2_TABLE.SEDFLUX[ised][IDAY+1] ;
+    SUMF[ised] = SUMC[ised] = SUMT[ised] = 0.0 ;
+    for ( j=0; j < NLAM; j++ ) {
+      int    ilam = BATCH->ILAMSED[j];
+      double frac = BATCH->FRAC_LAMSED[j];
+      F0    = S0[ilam] + (S0[ilam+1]-S0[ilam])*frac ;
+      F1    = S1[ilam] + (S1[ilam+1]-S1[ilam])*frac ;
+      FLAM  = (F0 + (F1-F0)*FDAY) * BATCH->WGT_FLUX[j] ;
+      SALT2_BATCH.FLAM[ised][j] = FLAM ;
+      SUMF[ised] += FLAM ;
+      SUMC[ised] += FLAM * BATCH->DLNCCOR_DC[j] ;
+      SUMT[ised] += (F1-F0) * BATCH->WGT_FLUX[j] ;
+    }
+  }
+
+  // negative-flux bins are zeroed in INTEG_zSED_SALT2 -> not smooth
+  if ( !NEGFLAM_SEDMODEL.ALLOW ) {
+    for ( j=0; j < NLAM; j++ ) {
+      FCHECK = 0.0 ;
+      for(ised=0; ised < NSED; ised++ ) 
+	{ FCHECK += x_loop[ised] * SALT2_BATCH.FLAM[ised][j]; }
+      if ( FCHECK < 0.0 ) { return 0; }
+    }
+  }
+
+  FTOT = 0.0 ;
+  for(ised=0; ised < NSED; ised++ ) { FTOT += x_loop[ised] * SUMF[ised]; }
+  if ( FTOT <= 0.0 ) { return 0; }
+
+  DLNF[0] = 1.0 / x0 ;
+  if ( NSED > 1 ) { DLNF[1] = SUMF[1] / FTOT ; }
+  if ( NSED > 2 ) { DLNF[4] = SUMF[2] / FTOT ; }
+  for(ised=0; ised < NSED; ised++ ) {
+    DLNF[2] += x_loop[ised] * SUMC[ised] ;
+    DLNF[3] += x_loop[ised] * SUMT[ised] ;
+  }
+  DLNF[2] /= FTOT ;
+  DLNF[3] /= ( FTOT * DAYSTEP * z1 ) ;  // dTrest/dTobs = 1/z1
+
+  return 1 ;
+
+} // end dlnflux_SALT2
+
+
+// **********************************************
+void malloc_COMP_SALT2_BATCH(SALT2_BATCH_FILTER_DEF *BATCH, int NEP) {
+
+  // Created Oct 2026
+  // Make sure that epoch-component cache has room for NEP epochs;
+  // new entries are flagged invalid.
+
+  int ep, MXEP, MEMD, MEMI ;
+
+  // ----------- BEGIN ------------
+
+  if ( NEP <= BATCH->NEP_MALLOC ) { return; }
+
+  MXEP = NEP + 20 ;
+  MEMI = MXEP * sizeof(int) ;
+  MEMD = MXEP * sizeof(double) ;
+  BATCH->ISTAT_COMP   = (int   *)realloc(BATCH->ISTAT_COMP,   MEMI);
+  BATCH->TOBS_COMP    = (double*)realloc(BATCH->TOBS_COMP,    MEMD);
+  BATCH->FCOMP        = (double*)realloc(BATCH->FCOMP, MEMD*MXSURFACE_SALT2);
+  BATCH->ECOMP        = (double*)realloc(BATCH->ECOMP, MEMD*MXSURFACE_SALT2);
+  BATCH->X1RANGE_COMP = (double*)realloc(BATCH->X1RANGE_COMP, 2*MEMD);
+
+  for(ep=BATCH->NEP_MALLOC; ep < MXEP; ep++ ) { BATCH->ISTAT_COMP[ep] = 0; }
+  BATCH->NEP_MALLOC = MXEP ;
+
+  return ;
+
+} // end malloc_COMP_SALT2_BATCH
+
+
+// **********************************************
+bool get_COMP_SALT2_BATCH(SALT2_BATCH_FILTER_DEF *BATCH, int ep,
+			  double Tobs, double x1, double *Finteg_filter, 
+			  double *Finteg_forErr) {
+
+  // Created Oct 2026
+  // If epoch ep has cached surfaces for this Tobs, and x1 is inside
+  // the range without negative-flux bins, load filter-integrated 
+  // flux & err sums for each surface and return true.
+  // Entries for a different Tobs (t0 fit step) are invalidated.
+
+  int NSED = SEDMODEL.NSURFACE ;
+  int ised ;
+
+  // ----------- BEGIN ------------
+
+  if ( ep >= BATCH->NEP_COMP || BATCH->TOBS_COMP[ep] != Tobs ) 
+    { BATCH->ISTAT_COMP[ep] = 0;  return false; }
+
+  if ( BATCH->ISTAT_COMP[ep] != 1 )           { return false; }
+  if ( x1 <= BATCH->X1RANGE_COMP[2*ep+0] )    { return false; }
+  if ( x1 >= BATCH->X1RANGE_COMP[2*ep+1] )    { return false; }
+
+  for(ised=0; ised < NSED; ised++ ) {
+    Finteg_filter[ised] = BATCH->FCOMP[ep*MXSURFACE_SALT2+ised] ;
+    Finteg_forErr[ised] = BATCH->ECOMP[ep*MXSURFACE_SALT2+ised] ;
+  }
+
+  return true ;
+
+} // end get_COMP_SALT2_BATCH
+
+
+// **********************************************
+void store_COMP_SALT2_BATCH(SALT2_BATCH_FILTER_DEF *BATCH, int ep,
+			    double Tobs, double *Finteg_filter, 
+			    double *Finteg_forErr) {
+
+  // Created Oct 2026
+  // Store filter-integrated surfaces for epoch ep, along with the
+  // x1 range for which x1-weighted flux is non-negative in every 
+  // lambda bin (i.e., no negative-flux zeroing is needed):
+  //    FLAM0[j] + x1*FLAM1[j] >= 0  for all j.
+  // Uses per-bin surfaces in SALT2_BATCH.FLAM from the last epoch.
+
+  int    NSED = SEDMODEL.NSURFACE ;
+  int    NLAM = BATCH->NLAM ;
+  int    ised, j ;
+  bool   EMPTY = false ;
+  double X1MIN = -1.0E30, X1MAX = 1.0E30, A, B, XLIM ;
+
+  // ----------- BEGIN ------------
+
+  if ( !NEGFLAM_SEDMODEL.ALLOW ) {
+    for ( j=0; j < NLAM; j++ ) {
+      A = SALT2_BATCH.FLAM[0][j] ;
+      B = ( NSED > 1 ) ? SALT2_BATCH.FLAM[1][j] : 0.0 ;
+      if ( B != 0.0 ) {
+	XLIM = -A/B ;
+	if ( B > 0.0 && XLIM > X1MIN ) { X1MIN = XLIM; }
+	if ( B < 0.0 && XLIM < X1MAX ) { X1MAX = XLIM; }
+      }
+      else if ( A < 0.0 ) 
+	{ EMPTY = true; }
+    }
+  }
+  if ( EMPTY ) { X1MIN = X1MAX = 0.0 ; }
+
+  for(ised=0; ised < NSED; ised++ ) {
+    BATCH->FCOMP[ep*MXSURFACE_SALT2+ised] = Finteg_filter[ised] ;
+    BATCH->ECOMP[ep*MXSURFACE_SALT2+ised] = Finteg_forErr[ised] ;
+  }
+  BATCH->X1RANGE_COMP[2*ep+0] = X1MIN ;
+  BATCH->X1RANGE_COMP[2*ep+1] = X1MAX ;
+  BATCH->TOBS_COMP[ep]  = Tobs ;
+  BATCH->ISTAT_COMP[ep] = 1 ;
+
+  return ;
+
+} // end store_COMP_SALT2_BATCH
+
+
+// **********************************************
+void interp_SEDFLUX_SALT2_BATCH(int NLAM, const int *restrict ILAM, 
+				const double *restrict FRAC, double FDAY,
+				const double *restrict S0, 
+				const double *restrict S1,
+				const double *restrict SMEAR, 
+				const double *restrict WFLUX, 
+				const double *restrict WERR,
+				double *restrict FLAM, double *restrict FERR) {
+
+  // Created Oct 2026
+  // Interpolate SED flux S0,S1 (two adjacent days) to packed lambda
+  // bins ILAM, and store flux-weighted (FLAM) and error-weighted
+  // (FERR) values. No reduction here, and restrict arguments tell 
+  // compiler that gathers from S0,S1 do not alias stores, so that
+  // this loop is auto-vectorized.
+
+  int j;
+  for ( j=0; j < NLAM; j++ ) {
+    double F0 = S0[ILAM[j]] + (S0[ILAM[j]+1]-S0[ILAM[j]])*FRAC[j];
+    double F1 = S1[ILAM[j]] + (S1[ILAM[j]+1]-S1[ILAM[j]])*FRAC[j];
+    double F  = (F0 + (F1-F0)*FDAY) * SMEAR[j] ;
+    FLAM[j]   = F * WFLUX[j] ;
+    FERR[j]   = F * WERR[j] ;
+  }
+  return ;
+
+} // end interp_SEDFLUX_SALT2_BATCH
+
+
+// **********************************************
+int prep_INTEG_zSED_SALT2_SPEC(int ifilt_obs, double z, 
+			       double *parList_SN, double *parList_HOST) {
+
+  // Created Oct 2026
+  // Spectrum analog of prep_INTEG_zSED_SALT2_BATCH: fill SoA arrays
+  // for each SED sub-bin used by INTEG_zSED_SALT2(OPT_SPEC=1):
+  // spectrum-bin index, SED lambda index & interp-fraction, and the
+  // product of color law, host & MW extinction and bin-size ratio.
+  // Sub-bin loop is identical to INTEG_zSED_SALT2 (SPECTROGRAPH bins
+  // are split into SED-sized sub-bins).
+  //
+  // Arrays are cached per filter and event key (z, c, host RV & AV,
+  // MW E(B-V)), so repeated spectra for an event (TAKE_SPECTRUM and
+  // SED_TRUE epochs) only interpolate the SED surfaces.
+  //
+  // Returns 1 on success; returns 0 if any sub-bin is out of SED 
+  // bounds so that caller uses INTEG_zSED_SALT2 (which aborts).
+
+  double c        = parList_SN[2];
+  double RV_host  = parList_HOST[0];
+  double AV_host  = parList_HOST[1];
+  bool   USE_HOSTXT = ( RV_host > 1.0E-9 && AV_host > 1.0E-9 );
+
+  int    ifilt    = IFILTMAP_SEDMODEL[ifilt_obs] ;
+  int    NLAMFILT = FILTER_SEDMODEL[ifilt].NLAM ;
+  bool   DO_SPECTROGRAPH = ( ifilt_obs == JFILT_SPECTROGRAPH ) ;
+  double z1       = 1.0 + z ;
+  double LAMSED_STEP  = SALT2_TABLE.LAMSTEP ;
+  double LAMFILT_STEP = FILTER_SEDMODEL[ifilt].lamstep ;
+  double KEY[NKEY_BATCH_SALT2] = 
+    { z, c, RV_host, AV_host, SEDMODEL_MWEBV_LAST } ;
+  int    ilamobs, ilamsed, ic, ikey, ised, ipass, MEMI, MEMD, NSUB ;
+  bool   SAME_KEY ;
+  double LAMOBS, LAMSED, LAMSED_MIN, LAMSED_MAX, TRANS, LAMDIF, FRAC ;
+  double CDIF, FRAC_INTERP_COLOR, LAMSPEC_STEP, XT, XTMW ;
+  double VAL0, VAL1, CCOR_LAM0, CCOR_LAM1, CCOR ;
+  SALT2_SPEC_BATCH_DEF *SPEC ;
+
+  // ----------- BEGIN ------------
+
+  SPEC = &SALT2_BATCH.SPEC[ifilt] ;
+
+  if ( !SPEC->INIT ) {
+    MEMD = (NLAMFILT+1) * sizeof(double);
+    SPEC->LAMREST     = (double*)malloc(MEMD);
+    SPEC->NLAM_MALLOC = NLAMFILT ;
+    SPEC->NSUB_MALLOC = 0 ;
+    SPEC->ISTAT       = -1 ;
+    SPEC->INIT        = true ;
+  }
+
+  // check cache
+  SAME_KEY = ( SPEC->ISTAT >= 0 ) ;
+  for(ikey=0; ikey < NKEY_BATCH_SALT2; ikey++ ) 
+    { if ( KEY[ikey] != SPEC->KEY[ikey] ) { SAME_KEY = false; } }
+  if ( SAME_KEY ) { return SPEC->ISTAT; }
+
+  for(ikey=0; ikey < NKEY_BATCH_SALT2; ikey++ ) 
+    { SPEC->KEY[ikey] = KEY[ikey]; }
+  SPEC->ISTAT = 0 ;
+
+  // color-index for interpolation of table; same as INTEG_zSED_SALT2
+  CDIF  = c - SALT2_TABLE.CMIN ;
+  ic    = (int)(CDIF / SALT2_TABLE.CSTEP) ;
+  if ( ic < 0 )                       { ic = 0 ; }
+  if ( ic > SALT2_TABLE.NCBIN - 2 )   { ic = SALT2_TABLE.NCBIN - 2 ; }
+  FRAC_INTERP_COLOR = (c - SALT2_TABLE.COLOR[ic])/SALT2_TABLE.CSTEP ;
+
+  // rest-frame lambda list for genSmear; same as INTEG_zSED_SALT2
+  SPEC->NLAMREST = 0 ;
+  for ( ilamobs=0; ilamobs < NLAMFILT; ilamobs++ ) {
+    get_LAMTRANS_SEDMODEL(ifilt,ilamobs, &LAMOBS, &TRANS);
+    if ( LAMOBS/z1 >= SALT2_TABLE.LAMMAX ) { continue ; }  
+    SPEC->LAMREST[ilamobs] = LAMOBS/z1 ;
+    SPEC->NLAMREST++ ;
+  }
+
+  // pass 0 counts sub-bins; pass 1 fills arrays
+  for(ipass=0; ipass < 2; ipass++ ) {
+
+    NSUB = 0 ;
+    for ( ilamobs=0; ilamobs < NLAMFILT; ilamobs++ ) {
+
+      get_LAMTRANS_SEDMODEL(ifilt,ilamobs, &LAMOBS, &TRANS);
+      LAMSED     = LAMOBS / z1 ;
+      LAMSED_MIN = LAMSED_MAX = LAMSED ;
+      if ( LAMSED <= SALT2_TABLE.LAMMIN ) { continue ; }
+      if ( LAMSED >= SALT2_TABLE.LAMMAX ) { continue ; } 
+
+      if ( DO_SPECTROGRAPH )  {
+	LAMSED_MIN = SPECTROGRAPH_SEDMODEL.LAMMIN_LIST[ilamobs]/z1 ; 
+	LAMSED_MAX = SPECTROGRAPH_SEDMODEL.LAMMAX_LIST[ilamobs]/z1 ;
+      }
+
+      XTMW = SEDMODEL_TABLE_MWXT_FRAC[ifilt][ilamobs] ;
+      XT   = 1.0 ;
+      if ( USE_HOSTXT ) { XT = SEDMODEL_TABLE_HOSTXT_FRAC[ifilt][ilamobs]; }
+
+      for(LAMSED=LAMSED_MIN; LAMSED <= LAMSED_MAX; LAMSED+=LAMSED_STEP) {
+
+	if ( LAMSED <= SALT2_TABLE.LAMMIN ) { continue ; }
+	if ( LAMSED >= SALT2_TABLE.LAMMAX ) { continue ; } 
+
+	if ( ipass == 1 ) {
+	  LAMDIF  = LAMSED - SALT2_TABLE.LAMMIN ;
+	  ilamsed = (int)(LAMDIF/LAMSED_STEP); 
+	  if ( ilamsed < 0 || ilamsed >= SALT2_TABLE.NLAMSED ) { return 0; }
+	  LAMDIF  = LAMSED - SALT2_TABLE.LAMSED[ilamsed] ;
+	  FRAC    = LAMDIF / LAMSED_STEP ;
+	  if ( FRAC < -1.0E-8 || FRAC > 1.0000000001 ) { return 0; }
+
+	  VAL0  = SALT2_TABLE.COLORLAW[ic+0][ilamsed];
+	  VAL1  = SALT2_TABLE.COLORLAW[ic+1][ilamsed];
+	  CCOR_LAM0  = VAL0 + (VAL1-VAL0) * FRAC_INTERP_COLOR ;
+	  VAL0  = SALT2_TABLE.COLORLAW[ic+0][ilamsed+1];
+	  VAL1  = SALT2_TABLE.COLORLAW[ic+1][ilamsed+1];
+	  CCOR_LAM1  = VAL0 + (VAL1-VAL0) * FRAC_INTERP_COLOR ;
+	  CCOR  = CCOR_LAM0 + (CCOR_LAM1-CCOR_LAM0)*FRAC ;
+
+	  LAMSPEC_STEP = LAMFILT_STEP ;
+	  if ( DO_SPECTROGRAPH ) {
+	    if ( LAMSED+LAMSED_STEP < LAMSED_MAX ) 
+	      { LAMSPEC_STEP = LAMSED_STEP  ; } 
+	    else
+	      { LAMSPEC_STEP = (LAMSED_MAX-LAMSED) ; }
+	  }
+
+	  SPEC->ILAMOBS[NSUB]     = ilamobs ;
+	  SPEC->ILAMSED[NSUB]     = ilamsed ;
+	  SPEC->FRAC_LAMSED[NSUB] = FRAC ;
+	  SPEC->WGT_SPEC[NSUB] = CCOR*XT*XTMW * LAMSPEC_STEP/LAMFILT_STEP ;
+	  SPEC->WGT_CHK[NSUB]  = CCOR*XT*XTMW * LAMSED*TRANS ;
+	}
+	NSUB++ ;
+      } // end LAMSED loop
+    } // end ilamobs loop
+
+    // after counting, make sure arrays are big enough
+    if ( ipass == 0 && NSUB > SPEC->NSUB_MALLOC ) {
+      if ( SPEC->NSUB_MALLOC > 0 ) {
+	free(SPEC->ILAMOBS);  free(SPEC->ILAMSED); free(SPEC->FRAC_LAMSED);
+	free(SPEC->WGT_SPEC); free(SPEC->WGT_CHK); free(SPEC->SMEAR);
+	for(ised=0; ised < MXSURFACE_SALT2; ised++ ) 
+	  { free(SPEC->FLAM[ised]); free(SPEC->FCHK[ised]); }
+      }
+      MEMI = (NSUB+1) * sizeof(int);
+      MEMD = (NSUB+1) * sizeof(double);
+      SPEC->ILAMOBS     = (int   *)malloc(MEMI);
+      SPEC->ILAMSED     = (int   *)malloc(MEMI);
+      SPEC->FRAC_LAMSED = (double*)malloc(MEMD);
+      SPEC->WGT_SPEC    = (double*)malloc(MEMD);
+      SPEC->WGT_CHK     = (double*)malloc(MEMD);
+      SPEC->SMEAR       = (double*)malloc(MEMD);
+      for(ised=0; ised < MXSURFACE_SALT2; ised++ ) { 
+	SPEC->FLAM[ised] = (double*)malloc(MEMD);
+	SPEC->FCHK[ised] = (double*)malloc(MEMD);
+      }
+      SPEC->NSUB_MALLOC = NSUB ;
+    }
+
+  } // end ipass
+
+  SPEC->NSUB  = NSUB ;
+  SPEC->ISTAT = 1 ;
+  return 1 ;
+
+} // end prep_INTEG_zSED_SALT2_SPEC
+
+
+// **********************************************
+void INTEG_zSED_SALT2_SPEC(int ifilt_obs, double z, double Tobs, 
+			   double *parList_SN, double *parList_HOST,
+			   double *Fspec) {
+
+  // Created Oct 2026
+  // Vectorized version of INTEG_zSED_SALT2(OPT_SPEC=1) that returns
+  // spectrum Fspec[ilamobs] for filter (or SPECTROGRAPH) ifilt_obs.
+  // Color law and extinction for every sub-bin are cached by 
+  // prep_INTEG_zSED_SALT2_SPEC, and SED surfaces are interpolated 
+  // over all sub-bins with interp_SEDFLUX_SALT2_BATCH, the same 
+  // kernel as for photometry. Sub-bins are then summed into 
+  // spectrum bins.
+  //
+  // Falls back to INTEG_zSED_SALT2 for FLAM late-time extrapolation,
+  // out-of-bound lambda bins, and negative-flux zeroing. Unlike 
+  // INTEG_zSED_SALT2, Fspec is zero for bins outside the model range.
+
+  int    NSED   = SEDMODEL.NSURFACE;
+  double x0     = parList_SN[0];
+  double x_loop[3] = { 1.0, parList_SN[1], parList_SN[4] } ;
+  int    ifilt  = IFILTMAP_SEDMODEL[ifilt_obs] ;
+  int    NLAMFILT = FILTER_SEDMODEL[ifilt].NLAM ;
+  double z1     = 1.0 + z ;
+  double Trest  = Tobs / z1 ;
+  double MODELNORM_Fspec = 
+    FILTER_SEDMODEL[ifilt].lamstep * SEDMODEL.FLUXSCALE ;
+  bool   EXTRAP_METHOD_FLAM = (EXTRAP_PHASE_METHOD == EXTRAP_PHASE_FLAM);
+  double DAYMIN_EXTRAP      = INPUT_EXTRAP_LATETIME_Ia.DAYMIN ;
+  double DAYSTEP = SALT2_TABLE.DAYSTEP ;
+
+  int    NSUB, ised, j, IDAY, ilamobs ;
+  double DAYDIF, FDAY, Fcheck, Fsum, FintegDum, FerrDum ;
+  double parList_genSmear[10] ;
+  SALT2_SPEC_BATCH_DEF *SPEC ;
+
+  // ----------- BEGIN ------------
+
+  if ( EXTRAP_METHOD_FLAM && Trest > DAYMIN_EXTRAP ) 
+    { goto SCALAR ; }
+
+  if ( !prep_INTEG_zSED_SALT2_SPEC(ifilt_obs, z, parList_SN, parList_HOST) )
+    { goto SCALAR ; }
+
+  SPEC = &SALT2_BATCH.SPEC[ifilt] ;
+  NSUB = SPEC->NSUB ;
+
+  DAYDIF  = Trest - SALT2_TABLE.DAY[0] ;
+  IDAY    = (int)(DAYDIF/DAYSTEP);  
+  DAYDIF  = Trest - SALT2_TABLE.DAY[IDAY] ;
+  FDAY    = DAYDIF/DAYSTEP ;
+
+  // intrinsic scatter is evaluated per spectrum bin
+  if ( istat_genSmear() ) {
+    parList_genSmear[0] = Trest ;
+    parList_genSmear[1] = parList_SN[1];  // x1
+    parList_genSmear[2] = parList_SN[2];  // c
+    parList_genSmear[3] = parList_HOST[2] ; // logMass
+    get_genSmear(parList_genSmear, SPEC->NLAMREST, SPEC->LAMREST, 
+		 GENSMEAR.MAGSMEAR_LIST) ;
+    for ( j=0; j < NSUB; j++ ) {
+      ilamobs = SPEC->ILAMOBS[j] ;
+      SPEC->SMEAR[j] = pow(TEN, -0.4*GENSMEAR.MAGSMEAR_LIST[ilamobs]); 
+    }
+  }
+  else {
+    for ( j=0; j < NSUB; j++ ) { SPEC->SMEAR[j] = 1.0 ; }
+  }
+
+  for(ised=0; ised < NSED; ised++ ) {
+    interp_SEDFLUX_SALT2_BATCH(NSUB, SPEC->ILAMSED, SPEC->FRAC_LAMSED, FDAY,
+			       SALT2_TABLE.SEDFLUX[ised][IDAY],
+			       SALT2_TABLE.SEDFLUX[ised][IDAY+1],
+			       SPEC->SMEAR, SPEC->WGT_SPEC, SPEC->WGT_CHK,
+			       SPEC->FLAM[ised], SPEC->FCHK[ised]);
+  }
+
+  // negative flux sub-bins must be zeroed -> scalar version
+  if ( !NEGFLAM_SEDMODEL.ALLOW ) {
+    for ( j=0; j < NSUB; j++ ) {
+      Fcheck = 0.0 ;
+      for(ised=0; ised < NSED; ised++ ) 
+	{ Fcheck += x_loop[ised] * SPEC->FCHK[ised][j]; }
+      if ( Fcheck < 0.0 ) { goto SCALAR ; }
+    }
+  }
+
+  for ( ilamobs=0; ilamobs < NLAMFILT; ilamobs++ ) { Fspec[ilamobs] = 0.0; }
+
+  for ( j=0; j < NSUB; j++ ) {
+    Fsum = 0.0 ;
+    for(ised=0; ised < NSED; ised++ ) 
+      { Fsum += x_loop[ised] * SPEC->FLAM[ised][j]; }
+    Fspec[SPEC->ILAMOBS[j]] += Fsum ;
+  }
+
+  for ( ilamobs=0; ilamobs < NLAMFILT; ilamobs++ ) 
+    { Fspec[ilamobs] *= ( x0 * MODELNORM_Fspec ); }
+
+  SALT2_BATCH.NSPEC_BATCH++ ;
+  return ;
+
+ SCALAR:
+  SALT2_BATCH.NSPEC_SCALAR++ ;
+  INTEG_zSED_SALT2(1, ifilt_obs, z, Tobs, parList_SN, parList_HOST,
+		   &FintegDum, &FerrDum, Fspec );
+  return ;
+
+} // end INTEG_zSED_SALT2_SPEC
+
 
 // **********************************************
 double SALT2x0calc(
@@ -3101,6 +4377,140 @@ void get_SALT2_ERRMAP(double Trest, double Lrest, double *ERRMAP ) {
 } // end of get_SALT2_ERRMAP
 
 
+// ***********************************************
+void init_SALT2_ERRTABLE(void) {
+
+  // Created Oct 2026
+  // Reset error-map lookup table; called after error maps are read.
+  // Table is used for any ERRMAP_INTERP_OPT except 0, which has
+  // zero errors and is handled by get_SALT2_ERRMAP.
+
+  SALT2_ERRTABLE.USE        = ( INPUT_SALT2_INFO.ERRMAP_INTERP_OPT != 0 );
+  SALT2_ERRTABLE.NSLOT      = 0 ;
+  SALT2_ERRTABLE.ISLOT_NEXT = 0 ;
+  SALT2_ERRTABLE.ISLOT_LAST = -1 ;
+  SALT2_ERRTABLE.STAMP      = 0 ;
+  SALT2_ERRTABLE.NLOOKUP    = 0 ;
+  SALT2_ERRTABLE.NFILL_SLOT = 0 ;
+  SALT2_ERRTABLE.NFILL_NODE = 0 ;
+
+} // end init_SALT2_ERRTABLE
+
+
+// ***********************************************
+int slot_SALT2_ERRTABLE(double Lrest) {
+
+  // Created Oct 2026
+  // Return table slot for rest-frame wavelength Lrest. If not found,
+  // the next slot (round-robin) is re-assigned to Lrest; the lambda 
+  // indices and color dispersion are computed here, while the day 
+  // nodes are filled on demand by get_SALT2_ERRTABLE.
+
+  int    islot, imap, ilam_min, NLAM ;
+  double LMIN, LSTEP ;
+  SALT2_ERRTABLE_SLOT_DEF *SLOT ;
+  char fnam[] = "slot_SALT2_ERRTABLE" ;
+
+  // ------------ BEGIN --------
+
+  islot = SALT2_ERRTABLE.ISLOT_LAST ;
+  if ( islot >= 0 && SALT2_ERRTABLE.SLOT[islot].LAMREST == Lrest ) 
+    { return islot; }
+
+  for(islot=0; islot < SALT2_ERRTABLE.NSLOT; islot++ ) {
+    if ( SALT2_ERRTABLE.SLOT[islot].LAMREST == Lrest ) 
+      { SALT2_ERRTABLE.ISLOT_LAST = islot;  return islot; }
+  }
+
+  // assign new slot
+  islot = SALT2_ERRTABLE.ISLOT_NEXT ;
+  SALT2_ERRTABLE.ISLOT_NEXT = (islot+1) % MXSLOT_ERRTABLE_SALT2 ;
+  if ( SALT2_ERRTABLE.NSLOT < MXSLOT_ERRTABLE_SALT2 ) 
+    { SALT2_ERRTABLE.NSLOT++ ; }
+
+  SLOT          = &SALT2_ERRTABLE.SLOT[islot];
+  SLOT->LAMREST = Lrest ;
+  SLOT->STAMP   = ++SALT2_ERRTABLE.STAMP ; // invalidate all day nodes
+  SLOT->CDISP   = SALT2colorDisp(Lrest,fnam);
+
+  for ( imap=0; imap < INDEX_SALT2_ERRMAP.COLORDISP; imap++ ) {
+    LMIN  = SALT2_ERRMAP[imap].LAMMIN ;
+    LSTEP = SALT2_ERRMAP[imap].LAMSTEP ;
+    NLAM  = SALT2_ERRMAP[imap].NLAM ;
+    ilam_min = (int)((Lrest - LMIN)/LSTEP) ;
+    if ( ilam_min >= NLAM-1 ) { ilam_min = NLAM - 2 ; }
+    if ( ilam_min <  0      ) { ilam_min = 0;         }
+    SLOT->ILAM[imap] = ilam_min ;
+    SLOT->FRAC[imap] = (Lrest - SALT2_ERRMAP[imap].LAM[ilam_min])/LSTEP;
+  }
+
+  SALT2_ERRTABLE.ISLOT_LAST = islot ;
+  SALT2_ERRTABLE.NFILL_SLOT++ ;
+  return islot ;
+
+} // end slot_SALT2_ERRTABLE
+
+
+// ***********************************************
+void get_SALT2_ERRTABLE(double Trest, double Lrest, double *ERRMAP,
+			double *cDisp) {
+
+  // Created Oct 2026
+  // Same output as get_SALT2_ERRMAP (linear interp), plus color 
+  // dispersion (cDisp) at Lrest. Bilinear interpolation is separable,
+  // so lambda interpolation at each day node is stored in the table 
+  // slot for Lrest, and only the Trest interpolation is done here.
+
+  int    islot, imap, iday, iday_min, jval, ilam, NLAM, NDAY ;
+  double TMIN, TSTEP, TDIF, val0, val1, frac, *NODE ;
+  SALT2_ERRTABLE_SLOT_DEF *SLOT ;
+
+  // ------------ BEGIN --------
+
+  islot = slot_SALT2_ERRTABLE(Lrest);
+  SLOT  = &SALT2_ERRTABLE.SLOT[islot];
+  SALT2_ERRTABLE.NLOOKUP++ ;
+
+  *cDisp = SLOT->CDISP ;
+
+  for ( imap=0; imap < NERRMAP_SALT2; imap++ ) {
+
+    if ( imap >= INDEX_SALT2_ERRMAP.COLORDISP ) { continue ; }
+
+    if ( ISMODEL_SALT3 && imap == INDEX_SALT2_ERRMAP.ERRSCALE )
+      { ERRMAP[imap] = 1.0 ; continue ; }
+
+    TMIN  = SALT2_ERRMAP[imap].DAYMIN ;
+    TSTEP = SALT2_ERRMAP[imap].DAYSTEP ;
+    NDAY  = SALT2_ERRMAP[imap].NDAY ;
+    NLAM  = SALT2_ERRMAP[imap].NLAM ;
+
+    iday_min = (int)((Trest - TMIN)/TSTEP) ;
+    if ( iday_min >= NDAY-1 ) { iday_min = NDAY - 2 ; }
+    if ( iday_min <  0      ) { iday_min = 0; } 
+
+    // fill lambda-interpolated nodes at iday_min and iday_min+1
+    NODE = SLOT->NODE[imap] ;
+    ilam = SLOT->ILAM[imap] ;
+    frac = SLOT->FRAC[imap] ;
+    for(iday=iday_min; iday <= iday_min+1; iday++ ) {
+      if ( SLOT->NODE_STAMP[imap][iday] == SLOT->STAMP ) { continue; }
+      jval = NLAM*iday + ilam ;
+      val0 = SALT2_ERRMAP[imap].VALUE[jval];
+      val1 = SALT2_ERRMAP[imap].VALUE[jval+1];
+      NODE[iday] = val0 + (val1-val0) * frac ;
+      SLOT->NODE_STAMP[imap][iday] = SLOT->STAMP ;
+      SALT2_ERRTABLE.NFILL_NODE++ ;
+    }
+
+    TDIF  = Trest - SALT2_ERRMAP[imap].DAY[iday_min];
+    ERRMAP[imap] = NODE[iday_min] + 
+      (NODE[iday_min+1]-NODE[iday_min]) * TDIF/TSTEP ;
+  } 
+
+} // end get_SALT2_ERRTABLE
+
+
 // *******************************************************
 int gencovar_SALT2(int MATSIZE, int *ifiltobsList, double *epobsList, 
 		   double z, double *parList_SN, double *parList_HOST,
@@ -3506,6 +4916,8 @@ void genSpec_SALT2(double *parList_SN, double *parList_HOST, double mwebv,
   //
   // Jul 29 2024: replace a few pow(x,2) with x*x (for speed)
   //
+  // Oct 15 2026: call INTEG_zSED_SALT2_SPEC
+  //
   // ------------------------------------------
 
   int    NBLAM      = SPECTROGRAPH_SEDMODEL.NBLAM_TOT ;
@@ -3525,7 +4937,7 @@ void genSpec_SALT2(double *parList_SN, double *parList_HOST, double mwebv,
   
   double Tobs_SED = Tobs; // Tobs to fetch SED
 
-  double Trest, Finteg, Finteg_errPar, MWXT_FRAC ;
+  double Trest, MWXT_FRAC ;
   double FTMP, GENFLUX, ZP, MAG, LAM, LAMREST, z1, FSCALE_ZP;
   double FTMP_DAYMAX, MAG_DAYMAX ;
   double hc8 = (double)hc ;
@@ -3556,10 +4968,10 @@ void genSpec_SALT2(double *parList_SN, double *parList_HOST, double mwebv,
   } 
   
   // - - - - -  
-      
-  INTEG_zSED_SALT2(1, JFILT_SPECTROGRAPH, z, Tobs_SED, 
-		   parList_SN, parList_HOST,
-		   &Finteg, &Finteg_errPar,  GENFLUX_LIST ) ;
+
+  // Oct 2026: vectorized spectrum (falls back to INTEG_zSED_SALT2)
+  INTEG_zSED_SALT2_SPEC(JFILT_SPECTROGRAPH, z, Tobs_SED, 
+			parList_SN, parList_HOST, GENFLUX_LIST ) ;
 
   FSCALE_ZP = pow(TEN,-0.4*MAG_OFFSET);
 
@@ -3634,7 +5046,7 @@ int getSpec_band_SALT2(int ifilt_obs, float Tobs_f, float z_f,
   int NBLAM      = FILTER_SEDMODEL[ifilt].NLAM ;
   int MEMD   = NBLAM * sizeof(double);
   int ilam ;
-  double LAMOBS, LAMREST, z1, Finteg, Finteg_errPar, Finteg_check, TRANS ;
+  double LAMOBS, LAMREST, z1, Finteg_check, TRANS ;
   double RV_host=-9.0, AV_host=0.0, m_host = -9.0  ;
 
   double Tobs  = (double)Tobs_f ;
@@ -3655,9 +5067,8 @@ int getSpec_band_SALT2(int ifilt_obs, float Tobs_f, float z_f,
   if ( Trest <= SALT2_TABLE.DAYMIN ) { return(0); }
   if ( Trest >= SALT2_TABLE.DAYMAX ) { return(0); }
 
-  INTEG_zSED_SALT2(1, ifilt_obs, z, Tobs,         // (I)
-		   parList_SN, parList_HOST,      // (I)
-		   &Finteg, &Finteg_errPar, FLUXLIST ) ; // (O)
+  INTEG_zSED_SALT2_SPEC(ifilt_obs, z, Tobs,             // (I)
+			parList_SN, parList_HOST, FLUXLIST ) ; // (I,O)
   
   Finteg_check = 0.0 ;  z1=1.0+z ;
   for(ilam=0; ilam < NBLAM; ilam++ ) {
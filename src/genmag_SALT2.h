@@ -199,6 +199,107 @@ struct SALT2_TABLE {
 
 
 
+// Oct 2026: packed (SoA) filter-lambda arrays for batched integration
+// of all epochs in one filter; see INTEG_zSED_SALT2_BATCH.
+// Arrays are cached per filter and refilled when the event key
+// (z, c, RV_host, AV_host, MWEBV) changes.
+#define NKEY_BATCH_SALT2 5
+typedef struct {
+  int    NLAM_MALLOC, NLAM ;  // allocated and packed number of bins
+  int    ISTAT ;              // -1=empty, 0=invalid (use scalar), 1=OK
+  double KEY[NKEY_BATCH_SALT2] ;
+  int    *ILAMOBS ;          // filter lambda index
+  int    *ILAMSED ;          // SED lambda index
+  double *FRAC_LAMSED ;      // interp frac in SED bin
+  double *WGT_FLUX ;         // CCOR*XTHOST*XTMW*LAMSED*TRANS
+  double *WGT_ERR ;          // idem without XTMW
+  double *DLNCCOR_DC ;       // d ln(CCOR)/dc for analytic gradient
+  double FNORM_SALT3 ;       // sum TRANS*LAMOBS
+
+  // Oct 15 2026: per-epoch cache of filter-integrated surfaces for
+  // current KEY; reused when Tobs is unchanged (e.g., fit steps in
+  // x0 & x1) so that flux is a linear combination of components.
+  int    NEP_MALLOC, NEP_COMP ;
+  int    *ISTAT_COMP ;      // 1 -> cached components are valid
+  double *TOBS_COMP ;       // Tobs for each cached epoch
+  double *FCOMP, *ECOMP ;   // [ep*MXSURFACE_SALT2+ised] flux & err sums
+  double *X1RANGE_COMP ;    // [2*ep+0,1] x1 range without negative flux
+} SALT2_BATCH_FILTER_DEF ;
+
+// Oct 2026: packed sub-bin arrays for spectra (INTEG_zSED_SALT2_SPEC).
+// Each spectrum bin (ILAMOBS) may have several SED sub-bins; same
+// event key and cache logic as SALT2_BATCH_FILTER_DEF.
+typedef struct {
+  bool   INIT ;
+  int    NSUB_MALLOC, NSUB ;   // allocated and packed number of sub-bins
+  int    NLAM_MALLOC ;         // allocated number of spectrum bins
+  int    ISTAT ;               // -1=empty, 0=invalid (use scalar), 1=OK
+  double KEY[NKEY_BATCH_SALT2] ;
+  int    *ILAMOBS ;            // spectrum bin for each sub-bin
+  int    *ILAMSED ;            // SED lambda index
+  double *FRAC_LAMSED ;        // interp frac in SED bin
+  double *WGT_SPEC ;           // CCOR*XTHOST*XTMW*LAMSPEC_STEP/LAMFILT_STEP
+  double *WGT_CHK ;            // CCOR*XTHOST*XTMW*LAMSED*TRANS (neg check)
+  double *SMEAR ;              // genSmear flux-scale per sub-bin
+  double *FLAM[MXSURFACE_SALT2], *FCHK[MXSURFACE_SALT2] ; // scratch
+  int    NLAMREST ;            // number of valid LAMREST for genSmear
+  double *LAMREST ;            // rest-frame lambda per spectrum bin
+} SALT2_SPEC_BATCH_DEF ;
+
+struct {
+  SALT2_BATCH_FILTER_DEF FILTER[MXFILT_SEDMODEL] ; // vs. sparse ifilt
+  SALT2_SPEC_BATCH_DEF   SPEC[MXFILT_SEDMODEL] ;   // idem for spectra
+  long long NSPEC_BATCH, NSPEC_SCALAR ;  // spectra diagnostics
+  double FLAM[MXSURFACE_SALT2][MXBIN_LAMFILT_SEDMODEL] ; // scratch per epoch
+  double FERR[MXSURFACE_SALT2][MXBIN_LAMFILT_SEDMODEL] ; // idem for err
+  double SMEAR[MXBIN_LAMFILT_SEDMODEL] ;  // genSmear flux-scale per bin
+  long long NCALL_FILL, NCALL_REUSE ;     // cache diagnostics
+  long long NEP_COMP_FILL, NEP_COMP_REUSE ; // idem for epoch components
+} SALT2_BATCH ;
+
+// Oct 2026: optional node-local shared memory for SALT2 template and
+// error-map tables (rd_sedFlux output). First job on a node parses
+// text files and publishes [DIR_SHM_SALT2]/SNANA_SALT2_[hash];
+// later jobs (e.g., split snlc_fit jobs) mmap the published table.
+// Stale files are never matched (hash includes file size & mod-time),
+// and can be removed with  rm /dev/shm/SNANA_SALT2_*
+#define ENV_SHM_SALT2      "SNANA_SALT2_SHM"   // =1 to enable
+#define DIR_SHM_SALT2      "/dev/shm"          // POSIX shm mount on linux
+#define PREFIX_SHM_SALT2   "SNANA_SALT2"
+#define MAGIC_SHM_SALT2    "SALT2SHM"
+#define VERSION_SHM_SALT2  1
+#define NHEAD_SHM_SALT2    8    // long long words in header
+#define TWAIT_SHM_SALT2    120  // max wait (sec) for publisher
+
+struct {
+  bool USE ;
+  int  NLOAD, NPUBLISH ;  // diagnostic counters
+} SALT2_SHM ;
+
+// Oct 2026: error-map lookup table pre-interpolated in rest-frame 
+// lambda; one slot per <lamObs>/(1+z) key, i.e., per filter and 
+// redshift. Each slot stores lambda-interpolated map values at each
+// day node (filled on demand), so SALT2magerr needs only a 1D 
+// interpolation in Trest. The x1 dependence (var0, var1, covar01) 
+// is combined after lookup as before.
+#define MXSLOT_ERRTABLE_SALT2 20
+typedef struct {
+  double LAMREST ;                  // key: <lamObs>/(1+z)
+  double CDISP ;                    // SALT2colorDisp(LAMREST)
+  int    ILAM[MXERRMAP_SALT2] ;     // lower lambda index in each map
+  double FRAC[MXERRMAP_SALT2] ;     // lambda-interp fraction 
+  int    STAMP ;                    // NODE is valid if NODE_STAMP==STAMP
+  int    NODE_STAMP[MXERRMAP_SALT2][MXBIN_DAYSED_SEDMODEL] ;
+  double NODE[MXERRMAP_SALT2][MXBIN_DAYSED_SEDMODEL] ;
+} SALT2_ERRTABLE_SLOT_DEF ;
+
+struct {
+  bool USE ;
+  int  NSLOT, ISLOT_NEXT, ISLOT_LAST, STAMP ;
+  SALT2_ERRTABLE_SLOT_DEF SLOT[MXSLOT_ERRTABLE_SALT2] ;
+  long long NLOOKUP, NFILL_SLOT, NFILL_NODE ; // diagnostics
+} SALT2_ERRTABLE ;
+
 // define structure for storing SALT2 spectrum and storing in table.
 
 
@@ -209,11 +310,32 @@ struct SALT2_TABLE {
 int  init_genmag_SALT2(char *model_version, char *model_extrap_latetime, 
 		       int OPTMASK );
 
+void init_SHM_SALT2(void);
+void rd_sedFlux_SALT2(char *sedFile, char *sedcomment,
+		      double *Trange, double *Lrange,
+		      int *NDAY, double *DAY, double *DAYSTEP,
+		      int *NLAM, double *LAM, double *LAMSTEP,
+		      double *FLUX, double *FLUXERR, int *nflux_nan);
+unsigned long long hash_SHM_SALT2(char *sedFile, 
+				  double *Trange, double *Lrange);
+void publish_SHM_SALT2(int fd, char *shmFile,
+		       int NDAY, double *DAY, double DAYSTEP,
+		       int NLAM, double *LAM, double LAMSTEP,
+		       double *FLUX, int nflux_nan);
+bool load_SHM_SALT2(char *shmFile, char *sedcomment,
+		    int *NDAY, double *DAY, double *DAYSTEP,
+		    int *NLAM, double *LAM, double *LAMSTEP,
+		    double *FLUX, int *nflux_nan);
+
 void genmag_SALT2(int OPTMASK, int ifilt, 
 		  double *parList_SN, double *parList_HOST, double mwebv,
 		  double z, double z_forErr, int nobs, double *Tobs_list, 
 		  double *magobs_list, double *magerr_list );
 
+void genmag_SALT2_BATCH(int OPTMASK, GENMAG_BATCH_DEF *GENMAG_BATCH,
+			double *parList_SN, double *parList_HOST, 
+			double mwebv, double z, double z_forErr);
+
 int  NSURFACE_SALT2(void);
 
 void colordump_SALT2(double lam, double c, char *cfilt);
@@ -248,6 +370,10 @@ void check_BADVAL_SALT2errmap(int imap);  // check for Nan & crazy values
 void init_BADVAL_SALT2errmap(int imap);  
 
 void get_SALT2_ERRMAP(double Trest, double Lrest, double *ERRMAP );
+void init_SALT2_ERRTABLE(void);
+int  slot_SALT2_ERRTABLE(double Lrest);
+void get_SALT2_ERRTABLE(double Trest, double Lrest, double *ERRMAP,
+			double *cDisp);
 
 void load_mBoff_SALT2(void);
 
@@ -269,6 +395,37 @@ void INTEG_zSED_SALT2(int OPT_SPEC, int ifilt_obs, double z, double Tobs,
 		      double *parList_SN, double *parList_HOST,
 		      double *Finteg, double *Finteg_errPar, 
 		      double *Fspec );
+int  prep_INTEG_zSED_SALT2_BATCH(int ifilt_obs, double z, 
+				 double *parList_SN, double *parList_HOST);
+void INTEG_zSED_SALT2_BATCH(int ifilt_obs, double z, 
+			    int NEP, double *Tobs_list,
+			    double *parList_SN, double *parList_HOST,
+			    double *Finteg_list, double *Finteg_errPar_list);
+int  dlnflux_SALT2(int ifilt_obs, double *parList_SN, double *parList_HOST,
+		   double mwebv, double z, double Tobs, double *DLNF);
+int  dlnflux_salt2__(int *ifilt_obs, double *parList_SN, 
+		     double *parList_HOST, double *mwebv, double *z, 
+		     double *Tobs, double *DLNF);
+void malloc_COMP_SALT2_BATCH(SALT2_BATCH_FILTER_DEF *BATCH, int NEP);
+bool get_COMP_SALT2_BATCH(SALT2_BATCH_FILTER_DEF *BATCH, int ep,
+			  double Tobs, double x1, double *Finteg_filter, 
+			  double *Finteg_forErr);
+void store_COMP_SALT2_BATCH(SALT2_BATCH_FILTER_DEF *BATCH, int ep,
+			    double Tobs, double *Finteg_filter, 
+			    double *Finteg_forErr);
+int  prep_INTEG_zSED_SALT2_SPEC(int ifilt_obs, double z, 
+				double *parList_SN, double *parList_HOST);
+void INTEG_zSED_SALT2_SPEC(int ifilt_obs, double z, double Tobs, 
+			   double *parList_SN, double *parList_HOST,
+			   double *Fspec);
+void interp_SEDFLUX_SALT2_BATCH(int NLAM, const int *restrict ILAM, 
+				const double *restrict FRAC, double FDAY,
+				const double *restrict S0, 
+				const double *restrict S1,
+				const double *restrict SMEAR, 
+				const double *restrict WFLUX, 
+				const double *restrict WERR,
+				double *restrict FLAM, double *restrict FERR);
 
 int gencovar_SALT2(int MATSIZE, int *ifilt_obs, double *epobs, 
 		   double z, double *parList_SN, double *parList_HOST, 
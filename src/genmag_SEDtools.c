@@ -51,6 +51,15 @@
       extinction table is no longer created for every iteration.
       Fits now go almost x10 faster ... same speed as in March 2020
 
+  Oct 15 2026:
+    + new function get_ZMAP_SEDMODEL to cache filter-to-SED wavelength
+      map vs. redshift; used by SALT2 and PySEDMODEL flux integrals.
+    + fill_TABLE_MWXT_SEDMODEL evaluates each filter's lambda array
+      with one call to GALextinct_array.
+    + new function set_calibZP_SEDMODEL to adopt zeropoint computed
+      by kcor.exe and stored in calib file, so that all SED-model
+      programs use identical zeropoints.
+
 ********************************************/
 
 #include "sntools.h"           // community tools
@@ -372,6 +381,53 @@ int init_filter_SEDMODEL(
 }  // end of init_filter_SEDMODEL
 
 
+// ***********************************************
+void set_calibZP_SEDMODEL(int ifilt_obs, double ZP_CALIB) {
+
+  // Created Oct 2026
+  // Call after init_filter_SEDMODEL to replace internally computed
+  // ZP with ZP_CALIB computed by kcor.exe and read from calib file
+  // (see get_calib_ZP_SEDMODEL). ZP_CALIB <= 0 means that calib file
+  // does not have this info, and internal ZP is kept.
+  // The internal and stored ZP should agree to float precision;
+  // a larger difference means that filter or primary was modified
+  // after kcor.exe, so print warning and keep internal ZP.
+
+  int    ifilt = IFILTMAP_SEDMODEL[ifilt_obs] ;
+  double ZP, dif;
+  double DIFMAX = 0.002 ;
+  char fnam[] = "set_calibZP_SEDMODEL" ;
+
+  // ------------ BEGIN -------------
+
+  if ( ZP_CALIB <= 0.0 ) { return; }
+
+  if ( ifilt < 0 ) {
+    sprintf(c1err,"ifilt_obs=%d not initialized.", ifilt_obs);
+    sprintf(c2err,"Call init_filter_SEDMODEL first.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  if ( FILTER_SEDMODEL[ifilt].lamshift != 0.0 ) { return; }
+
+  ZP  = FILTER_SEDMODEL[ifilt].ZP ;
+  dif = ZP_CALIB - ZP ;
+
+  if ( fabs(dif) > DIFMAX ) {
+    printf("   WARNING(%s): %s ZP(calib) - ZP(internal) = %.4f "
+	   "-> keep internal ZP\n", 
+	   fnam, FILTER_SEDMODEL[ifilt].name, dif );
+    fflush(stdout);
+    return;
+  }
+
+  FILTER_SEDMODEL[ifilt].ZP = ZP_CALIB ;
+
+  return;
+
+} // end set_calibZP_SEDMODEL
+
+
 // ***********************************************
 void filtdump_SEDMODEL(void) {
 
@@ -426,6 +482,108 @@ void filtdump_SEDMODEL(void) {
 
 
 
+// ===========================================================
+ZMAP_SEDMODEL_DEF *get_ZMAP_SEDMODEL(int ifilt, double z, 
+				     double LAMMIN, double LAMMAX,
+				     int NLAMSED, double *LAMSED_LIST, 
+				     double LAMSED_STEP) {
+
+  // Created Oct 2026
+  // Return pointer to map of filter bins (sparse index ifilt) onto
+  // rest-frame SED grid LAMSED_LIST at redshift z. Map includes
+  // filter bins with TRANS >= 1.0E-12 and LAMMIN <= LAMSED <= LAMMAX.
+  //  
+  // LAMSED_STEP > 0 -> uniform SED grid; ILAMSED = (LAMSED-LAM0)/STEP
+  // LAMSED_STEP = 0 -> non-uniform grid; ILAMSED from quickBinSearch.
+  //
+  // Map is cached in one of NSLOT_ZMAP_SEDMODEL slots per filter,
+  // selected by redshift bin. On cache miss, map is recomputed
+  // exactly for this z, so results do not depend on the cache.
+
+  int    NLAMFILT = FILTER_SEDMODEL[ifilt].NLAM ;
+  int    islot, ilamobs, ilamsed, MEMI, MEMD, NLAM = 0 ;
+  double z1 = 1.0 + z ;
+  double LAMOBS, LAMSED, TRANS, LAMBIN ;
+  ZMAP_SEDMODEL_DEF *ZMAP ;
+  char fnam[] = "get_ZMAP_SEDMODEL" ;
+
+  // ----------- BEGIN ------------
+
+  islot = (int)(z/DZBIN_ZMAP_SEDMODEL) ;
+  if ( islot < 0 ) { islot = 0; }
+  islot = islot % NSLOT_ZMAP_SEDMODEL ;
+  ZMAP  = &ZMAP_SEDMODEL.SLOT[ifilt][islot] ;
+
+  if ( ZMAP->NLAM_MALLOC > 0        && 
+       ZMAP->z           == z       && 
+       ZMAP->LAMMIN      == LAMMIN  &&  ZMAP->LAMMAX  == LAMMAX  &&
+       ZMAP->LAMSED_LIST == LAMSED_LIST && ZMAP->NLAMSED == NLAMSED &&
+       ZMAP->LAMSED_STEP == LAMSED_STEP ) {
+    ZMAP_SEDMODEL.NCALL_HIT++ ;
+    return ZMAP ;
+  }
+
+  ZMAP_SEDMODEL.NCALL_MISS++ ;
+
+  // allocate memory only once per filter & slot
+  if ( ZMAP->NLAM_MALLOC == 0 ) {
+    MEMI = (NLAMFILT+1) * sizeof(int);
+    MEMD = (NLAMFILT+1) * sizeof(double);
+    ZMAP->ILAMOBS = (int   *)malloc(MEMI);
+    ZMAP->ILAMSED = (int   *)malloc(MEMI);
+    ZMAP->LAMOBS  = (double*)malloc(MEMD);
+    ZMAP->LAMSED  = (double*)malloc(MEMD);
+    ZMAP->FRAC    = (double*)malloc(MEMD);
+    ZMAP->TRANS   = (double*)malloc(MEMD);
+    ZMAP->NLAM_MALLOC = NLAMFILT ;
+  }
+
+  ZMAP->z           = z ;
+  ZMAP->LAMMIN      = LAMMIN ;
+  ZMAP->LAMMAX      = LAMMAX ;
+  ZMAP->LAMSED_LIST = LAMSED_LIST ;
+  ZMAP->NLAMSED     = NLAMSED ;
+  ZMAP->LAMSED_STEP = LAMSED_STEP ;
+  ZMAP->ISTAT       = 1 ;
+
+  for ( ilamobs=0; ilamobs < NLAMFILT; ilamobs++ ) {
+
+    get_LAMTRANS_SEDMODEL(ifilt, ilamobs, &LAMOBS, &TRANS);
+    if ( TRANS < 1.0E-12 ) { continue ; }
+
+    LAMSED = LAMOBS / z1 ;
+    if ( LAMSED < LAMMIN ) { continue ; }
+    if ( LAMSED > LAMMAX ) { continue ; }
+
+    if ( LAMSED_STEP > 0.0 ) {
+      ilamsed = (int)( (LAMSED - LAMSED_LIST[0]) / LAMSED_STEP ); 
+      if ( ilamsed < 0 || ilamsed >= NLAMSED ) 
+	{ ZMAP->ISTAT = 0;  continue; }
+      LAMBIN  = LAMSED_STEP ;
+    }
+    else {
+      ilamsed = quickBinSearch(LAMSED, NLAMSED, LAMSED_LIST, fnam, fnam);
+      if ( ilamsed < NLAMSED-1 ) 
+	{ LAMBIN = LAMSED_LIST[ilamsed+1] - LAMSED_LIST[ilamsed] ; }
+      else
+	{ LAMBIN = 1.0 ; }
+    }
+
+    ZMAP->ILAMOBS[NLAM] = ilamobs ;
+    ZMAP->ILAMSED[NLAM] = ilamsed ;
+    ZMAP->LAMOBS[NLAM]  = LAMOBS ;
+    ZMAP->LAMSED[NLAM]  = LAMSED ;
+    ZMAP->FRAC[NLAM]    = (LAMSED - LAMSED_LIST[ilamsed]) / LAMBIN ;
+    ZMAP->TRANS[NLAM]   = TRANS ;
+    NLAM++ ;
+  }
+
+  ZMAP->NLAM = NLAM ;
+
+  return ZMAP ;
+
+} // end get_ZMAP_SEDMODEL
+
 // ***********************************
 void init_MWXT_SEDMODEL(int OPT_COLORLAW, double *PARLIST_COLORLAW, double RV) {
   // ------------------------
@@ -658,10 +816,18 @@ void malloc_FLUXTABLE_SEDMODEL( int NFILT, int NZBIN, int NLAMPOW,
   NBTOT_SEDMODEL_FLUXTABLE = N1DBINOFF_SEDMODEL_FLUXTABLE[0] ;
   ISIZE_SEDMODEL_FLUXTABLE = NBTOT_SEDMODEL_FLUXTABLE * isize ;
 
-  PTR_SEDMODEL_FLUXTABLE =  (float*)malloc(ISIZE_SEDMODEL_FLUXTABLE);
-
-  printf("  %s : allocate %6.2f Mb of memory for integral-flux tables. \n", 
-	 fnam, 1.E-6*(double)ISIZE_SEDMODEL_FLUXTABLE );
+  // Oct 2026: if table is mmap'ed later from binary file, 
+  //           do not allocate and do not zero here.
+  if ( MMAP_SEDMODEL_FLUXTABLE ) {
+    PTR_SEDMODEL_FLUXTABLE = NULL ;
+    printf("  %s : defer %6.2f Mb integral-flux tables to mmap. \n", 
+	   fnam, 1.E-6*(double)ISIZE_SEDMODEL_FLUXTABLE );
+  }
+  else {
+    PTR_SEDMODEL_FLUXTABLE =  (float*)malloc(ISIZE_SEDMODEL_FLUXTABLE);
+    printf("  %s : allocate %6.2f Mb of memory for integral-flux tables. \n", 
+	   fnam, 1.E-6*(double)ISIZE_SEDMODEL_FLUXTABLE );
+  }
 
   //  printf("\t\t Tables include lambda powers up to %d .\n",  NLAMPOW );
   printf("\t Table bins include %3d DAYs. \n",    NDAY);
@@ -683,7 +849,7 @@ void malloc_FLUXTABLE_SEDMODEL( int NFILT, int NZBIN, int NLAMPOW,
   }
 
 
-  zero_flux_SEDMODEL();
+  if ( !MMAP_SEDMODEL_FLUXTABLE ) { zero_flux_SEDMODEL(); }
 
   // - - - - - - - 
  
@@ -2190,6 +2356,10 @@ int init_filter_sedmodel__(int *ifilt_obs, char *filter_name,
   return istat;
 }
 
+void set_calibzp_sedmodel__(int *ifilt_obs, double *ZP_CALIB) {
+  set_calibZP_SEDMODEL(*ifilt_obs, *ZP_CALIB);
+}
+
 void init_redshift_sedmodel__(int *NZbin, double *Zmin, double *Zmax) {
   init_redshift_SEDMODEL(*NZbin, *Zmin, *Zmax);
 }
@@ -2588,6 +2758,8 @@ void fill_TABLE_MWXT_SEDMODEL(double RV, double mwebv) {
   // 
   // July 24 2016: if spectrograph option is set, load IFILT_SPECTROGRPAPH
   //
+  // Oct 15 2026: use GALextinct_array (one spline setup per filter)
+  //
 
   int  NLAMFILT, NBSPEC, ilam, I8, I8p, ifilt, ifilt_min ;
   int  OPT_COLORLAW ;
@@ -2629,9 +2801,14 @@ void fill_TABLE_MWXT_SEDMODEL(double RV, double mwebv) {
    
     NLAMFILT = FILTER_SEDMODEL[ifilt].NLAM ; 
 
+    // Oct 2026: evaluate extinction for entire lambda array in one call,
+    //           then convert mag -> flux-fraction in place.
+    GALextinct_array(RV, AV, NLAMFILT, FILTER_SEDMODEL[ifilt].lam,
+		     OPT_COLORLAW, PARLIST_COLORLAW, 
+		     SEDMODEL_TABLE_MWXT_FRAC[ifilt], fnam );
+
     for ( ilam=0; ilam < NLAMFILT; ilam++ ) {
-      LAMOBS     = FILTER_SEDMODEL[ifilt].lam[ilam] ;
-      XT_MAG     = GALextinct ( RV, AV, LAMOBS, OPT_COLORLAW, PARLIST_COLORLAW, fnam ) ;
+      XT_MAG     = SEDMODEL_TABLE_MWXT_FRAC[ifilt][ilam] ;
       arg        = -0.4*XT_MAG ;
       XT_FRAC    = pow(TEN,arg);    // flux-fraction thru MW
       SEDMODEL_TABLE_MWXT_FRAC[ifilt][ilam]  = XT_FRAC ;
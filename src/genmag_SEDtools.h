@@ -21,6 +21,11 @@
 
  May 31 2024: use global MXLAMBIN_SNANA (from sntools.h) to specify max number of wave bins
 
+ Oct 14 2026: define GENMAG_BATCH_DEF for all-filter/all-epoch genmag calls.
+ Oct 14 2026: MMAP_SEDMODEL_FLUXTABLE flag to mmap flux table from binary.
+ Oct 15 2026: define ZMAP_SEDMODEL cache of filter-to-SED wavelength map
+              vs. redshift; see get_ZMAP_SEDMODEL.
+
 ********************************************/
 
 // define bounds for filter and SED arrays
@@ -199,9 +204,56 @@ typedef struct SEDMODEL_FLUX_DEF {
 
 
 SEDMODEL_FLUX_DEF  TEMP_SEDMODEL ;
+
+
+// Oct 2026: request for model mags in all filters and epochs of one
+// event; passed to genmag_[MODEL]_BATCH functions so that per-event
+// setup is done once, and to allow models to fuse filter/epoch loops.
+// Arrays are NOT allocated here; pointers are set by caller.
+typedef struct GENMAG_BATCH_DEF {
+  int    NFILT ;                     // number of filters
+  int    IFILT_OBS[MXFILT_SEDMODEL]; // absolute obs-filter index
+  int    NEP[MXFILT_SEDMODEL];       // number of epochs per filter
+  double *TOBS[MXFILT_SEDMODEL];     // (I) Tobs list per filter
+  double *MAG[MXFILT_SEDMODEL];      // (O) mag (or flux) list
+  double *MAGERR[MXFILT_SEDMODEL];   // (O) mag-error list
+} GENMAG_BATCH_DEF ;
 // xxx mark SEDMODEL_FLUX_DEF *SEDMODEL_STORE ; // used with SPECTROGRAPH
 
 
+// Oct 2026: cache of filter-to-SED wavelength map for one redshift:
+// list of filter bins with non-zero transmission that are inside the
+// SED wavelength range, with rest-frame SED bin index and interp
+// fraction. Each filter has NSLOT_ZMAP_SEDMODEL slots selected by
+// redshift bin; a slot is recomputed (exactly) when its redshift or
+// SED grid does not match, so that repeated calls at the same redshift
+// (other epochs, fit iterations, peak mags, search-eff) skip the
+// per-bin search.
+#define NSLOT_ZMAP_SEDMODEL  50
+#define DZBIN_ZMAP_SEDMODEL  0.001  // z-bin size to select slot
+typedef struct ZMAP_SEDMODEL_DEF {
+  double z ;              // exact redshift (key)
+  double LAMMIN, LAMMAX ; // rest-frame SED range used for map (key)
+  double *LAMSED_LIST ;   // pointer to SED lambda grid (key)
+  int    NLAMSED ;        // size of SED lambda grid (key)
+  double LAMSED_STEP ;    // >0 for uniform grid (key)
+
+  int    ISTAT ;          // 1=valid map, 0=SED bin out of bounds
+  int    NLAM, NLAM_MALLOC ;
+  int    *ILAMOBS ;       // filter bin index
+  int    *ILAMSED ;       // SED bin index: LAMSED_LIST[ILAMSED] <= LAMSED
+  double *LAMOBS ;        // obs-frame filter lambda
+  double *LAMSED ;        // rest-frame lambda = LAMOBS/(1+z)
+  double *FRAC ;          // fraction of LAMSED within SED bin
+  double *TRANS ;         // filter transmission
+} ZMAP_SEDMODEL_DEF ;
+
+struct {
+  ZMAP_SEDMODEL_DEF SLOT[MXFILT_SEDMODEL][NSLOT_ZMAP_SEDMODEL];
+  long long NCALL_HIT, NCALL_MISS ;
+} ZMAP_SEDMODEL ;
+
+
 int NVAR_FIRSTBIN_SEDMODEL ;
 struct FIRSTBIN_SEDMODEL  {
   int    NSED;
@@ -241,6 +293,7 @@ float SEDBINARY[MXBIN_SED_SEDMODEL];
 #define IDIM_SEDMODEL_SED      5
 
 float    *PTR_SEDMODEL_FLUXTABLE ;  // pointer array
+bool      MMAP_SEDMODEL_FLUXTABLE ; // T -> table is mmap of binary (Oct 2026)
 long int  ISIZE_SEDMODEL_FLUXTABLE;  // total size
 long int  NBTOT_SEDMODEL_FLUXTABLE;  // total number of fluxtable bins
 int       NBIN_SEDMODEL_FLUXTABLE[NDIM_SEDMODEL_FLUXTABLE+1];
@@ -280,8 +333,15 @@ int init_filter_SEDMODEL(int ifilt_obs, char *filter_name, char *survey_name,
 			 double *TRANSSNLIST, double *TRANSREFLIST, 
 			 double LAMSHIFT ) ;
 
+void set_calibZP_SEDMODEL(int ifilt_obs, double ZP_CALIB);
+
 void filtdump_SEDMODEL(void);   // one-line dump per filter.
 
+ZMAP_SEDMODEL_DEF *get_ZMAP_SEDMODEL(int ifilt, double z, 
+				     double LAMMIN, double LAMMAX,
+				     int NLAMSED, double *LAMSED_LIST, 
+				     double LAMSED_STEP);
+
 void init_redshift_SEDMODEL(int NZbin, double Zmin,  double Zmax);
 
 void init_MWXT_SEDMODEL(int OPT_COLORLAW, double *PARLIST_COLORLAW, double RV) ;
@@ -400,6 +460,8 @@ int init_filter_sedmodel__(int *ifilt_obs, char *filter_name,
 			   double *TRANSREFLIST, 
 			   double *LAMSHIFT) ;
 
+void set_calibzp_sedmodel__(int *ifilt_obs, double *ZP_CALIB);
+
 void init_redshift_sedmodel__(int *NZbin, double *Zmin,  double *Zmax) ;
 
 void init_mwxt_sedmodel__(int *OPT_COLORLAW, double *PARLIST_COLORLAW, double *RV) ;
@@ -56,12 +56,17 @@
  Mar 02 2022: fix bug so that UVLAM_EXTRAP works when reading binary file
               or original text files.
 
+ Oct 14 2026: SIMSED_USE_BINARY += 512 -> mmap flux-table binary so that
+              pages are loaded on demand (see mmap_SIMSED_TABBINARY).
+
 *************************************/
 
 #include  <stdio.h> 
 #include  <math.h>     
 #include  <stdlib.h>   
 #include  <sys/stat.h>
+#include  <sys/mman.h>
+#include  <unistd.h>
 
 #include  "sntools.h"           // SNANA community tools
 #include  "genmag_SEDtools.h"
@@ -277,6 +282,11 @@ int init_genmag_SIMSED(char *VERSION      // SIMSED version
 		   &SIMSED_BINARY_INFO.RDFLAG_FLUX, 
 		   &SIMSED_BINARY_INFO.WRFLAG_FLUX);
 
+    // Oct 2026: option to mmap existing flux-table binary
+    MMAP_SEDMODEL_FLUXTABLE = 
+      ( SIMSED_BINARY_INFO.RDFLAG_FLUX && 
+	(OPTMASK & OPTMASK_INIT_SIMSED_MMAP) > 0 ) ;
+
   }
 
   // -------------------------------------- 
@@ -588,6 +598,7 @@ void read_SIMSED_TABBINARY(FILE *fp, char *binFile, int OPTMASK ) {
   //
   // Mar 24 2021: improve error messaging with CTAG.
   // Jul 02 2025: check OPTMASK bit to check KCOR_FILE
+  // Oct 14 2026: check option to mmap flux table instead of fread
   
   bool REQUIRE_KCOR_MATCH = ( OPTMASK & OPTMASK_INIT_SIMSED_SKIP_KCOR_MATCH) == 0 ;
   int NERR, idim, IZSIZE_RD, IZSIZE_ACTUAL;
@@ -665,7 +676,7 @@ void read_SIMSED_TABBINARY(FILE *fp, char *binFile, int OPTMASK ) {
   if ( LZOK  &&  LZSAME == 0 ) {
     printf("  Re-allocate memory with larger redshift range from table. \n");
     fflush(stdout);
-    free(PTR_SEDMODEL_FLUXTABLE) ;
+    if ( !MMAP_SEDMODEL_FLUXTABLE ) { free(PTR_SEDMODEL_FLUXTABLE) ; }
     malloc_FLUXTABLE_SEDMODEL ( NFILT_SEDMODEL, REDSHIFT_SEDMODEL.NZBIN,
 				NLAMPOW_SEDMODEL, SEDMODEL.MXDAY, 
 				SEDMODEL.NSURFACE );
@@ -715,10 +726,15 @@ void read_SIMSED_TABBINARY(FILE *fp, char *binFile, int OPTMASK ) {
   }  // end BINARYFLAG_KCORFILENAME
 
   // ------------
-  // read entire flux table
-  printf("\t Read entire flux table ... "); fflush(stdout);
-  fread(PTR_SEDMODEL_FLUXTABLE, ISIZE_SEDMODEL_FLUXTABLE, 1, fp);
-  printf("Done reading. \n"); fflush(stdout);
+  if ( MMAP_SEDMODEL_FLUXTABLE ) {
+    mmap_SIMSED_TABBINARY(fp, binFile);
+  }
+  else {
+    // read entire flux table
+    printf("\t Read entire flux table ... "); fflush(stdout);
+    fread(PTR_SEDMODEL_FLUXTABLE, ISIZE_SEDMODEL_FLUXTABLE, 1, fp);
+    printf("Done reading. \n"); fflush(stdout);
+  }
 
   return ;
 
@@ -726,6 +742,61 @@ void read_SIMSED_TABBINARY(FILE *fp, char *binFile, int OPTMASK ) {
 } // end of read_SIMSED_TABBINARY
 
 
+// ****************************************************************
+void mmap_SIMSED_TABBINARY(FILE *fp, char *binFile) {
+
+  // Created Oct 2026
+  // Map flux table from binary file (current position of fp) into
+  // memory instead of reading the entire table. Pages are loaded on
+  // demand by interp_flux_SIMSED, so init is fast and resident memory
+  // is proportional to the SEDs/redshifts actually sampled. Mapping is
+  // read-only and shared so that jobs on the same node share one copy
+  // in the page cache. The mapping remains valid after fclose(fp).
+  //
+  // Beware that binary file must not be re-written while in use.
+
+  int    fd          = fileno(fp);
+  long   OFFSET      = ftell(fp);
+  long   PAGESIZE    = sysconf(_SC_PAGESIZE);
+  long   OFFSET_PAGE = (OFFSET/PAGESIZE) * PAGESIZE ;
+  long   OFFSET_DIF  = OFFSET - OFFSET_PAGE;
+  size_t LEN         = (size_t)ISIZE_SEDMODEL_FLUXTABLE + OFFSET_DIF ;
+  struct stat statbuf ;
+  void   *ptr ;
+  char fnam[] = "mmap_SIMSED_TABBINARY" ;
+
+  // ------------ BEGIN ------------
+
+  fstat(fd, &statbuf);
+  if ( OFFSET + ISIZE_SEDMODEL_FLUXTABLE > (long)statbuf.st_size ) {
+    sprintf(c1err,"Binary size=%ld bytes, but expected >= %ld",
+	    (long)statbuf.st_size, OFFSET + ISIZE_SEDMODEL_FLUXTABLE );
+    sprintf(c2err,"Try deleting %s", binFile );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  ptr = mmap(NULL, LEN, PROT_READ, MAP_SHARED, fd, (off_t)OFFSET_PAGE);
+  if ( ptr == MAP_FAILED ) {
+    sprintf(c1err,"Unable to mmap %.2f Mb flux table from", 
+	    1.0E-6*(double)LEN );
+    sprintf(c2err,"%s", binFile );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  // table access is random in SED index -> disable read-ahead
+  madvise(ptr, LEN, MADV_RANDOM);
+
+  PTR_SEDMODEL_FLUXTABLE = (float*)((char*)ptr + OFFSET_DIF) ;
+
+  printf("\t mmap %.2f Mb flux table (loaded on demand). \n",
+	 1.0E-6*(double)ISIZE_SEDMODEL_FLUXTABLE ); 
+  fflush(stdout);
+
+  return ;
+
+} // end mmap_SIMSED_TABBINARY
+
+
 
 // ****************************************************************
 int read_SIMSED_INFO(char *PATHMODEL) {
@@ -15,6 +15,7 @@
 #define OPTMASK_INIT_SIMSED_TESTMODE  64 // used by SIMSED_check program
 #define OPTMASK_INIT_SIMSED_BATCH    128 // batch mode -> abort on stale binary
 #define OPTMASK_INIT_SIMSED_SKIP_KCOR_MATCH  256  // allow different KCOR_FILE
+#define OPTMASK_INIT_SIMSED_MMAP     512  // mmap flux-table binary (Oct 2026)
 
 
 #define SIMSED_INFO_FILENAME    "SED.INFO" 
@@ -97,6 +98,7 @@ void open_TABBINARY(char *fileName, bool force_create,
 		    FILE **fpbin, bool *RDFLAG, bool *WRFLAG);
 
 void read_SIMSED_TABBINARY(FILE *fp, char *binFile, int OPTMASK);
+void mmap_SIMSED_TABBINARY(FILE *fp, char *binFile);
 
 void genmag_SIMSED(int OPTMASK, int ifilt, double x0, 
 		   int NLUMIPAR, int *iflagpar, int *iparmap, double *lumipar,
@@ -13,6 +13,10 @@
   Translated from fortran -> C code as part of K-cor refactor to
   translate all fortran utilities into C.
 
+  Oct 15 2026: cache XTMAG(AV=1) vs. {band,Trest} for the current RV
+     (see set_RVcache_XTMAG), so that each epoch needs only a linear
+     interpolation in Trest instead of a 3D GRIDMAP lookup.
+
  ********************************************************/
 
 #include "fitsio.h"
@@ -131,6 +135,13 @@ void fill_GRIDMAP3D_XTMAG(void) {
   int NDIM_INP = 3;
   int NDIM_FUN = 1;
   temp_mem = malloc_double2D(+1,NDIM_INP+NDIM_FUN,NBIN_TOT,&TEMP_XTMAG_ARRAY);
+
+  // Oct 2026: keep copy of grid values for per-event RV cache
+  XTMAG_INFO.TABLE_AV1 = (double*)malloc(NBIN_TOT*sizeof(double));
+  XTMAG_INFO.CACHE_AV1 = 
+    (double*)malloc(NFILTDEF_REST*NBIN_Trest*sizeof(double));
+  XTMAG_INFO.RV_CACHE  = -999.0 ;
+  XTMAG_INFO.NCALL_CACHE_UPDATE = 0 ;
   J1D = 0 ;
   // start the 3D loop
   
@@ -147,6 +158,7 @@ void fill_GRIDMAP3D_XTMAG(void) {
 	TEMP_XTMAG_ARRAY[1][J1D]  = Trest;
 	TEMP_XTMAG_ARRAY[2][J1D]  = (double)ifilt;
 	TEMP_XTMAG_ARRAY[3][J1D]  = XTMAG;
+	XTMAG_INFO.TABLE_AV1[J1D] = XTMAG;
 
 	J1D++ ;
 
@@ -293,9 +305,92 @@ void dump_XTMAG(double Trest) {
 } // end dump_XTMAG
 
 
+// ==================================
+void set_RVcache_XTMAG(double RV) {
+
+  // Created Oct 2026
+  // Interpolate XTMAG(AV=1) table in 1/RV for each {band,Trest} 
+  // grid point and store in XTMAG_INFO.CACHE_AV1. RV is drawn
+  // once per event, so this is done once per event; each epoch
+  // then needs only a 1D interpolation in Trest.
+  // The 1/RV grid is uniform, so the bin index is computed directly.
+  // Since the GRIDMAP interpolation is multi-linear, interpolating
+  // first in 1/RV and then in Trest gives the same result.
+
+  int NFILTDEF_REST = CALIB_INFO.FILTERCAL_REST.NFILTDEF ;
+  int NBIN_Trest    = XTMAG_INFO.BININFO_Trest.NBIN;
+  int NBIN_RVinv    = XTMAG_INFO.BININFO_RVinv.NBIN;
+  int ifilt, iT, iRv, J0, JC ;
+  double RVinv, f, *TABLE = XTMAG_INFO.TABLE_AV1 ;
+
+  // ------------ BEGIN ------------
+
+  if ( RV == XTMAG_INFO.RV_CACHE ) { return; }
+
+  RVinv = 1.0/RV ;
+  iRv   = (int)((RVinv - RVinv_MIN_XTMAG)/RVinv_BIN_XTMAG);
+  if ( iRv > NBIN_RVinv-2 ) { iRv = NBIN_RVinv-2; }
+  f     = (RVinv - XTMAG_INFO.BININFO_RVinv.GRIDVAL[iRv])/RVinv_BIN_XTMAG;
+
+  for(ifilt=0; ifilt < NFILTDEF_REST; ifilt++ ) {
+    for(iT=0; iT < NBIN_Trest; iT++ ) {
+      JC = ifilt*NBIN_Trest + iT ;
+      J0 = JC*NBIN_RVinv + iRv ;
+      XTMAG_INFO.CACHE_AV1[JC] = TABLE[J0] + f*(TABLE[J0+1] - TABLE[J0]);
+    }
+  }
+
+  XTMAG_INFO.RV_CACHE = RV ;
+  XTMAG_INFO.NCALL_CACHE_UPDATE++ ;
+
+  return ;
+
+} // end set_RVcache_XTMAG
+
+
+// ==================================
+int eval_RVcache_XTMAG(int ifilt, double Trest, double RV, 
+		       double *XTMAG_AV1) {
+
+  // Created Oct 2026
+  // If RV and Trest are inside the grid, load *XTMAG_AV1 from
+  // per-event RV cache and return 1; else return 0 so that
+  // caller falls back to 3D GRIDMAP (which handles extrapolation).
+
+  int    NBIN_Trest = XTMAG_INFO.BININFO_Trest.NBIN;
+  double Trest_MIN  = XTMAG_INFO.BININFO_Trest.GRIDVAL[0];
+  double Trest_MAX  = XTMAG_INFO.BININFO_Trest.GRIDVAL[NBIN_Trest-1];
+  double Trest_BIN  = CALIB_INFO.BININFO_T.BINSIZE ;
+  double RVinv, f, *CACHE ;
+  int    iT ;
+
+  // ------------ BEGIN ------------
+
+  if ( XTMAG_INFO.TABLE_AV1 == NULL ) { return 0; }
+  if ( NBIN_Trest < 2 || Trest_BIN <= 0.0 ) { return 0; }
+  if ( Trest < Trest_MIN || Trest > Trest_MAX ) { return 0; }
+
+  RVinv = 1.0/RV ;
+  if ( RVinv < RVinv_MIN_XTMAG || RVinv > RVinv_MAX_XTMAG ) { return 0; }
+
+  set_RVcache_XTMAG(RV);
+
+  iT = (int)((Trest - Trest_MIN)/Trest_BIN);
+  if ( iT > NBIN_Trest-2 ) { iT = NBIN_Trest-2; }
+  f  = (Trest - XTMAG_INFO.BININFO_Trest.GRIDVAL[iT])/Trest_BIN ;
+
+  CACHE = &XTMAG_INFO.CACHE_AV1[ifilt*NBIN_Trest] ;
+  *XTMAG_AV1 = CACHE[iT] + f*(CACHE[iT+1] - CACHE[iT]) ;
+
+  return 1;
+
+} // end eval_RVcache_XTMAG
+
+
 double genmag_extinction(int ifiltdef, double Trest, double RV, double AV ) {
 
   // Return XTMAG for inputs Trest, AV, RV.
+  // Oct 15 2026: check eval_RVcache_XTMAG before 3D GRIDMAP.
 
   int    ifilt = CALIB_INFO.FILTERCAL_REST.IFILTDEF_INV[ifiltdef];
   double XTMAG=0.0, XTMAG_AV1, GRIDVAL_LIST[3];
@@ -308,6 +403,10 @@ double genmag_extinction(int ifiltdef, double Trest, double RV, double AV ) {
   if ( fabs(AV) > 100.0 ) { return 10.0; }
   if ( RV      < -10.0  ) { return XTMAG; }
 
+  // Oct 2026: use per-event RV cache when RV and Trest are inside grid
+  if ( eval_RVcache_XTMAG(ifilt, Trest, RV, &XTMAG_AV1) ) 
+    { return AV * XTMAG_AV1 ; }
+
   GRIDVAL_LIST[0] = 1.0/RV ;
   GRIDVAL_LIST[1] = Trest ;
   GRIDVAL_LIST[2] = (double)ifilt;
@@ -22,6 +22,13 @@ struct {
 
   GRIDMAP_DEF  GRIDMAP3D ;
 
+  // Oct 2026: copy of grid values, TABLE_AV1[(ifilt*NT + iT)*NRVinv + iRv],
+  // and per-event cache vs. [ifilt*NT + iT] interpolated to RV_CACHE.
+  double *TABLE_AV1 ;
+  double *CACHE_AV1 ;
+  double  RV_CACHE ;
+  int     NCALL_CACHE_UPDATE ;
+
 } XTMAG_INFO ;
 
 void init_genmag_extinction(int OPT_SNXT);
@@ -31,6 +38,8 @@ void fill_binInfo_XTMAG(void);
 void fill_GRIDMAP3D_XTMAG(void);
 double eval_XTMAG_AV1(int ifilt, double Trest, double RVinv) ;
 void dump_XTMAG(double Trest) ;
+void set_RVcache_XTMAG(double RV);
+int  eval_RVcache_XTMAG(int ifilt, double Trest, double RV, double *XTMAG_AV1);
 
 double genmag_extinction(int ifiltdef, double Trest, double RV, double AV );
 double genmag_extinction__(int *ifiltdef, double *Trest, 
@@ -53,6 +53,12 @@
               include arbitrary path.
 
  Dec 29 2017: use open_TEXTgz() to allow reading gzipped text files.
+
+ Oct 15 2026: 
+   + JDATES uses O(1) index lookup when template days are uniform
+     (see set_DAYSTEP_mlcs2k2) instead of linear search.
+   + gencovar_mlcs2k2 computes epoch brackets once per epoch
+     instead of once per matrix element.
       
 *******************************************************************/
 /*
@@ -256,6 +262,9 @@ int init_genmag_mlcs2k2(
   printf("\t TREST-range: %5.1f  to  %5.1f  days (NDAY=%d) \n", 
 	 TMINDAY_MLCS2k2, TMAXDAY_MLCS2k2, NDAY_MLCS2k2 );
 
+  // check for uniform day-grid to enable fast JDATES lookup
+  set_DAYSTEP_mlcs2k2();
+
   // Mar 2010: special flag to fix buggy vectors for SNchallenge
   if ( strcmp(version,"mlcs2k2.SNchallenge") == 0 ) {
     QWGT_FLAG = 1;
@@ -403,26 +412,73 @@ void JDATES ( double Trest, int *j1, int *j2 ) {
 
   // return integer indices j1 and j2 such that
   // TEMPLATE_DAYS_MLCS2k2[j1,j2] bracket Trest
+  //
+  // Oct 2026: if DAYSTEP_MLCS2k2 > 0, get first-guess index 
+  //   from uniform day-grid and then refine against 
+  //   TEMPLATE_DAYS_MLCS2k2 so that result is identical to
+  //   the linear search.
 
-  int j;
+  int j, jfound = -9 ;
 
   // ------------- BEGIN -----------
 
   *j1 = 0 ;  // init
   *j2 = 1 ;
 
-  for(j=0; j < NDAY_MLCS2k2; j++ ) {
-    if ( TEMPLATE_DAYS_MLCS2k2[j] > Trest ){
-      *j1 = j-1 ;
-      *j2 = j ;
-      break ;
+  if ( DAYSTEP_MLCS2k2 > 0.0 ) {
+    // find first j with TEMPLATE_DAYS > Trest
+    j = (int)floor((Trest - TMINDAY_MLCS2k2)/DAYSTEP_MLCS2k2) + 1 ;
+    if ( j < 0            ) { j = 0 ; }
+    if ( j > NDAY_MLCS2k2 ) { j = NDAY_MLCS2k2 ; }
+    while ( j < NDAY_MLCS2k2 && TEMPLATE_DAYS_MLCS2k2[j] <= Trest ) { j++ ; }
+    while ( j > 0 && TEMPLATE_DAYS_MLCS2k2[j-1] > Trest ) { j-- ; }
+    if ( j < NDAY_MLCS2k2 ) { jfound = j; }
+  }
+  else {
+    for(j=0; j < NDAY_MLCS2k2; j++ ) {
+      if ( TEMPLATE_DAYS_MLCS2k2[j] > Trest ){ jfound = j ; break ; }
     }
   }
 
+  if ( jfound >= 0 ) {
+    *j1 = jfound-1 ;
+    *j2 = jfound ;
+  }
+
   if ( *j1 < 0 ) { *j1=0; *j1=1 ; }
 
 }  // end of JDATES
 
+// ************************************************
+void set_DAYSTEP_mlcs2k2(void) {
+
+  // Created Oct 2026
+  // If TEMPLATE_DAYS_MLCS2k2 is a uniform grid, set DAYSTEP_MLCS2k2
+  // so that JDATES can use index lookup; else DAYSTEP_MLCS2k2=0
+  // and JDATES uses the original linear search.
+
+  int    j ;
+  double step, dif ;
+
+  // ------------- BEGIN -----------
+
+  DAYSTEP_MLCS2k2 = 0.0 ;
+  if ( NDAY_MLCS2k2 < 2 ) { return ; }
+
+  step = TEMPLATE_DAYS_MLCS2k2[1] - TEMPLATE_DAYS_MLCS2k2[0] ;
+  if ( step <= 0.0 ) { return ; }
+
+  for(j=1; j < NDAY_MLCS2k2; j++ ) {
+    dif = TEMPLATE_DAYS_MLCS2k2[j] - TEMPLATE_DAYS_MLCS2k2[j-1] ;
+    if ( fabs(dif-step) > 1.0E-6 ) { return ; }
+  }
+
+  DAYSTEP_MLCS2k2 = step ;
+  printf("\t Uniform TREST grid (step=%.2f days) -> fast JDATES lookup\n",
+	 step );
+
+}  // end of set_DAYSTEP_mlcs2k2
+
 // ***************************************
 void mag_extrap_mlcs2k2(int ifilt, double delta, double Trest,
 		     double *mag, double *magerr ) {
@@ -840,38 +896,52 @@ int gencovar_mlcs2k2 (
     ,wsum
     ;
 
+  int    *IEP1, *IEP2, MEMI, MEMD ;
+  double *EPLIST, *DIF1, *DIF2, ep ;
+
   // --------------- BEGIN -------------
 
+  // Oct 2026: compute epoch brackets once per epoch rather
+  //           than once per matrix element.
+  MEMI   = MATSIZE * sizeof(int);
+  MEMD   = MATSIZE * sizeof(double);
+  IEP1   = (int*)   malloc(MEMI);
+  IEP2   = (int*)   malloc(MEMI);
+  EPLIST = (double*)malloc(MEMD);
+  DIF1   = (double*)malloc(MEMD);
+  DIF2   = (double*)malloc(MEMD);
+
+  for ( irow=0; irow < MATSIZE; irow++ ) {
+    ep = rest_epoch[irow];  // epoch,  days
+    if ( ep < TMINDAY_MLCS2k2 )  ep = TMINDAY_MLCS2k2;
+    if ( ep > TMAXDAY_MLCS2k2 )  ep = TMAXDAY_MLCS2k2 - 0.01 ;
+
+    // get epoch indices that bracket ep
+    JDATES ( ep, &IEP1[irow], &IEP2[irow] ) ; 
+    EPLIST[irow] = ep ;
+    DIF1[irow]   = fabs ( TEMPLATE_DAYS_MLCS2k2[IEP1[irow]] - ep ) ;
+    DIF2[irow]   = fabs ( TEMPLATE_DAYS_MLCS2k2[IEP2[irow]] - ep ) ;
+  }
 
   icovar = 0;
 
   for ( irow=0; irow < MATSIZE; irow++ ) {
     
-    ep_row    = *(rest_epoch + irow);  // epoch,  days
-    if ( ep_row < TMINDAY_MLCS2k2 )  ep_row = TMINDAY_MLCS2k2;
-    if ( ep_row > TMAXDAY_MLCS2k2 )  ep_row = TMAXDAY_MLCS2k2 - 0.01 ;
-
-    ifilt_row = *(ifilt + irow) ;     // filter index
-
-    // get epoch indices that bracket ep_row
-    JDATES ( ep_row, &iep1_row, &iep2_row ) ; 
-
-    dif1_row = fabs ( TEMPLATE_DAYS_MLCS2k2[iep1_row] - ep_row ) ;
-    dif2_row = fabs ( TEMPLATE_DAYS_MLCS2k2[iep2_row] - ep_row ) ;
+    ep_row    = EPLIST[irow] ;
+    ifilt_row = ifilt[irow] ;     // filter index
+    iep1_row  = IEP1[irow] ;
+    iep2_row  = IEP2[irow] ;
+    dif1_row  = DIF1[irow] ;
+    dif2_row  = DIF2[irow] ;
 
     for ( icol=0; icol < MATSIZE; icol++ ) {
 
-      ep_col    = *(rest_epoch + icol);  // epoch,  days
-      if ( ep_col < TMINDAY_MLCS2k2 )  ep_col = TMINDAY_MLCS2k2;
-      if ( ep_col > TMAXDAY_MLCS2k2 )  ep_col = TMAXDAY_MLCS2k2 - 0.01;
-
-      ifilt_col = *(ifilt + icol);     // filter index
-
-      // get epoch indices that bracket ep_col
-      JDATES ( ep_col, &iep1_col, &iep2_col ) ; 
-
-      dif1_col = fabs ( TEMPLATE_DAYS_MLCS2k2[iep1_col] - ep_col ) ;
-      dif2_col = fabs ( TEMPLATE_DAYS_MLCS2k2[iep2_col] - ep_col ) ;
+      ep_col    = EPLIST[icol] ;
+      ifilt_col = ifilt[icol];     // filter index
+      iep1_col  = IEP1[icol] ;
+      iep2_col  = IEP2[icol] ;
+      dif1_col  = DIF1[icol] ;
+      dif2_col  = DIF2[icol] ;
 
       // now we have ep_row,ep_col in the middle of the square grid
       // containing this point. Take average of 4 corners wgted
@@ -927,6 +997,7 @@ int gencovar_mlcs2k2 (
     }  // end of icol
   }  // end of irow
 
+  free(IEP1); free(IEP2); free(EPLIST); free(DIF1); free(DIF2);
 
   return 1;
 
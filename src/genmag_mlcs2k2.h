@@ -28,6 +28,7 @@ double TEMPLATE_DAYS_MLCS2k2[MAXDAYS_MLCS2k2];
 int    NDAY_MLCS2k2;
 int    NFILT_MLCS2k2; // either 5 or 6-9
 double TMINDAY_MLCS2k2, TMAXDAY_MLCS2k2 ;
+double DAYSTEP_MLCS2k2 ;   // >0 for uniform day-grid (Oct 2026)
 char   FILTSTRING_MLCS2k2[20]  ;
 char   PATHMODEL_MLCS2k2[200] ;
 int    IDAYPEAK_MLCS2k2 ;  // day-index for peakmag
@@ -70,6 +71,7 @@ void mag_extrap_mlcs2k2(int ifilt, double delta, double Trest,
 		     double *mag, double *magerr );
 
 void JDATES ( double Trest, int *j1, int *j2 );
+void set_DAYSTEP_mlcs2k2(void);
 int  mlcs2k2_Tmin(void);
 int  mlcs2k2_Tmax(void);
 
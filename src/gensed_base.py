@@ -72,6 +72,33 @@ class gensed_base(ABC):
         """Wrapper of fetchSED to call from C"""
         return np.asarray(self.fetchSED(*args, **kwargs), dtype=np.float64)
 
+    def fetchSED_batch(self, trest: np.ndarray, maxlam: int, external_id: int, new_event: int, hostpars: Tuple[float]) -> npt.ArrayLike:
+        """
+        Returns the flux at every wavelength for each phase in trest.
+
+        Default implementation calls fetchSED for each phase; new_event
+        is passed only for the first phase. Models can override this method
+        to evaluate all phases at once.
+
+        Parameters
+        ----------
+        trest : ndarray[float64]
+             The rest frame phases at which to calculate the flux
+        maxlam, external_id, new_event, hostpars :
+             Same as for fetchSED
+
+        Returns
+        -------
+        An array of shape (len(trest), len(fetchSED_LAM)) with the flux
+        observed from 10 pc in erg / s / cm^2 / Angstrom
+        """
+        return [self.fetchSED(t, maxlam, external_id, new_event if i == 0 else 0, hostpars)
+                for i, t in enumerate(trest)]
+
+    def _fetchSED_batch(self, *args, **kwargs) -> np.ndarray:
+        """Wrapper of fetchSED_batch to call from C; C reads the returned buffer in place"""
+        return np.ascontiguousarray(self.fetchSED_batch(*args, **kwargs), dtype=np.float64)
+
     @abstractmethod
     def fetchParNames(self) -> Sequence[str]:
         """
@@ -91,3 +118,14 @@ class gensed_base(ABC):
         """
         raise NotImplementedError
 
+    def fetchParVals_all(self, varnames: Sequence[str]) -> npt.ArrayLike:
+        """
+        Returns the values of all parameters in varnames
+
+        Default implementation calls fetchParVals for each name.
+        """
+        return [self.fetchParVals(varname) for varname in varnames]
+
+    def _fetchParVals_all(self, varnames: Sequence[str]) -> np.ndarray:
+        """Wrapper of fetchParVals_all to call from C"""
+        return np.ascontiguousarray(self.fetchParVals_all(varnames), dtype=np.float64)
@@ -5,6 +5,10 @@
 http://adsabs.harvard.edu/abs/2014arXiv1402.0677I
 http://www.las.osaka-sandai.ac.jp/~inoue/ANAIGM/ANAIGM.tar.gz
 
+Oct 15 2026: add init_IGM_TABLE_Inoue to tabulate tau on a 
+  (z, lambda_rest) grid at init, and get_IGM_trans_Inoue to return
+  the transmission vector for all SED wavelengths at one redshift.
+
 */
 
 void read_Inoue_coeffs() {
@@ -154,6 +158,102 @@ double tLCLAF(double zS, double lobs) {
     
 }
 
+double tau_Inoue(double zS, double lobs) {
+    /* Total optical depth: Lyman series + continuum, LAF + DLA */
+    return tLSLAF(zS, lobs) + tLCLAF(zS, lobs) + tLSDLA(zS, lobs) + tLCDLA(zS, lobs);
+}
+
+void init_IGM_TABLE_Inoue(double zmin, double zmax, double zbin,
+                          double lammin, double lambin) {
+    /* Created Oct 2026
+       Tabulate tau vs. (z, lambda_rest) for lambda_rest in 
+       [lammin, LAMREST_MAX_IGM]. Rest-frame grid is used because 
+       tau=0 for lambda_rest > Ly-a at any z, so the table stays 
+       compact for high-z sims. Must call read_Inoue_coeffs first. 
+       tau has steps at each Lyman line (lam1) and at the Lyman limit,
+       which are at fixed lambda_rest; cells containing a step are 
+       flagged EXACT so that they are evaluated without interpolation. */
+
+    int iz, ilam, NZ, NLAM, j;
+    double z, lrest, lamL = 911.8;
+
+    NZ   = (int)((zmax - zmin)/zbin + 0.5) + 1;
+    NLAM = (int)((LAMREST_MAX_IGM - lammin)/lambin + 0.5) + 1;
+
+    IGM_TABLE.NZ     = NZ;
+    IGM_TABLE.NLAM   = NLAM;
+    IGM_TABLE.ZMIN   = zmin;
+    IGM_TABLE.ZBIN   = zbin;
+    IGM_TABLE.LAMMIN = lammin;
+    IGM_TABLE.LAMBIN = lambin;
+    IGM_TABLE.TAU    = malloc(sizeof(double)*NZ*NLAM);
+    IGM_TABLE.EXACT  = calloc(NLAM, sizeof(char));
+
+    for (j=0; j<=NA; ++j) {
+        lrest = (j < NA) ? lam1[j] : lamL;
+        ilam  = (int)((lrest - lammin)/lambin);
+        if (ilam >= 0 && ilam < NLAM) { IGM_TABLE.EXACT[ilam] = 1; }
+    }
+
+    for (iz=0; iz<NZ; ++iz) {
+        z = zmin + zbin*(double)iz;
+        for (ilam=0; ilam<NLAM; ++ilam) {
+            lrest = lammin + lambin*(double)ilam;
+            IGM_TABLE.TAU[iz*NLAM + ilam] = tau_Inoue(z, lrest*(1.0+z));
+        }
+    }
+
+    printf("\t Store IGM tau table: %d z-bins x %d lambda-bins\n", NZ, NLAM);
+    fflush(stdout);
+}
+
+void get_IGM_trans_Inoue(double zS, int NLAM, double *lobs_list, 
+                         double *trans_list) {
+    /* Created Oct 2026
+       Return trans_list[i] = exp(-tau) for each lobs_list[i] at 
+       redshift zS. If IGM_TABLE is initialized and zS is inside the 
+       table, use bilinear interpolation in (z, lambda_rest); else 
+       evaluate the Inoue functions directly. */
+
+    int i, iz, ilam, NL = IGM_TABLE.NLAM;
+    double z1 = 1.0 + zS, lrest, fz, fl, t0, t1, tau, *T0, *T1;
+    int use_table = (IGM_TABLE.TAU != NULL);
+
+    if (use_table) {
+        fz = (zS - IGM_TABLE.ZMIN)/IGM_TABLE.ZBIN;
+        iz = (int)fz;
+        if (fz < 0.0 || iz > IGM_TABLE.NZ-1) { use_table = 0; }
+        if (iz == IGM_TABLE.NZ-1) { iz--; }
+        fz -= (double)iz;
+    }
+
+    for (i=0; i<NLAM; ++i) {
+        lrest = lobs_list[i]/z1;
+        if (lrest > LAMREST_MAX_IGM) { trans_list[i] = 1.0; continue; }
+
+        if (!use_table || lrest < IGM_TABLE.LAMMIN) {
+            trans_list[i] = exp(-tau_Inoue(zS, lobs_list[i]));
+            continue;
+        }
+
+        fl   = (lrest - IGM_TABLE.LAMMIN)/IGM_TABLE.LAMBIN;
+        ilam = (int)fl;
+        if (ilam > NL-2) { ilam = NL-2; }
+        if (IGM_TABLE.EXACT[ilam]) {
+            trans_list[i] = exp(-tau_Inoue(zS, lobs_list[i]));
+            continue;
+        }
+        fl  -= (double)ilam;
+
+        T0  = &IGM_TABLE.TAU[iz*NL];
+        T1  = &IGM_TABLE.TAU[(iz+1)*NL];
+        t0  = T0[ilam] + fl*(T0[ilam+1] - T0[ilam]);
+        t1  = T1[ilam] + fl*(T1[ilam+1] - T1[ilam]);
+        tau = t0 + fz*(t1 - t0);
+        trans_list[i] = exp(-tau);
+    }
+}
+
 // int main() {
 //     double zS = 5.;
 //     double lrest, lobs, tau;
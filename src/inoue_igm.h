@@ -22,3 +22,18 @@ double tLCLAF(double zS, double lobs);
 double tLSDLA(double zS, double lobs);
 double tLCDLA(double zS, double lobs);
 
+//// Oct 2026: optional tau table on (z, lambda_rest) grid, and vector API
+#define LAMREST_MAX_IGM 1216.0  // tau=0 above Ly-a
+struct {
+    int     NZ, NLAM;
+    double  ZMIN, ZBIN, LAMMIN, LAMBIN;
+    double *TAU;    // TAU[iz*NLAM + ilam]
+    char   *EXACT;  // 1 => lambda cell straddles Lyman line/limit step
+} IGM_TABLE;
+
+double tau_Inoue(double zS, double lobs);
+void   init_IGM_TABLE_Inoue(double zmin, double zmax, double zbin,
+                            double lammin, double lambin);
+void   get_IGM_trans_Inoue(double zS, int NLAM, double *lobs_list, 
+                           double *trans_list);
+
@@ -109,8 +109,28 @@
 
  Mar 28 2025; allow command-line override for SPECTROGRAPH
 
+ Oct 15 2026: MW extinction for observer mags is computed once per
+              (MWEBV, SN lambda bin) with GALextinct_array;
+              see fill_MWXT_KCOR().
+
+ Oct 15 2026: kcor_grid computes SN flux once per (AV,z,epoch) and
+              filter trans once per filter, and distributes (AV,z)
+              bins among NTHREAD pthreads (kcor-input key NTHREAD:
+              or command-line arg NTHREAD <n>).
+
+ Oct 15 2026: new command-line arg CALIB_FILE_REF <file> re-uses
+              K-cor and mag tables from a previous calib file for
+              filters whose trans and zero point are unchanged;
+              see read_calib_ref_KCOR().
+
+ Oct 15 2026: ZPoff table has new column ZP(SEDMODEL) = zeropoint in
+              the convention of genmag_SEDtools (init_filter_SEDMODEL);
+              SED-model consumers (sim & fit) use this stored value
+              so that all programs share identical zeropoints.
+
 ****************************************************/
 
+#include <pthread.h>
 #include "fitsio.h"
 #include "sntools.h"    // defines some general tools
 #include "sntools_calib.h"
@@ -261,6 +281,12 @@ void  print_kcor_help(void) {
     "AV_RANGE:   -6.0  6.0 " , 
     "AV_BINSIZE:  0.5    # increase for faster kcor generation ",
     "AV_OPTION:   2      # 2->proper integration over filter",
+    "",
+    "NTHREAD:     4      # number of threads for kcor table (default=1)",
+    "",
+    "# command-line only: re-use K-cor & mag tables from previous calib",
+    "# file for filters with identical trans and zero point: ",
+    "#    CALIB_FILE_REF <calibFile> ",
     0
   };
 
@@ -395,6 +421,8 @@ int rd_input(void) {
   for(i=0; i<10; i++ ) { INPUTS.PARLIST_MWCOLORLAW[i] = 0.0 ; }
   
   INPUTS.FASTDEBUG    = 0 ;
+  INPUTS.NTHREAD      = 1 ;
+  INPUTS.CALIB_FILE_REF[0] = 0 ;
   INPUTS.SKIPKCOR     = 0 ;
   INPUTS.FLUXERR_FLAG = 0 ;
 
@@ -714,6 +742,9 @@ int rd_input(void) {
     if ( strcmp(c_get,"AV_OPTION:")==0 )  
       { readint ( fp_input, 1, &INPUTS.AV_OPTION );  }  
 
+    if ( strcmp(c_get,"NTHREAD:")==0 )  
+      { readint ( fp_input, 1, &INPUTS.NTHREAD );  }  
+
 
     if ( strcmp(c_get,"LAMBDA_RANGE:")==0 )  {
       readfloat ( fp_input, 2, xlim4 );
@@ -1331,6 +1362,14 @@ void kcor_input_override(int OPT) {
     if ( strcmp( ARGV_LIST[i], "FASTDEBUG" ) == 0 ) 
       { INPUTS.FASTDEBUG = 1; USE_ARGV_LIST[i] = 1; }
 
+    if ( strcmp( ARGV_LIST[i], "NTHREAD" ) == 0 ) {
+      i++ ; sscanf(ARGV_LIST[i] , "%d", &INPUTS.NTHREAD ); 
+    }
+
+    if ( strcmp( ARGV_LIST[i], "CALIB_FILE_REF" ) == 0 ) {
+      i++ ; sscanf(ARGV_LIST[i] , "%s", INPUTS.CALIB_FILE_REF ); 
+    }
+
 
     if ( strcmp( ARGV_LIST[i], "FLUXERR" ) == 0 ) 
       { INPUTS.FLUXERR_FLAG = 1; USE_ARGV_LIST[i] = 1; }
@@ -3285,148 +3324,716 @@ int kcor_grid (void) {
   // Nov 12, 2010: loop over NKCOR+KCOR_EXTRA to get synthetic
   //               'magobs' for the rest-frame filters that are
   //               needed by snana.
+  //
+  // Oct 15 2026: 
+  //  * loop order is now (AV,z) -> epoch -> ikcor so that the SN flux
+  //    at each grid point is computed once and shared by all K-cors;
+  //    see kcor_grid_zav and SNFLUX_CACHE_DEF.
+  //  * filter trans on SN lambda grid is computed once per filter.
+  //  * (AV,z) bins are distributed among INPUTS.NTHREAD pthreads.
+  //  * K-cors and mags read from CALIB_FILE_REF are not recomputed.
+  //
   // -------------------------------------------------
 
    char ctmp[20]
      ,  fnam[] = "kcor_grid"
      ;
 
-   int  ikcor, OPT, ifilt_rest, ifilt_obs ;
-   int  i_epoch, i_z, i_av, i_ebv, FLAG_MAGOBS, NZBIN ;
+   int  nthread = INPUTS.NTHREAD ;
+   int  ikcor ;
    
-   double 
-     z, epoch, av, dum, kcor, kcormin, kcormax
-     ,err, ovp, magobs[MXMWEBV+2], magtmp, dxt, debv
-     ; 
-
    /* -------------------- BEGIN ------------------ */
 
-   OPT = 0;
-
    printf("\n  ***** START LOOPING for KCOR GRID ***** \n" );
 
+   // one-time inits that are shared by all threads
+   fill_TRANS_SNGRID_KCOR();
+   if ( MWXT_FRAC_KCOR[0] == NULL ) { fill_MWXT_KCOR(); }
 
+   KCOR_GRID_JOBS.NZBIN     = INPUTS.NBIN_REDSHIFT ;
+   KCOR_GRID_JOBS.NJOB      = INPUTS.NBIN_AV * INPUTS.NBIN_REDSHIFT ;
+   KCOR_GRID_JOBS.IJOB_NEXT = 0 ;
    for ( ikcor=1; ikcor <= NKCOR + NKCOR_EXTRA ; ikcor++ ) {
-       
-     // check which filter indices
+     KCOR_GRID_JOBS.KCORMIN[ikcor] =  999999. ;
+     KCOR_GRID_JOBS.KCORMAX[ikcor] = -99999. ;
+   }
+
+   CALIB_REF_KCOR.NFILT_REUSE = CALIB_REF_KCOR.NKCOR_REUSE = 0 ;
+   for ( ikcor=0; ikcor < MXKCOR; ikcor++ ) 
+     { CALIB_REF_KCOR.REUSE_KCOR[ikcor] = false; }
+   if ( strlen(INPUTS.CALIB_FILE_REF) > 0 ) { read_calib_ref_KCOR(); }
+
+   if ( nthread > KCOR_GRID_JOBS.NJOB ) { nthread = KCOR_GRID_JOBS.NJOB; }
+
+   if ( nthread <= 1 ) {
+     kcor_grid_thread(NULL);
+   }
+   else if ( nthread <= MXTHREAD_KCOR ) {
+     pthread_t thread[MXTHREAD_KCOR];
+     int t;
+     printf("\t Split %d (AV,z) bins into %d threads. \n", 
+	    KCOR_GRID_JOBS.NJOB, nthread);
+     fflush(stdout);
+     pthread_mutex_init(&KCOR_GRID_JOBS.MUTEX, NULL);
+     for ( t=0; t < nthread; t++ ) 
+       { pthread_create(&thread[t], NULL, kcor_grid_thread, &nthread); }
+     for ( t=0; t < nthread; t++ ) 
+       { pthread_join(thread[t], NULL); }
+     pthread_mutex_destroy(&KCOR_GRID_JOBS.MUTEX);
+   }
+   else {
+     sprintf(c1err,"NTHREAD=%d exceeds bound", nthread);
+     sprintf(c2err,"Check NTHREAD arg; MXTHREAD_KCOR = %d", MXTHREAD_KCOR);
+     errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+   }
+
+   // summary for each K-cor
+   for ( ikcor=1; ikcor <= NKCOR + NKCOR_EXTRA ; ikcor++ ) {
+     if ( ikcor <= NKCOR ) 
+       { ctmp[0]=0; }
+     else
+       { sprintf(ctmp, "%s", "EXTRA"); }
+
+     printf("  Computed %s %s for '%s' (rest) => '%s' (obs) \n",
+	    ctmp, KCORSYM[ikcor], KCORLIST[ikcor][0], KCORLIST[ikcor][1] );
+     printf("\t %s min/max = %6.3f/%6.3f \n", KCORSYM[ikcor], 
+	    KCOR_GRID_JOBS.KCORMIN[ikcor], KCOR_GRID_JOBS.KCORMAX[ikcor]);
+   }
+   fflush(stdout);
+
+   return SUCCESS;
+
+
+} // end of kcor_grid
+
+
+// ***************************************************
+void *kcor_grid_thread(void *arg) {
+
+  // Created Oct 2026
+  // Driver for kcor_grid: grab next (AV,z) job until all jobs are done.
+  // Called directly with arg=NULL for single thread, or as pthread 
+  // start routine with arg != NULL.
+  // Each caller has its own SN flux cache and K-cor min/max, and the
+  // min/max are merged into KCOR_GRID_JOBS at the end.
+
+  int NBIN  = SNSED.NBIN_LAMBDA ;
+  int NZBIN = KCOR_GRID_JOBS.NZBIN ;
+  int NJOB  = KCOR_GRID_JOBS.NJOB ;
+  int MEMD  = (NBIN+1) * sizeof(double) ;
+  int MEMB  = (NBIN+1) * sizeof(bool) ;
+  int ijob, i_av, i_z, ikcor ;
+  bool USE_MUTEX = ( arg != NULL ) ;
+  double KCORMIN[MXKCOR], KCORMAX[MXKCOR] ;
+  SNFLUX_CACHE_DEF CACHE ;
+
+  // ----------- BEGIN -----------
+
+  CACHE.FLUX_REST = (double*) malloc(MEMD);
+  CACHE.FLUX_OBS  = (double*) malloc(MEMD);
+  CACHE.DONE_REST = (bool  *) malloc(MEMB);
+  CACHE.DONE_OBS  = (bool  *) malloc(MEMB);
+
+  for ( ikcor=1; ikcor <= NKCOR + NKCOR_EXTRA ; ikcor++ ) {
+    KCORMIN[ikcor] = KCOR_GRID_JOBS.KCORMIN[ikcor] ;
+    KCORMAX[ikcor] = KCOR_GRID_JOBS.KCORMAX[ikcor] ;
+  }
+
+  while ( 1 ) {
+    ijob = __atomic_fetch_add(&KCOR_GRID_JOBS.IJOB_NEXT, 1, 
+			      __ATOMIC_RELAXED);
+    if ( ijob >= NJOB ) { break; }
+    i_av = ijob / NZBIN + 1 ;
+    i_z  = ijob % NZBIN + 1 ;
+    kcor_grid_zav(i_av, i_z, &CACHE, KCORMIN, KCORMAX);
+  }
+
+  if ( USE_MUTEX ) { pthread_mutex_lock(&KCOR_GRID_JOBS.MUTEX); }
+  for ( ikcor=1; ikcor <= NKCOR + NKCOR_EXTRA ; ikcor++ ) {
+    if ( KCORMIN[ikcor] < KCOR_GRID_JOBS.KCORMIN[ikcor] ) 
+      { KCOR_GRID_JOBS.KCORMIN[ikcor] = KCORMIN[ikcor]; }
+    if ( KCORMAX[ikcor] > KCOR_GRID_JOBS.KCORMAX[ikcor] ) 
+      { KCOR_GRID_JOBS.KCORMAX[ikcor] = KCORMAX[ikcor]; }
+  }
+  if ( USE_MUTEX ) { pthread_mutex_unlock(&KCOR_GRID_JOBS.MUTEX); }
+
+  free(CACHE.FLUX_REST);  free(CACHE.FLUX_OBS);
+  free(CACHE.DONE_REST);  free(CACHE.DONE_OBS);
+
+  return NULL;
+
+} // end kcor_grid_thread
+
+
+// ***************************************************
+void kcor_grid_zav(int i_av, int i_z, SNFLUX_CACHE_DEF *CACHE,
+		   double *KCORMIN, double *KCORMAX) {
+
+  // Created Oct 2026 [code moved from kcor_grid]
+  // Compute all K-cors and observer mags for AV bin i_av and
+  // redshift bin i_z. EXTRA K-cors are computed only for i_z=1.
+  // Observer mags for each obs-filter are computed with the first
+  // K-cor that uses this obs-filter (FLAG_MAGOBS=1).
+  // K-cors (and mags) read from CALIB_FILE_REF are skipped.
+
+  int  ikcor, OPT, ifilt_rest, ifilt_obs ;
+  int  i_epoch, i_ebv, FLAG_MAGOBS ;
+  double 
+    z, epoch, av, dum, kcor
+    ,err, ovp, magobs[MXMWEBV+2], magtmp, dxt, debv
+    ; 
+  char fnam[] = "kcor_grid_zav" ;
+
+  // ----------- BEGIN ------------
+
+  OPT = 0;
+
+  dum    = (double)(i_av-1) ;
+  av     = INPUTS.AV_MIN + dum * INPUTS.AV_BINSIZE;
+
+  dum    = (double)(i_z-1) ;
+  z      = INPUTS.REDSHIFT_MIN + dum * INPUTS.REDSHIFT_BINSIZE;
+
+  for ( i_epoch=1; i_epoch<= SNSED.NEPOCH; i_epoch++ ) {
+
+    epoch = SNSED.EPOCH[i_epoch];  
+    init_snflux_cache(CACHE, av, z, epoch);
+
+    for ( ikcor=1; ikcor <= NKCOR + NKCOR_EXTRA ; ikcor++ ) {
+
+      if ( ikcor > NKCOR && i_z > 1 ) { continue; } // EXTRA: 1 z-bin
 
       ifilt_rest  = -1;
       ifilt_obs   = -1;
-
       index_filter ( ikcor, &ifilt_rest, &ifilt_obs );
 
-      if ( ikcor <= NKCOR ) {
-	NZBIN  = INPUTS.NBIN_REDSHIFT;
-	ctmp[0]=0;
+      R4KCOR_GRID.REDSHIFT[ikcor][i_av][i_z][i_epoch]  = (float)z ;
+      R4KCOR_GRID.EPOCH[ikcor][i_av][i_z][i_epoch]     = (float)epoch ;
+
+      // check if these obs mags have already been computed
+      if ( SNSED.R4MAG_OBS[0][ifilt_obs][i_av][i_z][i_epoch] == NULLVAL )
+	{ FLAG_MAGOBS = 1 ; }
+      else
+	{ FLAG_MAGOBS = 0; }
+
+      // skip if K-cor and obs mags were read from CALIB_FILE_REF
+      if ( CALIB_REF_KCOR.REUSE_KCOR[ikcor] && FLAG_MAGOBS == 0 )
+	{ continue; }
+
+      kcor_eval( OPT
+		 ,av, z, epoch
+		 ,ifilt_rest, ifilt_obs 
+		 ,FLAG_MAGOBS
+		 ,&kcor, &err, &ovp, magobs        // return values
+		 ,CACHE
+		 );
+
+      if ( kcor > KCORMAX[ikcor] ) { KCORMAX[ikcor] = kcor ; }
+      if ( kcor < KCORMIN[ikcor] ) { KCORMIN[ikcor] = kcor ; }
+
+      // if kcor is outside valid range, then set it to really
+      // crazy NULLVAL so that sim & fitter know to ignore it
+      if ( kcor > KCORMAX_VALID ) { kcor = NULLVAL ; }
+      if ( kcor < KCORMIN_VALID ) { kcor = NULLVAL ; }
+
+      // 6/08/2009: check for nan 
+      if ( isnan(kcor) ) {
+	sprintf(c1err,"kcor=%f  for z=%6.3f T=%6.3f  av=%6.3f",
+		kcor, z, epoch, av);
+	sprintf(c2err,"ifilt_[rest,obs]=%d,%d (%s,%s) FLAG_MAGOBS=%d"
+		,ifilt_rest, ifilt_obs
+		,FILTER[ifilt_rest].name
+		,FILTER[ifilt_obs].name
+		,FLAG_MAGOBS);
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err);  
       }
-      else {
-	NZBIN = 1;
-	sprintf(ctmp, "%s", "EXTRA");
+
+      R4KCOR_GRID.VALUE[ikcor][i_av][i_z][i_epoch] = (float)kcor ;
+
+      // Feb 2007: store observer mags with array of MW E(B-V)
+      if ( FLAG_MAGOBS > 0 ) {
+	for ( i_ebv = 0; i_ebv <= MXMWEBV; i_ebv++ ) {
+	  magtmp = magobs[i_ebv];
+	  if ( isnan(magtmp) ) {
+	    sprintf(c1err,"magobs=%f for i_ebv=%d z=%6.3f T=%6.2f",
+		    magtmp, i_ebv, z, epoch );
+	    sprintf(c2err,"ifilt_[rest,obs]=%d,%d", 
+		    ifilt_rest, ifilt_obs);
+	    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);  
+	  }
+
+	  SNSED.R4MAG_OBS[i_ebv][ifilt_obs][i_av][i_z][i_epoch] = 
+	    (float)magtmp;
+	}
+	// store d(mag)/d(xtmw) based on first two bins
+	dxt   = *(magobs + 1) - *(magobs + 0) ;
+	debv = MWEBV_LIST[1] -  MWEBV_LIST[0]  ;
+	SNSED.MW_dXT_dEBV[ifilt_obs][i_av][i_z][i_epoch] = (dxt/debv);
       }
 
-      printf("  Compute %s %s for '%s' (rest) => '%s' (obs) \n",
-	     ctmp, KCORSYM[ikcor], KCORLIST[ikcor][0], KCORLIST[ikcor][1] );
-      kcormin = 999999. ;
-      kcormax = -99999. ;
+    } // end of ikcor loop 
+  } // end of i_epoch loop 
 
-      printf("\t AV = ");
+  return ;
 
+} // end kcor_grid_zav
 
-      // now loop over redshift and epoch 
 
-      for ( i_av=1;  i_av<=INPUTS.NBIN_AV;   i_av++ ) {
+// ***************************************************
+void fill_TRANS_SNGRID_KCOR(void) {
 
-	  dum    = (double)(i_av-1) ;
-	  av     = INPUTS.AV_MIN + dum * INPUTS.AV_BINSIZE;
+  // Created Oct 2026
+  // Store filter trans on SN lambda grid (epoch=1) for each filter
+  // so that kcor_eval does not interpolate filter trans for every
+  // (AV,z,epoch) grid point.
 
-          printf("%4.2f ", av);
-	  fflush(stdout);
+  int NBIN = SNSED.NBIN_LAMBDA ;
+  int MEMD = (NBIN+1) * sizeof(double) ;
+  int ifilt, ilam ;
 
-	for ( i_z=1;   i_z <= NZBIN ; i_z++ ) {
+  // ----------- BEGIN ------------
 
-	  dum   = (double)(i_z-1) ;
-	  z     = INPUTS.REDSHIFT_MIN + dum * INPUTS.REDSHIFT_BINSIZE;
+  for ( ifilt=1; ifilt <= NFILTDEF; ifilt++ ) {
+    if ( FILTER[ifilt].TRANS_SNGRID == NULL ) 
+      { FILTER[ifilt].TRANS_SNGRID = (double*) malloc(MEMD); }
+    FILTER[ifilt].TRANS_SNGRID[0] = 0.0 ;
+    for ( ilam=1; ilam <= NBIN; ilam++ ) {
+      FILTER[ifilt].TRANS_SNGRID[ilam] = 
+	filter_trans( SNSED.LAMBDA[1][ilam], ifilt, 0 );
+    }
+  }
 
-	  for ( i_epoch=1; i_epoch<= SNSED.NEPOCH; i_epoch++ ) {
+  return ;
 
-	    epoch = SNSED.EPOCH[i_epoch];  
+} // end fill_TRANS_SNGRID_KCOR
 
-	    R4KCOR_GRID.REDSHIFT[ikcor][i_av][i_z][i_epoch]  = (float)z ;
-	    R4KCOR_GRID.EPOCH[ikcor][i_av][i_z][i_epoch]     = (float)epoch ;
+// ***************************************************
+void read_calib_ref_KCOR(void) {
 
-	    // check if these obs mags have already been computed
-	    if ( SNSED.R4MAG_OBS[0][ifilt_obs][i_av][i_z][i_epoch] == NULLVAL )
-	      { FLAG_MAGOBS = 1 ; }
-	    else
-	      { FLAG_MAGOBS = 0; }
+  // Created Oct 2026
+  // Read reference calib file INPUTS.CALIB_FILE_REF (written by previous
+  // kcor job) and re-use its K-cor and mag tables for filters that are
+  // unchanged. Intended for calibration-systematic loops where only
+  // a few filters are shifted (FILTER_LAMSHIFT) or replaced.
+  //
+  // Reference must have identical header binning (lambda, Trest, z, AV),
+  // MW color law, filter & K-cor lists, and SN SED; otherwise nothing
+  // is re-used. A filter is re-used if its trans (on SN lambda grid)
+  // and zero point are identical to float precision in the reference.
+  // Note that AV_OPTION is not stored in the calib file, so reference
+  // must be created with the same AV_OPTION.
+
+  char *FILE = INPUTS.CALIB_FILE_REF ;
+  fitsfile *fp ;
+  int  istat = 0, ikcor, ifilt_rest, ifilt_obs ;
+  char fnam[] = "read_calib_ref_KCOR" ;
 
-            kcor_eval( OPT
-		       ,av, z, epoch
-		       ,ifilt_rest, ifilt_obs 
-		       ,FLAG_MAGOBS
-		       ,&kcor, &err, &ovp, magobs        // return values
-		       );
+  // ------------ BEGIN ------------
 
-	    if ( kcor > kcormax ) { kcormax = kcor ; }
-	    if ( kcor < kcormin ) { kcormin = kcor ; }
-
-	    // if kcor is outside valid range, then set it to really
-	    // crazy NULLVAL so that sim & fitter know to ignore it
-	    if ( kcor > KCORMAX_VALID ) { kcor = NULLVAL ; }
-	    if ( kcor < KCORMIN_VALID ) { kcor = NULLVAL ; }
-
-	    // 6/08/2009: check for nan 
-	    if ( isnan(kcor) ) {
-	      sprintf(c1err,"kcor=%f  for z=%6.3f T=%6.3f  av=%6.3f",
-		      kcor, z, epoch, av);
-	      sprintf(c2err,"ifilt_[rest,obs]=%d,%d (%s,%s) FLAG_MAGOBS=%d"
-		      ,ifilt_rest, ifilt_obs
-		      ,FILTER[ifilt_rest].name
-		      ,FILTER[ifilt_obs].name
-		      ,FLAG_MAGOBS);
-	      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);  
-	    }
-
-	    R4KCOR_GRID.VALUE[ikcor][i_av][i_z][i_epoch] = (float)kcor ;
-
-	    // Feb 2007: store observer mags with array of MW E(B-V)
-	    if ( FLAG_MAGOBS > 0 ) {
-	      for ( i_ebv = 0; i_ebv <= MXMWEBV; i_ebv++ ) {
-		magtmp = magobs[i_ebv];
-		if ( isnan(magtmp) ) {
-		  sprintf(c1err,"magobs=%f for i_ebv=%d z=%6.3f T=%6.2f",
-			  magtmp, i_ebv, z, epoch );
-		  sprintf(c2err,"ifilt_[rest,obs]=%d,%d", 
-			  ifilt_rest, ifilt_obs);
-		  errmsg(SEV_FATAL, 0, fnam, c1err, c2err);  
-
-		}
-
-		SNSED.R4MAG_OBS[i_ebv][ifilt_obs][i_av][i_z][i_epoch] = 
-		  (float)magtmp;
-	      }
-	      // store d(mag)/d(xtmw) based on first two bins
-	      dxt   = *(magobs + 1) - *(magobs + 0) ;
-	      debv = MWEBV_LIST[1] -  MWEBV_LIST[0]  ;
-	      SNSED.MW_dXT_dEBV[ifilt_obs][i_av][i_z][i_epoch] = 
-		(dxt/debv);
-	    }
-	    
-
-	  } // end of i_epoch loop 
-	}  // end of i_z loop 
-      }   // end if i_av loop
-
-      printf(" \n\t %s min/max = %6.3f/%6.3f \n", 
-	     KCORSYM[ikcor], kcormin, kcormax);
-
-   }     // end of ikcor loop 
-     
+  printf("\n %s: check re-use of tables from \n\t %s\n", fnam, FILE);
+  fflush(stdout);
 
-   return SUCCESS;
+  fits_open_file(&fp, FILE, READONLY, &istat);
+  if ( istat != 0 ) {
+    sprintf(c1err,"Cannot open CALIB_FILE_REF");
+    sprintf(c2err,"%s", FILE);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
 
+  if ( !match_calib_ref_header(fp) ) { goto DONE ; }
+  if ( !match_calib_ref_snsed(fp)  ) { goto DONE ; }
+
+  match_calib_ref_filters(fp);
+
+  for ( ikcor=1; ikcor <= NKCOR + NKCOR_EXTRA ; ikcor++ ) {
+    index_filter ( ikcor, &ifilt_rest, &ifilt_obs );
+    CALIB_REF_KCOR.REUSE_KCOR[ikcor] = 
+      CALIB_REF_KCOR.REUSE_FILT[ifilt_rest] && 
+      CALIB_REF_KCOR.REUSE_FILT[ifilt_obs] ;
+    if ( CALIB_REF_KCOR.REUSE_KCOR[ikcor] && ikcor <= NKCOR ) 
+      { CALIB_REF_KCOR.NKCOR_REUSE++ ; }
+  }
+
+  read_calib_ref_tables(fp);
+
+ DONE:
+  fits_close_file(fp, &istat);
+
+  printf("\t Re-use %d of %d filters and %d of %d K-cors. \n",
+	 CALIB_REF_KCOR.NFILT_REUSE, NFILTDEF, 
+	 CALIB_REF_KCOR.NKCOR_REUSE, NKCOR );
+  fflush(stdout);
+
+  return ;
+
+} // end read_calib_ref_KCOR
+
+
+// ***************************************************
+bool match_calib_ref_header(fitsfile *fp) {
+
+  // Created Oct 2026
+  // Return true if global header of reference calib file matches
+  // binning, MW color law, filter names and K-cor names of this job.
+  // Float keys are compared after casting local value to float
+  // as in wr_fits_HEAD.
+
+  char *KEY_INT[] = 
+    { "NBL", "NBT", "NBZ", "NBAV", "NFILTERS", "NKCOR" } ;
+  int   VAL_INT[] = 
+    { SNSED.NBIN_LAMBDA, SNSED.NEPOCH, INPUTS.NBIN_REDSHIFT,
+      INPUTS.NBIN_AV, NFILTDEF, NKCOR } ;
+  char *KEY_FLT[] = 
+    { "LBIN", "LMIN", "LMAX", "TMIN", "TMAX", "ZMIN", "ZMAX", 
+      "AVMIN", "AVBIN" } ;
+  float VAL_FLT[] = 
+    { SNSED.LAMBDA_BINSIZE, SNSED.LAMBDA_MIN, SNSED.LAMBDA_MAX,
+      SNSED.TREST_MIN, SNSED.TREST_MAX, 
+      INPUTS.REDSHIFT_MIN, INPUTS.REDSHIFT_MAX,
+      INPUTS.AV_MIN, INPUTS.AV_BINSIZE } ;
+
+  int   NKEY_INT = sizeof(VAL_INT)/sizeof(int);
+  int   NKEY_FLT = sizeof(VAL_FLT)/sizeof(float);
+  int   k, ival, istat, ifilt, ikcor ;
+  float fval ;
+  char  KEYNAME[40], KEYVAL[MXPATHLEN], comment[100] ;
+
+  // ------------ BEGIN ------------
+
+  for ( k=0; k < NKEY_INT; k++ ) {
+    istat = 0 ;
+    fits_read_key(fp, TINT, KEY_INT[k], &ival, comment, &istat);
+    if ( istat != 0 || ival != VAL_INT[k] ) {
+      printf("\t %s mismatch (%d vs. %d) -> no re-use\n", 
+	     KEY_INT[k], ival, VAL_INT[k] );
+      return false ;
+    }
+  }
+
+  for ( k=0; k < NKEY_FLT; k++ ) {
+    istat = 0 ;
+    fits_read_key(fp, TFLOAT, KEY_FLT[k], &fval, comment, &istat);
+    if ( istat != 0 || fval != VAL_FLT[k] ) {
+      printf("\t %s mismatch (%f vs. %f) -> no re-use\n", 
+	     KEY_FLT[k], fval, VAL_FLT[k] );
+      return false ;
+    }
+  }
+
+  if ( NKCOR > 0 ) {
+    istat = 0 ;
+    fits_read_key(fp, TFLOAT, "RV", &fval, comment, &istat);
+    if ( istat != 0 || fval != (float)INPUTS.RV_MWCOLORLAW ) 
+      { printf("\t RV mismatch -> no re-use\n"); return false ; }
+    istat = 0 ;
+    fits_read_key(fp, TINT, "OPT_MWCOLORLAW", &ival, comment, &istat);
+    if ( istat != 0 || ival != INPUTS.OPT_MWCOLORLAW ) 
+      { printf("\t OPT_MWCOLORLAW mismatch -> no re-use\n"); return false;}
+  }
+
+  for ( ifilt = 1; ifilt <= NFILTDEF ; ifilt++ ) {
+    sprintf(KEYNAME,"FILT%3.3d", ifilt);
+    istat = 0 ;
+    fits_read_key(fp, TSTRING, KEYNAME, KEYVAL, comment, &istat);
+    if ( istat != 0 || strcmp(KEYVAL,FILTER[ifilt].name) != 0 ) {
+      printf("\t %s mismatch (%s vs. %s) -> no re-use\n", 
+	     KEYNAME, KEYVAL, FILTER[ifilt].name );
+      return false ;
+    }
+  }
+
+  for ( ikcor = 1; ikcor <= NKCOR ; ikcor++ ) {
+    char KCORDEF[200];
+    sprintf(KEYNAME,"KCOR%3.3d", ikcor);
+    sprintf(KCORDEF,"Kcor %s for rest %s to obs %s",
+	    KCORSYM[ikcor], KCORLIST[ikcor][0], KCORLIST[ikcor][1] );
+    istat = 0 ;
+    fits_read_key(fp, TSTRING, KEYNAME, KEYVAL, comment, &istat);
+    if ( istat != 0 || strcmp(KEYVAL,KCORDEF) != 0 ) {
+      printf("\t %s mismatch (%s) -> no re-use\n", KEYNAME, KEYVAL);
+      return false ;
+    }
+  }
+
+  return true ;
+
+} // end match_calib_ref_header
+
+
+// ***************************************************
+bool match_calib_ref_snsed(fitsfile *fp) {
+
+  // Created Oct 2026
+  // Return true if SN SED table in reference calib file is identical
+  // to the SED that would be written by wr_fits_SNSED.
+
+  int  NBLAM  = SNSED.NBIN_LAMBDA ;
+  int  NTREST = SNSED.NEPOCH ;
+  long NROW   = NBLAM * NTREST ;
+  int  istat = 0, anynul, iday, ilam, irow ;
+  float *FLUX_REF, flux, NULL_F = 0.0 ;
+  bool SAME = true ;
+
+  // ------------ BEGIN ------------
+
+  fits_movnam_hdu(fp, BINARY_TBL, "SN SED", 0, &istat);
+  if ( istat != 0 ) 
+    { printf("\t Missing SN SED table -> no re-use\n"); return false; }
+
+  FLUX_REF = (float*) malloc( NROW * sizeof(float) );
+  fits_read_col_flt(fp, 1, 1, 1, NROW, NULL_F, FLUX_REF, &anynul, &istat);
+  if ( istat != 0 ) { SAME = false; }
+
+  irow = 0 ;
+  for ( iday=1; iday <= NTREST && SAME ; iday++ ) {      
+    for ( ilam=1; ilam <= NBLAM; ilam++ ) {
+      flux  = (float)SNSED.FLUX_WAVE[iday][ilam] ;
+      flux *= SNSED.LAMBDA_BINSIZE;     
+      if ( flux != FLUX_REF[irow] ) { SAME = false; break; }
+      irow++ ;
+    }
+  }
+
+  free(FLUX_REF);
+  if ( !SAME ) { printf("\t SN SED mismatch -> no re-use\n"); }
+
+  return SAME ;
+
+} // end match_calib_ref_snsed
+
+
+// ***************************************************
+void match_calib_ref_filters(fitsfile *fp) {
+
+  // Created Oct 2026
+  // Set CALIB_REF_KCOR.REUSE_FILT[ifilt] = true if filter trans in 
+  // FilterTrans table, and primary name, primary mag and zero point
+  // in ZPoff table, are identical to values written by this job.
+
+  int  NBLAM = SNSED.NBIN_LAMBDA ;
+  int  istat = 0, anynul, ifilt, ilam, icol ;
+  float *TRANS_REF, *LAM_REF, *FVAL_REF, NULL_F = 0.0 ;
+  char **NAME_REF ;
+  bool SAME ;
+
+  // ------------ BEGIN ------------
+
+  for ( ifilt=0; ifilt < MXFILTDEF; ifilt++ ) 
+    { CALIB_REF_KCOR.REUSE_FILT[ifilt] = false; }
+
+  TRANS_REF = (float*) malloc( (NBLAM+1) * sizeof(float) );
+  LAM_REF   = (float*) malloc( (NBLAM+1) * sizeof(float) );
+  FVAL_REF  = (float*) malloc( (NFILTDEF+1) * sizeof(float) );
+  NAME_REF  = (char**) malloc( sizeof(char*) );
+  NAME_REF[0] = (char*) malloc( 60*sizeof(char) );
+
+  // - - - - ZPoff table - - - - 
+  fits_movnam_hdu(fp, BINARY_TBL, "ZPoff", 0, &istat);
+  if ( istat != 0 ) { goto DONE; }
+
+  for ( ifilt=1; ifilt <= NFILTDEF; ifilt++ ) {
+    fits_read_col_str(fp, 2, ifilt, 1, 1, "", NAME_REF, &anynul, &istat);
+    CALIB_REF_KCOR.REUSE_FILT[ifilt] = 
+      ( istat == 0 && strcmp(NAME_REF[0],FILTER[ifilt].MAGSYSTEM_NAME)==0);
+  }
+
+  fits_read_col_flt(fp, 3, 1, 1, NFILTDEF, NULL_F, &FVAL_REF[1], 
+		    &anynul, &istat);
+  for ( ifilt=1; ifilt <= NFILTDEF; ifilt++ ) {
+    if ( FVAL_REF[ifilt] != (float)FILTER[ifilt].MAGFILTER_REF ) 
+      { CALIB_REF_KCOR.REUSE_FILT[ifilt] = false; }
+  }
+
+  fits_read_col_flt(fp, 4, 1, 1, NFILTDEF, NULL_F, &FVAL_REF[1], 
+		    &anynul, &istat);
+  for ( ifilt=1; ifilt <= NFILTDEF; ifilt++ ) {
+    if ( FVAL_REF[ifilt] != (float)FILTER[ifilt].MAGFILTER_ZP ) 
+      { CALIB_REF_KCOR.REUSE_FILT[ifilt] = false; }
+  }
+
+  if ( istat != 0 ) { goto DONE; }
+
+  // - - - - FilterTrans table - - - - 
+  fits_movnam_hdu(fp, BINARY_TBL, "FilterTrans", 0, &istat);
+  fits_read_col_flt(fp, 1, 1, 1, NBLAM, NULL_F, &LAM_REF[1], 
+		    &anynul, &istat);
+  if ( istat != 0 ) { goto DONE; }
+
+  for ( ilam=1; ilam <= NBLAM; ilam++ ) {
+    if ( LAM_REF[ilam] != (float)SNSED.LAMBDA[1][ilam] ) 
+      { istat = -1; goto DONE; }
+  }
+
+  for ( ifilt=1; ifilt <= NFILTDEF; ifilt++ ) {
+    if ( !CALIB_REF_KCOR.REUSE_FILT[ifilt] ) { continue; }
+    icol = ifilt + 1 ;
+    fits_read_col_flt(fp, icol, 1, 1, NBLAM, NULL_F, &TRANS_REF[1], 
+		      &anynul, &istat);
+    SAME = ( istat == 0 );
+    for ( ilam=1; ilam <= NBLAM && SAME; ilam++ ) {
+      if ( TRANS_REF[ilam] != (float)FILTER[ifilt].TRANS_SNGRID[ilam] )
+	{ SAME = false; }
+    }
+    CALIB_REF_KCOR.REUSE_FILT[ifilt] = SAME ;
+  }
+
+ DONE:
+  if ( istat != 0 ) {
+    printf("\t Cannot read/match ZPoff or FilterTrans table -> no re-use\n");
+    for ( ifilt=0; ifilt < MXFILTDEF; ifilt++ ) 
+      { CALIB_REF_KCOR.REUSE_FILT[ifilt] = false; }
+  }
+
+  for ( ifilt=1; ifilt <= NFILTDEF; ifilt++ ) {
+    if ( CALIB_REF_KCOR.REUSE_FILT[ifilt] ) 
+      { CALIB_REF_KCOR.NFILT_REUSE++ ; }
+    else
+      { printf("\t Recompute tables for %s \n", FILTER[ifilt].name); }
+  }
+
+  free(TRANS_REF); free(LAM_REF); free(FVAL_REF);
+  free(NAME_REF[0]); free(NAME_REF);
+
+  return ;
+
+} // end match_calib_ref_filters
+
+
+// ***************************************************
+void read_calib_ref_tables(fitsfile *fp) {
+
+  // Created Oct 2026
+  // Copy re-used K-cors from reference KCOR table into R4KCOR_GRID,
+  // and re-used observer mags & MWXT slopes from MAG+MWXTCOR table
+  // into SNSED.R4MAG_OBS[0] & SNSED.MW_dXT_dEBV. Row order is
+  // (AV,z,Trest) as in wr_fits_KCOR and wr_fits_MAGS.
+
+  int  NCOFF = 3 ;
+  long NROW  = INPUTS.NBIN_AV * INPUTS.NBIN_REDSHIFT * SNSED.NEPOCH ;
+  int  istat = 0, anynul, ikcor, ifilt, iav, iz, iday, irow, icol ;
+  float *COL_REF, NULL_F = 0.0, kcor ;
+
+  // ------------ BEGIN ------------
+
+  COL_REF = (float*) malloc( NROW * sizeof(float) );
+
+  if ( CALIB_REF_KCOR.NKCOR_REUSE > 0 ) {
+    fits_movnam_hdu(fp, BINARY_TBL, "KCOR", 0, &istat);
+    sprintf(c1err,"move to KCOR table in CALIB_FILE_REF");
+    wr_fits_errorCheck(c1err, istat) ;
+  }
+
+  for ( ikcor=1; ikcor <= NKCOR; ikcor++ ) {
+    if ( !CALIB_REF_KCOR.REUSE_KCOR[ikcor] ) { continue; }
+    icol = NCOFF + ikcor ;
+    fits_read_col_flt(fp, icol, 1, 1, NROW, NULL_F, COL_REF, 
+		      &anynul, &istat);
+    sprintf(c1err,"read %s from CALIB_FILE_REF", KCORSYM[ikcor] );
+    wr_fits_errorCheck(c1err, istat) ;
+
+    irow = 0 ;
+    for ( iav = 1; iav <= INPUTS.NBIN_AV; iav++ ) {
+      for ( iz=1; iz <= INPUTS.NBIN_REDSHIFT; iz++ ) {
+	for ( iday=1; iday <= SNSED.NEPOCH; iday++ ) {
+	  kcor = COL_REF[irow] ;  irow++ ;
+	  R4KCOR_GRID.VALUE[ikcor][iav][iz][iday] = kcor ;
+	  if ( kcor == (float)NULLVAL ) { continue; }
+	  if ( kcor > KCOR_GRID_JOBS.KCORMAX[ikcor] ) 
+	    { KCOR_GRID_JOBS.KCORMAX[ikcor] = kcor; }
+	  if ( kcor < KCOR_GRID_JOBS.KCORMIN[ikcor] ) 
+	    { KCOR_GRID_JOBS.KCORMIN[ikcor] = kcor; }
+	}
+      }
+    }
+  }
+
+  if ( CALIB_REF_KCOR.NFILT_REUSE > 0 ) {
+    fits_movnam_hdu(fp, BINARY_TBL, "MAG+MWXTCOR", 0, &istat);
+    sprintf(c1err,"move to MAG+MWXTCOR table in CALIB_FILE_REF");
+    wr_fits_errorCheck(c1err, istat) ;
+  }
+
+  for ( ifilt=1; ifilt <= NFILTDEF; ifilt++ ) {
+    if ( !CALIB_REF_KCOR.REUSE_FILT[ifilt] ) { continue; }
+
+    icol = NCOFF + ifilt ;
+    fits_read_col_flt(fp, icol, 1, 1, NROW, NULL_F, COL_REF, 
+		      &anynul, &istat);
+    sprintf(c1err,"read MAGOBS for %s from CALIB_FILE_REF", 
+	    FILTER[ifilt].name );
+    wr_fits_errorCheck(c1err, istat) ;
+    irow = 0 ;
+    for ( iav = 1; iav <= INPUTS.NBIN_AV; iav++ ) {
+      for ( iz=1; iz <= INPUTS.NBIN_REDSHIFT; iz++ ) {
+	for ( iday=1; iday <= SNSED.NEPOCH; iday++ ) {
+	  SNSED.R4MAG_OBS[0][ifilt][iav][iz][iday] = COL_REF[irow] ;  
+	  irow++ ;
+	}
+      }
+    }
+
+    icol = NCOFF + ifilt + NFILTDEF ;
+    fits_read_col_flt(fp, icol, 1, 1, NROW, NULL_F, COL_REF, 
+		      &anynul, &istat);
+    sprintf(c1err,"read MWXT_SLOPE for %s from CALIB_FILE_REF", 
+	    FILTER[ifilt].name );
+    wr_fits_errorCheck(c1err, istat) ;
+    irow = 0 ;
+    for ( iav = 1; iav <= INPUTS.NBIN_AV; iav++ ) {
+      for ( iz=1; iz <= INPUTS.NBIN_REDSHIFT; iz++ ) {
+	for ( iday=1; iday <= SNSED.NEPOCH; iday++ ) {
+	  SNSED.MW_dXT_dEBV[ifilt][iav][iz][iday] = (double)COL_REF[irow] ;
+	  irow++ ;
+	}
+      }
+    }
+  }
+
+  free(COL_REF);
+
+  return ;
+
+} // end read_calib_ref_tables
 
-} // end of kcor_grid
+
+
+
+// ***************************************************
+void fill_MWXT_KCOR(void) {
+
+  // Created Oct 2026
+  // Store MW flux-fraction MWXT_FRAC_KCOR[iebv][ilam] for each 
+  // MWEBV_LIST value and each SN lambda bin (epoch=1 grid). 
+  // Extinction is evaluated for the whole lambda array with one
+  // call to GALextinct_array, instead of once per (epoch,filter)
+  // in kcor_eval.
+
+  int    NBIN = SNSED.NBIN_LAMBDA ;
+  int    iebv, ilam, MEM ;
+  double RV   = INPUTS.RV_MWCOLORLAW ;
+  double mwav, *XTMAG ;
+  char fnam[] = "fill_MWXT_KCOR" ;
+
+  // ------------- BEGIN ----------
+
+  MEM   = (NBIN+1) * sizeof(double) ;
+  XTMAG = (double*) malloc(MEM);
+
+  for ( iebv=0; iebv <= MXMWEBV; iebv++ ) {
+    MWXT_FRAC_KCOR[iebv] = (double*) malloc(MEM);
+    mwav = RV * MWEBV_LIST[iebv] ;
+    GALextinct_array(RV, mwav, NBIN, &SNSED.LAMBDA[1][1],
+		     INPUTS.OPT_MWCOLORLAW, INPUTS.PARLIST_MWCOLORLAW,
+		     &XTMAG[1], fnam );
+    MWXT_FRAC_KCOR[iebv][0] = 1.0 ;
+    for ( ilam=1; ilam <= NBIN; ilam++ ) 
+      { MWXT_FRAC_KCOR[iebv][ilam] = 1.0/pow(TEN, 0.4*XTMAG[ilam]) ; }
+  }
+
+  free(XTMAG);
+  return ;
+
+} // end fill_MWXT_KCOR
 
 
 
@@ -3442,6 +4049,7 @@ void kcor_eval(int opt                // (I) K cor option ("E" or "N")
 	       ,double *kcor_error   // (O) error on above
 	       ,double *overlap      // (O) rest-observer flux overlap
                ,double *mag_obs       // (O) observer-flux in ifilt_obs
+	       ,SNFLUX_CACHE_DEF *CACHE // (I) SN flux cache for av,z,epoch
    ) {
 
 /***
@@ -3472,6 +4080,10 @@ void kcor_eval(int opt                // (I) K cor option ("E" or "N")
 
   Jun 9, 2009: all floats -> double
 
+  Oct 15 2026: use filter trans stored on SN lambda grid, and SN
+               fluxes from CACHE that is shared by all K-cors at
+               this (av,z,epoch).
+
  ***/
 
   int   
@@ -3567,10 +4179,10 @@ void kcor_eval(int opt                // (I) K cor option ("E" or "N")
 
      if ( LAM >= LAMMIN_FILT && LAM <= LAMMAX_FILT ) {
 
-       trans_rest  = filter_trans( LAM, ifilt_rest, 0 );
+       trans_rest  = FILTER[ifilt_rest].TRANS_SNGRID[ilam_sn] ;
      
 	if ( trans_rest > 0.0 ) {
-	  flux_sn_rest  = snflux ( epoch, LAM, zero, av );   // flux at z=0 
+	  flux_sn_rest  = snflux_cache(CACHE, 0, ilam_sn);  // flux at z=0 
 	  conv_sn_rest += flux_sn_rest * trans_rest * LAM ;
 
 	  // June 6, 2008 compute overlap function
@@ -3609,12 +4221,12 @@ void kcor_eval(int opt                // (I) K cor option ("E" or "N")
 
      if ( LAM >= LAMMIN_FILT && LAM <= LAMMAX_FILT ) {
 
-       trans_obs   = filter_trans( LAM, ifilt_obs, 0 ); // filter trans
+       trans_obs   = FILTER[ifilt_obs].TRANS_SNGRID[ilam_sn] ; 
 
        if ( trans_obs > 0.0 ) {
 
 	 // get redshifted flux needed for K-cor
-	 flux_sn_obs  = snflux ( epoch, LAM, redshift, av ); 
+	 flux_sn_obs  = snflux_cache(CACHE, 1, ilam_sn); 
 	 conv_sn_obs += flux_sn_obs * trans_obs * LAM ;
 
 	 if ( flux_sn_obs == NULLVAL ) { return ; }
@@ -3631,10 +4243,14 @@ void kcor_eval(int opt                // (I) K cor option ("E" or "N")
 		       &lam, &ftmp, &wflux, &wfilt ) ;
 
 	 for ( iebv=0; iebv <= MXMWEBV; iebv++ ) {
-	   mwav = INPUTS.RV_MWCOLORLAW * MWEBV_LIST[iebv] ;
-	   tmp  = 0.4 * GALextinct ( RV, mwav, lam,
-				     INPUTS.OPT_MWCOLORLAW, INPUTS.PARLIST_MWCOLORLAW, fnam );
-	   mwxt = 1./pow(ten,tmp) ;
+	   if ( lam == SNSED.LAMBDA[1][ilam_sn] ) 
+	     { mwxt = MWXT_FRAC_KCOR[iebv][ilam_sn] ; }
+	   else {
+	     mwav = INPUTS.RV_MWCOLORLAW * MWEBV_LIST[iebv] ;
+	     tmp  = 0.4 * GALextinct ( RV, mwav, lam,
+				       INPUTS.OPT_MWCOLORLAW, INPUTS.PARLIST_MWCOLORLAW, fnam );
+	     mwxt = 1./pow(ten,tmp) ;
+	   }
 	   flux_obs[iebv]  += mwxt * wflux * flux * trans_obs  ; 
 	   flux_obs[iebv]  += 0.1E-8;
 	 }
@@ -3898,6 +4514,57 @@ double snflux( double epoch, double lambda, double redshift, double av ) {
 }  // end of snflux
 
 
+// ***********************************************************************
+void init_snflux_cache(SNFLUX_CACHE_DEF *CACHE, double av, double z,
+		       double epoch) {
+
+  // Created Oct 2026
+  // Reset SN flux cache for new (av,z,epoch) grid point.
+
+  int NBIN = SNSED.NBIN_LAMBDA ;
+  int MEMB = (NBIN+1) * sizeof(bool) ;
+
+  CACHE->av    = av ;
+  CACHE->z     = z ;
+  CACHE->epoch = epoch ;
+  memset(CACHE->DONE_REST, 0, MEMB);
+  memset(CACHE->DONE_OBS,  0, MEMB);
+
+} // end init_snflux_cache
+
+
+double snflux_cache(SNFLUX_CACHE_DEF *CACHE, int OPT_Z, int ilam) {
+
+  // Created Oct 2026
+  // Return snflux at SN lambda index ilam for the (av,z,epoch) stored
+  // in CACHE. OPT_Z=0 -> rest frame (z=0); OPT_Z=1 -> redshifted.
+  // Flux is computed on first request and stored for the other
+  // K-cors at the same grid point.
+
+  double LAM = SNSED.LAMBDA[1][ilam] ;
+  double flux ;
+
+  if ( OPT_Z == 0 ) {
+    if ( !CACHE->DONE_REST[ilam] ) {
+      CACHE->FLUX_REST[ilam] = snflux(CACHE->epoch, LAM, 0.0, CACHE->av);
+      CACHE->DONE_REST[ilam] = true ;
+    }
+    flux = CACHE->FLUX_REST[ilam] ;
+  }
+  else {
+    if ( !CACHE->DONE_OBS[ilam] ) {
+      CACHE->FLUX_OBS[ilam] = snflux(CACHE->epoch, LAM, 
+				     CACHE->z, CACHE->av);
+      CACHE->DONE_OBS[ilam] = true ;
+    }
+    flux = CACHE->FLUX_OBS[ilam] ;
+  }
+
+  return flux ;
+
+} // end snflux_cache
+
+
 
 double primaryflux( int iprim, double lambda ) {
 
@@ -5013,6 +5680,45 @@ void wr_fits_SNSED(fitsfile *fp) {
 } // end of wr_fits_SNSED
 
 
+// ========================================
+double ZP_SEDMODEL_KCOR(int ifilt) {
+
+  // Created Oct 2026
+  // Return zeropoint for filter ifilt using the same convention
+  // as init_filter_SEDMODEL in genmag_SEDtools.c:
+  //    ZP = 2.5*log10( sum[T * F_prim * lam] * dlam/hc ) + magprim
+  // Trans and primary flux are evaluated on the SNSED lambda grid
+  // and truncated to float so that the sum matches what is computed
+  // from the FilterTrans and PrimarySED tables written to the
+  // calib file.
+
+  int    iprim   = FILTER[ifilt].MAGSYSTEM_INDX ;
+  int    NBLAM   = SNSED.NBIN_LAMBDA ;
+  double lamstep = SNSED.LAMBDA_BINSIZE ;
+  double magprim = FILTER[ifilt].MAGFILTER_REF ;
+  double hc8     = (double)hc ;
+  double lam, trans, flux, sum = 0.0, ZP = 0.0 ;
+  int    ilam ;
+
+  // ------------ BEGIN ------------
+
+  if ( iprim <= 0 ) { return ZP; }
+
+  for ( ilam=1; ilam <= NBLAM; ilam++ ) {
+    lam   = (double)((float)SNSED.LAMBDA[1][ilam]) ;
+    trans = (double)((float)filter_trans(SNSED.LAMBDA[1][ilam],ifilt,0));
+    if ( trans == 0.0 ) { continue; }
+    flux  = (double)((float)primaryflux(iprim, SNSED.LAMBDA[1][ilam]));
+    sum  += trans * flux * lam ;
+  }
+
+  sum *= (lamstep/hc8);
+  if ( sum > 0.0 ) { ZP = 2.5*log10(sum) + magprim ; }
+
+  return ZP ;
+
+} // end ZP_SEDMODEL_KCOR
+
 // ========================================
 void wr_fits_ZPT(fitsfile *fp) {
 
@@ -5027,6 +5733,8 @@ void wr_fits_ZPT(fitsfile *fp) {
   // offsets. These offsets are NOT used here in the K-cor program;
   // instead they are stored so that snana can use them.
   //
+  // Oct 15 2026: add ZP(SEDMODEL) column; see ZP_SEDMODEL_KCOR().
+  //
 
   int istat, ncol, icol, ifilt ;
   int firstrow, firstelem, nrow ;
@@ -5040,6 +5748,7 @@ void wr_fits_ZPT(fitsfile *fp) {
     ,LABEL_PRIMARY_MAG[]  = "Primary Mag"
     ,LABEL_ZPOFF_REF[]    = "ZPoff(Primary)"  // used here, but not in snana
     ,LABEL_ZPOFF_SN[]     = "ZPoff(SNpot)"    // ignore here, used in snana
+    ,LABEL_ZP_SEDMODEL[]  = "ZP(SEDMODEL)"    // used by SED models
     ,TBLname[] = "ZPoff" 
     ;
 
@@ -5050,13 +5759,14 @@ void wr_fits_ZPT(fitsfile *fp) {
   printf("\t %s: write ZPT info \n", fnam );
   fflush(stdout);
 
-  ncol = 5 ; istat = 0 ;
+  ncol = 6 ; istat = 0 ;
 
   STRFITS.tName[0] = LABEL_FILT ;
   STRFITS.tName[1] = LABEL_PRIMARY_NAME ;
   STRFITS.tName[2] = LABEL_PRIMARY_MAG ;
   STRFITS.tName[3] = LABEL_ZPOFF_REF ;
   STRFITS.tName[4] = LABEL_ZPOFF_SN ;
+  STRFITS.tName[5] = LABEL_ZP_SEDMODEL ;
 
 
 
@@ -5066,7 +5776,7 @@ void wr_fits_ZPT(fitsfile *fp) {
   }
   STRFITS.tForm[0] = STRFITS.C20 ;
   STRFITS.tForm[1] = STRFITS.C20 ;
-
+  STRFITS.tForm[5] = STRFITS.D8 ;
 
   fits_create_tbl(fp, BINARY_TBL, NROW, ncol
 		  ,&STRFITS.tName[0]
@@ -5084,6 +5794,7 @@ void wr_fits_ZPT(fitsfile *fp) {
   firstrow = 0 ;
 
   float mag_prim, zptoff_ref, zptoff_filt ;
+  double zp_sedmodel ;
   char  *name_filt, *name_prim ;
 
   for ( ifilt = 1; ifilt <= NFILTDEF ; ifilt++) {
@@ -5094,6 +5805,7 @@ void wr_fits_ZPT(fitsfile *fp) {
     mag_prim     = FILTER[ifilt].MAGFILTER_REF ;     // primary mag
     zptoff_ref   = FILTER[ifilt].MAGFILTER_ZP ;      // applied filter zp
     zptoff_filt  = FILTER[ifilt].MAGFILTER_ZPOFF;    // stored AB  offset
+    zp_sedmodel  = ZP_SEDMODEL_KCOR(ifilt);          // SEDMODEL ZP
    
     icol++;     
     fits_write_col(fp, TSTRING, icol, firstrow, firstelem, nrow,
@@ -5125,6 +5837,12 @@ void wr_fits_ZPT(fitsfile *fp) {
     sprintf(c1err,"write ZPTOFF_FILT into %s", TBLname );
     wr_fits_errorCheck(c1err, istat) ;  
 
+    icol++ ;
+    fits_write_col(fp, TDOUBLE, icol, firstrow, firstelem, nrow,
+		   &zp_sedmodel, &istat);  
+    sprintf(c1err,"write ZP_SEDMODEL into %s", TBLname );
+    wr_fits_errorCheck(c1err, istat) ;  
+
   }
 
   return ;
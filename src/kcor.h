@@ -19,6 +19,12 @@
   Nov 15 2020: IVERSION_KCOR -> 4 (was 3) for reading SURVEY key
 
   May 31 2024:  set all MXLAM_XXX values to common MXLAMBIN_SNANA (from sntools.h)
+
+  Oct 15 2026: add INPUTS.NTHREAD, FILTER[].TRANS_SNGRID and
+               SNFLUX_CACHE_DEF for faster/threaded kcor_grid.
+
+  Oct 15 2026: add INPUTS.CALIB_FILE_REF and CALIB_REF_KCOR struct
+               to re-use K-cor & mag tables from reference calib file.
     
 
 ********************************************************/
@@ -39,6 +45,7 @@ bool REQUIRE_SURVEY_KCOR = true ; // flip to require SURVEY in kcor-input
 #define MXMWEBV      4    // max number of MW E(B-V) bins
 #define MXPRIMARY    6    // max number of primary standards
 #define MXCHAR_FILENAME 200
+#define MXTHREAD_KCOR  64    // max number of pthreads for kcor_grid
 
 #define MXSED  MXLAM_SN*MXEP // max flattened array size for lam x epoch
 
@@ -130,6 +137,8 @@ struct INPUTS {
   double SN_MAGOFF ;   // (I) global mag-offset 
 
   int FASTDEBUG ;    // 1 => skip calculations to run thru quickly
+  int NTHREAD ;      // (I) number of pthreads for kcor_grid (Oct 2026)
+  char CALIB_FILE_REF[MXPATHLEN]; // (I) re-use tables for unchanged filters
 
   int SKIPKCOR;      // (I) 1=> skip K-corrections (just do mags & zeropoints)
   int FLUXERR_FLAG;  // (I) flux errors are present => read & ignore
@@ -187,6 +196,35 @@ double VEGAOFF_ASTIER06[7] = { -99.0, 0.02, 0.03, 0.03, 0.03, 0.024,.03 };
 // define array of MW E(B-V) values to check linear relation
 double MWEBV_LIST[MXMWEBV+1] = { 0.0, 0.1, 0.20, 0.40, 0.80 };
 
+// Oct 2026: MW flux-fraction vs. SN lambda index for each MWEBV_LIST
+// value; filled once by fill_MWXT_KCOR and used in kcor_eval.
+double *MWXT_FRAC_KCOR[MXMWEBV+1] ;
+
+// Oct 2026: SN flux vs. SN lambda index at one (AV,z,epoch) grid point;
+// computed on demand and shared by all K-cors at this grid point.
+typedef struct {
+  double av, z, epoch ;
+  double *FLUX_REST, *FLUX_OBS ; // rest-frame (z=0) and redshifted
+  bool   *DONE_REST, *DONE_OBS ;
+} SNFLUX_CACHE_DEF ;
+
+// Oct 2026: K-cor and mag tables re-used from INPUTS.CALIB_FILE_REF.
+// A filter is re-used if its trans and zero point are identical in
+// the reference file; a K-cor is re-used if both filters are re-used.
+struct {
+  int  NFILT_REUSE, NKCOR_REUSE ;
+  bool REUSE_FILT[MXFILTDEF];
+  bool REUSE_KCOR[MXKCOR];
+} CALIB_REF_KCOR ;
+
+// Oct 2026: job bookkeeping for threaded kcor_grid; 
+// one job is one (AV,z) bin.
+struct {
+  int    NJOB, IJOB_NEXT, NZBIN ;
+  double KCORMIN[MXKCOR], KCORMAX[MXKCOR] ;
+  pthread_mutex_t MUTEX ;
+} KCOR_GRID_JOBS ;
+
 
 // define SN template
 struct SNSED {
@@ -305,6 +343,8 @@ struct  FILTER
   int    NBIN_LAMBDA ;      // No. lambda bins 
   int  IFLAG_DUPLICATE ; // T -> duplicate band with LAMSHIFT (May 2017)
 
+  double *TRANS_SNGRID ; // trans vs. SN lambda index (Oct 2026)
+
   // SSUM = int S(lam,nu) dlam,dnu/nu 
   double SSUM_PRIM ; // in primary ref lambda bins
   double SSUM_SN ;   // in SN lambda bins
@@ -396,6 +436,15 @@ void  set_store_lambda_range(void);
 int   malloc_ini(void);
 int   kcor_out(void) ;
 int   kcor_grid(void) ;
+void  kcor_grid_zav(int i_av, int i_z, SNFLUX_CACHE_DEF *CACHE,
+		    double *KCORMIN, double *KCORMAX);
+void *kcor_grid_thread(void *arg);
+void  fill_TRANS_SNGRID_KCOR(void);
+void  read_calib_ref_KCOR(void);
+bool  match_calib_ref_header(fitsfile *fp);
+bool  match_calib_ref_snsed(fitsfile *fp);
+void  match_calib_ref_filters(fitsfile *fp);
+void  read_calib_ref_tables(fitsfile *fp);
 void  primarymag_zp(int iprim);  // integrated fluxes, mags, and zero points/
 void  primarymag_zp2(int iprim);
 void  primarymag_summary(int iprim); 
@@ -437,18 +486,23 @@ double filter_trans ( double lam, int ifilt, int idump );
 
 // return SN flux at "epoch" and for "lambda/(1+redshift)"
 double snflux ( double epoch, double lambda, double redshift, double av );
+void   init_snflux_cache(SNFLUX_CACHE_DEF *CACHE, double av, double z,
+			 double epoch);
+double snflux_cache(SNFLUX_CACHE_DEF *CACHE, int OPT_Z, int ilam);
 
 // return flux of primary standard
 double primaryflux ( int iprim, double lambda );
 
 // Compute K correction as in Nugent 2002 
 // Note opt = OPT_KCOR_EPHOT, OPT_KCOR_NPHOT 
+void fill_MWXT_KCOR(void);
 void kcor_eval ( int iopt
 		 ,double av, double redshift, double epoch
 		 ,int ifilt_rest, int ifilt_obs
 		 ,int FLAG_MAGOBS
 		 ,double *kcor_value, double *kcor_error
 		 ,double *overlap, double *flux_obs
+		 ,SNFLUX_CACHE_DEF *CACHE
                         ) ;
 
 // convert  epoch (days) to integer index
@@ -474,6 +528,7 @@ void wr_fits_HEAD(fitsfile *fp);
 void wr_fits_PRIMARY(fitsfile *fp);
 void wr_fits_SNSED(fitsfile *fp);
 void wr_fits_ZPT(fitsfile *fp);
+double ZP_SEDMODEL_KCOR(int ifilt);
 void wr_fits_FilterTrans(fitsfile *fp);
 void wr_fits_KCOR(fitsfile *fp);
 void wr_fits_MAGS(fitsfile *fp);
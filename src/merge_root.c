@@ -19,6 +19,12 @@
     + abort if number of input files exceeds MXFILE_MERGE
     + MXFILE_MERGE -> 200 (was 130)
 
+  Oct 15 2026:
+    + MXFILE_MERGE -> 1000 (was 200) for large split jobs.
+    + fast path for TEXT tables (MERGE_TEXT): validate that each
+      VARNAMES list matches the first file, then copy data lines
+      without parsing values. Header of first file is kept.
+
 **************************************/
 
 #include <stdio.h>
@@ -28,6 +34,7 @@
 #include <math.h>
 #include <time.h>
 #include <sys/stat.h>
+#include <ctype.h>
 
 #include "sntools.h"
 #include "sntools_output.h"
@@ -35,9 +42,11 @@
 #ifdef USE_ROOT
 void MERGE_ROOT(int NFILE, char **INFILES, char *OUTFILE);
 #endif
+void MERGE_TEXT(int NFILE, char **INFILES, char *OUTFILE);
 
 
-#define MXFILE_MERGE 200 
+#define MXFILE_MERGE 1000  // Oct 2026: 200 -> 1000
+#define MXCHAR_LINE_MERGE 40000 
 
 char msgerr1[80], msgerr2[80];
 
@@ -65,18 +74,20 @@ int main(int argc, char **argv) {
 
   set_EXIT_ERRCODE(EXIT_ERRCODE_merge_root);
 
-#ifndef USE_ROOT
-  sprintf(msgerr1,
-	  "Cannot run %s because it's not linked to root.", fnam);
-  sprintf(msgerr2,
-	  "Set USE_ROOT in Makefile and #define ROOT in sntools_output.h");
-  errmsg(SEV_FATAL, 0, fnam, msgerr1, msgerr2 ); 
-#endif
-
-
   printf(" Begin %s \n", fnam ); fflush(stdout);
   parse_args(argc,argv);
 
+#ifndef USE_ROOT
+  // Oct 2026: text tables can be merged without root
+  if ( !ISFILE_TEXT(INPUTS.INFILES[0]) ) {
+    sprintf(msgerr1,
+	    "Cannot run %s because it's not linked to root.", fnam);
+    sprintf(msgerr2,
+	    "Set USE_ROOT in Makefile and #define ROOT in sntools_output.h");
+    errmsg(SEV_FATAL, 0, fnam, msgerr1, msgerr2 ); 
+  }
+#endif
+
   // xxx mark  print_elapsed_time(t_start,"INIT", UNIT_TIME_SECOND) ;
 
   // do lots of sanity checks
@@ -88,8 +99,12 @@ int main(int argc, char **argv) {
   outF = INPUTS.OUTFILE ;
   for(i=0; i<NF; i++ ) { inF[i] = INPUTS.INFILES[i] ; }
 
+  if ( INPUTS.IFILETYPE == IFILETYPE_TEXT ) 
+    { MERGE_TEXT(NF,inF,outF); }
+
 #ifdef USE_ROOT
-  MERGE_ROOT(NF,inF,outF); 
+  if ( INPUTS.IFILETYPE == IFILETYPE_ROOT ) 
+    { MERGE_ROOT(NF,inF,outF); }
   fflush(stdout);
 #endif
 
@@ -184,6 +199,10 @@ void checkFiles(void) {
 	sprintf(FTYPE,"ROOT");
       }
 #endif
+      if ( IFILETYPE < 0 && ISFILE_TEXT(inFile) ) { 
+	IFILETYPE = IFILETYPE_TEXT  ; 
+	sprintf(FTYPE,"TEXT");
+      }
 
       printf(" Found %-8.8s File %3d: '%s' \n", FTYPE, ifile+1, inFile ); 
       fflush(stdout);
@@ -195,7 +214,7 @@ void checkFiles(void) {
 
 	if ( IFILETYPE < 0 ) {
 	  sprintf(msgerr1,"Invalid file type for '%s'", inFile);
-	  sprintf(msgerr2,"Must be a ROOT file.");
+	  sprintf(msgerr2,"Must be a ROOT or TEXT file.");
 	  errmsg(SEV_FATAL, 0, fnam, msgerr1, msgerr2 );	
 	}
       }
@@ -231,6 +250,8 @@ void checkFiles(void) {
 #ifdef USE_ROOT
       if ( ISFILE_ROOT(outFile)  ) { IFILETYPE = IFILETYPE_ROOT  ; }
 #endif
+      if ( IFILETYPE < 0 && ISFILE_TEXT(outFile) ) 
+	{ IFILETYPE = IFILETYPE_TEXT  ; }
 
       if ( IFILETYPE != INPUTS.IFILETYPE ) {
 	sprintf(msgerr1,"Output file type does not match input.");
@@ -241,3 +262,88 @@ void checkFiles(void) {
 
 } // end of checkFiles
 
+
+
+// =========================
+void MERGE_TEXT(int NFILE, char **INFILES, char *OUTFILE) {
+
+  // Created Oct 2026
+  // Fast merge of TEXT tables: copy all lines of first file; 
+  // for remaining files, skip header up to VARNAMES key, abort
+  // if VARNAMES list differs from first file, then copy remaining
+  // non-comment lines without parsing values.
+
+  FILE *FP_OUT, *FP ;
+  int  ifile, GZIPFLAG, OPTMASK_NOFILE = 1, NLINE_COPY = 0, len ;
+  bool FOUND_VARNAMES ;
+  char *LINE, *VARLIST_FIRST, *ptr ;
+  char KEY_VARNAMES[] = "VARNAMES:" ;
+  char fnam[] = "MERGE_TEXT" ;
+
+  // ------------ BEGIN --------
+
+  LINE          = (char*)malloc(MXCHAR_LINE_MERGE * sizeof(char));
+  VARLIST_FIRST = (char*)malloc(MXCHAR_LINE_MERGE * sizeof(char));
+  VARLIST_FIRST[0] = 0 ;
+
+  FP_OUT = fopen(OUTFILE, "wt");
+  if ( !FP_OUT ) {
+    sprintf(msgerr1,"Could not open output file");
+    sprintf(msgerr2,"%s", OUTFILE);
+    errmsg(SEV_FATAL, 0, fnam, msgerr1, msgerr2 );
+  }
+
+  for(ifile=0; ifile < NFILE; ifile++ ) {
+    FP = open_TEXTgz(INFILES[ifile], "rt", OPTMASK_NOFILE, &GZIPFLAG, fnam);
+    FOUND_VARNAMES = false ;
+
+    while ( fgets(LINE, MXCHAR_LINE_MERGE, FP) != NULL ) {
+
+      if ( !FOUND_VARNAMES ) {
+	ptr = strstr(LINE,KEY_VARNAMES);
+	if ( ptr != NULL ) {
+	  FOUND_VARNAMES = true ;
+	  len = strlen(ptr);  // remove trailing blanks and <CR>
+	  while ( len > 0 && isspace((unsigned char)ptr[len-1]) ) 
+	    { ptr[--len] = 0; }
+	  if ( ifile == 0 ) 
+	    { sprintf(VARLIST_FIRST, "%s", ptr); }
+	  else if ( strcmp(ptr,VARLIST_FIRST) != 0 ) {
+	    print_preAbort_banner(fnam);
+	    printf("   VARNAMES(file 1): %s\n", VARLIST_FIRST);
+	    printf("   VARNAMES(file %d): %s\n", ifile+1, ptr);
+	    sprintf(msgerr1,"VARNAMES mismatch for");
+	    sprintf(msgerr2,"%s", INFILES[ifile]);
+	    errmsg(SEV_FATAL, 0, fnam, msgerr1, msgerr2 );
+	  }
+	  if ( ifile == 0 ) { fprintf(FP_OUT, "%s\n", ptr); }
+	  continue ;
+	}
+	if ( ifile == 0 ) { fputs(LINE, FP_OUT); }
+	continue ;
+      }
+
+      // data lines: copy as is; skip comments after header
+      if ( LINE[0] == '#' && ifile > 0 ) { continue; }
+      fputs(LINE, FP_OUT);   NLINE_COPY++ ;
+    }
+
+    if ( GZIPFLAG ) { pclose(FP); }  else { fclose(FP); }
+
+    if ( !FOUND_VARNAMES ) {
+      sprintf(msgerr1,"Could not find %s key in", KEY_VARNAMES);
+      sprintf(msgerr2,"%s", INFILES[ifile]);
+      errmsg(SEV_FATAL, 0, fnam, msgerr1, msgerr2 );
+    }
+  }
+
+  fclose(FP_OUT);
+  free(LINE);  free(VARLIST_FIRST);
+
+  printf("\t %s: copied %d lines from %d files.\n", 
+	 fnam, NLINE_COPY, NFILE);
+  fflush(stdout);
+
+  return ;
+
+} // end MERGE_TEXT
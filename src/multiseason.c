@@ -9,6 +9,10 @@
 // physical model and can thus be used for any mult-season
 // sources.
 //
+// Oct 15 2026: seasons are contiguous in the MJD-sorted list, so each
+//   season loops over its own range instead of all NOBS (was 
+//   Nseason x NOBS); work arrays are kept between calls.
+//
 
 
 #include <stdio.h>
@@ -62,6 +66,43 @@ void INIT_MULTISEASON(float *parList) {
 void init_multiseason__(float *parList) { INIT_MULTISEASON(parList); }
 
 
+// ========================================================
+void malloc_MULTISEASON_WORK(int NOBS) {
+
+  // Created Oct 2026
+  // Make sure that work arrays can hold NOBS observations;
+  // arrays only grow, so that typical calls do no malloc.
+
+  int MEMI, MEMD ;
+  // ------------ BEGIN ---------
+
+  if ( NOBS <= MULTISEASON_WORK.NOBS_ALLOC ) { return ; }
+
+  if ( MULTISEASON_WORK.NOBS_ALLOC > 0 ) {
+    free(MULTISEASON_WORK.INDX_SORT);
+    free(MULTISEASON_WORK.INDX_SORT2);
+    free(MULTISEASON_WORK.ISEASON);
+    free(MULTISEASON_WORK.CHI2_LIST);
+    free(MULTISEASON_WORK.chi2_list);
+    free(MULTISEASON_WORK.OBS_LIST);
+    free(MULTISEASON_WORK.obs_list);
+  }
+
+  MEMI = NOBS * sizeof(int);
+  MEMD = NOBS * sizeof(double);
+
+  MULTISEASON_WORK.INDX_SORT  = (int   *) malloc( MEMI ) ;
+  MULTISEASON_WORK.INDX_SORT2 = (int   *) malloc( MEMI ) ;
+  MULTISEASON_WORK.ISEASON    = (int   *) malloc( MEMI ) ;
+  MULTISEASON_WORK.CHI2_LIST  = (double*) malloc( MEMD ) ;
+  MULTISEASON_WORK.chi2_list  = (double*) malloc( MEMD ) ;
+  MULTISEASON_WORK.OBS_LIST   = (int   *) malloc( MEMI ) ;
+  MULTISEASON_WORK.obs_list   = (int   *) malloc( MEMI ) ;
+  MULTISEASON_WORK.NOBS_ALLOC = NOBS ;
+
+} // end malloc_MULTISEASON_WORK
+
+
 // ========================================================
 void GET_MULTISEASON(char *CCID, int NOBS, double *MJD_LIST, 
 		     double *FLUX_LIST, double *FLUXERR_LIST,
@@ -89,6 +130,12 @@ void GET_MULTISEASON(char *CCID, int NOBS, double *MJD_LIST,
   //   + convert float to double
   //   + add new option to compare flux to season-average 
   //     instead of zero.
+  //
+  // Oct 15 2026: 
+  //   + store sorted-obs range per season (ISORT_FIRST/LAST) so that
+  //     each season loops over its own range; same results.
+  //   + obs with FLUXERR <= 0 get ISEASON = -1 (was uninitialized)
+  //   + use MULTISEASON_WORK arrays instead of malloc/free per call.
 
   int   OPT_FLUXREF_ZERO = ( INPUTS.OPTMASK == 1 ) ;
   int   OPT_FLUXREF_AVG  = ( INPUTS.OPTMASK == 2 ) ;
@@ -96,6 +143,7 @@ void GET_MULTISEASON(char *CCID, int NOBS, double *MJD_LIST,
   int   obs, Nobs[MXSEASON], Ndof[MXSEASON] ;
   int   *INDX_SORT, *INDX_SORT2,  *ISEASON;
   int   Nseason, iSeason, i, isort, Ntmp ;
+  int   ISORT_FIRST[MXSEASON], ISORT_LAST[MXSEASON];
   double MJD_LAST, XN, MJD, SNR, CHI2, WGT, SUMCHI2[MXSEASON] ;
   double *CHI2_LIST, *chi2_list, FLUX, ERR, FDIF=0.0, CHI2TMP ;
   double SUMFLUX[MXSEASON], SUMWGT[MXSEASON] ;
@@ -123,18 +171,15 @@ void GET_MULTISEASON(char *CCID, int NOBS, double *MJD_LIST,
   }
 
   // ---------------------------------------------
-  // malloc local arrays
-  int MEMI = NOBS * sizeof(int);
-  int MEMD = NOBS * sizeof(double);
-
-  INDX_SORT  = (int   *) malloc( MEMI ) ;
-  INDX_SORT2 = (int   *) malloc( MEMI ) ;
-  ISEASON    = (int   *) malloc( MEMI ) ;
-  CHI2_LIST  = (double*) malloc( MEMD );
-  chi2_list  = (double*) malloc( MEMD );
-
-  OBS_LIST   = (int*) malloc( MEMI ) ;
-  obs_list   = (int*) malloc( MEMI ) ;
+  // work arrays (grow if needed)
+  malloc_MULTISEASON_WORK(NOBS);
+  INDX_SORT  = MULTISEASON_WORK.INDX_SORT ;
+  INDX_SORT2 = MULTISEASON_WORK.INDX_SORT2 ;
+  ISEASON    = MULTISEASON_WORK.ISEASON ;
+  CHI2_LIST  = MULTISEASON_WORK.CHI2_LIST ;
+  chi2_list  = MULTISEASON_WORK.chi2_list ;
+  OBS_LIST   = MULTISEASON_WORK.OBS_LIST ;
+  obs_list   = MULTISEASON_WORK.obs_list ;
 
   // -----------------------------------------
   // first find season(s) with sorted MJD
@@ -149,6 +194,7 @@ void GET_MULTISEASON(char *CCID, int NOBS, double *MJD_LIST,
     CHI2_LIST[isort]   = 0.0 ;
     REJECT[isort]      = 1 ; // init all to rejected
     OBS_LIST[isort]    = -9;
+    ISEASON[isort]     = -1;
 
     if ( FLUXERR_LIST[isort] <= 0.0 ) { continue ; }
 
@@ -161,10 +207,12 @@ void GET_MULTISEASON(char *CCID, int NOBS, double *MJD_LIST,
     if ( MJD > MJD_LAST + INPUTS.TGAP ) {
       iSeason++ ;      
       MJDMIN[iSeason] = MJD ;
+      ISORT_FIRST[iSeason] = obs ;
     }
     MJD_LAST = MJD ;
     ISEASON[isort]  = iSeason;
     MJDMAX[iSeason] = MJD ;
+    ISORT_LAST[iSeason] = obs ;
     
     // compute weighted avg
     ERR   = FLUXERR_LIST[isort] ;
@@ -201,8 +249,8 @@ void GET_MULTISEASON(char *CCID, int NOBS, double *MJD_LIST,
   
   for(iSeason=0; iSeason < Nseason; iSeason++ ) {
 
-    // build chi2_list for this season
-    for(obs=0; obs < NOBS; obs++ ) {
+    // build chi2_list for this season from its sorted-obs range
+    for(obs=ISORT_FIRST[iSeason]; obs <= ISORT_LAST[iSeason]; obs++ ) {
       isort = INDX_SORT[obs] ;
       if ( iSeason == ISEASON[isort] ) {
 	Nobs[iSeason]++ ;  
@@ -273,15 +321,6 @@ void GET_MULTISEASON(char *CCID, int NOBS, double *MJD_LIST,
     fflush(stdout);
   }
 
-  // ------- cleanup ------
-  free(INDX_SORT);
-  free(INDX_SORT2);
-  free(ISEASON);
-  free(CHI2_LIST);
-  free(chi2_list);
-  free(OBS_LIST);
-  free(obs_list);
-
 } // end of GET_MULTISEASON
 
 
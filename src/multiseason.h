@@ -7,8 +7,16 @@ struct {
   float TGAP ;
 } INPUTS ;
 
+// work arrays kept between calls; realloc only if NOBS increases
+struct {
+  int    NOBS_ALLOC ;
+  int    *INDX_SORT, *INDX_SORT2, *ISEASON, *OBS_LIST, *obs_list ;
+  double *CHI2_LIST, *chi2_list ;
+} MULTISEASON_WORK ;
+
 // ---------------
 
+void malloc_MULTISEASON_WORK(int NOBS);
 void INIT_MULTISEASON(float *parList) ;
 void init_multiseason__(float *parList);
 
@@ -296,6 +296,14 @@
   Jan 10 2024:
     + add vpec=0 as dLmag argument
 
+  Oct 15 2026:
+    + new input DCHI2_PRUNE: after coarse pass, refine & compute
+      evidence only for templates whose coarse min-chi2 is within
+      DCHI2_PRUNE of the best. Default 0 -> no pruning.
+    + grid search uses per-event flux tables (PSNID_MODEL_FLUX) 
+      interpolated once per (shape,z,Tmax,obs); color and dmu enter
+      as multiplicative factors -> no per-grid-point model fill.
+
  ================================================================ */
 
 #include <stdio.h>
@@ -473,6 +481,11 @@ double PSNID_FIRST_MJD;
 double ***PSNID_MODEL_EPOCH, ****PSNID_MODEL_MAG, ****PSNID_MODEL_MAGERR,
   ****PSNID_MODEL_EXTINCT, ****PSNID_MODEL_MWEXTINCT;
 
+// Oct 2026: same grid in flux space (MW extinction included);
+// FLUXERRF = fluxerr/flux, or -1 for undefined model mag.
+double ****PSNID_MODEL_FLUX, ****PSNID_MODEL_FLUXERRF ;
+#define PSNID_MAG2LNFLUX 0.9210340371976183  // 0.4*ln(10)
+
 
 double PSNID_BIGN=1.e30, PSNID_SMALLN=1.e-30, PSNID_SPECZSIG=20.0;
 double PSNID_BASE_COLOR[PSNID_NTYPES];
@@ -559,6 +572,34 @@ PSNID_BEST_RESULTS_DEF PSNID_BEST_RESULTS;
   RESIDS_PSNID_DOFIT_DEF    RESIDS_PSNID_DOFIT[PSNID_NTYPES] ;
 F_RESIDS_PSNID_DOFIT_DEF  F_RESIDS_PSNID_DOFIT ; // for best-type only
 
+
+// Oct 2026: model flux interpolated to each data epoch vs. [Tmax][obs]
+// for fast chi2 in psnid_best_grid_compare.
+typedef struct {
+  int    NPEAK, NOBS ;
+  int    *USE ;        // [obs] 1 -> include in chi2
+  double **FLUX ;      // [ipeak][obs] model flux at base color
+  double **FLUXERRF ;  // [ipeak][obs] model flux-error / flux
+  double **CFAC ;      // [ipeak][obs] color factor for current color
+  double **CSTEP ;     // [ipeak][obs] CFAC multiplier per color step
+} PSNID_FLUXINTERP_DEF ;
+
+void   psnid_best_fluxinterp_alloc(int npeak, int nobs, 
+				   PSNID_FLUXINTERP_DEF *FI);
+void   psnid_best_fluxinterp_free(PSNID_FLUXINTERP_DEF *FI);
+void   psnid_best_fluxinterp_prep(int itype, int d, int z, 
+				  double color0, double dcolor,
+				  int mini, int maxi, double istep,
+				  int nobs, int *useobs, int *data_filt, 
+				  double *data_mjd, double *data_fluxcalerr,
+				  PSNID_FLUXINTERP_DEF *FI);
+void   psnid_best_fluxinterp_colorstep(int mini, int maxi,
+				       PSNID_FLUXINTERP_DEF *FI);
+double psnid_best_chisq_fluxinterp(int ipeak, double ufac, 
+				   double *data_fluxcal, 
+				   double *data_fluxcalerr,
+				   PSNID_FLUXINTERP_DEF *FI, int *ngood);
+
 ///////////////////////////////////////////////////////////////////////////
 
 
@@ -1438,6 +1479,7 @@ void psnid_best_set_grid_values(int typeindex, int *nonia_types)
   double trest1[MXEP_PSNID], mag1[MXEP_PSNID], magerr1[MXEP_PSNID];
   double trest2[MXEP_PSNID], mag2[MXEP_PSNID], magerr2[MXEP_PSNID];
   double color1, color2, redshift, logz, dmdc;
+  double mag, magerr, flux, fluxerr ;
   int nepoch1, nepoch2, optDump=0;
   char fnam[] = "psnid_best_set_grid_values" ;
 
@@ -1517,6 +1559,20 @@ void psnid_best_set_grid_values(int typeindex, int *nonia_types)
 	      PSNID_MODEL_EXTINCT[m][type_count][j][k+1]    = dmdc ;
 	      PSNID_MODEL_MWEXTINCT[m][type_count][j][k+1]  = dmdc ;
 
+	      // Oct 2026: flux table; same validity as calc_chisq
+	      mag    = PSNID_MODEL_MAG[m][type_count][j][k+1] ;
+	      magerr = PSNID_MODEL_MAGERR[m][type_count][j][k+1] ;
+	      if ( mag    < PSNID_GOODMAG_HI    && mag    > PSNID_GOODMAG_LO &&
+		   magerr < PSNID_GOODMAGERR_HI && magerr > PSNID_GOODMAGERR_LO){
+		psnid_pogson2fluxcal(mag, magerr, &flux, &fluxerr);
+		PSNID_MODEL_FLUX[m][type_count][j][k+1]     = flux ;
+		PSNID_MODEL_FLUXERRF[m][type_count][j][k+1] = magerr*.921 ;
+	      }
+	      else {
+		PSNID_MODEL_FLUX[m][type_count][j][k+1]     =  0.0 ;
+		PSNID_MODEL_FLUXERRF[m][type_count][j][k+1] = -1.0 ;
+	      }
+
 	    }
 	  }
 	}
@@ -1791,6 +1847,12 @@ void psnid_best_model_alloc()
   PSNID_MODEL_MWEXTINCT = d4tensor(ONE8,PSNID_NFILTER, ONE8,PSNID_MAXNL, 
 				   ONE8,PSNID_MAXNZ, ONE8,PSNID_MAXND);
 
+  PSNID_MODEL_FLUX      = d4tensor(ONE8,PSNID_NFILTER, ONE8,PSNID_MAXNL, 
+				   ONE8,PSNID_MAXNZ, ONE8,PSNID_MAXND);
+
+  PSNID_MODEL_FLUXERRF  = d4tensor(ONE8,PSNID_NFILTER, ONE8,PSNID_MAXNL, 
+				   ONE8,PSNID_MAXNZ, ONE8,PSNID_MAXND);
+
 
   return;
 }
@@ -1817,6 +1879,12 @@ void psnid_best_model_free()
   free_d4tensor(PSNID_MODEL_MWEXTINCT, ONE8,PSNID_NFILTER, ONE8,
 		PSNID_MAXNL, ONE8, PSNID_MAXNZ, ONE8,PSNID_MAXND);
 
+  free_d4tensor(PSNID_MODEL_FLUX, ONE8,PSNID_NFILTER, ONE8,
+		PSNID_MAXNL, ONE8, PSNID_MAXNZ, ONE8,PSNID_MAXND);
+
+  free_d4tensor(PSNID_MODEL_FLUXERRF, ONE8,PSNID_NFILTER, ONE8,
+		PSNID_MAXNL, ONE8, PSNID_MAXNZ, ONE8,PSNID_MAXND);
+
 
   return;
 }
@@ -1955,6 +2023,12 @@ void psnid_best_grid_compare(int itype, int zpind, int nobs,
   double ZPRIOR, ZPRIOR_ERR, DZ, ZSIG ;
   int    DOPRIOR_ZSPEC, DOPRIOR_ZPHOT, optDebug, NON1A_INDEX, isp;
   int    AWID, ZWID, ZRBN, ARBN, UWID, URBN, indTmp ;
+  double DCHI2_PRUNE = PSNID_INPUTS.DCHI2_PRUNE ;
+  double *chisqlo_shape, chisqlo_coarse = PSNID_BIGN ;
+  int    DO_PRUNE = ( DCHI2_PRUNE > 0.0 ) ;
+  int    USE_FLUXINTERP ;
+  double ufac, color0, dcolor ;
+  PSNID_FLUXINTERP_DEF FLUXINTERP ;
 
   //  char fnam[] = "psnid_best_grid_compare" ;
 
@@ -1974,6 +2048,9 @@ void psnid_best_grid_compare(int itype, int zpind, int nobs,
   psnid_best_get_z_grid(z_grid);
   psnid_best_get_u_grid(u_grid);
 
+  // min chi2 per shape/template from coarse pass (Oct 2026)
+  chisqlo_shape = dvector(1,PSNID_MAXNL);
+  for (d = 1; d <= PSNID_MAXNL; d++ ) { chisqlo_shape[d] = PSNID_BIGN; }
 
   hunt(z_grid, PSNID_MAXNZ, PSNID_BEST_RESULTS.ZPRIOR[zpind], &this_z);
   // z_grid[this_z] <= PSNID_BEST_RESULTS.ZPRIOR[zpind] < z_grid[this_z+1]
@@ -2227,6 +2304,14 @@ void psnid_best_grid_compare(int itype, int zpind, int nobs,
     fflush(stdout);
     */
 
+    // Oct 2026: grid passes use flux tables interpolated once per
+    // (z,d,Tmax,obs); debug pass (ipass > NITER) uses mag arrays.
+    USE_FLUXINTERP = ( ipass <= PSNID_NITER ) ;
+    if ( USE_FLUXINTERP ) 
+      { psnid_best_fluxinterp_alloc(maxi, nobs, &FLUXINTERP); }
+    color0 = c_grid[mina] - PSNID_BASE_COLOR[itype] ;
+    dcolor = PSNID_ASTEP * (double)astep ;
+
     /**********************************************************/
     /*****  compare data with grid of light curve models  *****/
     /**********************************************************/
@@ -2248,6 +2333,7 @@ void psnid_best_grid_compare(int itype, int zpind, int nobs,
       for (u = minu; u <= maxu; u = u + ustep) {      // dmu
 	chisqlozu = PSNID_BIGN;
 	ushift = u_grid[u];
+	ufac   = exp(-PSNID_MAG2LNFLUX*ushift) ;
 	// for Ia opton, set ushift=0 (9/15/2017)
 
 	for (d = mind; d <= maxd; d = d + dstep) {    // shapepar
@@ -2261,35 +2347,56 @@ void psnid_best_grid_compare(int itype, int zpind, int nobs,
 	      { continue ; }
 	  } // end AVOID_SIMCHEAT
 
+	  // skip templates far from best coarse-pass chi2 (Oct 2026)
+	  if ( DO_PRUNE && ipass > 0 && ipass <= PSNID_NITER ) {
+	    if ( chisqlo_shape[d] > chisqlo_coarse + DCHI2_PRUNE ) 
+	      { continue ; }
+	  }
+
+	  if ( USE_FLUXINTERP ) {
+	    psnid_best_fluxinterp_prep(itype, d, z, color0, dcolor,
+				       mini, maxi, istep, nobs, useobs, 
+				       data_filt, data_mjd, data_fluxcalerr,
+				       &FLUXINTERP);
+	  }
+
 
 	  for (a = mina; a <= maxa; a = a + astep) {  // colorpar
 
 	    for (i = mini; i <= maxi; i++) {           // peak MJD (RK fix?)
 	      //   for (i = mini; i < maxi; i++) {  // peak MJD (bug?)
 
-	      // shift model along time axis
-	      peak_guess   = PSNID_PEAK_START + i*istep;
-	      for (t = 1; t <= PSNID_MAXND; t++) {
-		fit_epoch[t] = PSNID_MODEL_EPOCH[d][z][t] + peak_guess;
-		for (f = 1; f <= PSNID_NFILTER; f++) {
-		  // apply extinction and dmu
-		  fit_mag[f][t]    = PSNID_MODEL_MAG[f][d][z][t] -
-		    (c_grid[a]-PSNID_BASE_COLOR[itype])*PSNID_MODEL_EXTINCT[f][d][z][t] + ushift;
-		  fit_magerr[f][t] = PSNID_MODEL_MAGERR[f][d][z][t];
-		}
+	      chisq = 0.0;
+	      ngood = 0;
+
+	      if ( USE_FLUXINTERP ) {
+		chisq = psnid_best_chisq_fluxinterp(i, ufac, data_fluxcal,
+						    data_fluxcalerr,
+						    &FLUXINTERP, &ngood);
 	      }
+	      else {
+		// shift model along time axis
+		peak_guess   = PSNID_PEAK_START + i*istep;
+		for (t = 1; t <= PSNID_MAXND; t++) {
+		  fit_epoch[t] = PSNID_MODEL_EPOCH[d][z][t] + peak_guess;
+		  for (f = 1; f <= PSNID_NFILTER; f++) {
+		    // apply extinction and dmu
+		    fit_mag[f][t]    = PSNID_MODEL_MAG[f][d][z][t] -
+		      (c_grid[a]-PSNID_BASE_COLOR[itype])*PSNID_MODEL_EXTINCT[f][d][z][t] + ushift;
+		    fit_magerr[f][t] = PSNID_MODEL_MAGERR[f][d][z][t];
+		  }
+		}
 	      
-	      optDebug = (ipass > PSNID_NITER && itype == 0 ) ; 
+		optDebug = (ipass > PSNID_NITER && itype == 0 ) ; 
 
-	      // calculate chi-squared between data and model
-	      chisq = 0.0;
-	      ngood = 0;
-	      //	      printf("\t z,d,a,i = %d %d %d %d  peak_mjd = %10.2f\n",
-	      //		     z,d,a,i, peak_guess);
-	      psnid_best_calc_chisq(nobs, useobs, data_filt,
-				    data_mjd, data_fluxcal, data_fluxcalerr,
-				    fit_epoch, fit_mag, fit_magerr,
-				    &ngood, &chisq, optDebug, 0);
+		// calculate chi-squared between data and model
+		//              printf("\t z,d,a,i = %d %d %d %d  peak_mjd = %10.2f\n",
+		//                     z,d,a,i, peak_guess);
+		psnid_best_calc_chisq(nobs, useobs, data_filt,
+				      data_mjd, data_fluxcal, data_fluxcalerr,
+				      fit_epoch, fit_mag, fit_magerr,
+				      &ngood, &chisq, optDebug, 0);
+	      } // end USE_FLUXINTERP
 
 	      //////////////////////////
 	      //  PRIORS
@@ -2343,14 +2450,23 @@ void psnid_best_grid_compare(int itype, int zpind, int nobs,
 	      if (chisq < chisqlozu) {   // min chi-sq for this z and dmu
 		chisqlozu = chisq;
 	      }
+	      if ( ipass == 0 && chisq < chisqlo_shape[d] ) {
+		chisqlo_shape[d] = chisq;
+	      }
+
+	    } // end i loop over Tmax
+
+	    if ( USE_FLUXINTERP ) 
+	      { psnid_best_fluxinterp_colorstep(mini, maxi, &FLUXINTERP); }
 
-	    }
 	  }
 	}
       }
     }
     /**********************************************************/
 
+    if ( USE_FLUXINTERP ) { psnid_best_fluxinterp_free(&FLUXINTERP); }
+
     // zero index is not allowed
     psnid_best_check_ind_bounds(ipass, itype, ind);
 
@@ -2389,6 +2505,7 @@ void psnid_best_grid_compare(int itype, int zpind, int nobs,
     */
 
     PSNID_BEST_RESULTS.MINCHISQ[zpind][itype] = chisqlo;
+    if ( ipass == 0 ) { chisqlo_coarse = chisqlo; }
     //  if (ipass == PSNID_NITER)
     //    printf("COMMENT: chisqlo = %8.2f;   ngood = %3d\n", chisqlo, ngood);
 
@@ -2481,13 +2598,148 @@ void psnid_best_grid_compare(int itype, int zpind, int nobs,
   free_dvector(c_grid, 1,PSNID_MAXNA);
   free_dvector(z_grid, 1,PSNID_MAXNZ);
   free_dvector(u_grid, 1,PSNID_MAXNU);
-
+  free_dvector(chisqlo_shape, 1,PSNID_MAXNL);
 
   return;
 }
 // end of psnid_best_grid_compare
 
 
+/**********************************************************************/
+void psnid_best_fluxinterp_alloc(int npeak, int nobs, 
+				 PSNID_FLUXINTERP_DEF *FI) {
+
+  // Created Oct 2026
+  // Allocate [1..npeak][0..nobs-1] arrays for flux interpolation.
+
+  FI->NPEAK    = npeak ;
+  FI->NOBS     = nobs ;
+  FI->USE      = ivector(0,nobs);
+  FI->FLUX     = dmatrix(1,npeak, 0,nobs);
+  FI->FLUXERRF = dmatrix(1,npeak, 0,nobs);
+  FI->CFAC     = dmatrix(1,npeak, 0,nobs);
+  FI->CSTEP    = dmatrix(1,npeak, 0,nobs);
+
+} // end psnid_best_fluxinterp_alloc
+
+void psnid_best_fluxinterp_free(PSNID_FLUXINTERP_DEF *FI) {
+  int npeak = FI->NPEAK, nobs = FI->NOBS ;
+  free_ivector(FI->USE, 0,nobs);
+  free_dmatrix(FI->FLUX,     1,npeak, 0,nobs);
+  free_dmatrix(FI->FLUXERRF, 1,npeak, 0,nobs);
+  free_dmatrix(FI->CFAC,     1,npeak, 0,nobs);
+  free_dmatrix(FI->CSTEP,    1,npeak, 0,nobs);
+} // end psnid_best_fluxinterp_free
+
+
+/**********************************************************************/
+void psnid_best_fluxinterp_prep(int itype, int d, int z, 
+				double color0, double dcolor,
+				int mini, int maxi, double istep,
+				int nobs, int *useobs, int *data_filt, 
+				double *data_mjd, double *data_fluxcalerr,
+				PSNID_FLUXINTERP_DEF *FI) {
+
+  // Created Oct 2026
+  // For shape index d and redshift index z, interpolate the flux 
+  // tables (PSNID_MODEL_FLUX[ERRF]) and extinction (dmag/dcolor)
+  // to each data epoch for each Tmax index i = mini..maxi.
+  // Color enters as flux factor exp(0.921*color*EXT), with
+  //   CFAC  = factor for first color bin (color0 = c - c_base)
+  //   CSTEP = factor per color-grid step (dcolor)
+  // so that the color loop in grid_compare is pure multiplication.
+  //
+  // Matches psnid_best_calc_chisq except that interpolation in Tobs 
+  // is linear in flux instead of mag, and model-mag validity is
+  // checked before (instead of after) color & dmu shifts.
+
+  double *EPOCH = PSNID_MODEL_EPOCH[d][z] ;
+  int    NDAY   = PSNID_MAXND ;
+  int    t, f, i, this_filt, jlo = 1 ;
+  double peak, tobs, tFrac, ext, *FLUX, *ERRF, *EXT ;
+
+  // ----------- BEGIN -----------
+
+  for (t = 0; t < nobs; t++) {
+    f         = data_filt[t] + 1 ;
+    this_filt = PSNID_INPUTS.IFILTLIST[f-1];
+    FI->USE[t] = ( PSNID_INPUTS.USEFILT[this_filt] == 1 && 
+		   useobs[t] == 1 && data_fluxcalerr[t] > 0.0 ) ;
+    if ( !FI->USE[t] ) { continue ; }
+
+    FLUX = PSNID_MODEL_FLUX[f][d][z] ;
+    ERRF = PSNID_MODEL_FLUXERRF[f][d][z] ;
+    EXT  = PSNID_MODEL_EXTINCT[f][d][z] ;
+
+    for (i = mini; i <= maxi; i++) {
+      peak = PSNID_PEAK_START + i*istep ;
+      tobs = data_mjd[t] - peak ;
+
+      FI->FLUX[i][t] = FI->FLUXERRF[i][t] = 0.0 ;
+      FI->CFAC[i][t] = FI->CSTEP[i][t]    = 1.0 ;
+
+      if ( tobs < EPOCH[1] || tobs >= EPOCH[NDAY] ) { continue ; }
+
+      hunt(EPOCH, NDAY, tobs, &jlo);
+      if ( ERRF[jlo] < 0.0 || ERRF[jlo+1] < 0.0 ) { continue ; }
+
+      tFrac = (tobs - EPOCH[jlo]) / (EPOCH[jlo+1] - EPOCH[jlo]) ;
+      ext   = EXT[jlo] + (EXT[jlo+1] - EXT[jlo]) * tFrac ;
+      FI->FLUX[i][t]     = FLUX[jlo] + (FLUX[jlo+1] - FLUX[jlo]) * tFrac ;
+      FI->FLUXERRF[i][t] = ERRF[jlo] + (ERRF[jlo+1] - ERRF[jlo]) * tFrac ;
+      FI->CFAC[i][t]     = exp(PSNID_MAG2LNFLUX * color0 * ext) ;
+      FI->CSTEP[i][t]    = exp(PSNID_MAG2LNFLUX * dcolor * ext) ;
+    }
+  }
+
+} // end psnid_best_fluxinterp_prep
+
+
+/**********************************************************************/
+void psnid_best_fluxinterp_colorstep(int mini, int maxi,
+				     PSNID_FLUXINTERP_DEF *FI) {
+  // Created Oct 2026
+  // Advance color factor to next color-grid bin.
+  int i, t, nobs = FI->NOBS ;
+  for (i = mini; i <= maxi; i++) {
+    for (t = 0; t < nobs; t++ ) { FI->CFAC[i][t] *= FI->CSTEP[i][t]; }
+  }
+} // end psnid_best_fluxinterp_colorstep
+
+
+/**********************************************************************/
+double psnid_best_chisq_fluxinterp(int ipeak, double ufac, 
+				   double *data_fluxcal, 
+				   double *data_fluxcalerr,
+				   PSNID_FLUXINTERP_DEF *FI, int *ngood) {
+
+  // Created Oct 2026
+  // Return chi2 for Tmax index ipeak using interpolated model fluxes
+  // from psnid_best_fluxinterp_prep; color factor is CFAC and 
+  // ufac = 10^(-0.4*dmu). Increment *ngood by number of obs used.
+
+  int    t, nobs = FI->NOBS, count = 0 ;
+  double *FLUX = FI->FLUX[ipeak],  *ERRF  = FI->FLUXERRF[ipeak] ;
+  double *CFAC = FI->CFAC[ipeak] ;
+  double chisq = 0.0, model_flux, model_fluxe, FDIF, SQFERR ;
+
+  for (t = 0; t < nobs; t++) {
+    if ( !FI->USE[t] ) { continue ; }
+    model_flux  = FLUX[t] * CFAC[t] * ufac ;
+    model_fluxe = model_flux * ERRF[t] ;
+    FDIF        = model_flux - data_fluxcal[t] ;
+    SQFERR      = model_fluxe*model_fluxe + 
+      data_fluxcalerr[t]*data_fluxcalerr[t] ;
+    chisq      += (FDIF*FDIF) / SQFERR ;
+    count++ ;
+  }
+
+  *ngood += count ;
+  return chisq ;
+
+} // end psnid_best_chisq_fluxinterp
+
+
 
 /**********************************************************************/
 void psnid_best_calc_chisq(int nobs, int *useobs,
@@ -5878,6 +6130,7 @@ void  psnid_best_malloc_resids(void) {
 
 
 
+
 // *****************************************************
 void psnid_best_define_TableVARNAMES(int DO_ADDCOL ) {
 
@@ -232,6 +232,10 @@ void PSNID_USER_INPUT(int NVAR, double *input_array, char *input_string ) {
     PSNID_INPUTS.ZRATEPRIOR_NONIA[i] = dval ; 
   }
 
+  // Oct 2026: template pruning after coarse grid pass
+  ivar++ ; dval = input_array[ivar];
+  PSNID_INPUTS.DCHI2_PRUNE = dval ;
+
   // -----------------------------------------------
   // break the input string into separate words
   //  printf(" xxx input_string = '%s' \n", input_string);
@@ -360,6 +364,11 @@ void PSNID_USER_INPUT(int NVAR, double *input_array, char *input_string ) {
            PSNID_INPUTS.CHISQMIN_OUTLIER,
            PSNID_INPUTS.NREJECT_OUTLIER);
 
+    if ( PSNID_INPUTS.DCHI2_PRUNE > 0.0 ) {
+      printf("\t Input DCHI2_PRUNE = %.1f (prune templates after "
+	     "coarse pass)\n", PSNID_INPUTS.DCHI2_PRUNE);
+    }
+
     printf("\n" ) ;
     fflush(stdout);
 
@@ -565,7 +574,9 @@ void PSNID_READ_TEMPLATES(int TYPEINDX, char *file ) {
   // $SNDATA_ROOT/models/psnid.
 
   FILE *fp;
-  int OPT_READ = 1; // 1-> verbose mode
+  // verbose mode, and mmap grid mag/err arrays so that concurrent 
+  // jobs share one copy (Oct 2026)
+  int OPT_READ = OPTMASK_SNGRID_VERBOSE + OPTMASK_SNGRID_MMAP ;
   int gzipFlag ;
   char FILE[200], *ptrFile ;
   char fnam[] = "PSNID_READ_TEMPLATES";
@@ -141,6 +141,8 @@ struct  PSNID_INPUTS  {
   double TMAX_STOP[MXITER_PSNID];
   double TMAX_STEP[MXITER_PSNID];
 
+  double DCHI2_PRUNE ;  // skip templates with coarse chi2 > best+DCHI2_PRUNE
+
   // quantities below are computed from the raw input above
 
   int  NFILT;                  // number of filters to fit
@@ -7,6 +7,9 @@
 //
 // [moved out of snlc_sim.c on Nov 19 2022]
 //
+// Oct 15 2026: UNIT_TEST BENCH[_XXX] runs microbenchmarks for
+//   genmag kernels after init_genmodel; see bench_driver.
+//
 //
 
 // ================================================
@@ -28,6 +31,13 @@ void test_PARSE_WORDS(void);
 void test_zcmb_dLmag_invert(void);
 
 void test_getRan_funVal(char *FUNVAL_NAME);
+
+void bench_driver(char *UNIT_TEST_NAME);
+void bench_genmag(void);
+void bench_GRIDMAP(void);
+void bench_GALextinct(void);
+void bench_genSmear(void);
+void bench_summary(char *kernel, long long NCALL, double t_sum, double chksum);
 void load_test_GENGAUSS(GENGAUSS_ASYM_DEF *GENGAUSS );
 void load_test_GENEXP(GEN_EXP_HALFGAUSS_DEF *GENEXP);
 
@@ -38,6 +48,11 @@ char TEST_LEGACY[] = "LEGACY";
 #define STRING_FUNVAL_GENEXP       "FUNVAL_GENEXP"
 #define STRING_FUNVAL_GENPDF       "FUNVAL_GENPDF"
 
+#define STRING_BENCH               "BENCH"
+#define TMIN_BENCH          2.0    // min seconds per kernel benchmark
+#define NCALL_CHECK_BENCH   64     // check elapsed time every N calls
+#define IDGRIDMAP_BENCH     99
+
 // ************************
 
 
@@ -55,6 +70,9 @@ void unit_test_driver(char *UNIT_TEST_NAME) {
   else if ( strstr(UNIT_TEST_NAME,"FUNVAL") != NULL ) 
     { test_getRan_funVal(UNIT_TEST_NAME); }
 
+  else if ( strstr(UNIT_TEST_NAME,STRING_BENCH) != NULL ) 
+    { return; } // bench_driver is called after init_genmodel
+
   else {
     sprintf(c1err,"Undefined UNIT_TEST: %s", UNIT_TEST_NAME);
     sprintf(c2err,"Check UNIT_TEST key in sim-input file");
@@ -485,6 +503,21 @@ void test_igm(void) {
 	   lrest, z_a, tau_a,  z_b, tau_b) ;
     fflush(stdout);
   }
+
+  // Oct 2026: compare tabulated vector API with direct calculation
+  int    NLAM = 0 ;
+  double LOBS_LIST[20], TRANS_LIST[20];
+  init_IGM_TABLE_Inoue(0.0, 10.0, 0.01, 100.0, 1.0);
+  z = z_b;
+  for (ilam=500; ilam <=1500; ilam+=100 ) 
+    { LOBS_LIST[NLAM] = (double)ilam * (1.0+z);  NLAM++ ; }
+  get_IGM_trans_Inoue(z, NLAM, LOBS_LIST, TRANS_LIST);
+  for (ilam=0; ilam < NLAM; ilam++ ) {
+    lobs = LOBS_LIST[ilam];
+    printf(" xxx lobs=%7.0f trans(z=%.1f): table=%le  direct=%le\n",
+	   lobs, z, TRANS_LIST[ilam], exp(-tau_Inoue(z,lobs)) );
+  }
+  fflush(stdout);
   
   exit(1);
 
@@ -781,3 +814,297 @@ void load_test_GENEXP(GEN_EXP_HALFGAUSS_DEF *GENEXP) {
   return ;
 
 } // end load_test_GENEXP
+
+
+// ==============================================
+void bench_driver(char *UNIT_TEST_NAME) {
+
+  // Created Oct 2026
+  // Microbenchmarks for genmag kernels, called after init_genmodel
+  // so that the GENMODEL in the sim-input file is ready. Each kernel
+  // is called with synthetic inputs for at least TMIN_BENCH seconds,
+  // and ns/call and calls/sec are printed. Options:
+  //   UNIT_TEST: BENCH           ! all kernels
+  //   UNIT_TEST: BENCH_GENMAG    ! genmag_[SALT2,BAYESN,SIMSED]
+  //   UNIT_TEST: BENCH_GRIDMAP   ! interp_GRIDMAP on 2D map
+  //   UNIT_TEST: BENCH_GALEXT    ! GALextinct for a few color laws
+  //   UNIT_TEST: BENCH_GENSMEAR  ! get_genSmear (if GENMAG_SMEAR_MODELNAME)
+
+  bool DOALL ;
+  char fnam[] = "bench_driver" ;
+
+  // ------ BEGIN ----------
+
+  if ( strstr(UNIT_TEST_NAME,STRING_BENCH) == NULL ) { return; }
+
+  print_banner(fnam);
+  printf("\t %-28s %12s %12s %14s   %s\n",
+	 "KERNEL", "NCALL", "NSEC/CALL", "CALLS/SEC", "CHECKSUM");
+  fflush(stdout);
+
+  DOALL = ( strcmp(UNIT_TEST_NAME,STRING_BENCH) == 0 );
+
+  if ( DOALL || strcmp(UNIT_TEST_NAME,"BENCH_GENMAG")   == 0 ) 
+    { bench_genmag(); }
+  if ( DOALL || strcmp(UNIT_TEST_NAME,"BENCH_GRIDMAP")  == 0 ) 
+    { bench_GRIDMAP(); }
+  if ( DOALL || strcmp(UNIT_TEST_NAME,"BENCH_GALEXT")   == 0 ) 
+    { bench_GALextinct(); }
+  if ( DOALL || strcmp(UNIT_TEST_NAME,"BENCH_GENSMEAR") == 0 ) 
+    { bench_genSmear(); }
+
+  printf("\n - - - Done with %s benchmarks - - - \n", UNIT_TEST_NAME);
+  fflush(stdout);
+  exit(0);
+
+} // end bench_driver
+
+
+// ==============================================
+void bench_summary(char *kernel, long long NCALL, double t_sum, double chksum) {
+
+  // Created Oct 2026
+  // print one line of benchmark results.
+
+  double nsec_per_call = 1.0E9 * t_sum / (double)NCALL ;
+  double calls_per_sec = (double)NCALL / t_sum ;
+
+  printf("\t %-28s %12lld %12.1f %14.1f   %le\n",
+	 kernel, NCALL, nsec_per_call, calls_per_sec, chksum);
+  fflush(stdout);
+
+} // end bench_summary
+
+
+// ==============================================
+void bench_genmag(void) {
+
+  // Created Oct 2026
+  // Time genmag function for SALT2, BAYESN or SIMSED model,
+  // one filter & NOBS epochs per call. Redshift is varied per call
+  // so that model caches do not short-circuit the calculation.
+
+#define NOBS_BENCH 20
+  int    ifilt_obs = INPUTS.IFILTMAP_OBS[0] ;
+  int    OPTMASK   = 0, iobs, TEMPLATE_INDEX ;
+  long long NCALL  = 0 ;
+  double Tobs_list[NOBS_BENCH], mag_list[NOBS_BENCH], magerr_list[NOBS_BENCH];
+  double mwebv = 0.02, z, t0, t1, chksum=0.0 ;
+  char   kernel[60], kernel_band[80];
+
+  // ------ BEGIN ----------
+
+  for(iobs=0; iobs < NOBS_BENCH; iobs++ ) 
+    { Tobs_list[iobs] = -15.0 + 3.0*(double)iobs ; }
+
+  // model-specific inputs
+  double parList_SN[5]   = { 1.0E-4, 0.0, 0.0, 0.0, 0.0 } ;
+  double parList_HOST[MXHOSTPAR_PySEDMODEL] ;
+  double lumipar[MXPAR_SIMSED];
+  int    ipar, ised_mid ;
+
+  for(ipar=0; ipar < MXHOSTPAR_PySEDMODEL; ipar++ ) 
+    { parList_HOST[ipar] = 0.0 ; }
+  parList_HOST[0] = 3.1; parList_HOST[1] = 0.1; parList_HOST[2] = 10.0 ;
+
+  if ( INDEX_GENMODEL == MODEL_SALT2 ) 
+    { sprintf(kernel,"genmag_SALT2"); }
+  else if ( INDEX_GENMODEL == MODEL_BAYESN ) {
+    sprintf(kernel,"genmag_BAYESN"); 
+    parList_SN[0] = 40.0 ; // DLMU
+    parList_SN[1] =  0.0 ; // THETA
+    parList_SN[2] =  0.1 ; // AV
+    parList_SN[3] =  3.1 ; // RV
+  }
+  else if ( INDEX_GENMODEL == MODEL_SIMSED ) {
+    sprintf(kernel,"genmag_SIMSED"); 
+    ised_mid = SEDMODEL.NSURFACE/2 + 1 ;
+    for(ipar=0; ipar < INPUTS.NPAR_SIMSED; ipar++ ) {
+      lumipar[ipar] = 
+	SEDMODEL.PARVAL[ised_mid][GENLC.SIMSED_IPARMAP[ipar]] ;
+    }
+  }
+  else {
+    printf("\t %-28s   (skip: GENMODEL=%s has no genmag benchmark)\n",
+	   "genmag", INPUTS.MODELNAME);
+    return ;
+  }
+  sprintf(kernel_band,"%s(%c)", kernel, FILTERSTRING[ifilt_obs]) ;
+
+  t0 = get_wallTime_sec(); t1 = t0 ;
+  while ( t1 - t0 < TMIN_BENCH ) {
+
+    z = 0.1 + 0.4 * (double)(NCALL % 1000) / 1000.0 ;
+
+    if ( INDEX_GENMODEL == MODEL_SALT2 ) {
+      genmag_SALT2(OPTMASK, ifilt_obs, parList_SN, parList_HOST, 
+		   mwebv, z, z, NOBS_BENCH, Tobs_list, 
+		   mag_list, magerr_list);
+    }
+    else if ( INDEX_GENMODEL == MODEL_BAYESN ) {
+      genmag_BAYESN(OPTMASK, ifilt_obs, parList_SN, parList_HOST, 
+		    mwebv, z, NOBS_BENCH, Tobs_list, 
+		    mag_list, magerr_list);
+    }
+    else {
+      genmag_SIMSED(OPTMASK + INPUTS.OPTMASK_SIMSED, ifilt_obs, 1.0,
+		    INPUTS.NPAR_SIMSED, INPUTS.GENFLAG_SIMSED, 
+		    GENLC.SIMSED_IPARMAP, lumipar, 3.1, 0.1, 
+		    mwebv, z, NOBS_BENCH, Tobs_list, 
+		    mag_list, magerr_list, &TEMPLATE_INDEX);
+    }
+
+    chksum += mag_list[NOBS_BENCH/2] ;
+    NCALL++ ;
+    if ( NCALL % NCALL_CHECK_BENCH == 0 ) { t1 = get_wallTime_sec(); }
+  }
+  t1 = get_wallTime_sec();
+
+  bench_summary(kernel_band, NCALL, t1-t0, chksum);
+
+  return ;
+
+} // end bench_genmag
+
+
+// ==============================================
+void bench_GRIDMAP(void) {
+
+  // Created Oct 2026
+  // Time interp_GRIDMAP on synthetic 2D map with NBIN x NBIN grid
+  // (typical size of GENPDF and HOSTLIB weight maps).
+
+#define NBIN_GRIDMAP_BENCH 50
+  int    NBIN = NBIN_GRIDMAP_BENCH, MAPSIZE = NBIN*NBIN ;
+  int    NDIM = 2, NFUN = 1, i, j, ibin ;
+  long long NCALL = 0 ;
+  double **GRIDMAP_INPUT, **GRIDFUN_INPUT, x[2], fun, t0, t1, chksum=0.0 ;
+  GRIDMAP_DEF GRIDMAP ;
+
+  // ------ BEGIN ----------
+
+  GRIDMAP_INPUT    = (double**)malloc(NDIM*sizeof(double*));
+  GRIDMAP_INPUT[0] = (double*) malloc(MAPSIZE*sizeof(double));
+  GRIDMAP_INPUT[1] = (double*) malloc(MAPSIZE*sizeof(double));
+  GRIDFUN_INPUT    = (double**)malloc(NFUN*sizeof(double*));
+  GRIDFUN_INPUT[0] = (double*) malloc(MAPSIZE*sizeof(double));
+
+  ibin = 0 ;
+  for(i=0; i < NBIN; i++ ) {
+    for(j=0; j < NBIN; j++ ) {
+      GRIDMAP_INPUT[0][ibin] = (double)i / (double)(NBIN-1) ;
+      GRIDMAP_INPUT[1][ibin] = (double)j / (double)(NBIN-1) ;
+      GRIDFUN_INPUT[0][ibin] = 
+	exp(-GRIDMAP_INPUT[0][ibin]) * cos(GRIDMAP_INPUT[1][ibin]) ;
+      ibin++ ;
+    }
+  }
+
+  init_interp_GRIDMAP(IDGRIDMAP_BENCH, "BENCH", MAPSIZE, NDIM, NFUN, 0,
+		      GRIDMAP_INPUT, GRIDFUN_INPUT, &GRIDMAP );
+
+  t0 = get_wallTime_sec(); t1 = t0 ;
+  while ( t1 - t0 < TMIN_BENCH ) {
+    x[0] = (double)(NCALL % 997) / 997.0 ;
+    x[1] = (double)(NCALL % 991) / 991.0 ;
+    interp_GRIDMAP(&GRIDMAP, x, &fun);
+    chksum += fun ;
+    NCALL++ ;
+    if ( NCALL % NCALL_CHECK_BENCH == 0 ) { t1 = get_wallTime_sec(); }
+  }
+  t1 = get_wallTime_sec();
+
+  bench_summary("interp_GRIDMAP(2D,50x50)", NCALL, t1-t0, chksum);
+
+  free(GRIDMAP_INPUT[0]); free(GRIDMAP_INPUT[1]); free(GRIDMAP_INPUT);
+  free(GRIDFUN_INPUT[0]); free(GRIDFUN_INPUT);
+
+  return ;
+
+} // end bench_GRIDMAP
+
+
+// ==============================================
+void bench_GALextinct(void) {
+
+  // Created Oct 2026
+  // Time GALextinct for CCM89, O'Donnell94 and Fitzpatrick99,
+  // scanning wavelength from 2000 to 12000 A.
+
+#define NOPT_GALEXT_BENCH 3
+  int    OPT_LIST[NOPT_GALEXT_BENCH] = { 89, 94, 99 } ;
+  int    iopt, OPT ;
+  long long NCALL ;
+  double RV = 3.1, AV = 0.3, WAVE, XT, t0, t1, chksum ;
+  double PARLIST[10] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+  char   kernel[60];
+  char fnam[] = "bench_GALextinct" ;
+
+  // ------ BEGIN ----------
+
+  for(iopt=0; iopt < NOPT_GALEXT_BENCH; iopt++ ) {
+    OPT = OPT_LIST[iopt];  NCALL = 0;  chksum = 0.0 ;
+    t0  = get_wallTime_sec(); t1 = t0 ;
+    while ( t1 - t0 < TMIN_BENCH ) {
+      WAVE = 2000.0 + (double)(NCALL % 10000) ;
+      XT   = GALextinct(RV, AV, WAVE, OPT, PARLIST, fnam);
+      chksum += XT ;
+      NCALL++ ;
+      if ( NCALL % NCALL_CHECK_BENCH == 0 ) { t1 = get_wallTime_sec(); }
+    }
+    t1 = get_wallTime_sec();
+    sprintf(kernel,"GALextinct(OPT=%d)", OPT);
+    bench_summary(kernel, NCALL, t1-t0, chksum);
+  }
+
+  return ;
+
+} // end bench_GALextinct
+
+
+// ==============================================
+void bench_genSmear(void) {
+
+  // Created Oct 2026
+  // Time get_genSmear for the intrinsic-scatter model in the
+  // sim-input file (GENMAG_SMEAR_MODELNAME), NLAM wave bins per call.
+  // Trest changes every call so that the repeat-check does not
+  // skip the calculation.
+
+#define NLAM_GENSMEAR_BENCH 100
+  int    NLAM = NLAM_GENSMEAR_BENCH, ilam ;
+  long long NCALL = 0 ;
+  double LAM[NLAM_GENSMEAR_BENCH], magSmear[NLAM_GENSMEAR_BENCH];
+  double parList[4] = { 0.0, 0.0, 0.0, 10.0 } ; // Trest, x1, c, logMass
+  double t0, t1, chksum = 0.0 ;
+  char   kernel[100];
+
+  // ------ BEGIN ----------
+
+  if ( GENSMEAR.NUSE == 0 ) {
+    printf("\t %-28s   (skip: no GENMAG_SMEAR_MODELNAME)\n", 
+	   "get_genSmear");
+    return ;
+  }
+
+  for(ilam=0; ilam < NLAM; ilam++ ) 
+    { LAM[ilam] = 3000.0 + 60.0*(double)ilam ; }
+
+  genran_modelSmear(); 
+
+  t0 = get_wallTime_sec(); t1 = t0 ;
+  while ( t1 - t0 < TMIN_BENCH ) {
+    parList[0] = -15.0 + (double)(NCALL % 600)/10.0 ; // Trest
+    get_genSmear(parList, NLAM, LAM, magSmear);
+    chksum += magSmear[NLAM/2] ;
+    NCALL++ ;
+    if ( NCALL % NCALL_CHECK_BENCH == 0 ) { t1 = get_wallTime_sec(); }
+  }
+  t1 = get_wallTime_sec();
+
+  sprintf(kernel,"get_genSmear(%s)", INPUTS.GENMAG_SMEAR_MODELNAME);
+  bench_summary(kernel, NCALL, t1-t0, chksum);
+
+  return ;
+
+} // end bench_genSmear
@@ -61,6 +61,9 @@
     simlib_coadd <simlib_file> --SIMLIB_COADD_FILE <file name>
            (default file name is <simlib_file>.COADD
 
+    simlib_coadd <simlib_file> STREAM (single-pass coadd per band;
+         no sort if MJDs are already sorted)
+
 
   History
   ---------
@@ -122,6 +125,12 @@
    + if LIBID > LIBID_MAX, then stop to avoid waiting to read all entries
    + new optional input --SIMLIB_COADD_FILE <file name>
 
+ Oct 15 2026:
+   + SIMLIB_coadd assigns a measurement index to each obs, then sums 
+     in one pass (same sums as before).
+   + new STREAM option: skip MJD sort if input is already sorted, and
+     coadd each band separately in one pass without SORT_BAND copies.
+
 ***************************************/
 
 #include <stdio.h>
@@ -171,6 +180,7 @@ struct INPUTS {
   int   OPT_SNLS;       // SNLS options
 
   int   OPT_SORT_BAND;  // Mar 2022
+  int   OPT_STREAM;     // Oct 2026: single-pass per-band coadd
 } INPUTS ;
 
 // -----------------------
@@ -214,8 +224,20 @@ SIMLIB_CONTENTS_DEF SIMLIB_OUTPUT ;
 struct {
   double MJD_MAX, MJD_MIN;
   int    NOBS_MIN, NOBS_MAX;
+  int    NLIBID_UNSORTED;  // Oct 2026: STREAM option only
 } SUMMARY_INFO;
 
+// Oct 2026: measurement index for each input obs (global to avoid
+// large local arrays).
+struct {
+  int    IMEAS[MXMJD];     // measurement index for each input obs
+  int    OBSMIN[MXMJD];    // first input obs for each measurement
+  int    NEXPOSE[MXMJD];   // sum of NEXPOSE for each measurement
+  double XN[MXMJD];        // number of input obs for each measurement
+} COADD_MEAS ;
+
+#define MXCHAR_BAND_COADD 128  // band index is ASCII code of band char
+
 // declare functions
 
 void  print_simlib_coadd_help(void);
@@ -227,6 +249,9 @@ void  SIMLIB_coadd(void);
 void  insert_NLIBID(void);
 
 void sort_OBS_byMJD(int NOBS, double *MJD_UNSORT);
+bool isSorted_MJD(int NOBS, double *MJD);
+int  SIMLIB_coadd_group(void);
+int  SIMLIB_coadd_group_stream(void);
 
 void  init_summary_info(void);
 void  update_summary_info(int obs);
@@ -283,7 +308,9 @@ int main(int argc, char **argv) {
 
     LIBID = SIMLIB_INPUT.LIBID ;
 
-    if ( INPUTS.OPT_SORT_BAND && LIBID>=0 )  { SIMLIB_sort_band(); ; }
+    // STREAM option coadds each band in one pass, so no band sort
+    if ( INPUTS.OPT_SORT_BAND && !INPUTS.OPT_STREAM && LIBID>=0 )  
+      { SIMLIB_sort_band(); ; }
 
     XN = (float)NLIBID_FOUND;
     if ( fmodf(XN,XNMOD) == 0.0 && LIBID >= 0 ) 
@@ -400,6 +427,8 @@ void  print_simlib_coadd_help(void) {
     ""
     "SORT_BAND   # sort by band before coadd",
     "#   (e.g., g,r,i,g,r,i -> gg,rr,ii so that each band is coadded)",
+    "STREAM      # single-pass coadd of each band (like SORT_BAND, but ",
+    "#   no copies, output in MJD order, and no MJD sort if input is sorted)",
     "",
     "# replace default outout name <simlib_file>.COADD to <coadd_file>",
     "# For testing only; NOT recommended for science.",
@@ -434,6 +463,7 @@ void  parse_args(int argc, char **argv) {
   INPUTS.OPT_SNLS    = 0 ;
   INPUTS.OPT_MWEBV   = 0 ;
   INPUTS.OPT_SORT_BAND = 0 ;
+  INPUTS.OPT_STREAM    = 0 ;
 
 
   // combine consecutive exposures in same filter 
@@ -490,6 +520,9 @@ void  parse_args(int argc, char **argv) {
     if ( strcmp(argv[i], "SORT_BAND" ) == 0 ) 
       { INPUTS.OPT_SORT_BAND = 1; }
 
+    if ( strcmp(argv[i], "STREAM" ) == 0 ) 
+      { INPUTS.OPT_STREAM = 1; }
+
     if ( strcmp(argv[i],"MJD_DMP") == 0 ) 
       { INPUTS.OPT_MJD_DMP = 1;  }
 
@@ -552,6 +585,12 @@ void  parse_args(int argc, char **argv) {
 	    "(reject MWEBV > %3.1f). \n", MWEBV_MAX );
   }
 
+  if ( INPUTS.OPT_STREAM ) {
+    ptrhead = HEADER_ADD[N]; N++ ;
+    sprintf(ptrhead,"   + Combine exposures separately for each band "
+	    "(STREAM)");
+  }
+
   ptrhead = HEADER_ADD[N]; N++ ;
   sprintf(ptrhead,"   + Multiple exposures are '%s' ", copt);
 
@@ -901,8 +940,13 @@ void SIMLIB_read(int *RDSTAT) {
 
     if ( ENDLIB == 1 ) {
 
-      if ( REFAC_SORT_OBS_byMJD ) 
-	{ sort_OBS_byMJD(NOBS_ACCEPT, MJD_UNSORT); }
+      // STREAM option sorts only if needed
+      if ( INPUTS.OPT_STREAM && isSorted_MJD(NOBS_ACCEPT,MJD_UNSORT) ) 
+	{ ; }
+      else if ( REFAC_SORT_OBS_byMJD ) { 
+	sort_OBS_byMJD(NOBS_ACCEPT, MJD_UNSORT); 
+	if ( INPUTS.OPT_STREAM ) { SUMMARY_INFO.NLIBID_UNSORTED++ ; }
+      }
       free(MJD_UNSORT);
 
       if ( NOBS_READ != NOBS_EXPECT && INPUTS.OPT_MJD_DMP == 0 ) {
@@ -986,6 +1030,15 @@ void sort_OBS_byMJD(int NOBS, double *MJD_UNSORT) {
 
 } // end sort_OBS_byMJD
 
+// ========================================================
+bool isSorted_MJD(int NOBS, double *MJD) {
+  // Created Oct 2026: return true if MJD[0:NOBS-1] is non-decreasing.
+  int o;
+  for(o=1; o < NOBS; o++ ) 
+    { if ( MJD[o] < MJD[o-1] ) { return(false); } }
+  return(true);
+} // end isSorted_MJD
+
 // *******************************************
 void SIMLIB_sort_band(void) {
 
@@ -1042,11 +1095,14 @@ void SIMLIB_coadd(void) {
   // May 20, 2009: special fix for taking MJD average without roundoff error
   // Jun 20, 2017: MJD -> double instead of float
   // Jan 07, 2021: sum NEXPOSE and write proper IDEXPT string
-
-  int  i, j, obs, ipar, NOBS_IN, NMEASURE, OVPFILT, IDEXPT, NEXPOSE ;
-  int  OBSMIN[MXMJD], OBSMAX[MXMJD]    ;
-  char *cfilt, *cfilt_last ;
-  double MJD, MJD_LAST, MJD_DIF, XIN, XSUM, XN, XNOPT, ARG, ZPTOFF;
+  // Oct 15, 2026: 
+  //   + grouping is done in SIMLIB_coadd_group[_stream], which assigns
+  //     measurement index COADD_MEAS.IMEAS[obs]; then sums are taken
+  //     in one pass over obs.
+
+  int  i, j, obs, ipar, NOBS_IN, NMEASURE, IDEXPT ;
+  char *cfilt ;
+  double MJD, XIN, XSUM, XN, XNOPT, ARG, ZPTOFF;
   double *PTR_INFO_INPUT, *PTR_INFO_OUTPUT  ;
 
   char fnam[] = "SIMLIB_coadd";
@@ -1064,71 +1120,38 @@ void SIMLIB_coadd(void) {
   sprintf(SIMLIB_OUTPUT.FIELDNAME, "%s", SIMLIB_INPUT.FIELDNAME ); 
 
   // ----------------------
-  // first loop through and identify MJD-ranges to combine.
+  // first loop through and identify obs to combine.
 
   NOBS_IN  = SIMLIB_INPUT.NOBS_ACCEPT ;
-  MJD_LAST = -9.0 ;
-  NMEASURE = 0 ;
-
-  obs = 0;
-  cfilt      = SIMLIB_INPUT.BAND[obs] ;
-  cfilt_last = SIMLIB_INPUT.BAND[obs] ;
-
-  for ( obs=0; obs < NOBS_IN; obs++ ) {
-    MJD     = SIMLIB_INPUT.INFO_OBS[obs][IPAR_MJD] ;
-    MJD_DIF = fabs(MJD - MJD_LAST);
-    cfilt   = SIMLIB_INPUT.BAND[obs] ;
-    OVPFILT = strcmp(cfilt,cfilt_last);  
-
-    if ( MJD_DIF < INPUTS.MAXTDIF_COMBINE && OVPFILT == 0 ) {
-      //  different MJD, same filter -> update OBSMAX
-      OBSMAX[NMEASURE-1] = obs ;  
-    } 
-    else {
-      // next band
-      OBSMIN[NMEASURE] = obs ;
-      OBSMAX[NMEASURE] = obs ;
-      NMEASURE++ ;   
-    }
-
-    cfilt_last = cfilt ;
-    MJD_LAST   = MJD ;
-
-  }  // end of obs loop
-
+  if ( INPUTS.OPT_STREAM ) 
+    { NMEASURE = SIMLIB_coadd_group_stream(); }
+  else
+    { NMEASURE = SIMLIB_coadd_group(); }
 
   // -----------------
-  // Now loop through and combine exposures and take appropriate
-  // averages for SIMLIB_OUTPUT structure
+  // init each output measurement from its 1st exposure
 
   SIMLIB_OUTPUT.NOBS  = NMEASURE ;
   for ( i = 0; i < NMEASURE; i++ ) {
-
-    // for filter, copy element from 1st exposure to OUTPUT measurement,
-    obs = OBSMIN[i] ;
-
-    cfilt = SIMLIB_INPUT.BAND[obs] ;
-    sprintf(SIMLIB_OUTPUT.BAND[i], "%s", cfilt);
-
-    NEXPOSE = 0;
-    IDEXPT  = SIMLIB_INPUT.IDEXPT[obs] ;
-
-    // setup pointer to output INFO array
-    PTR_INFO_OUTPUT = &SIMLIB_OUTPUT.INFO_OBS[i][0] ;
-
-    // init output INFO array 
+    obs = COADD_MEAS.OBSMIN[i] ;
+    sprintf(SIMLIB_OUTPUT.BAND[i], "%s", SIMLIB_INPUT.BAND[obs] );
+    COADD_MEAS.NEXPOSE[i] = 0 ;
+    COADD_MEAS.XN[i]      = 0.0 ;
     for ( ipar=0; ipar < NPAR_OBS; ipar++ ) 
-      { PTR_INFO_OUTPUT[ipar] = 0.0 ; }
+      { SIMLIB_OUTPUT.INFO_OBS[i][ipar] = 0.0 ; }
+  }
 
-    // take sums or sums-of-squares over INPUT 'obs' observations
+  // take sums or sums-of-squares over INPUT 'obs' observations;
+  // obs order within each measurement is the same as before.
 
-    XN = 0.0 ;
+  for ( obs = 0; obs < NOBS_IN; obs++ ) {
 
-    for ( obs = OBSMIN[i]; obs <= OBSMAX[i]; obs++ ) {
+      i = COADD_MEAS.IMEAS[obs] ;
+      PTR_INFO_OUTPUT = &SIMLIB_OUTPUT.INFO_OBS[i][0] ;
 
-      NEXPOSE += SIMLIB_INPUT.NEXPOSE_IDEXPT[obs];
+      COADD_MEAS.NEXPOSE[i] += SIMLIB_INPUT.NEXPOSE_IDEXPT[obs];
 
-      XN += 1.0 ;  // number of exposures for this measurement.
+      COADD_MEAS.XN[i] += 1.0 ;  // number of exposures for this measurement.
 
       PTR_INFO_INPUT   = &SIMLIB_INPUT.INFO_OBS[obs][0] ;
 
@@ -1162,18 +1185,31 @@ void SIMLIB_coadd(void) {
       XIN = PTR_INFO_INPUT[IPAR_MAG] ;
       PTR_INFO_OUTPUT[IPAR_MAG] += XIN ;
 
-    } // end of obs loop
+  } // end of obs loop
+
+  // -----------------
+  // Now loop through and take appropriate averages 
+  // for SIMLIB_OUTPUT structure
+
+  for ( i = 0; i < NMEASURE; i++ ) {
+
+    obs             = COADD_MEAS.OBSMIN[i] ;
+    cfilt           = SIMLIB_INPUT.BAND[obs] ;
+    IDEXPT          = SIMLIB_INPUT.IDEXPT[obs] ;
+    XN              = COADD_MEAS.XN[i] ;
+    PTR_INFO_OUTPUT = &SIMLIB_OUTPUT.INFO_OBS[i][0] ;
 
     // now divide by NMEASURE, take sqrt, etc ... to get
     // appropriate result for single measure
     if ( XN == 0.0 ) {
-      sprintf(c1err,"Nexposure=0 for Meaure=%d OBS=%d-%d, filt=%s ",
-	     i, OBSMIN[i], OBSMAX[i], cfilt );
-      sprintf(c2err," MJD = %f", SIMLIB_INPUT.INFO_OBS[OBSMIN[i]][0] ) ;
+      sprintf(c1err,"Nexposure=0 for Meaure=%d OBS=%d, filt=%s ",
+	     i, obs, cfilt );
+      sprintf(c2err," MJD = %f", SIMLIB_INPUT.INFO_OBS[obs][0] ) ;
       errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
     }
 
-    sprintf(SIMLIB_OUTPUT.STRING_IDEXPT[i], "%d*%d", IDEXPT, NEXPOSE);
+    sprintf(SIMLIB_OUTPUT.STRING_IDEXPT[i], "%d*%d", 
+	    IDEXPT, COADD_MEAS.NEXPOSE[i]);
 
     if ( INPUTS.OPT_SUM > 0 ) 
       { XNOPT = 1.0 ; }
@@ -1219,6 +1255,93 @@ void SIMLIB_coadd(void) {
 } // end of SIMLIB_coadd
 
 
+// *********************
+int SIMLIB_coadd_group(void) {
+
+  // Created Oct 2026 (moved from SIMLIB_coadd)
+  // Combine consecutive obs with same band and MJD within
+  // MAXTDIF_COMBINE of previous obs. Load COADD_MEAS.IMEAS[obs]
+  // and COADD_MEAS.OBSMIN[imeas]; return number of measurements.
+
+  int    NOBS_IN  = SIMLIB_INPUT.NOBS_ACCEPT ;
+  int    NMEASURE = 0, obs, OVPFILT ;
+  double MJD, MJD_LAST = -9.0, MJD_DIF ;
+  char   *cfilt, *cfilt_last ;
+
+  // ------------- BEGIN ----------
+
+  cfilt_last = SIMLIB_INPUT.BAND[0] ;
+
+  for ( obs=0; obs < NOBS_IN; obs++ ) {
+    MJD     = SIMLIB_INPUT.INFO_OBS[obs][IPAR_MJD] ;
+    MJD_DIF = fabs(MJD - MJD_LAST);
+    cfilt   = SIMLIB_INPUT.BAND[obs] ;
+    OVPFILT = strcmp(cfilt,cfilt_last);  
+
+    if ( MJD_DIF < INPUTS.MAXTDIF_COMBINE && OVPFILT == 0 ) {
+      //  different MJD, same filter -> same measurement
+      COADD_MEAS.IMEAS[obs] = NMEASURE-1 ;
+    } 
+    else {
+      // next band
+      COADD_MEAS.OBSMIN[NMEASURE] = obs ;
+      COADD_MEAS.IMEAS[obs]       = NMEASURE ;
+      NMEASURE++ ;   
+    }
+
+    cfilt_last = cfilt ;
+    MJD_LAST   = MJD ;
+
+  }  // end of obs loop
+
+  return(NMEASURE);
+
+} // end SIMLIB_coadd_group
+
+// *********************
+int SIMLIB_coadd_group_stream(void) {
+
+  // Created Oct 2026
+  // STREAM option: single pass over MJD-sorted obs with one open 
+  // measurement per band (indexed by band char). Obs joins the open
+  // measurement in its band if MJD is within MAXTDIF_COMBINE of the 
+  // previous obs in that band; otherwise a new measurement is opened.
+  // This gives the same groups as SORT_BAND without sorting or
+  // copying, and measurements are in order of first MJD.
+
+  int    NOBS_IN  = SIMLIB_INPUT.NOBS_ACCEPT ;
+  int    NMEASURE = 0, obs, ib ;
+  int    IMEAS_OPEN[MXCHAR_BAND_COADD];
+  double MJD, MJD_LAST[MXCHAR_BAND_COADD] ;
+
+  // ------------- BEGIN ----------
+
+  for(ib=0; ib < MXCHAR_BAND_COADD; ib++ ) 
+    { IMEAS_OPEN[ib] = -9;  MJD_LAST[ib] = -9.0; }
+
+  for ( obs=0; obs < NOBS_IN; obs++ ) {
+    MJD = SIMLIB_INPUT.INFO_OBS[obs][IPAR_MJD] ;
+    ib  = (int)((unsigned char)SIMLIB_INPUT.BAND[obs][0]) 
+      % MXCHAR_BAND_COADD ;
+
+    if ( IMEAS_OPEN[ib] >= 0 && 
+	 fabs(MJD - MJD_LAST[ib]) < INPUTS.MAXTDIF_COMBINE ) {
+      COADD_MEAS.IMEAS[obs] = IMEAS_OPEN[ib] ;
+    }
+    else {
+      COADD_MEAS.OBSMIN[NMEASURE] = obs ;
+      COADD_MEAS.IMEAS[obs]       = NMEASURE ;
+      IMEAS_OPEN[ib]              = NMEASURE ;
+      NMEASURE++ ;   
+    }
+    MJD_LAST[ib] = MJD ;
+  }
+
+  return(NMEASURE);
+
+} // end SIMLIB_coadd_group_stream
+
+
 // ************************************************************
 void copy_SIMLIB_CONTENTS_OBS(SIMLIB_CONTENTS_DEF *CONTENTS_INP,
 			      SIMLIB_CONTENTS_DEF *CONTENTS_OUT, 
@@ -1289,6 +1412,7 @@ void init_summary_info(void) {
 
   SUMMARY_INFO.MJD_MIN = +1.0E9;
   SUMMARY_INFO.MJD_MAX = 0.0;
+  SUMMARY_INFO.NLIBID_UNSORTED = 0;
 
   SUMMARY_INFO.NOBS_MIN = 9999999;
   SUMMARY_INFO.NOBS_MAX = 0;
@@ -1330,6 +1454,11 @@ void print_summary_info(void) {
   printf("  Coadd MJD Range: %.1f to %.1f \n",
 	 SUMMARY_INFO.MJD_MIN, SUMMARY_INFO.MJD_MAX );
 
+  if ( INPUTS.OPT_STREAM ) {
+    printf("  STREAM: %d LIBIDs required MJD sort \n",
+	   SUMMARY_INFO.NLIBID_UNSORTED );
+  }
+
   printf("\n Done coadding %d LIBIDs (%d read) \n", 
 	 NLIBID_COADD, NLIBID_FOUND );
     
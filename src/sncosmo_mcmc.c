@@ -19,6 +19,12 @@
 #include <string.h>
 #include "sntools.h"
 #include "sntools_output.h"
+#include <pthread.h>
+
+// thread-local storage for the cosmology state touched by like()
+#define MCMC_TLS __thread
+#define MXCHAIN_THREAD 64  // max number of parallel chains (NUM_CHAIN key)
+#define NZTAB 2000         // number of z bins in distance table
 
 //sncosmo_mcmc functions
 double cmb_point(double params[NCOSPAR],double *redshift);
@@ -26,6 +32,12 @@ double confidVal(int ix, double limfrac, int upper) ;
 void deriv(double p[NCOSPAR],int ipr,double del[NCOSPAR]);
 int domcmc(double parini[NCOSPAR],double errini[NCOSPAR][NCOSPAR],int chain_length,int chainmult[MAXCHAIN],
 double chainlike[MAXCHAIN],double chainpar[4][MAXCHAIN]);
+int domcmc_multi(double parini[NCOSPAR],double errini[NCOSPAR][NCOSPAR],int chain_length,int chainmult[MAXCHAIN],
+double chainlike[MAXCHAIN],double chainpar[4][MAXCHAIN]);
+void *domcmc_thread(void *arg);
+void rhat_multi(int nchain_thr, int nacc[], int *mult[], double (*par[])[MAXCHAIN]);
+void init_sntab(void);
+double rand_mcmc(void);
 void getCovMatrix(int numsamp,double params[NCOSPAR],double covmatrix[NCOSPAR][NCOSPAR],char fname[]);
 double like(double p[NCOSPAR]);
 int readinputfile(FILE* funit);
@@ -172,6 +184,15 @@ The starting values of
 !                  Mainly replaec try* with Try* inside confidVal().
 !
 ! Oct 27 2014 RK - switch to refactored table-read functions, SNTABLE_xxx
+!
+! Oct 15 2026
+!  - per-SN distance-table index, weight and 1/sigma^2 are computed
+!    once (init_sntab); like() does a single fused pass over SNe.
+!  - fix dtab overflow (dtab[nz] was written past the array end).
+!  - new input key NUM_CHAIN: n  runs n Metropolis chains in parallel
+!    pthreads (domcmc_multi), each with its own rand_r seed; chains
+!    are merged and a Gelman-Rubin R-hat is printed per parameter.
+!    Default NUM_CHAIN=1 runs the original single chain.
 */
 
 //Global variables
@@ -217,14 +238,36 @@ int npoints;
 double planck_cov_matrix[NCOSPAR][NCOSPAR];
 
 double RNORM;
-double omega_k, omega_l, omega_m, wde, wa;
+MCMC_TLS double omega_k, omega_l, omega_m, wde, wa;
 double H0;
-int nz = 2000;
-double dtab[2000];
-  double cmb_chisq;
-  double sn_chisq;
-  double bao_chi;
-  double pl_chisq;
+int nz = NZTAB;
+MCMC_TLS double dtab[NZTAB+1];
+MCMC_TLS double cmb_chisq;
+MCMC_TLS double sn_chisq;
+MCMC_TLS double bao_chi;
+MCMC_TLS double pl_chisq;
+
+// Oct 2026: per-SN lookup into dtab; z and sigma are fixed for the run
+int    iz_sntab[MAXSN];
+double dz_sntab[MAXSN];
+double wgt_sntab[MAXSN];   // 1/sigma^2
+double sumwgt_sntab;
+
+// Oct 2026: parallel chains
+int nchain_thread;                 // NUM_CHAIN: key
+MCMC_TLS int          store_delmu = TRUE; // only main thread fills delmu
+MCMC_TLS int          use_seed_chain = FALSE;
+MCMC_TLS unsigned int seed_chain;
+
+typedef struct {
+  int    ichain, chain_length, nacc;
+  unsigned int seed;
+  double parini[NCOSPAR];
+  double errini[NCOSPAR][NCOSPAR];
+  int    *mult;
+  double *like;
+  double (*par)[MAXCHAIN];
+} CHAIN_THREAD_DEF ;
 
 int main(int argc,char* argv[])
 {
@@ -458,6 +501,7 @@ int main(int argc,char* argv[])
   
   npoints = npt;
   if(debug>=1) printf("Read in %6i data points %6.3f < z < %6.3f \n",npoints,zlim_mn,zlim_mx);
+  init_sntab();
   if (debug>=1 && use_lowz_sn) printf("First data point is lowz pseudo-data.\n");
   
   // initialise cmb distance prior ...
@@ -574,7 +618,7 @@ int main(int argc,char* argv[])
     }
 
   printf("\nBeginning initial error estimate with %i samples.\n",ninit);
-  nchain = domcmc(params,errini,ninit,chainmult,chainlike,chainpar);
+  nchain = domcmc_multi(params,errini,ninit,chainmult,chainlike,chainpar);
   numsamp = 0;
   for (n=0;n<nchain;++n) numsamp += chainmult[n];
 
@@ -583,7 +627,7 @@ int main(int argc,char* argv[])
   getCovMatrix(numsamp,params,covmatrix,filename);
 
   printf( "\nBeginning training stage with %i samples.\n",ntrain);
-  nchain = domcmc(params,covmatrix,ntrain,chainmult,chainlike,chainpar);
+  nchain = domcmc_multi(params,covmatrix,ntrain,chainmult,chainlike,chainpar);
   numsamp = 0;
   for (n=0;n<nchain;++n) numsamp += chainmult[n];
   //  printf("nchain=%i numsamp=%i\n",nchain,numsamp);
@@ -593,7 +637,7 @@ int main(int argc,char* argv[])
   getCovMatrix(numsamp,params,covmatrix,filename);
 
   printf("\nBeginning final stage with %i samples.\n",num_samps);
-  nchain = domcmc(params,covmatrix,num_samps,chainmult,chainlike,chainpar);
+  nchain = domcmc_multi(params,covmatrix,num_samps,chainmult,chainlike,chainpar);
   //Sort chain data
   for (i=0;i<nchain;++i) inch[i] = i;
   qSort(inch,chainlike,nchain-1);
@@ -1218,7 +1262,7 @@ double chainpar[4][MAXCHAIN])
 
       //! implement metropolis hastings
 
-       u = rand()/RNORM;
+       u = rand_mcmc();
         if ((loglike != logzero) && (curlike>loglike || u<exp(-loglike+curlike))) 
 	 {
 	   chainmult[numaccept] = mult;
@@ -1381,6 +1425,222 @@ void getCovMatrix(int numsamp,double params[NCOSPAR],double covmatrix[NCOSPAR][N
     if(debug>=3) printf("Correlation matrix written to %s\n",fname);
     return;
 }
+
+// ======================================
+void init_sntab(void) {
+
+  // Created Oct 2026
+  // Redshifts and errors are fixed for the whole run, so compute
+  // once the dtab index, interpolation weight and 1/sigma^2 for
+  // each SN; like() then only evaluates the distance table.
+
+  int    i, iz;
+  double delz = 2.0/nz, zr, sig2 ;
+
+  // ------ BEGIN ------
+
+  sumwgt_sntab = 0.0;
+  for (i=0;i<npoints;++i)
+    {
+      zr = zdata[i]/delz;
+      iz = (int)zr;
+      if ( iz < 0 || iz >= nz ) 
+	{
+	  printf("z=%f for SN %i is outside distance table (0 < z < %.1f)\n",
+		 zdata[i],i,2.0);
+	  printf("ABORTING.\n");
+	  exit(3);
+	}
+      sig2 = sigma[i]*sigma[i];
+      iz_sntab[i]  = iz;
+      dz_sntab[i]  = zr - iz;
+      wgt_sntab[i] = 1.0/sig2;
+      sumwgt_sntab += wgt_sntab[i];
+    }
+
+  return;
+
+} // end init_sntab
+
+
+// ======================================
+double rand_mcmc(void) {
+
+  // Created Oct 2026
+  // Uniform random in [0,1]. Parallel chains use a per-thread
+  // rand_r seed; the single-chain default keeps rand().
+  if ( use_seed_chain ) 
+    { return( (double)rand_r(&seed_chain)/RNORM ); }
+  else
+    { return( (double)rand()/RNORM ); }
+
+} // end rand_mcmc
+
+
+// ======================================
+int domcmc_multi(double parini[NCOSPAR],double errini[NCOSPAR][NCOSPAR],
+		 int chain_length,int chainmult[MAXCHAIN],
+		 double chainlike[MAXCHAIN],double chainpar[4][MAXCHAIN]) {
+
+  // Created Oct 2026
+  // Run nchain_thread independent Metropolis chains in parallel
+  // pthreads, each with chain_length/nchain_thread accepted points,
+  // and concatenate them into the output chain arrays.
+  // Returns total number of accepted points.
+  // nchain_thread=1 calls domcmc directly (original behavior).
+
+  int nthr = nchain_thread;
+  CHAIN_THREAD_DEF CHAIN[MXCHAIN_THREAD];
+  pthread_t        THREAD[MXCHAIN_THREAD];
+  int    *MULT_LIST[MXCHAIN_THREAD];
+  double (*PAR_LIST[MXCHAIN_THREAD])[MAXCHAIN];
+  int    NACC_LIST[MXCHAIN_THREAD];
+  int    t, i, j, n, ntot, len, rc ;
+
+  // ------ BEGIN ------
+
+  if ( nthr <= 1 ) 
+    { return domcmc(parini,errini,chain_length,chainmult,chainlike,chainpar); }
+
+  if ( nthr > MXCHAIN_THREAD ) 
+    {
+      printf("NUM_CHAIN=%i exceeds bound MXCHAIN_THREAD=%i\nABORTING.\n",
+	     nthr, MXCHAIN_THREAD);
+      exit(4);
+    }
+
+  for(t=0; t < nthr; t++ ) 
+    {
+      len = chain_length/nthr ;
+      if ( t < chain_length%nthr ) { len++ ; }
+      CHAIN[t].ichain       = t;
+      CHAIN[t].chain_length = len;
+      CHAIN[t].nacc         = 0;
+      CHAIN[t].seed         = (unsigned int)rand();
+      for(i=0; i < NCOSPAR; i++ ) 
+	{
+	  CHAIN[t].parini[i] = parini[i];
+	  for(j=0; j < NCOSPAR; j++ ) 
+	    { CHAIN[t].errini[i][j] = errini[i][j]; }
+	}
+      CHAIN[t].mult = (int*)   malloc(MAXCHAIN*sizeof(int));
+      CHAIN[t].like = (double*)malloc(MAXCHAIN*sizeof(double));
+      CHAIN[t].par  = (double(*)[MAXCHAIN])malloc(4*MAXCHAIN*sizeof(double));
+
+      rc = pthread_create(&THREAD[t], NULL, domcmc_thread, (void*)&CHAIN[t]);
+      if ( rc != 0 ) 
+	{
+	  printf("pthread_create returns errcode=%d for chain %d\nABORTING.\n",
+		 rc, t);
+	  exit(4);
+	}
+    }
+
+  ntot = 0;
+  for(t=0; t < nthr; t++ ) 
+    {
+      pthread_join(THREAD[t], NULL);
+      for(n=0; n < CHAIN[t].nacc; n++ ) 
+	{
+	  chainmult[ntot] = CHAIN[t].mult[n];
+	  chainlike[ntot] = CHAIN[t].like[n];
+	  for(i=0; i < NCOSPAR; i++ ) 
+	    { chainpar[i][ntot] = CHAIN[t].par[i][n]; }
+	  ntot++ ;
+	}
+      NACC_LIST[t] = CHAIN[t].nacc ;
+      MULT_LIST[t] = CHAIN[t].mult ;
+      PAR_LIST[t]  = CHAIN[t].par ;
+    }
+
+  rhat_multi(nthr, NACC_LIST, MULT_LIST, PAR_LIST);
+
+  for(t=0; t < nthr; t++ ) 
+    { free(CHAIN[t].mult); free(CHAIN[t].like); free(CHAIN[t].par); }
+
+  return(ntot);
+
+} // end domcmc_multi
+
+
+// ======================================
+void *domcmc_thread(void *arg) {
+
+  // Created Oct 2026
+  // pthread entry for one chain of domcmc_multi. Cosmology state used
+  // by like() is thread-local (MCMC_TLS); the random stream is rand_r.
+
+  CHAIN_THREAD_DEF *CHAIN = (CHAIN_THREAD_DEF*)arg;
+
+  // ------ BEGIN ------
+
+  use_seed_chain = TRUE;
+  seed_chain     = CHAIN->seed;
+  store_delmu    = FALSE;
+
+  CHAIN->nacc = domcmc(CHAIN->parini, CHAIN->errini, CHAIN->chain_length,
+		       CHAIN->mult, CHAIN->like, CHAIN->par);
+  return(NULL);
+
+} // end domcmc_thread
+
+
+// ======================================
+void rhat_multi(int nchain_thr, int nacc[], int *mult[], 
+		double (*par[])[MAXCHAIN]) {
+
+  // Created Oct 2026
+  // Print Gelman-Rubin R-hat for each fitted parameter, using the
+  // multiplicity-weighted mean and variance within each chain.
+  //   W = <within-chain var>,  B/n = var(chain means)
+  //   R = sqrt( ((n-1)/n*W + B/n) / W )
+
+  int    t, i, n;
+  double wsum, mean, var, d, nmean;
+  double MEAN[MXCHAIN_THREAD], VAR[MXCHAIN_THREAD];
+  double W, Bn, mm, R;
+  char   *PARNAME[NCOSPAR] = { "Omega_DE", "w_0", "w_a", "Omega_K" } ;
+
+  // ------ BEGIN ------
+
+  printf("\n %i parallel chains: Gelman-Rubin R-hat\n", nchain_thr);
+  for(i=0; i < NCOSPAR; i++ ) 
+    {
+      if ( ipar[i] <= 0 ) { continue; }
+      nmean = 0.0;
+      for(t=0; t < nchain_thr; t++ ) 
+	{
+	  wsum = mean = var = 0.0;
+	  for(n=0; n < nacc[t]; n++ ) 
+	    { wsum += mult[t][n];  mean += mult[t][n]*par[t][i][n]; }
+	  if ( wsum > 0.0 ) { mean /= wsum; }
+	  for(n=0; n < nacc[t]; n++ ) 
+	    { d = par[t][i][n]-mean;  var += mult[t][n]*d*d; }
+	  if ( wsum > 1.0 ) { var /= (wsum-1.0); }
+	  MEAN[t] = mean;  VAR[t] = var;
+	  nmean  += wsum/(double)nchain_thr;
+	}
+
+      W = mm = 0.0;
+      for(t=0; t < nchain_thr; t++ ) 
+	{ W += VAR[t]/nchain_thr;  mm += MEAN[t]/nchain_thr; }
+      Bn = 0.0;
+      for(t=0; t < nchain_thr; t++ ) 
+	{ d = MEAN[t]-mm;  Bn += d*d/(nchain_thr-1); }
+
+      if ( W > 0.0 && nmean > 1.0 ) 
+	{ R = sqrt( ((nmean-1.0)/nmean*W + Bn) / W ); }
+      else
+	{ R = -9.0; }
+      printf("   %-8s  R-hat = %.4f \n", PARNAME[i], R);
+    }
+  fflush(stdout);
+
+  return;
+
+} // end rhat_multi
+
+
 double like(double p[NCOSPAR])
 {
   double chisq;
@@ -1392,13 +1652,13 @@ double like(double p[NCOSPAR])
   double del, z, delz ;
   int iz;
   double dl, dz;
-  double sig2;
   double a1;
   double resultb;
   double cmb_red, cmb_dist;
   double dev;
   double di, dj;
   double Abao;
+  double dscale, sqk, wgt;
 
   omega_l = p[0];
   wde = p[1];
@@ -1411,6 +1671,8 @@ double like(double p[NCOSPAR])
   //** distances are calculated only once for a given cosmology.  
   //** Individual SN found via lookup table dtab
 			       
+  dscale = cvel/H0;
+  sqk    = sqrt(fabs(omega_k));
   dtab[0] = 0.0;
   z = 0.0;
   delz = 2.0/nz;
@@ -1419,42 +1681,38 @@ double like(double p[NCOSPAR])
     {
       dtab[i] = del + dtab[i-1];
       dtab[i-1] = 0.5*delz*dtab[i-1];
-      if(omega_k==0.0) dtab[i-1] = (1.0+z)*(cvel/H0)*dtab[i-1];
-      else if(omega_k<0.0) dtab[i-1] = (1.0+z)*(cvel/H0)*sin(sqrt(-omega_k)*dtab[i-1])/sqrt(-omega_k);
-      else dtab[i-1] = (1.0+z)*(cvel/H0)*sinh(sqrt(omega_k)*dtab[i-1])/sqrt(omega_k);      
+      if(omega_k==0.0) dtab[i-1] = (1.0+z)*dscale*dtab[i-1];
+      else if(omega_k<0.0) dtab[i-1] = (1.0+z)*dscale*sin(sqk*dtab[i-1])/sqk;
+      else dtab[i-1] = (1.0+z)*dscale*sinh(sqk*dtab[i-1])/sqk;
      z = z + delz;
      del = inc(z);
      dtab[i] = dtab[i] + del;
     }
  
   dtab[nz] = 0.5*delz*dtab[nz];
-  if(omega_k==0.0) dtab[nz] = (1.0+z)*(cvel/H0)*dtab[nz];
-  else if(omega_k<0.0) dtab[nz] = (1.0+z)*(cvel/H0)*sin(sqrt(-omega_k)*dtab[nz])/sqrt(-omega_k);
-  else dtab[nz] = (1.0+z)*(cvel/H0)*sinh(sqrt(omega_k)*dtab[nz])/sqrt(omega_k);
+  if(omega_k==0.0) dtab[nz] = (1.0+z)*dscale*dtab[nz];
+  else if(omega_k<0.0) dtab[nz] = (1.0+z)*dscale*sin(sqk*dtab[nz])/sqk;
+  else dtab[nz] = (1.0+z)*dscale*sinh(sqk*dtab[nz])/sqk;
     
   sn_marge = TRUE;
 					       
-  // SN data - may include lowz "super" point
-  for (i=0;i<npoints;++i)
-    {
-      z=zdata[i];
-      // get interpolated distance
-      iz = (int)(z/delz);
-      dz = z/delz-iz;
-      dl = dtab[iz]*(1.-dz) + dtab[iz+1]*dz;
-      mu0 = 5.0*log10(dl) + 25.0;
-      delmu[i] = mu0-mudata[i];
-    }
-  
+  // SN data - may include lowz "super" point.
+  // Table index, interp weight and 1/sigma^2 are from init_sntab,
+  // so one pass gives the three marginalization sums.
   aprima = 0.0;
   bprima = 0.0;
-  cprima = 0.0;
+  cprima = sumwgt_sntab;
   for (i=0;i<npoints;++i)
     {
-      sig2 = sigma[i]*sigma[i];
-      aprima += delmu[i]*delmu[i]/sig2;
-      bprima += delmu[i]/sig2;
-      cprima += 1.0/sig2;
+      iz  = iz_sntab[i];
+      dz  = dz_sntab[i];
+      wgt = wgt_sntab[i];
+      dl  = dtab[iz]*(1.-dz) + dtab[iz+1]*dz;
+      mu0 = 5.0*log10(dl) + 25.0;
+      del = mu0-mudata[i];
+      if ( store_delmu ) { delmu[i] = del; }
+      aprima += wgt*del*del;
+      bprima += wgt*del;
     }
   if(sn_marge) 
     {
@@ -1533,6 +1791,8 @@ int readinputfile(FILE* finput)
   nsamps = 50000;
   ninit = 1000;
   ntrain = 5000;
+  // number of parallel chains (1 => single chain, no pthreads)
+  nchain_thread = 1;
   // intrinsic error
   sigint = 0.08;
   // cheat=.true. means use simulated value (not light curve fit value)
@@ -1648,6 +1908,7 @@ int readinputfile(FILE* finput)
       if (!strncmp(instring,"NUM_SAMPLES:",12)) sscanf(&instring[12],"%i",&nsamps);
       if (!strncmp(instring,"NUM_INITIAL:",12)) sscanf(&instring[12],"%i",&ninit);
       if (!strncmp(instring,"NUM_TRAIN:",10)) sscanf(&instring[10],"%i",&ntrain);
+      if (!strncmp(instring,"NUM_CHAIN:",10)) sscanf(&instring[10],"%i",&nchain_thread);
 
 
       if (!strncmp(instring,"H0:",3)) sscanf(&instring[4],"%lf",&in_H0);
@@ -2113,8 +2374,8 @@ void gengauss(double r[2])
 {
   // Generates two random numbers with a Gaussian distribution
   double radius, phi;
-  radius = sqrt(-2.0*log(rand()/RNORM));
-  phi = TWOPI*rand()/RNORM;
+  radius = sqrt(-2.0*log(rand_mcmc()));
+  phi = TWOPI*rand_mcmc();
   //  printf("radius %f phi %f \n",radius,phi);
   r[0] = radius*cos(phi);
   r[1] = radius*sin(phi);
@@ -57,6 +57,7 @@
 #define WRITE_MASK_SED_TRUE   1024     // write true SED instead of spectra (sim only)
 #define WRITE_MASK_COMPACT      64  // suppress non-essential PHOT output
 #define WRITE_MASK_COMPACT_noFLUXCAL  4096 // internally set if SMEARFLAG_FLUX=0
+#define WRITE_MASK_PHOT_REDUCED 8192  // FITS PHOT: scaled int16 columns (Oct 2026)
 
 #define OPT_ZPTSIG_TRUN  1   // option to use ZPTSIG from template
 #define OPT_ZPTSIG_SRUN  2   // idem for search run
@@ -31,6 +31,7 @@
 #include "sntools.h"
 #include "sntools_cosmology.h"
 #include "sntools_stronglens.h"
+#include "snlc_sim_stream.h"
 #include "snlc_sim.h"
 #include "sntools_devel.h"
 #include "sntools_host.h"
@@ -61,6 +62,11 @@
 #include <gsl/gsl_sort.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
 
 // include C code
 #include "SNcadenceFoM.c"
@@ -70,10 +76,49 @@
 #define TWO_RANDONE_STREAMS
 
 // ******************************************
+#ifndef SNLC_SIM_LIB
 int main(int argc, char **argv) {
 
-  int ilc, i  ;
-  char fnam[] = "main"; 
+  int ilc, istat ;
+
+  // ------------- BEGIN --------------
+
+  // full init; see init_simMain (Oct 2026)
+  init_simMain(argc, argv);
+
+  // =================================================
+  // start main loop over "ilc"
+
+  print_banner( " Begin Generating Lightcurves. " );
+  fflush(stdout);
+
+  for ( ilc = SIMTHREAD_INFO.ILC_MIN; ilc <= INPUTS.NGEN ; ilc++ ) {
+    istat = gen_event_main(&ilc);
+    if ( istat == ISTAT_GENEVENT_STOP ) { break; }
+  } // end of ilc loop
+
+  set_TIMERS(2);
+
+  // print final statistics on generated lightcurves.
+
+  simEnd(&GENLC.SIMFILE_AUX);
+
+  // wait for all MPI ranks, then rank 0 merges output
+  if ( SIMTHREAD_INFO.NRANK > 1 ) { end_simMPI(); }
+
+  return(0);
+
+} // end of main
+#endif
+
+// **************************
+void init_simMain(int argc, char **argv) {
+
+  // Created Oct 2026
+  // Full init (moved out of main) so that it can also be called 
+  // by the in-memory event-stream API (snlc_sim_stream_init).
+
+  char fnam[] = "init_simMain"; 
 
   // ------------- BEGIN --------------
 
@@ -96,6 +141,10 @@ int main(int argc, char **argv) {
   // one-time init of sim-variables
   init_simvar();
 
+#ifdef USE_MPI
+  init_simMPI(&argc, &argv);  // Oct 2026
+#endif
+
   // read user input file for directions
   get_user_input();
 
@@ -103,9 +152,14 @@ int main(int argc, char **argv) {
   rewrite_HOSTLIB_DRIVER();
 
   // init random number generator, and store first random.
+  GENRAN_INFO.USE_COUNTER = ( INPUTS.RANDOM_COUNTER > 0 );
   if ( GENLC.IFLAG_GENSOURCE != IFLAG_GENGRID  ) 
     { init_random_seed(INPUTS.ISEED, INPUTS.NSTREAM_RAN); }
 
+  // optional per-stage random substreams for smear, noise, trigger
+  if ( INPUTS.RANDOM_STAGE > 0 && GENLC.IFLAG_GENSOURCE != IFLAG_GENGRID ) 
+    { init_random_stage(INPUTS.ISEED); }
+
   // prepare user input after init_random_seed to allow 
   // random systematic shifts.
   prep_user_input();
@@ -212,12 +266,30 @@ int main(int argc, char **argv) {
   init_modelSmear(); 
   init_genSpec();     // July 2016: prepare optional spectra
 
+  // Oct 2026: check UNIT_TEST BENCH[_XXX] for kernel microbenchmarks
+  bench_driver(INPUTS.UNIT_TEST);
+
   // init atmosphere/DCR after we know survey ID from SIMLIB, and
   // after filters are read fom kcor/calib file
   if ( INPUTS_ATMOSPHERE.OPTMASK > 0 ) { INIT_ATMOSPHERE(); }
 
-  // create/init output sim-files
-  init_simFiles(&GENLC.SIMFILE_AUX);
+  // check option to fork NTHREAD workers that inherit the init above.
+  // Parent waits for workers, merges their output, and exits;
+  // only worker processes return here.
+  // For MPI build with >1 ranks, each rank is a worker.
+  if ( SIMTHREAD_INFO.NRANK > 1 ) 
+    { prep_simMPI(); }
+  else if ( INPUTS.NTHREAD > 1 && !SIMSTREAM.USE && !IS_GENGRID ) 
+    { fork_simThreads(); }
+
+  // create/init output sim-files (not for in-memory stream)
+  if ( !SIMSTREAM.USE ) { init_simFiles(&GENLC.SIMFILE_AUX); }
+
+#ifdef MODELGRID_GEN
+  // GRIDGEN workers are forked after grid-file header is written
+  if ( IS_GENGRID && INPUTS.NTHREAD > 1 ) 
+    { fork_GRIDthreads(INPUTS.NTHREAD); }
+#endif
 
   // check option to dump rest-frame mags
  SIMLIB_DUMP:
@@ -230,209 +302,276 @@ int main(int argc, char **argv) {
   if ( INPUTS.INIT_ONLY ==2 ) { debugexit("main: QUIT AFTER FULL INIT"); }
 
   set_TIMERS(1);
+  update_SIMGEN_STATUS(OPT_STATUS_INIT, &GENLC.SIMFILE_AUX);
 
-  // =================================================
-  // start main loop over "ilc"
+  return ;
 
-  print_banner( " Begin Generating Lightcurves. " );
-  fflush(stdout);
+} // end init_simMain
 
+// **************************
+int gen_event_main(int *ILC) {
 
-  // - - - - - 
-  for ( ilc = 1; ilc <= INPUTS.NGEN ; ilc++ ) {
+  // Created Oct 2026
+  // Generate one event for global event index *ILC (body of the
+  // main ilc loop). gen_event_reject may decrement *ILC so that the
+  // same index is re-generated. Returns
+  //   ISTAT_GENEVENT_DONE : event processed (accepted or rejected)
+  //   ISTAT_GENEVENT_SKIP : negative LIBID; skip efficiency update
+  //   ISTAT_GENEVENT_STOP : stop generating (e.g., NGEN_LC reached)
+  // Accepted events have GENLC.FLAG_ACCEPT=1.
 
-    NGENEV_TOT++;
-    if ( INPUTS.TRACE_MAIN  ) { dmp_trace_main("01", ilc) ; }
+  int  ilc = *ILC, i, istat_trig ;
+  static int ilc_last = -9, NRETRY = 0 ;
 
-    if ( fudge_SNR() == 2 ) { goto GETMAGS ; }
+  // ------------- BEGIN --------------
 
-    init_event_GENLC();
+  NGENEV_TOT++;
+  if ( INPUTS.TRACE_MAIN  ) { dmp_trace_main("01", ilc) ; }
 
-    if ( INPUTS.TRACE_MAIN  ) { dmp_trace_main("02", ilc) ; }
+  if ( fudge_SNR() == 2 ) { goto GETMAGS ; }
 
-    if ( GENLC.IFLAG_GENSOURCE != IFLAG_GENGRID ) 
-      { fill_RANLISTs(); }      // init list of random numbers for each SN    
+  init_event_GENLC();
 
-    gen_event_driver(ilc); 
+  if ( INPUTS.TRACE_MAIN  ) { dmp_trace_main("02", ilc) ; }
 
+  // for counter-based randoms, key on global event index and on
+  // number of retries for this index (e.g., after GENRANGE reject)
+  if ( ilc == ilc_last ) { NRETRY++ ; } else { NRETRY = 0; ilc_last = ilc; }
+  set_random_event(INPUTS.CIDOFF + ilc, NRETRY);
 
-    if ( GENLC.STOPGEN_FLAG ) { NGENEV_TOT--;  goto ENDLOOP ; }
-    
-    if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("03", ilc) ; }
+  if ( GENLC.IFLAG_GENSOURCE != IFLAG_GENGRID ) 
+    { fill_RANLISTs(); }      // init list of random numbers for each SN    
 
-    // build filter-maps & logical after shapepar in case
-    // new filters are read (i.e, for non1a)
-    gen_filtmap(ilc);   
+  gen_event_driver(ilc); 
 
-    if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("04", ilc) ; }
 
-    // Quit if we get negative LIBID;
-    // mainly to stop reading fakes at end of file.
-    if ( GENLC.SIMLIB_ID < 0 ) { continue ; }
+  if ( GENLC.STOPGEN_FLAG ) 
+    { NGENEV_TOT--;  return(ISTAT_GENEVENT_STOP) ; }
+  
+  if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("03", ilc) ; }
 
-    if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("05", ilc) ;  }
+  // build filter-maps & logical after shapepar in case
+  // new filters are read (i.e, for non1a)
+  gen_filtmap(ilc);   
 
-    // apply generation cuts
-    if ( GENRANGE_CUT() == 0  ) {
-      gen_event_reject(&ilc, &GENLC.SIMFILE_AUX, "GENRANGE");
-      goto GENEFF;
-    }
+  if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("04", ilc) ; }
 
-    NGENLC_TOT++ ; // May 26, 2025: increment just before generating LC
-    if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("06", ilc) ; }
+  // Quit if we get negative LIBID;
+  // mainly to stop reading fakes at end of file.
+  if ( GENLC.SIMLIB_ID < 0 ) { return(ISTAT_GENEVENT_SKIP) ; }
 
-    // skip small NEPOCH, but count this as generated LC for efficiency
-    if ( GENLC.NEPOCH < INPUTS.CUTWIN_NEPOCH[0] ) {   
-      gen_event_reject(&ilc, &GENLC.SIMFILE_AUX, "NEPOCH");
-      goto GENEFF; 
-    }
+  if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("05", ilc) ;  }
 
-  GETMAGS:
+  // Oct 2026: GRIDGEN goes directly to model mags and grid output
+  if ( GENLC.IFLAG_GENSOURCE == IFLAG_GENGRID ) 
+    { gen_event_grid(ilc);  goto GENEFF; }
 
-    // first check if peakMag-dependent trigger fails (to speed generation)
-    if ( gen_TRIGGER_PEAKMAG_SPEC() == 0 ) { 
-      gen_event_reject(&ilc, &GENLC.SIMFILE_AUX, "SEARCHEFF");
-      goto GENEFF; 
-    }
+  // apply generation cuts
+  if ( GENRANGE_CUT() == 0  ) {
+    gen_event_reject(&ilc, &GENLC.SIMFILE_AUX, "GENRANGE");
+    goto GENEFF;
+  }
 
-    // now check zHOST-dependent efficiency (Dec 1 2017)  
-    if ( gen_TRIGGER_zHOST() == 0 ) { 
-      gen_event_reject(&ilc, &GENLC.SIMFILE_AUX, "SEARCHEFF");
-      goto GENEFF; 
-    }
+  NGENLC_TOT++ ; // May 26, 2025: increment just before generating LC
+  if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("06", ilc) ; }
 
+  // skip small NEPOCH, but count this as generated LC for efficiency
+  if ( GENLC.NEPOCH < INPUTS.CUTWIN_NEPOCH[0] ) {   
+    gen_event_reject(&ilc, &GENLC.SIMFILE_AUX, "NEPOCH");
+    goto GENEFF; 
+  }
 
-    if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("07", ilc) ; }
-    GENMAG_DRIVER();   // July 2016
+ GETMAGS:
 
-    if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("08", ilc) ; }
+  // first check if peakMag-dependent trigger fails (to speed generation)
+  start_STAGE_TIMER(ISTAGE_TIMER_TRIGGER);
+  istat_trig = gen_TRIGGER_PEAKMAG_SPEC();
+  end_STAGE_TIMER(ISTAGE_TIMER_TRIGGER);
+  if ( istat_trig == 0 ) { 
+    gen_event_reject(&ilc, &GENLC.SIMFILE_AUX, "SEARCHEFF");
+    goto GENEFF; 
+  }
 
-    // generate spectra before broadband fluxes in case TEXPOSE
-    // is computed from requested SNR; TEXPOSE is then used for
-    // synthetic bands.
-    GENSPEC_DRIVER(); 
+  // now check zHOST-dependent efficiency (Dec 1 2017)  
+  start_STAGE_TIMER(ISTAGE_TIMER_TRIGGER);
+  istat_trig = gen_TRIGGER_zHOST();
+  end_STAGE_TIMER(ISTAGE_TIMER_TRIGGER);
+  if ( istat_trig == 0 ) { 
+    gen_event_reject(&ilc, &GENLC.SIMFILE_AUX, "SEARCHEFF");
+    goto GENEFF; 
+  }
 
+  // Oct 2026: check SNRMAX upper bound before generating LC
+  if ( gen_PRESCREEN_SNRMAX() == 0 ) { 
+    gen_event_reject(&ilc, &GENLC.SIMFILE_AUX, "PRESCREEN");
+    goto GENEFF; 
+  }
 
-    if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("09", ilc) ; }
 
-    // convert generated mags into observed fluxes
-    GENFLUX_DRIVER(); 
+  if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("07", ilc) ; }
+  start_STAGE_TIMER(ISTAGE_TIMER_GENMAG);
+  GENMAG_DRIVER();   // July 2016
+  end_STAGE_TIMER(ISTAGE_TIMER_GENMAG);
 
-    // May 29 2024: reject on crazyFlux (if abort is skipped)
-    if ( GENLC.FLAG_CRAZYFLUX ) {
-      gen_event_reject(&ilc, &GENLC.SIMFILE_AUX, "CRAZYFLUX");
-      goto GENEFF ;
-    }
-    
-    // Oct 1 2023
-    // bail of there are no observations to write out; e.g., pre-explosion 
-    // epochs overlap end of season (hence GENLC.NEPOCH>0) but transient 
-    // model is not defined.
-    if ( GENLC.NOBS_MODELFLUX == 0 ) {
-      gen_event_reject(&ilc, &GENLC.SIMFILE_AUX, "NEPOCH");
-      goto GENEFF;
-    }
-
-    if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("10", ilc) ; }
-
-    // Jan 2016: Force ACCEPT if too many repeats with same LIBID 
-    // to keep track of LIBIDs with no accepts.
-    // In this case, set NOBS=NEPOCH=0 for data file since the
-    // event has actually been discarded.
-    if ( GENLC.NGEN_SIMLIB_ID >= SIMLIB_MXGEN_LIBID )  { 
-      GENLC.FLAG_ACCEPT_FORCE = 1;
-      GENLC.NOBS_MODELFLUX = GENLC.NEPOCH = 0; 
-    }
-
-    // check if search finds this SN:
-    GENLC.SEARCHEFF_MASK = 3 ;
-    if ( GENLC.IFLAG_GENSOURCE != IFLAG_GENGRID  ) {
-      MJD_DETECT_DEF MJD_DETECT;
-      LOAD_SEARCHEFF_DATA();
-      GENLC.SEARCHEFF_MASK = 
+  if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("08", ilc) ; }
+
+  // generate spectra before broadband fluxes in case TEXPOSE
+  // is computed from requested SNR; TEXPOSE is then used for
+  // synthetic bands.
+  start_STAGE_TIMER(ISTAGE_TIMER_GENSPEC);
+  GENSPEC_DRIVER(); 
+  end_STAGE_TIMER(ISTAGE_TIMER_GENSPEC);
+
+
+  if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("09", ilc) ; }
+
+  // convert generated mags into observed fluxes
+  start_STAGE_TIMER(ISTAGE_TIMER_GENFLUX);
+  GENFLUX_DRIVER(); 
+  end_STAGE_TIMER(ISTAGE_TIMER_GENFLUX);
+
+  // May 29 2024: reject on crazyFlux (if abort is skipped)
+  if ( GENLC.FLAG_CRAZYFLUX ) {
+    gen_event_reject(&ilc, &GENLC.SIMFILE_AUX, "CRAZYFLUX");
+    goto GENEFF ;
+  }
+  
+  // Oct 1 2023
+  // bail of there are no observations to write out; e.g., pre-explosion 
+  // epochs overlap end of season (hence GENLC.NEPOCH>0) but transient 
+  // model is not defined.
+  if ( GENLC.NOBS_MODELFLUX == 0 ) {
+    gen_event_reject(&ilc, &GENLC.SIMFILE_AUX, "NEPOCH");
+    goto GENEFF;
+  }
+
+  if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("10", ilc) ; }
+
+  // Jan 2016: Force ACCEPT if too many repeats with same LIBID 
+  // to keep track of LIBIDs with no accepts.
+  // In this case, set NOBS=NEPOCH=0 for data file since the
+  // event has actually been discarded.
+  if ( GENLC.NGEN_SIMLIB_ID >= SIMLIB_MXGEN_LIBID )  { 
+    GENLC.FLAG_ACCEPT_FORCE = 1;
+    GENLC.NOBS_MODELFLUX = GENLC.NEPOCH = 0; 
+  }
+
+  // check if search finds this SN:
+  GENLC.SEARCHEFF_MASK = 3 ;
+  if ( GENLC.IFLAG_GENSOURCE != IFLAG_GENGRID  ) {
+    MJD_DETECT_DEF MJD_DETECT;
+    start_STAGE_TIMER(ISTAGE_TIMER_TRIGGER);
+    LOAD_SEARCHEFF_DATA();
+    GENLC.SEARCHEFF_MASK = 
 	gen_SEARCHEFF(GENLC.CID                 // (I) ID for dump/abort
 		      ,&GENLC.SEARCHEFF_SPEC     // (O)
 		      ,&GENLC.SEARCHEFF_zHOST    // (O) Mar 2018
 		      ,&MJD_DETECT   );          // (O) Oct 2021
 
-      GENLC.MJD_TRIGGER        = (float)MJD_DETECT.TRIGGER ;
-      GENLC.MJD_DETECT_FIRST   = (float)MJD_DETECT.FIRST ;
-      GENLC.MJD_DETECT_LAST    = (float)MJD_DETECT.LAST ;
-    }
+    GENLC.MJD_TRIGGER        = (float)MJD_DETECT.TRIGGER ;
+    GENLC.MJD_DETECT_FIRST   = (float)MJD_DETECT.FIRST ;
+    GENLC.MJD_DETECT_LAST    = (float)MJD_DETECT.LAST ;
+    end_STAGE_TIMER(ISTAGE_TIMER_TRIGGER);
+  }
 
-    for ( i=1; i<= GENRAN_INFO.NLIST_RAN ; i++ )  
-      { GENRAN_INFO.RANLAST[i] = getRan_Flat1(i); }
+  for ( i=1; i<= GENRAN_INFO.NLIST_RAN ; i++ )  
+    { GENRAN_INFO.RANLAST[i] = getRan_Flat1(i); }
 
-    // if APPLY opt is set, then require search MASK to keep SN;
-    // otherwise keep all SNe    
-    int OVP ;
-    OVP = ( INPUTS.APPLY_SEARCHEFF_OPT & GENLC.SEARCHEFF_MASK ) ;
-    if ( OVP != INPUTS.APPLY_SEARCHEFF_OPT  && GENLC.FLAG_ACCEPT_FORCE==0 ) {
-      gen_event_reject(&ilc, &GENLC.SIMFILE_AUX, "SEARCHEFF");
-      goto GENEFF ;
-    }
+  // if APPLY opt is set, then require search MASK to keep SN;
+  // otherwise keep all SNe    
+  int OVP ;
+  OVP = ( INPUTS.APPLY_SEARCHEFF_OPT & GENLC.SEARCHEFF_MASK ) ;
+  if ( OVP != INPUTS.APPLY_SEARCHEFF_OPT  && GENLC.FLAG_ACCEPT_FORCE==0 ) {
+    gen_event_reject(&ilc, &GENLC.SIMFILE_AUX, "SEARCHEFF");
+    goto GENEFF ;
+  }
 
-    // check for Spectroscopic typing tag (not related to GENSPEC_DRIVER)
-    gen_spectype();
+  // check for Spectroscopic typing tag (not related to GENSPEC_DRIVER)
+  gen_spectype();
 
-    if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("11", ilc) ; }
+  if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("11", ilc) ; }
 
-    // check option to apply CUT windows
-    if ( gen_cutwin() != SUCCESS  && GENLC.FLAG_ACCEPT_FORCE==0 ) {
-      gen_event_reject(&ilc, &GENLC.SIMFILE_AUX, "CUTWIN");
-      goto GENEFF;
-    }
+  // check option to apply CUT windows
+  if ( gen_cutwin() != SUCCESS  && GENLC.FLAG_ACCEPT_FORCE==0 ) {
+    gen_event_reject(&ilc, &GENLC.SIMFILE_AUX, "CUTWIN");
+    goto GENEFF;
+  }
 
-    // May 2023: check options to model atmosheric effects (e.g. DCR) 
-    //    Call here is after trigger so that coordinate avg can be
-    //    made only for detections.
-    GEN_ATMOSPHERE_DRIVER();
+  // May 2023: check options to model atmosheric effects (e.g. DCR) 
+  //    Call here is after trigger so that coordinate avg can be
+  //    made only for detections.
+  GEN_ATMOSPHERE_DRIVER();
 
-    if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("12", ilc) ; }
+  if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("12", ilc) ; }
 
-    // check for dump option
-    dmp_event(ilc);
+  // check for dump option
+  dmp_event(ilc);
 
-    // check option to lock first accepted LIBID
-    if ( INPUTS.SIMLIB_IDLOCK == 1 ) 
-      { GENLC.SIMLIB_IDLOCK = GENLC.SIMLIB_ID ; }
+  // check option to lock first accepted LIBID
+  if ( INPUTS.SIMLIB_IDLOCK == 1 ) 
+    { GENLC.SIMLIB_IDLOCK = GENLC.SIMLIB_ID ; }
 
-    // update various counters for accepted event.
-    update_accept_counters(ilc);
+  // update various counters for accepted event.
+  update_accept_counters(ilc);
 
-    if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("13", ilc) ; }
+  if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("13", ilc) ; }
 
-    // update SNDATA files & auxiliary files
-    update_simFiles(&GENLC.SIMFILE_AUX);
+  // update SNDATA files & auxiliary files, or load in-memory stream
+  start_STAGE_TIMER(ISTAGE_TIMER_OUTPUT);
+  if ( SIMSTREAM.USE ) 
+    { load_simStream_event(); }
+  else
+    { update_simFiles(&GENLC.SIMFILE_AUX); }
+  end_STAGE_TIMER(ISTAGE_TIMER_OUTPUT);
 
-    GENLC.FLAG_ACCEPT = 1 ;  // Added Dec 2015
+  GENLC.FLAG_ACCEPT = 1 ;  // Added Dec 2015
 
-    if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("14", ilc) ; }
+  if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("14", ilc) ; }
 
-  GENEFF:
+ GENEFF:
 
-    if ( INPUTS.NGENTOT_LC > 0 ) { screen_update(ilc); }
+  *ILC = ilc ;  // gen_event_reject may have decremented ilc
+  if ( INPUTS.NGENTOT_LC > 0 ) { screen_update(ilc); }
+  update_SIMGEN_STATUS(OPT_STATUS_UPDATE, &GENLC.SIMFILE_AUX);
 
-    GENLC.STOPGEN_FLAG = geneff_calc();  // calc generation effic & error  
-    if ( GENLC.STOPGEN_FLAG )  { goto ENDLOOP; }
-    
-    fflush(stdout);
-    
-  } // end of ilc loop
+  GENLC.STOPGEN_FLAG = geneff_calc();  // calc generation effic & error  
+  if ( GENLC.STOPGEN_FLAG )  { return(ISTAT_GENEVENT_STOP); }
+  
+  fflush(stdout);
+  return(ISTAT_GENEVENT_DONE);
 
+} // end gen_event_main
 
- ENDLOOP:
+// **************************
+void gen_event_grid(int ilc) {
 
-  set_TIMERS(2);
+  // Created Oct 2026
+  // Direct GRIDGEN path called from gen_event_main: compute model
+  // mags at the grid epochs and write them to the grid file.
+  // Stages that do nothing for GRID (GENRANGE cuts, triggers,
+  // spectra, flux noise, search efficiency, cut windows) are skipped.
 
-  // print final statistics on generated lightcurves.
+  // ------------- BEGIN --------------
 
-  simEnd(&GENLC.SIMFILE_AUX);
+  NGENLC_TOT++ ;
 
-  return(0);
+  start_STAGE_TIMER(ISTAGE_TIMER_GENMAG);
+  GENMAG_DRIVER(); 
+  end_STAGE_TIMER(ISTAGE_TIMER_GENMAG);
 
-} // end of main
+  GENLC.NOBS_MODELFLUX = GENLC.NEPOCH ; // as in GENFLUX_DRIVER
 
+  update_accept_counters(ilc);
+
+  start_STAGE_TIMER(ISTAGE_TIMER_OUTPUT);
+  update_simFiles(&GENLC.SIMFILE_AUX);
+  end_STAGE_TIMER(ISTAGE_TIMER_OUTPUT);
+
+  GENLC.FLAG_ACCEPT = 1 ;
+
+  return ;
+
+} // end gen_event_grid
 
 
 // **************************
@@ -527,6 +666,8 @@ void simEnd(SIMFILE_AUX_DEF *SIMFILE_AUX) {
   sprintf(str_cputime,"%s(ACCEP)", STRING_CPUTIME_PROC_RATE);
   print_cputime(t_end_init, str_cputime, UNIT_TIME_SECOND, NGENLC_WRITE);
 
+  print_STAGE_TIMERS(); // Oct 2026
+
   fflush(stdout);
 
   // - - - - 
@@ -739,6 +880,8 @@ void set_user_defaults(void) {
   INPUTS.ISEED       = 1 ;
 
   INPUTS.RANLIST_START_GENSMEAR = 1 ;
+  INPUTS.RANDOM_COUNTER         = 0 ; // 1 => Philox counter-based randoms
+  INPUTS.RANDOM_STAGE           = 0 ; // 1 => random substream per stage
 
 #ifdef ONE_RANDOM_STREAM
   INPUTS.NSTREAM_RAN = 1 ; // for Mac (7.30.2020
@@ -759,10 +902,20 @@ void set_user_defaults(void) {
   INPUTS.CIDRAN_MAX = 3000000 ;
   INPUTS.CIDRAN_MIN = 0 ;
   INPUTS.NCIDRAN_SKIPLIST = 0 ;
+  INPUTS.CIDRAN_METHOD    = CIDRAN_METHOD_LIST ;
+  INPUTS.CIDRAN_SEED      = 0 ;
   
   INPUTS.GZIP_DATA_FILES = 1;
   INPUTS.JOBID      = 0;         // for batch only
   INPUTS.NJOBTOT    = 0;         // for batch only
+  INPUTS.NTHREAD    = 1;         // 1 => no forked workers
+
+  SIMTHREAD_INFO.NTHREAD = 1 ;
+  SIMTHREAD_INFO.ITHREAD = -1 ;
+  SIMTHREAD_INFO.ILC_MIN =  1 ;
+  SIMTHREAD_INFO.ILC_MAX = -9 ;
+  SIMTHREAD_INFO.IRANK   =  0 ;
+  SIMTHREAD_INFO.NRANK   =  1 ;
   INPUTS.NSUBSAMPLE_MARK = 0 ;
 
   // Mar 2020: use updated cosmoparameters defined in sntools.h
@@ -823,6 +976,7 @@ void set_user_defaults(void) {
 
   init_RATEPAR ( &INPUTS.RATEPAR );
   init_RATEPAR ( &INPUTS.RATEPAR_PEC1A );
+  INPUTS.DNDZ_ICDF = 0 ;
   INPUTS.RATEPAR.SEASON_FRAC           = 1.0 ;
   INPUTS.RATEPAR_PEC1A.SEASON_FRAC     = 0.0 ;
   INPUTS.MUREWGT.NMUBIN = 0 ;
@@ -1013,6 +1167,10 @@ void set_user_defaults(void) {
   INPUTS.GENMODEL_ERRSCALE_CORRELATION = 0.0;   // corr with GENMAG_SMEAR
   INPUTS.GENMODEL_MSKOPT             = 0 ; 
   INPUTS.GENMODEL_ARGLIST[0]         = 0 ;
+  INPUTS.GENMODEL_SEDCACHE[0]        = 0.0 ; // 0 -> no SED cache
+  INPUTS.GENMODEL_SEDCACHE[1]        = 0.0 ;
+  INPUTS.GENMODEL_SEDCACHE_MXMB      = 500.0 ;
+  INPUTS.GENMODEL_SEDCACHE_DIR[0]    = 0 ;
   INPUTS.GENMAG_SMEAR[0]             = 0.0 ;
   INPUTS.GENMAG_SMEAR[1]             = 0.0 ; // optional asymmetric smear
   INPUTS.GENMAG_SMEAR_ADDPHASECOR[0] = 0.0 ;
@@ -1027,6 +1185,8 @@ void set_user_defaults(void) {
 
   
   sprintf(INPUTS.STRONGLENS_FILE,       "NONE");
+  sprintf(INPUTS.STRONGLENS_CACHEFILE,  "NONE");
+  INPUTS.STRONGLENS_ORDER_ZSRC = 0 ;
 
 
   sprintf(INPUTS_WEAKLENS.PROBMAP_FILE, "NONE");
@@ -1057,6 +1217,7 @@ void set_user_defaults(void) {
   INPUTS.WRITE_MASK       = WRITE_MASK_SIM_SNANA ; // default
   INPUTS.WRFLAG_MODELPAR  = 1;  // default is yes
   INPUTS.WRFLAG_YAML_FILE = 0;  // batch-sumbit scripts should set this
+  INPUTS.STATUS_UPDATE_SEC = 0.0; // 0 => no live status file
   INPUTS.WRSPEC_PRESCALE  = 1;
   
   INPUTS.NPE_PIXEL_SATURATE = 1000000000; // billion
@@ -1132,6 +1293,7 @@ void set_user_defaults(void) {
   sprintf(INPUTS.HOSTLIB_FILE,          "NONE" );  // input library
   sprintf(INPUTS.HOSTLIB_WGTMAP_FILE,   "NONE" );  // optional wgtmap
   sprintf(INPUTS.HOSTLIB_ZPHOTEFF_FILE, "NONE" );  // optional zphot-eff
+  sprintf(INPUTS.HOSTLIB_BINARY_FILE,   "NONE" );  // optional binary image
   sprintf(INPUTS.HOSTLIB_SPECBASIS_FILE,"NONE" );  //optional host-spec templ
   sprintf(INPUTS.HOSTLIB_SPECDATA_FILE, "NONE" ); 
   sprintf(INPUTS.HOSTLIB_COLUMN_NAME_ZPHOT, "%s" , HOSTLIB_VARNAME_ZPHOT); 
@@ -1145,6 +1307,7 @@ void set_user_defaults(void) {
   INPUTS.HOSTLIB_MSKOPT      = 0;
   INPUTS.HOSTLIB_MSKOPT_ADD  = 0;
   INPUTS.HOSTLIB_MAXREAD     = MXROW_HOSTLIB;
+  INPUTS.HOSTLIB_NTHREAD     = 1;
   INPUTS.HOSTLIB_MNINTFLUX_SNPOS = 0.00 ;  // use 0% as the minimum limit for SNPOS
   INPUTS.HOSTLIB_MXINTFLUX_SNPOS = 0.99 ;  // use 99% of total flux for SNPOS
   INPUTS.HOSTLIB_GALID_NULL      = -9;     // value for no host
@@ -1314,6 +1477,7 @@ void set_user_defaults(void) {
 
   INPUTS.NCUTWIN_SNRMAX = 0;
   INPUTS.OVERRIDE_CUTWIN_SNRMAX = 0;
+  INPUTS.PRESCREEN_CUTWIN_SNRMAX = 0.0 ;
   for ( i=0; i < MXCUTWIN_SNRMAX; i++ ) {
     INPUTS.CUTWIN_SNRMAX[i][0] = -9999. ;
     INPUTS.CUTWIN_SNRMAX[i][1] = +9999. ;
@@ -1396,6 +1560,7 @@ void set_user_defaults(void) {
   INPUTS.NVAR_SIMGEN_DUMP = -9 ;    // note that 0 => list variables & quit
   INPUTS.IFLAG_SIMGEN_DUMPALL = 0 ; // dump only SN written to data file.
   INPUTS.PRESCALE_SIMGEN_DUMP = 1 ; // prescale
+  INPUTS.FORMAT_SIMGEN_DUMP   = FORMAT_SIMGEN_DUMP_TEXT ;
 
   INPUTS.SIMGEN_DUMP_NOISE = 0 ;
   INPUTS.SIMGEN_DUMP_TRAINSALT = 0 ;
@@ -1543,10 +1708,12 @@ int read_input_file(char *input_file, int keySource ) {
   // Aug 01 2024:
   //   + remove REFAC logic and hard-wire REFAC from 2022
   //   + return if input_file == NOFILE
+  // Oct 15 2026: read with zero-copy MSKOPT_PARSE_WORDS_VIEW
   //
  
 
-  int MSKOPT = MSKOPT_PARSE_WORDS_FILE + MSKOPT_PARSE_WORDS_IGNORECOMMENT ;
+  int MSKOPT = MSKOPT_PARSE_WORDS_FILE + MSKOPT_PARSE_WORDS_IGNORECOMMENT +
+    MSKOPT_PARSE_WORDS_VIEW ;
   int  iwd, NWD_FILE, NWD_READ, LENWD, INIT_FLAG_STRING, NTRY=0 ;
   FILE *fp;
   bool DO_STRINGMATCH_INIT;
@@ -1927,6 +2094,9 @@ int parse_input_key_driver(char **WORDS, int keySource ) {
   else if ( keyMatchSim(1, "WRFLAG_YAML_FILE",  WORDS[0],keySource) ) {
     N++;  sscanf(WORDS[N], "%d", &INPUTS.WRFLAG_YAML_FILE );
   }
+  else if ( keyMatchSim(1, "STATUS_UPDATE_SEC",  WORDS[0],keySource) ) {
+    N++;  sscanf(WORDS[N], "%le", &INPUTS.STATUS_UPDATE_SEC );
+  }
   else if ( keyMatchSim(1, "WRSPEC_PRESCALE",  WORDS[0],keySource) ) {
     N++;  sscanf(WORDS[N], "%d", &INPUTS.WRSPEC_PRESCALE );
     README_KEYPLUSARGS_load(MXSPECTRA, 1, WORDS, keySource,
@@ -2075,6 +2245,15 @@ int parse_input_key_driver(char **WORDS, int keySource ) {
   else if ( keyMatchSim(1,"NSTREAM_RAN", WORDS[0],keySource) ) {
     N++;  sscanf(WORDS[N], "%d", &INPUTS.NSTREAM_RAN );
   } 
+  else if ( keyMatchSim(1,"RANDOM_COUNTER", WORDS[0],keySource) ) {
+    N++;  sscanf(WORDS[N], "%d", &INPUTS.RANDOM_COUNTER );
+  } 
+  else if ( keyMatchSim(1,"RANDOM_STAGE", WORDS[0],keySource) ) {
+    N++;  sscanf(WORDS[N], "%d", &INPUTS.RANDOM_STAGE );
+  } 
+  else if ( keyMatchSim(1,"NTHREAD", WORDS[0],keySource) ) {
+    N++;  sscanf(WORDS[N], "%d", &INPUTS.NTHREAD );
+  } 
   else if ( keyMatchSim(1,"RANLIST_START_GENSMEAR", WORDS[0],keySource) ) {
     N++;  sscanf(WORDS[N], "%d", &INPUTS.RANLIST_START_GENSMEAR );
   }
@@ -2733,6 +2912,9 @@ int parse_input_RATEPAR(char **WORDS, int keySource, char *WHAT,
     else if ( keyMatchSim(1, "DNDZ_ALLSCALE", KEYNAME, keySource) ) {
       N++; sscanf(WORDS[N], "%le", &RATEPAR->DNDZ_ALLSCALE ); 
     }
+    else if ( keyMatchSim(1, "DNDZ_ICDF", KEYNAME, keySource) ) {
+      N++; sscanf(WORDS[N], "%d", &INPUTS.DNDZ_ICDF ); 
+    }
     
     // return if any key above was read
     if ( N > 0 ) { return(N); }
@@ -3795,6 +3977,10 @@ int parse_input_HOSTLIB(char **WORDS, int keySource ) {
     check_arg_len(WORDS[0], WORDS[1], MXPATHLEN );
     N++;  sscanf(WORDS[N], "%s", INPUTS.HOSTLIB_ZPHOTEFF_FILE ) ; 
   }
+  else if ( keyMatchSim(1, "HOSTLIB_BINARY_FILE", WORDS[0], keySource) ) {
+    check_arg_len(WORDS[0], WORDS[1], MXPATHLEN );
+    N++;  sscanf(WORDS[N], "%s", INPUTS.HOSTLIB_BINARY_FILE ) ; 
+  }
 
   else if ( keyMatchSim(1, "HOSTLIB_SPECBASIS_FILE", WORDS[0], keySource) ) {
     check_arg_len(WORDS[0], WORDS[1], MXPATHLEN );
@@ -3909,6 +4095,9 @@ int parse_input_HOSTLIB(char **WORDS, int keySource ) {
   else if ( keyMatchSim(1, "HOSTLIB_MAXREAD",WORDS[0],keySource) ) {
     N++;  sscanf(WORDS[N], "%d", &INPUTS.HOSTLIB_MAXREAD ) ;
   }
+  else if ( keyMatchSim(1, "HOSTLIB_NTHREAD",WORDS[0],keySource) ) {
+    N++;  sscanf(WORDS[N], "%d", &INPUTS.HOSTLIB_NTHREAD ) ;
+  }
   else if ( keyMatchSim(1, "HOSTLIB_GALID_NULL",WORDS[0],keySource) ) {
     N++;  sscanf(WORDS[N], "%d", &INPUTS.HOSTLIB_GALID_NULL ) ;
   }
@@ -4063,6 +4252,15 @@ int parse_input_LENS(char **WORDS, int keySource) {
     N++;  sscanf(WORDS[N], "%s", INPUTS.STRONGLENS_FILE );
   }
 
+  else if ( keyMatchSim(1, "STRONGLENS_CACHEFILE",  WORDS[0],keySource) ) {
+    check_arg_len(WORDS[0], WORDS[1], MXPATHLEN);
+    N++;  sscanf(WORDS[N], "%s", INPUTS.STRONGLENS_CACHEFILE );
+  }
+
+  else if ( keyMatchSim(1, "STRONGLENS_ORDER_ZSRC",  WORDS[0],keySource) ) {
+    N++;  sscanf(WORDS[N], "%d", &INPUTS.STRONGLENS_ORDER_ZSRC );
+  }
+
   else if ( keyMatchSim(1, "NPSFSIGMA_MINSEP_DETECT",  WORDS[0],keySource) ) {
     N++;  sscanf(WORDS[N], "%le", &INPUTS_SEARCHEFF.NPSFSIGMA_MINSEP_DETECT );
   }
@@ -4132,6 +4330,9 @@ int  parse_input_CUTWIN(char **WORDS, int keySource ) {
    N++;  sscanf(WORDS[N], "%f", &INPUTS.CUTWIN_HOST_ZPHOT[0] );
    N++;  sscanf(WORDS[N], "%f", &INPUTS.CUTWIN_HOST_ZPHOT[1] );
  }
+ else if ( keyMatchSim(1, "PRESCREEN_CUTWIN_SNRMAX", WORDS[0],keySource)) {
+   N++;  sscanf(WORDS[N], "%f", &INPUTS.PRESCREEN_CUTWIN_SNRMAX );
+ }
  else if ( keyMatchSim(1, "CUTWIN_TRESTMIN", WORDS[0],keySource)) {
    N++;  sscanf(WORDS[N], "%f", &INPUTS.CUTWIN_TRESTMIN[0] );
    N++;  sscanf(WORDS[N], "%f", &INPUTS.CUTWIN_TRESTMIN[1] );
@@ -4574,6 +4775,17 @@ int parse_input_GENMODEL(char **WORDS, int keySource) {
   else if ( keyMatchSim(1, "GENMODEL_ARGLIST",  WORDS[0],keySource) ) {
     N += parse_input_GENMODEL_ARGLIST(WORDS,keySource);
   }
+  else if ( keyMatchSim(1, "GENMODEL_SEDCACHE",  WORDS[0],keySource) ) {
+    // Oct 2026: PySEDMODEL SED cache with Trest and param quanta
+    N++;  sscanf(WORDS[N], "%le", &INPUTS.GENMODEL_SEDCACHE[0] );
+    N++;  sscanf(WORDS[N], "%le", &INPUTS.GENMODEL_SEDCACHE[1] );
+  }
+  else if ( keyMatchSim(1, "GENMODEL_SEDCACHE_MXMB", WORDS[0],keySource) ) {
+    N++;  sscanf(WORDS[N], "%le", &INPUTS.GENMODEL_SEDCACHE_MXMB );
+  }
+  else if ( keyMatchSim(1, "GENMODEL_SEDCACHE_DIR", WORDS[0],keySource) ) {
+    N++;  sscanf(WORDS[N], "%s", INPUTS.GENMODEL_SEDCACHE_DIR );
+  }
   else if ( keyMatchSim(1,"GENMODEL_EXTRAP_LATETIME",WORDS[0],keySource) ) {
     N++;  sscanf(WORDS[N], "%s", INPUTS.GENMODEL_EXTRAP_LATETIME );
   }
@@ -4731,6 +4943,7 @@ int parse_input_SIMGEN_DUMP(char **WORDS,int keySource) {
   // Apr 16 2021: check SIMGEN_DUMPALL SWITCH 
   // Jun 23 2023: check LRD_ADD
   // Aug 30 2024: check SIMGEN_DUMP_NOISE
+  // Oct 15 2026: check SIMGEN_DUMP_FORMAT: TEXT, BIN or BINZ
   
   int  ivar, NVAR=0, N=0 ;
   bool LRD = false, LRD_COMMA_SEP=false, LRD_SPACE_SEP=false ;
@@ -4786,6 +4999,22 @@ int parse_input_SIMGEN_DUMP(char **WORDS,int keySource) {
     N++ ; sscanf(WORDS[N] , "%d", &INPUTS.SIMGEN_DUMP_MWCL );
     return(N);
   }
+  else if ( keyMatchSim(1, "SIMGEN_DUMP_FORMAT", WORDS[0], keySource) ) {
+    // Oct 2026: binary columnar option for very large DUMPALL files
+    N++ ;
+    if ( strcmp_ignoreCase(WORDS[N],"TEXT") == 0 ) 
+      { INPUTS.FORMAT_SIMGEN_DUMP = FORMAT_SIMGEN_DUMP_TEXT; }
+    else if ( strcmp_ignoreCase(WORDS[N],"BIN") == 0 ) 
+      { INPUTS.FORMAT_SIMGEN_DUMP = FORMAT_SIMGEN_DUMP_BIN; }
+    else if ( strcmp_ignoreCase(WORDS[N],"BINZ") == 0 ) 
+      { INPUTS.FORMAT_SIMGEN_DUMP = FORMAT_SIMGEN_DUMP_BINZ; }
+    else {
+      sprintf(c1err,"Invalid SIMGEN_DUMP_FORMAT: %s", WORDS[N]);
+      sprintf(c2err,"Valid options are TEXT, BIN, BINZ");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+    }
+    return(N);
+  }
 
   // - - - - - - - 
 
@@ -4883,6 +5112,12 @@ int  parse_input_CID(char **WORDS, int keySource ) {
   else if ( keyMatchSim(1, "CIDRAN_MIN",  WORDS[0],keySource) ) {
     N++;  sscanf(WORDS[N], "%d", &INPUTS.CIDRAN_MIN );
   }
+  else if ( keyMatchSim(1, "CIDRAN_METHOD",  WORDS[0],keySource) ) {
+    N++;  sscanf(WORDS[N], "%d", &INPUTS.CIDRAN_METHOD );
+  }
+  else if ( keyMatchSim(1, "CIDRAN_SEED",  WORDS[0],keySource) ) {
+    N++;  sscanf(WORDS[N], "%d", &INPUTS.CIDRAN_SEED );
+  }
 
   else if ( keyMatchSim(1, "CIDRAN_SKIPLIST",  WORDS[0],keySource) ) {
     // parse comma-sep list of CIDRANs to avoid
@@ -6471,6 +6706,8 @@ void prep_user_input(void) {
   Feb 21 2021: abort on FORMAT_MASK +=1, or legacy VERBOSE 
   Oct 14 2021: set spectra bit of WRITE_MASK if spectrograph is used.
   Jul 23 2024: INPUTS.HOSTLIB_USE=0 for FIXMAG model
+  Oct 15 2026: check WRFLAG_PACK (FORMAT_MASK += 4096)
+  Oct 15 2026: check FORMAT_MASK_PHOT_REDUCED (FORMAT_MASK += 8192)
 
   *******************/
 
@@ -6491,6 +6728,7 @@ void prep_user_input(void) {
   ENVreplace(INPUTS.HOSTLIB_FILE,fnam,1);
   ENVreplace(INPUTS.HOSTLIB_WGTMAP_FILE,fnam,1);
   ENVreplace(INPUTS.HOSTLIB_ZPHOTEFF_FILE,fnam,1);
+  ENVreplace(INPUTS.HOSTLIB_BINARY_FILE,fnam,1);
   ENVreplace(INPUTS.HOSTLIB_SPECBASIS_FILE,fnam,1);
   ENVreplace(INPUTS.HOSTLIB_SPECDATA_FILE,fnam,1);
   ENVreplace(INPUTS.FLUXERRMODEL_FILE,fnam,1 );
@@ -6501,6 +6739,7 @@ void prep_user_input(void) {
   ENVreplace(INPUTS.NON1AGRID_FILE,fnam,1);
   ENVreplace(INPUTS.NONLINEARITY_FILE,fnam,1);
   ENVreplace(INPUTS.STRONGLENS_FILE,fnam,1);
+  ENVreplace(INPUTS.STRONGLENS_CACHEFILE,fnam,1);
   ENVreplace(INPUTS.LCLIB_FILE,fnam,1);
   ENVreplace(INPUTS.MODELPATH,fnam,1);
   ENVreplace(PATH_USER_INPUT,fnam,1);
@@ -7184,6 +7423,7 @@ void prep_user_input(void) {
   WRFLAG_COMPACT   = 0 ;
   WRFLAG_ATMOS     = 0 ;
   WRFLAG_noSPEC    = 0 ;
+  WRFLAG_PACK      = 0 ;
   
   // check for whether to write FULL, TERSE, FITS, etc ,
   // EXCEPT for the GRID-GEN option (for psnid ...), 
@@ -7198,6 +7438,15 @@ void prep_user_input(void) {
     WRFLAG_COMPACT   = ( INPUTS.FORMAT_MASK  & FORMAT_MASK_COMPACT   ) ;
     WRFLAG_ATMOS     = ( INPUTS.FORMAT_MASK  & FORMAT_MASK_ATMOS     ) ;
     WRFLAG_noSPEC    = ( INPUTS.FORMAT_MASK  & FORMAT_MASK_noSPEC    ) ;
+    WRFLAG_PACK      = ( INPUTS.FORMAT_MASK  & FORMAT_MASK_PACK      ) ;
+  }
+
+  // Oct 2026: PACK is for FITS only; one text file per event cannot be packed.
+  if ( WRFLAG_PACK && !WRFLAG_FITS ) {
+    sprintf(c1err,"FORMAT_MASK += %d (PACK) requires FITS format", 
+	    FORMAT_MASK_PACK);
+    sprintf(c2err,"Add %d to FORMAT_MASK", FORMAT_MASK_FITS);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
 
   if ( WRFLAG_BLINDTEST ) 
@@ -7211,6 +7460,8 @@ void prep_user_input(void) {
 
   if ( WRFLAG_ATMOS     ) 
     { INPUTS.WRITE_MASK += WRITE_MASK_ATMOS; }
+  if ( INPUTS.FORMAT_MASK & FORMAT_MASK_PHOT_REDUCED ) 
+    { INPUTS.WRITE_MASK += WRITE_MASK_PHOT_REDUCED; }  // Oct 2026
   if ( INPUTS.MAGMONITOR_SNR) { 
     SNDATA.MAGMONITOR_SNR = INPUTS.MAGMONITOR_SNR ;
     sprintf(SNDATA.VARNAME_SNRMON, "SIM_SNRMAG%2.2d", SNDATA.MAGMONITOR_SNR);
@@ -7398,6 +7649,7 @@ void prep_user_cosmology(void) {
   // Call init_HzFUN_INFO to either store user-input cosmology params,
   // or to read z,H(z) from 2-column input file.
   //
+  // Oct 14 2026: call init_HzINV_TABLE
  
   double cosPar[NCOSPAR_HzFUN];
   char  *HzFUN_FILE = INPUTS.HzFUN_FILE ;
@@ -7416,6 +7668,11 @@ void prep_user_cosmology(void) {
   init_HzFUN_INFO(VBOSE, cosPar, HzFUN_FILE, 
 		  &INPUTS.HzFUN_INFO );             // <== returned 
 
+  // Oct 2026: tabulate H0/H(z) integral for fast dLmag and dV/dz
+  double zmax_table = INPUTS.GENRANGE_REDSHIFT[1] ;
+  if ( zmax_table < 1.0 ) { zmax_table = 1.0; }
+  init_HzINV_TABLE(zmax_table+0.5, &INPUTS.HzFUN_INFO);
+
   // May 2025 - check special option with MUSHIFT and DNDZ_XXX_REWGT option
   bool USE_MUSHIFT_RANGE = (INPUTS.MUSHIFT[1] - INPUTS.MUSHIFT[0]) > 0;
   bool USE_REWGT         = 
@@ -8694,7 +8951,8 @@ void init_DNDZ_Rate(void) {
 
   sprintf(key_model_rate,"MODEL_RATE");
 
-  init_stronglens(INPUTS.STRONGLENS_FILE);
+  init_stronglens(INPUTS.STRONGLENS_FILE, INPUTS.STRONGLENS_CACHEFILE,
+		  INPUTS.STRONGLENS_ORDER_ZSRC);
   if ( INPUTS_STRONGLENS.USE_FLAG ) 
     { sprintf(key_model_rate,"PROB_SL x MODEL_RATE");  }
 
@@ -9083,6 +9341,7 @@ void init_simvar(void) {
     { NGENLC_TOT_SUBSURVEY[i] = NGENLC_WRITE_SUBSURVEY[i] = 0; }
 
   NGENFLUX_DRIVER = 0 ;
+  FLUXNOISE_BATCH.NALLOC = FLUXNOISE_BATCH.NEP = 0 ;
 
   NGEN_REJECT.GENRANGE  = 0;
   NGEN_REJECT.GENMAG    = 0;
@@ -9091,6 +9350,7 @@ void init_simvar(void) {
   NGEN_REJECT.CUTWIN    = 0;
   NGEN_REJECT.NEPOCH    = 0;
   NGEN_REJECT.CRAZYFLUX = 0;  
+  NGEN_REJECT.PRESCREEN = 0;
 
   GENLC.MWEBV           = 0.0 ;
   GENLC.MWEBV_ERR       = 0.0 ;
@@ -9141,6 +9401,7 @@ void init_simvar(void) {
 
   SIMLIB_IDEAL_GRID.USE = false;
 
+  SIMLIB_malloc_OBS(MXOBS_SIMLIB_INIT); // Oct 2026
   SIMLIB_OBS_GEN.PIXSIZE[0] = -9.0 ; // ?? why is this here
 
   // init strong lens struct.
@@ -9251,11 +9512,14 @@ void  init_event_GENLC(void) {
   // Nov 22 2017: use NEP_RESET (instead of MXEPSIM) to limit
   //               wasted CPU on initializing (based on gprof)
   // Jul 20 2019: add skip for repeated strong lens images
+  // Oct 15 2026: reset per-event scratch arena (ARENA_EVENT)
 
   int epoch, ifilt, ifilt_obs, i, obs, imjd, NEP_RESET ;
   char fnam[] = "init_event_GENLC" ;
 
   // -------------- BEGIN ---------------
+  arena_reset(&ARENA_EVENT);
+
   GENLC.FLAG_ACCEPT_LAST  = GENLC.FLAG_ACCEPT ;
   GENLC.FLAG_ACCEPT       = 0 ;
   GENLC.FLAG_ACCEPT_FORCE = 0 ;
@@ -9547,7 +9811,8 @@ void  init_event_GENLC(void) {
   //  GENLC.SNTYPE_NAME[0] = 0;
   sprintf(GENLC.SNTYPE_NAME,"UNKNOWN");
 
-  for(i=0; i < MXOBS_SIMLIB; i++ ) {
+  // Oct 2026: loop over allocated size instead of MXOBS_SIMLIB
+  for(i=0; i < SIMLIB_OBS_RAW.MXOBS_ALLOC; i++ ) {
     SIMLIB_OBS_GEN.IFILT_OBS[i]  = -9 ;
     SIMLIB_OBS_GEN.MJD[i]        = -99. ;
     SIMLIB_OBS_GEN.CCDGAIN[i]    = -99. ;
@@ -9658,6 +9923,7 @@ void init_modelSmear(void) {
   // Feb 11 2020: call init_genSmear_phaseCor(magSmear,expTau);
   //
   // May 20 2024: begin integrating DUST models.
+  // Oct 14 2026: call init_genSmear_TABLE (GENMAG_SMEAR_MSKOPT += 64)
   
   double GENMODEL_ERRSCALE   = (double)INPUTS.GENMODEL_ERRSCALE ;
   char  *SMEAR_SCALE_STRING  = INPUTS.GENMAG_SMEAR_SCALE;
@@ -9825,6 +10091,9 @@ void init_modelSmear(void) {
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
 
+  // Oct 2026: check option for per-event (lambda x Trest) table
+  init_genSmear_TABLE(LAMRANGE);
+
   // -------------------------------
   if ( INPUTS.DO_MODELSMEAR  == 0 ) 
     { printf("\t ==> No model smearing options selected. \n" ) ; }
@@ -9975,6 +10244,7 @@ void  init_genSpec(void) {
   // See GENSPEC_DRIVER for execution.
   //
   // Jul 12 2019: allow BYOSED
+  // Oct 15 2026: lambda arrays are malloc'ed later by GENSPEC_MALLOC_LAM
 
   char *modelName  = GENMODEL_NAME[INDEX_GENMODEL][0] ; // generic model name
   int  OPTMASK     = INPUTS.SPECTROGRAPH_OPTIONS.OPTMASK ;
@@ -10096,24 +10366,12 @@ void  init_genSpec(void) {
   GENSPEC.TEXPOSE_TEMPLATE = 0.0 ; // May 2021
 
   // - - - - - - - - - - - - - - - - - - - -
-  // malloc arrays vs. lambda 
-  int ispec, MXLAM = NBLAM ;
+  // arrays vs. lambda are malloc'ed on demand in GENSPEC_DRIVER
+  // (Oct 2026) so that memory scales with the number of spectra
+  // actually generated rather than with MXSPECTRA.
+  int MXLAM = NBLAM ;
   int MEMD = MXLAM * sizeof(double);
-  for(ispec=0; ispec < MXSPEC; ispec++ ) {
-    GENSPEC.LAMMIN_LIST[ispec]           = (double*) malloc(MEMD) ;
-    GENSPEC.LAMMAX_LIST[ispec]           = (double*) malloc(MEMD) ;
-    GENSPEC.GENMAG_LIST[ispec]           = (double*) malloc(MEMD) ;
-    GENSPEC.GENSNR_LIST[ispec]           = (double*) malloc(MEMD) ;
-    GENSPEC.GENFLUX_LIST[ispec]          = (double*) malloc(MEMD) ;
-    GENSPEC.GENFLUX_LAMSMEAR_LIST[ispec] = (double*) malloc(MEMD) ;
-    GENSPEC.OBSFLUX_LIST[ispec]          = (double*) malloc(MEMD) ;
-    GENSPEC.OBSFLUXERR_LIST[ispec]       = (double*) malloc(MEMD) ;
-    GENSPEC.OBSFLUXERRSQ_LIST[ispec]     = (double*) malloc(MEMD) ;
-    GENSPEC.GENFLAM_LIST[ispec]          = (double*) malloc(MEMD) ;
-    GENSPEC.FLAM_LIST[ispec]             = (double*) malloc(MEMD) ;
-    GENSPEC.FLAMERR_LIST[ispec]          = (double*) malloc(MEMD) ;
-    GENSPEC.FLAMWARP_LIST[ispec]         = (double*) malloc(MEMD) ;
-  } 
+  GENSPEC.NMJD_MALLOC = 0 ;
 
   if ( INPUTS.TAKE_SPECTRUM_HOSTSNFRAC > 0.000001 ) {   // Mar 2 2021
     GENSPEC.GENFLUX_PEAK          = (double*) malloc(MEMD) ;
@@ -10175,6 +10433,7 @@ void GENSPEC_DRIVER(void) {
   // Feb 24 2021: increment NMJD_PROC only if NBLAM_VALID > 0
   // May 24 2021: check prescale for SN spectra
   // May 11 2023: check option for ideal spectra at each obs
+  // Oct 15 2026: call GENSPEC_MALLOC_LAM
 
   int  OPTMASK     = INPUTS.SPECTROGRAPH_OPTIONS.OPTMASK ;  
   bool DO_SEDMODEL = ( (OPTMASK & SPECTROGRAPH_OPTMASK_SEDMODEL)>0 );
@@ -10200,6 +10459,9 @@ void GENSPEC_DRIVER(void) {
   // bail if no  spectra are requested
   if ( NMJD == 0 ) { return; }
 
+  // make sure lambda arrays exist for each spectrum (Oct 2026)
+  GENSPEC_MALLOC_LAM(NMJD);
+
   // if there is no SPECTROGRPAH instrument, abort
   if ( !SPECTROGRAPH_USEFLAG ) {
     sprintf(c1err,"Cannot generate %d spectra for CID=%d", 
@@ -10226,6 +10488,7 @@ void GENSPEC_DRIVER(void) {
 
   if ( INPUTS.TAKE_SPECTRUM_HOSTSNFRAC > 1.0E-8 ) 
     { GENSPEC_TRUE(ISPEC_PEAK); }
+  GENSPEC.SCALE_HOSTSNFRAC = -9.0 ; // computed with 1st SN spectrum
 
   int    NFIELD_OVP = SIMLIB_HEADER.NFIELD_OVP ;
   int    NFLATRAN, iran, imjd_order[MXSPEC];
@@ -10266,6 +10529,9 @@ void GENSPEC_DRIVER(void) {
     // apply optional fudges for test or debug
     GENSPEC_FUDGES(imjd); 
 
+    // host spectrum changed -> re-compute HOSTSNFRAC scale
+    if ( GENSPEC.IS_HOST[imjd] ) { GENSPEC.SCALE_HOSTSNFRAC = -9.0; }
+
     // if TAKE_SPECTRUM is defined by SNR, compute TEXPOSE
     GENSPEC_TEXPOSE_TAKE_SPECTRUM(imjd);
 
@@ -10668,6 +10934,8 @@ void GENSPEC_INIT(int OPT, int imjd) {
   // Init imjd & lambda-arrays.
   // OPT=1 --> init everything for one-time init
   // OPT=2 --> init some stuff each event.
+  //
+  // Oct 15 2026: init lambda arrays only if they are malloc'ed
 
   int  NBLAM = INPUTS_SPECTRO.NBIN_LAM ;
   int  ilam ;
@@ -10698,6 +10966,8 @@ void GENSPEC_INIT(int OPT, int imjd) {
 
   GENSPEC.SNR_REST_U[imjd] = 0.0 ;
   GENSPEC.SNR_REST_V[imjd] = 0.0 ;  
+
+  if ( imjd >= GENSPEC.NMJD_MALLOC ) { return; }
   
   // init arrays
   for(ilam=0; ilam < NBLAM; ilam++ ) {
@@ -10721,6 +10991,45 @@ void GENSPEC_INIT(int OPT, int imjd) {
 } // end GENSPEC_INIT
 
 
+// *********************************************
+void GENSPEC_MALLOC_LAM(int NMJD) {
+
+  // Created Oct 2026
+  // Make sure that arrays vs. lambda are malloc'ed for spectrum 
+  // indices imjd < NMJD. Arrays are never freed, so the number of 
+  // malloc'ed spectra only grows to the max NMJD of any event.
+  // Newly malloc'ed arrays are initialized with GENSPEC_INIT.
+
+  int NBLAM = INPUTS_SPECTRO.NBIN_LAM ;
+  int MEMD  = NBLAM * sizeof(double);
+  int imjd ;
+  // char fnam[] = "GENSPEC_MALLOC_LAM" ;
+
+  // ------------ BEGIN ----------
+
+  for(imjd = GENSPEC.NMJD_MALLOC; imjd < NMJD; imjd++ ) {
+    GENSPEC.LAMMIN_LIST[imjd]           = (double*) malloc(MEMD) ;
+    GENSPEC.LAMMAX_LIST[imjd]           = (double*) malloc(MEMD) ;
+    GENSPEC.GENMAG_LIST[imjd]           = (double*) malloc(MEMD) ;
+    GENSPEC.GENSNR_LIST[imjd]           = (double*) malloc(MEMD) ;
+    GENSPEC.GENFLUX_LIST[imjd]          = (double*) malloc(MEMD) ;
+    GENSPEC.GENFLUX_LAMSMEAR_LIST[imjd] = (double*) malloc(MEMD) ;
+    GENSPEC.OBSFLUX_LIST[imjd]          = (double*) malloc(MEMD) ;
+    GENSPEC.OBSFLUXERR_LIST[imjd]       = (double*) malloc(MEMD) ;
+    GENSPEC.OBSFLUXERRSQ_LIST[imjd]     = (double*) malloc(MEMD) ;
+    GENSPEC.GENFLAM_LIST[imjd]          = (double*) malloc(MEMD) ;
+    GENSPEC.FLAM_LIST[imjd]             = (double*) malloc(MEMD) ;
+    GENSPEC.FLAMERR_LIST[imjd]          = (double*) malloc(MEMD) ;
+    GENSPEC.FLAMWARP_LIST[imjd]         = (double*) malloc(MEMD) ;
+    GENSPEC.NMJD_MALLOC = imjd + 1 ;
+    GENSPEC_INIT(2,imjd);
+  }
+
+  return ;
+
+} // end GENSPEC_MALLOC_LAM
+
+
 void GENSPEC_OBSFLUX_INIT(int imjd, int ILAM_MIN, int ILAM_MAX) {
 
   int ilam;
@@ -10902,8 +11211,9 @@ void GENSPEC_TRUE(int imjd) {
   // Note that global GENSPEC.GENFLAM_LIST has not been filled yet, and thus
   // local GENFLAM_LIST is computed here.
   int     NLAMSPEC        = SPECTROGRAPH_SEDMODEL.NBLAM_TOT ;
-  double *GENFLAM_LIST      = (double*)malloc( NLAMSPEC * sizeof(double) );
-  double *NULL_FLAMERR_LIST = (double*)malloc( NLAMSPEC * sizeof(double) );
+  size_t  MEMD            = NLAMSPEC * sizeof(double);
+  double *GENFLAM_LIST      = (double*)arena_alloc(&ARENA_EVENT,MEMD);
+  double *NULL_FLAMERR_LIST = (double*)arena_alloc(&ARENA_EVENT,MEMD);
   double *LAMMAX_LIST  = SPECTROGRAPH_SEDMODEL.LAMMAX_LIST ;
   double *LAMMIN_LIST  = SPECTROGRAPH_SEDMODEL.LAMMIN_LIST ;
   double *LAMAVG_LIST  = SPECTROGRAPH_SEDMODEL.LAMAVG_LIST ;
@@ -10951,8 +11261,6 @@ void GENSPEC_TRUE(int imjd) {
 
   } // end ifilt
 
-  free(GENFLAM_LIST);
-
   return ;
 
 } // end GENSPEC_TRUE
@@ -11028,7 +11336,7 @@ void GENSPEC_SYNMAG(int ifilt_obs,  double *FLAM_LIST, double *FLAMERR_LIST,
   double hc8          = (double)hc ;
   bool   DO_MAGERR    =  FLAMERR_LIST[0] >= 0.0 ;
 
-  double LAMOBS, TRANS, flam, flamerr, flux;
+  double LAMOBS, TRANS, flam, flamerr ;
   double flux_sum=0.0, varflux_sum=0.0, T_max=0.0, T_sum=0.0 ;
   double lamstep, ZP, lammin, lammax, LT, frac_err ; 
   int  ifilt, NLAMFILT, ilam ; 
@@ -11291,6 +11599,8 @@ void GENSPEC_HOST_CONTAMINATION(int imjd) {
   //
   // Mar 10 2025: scale store host flux so that plotting Flam(host) on Flam(SN_host)
   //              makes sense
+  // Oct 15 2026: HOSTSNFRAC scale does not depend on imjd; compute once
+  //              per event and store in GENSPEC.SCALE_HOSTSNFRAC
   
   int    IS_HOST    = GENSPEC.IS_HOST[imjd];
   double HOSTFRAC   = (double)INPUTS.TAKE_SPECTRUM_HOSTFRAC;
@@ -11329,7 +11639,12 @@ void GENSPEC_HOST_CONTAMINATION(int imjd) {
     NOPT++ ;
   }
 
-  if ( HOSTSNFRAC > 0.001 ) {
+  if ( HOSTSNFRAC > 0.001 && GENSPEC.SCALE_HOSTSNFRAC >= 0.0 ) {
+    // re-use scale from previous SN spectrum in this event
+    SCALE_FLAM_HOST_CONTAM = GENSPEC.SCALE_HOSTSNFRAC ;
+    NOPT++ ;
+  }
+  else if ( HOSTSNFRAC > 0.001 ) {
     FSUM_PEAK = FSUM_HOST = 0.0 ;
     for(ilam=0; ilam < NBLAM; ilam++ ) {
       LAMAVG      = INPUTS_SPECTRO.LAMAVG_LIST[ilam] ;
@@ -11379,6 +11694,7 @@ void GENSPEC_HOST_CONTAMINATION(int imjd) {
     if ( !IS_HOST_ZEROFLUX ) 
       { SCALE_FLAM_HOST_CONTAM = HOSTSNFRAC * FSUM_PEAK / FSUM_HOST ; }
 
+    GENSPEC.SCALE_HOSTSNFRAC = SCALE_FLAM_HOST_CONTAM ;
     NOPT++ ;
   }
 
@@ -11735,15 +12051,19 @@ double GENSPEC_SMEAR(int imjd, double LAMMIN, double LAMMAX ) {
   //  Fix bug from v10_78 where GRAN_T no longer followed correlated option.
   //
   // Nov 10 2021: store LAMRANGE_VALID[imjd][0:1]
+  // Oct 15 2026: compute true SNR for all wave bins in one call to
+  //              getSNR_spectrograph_LIST after the LAMSMEAR loop.
 
   int    NBLAM = INPUTS_SPECTRO.NBIN_LAM ;
   int    MEMD  = NBLAM * sizeof(double);
+  int    MEMB  = NBLAM * sizeof(bool);
 
   GENPOLY_DEF *GENPOLY_SCALE_SNR = &INPUTS.SPECTROGRAPH_OPTIONS.GENPOLY_SCALE_SNR;
 
   int    ilam, ILAM_MIN=99999, ILAM_MAX=-9, NBLAM_USE=0 ;
   double GENFLUX, GENFLUXERR, GENFLUXERR_T, GENMAG, LAMAVG ;
   double *SNR_TRUE_LIST,   SNR_TRUE, *ERRFRAC_T_LIST, ERRFRAC_T ; 
+  bool   *USE_LIST ;
 
   double  TEXPOSE_S  = GENSPEC.TEXPOSE_LIST[imjd] ;
   double  TEXPOSE_T  = GENSPEC.TEXPOSE_TEMPLATE ;
@@ -11763,12 +12083,17 @@ double GENSPEC_SMEAR(int imjd, double LAMMIN, double LAMMAX ) {
 
   // - - - - - -
 
-  SNR_TRUE_LIST   = (double*) malloc( MEMD ) ;
-  ERRFRAC_T_LIST  = (double*) malloc( MEMD ) ;
+  // scratch is popped at DONE since this function is called
+  // iteratively for each spectrum (see GENSPEC_TEXPOSE_TAKE_SPECTRUM)
+  size_t ARENA_MARK = arena_mark(&ARENA_EVENT);
+  SNR_TRUE_LIST   = (double*) arena_alloc(&ARENA_EVENT, MEMD ) ;
+  ERRFRAC_T_LIST  = (double*) arena_alloc(&ARENA_EVENT, MEMD ) ;
+  USE_LIST        = (bool  *) arena_alloc(&ARENA_EVENT, MEMB ) ;
  	 
   for(ilam=0; ilam < NBLAM; ilam++ ) {
 
     SNR_TRUE_LIST[ilam] = -9.0 ;
+    USE_LIST[ilam]      = false ;
 
     LAMAVG = INPUTS_SPECTRO.LAMAVG_LIST[ilam] ;
     if ( LAMAVG < LAMMIN ) { continue; }
@@ -11794,21 +12119,13 @@ double GENSPEC_SMEAR(int imjd, double LAMMIN, double LAMMAX ) {
     if ( !DO_SEDMODEL && GENFLUX <= 0.0  ) { continue ; }
     if ( !DO_SEDMODEL && GENMAG  > 600.0 ) { continue ; } // Mar 2019
 
-    // get true SNR in this lambda bin
+    // true SNR is computed below; special case with ideal SNR 
+    // for true SED (HOSTLIB_OPTMASK=128)
     if ( DO_SEDMODEL ) {
-      // special case with ideal SNR for true SED (HOSTLIB_OPTMASK=128)
-      SNR_TRUE = 1000.0 ; 
-      ERRFRAC_T = 0.0 ;
-    }
-    else {
-      // nominal usage
-      SNR_TRUE =
-	getSNR_spectrograph(ilam, TEXPOSE_S, TEXPOSE_T, ALLOW_TEXTRAP, GENMAG,
-			    &ERRFRAC_T);  // template frac of error
+      SNR_TRUE_LIST[ilam]  = 1000.0 ;
+      ERRFRAC_T_LIST[ilam] = 0.0 ;
     }
-
-    SNR_TRUE_LIST[ilam]  = SNR_TRUE ;
-    ERRFRAC_T_LIST[ilam] = ERRFRAC_T ;
+    USE_LIST[ilam] = true ;
 
     // apply lambda smear to distribute GENFLUX over lambda bins 
     GENSPEC_LAMSMEAR(imjd, ilam, GENFLUX );
@@ -11825,6 +12142,14 @@ double GENSPEC_SMEAR(int imjd, double LAMMIN, double LAMMAX ) {
 
   if ( NBLAM_USE == 0 ) { goto DONE ; }
 
+  // get true SNR in each used lambda bin (nominal usage);
+  // ERRFRAC_T is template frac of error.
+  if ( !DO_SEDMODEL ) {
+    getSNR_spectrograph_LIST(ILAM_MIN, ILAM_MAX, TEXPOSE_S, TEXPOSE_T,
+			     ALLOW_TEXTRAP, USE_LIST, GENSPEC.GENMAG_LIST[imjd],
+			     SNR_TRUE_LIST, ERRFRAC_T_LIST);
+  }
+
   // - - - - - - - - - - - - - - 
   // after smearing flux in neighbor bins, loop again over wavelegth
   // and apply Poisson noise.
@@ -11890,9 +12215,7 @@ double GENSPEC_SMEAR(int imjd, double LAMMIN, double LAMMAX ) {
   */
 
  DONE:
-  free(SNR_TRUE_LIST);
-  free(ERRFRAC_T_LIST);
-
+  arena_rewind(&ARENA_EVENT, ARENA_MARK);
   return(SNR_SPEC) ;
 
 } // end GENSPEC_SMEAR
@@ -12525,7 +12848,9 @@ void gen_event_driver(int ilc) {
     // Note that SNHOST_DRIVER can change GENLC.REDSHIFT_CMB 
     // and DLMAG to match that of the HOST
     // Similarly, GENLC.REDSHIFT_HOST is changed to be the true zhost
+    start_STAGE_TIMER(ISTAGE_TIMER_HOST);
     GEN_SNHOST_DRIVER(zHOST, GENLC.PEAKMJD); 
+    end_STAGE_TIMER(ISTAGE_TIMER_HOST);
 
     // Jun 12 2020 
     //  if no SN par in WGTMAP, generate SN params after picking host
@@ -13129,6 +13454,8 @@ void gen_event_reject(int *ILC, SIMFILE_AUX_DEF *SIMFILE_AUX,
   //
   // Mar 18 2018: add separate category for NEPOCH 
   // May 29 2024: add new category for CRAZYFLUX
+  // Oct 14 2026: add new category for PRESCREEN (SNRMAX upper bound)
+  // Oct 15 2026: no dump files for in-memory stream (SIMSTREAM.USE)
   
   int ilc_orig, ilc;
   bool doReject_DUMP = false ;
@@ -13175,6 +13502,14 @@ void gen_event_reject(int *ILC, SIMFILE_AUX_DEF *SIMFILE_AUX,
     if(LDMP) { printf(" xxx %s CID=%d fails NEPOCH\n", fnam, GENLC.CID); fflush(stdout); }
   }
 
+  else if ( strcmp(REJECT_STAGE,"PRESCREEN") == 0 ) {  // Oct 2026
+    if ( INPUTS.NGEN_LC > 0 ) { ilc-- ; }
+    NGEN_REJECT.PRESCREEN++ ;
+    doReject_DUMP = doReject_SIMGEN_DUMP("CUTWIN");
+    REJECT = true;
+    if(LDMP) { printf(" xxx %s CID=%d fails PRESCREEN\n", fnam, GENLC.CID); fflush(stdout); }
+  }
+
   else if ( strcmp(REJECT_STAGE,"CRAZYFLUX") == 0 ) {  // May 29 2024
     if ( INPUTS.NGEN_LC > 0 ) { ilc-- ; }
     NGEN_REJECT.CRAZYFLUX++ ;
@@ -13189,6 +13524,8 @@ void gen_event_reject(int *ILC, SIMFILE_AUX_DEF *SIMFILE_AUX,
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
   }
 
+  if ( SIMSTREAM.USE ) { doReject_DUMP = REJECT = false; }
+
   int FLAG = FLAG_PROCESS_UPDATE;
   if ( doReject_DUMP ) {  wr_SIMGEN_DUMP(FLAG,SIMFILE_AUX); }
   if ( REJECT        ) {  wr_SIMGEN_DUMP_SL(FLAG,SIMFILE_AUX); }
@@ -13345,8 +13682,9 @@ double gen_MWEBV(double RA, double DEC) {
   for ( ifilt=0; ifilt < GENLC.NFILTDEF_OBS; ifilt++ ) {
     ifilt_obs  = GENLC.IFILTMAP_OBS[ifilt];
     LAMOBS     = (double)INPUTS.LAMAVG_OBS[ifilt_obs];
-    MCOR_MAP   = GALextinct( RV, AV_MAP,  LAMOBS, OPT, PARLIST, fnam );
-    MCOR_TRUE  = GALextinct( RV, AV_TRUE, LAMOBS, OPT, PARLIST, fnam );
+    // Oct 2026: XT/AV is stored per band; see GALextinct_cache
+    MCOR_MAP   = GALextinct_cache( RV, AV_MAP,  LAMOBS, OPT, PARLIST, fnam );
+    MCOR_TRUE  = GALextinct_cache( RV, AV_TRUE, LAMOBS, OPT, PARLIST, fnam );
     GENLC.MWXT_MAG[ifilt_obs] = MCOR_TRUE ; // Nov 2023
 
     // check PLASTICC option to actually correct fluxes for MW
@@ -14205,8 +14543,11 @@ void genran_modelSmear(void) {
   rmax = INPUTS.SIGMACLIP_MAGSMEAR[1] ;
 
 
-  // for global coherent smearing
-  GENLC.GENSMEAR_RANGauss_FILTER[0] = getRan_GaussClip(1,rmin,rmax);
+  // for global coherent smearing.
+  // Oct 15 2026: smear randoms use ISTAGE_RAN_SMEAR substream if 
+  //              RANDOM_STAGE is set (else legacy list as before)
+  GENLC.GENSMEAR_RANGauss_FILTER[0] = 
+    getRan_GaussClip_stage(ISTAGE_RAN_SMEAR, 1, rmin, rmax);
 
   // Jun 26 2019: check option for asymmetric smear
   double siglo = (double)INPUTS.GENMAG_SMEAR[0] ;
@@ -14228,7 +14569,7 @@ void genran_modelSmear(void) {
   RHO  = sqrt( 1.0 - rho*rho );
   
   for ( ifilt=1; ifilt < MXFILTINDX; ifilt++ ) {
-    rr8 = getRan_GaussClip(ILIST_RAN,rmin,rmax);
+    rr8 = getRan_GaussClip_stage(ISTAGE_RAN_SMEAR, ILIST_RAN, rmin, rmax);
     rtot =  rho * GENLC.GENSMEAR_RANGauss_FILTER[0] +  RHO * rr8 ; 
     GENLC.GENSMEAR_RANGauss_FILTER[ifilt]  = rtot ;      
   }
@@ -14240,9 +14581,9 @@ void genran_modelSmear(void) {
   }
 
   // set randoms for instrinsic scatter matrix (July 2011)
-  GENLC.COVMAT_SCATTER_GRAN[0] =  getRan_Gauss(1);
-  GENLC.COVMAT_SCATTER_GRAN[1] =  getRan_Gauss(1);
-  GENLC.COVMAT_SCATTER_GRAN[2] =  getRan_Gauss(1);
+  GENLC.COVMAT_SCATTER_GRAN[0] =  getRan_Gauss_stage(ISTAGE_RAN_SMEAR,1);
+  GENLC.COVMAT_SCATTER_GRAN[1] =  getRan_Gauss_stage(ISTAGE_RAN_SMEAR,1);
+  GENLC.COVMAT_SCATTER_GRAN[2] =  getRan_Gauss_stage(ISTAGE_RAN_SMEAR,1);
   GEN_COVMAT_SCATTER ( GENLC.COVMAT_SCATTER_GRAN,    // <== input 
 		       GENLC.COVMAT_SCATTER );       // <== output
   
@@ -14336,12 +14677,15 @@ void set_TIMERS(int flag) {
   // flag=0 -> start
   // flag=1 -> end of init
   // flat=2 -> end of job
+  //
+  // Oct 15 2026: flag=0 also inits STAGE_TIMERS
 
   char fnam[] = "set_TIMERS" ;
   // ---------- BEGIN -----------
 
   if ( flag == 0 ) {
     TIMERS.t_start = time(NULL);
+    init_STAGE_TIMERS();
   }
   else if ( flag == 1 ) {
     TIMERS.t_end_init    = time(NULL); // Mar 15 2020
@@ -14359,11 +14703,97 @@ void set_TIMERS(int flag) {
   return;
 } // end set_TIMERS
 
+
+// ***********************************************
+void init_STAGE_TIMERS(void) {
+
+  // Created Oct 2026
+  // Init cumulative timers for each stage of the generation loop.
+  // Names are used for stdout and for YAML keys
+  // TIME_STAGE_[NAME] and NCALL_STAGE_[NAME].
+
+  int istage;
+  // ---------- BEGIN -----------
+
+  sprintf(STAGE_TIMERS.NAME[ISTAGE_TIMER_HOST],     "HOST"     );
+  sprintf(STAGE_TIMERS.NAME[ISTAGE_TIMER_GENMAG],   "GENMAG"   );
+  sprintf(STAGE_TIMERS.NAME[ISTAGE_TIMER_GENMODEL], "GENMODEL" );
+  sprintf(STAGE_TIMERS.NAME[ISTAGE_TIMER_GENSPEC],  "GENSPEC"  );
+  sprintf(STAGE_TIMERS.NAME[ISTAGE_TIMER_GENFLUX],  "GENFLUX"  );
+  sprintf(STAGE_TIMERS.NAME[ISTAGE_TIMER_TRIGGER],  "TRIGGER"  );
+  sprintf(STAGE_TIMERS.NAME[ISTAGE_TIMER_OUTPUT],   "OUTPUT"   );
+
+  for(istage=0; istage < NSTAGE_TIMER; istage++ ) {
+    STAGE_TIMERS.T_START[istage] = 0.0 ;
+    STAGE_TIMERS.T_SUM[istage]   = 0.0 ;
+    STAGE_TIMERS.NCALL[istage]   = 0 ;
+  }
+
+  return;
+} // end init_STAGE_TIMERS
+
+// ***********************************************
+double get_wallTime_sec(void) {
+  // Created Oct 2026: monotonic wall time (sec) for stage timers.
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + 1.0E-9*(double)ts.tv_nsec ;
+} // end get_wallTime_sec
+
+// ***********************************************
+void start_STAGE_TIMER(int istage) {
+  // Created Oct 2026
+  STAGE_TIMERS.T_START[istage] = get_wallTime_sec();
+} 
+
+void end_STAGE_TIMER(int istage) {
+  // Created Oct 2026
+  double t_now = get_wallTime_sec();
+  STAGE_TIMERS.T_SUM[istage] += (t_now - STAGE_TIMERS.T_START[istage]);
+  STAGE_TIMERS.NCALL[istage]++ ;
+} 
+
+// ***********************************************
+void print_STAGE_TIMERS(void) {
+
+  // Created Oct 2026
+  // Print cumulative time, number of calls and time per call
+  // for each stage of the generation loop. GENMODEL is the
+  // model-evaluation part of GENMAG.
+
+  int istage ;
+  long long int NCALL;
+  double T_SUM, T_GEN = (double)(TIMERS.t_end - TIMERS.t_end_init);
+  char *NAME ;
+  // ---------- BEGIN -----------
+
+  printf("\n  Generation time per stage (GENMODEL=%s):\n", 
+	 INPUTS.MODELNAME);
+  printf("\t %-10s %10s %12s %12s  %s\n",
+	 "STAGE", "SEC", "NCALL", "MSEC/CALL", "FRAC" );
+
+  for(istage=0; istage < NSTAGE_TIMER; istage++ ) {
+    NAME  = STAGE_TIMERS.NAME[istage];
+    NCALL = STAGE_TIMERS.NCALL[istage];
+    T_SUM = STAGE_TIMERS.T_SUM[istage];
+    if ( NCALL == 0 ) { continue; }
+
+    printf("\t %-10s %10.2f %12lld %12.4f  %.3f\n",
+	   NAME, T_SUM, NCALL, 1000.0*T_SUM/(double)NCALL,
+	   T_SUM/(T_GEN+1.0E-9) );
+  }
+  fflush(stdout);
+
+  return;
+} // end print_STAGE_TIMERS
+
 // ***********************************************
 void wr_SIMGEN_YAML_SUMMARY(SIMFILE_AUX_DEF *SIMFILE_AUX) {
   
   // Write yaml-formatted summary to communicate with pipelines 
   // such as submit_batch_jobs.py or pippin.py.
+  //
+  // Oct 15 2026: write TIME_STAGE_[STAGE] and NCALL_STAGE_[STAGE]
 
   FILE *fp ;
   char *ptrFile  = SIMFILE_AUX->YAML ;
@@ -14385,6 +14815,16 @@ void wr_SIMGEN_YAML_SUMMARY(SIMFILE_AUX_DEF *SIMFILE_AUX) {
   fprintf(fp, "NGENSPEC_WRITE:  %d\n",    NGENSPEC_WRITE );
   fprintf(fp, "CPU_MINUTES:     %.2f\n",  t_gen/60.0     );
   fprintf(fp, "%s:   %d\n",    YAMLKEY_ABORT_IF_ZERO, NGENLC_WRITE   );
+
+  // Oct 2026: cumulative time and number of calls per stage
+  int istage;
+  fprintf(fp, "GENMODEL_NAME:   %s\n",    INPUTS.MODELNAME );
+  for(istage=0; istage < NSTAGE_TIMER; istage++ ) {
+    fprintf(fp, "TIME_STAGE_%s:  %.3f   # sec\n", 
+	    STAGE_TIMERS.NAME[istage], STAGE_TIMERS.T_SUM[istage] );
+    fprintf(fp, "NCALL_STAGE_%s: %lld\n", 
+	    STAGE_TIMERS.NAME[istage], STAGE_TIMERS.NCALL[istage] );
+  }
   
   // write a few extras when creating binary flux table for SIMSED model
   if ( SIMSED_BINARY_INFO.WRFLAG_FLUX ) {
@@ -14403,6 +14843,109 @@ void wr_SIMGEN_YAML_SUMMARY(SIMFILE_AUX_DEF *SIMFILE_AUX) {
 
 } // end wr_SIMGEN_YAML_SUMARY
 
+// ***********************************************
+void update_SIMGEN_STATUS(int OPT, SIMFILE_AUX_DEF *SIMFILE_AUX) {
+
+  // Created Oct 2026
+  // Write small YAML-formatted status file [VERSION].STATUS with
+  // cumulative counters (generated, rejected per stage, written),
+  // throughput and peak RSS, so that a workflow manager can detect
+  // stalled or slow jobs without parsing stdout. Counters are the
+  // same global counters incremented per event; nothing is rescanned.
+  // Called every event, but file is written only every
+  // INPUTS.STATUS_UPDATE_SEC seconds of wall time.
+  // File is written to temp file and renamed so that a reader
+  // never sees a partial file.
+  //
+  // OPT = OPT_STATUS_INIT   : init timers (first call)
+  // OPT = OPT_STATUS_UPDATE : write if update interval has elapsed
+  // OPT = OPT_STATUS_END    : final write with STATE: DONE
+
+  char   *ptrFile = SIMFILE_AUX->STATUS ;
+  double  t_now, t_run, t_dif, rate_tot, rate_recent = 0.0 ;
+  double  RSS_MB ;
+  struct  rusage RU ;
+  char    tmpFile[MXPATHLEN+8], STATE[12] ;
+  FILE   *fp ;
+  char fnam[] = "update_SIMGEN_STATUS" ;
+
+  // ------------ BEGIN ---------------
+
+  if ( INPUTS.STATUS_UPDATE_SEC <= 0.0 ) { return; }
+  if ( ptrFile[0] == 0 ) { return; }
+
+  t_now = get_wallTime_sec();
+
+  if ( OPT == OPT_STATUS_INIT ) {
+    SIMGEN_STATUS.T_START     = t_now ;
+    SIMGEN_STATUS.T_LAST      = t_now ;
+    SIMGEN_STATUS.NGENLC_LAST = 0 ;
+    SIMGEN_STATUS.NUPDATE     = 0 ;
+  }
+
+  t_dif = t_now - SIMGEN_STATUS.T_LAST ;
+  if ( OPT == OPT_STATUS_UPDATE && t_dif < INPUTS.STATUS_UPDATE_SEC ) 
+    { return; }
+
+  t_run    = t_now - SIMGEN_STATUS.T_START ;
+  rate_tot = (t_run > 0.0) ? (double)NGENLC_TOT / t_run : 0.0 ;
+  if ( t_dif > 0.0 ) 
+    { rate_recent = (double)(NGENLC_TOT - SIMGEN_STATUS.NGENLC_LAST)/t_dif; }
+
+  getrusage(RUSAGE_SELF, &RU);
+  RSS_MB = (double)RU.ru_maxrss / 1024.0 ; // ru_maxrss is KB on linux
+
+  if ( OPT == OPT_STATUS_END ) 
+    { sprintf(STATE, "DONE"); }
+  else
+    { sprintf(STATE, "RUNNING"); }
+
+  sprintf(tmpFile, "%s.TMP", ptrFile);
+  if ( (fp = fopen(tmpFile, "wt")) == NULL ) {       
+    sprintf ( c1err, "Cannot open SIMGEN STATUS file :" );
+    sprintf ( c2err," '%s' ", tmpFile );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  fprintf(fp, "STATE:              %s\n",   STATE );
+  fprintf(fp, "PID:                %d\n",   (int)getpid() );
+  fprintf(fp, "UPDATE_UNIX_TIME:   %ld\n",  (long)time(NULL) );
+  fprintf(fp, "NUPDATE:            %d\n",   SIMGEN_STATUS.NUPDATE+1 );
+  fprintf(fp, "NGENTOT_LC:         %d   # requested\n", INPUTS.NGENTOT_LC );
+  fprintf(fp, "NGENEV_TOT:         %d\n",   NGENEV_TOT     );
+  fprintf(fp, "NGENLC_TOT:         %d\n",   NGENLC_TOT     );
+  fprintf(fp, "NGENLC_WRITE:       %d\n",   NGENLC_WRITE   );
+  fprintf(fp, "NGENSPEC_WRITE:     %d\n",   NGENSPEC_WRITE );
+  fprintf(fp, "NREJECT_GENRANGE:   %d\n",   NGEN_REJECT.GENRANGE  );
+  fprintf(fp, "NREJECT_HOSTLIB:    %d\n",   NGEN_REJECT.HOSTLIB   );
+  fprintf(fp, "NREJECT_GENMAG:     %d\n",   NGEN_REJECT.GENMAG    );
+  fprintf(fp, "NREJECT_PRESCREEN:  %d\n",   NGEN_REJECT.PRESCREEN );
+  fprintf(fp, "NREJECT_SEARCHEFF:  %d\n",   NGEN_REJECT.SEARCHEFF );
+  fprintf(fp, "NREJECT_CUTWIN:     %d\n",   NGEN_REJECT.CUTWIN    );
+  fprintf(fp, "NREJECT_NEPOCH:     %d\n",   NGEN_REJECT.NEPOCH    );
+  fprintf(fp, "NREJECT_CRAZYFLUX:  %d\n",   NGEN_REJECT.CRAZYFLUX );
+  fprintf(fp, "WALLTIME_SEC:       %.1f   # since end of init\n", t_run );
+  fprintf(fp, "EVT_PER_SEC:        %.2f   # NGENLC_TOT/WALLTIME\n", 
+	  rate_tot);
+  fprintf(fp, "EVT_PER_SEC_RECENT: %.2f   # since previous update\n", 
+	  rate_recent);
+  fprintf(fp, "MAXRSS_MB:          %.1f\n",  RSS_MB );
+  fclose(fp);
+
+  if ( rename(tmpFile, ptrFile) != 0 ) {
+    sprintf ( c1err, "Cannot rename STATUS file" );
+    sprintf ( c2err," '%s' -> '%s' ", tmpFile, ptrFile );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  SIMGEN_STATUS.T_LAST      = t_now ;
+  SIMGEN_STATUS.NGENLC_LAST = NGENLC_TOT ;
+  SIMGEN_STATUS.NUPDATE++ ;
+
+  return;
+
+} // end update_SIMGEN_STATUS
+
 // ***********************************************
 void wr_SIMGEN_DUMP(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX) {
 
@@ -14443,6 +14986,9 @@ void wr_SIMGEN_DUMP(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX) {
     
   Jun 7 2022: protect SIMSED variables from checkAlternateVarNames_HOSTLIB.
 
+  Oct 15 2026: if SIMGEN_DUMP_FORMAT = BIN[Z], write columnar SNBIN
+               table via wr_SIMGEN_DUMP_BIN (no per-value text formatting).
+
   ****/
 
   double LAMBIN_SED_TRUE = INPUTS.SPECTROGRAPH_OPTIONS.LAMBIN_SED_TRUE;
@@ -14493,6 +15039,20 @@ void wr_SIMGEN_DUMP(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX) {
 
     NVAR = INPUTS.NVAR_SIMGEN_DUMP ; // update NVAR
 
+    // check all user-variables before writing NVAR to dump-file;
+    // abort if invalid variable is specified.
+    // ??? NVAR_ABORT_SIMGEN_DUMP = 0 ;
+
+    for ( ivar = 0; ivar < NVAR ; ivar++ ) {
+      pvar = INPUTS.VARNAME_SIMGEN_DUMP[ivar] ;
+      INDEX_SIMGEN_DUMP[ivar] = MATCH_INDEX_SIMGEN_DUMP(pvar);
+      if ( strstr(pvar,"WIDTH") ) { GENLC.NWIDTH_SIMGEN_DUMP++; }
+    } // end of ivar loop over user variables
+    if ( GENLC.NWIDTH_SIMGEN_DUMP>0 ) { init_lightCurveWidth(); }
+
+    if ( INPUTS.FORMAT_SIMGEN_DUMP != FORMAT_SIMGEN_DUMP_TEXT ) 
+      { wr_SIMGEN_DUMP_BIN(OPT_DUMP,SIMFILE_AUX);  return; }
+
     // allocate memory to hold one line of output
     // (for faster writing)
     SIMFILE_AUX->OUTLINE = (char *) malloc( 50 + sizeof(char)*NVAR*20 );
@@ -14508,17 +15068,6 @@ void wr_SIMGEN_DUMP(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX) {
 
     fp = SIMFILE_AUX->FP_DUMP ;
 
-    // check all user-variables before writing NVAR to dump-file;
-    // abort if invalid variable is specified.
-    // ??? NVAR_ABORT_SIMGEN_DUMP = 0 ;
-
-    for ( ivar = 0; ivar < NVAR ; ivar++ ) {
-      pvar = INPUTS.VARNAME_SIMGEN_DUMP[ivar] ;
-      INDEX_SIMGEN_DUMP[ivar] = MATCH_INDEX_SIMGEN_DUMP(pvar);
-      if ( strstr(pvar,"WIDTH") ) { GENLC.NWIDTH_SIMGEN_DUMP++; }
-    } // end of ivar loop over user variables
-    if ( GENLC.NWIDTH_SIMGEN_DUMP>0 ) { init_lightCurveWidth(); }
-
     // - - - - - - - - - 
     // now write header info to dump file.
     fprintf(fp, "#\n"  );
@@ -14559,6 +15108,9 @@ void wr_SIMGEN_DUMP(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX) {
     // check pre-scale (Aug 2017)
     if ( fmod(XN,XNPS) != 0 ) { return; }
 
+    if ( INPUTS.FORMAT_SIMGEN_DUMP != FORMAT_SIMGEN_DUMP_TEXT ) 
+      { wr_SIMGEN_DUMP_BIN(OPT_DUMP,SIMFILE_AUX);  return; }
+
     fp = SIMFILE_AUX->FP_DUMP ;
 
     sprintf(SIMFILE_AUX->OUTLINE, "SN: " );
@@ -14623,6 +15175,8 @@ void wr_SIMGEN_DUMP(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX) {
 
 
   if ( OPT_DUMP == FLAG_PROCESS_END ) {
+    if ( INPUTS.FORMAT_SIMGEN_DUMP != FORMAT_SIMGEN_DUMP_TEXT ) 
+      { wr_SIMGEN_DUMP_BIN(OPT_DUMP,SIMFILE_AUX);  return; }
     free(SIMFILE_AUX->OUTLINE);
     fclose(SIMFILE_AUX->FP_DUMP);
     printf("  %s\n", ptrFile ); fflush(stdout);
@@ -14632,6 +15186,109 @@ void wr_SIMGEN_DUMP(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX) {
 
 } // end of wr_SIMGEN_DUMP
 
+
+// ***********************************************
+void wr_SIMGEN_DUMP_BIN(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX) {
+
+  // Created Oct 2026
+  // Binary columnar version of wr_SIMGEN_DUMP using the SNBIN
+  // table backend (sntools_output_bin.c). Each column is attached
+  // directly to the SIMGEN_DUMP pointer, so that an update is only
+  // a memcpy per column into a buffered chunk; no text formatting.
+  // Output file is [VERSION].DUMP.SNBIN, readable by any SNTABLE
+  // reader (e.g., sntable_dump.pl, or SNANA codes that read FITRES).
+  // For SIMGEN_DUMP_FORMAT = BINZ, each chunk is zlib-compressed.
+  //
+  // Column cast is fixed here at init based on which SIMGEN_DUMP
+  // pointer was re-assigned away from SIMGEN_DUMMY. Prescale is
+  // applied by the caller.
+  //
+  // Note that with multi-threaded sim, each worker's SNBIN file
+  // keeps its unique name; they are not concatenated by
+  // merge_simThreads.
+
+  int  NVAR, ivar, index ;
+  char *pvar, *ptrFile, tableVar[80], OPENOPT[40], comment[200] ;
+  void *ptrCol ;
+  char BLOCKVAR[] = "VAR" ;
+  char fnam[] = "wr_SIMGEN_DUMP_BIN" ;
+
+  // --------------- BEGIN ----------
+
+  ptrFile = SIMFILE_AUX->DUMP ;
+
+  if ( OPT_DUMP == FLAG_PROCESS_INIT ) {
+
+    strcat(ptrFile,".SNBIN");
+    sprintf(OPENOPT,"new bin");
+    if ( INPUTS.FORMAT_SIMGEN_DUMP == FORMAT_SIMGEN_DUMP_BINZ ) 
+      { strcat(OPENOPT," compress"); }
+
+    TABLEFILE_INIT();
+    TABLEFILE_OPEN(ptrFile, OPENOPT);
+
+    sprintf(comment,"Simulation SUMMARY: one row per event.");
+    STORE_TABLEFILE_COMMENT(comment);
+    sprintf(comment," MODEL:     %s", INPUTS.GENMODEL );
+    STORE_TABLEFILE_COMMENT(comment);
+    sprintf(comment," PRESCALE:  %d", INPUTS.PRESCALE_SIMGEN_DUMP );
+    STORE_TABLEFILE_COMMENT(comment);
+    if  ( INPUTS.IFLAG_SIMGEN_DUMPALL )
+      { sprintf(comment," SELECTION: NONE (write every generated event)"); }
+    else
+      { sprintf(comment," SELECTION: Pass Trigger + Cuts"); }
+    STORE_TABLEFILE_COMMENT(comment);
+
+    SNTABLE_CREATE(IDTABLE_SIMGEN_DUMP, "SIMGEN_DUMP", "KEY");
+
+    NVAR = INPUTS.NVAR_SIMGEN_DUMP ;
+    for ( ivar=0; ivar < NVAR; ivar++ ) {
+      pvar  = INPUTS.VARNAME_SIMGEN_DUMP[ivar] ;
+      index = INDEX_SIMGEN_DUMP[ivar] ;
+
+      if ( SIMGEN_DUMP[index].PTRVAL4 != &SIMGEN_DUMMY.VAL4 ) {
+	ptrCol = SIMGEN_DUMP[index].PTRVAL4 ;
+	sprintf(tableVar, "%s:F", pvar);
+      }
+      else if ( SIMGEN_DUMP[index].PTRVAL8 != &SIMGEN_DUMMY.VAL8 ) {
+	ptrCol = SIMGEN_DUMP[index].PTRVAL8 ;
+	sprintf(tableVar, "%s:D", pvar);
+      }
+      else if ( SIMGEN_DUMP[index].PTRINT4 != &SIMGEN_DUMMY.IVAL4 ) {
+	ptrCol = SIMGEN_DUMP[index].PTRINT4 ;
+	sprintf(tableVar, "%s:I", pvar);
+      }
+      else if ( SIMGEN_DUMP[index].PTRINT8 != &SIMGEN_DUMMY.IVAL8 ) {
+	ptrCol = SIMGEN_DUMP[index].PTRINT8 ;
+	sprintf(tableVar, "%s:L", pvar);
+      }
+      else if ( SIMGEN_DUMP[index].PTRCHAR != SIMGEN_DUMMY.CVAL ) {
+	ptrCol = SIMGEN_DUMP[index].PTRCHAR ;
+	sprintf(tableVar, "%s:C*40", pvar);
+      }
+      else {
+	sprintf(c1err,"no pointer for variable %d (%s)", ivar, pvar);
+	errmsg(SEV_FATAL, 0, fnam, c1err, "" ); 
+      }
+
+      SNTABLE_ADDCOL(IDTABLE_SIMGEN_DUMP, BLOCKVAR, ptrCol, tableVar, 1);
+    }
+
+    printf("\t open %s (%d columns)\n", ptrFile, NVAR );
+    fflush(stdout);
+  }
+  else if ( OPT_DUMP == FLAG_PROCESS_UPDATE ) {
+    SNTABLE_FILL(IDTABLE_SIMGEN_DUMP);
+  }
+  else if ( OPT_DUMP == FLAG_PROCESS_END ) {
+    TABLEFILE_CLOSE(ptrFile);
+    printf("  %s\n", ptrFile ); fflush(stdout);
+  }
+
+  return ;
+
+} // end wr_SIMGEN_DUMP_BIN
+
 // ***********************************************
 void wr_SIMGEN_DUMP_SL(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX) {
 
@@ -16842,8 +17499,11 @@ void gen_redshift_LCLIB(void) {
 
   GENLC.REDSHIFT_HELIO = ZHEL_TRUE ;
   GENLC.REDSHIFT_CMB   = ZCMB_TRUE ;
-  if ( LCLIB_INFO.IPAR_REDSHIFT > 0  ) 
-    { GEN_SNHOST_DRIVER(ZHEL_TRUE, GENLC.PEAKMJD); }
+  if ( LCLIB_INFO.IPAR_REDSHIFT > 0  ) {
+    start_STAGE_TIMER(ISTAGE_TIMER_HOST);
+    GEN_SNHOST_DRIVER(ZHEL_TRUE, GENLC.PEAKMJD); 
+    end_STAGE_TIMER(ISTAGE_TIMER_HOST);
+  }
   else
     { SNHOSTGAL.ZPHOT = SNHOSTGAL.ZPHOT_ERR  = 0.0 ; }
 
@@ -17222,6 +17882,9 @@ double genz_hubble ( double zmin, double zmax, RATEPAR_DEF *RATEPAR ) {
       (USE_FLAT || USE_SIMLIB_DISTANCE || USE_SIMLIB_REDSHIFT)
 
    Nov 24 2019: if zmin == zmax, return immediately
+   Oct 15 2026: if DNDZ_ICDF is set, pick z from tabulated inverse-CDF
+                (one random per event, no dVdz calls); see 
+                genz_hubble_ICDF.
 
   *****************/
 
@@ -17252,6 +17915,11 @@ double genz_hubble ( double zmin, double zmax, RATEPAR_DEF *RATEPAR ) {
 
   if ( ISFLAT ) { RATEPAR->ZGENWGT_MAX = 1.0 ; goto PICKRAN ;  }
 
+  if ( INPUTS.DNDZ_ICDF && !INPUTS.USE_SIMLIB_DISTANCE ) {
+    zran = genz_hubble_ICDF(zmin, zmax, RATEPAR);
+    if ( zran > 0.0 ) { return(zran); }  // else z-range is not in table
+  }
+
   // get max wgt if zmin or zmax have changed.
   NEWZRANGE = ( ( zmin != RATEPAR->ZGENMIN_STORE) || 
 		( zmax != RATEPAR->ZGENMAX_STORE) );
@@ -17348,6 +18016,149 @@ double genz_hubble ( double zmin, double zmax, RATEPAR_DEF *RATEPAR ) {
 }  // end of genz_hubble
 
 
+// *******************************************
+double genz_hubble_ICDF(double zmin, double zmax, RATEPAR_DEF *RATEPAR ) {
+
+  // Created Oct 2026
+  // Return random redshift between zmin & zmax drawn from the
+  // tabulated inverse-CDF of dN/dz (see init_genz_ICDF). Table
+  // covers GENRANGE_REDSHIFT, and is built on first call. 
+  // A sub-range (e.g., SIMLIB redshift window) is drawn by restricting
+  // the random CDF value to [CDF(zmin),CDF(zmax)].
+  // Returns -9 if [zmin,zmax] is outside the table, so that caller
+  // falls back to rejection method.
+
+  double ZMIN_TABLE = INPUTS.GENRANGE_REDSHIFT[0];
+  double ZMAX_TABLE = INPUTS.GENRANGE_REDSHIFT[1];
+  int    NZ, iz, k ;
+  double *CDF, DZ, x, frac, c0, c1, u, zran ;
+  //  char fnam[] = "genz_hubble_ICDF" ;
+
+  // ----------- BEGIN ------------
+
+  if ( RATEPAR->NZ_ICDF == 0 ) 
+    { init_genz_ICDF(ZMIN_TABLE, ZMAX_TABLE, RATEPAR); }
+
+  NZ  = RATEPAR->NZ_ICDF ;
+  CDF = RATEPAR->CDF_ICDF ;
+  DZ  = RATEPAR->DZ_ICDF ;
+
+  x = (zmin - RATEPAR->ZMIN_ICDF) / DZ ;
+  if ( x < -1.0E-9 || zmax > RATEPAR->ZMIN_ICDF + DZ*(NZ-1)*(1.0+1.0E-9) )
+    { return(-9.0); }
+
+  // CDF at edges of requested z-range (uniform z grid -> O(1) lookup)
+  iz = (int)x;  if ( iz > NZ-2 ) { iz = NZ-2; }  if ( iz < 0 ) { iz=0; }
+  frac = x - (double)iz ;
+  c0   = CDF[iz] + frac*(CDF[iz+1]-CDF[iz]) ;
+
+  x  = (zmax - RATEPAR->ZMIN_ICDF) / DZ ;
+  iz = (int)x;  if ( iz > NZ-2 ) { iz = NZ-2; }
+  frac = x - (double)iz ;
+  c1   = CDF[iz] + frac*(CDF[iz+1]-CDF[iz]) ;
+
+  if ( c1 <= c0 ) { return(-9.0); } // zero rate in this window
+
+  u = c0 + (c1-c0) * getRan_Flat1(1) ;
+
+  // guide table gives starting node; walk forward to bracket u
+  k  = (int)( (double)(NZ-1) * u / CDF[NZ-1] );
+  if ( k > NZ-1 ) { k = NZ-1; }
+  iz = RATEPAR->GUIDE_ICDF[k];
+  if ( iz > 0 ) { iz-- ; }
+  while ( iz < NZ-2 && CDF[iz+1] < u ) { iz++ ; }
+
+  // linear CDF within node interval (constant dN/dz per interval)
+  frac = 0.0 ;
+  if ( CDF[iz+1] > CDF[iz] ) { frac = (u - CDF[iz])/(CDF[iz+1]-CDF[iz]); }
+  zran = RATEPAR->ZMIN_ICDF + DZ*((double)iz + frac) ;
+
+  if ( zran < zmin ) { zran = zmin; }
+  if ( zran > zmax ) { zran = zmax; }
+  return(zran);
+
+} // end genz_hubble_ICDF
+
+
+// *******************************************
+void init_genz_ICDF(double zmin, double zmax, RATEPAR_DEF *RATEPAR ) {
+
+  // Created Oct 2026
+  // Tabulate cumulative dN/dz (same weight as genz_hubble rejection
+  // method, including rate model, DNDZ_[Z,Z1]POLY_REWGT & ZEXP_REWGT)
+  // on a uniform z grid, and fill guide table for O(1) inversion.
+
+  double DZ_TARGET = 5.0E-4 ;
+  int    NZ, iz, k ;
+  double DZ, z, w, w_last, *CDF ;
+  char   fnam[] = "init_genz_ICDF" ;
+
+  // ----------- BEGIN ------------
+
+  NZ = (int)( (zmax-zmin)/DZ_TARGET ) + 1 ;
+  if ( NZ < 100 ) { NZ = 100; }
+  DZ = (zmax-zmin) / (double)(NZ-1) ;
+
+  RATEPAR->ZMIN_ICDF  = zmin ;
+  RATEPAR->DZ_ICDF    = DZ ;
+  RATEPAR->CDF_ICDF   = (double*) malloc( NZ * sizeof(double) );
+  RATEPAR->GUIDE_ICDF = (int   *) malloc( NZ * sizeof(int)    );
+  CDF = RATEPAR->CDF_ICDF ;
+
+  w_last = 0.0 ;
+  for ( iz=0; iz < NZ; iz++ ) {
+    z = zmin + DZ*(double)iz ;
+    w = genz_dNdz(z, RATEPAR);
+    if ( w < 0.0 ) { w = 0.0; }   // never accepted by rejection method
+    if ( iz == 0 ) 
+      { CDF[iz] = 0.0 ; }
+    else
+      { CDF[iz] = CDF[iz-1] + 0.5*(w+w_last)*DZ ; }
+    w_last = w ;
+  }
+
+  if ( CDF[NZ-1] <= 0.0 ) {
+    print_preAbort_banner(fnam);
+    printf("\t RATE MODEL = '%s' \n", RATEPAR->NAME );
+    sprintf(c1err,"Integral of dN/dz*wgt = 0   ?!?!?");
+    sprintf(c2err,"zmin=%f zmax=%f", zmin, zmax);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  iz = 0 ;
+  for ( k=0; k < NZ; k++ ) {
+    while ( iz < NZ-1 && CDF[iz] < CDF[NZ-1]*(double)k/(double)(NZ-1) ) 
+      { iz++ ; }
+    RATEPAR->GUIDE_ICDF[k] = iz ;
+  }
+
+  RATEPAR->NZ_ICDF = NZ ;
+
+  printf("  %s: %d z nodes for %.4f < z < %.4f (rate model %s)\n",
+	 fnam, NZ, zmin, zmax, RATEPAR->NAME );
+  fflush(stdout);
+
+} // end init_genz_ICDF
+
+
+// *******************************************
+double genz_dNdz(double z, RATEPAR_DEF *RATEPAR) {
+
+  // Created Oct 2026
+  // Return un-normalized dN/dz used to generate redshifts.
+  char fnam[] = "genz_dNdz" ;
+  double w;
+  if ( strcmp(RATEPAR->NAME,"ZPOLY") == 0 ) 
+    { w = eval_GENPOLY(z, &RATEPAR->MODEL_ZPOLY, fnam) ; }
+  else {
+    w  = dVdz (z, &INPUTS.HzFUN_INFO);
+    w /= (1.0+z);
+    w *= genz_wgt(z,RATEPAR) ;
+  }
+  return(w);
+} // end genz_dNdz
+
+
 // *******************************************
 double genz_wgt(double z, RATEPAR_DEF *RATEPAR ) {
 
@@ -17450,6 +18261,10 @@ void  init_RATEPAR ( RATEPAR_DEF *RATEPAR ) {
   RATEPAR->ZGENWGT_MAX = 0.0;
   RATEPAR->ZGENMIN_STORE =  RATEPAR->ZGENMAX_STORE = 0.0 ; 
 
+  RATEPAR->NZ_ICDF    = 0 ;
+  RATEPAR->CDF_ICDF   = NULL ;
+  RATEPAR->GUIDE_ICDF = NULL ;
+
 } // end init_RATEPAR
 
 
@@ -17879,11 +18694,144 @@ void SIMLIB_INIT_DRIVER(void) {
 
   if ( INPUTS.INIT_ONLY == 1 ) { return; } 
 
+  SIMLIB_INIT_INDEX();      // 1024-bit of SIMLIB_MSKOPT
+  SIMLIB_INIT_CACHE();      // 2048-bit of SIMLIB_MSKOPT
+
   SIMLIB_findStart();    // find first LIBID to start reading
 
 } // end SIMLIB_INIT
 
 
+// *************************************************
+void SIMLIB_malloc_OBS(int NOBS_NEED) {
+
+  // Created Oct 2026
+  // Make sure that [obs] arrays in SIMLIB_OBS_RAW, SIMLIB_OBS_GEN
+  // and SIMLIB_LIST_forSORT have at least NOBS_NEED elements.
+  // Arrays start with MXOBS_SIMLIB_INIT and double as needed,
+  // but never exceed MXOBS_SIMLIB so that existing MXOBS_SIMLIB
+  // checks/aborts remain valid. New elements are zeroed (as for
+  // the original static arrays), then get init_event_GENLC values.
+
+  int MXOLD = SIMLIB_OBS_RAW.MXOBS_ALLOC ;
+  int MXNEW, i ;
+  char fnam[] = "SIMLIB_malloc_OBS" ;
+
+  // ------------ BEGIN ------------
+
+  if ( NOBS_NEED <= MXOLD ) { return ; }
+
+  MXNEW = 2*MXOLD ;
+  if ( MXNEW < MXOBS_SIMLIB_INIT ) { MXNEW = MXOBS_SIMLIB_INIT; }
+  if ( MXNEW < NOBS_NEED         ) { MXNEW = NOBS_NEED; }
+  if ( MXNEW > MXOBS_SIMLIB      ) { MXNEW = MXOBS_SIMLIB; }
+  if ( MXNEW <= MXOLD ) { return ; } // callers check MXOBS_SIMLIB
+
+  SIMLIB_realloc_OBS(&SIMLIB_OBS_RAW, MXOLD, MXNEW);
+  SIMLIB_realloc_OBS(&SIMLIB_OBS_GEN, MXOLD, MXNEW);
+
+  SIMLIB_LIST_forSORT.INDEX_SORT = (int*)
+    realloc(SIMLIB_LIST_forSORT.INDEX_SORT, MXNEW*sizeof(int) );
+  SIMLIB_LIST_forSORT.MJD = (double*)
+    realloc(SIMLIB_LIST_forSORT.MJD, MXNEW*sizeof(double) );
+
+  if ( SIMLIB_OBS_RAW.MJD == NULL || SIMLIB_LIST_forSORT.MJD == NULL ) {
+    sprintf(c1err,"Could not allocate %d SIMLIB obs (was %d)", 
+	    MXNEW, MXOLD);
+    sprintf(c2err,"Check memory");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ) ; 
+  }
+
+  // FIELDNAME and BAND may have moved -> reset all pointers
+  for(i=0; i < MXNEW; i++ ) {
+    SIMLIB_OBS_RAW.PTR_FIELDNAME[i] = SIMLIB_OBS_RAW.FIELDNAME[i] ;
+    SIMLIB_OBS_RAW.PTR_BAND[i]      = SIMLIB_OBS_RAW.BAND[i] ;
+    SIMLIB_OBS_GEN.PTR_FIELDNAME[i] = SIMLIB_OBS_GEN.FIELDNAME[i] ;
+    SIMLIB_OBS_GEN.PTR_BAND[i]      = SIMLIB_OBS_GEN.BAND[i] ;
+  }
+
+  // same init as in init_event_GENLC for new elements
+  for(i=MXOLD; i < MXNEW; i++ ) {
+    SIMLIB_OBS_GEN.IFILT_OBS[i]  = -9 ;
+    SIMLIB_OBS_GEN.MJD[i]        = -99. ;
+    SIMLIB_OBS_GEN.CCDGAIN[i]    = -99. ;
+    SIMLIB_OBS_GEN.SKYSIG[i]     = -99. ;
+    SIMLIB_OBS_GEN.READNOISE[i]  = -99. ;
+    SIMLIB_OBS_GEN.PSFSIG1[i]    = -99. ;
+    SIMLIB_OBS_GEN.PSFSIG2[i]    = -99. ;
+    SIMLIB_OBS_GEN.PSFRATIO[i]   = -99. ;
+    SIMLIB_OBS_GEN.PSF_FWHM[i]   = -99. ;
+    SIMLIB_OBS_GEN.NEA[i]        = -99. ;
+    SIMLIB_OBS_GEN.ZPTADU[i]     = -99. ;
+    SIMLIB_OBS_GEN.ZPTERR[i]     = -99. ;
+    SIMLIB_OBS_GEN.TEMPLATE_ZPT[i] = -99. ;
+  }
+
+  SIMLIB_OBS_RAW.MXOBS_ALLOC = MXNEW ;
+  SIMLIB_OBS_GEN.MXOBS_ALLOC = MXNEW ;
+
+  if ( MXOLD > 0 ) {
+    printf("\t %s: increase SIMLIB obs arrays from %d to %d \n",
+	   fnam, MXOLD, MXNEW );
+    fflush(stdout);
+  }
+
+  return ;
+
+} // end SIMLIB_malloc_OBS
+
+
+// *************************************************
+void SIMLIB_realloc_OBS(SIMLIB_OBS_DEF *OBS, int MXOLD, int MXNEW) {
+
+  // Created Oct 2026
+  // realloc each [obs] array of *OBS from MXOLD to MXNEW elements,
+  // and zero the new elements.
+
+#define REALLOC_SIMLIB_OBS(ARR) {					\
+    size_t sz = sizeof(OBS->ARR[0]) ;					\
+    OBS->ARR  = realloc(OBS->ARR, MXNEW*sz) ;				\
+    memset((char*)OBS->ARR + MXOLD*sz, 0, (MXNEW-MXOLD)*sz); }
+
+  // ------------ BEGIN ------------
+
+  REALLOC_SIMLIB_OBS(OPTLINE);
+  REALLOC_SIMLIB_OBS(IFILT_OBS);
+  REALLOC_SIMLIB_OBS(PTR_BAND);
+  REALLOC_SIMLIB_OBS(BAND);
+  REALLOC_SIMLIB_OBS(IDEXPT);
+  REALLOC_SIMLIB_OBS(NEXPOSE);
+  REALLOC_SIMLIB_OBS(DETNUM);
+  REALLOC_SIMLIB_OBS(MJD);
+  REALLOC_SIMLIB_OBS(CCDGAIN);
+  REALLOC_SIMLIB_OBS(READNOISE);
+  REALLOC_SIMLIB_OBS(SKYSIG);
+  REALLOC_SIMLIB_OBS(PSFSIG1);
+  REALLOC_SIMLIB_OBS(PSFSIG2);
+  REALLOC_SIMLIB_OBS(PSFRATIO);
+  REALLOC_SIMLIB_OBS(PSF_FWHM);
+  REALLOC_SIMLIB_OBS(NEA);
+  REALLOC_SIMLIB_OBS(ZPTADU);
+  REALLOC_SIMLIB_OBS(ZPTERR);
+  REALLOC_SIMLIB_OBS(MAG);
+  REALLOC_SIMLIB_OBS(PIXSIZE);
+  REALLOC_SIMLIB_OBS(PTR_FIELDNAME);
+  REALLOC_SIMLIB_OBS(FIELDNAME);
+  REALLOC_SIMLIB_OBS(APPEND_PHOTFLAG);
+  REALLOC_SIMLIB_OBS(TEMPLATE_SKYSIG);
+  REALLOC_SIMLIB_OBS(TEMPLATE_READNOISE);
+  REALLOC_SIMLIB_OBS(TEMPLATE_ZPT);
+  REALLOC_SIMLIB_OBS(ISTORE_RAW);
+  REALLOC_SIMLIB_OBS(ISEASON);
+  REALLOC_SIMLIB_OBS(IFILT_SPECTROGRAPH);
+  REALLOC_SIMLIB_OBS(INDX_TAKE_SPECTRUM);
+  REALLOC_SIMLIB_OBS(TEXPOSE_SPECTROGRAPH);
+
+  return ;
+
+} // end SIMLIB_realloc_OBS
+
+
 // *************************************************
 void SIMLIB_initGlobalHeader(void) {
 
@@ -18382,6 +19330,440 @@ void SIMLIB_INIT_IDEAL_GRID(void) {
 
 } // end SIMLIB_INIT_IDEAL_GRID
 
+// ===================================
+void SIMLIB_INIT_INDEX(void) {
+
+  // Created Oct 2026
+  // For SIMLIB_MSKOPT += 1024, make one fast pass thru the SIMLIB file
+  // and store the file offset of each "LIBID:" line in SIMLIB_INDEX.
+  // SIMLIB_findStart then jumps to the start LIBID with fseek
+  // instead of parsing every preceding LIBID; this matters for
+  // large SIMLIBs with high JOBID, IDSTART or IDLOCK, and for each
+  // worker re-opening the SIMLIB (SIMLIB_reopen_simThread).
+  // If global header is missing NLIBID key, NLIBID is set here
+  // so that batch jobs auto-compute their start LIBID.
+  // Index is also built for SIMLIB cache (SIMLIB_MSKOPT += 2048).
+  //
+  // Index is disabled for gzipped SIMLIB since popen cannot fseek.
+
+  int  MASK   = SIMLIB_MSKOPT_INDEX_LIBID + SIMLIB_MSKOPT_CACHE_LIBID ;
+  int  USE    = INPUTS.SIMLIB_MSKOPT & MASK ;
+  int  LIBID, NLIBID = 0, MEMI, MEML ;
+  long OFFSET ;
+  bool NEWLINE = true ;
+  char LINE[MXPATHLEN], *ptr ;
+  time_t t0 = time(NULL) ;
+  char fnam[] = "SIMLIB_INIT_INDEX" ;
+
+  // ----------- BEGIN ---------
+
+  SIMLIB_INDEX.USE    = false ;
+  SIMLIB_INDEX.NLIBID = SIMLIB_INDEX.NALLOC = 0 ;
+
+  if ( !USE ) { return ; }
+
+  print_banner(fnam);
+
+  if ( INPUTS.SIMLIB_GZIPFLAG ) {
+    printf("\t WARNING: cannot index gzipped SIMLIB -> "
+	   "ignore SIMLIB_MSKOPT=%d bit\n", SIMLIB_MSKOPT_INDEX_LIBID);
+    fflush(stdout);
+    return ;
+  }
+
+  SIMLIB_INDEX.NALLOC = 1000 ;
+  MEMI = SIMLIB_INDEX.NALLOC * sizeof(int);
+  MEML = SIMLIB_INDEX.NALLOC * sizeof(long);
+  SIMLIB_INDEX.LIBID  = (int *) malloc(MEMI);
+  SIMLIB_INDEX.OFFSET = (long*) malloc(MEML);
+
+  SIMLIB_INDEX.OFFSET_BEGIN = ftell(fp_SIMLIB);
+  OFFSET = SIMLIB_INDEX.OFFSET_BEGIN ;
+
+  while ( fgets(LINE, MXPATHLEN, fp_SIMLIB) != NULL ) {
+
+    // only check start of line; skip continuation of very long line
+    if ( NEWLINE ) {
+      ptr = LINE ;
+      while ( *ptr == ' ' || *ptr == '\t' ) { ptr++ ; }
+
+      if ( *ptr == 'E' && strncmp(ptr,"END_OF_SIMLIB:",14) == 0 ) 
+	{ break; }
+
+      if ( *ptr == 'L' && strncmp(ptr,"LIBID:",6) == 0 ) {
+	sscanf(&ptr[6], "%d", &LIBID);
+
+	if ( NLIBID == SIMLIB_INDEX.NALLOC ) {
+	  SIMLIB_INDEX.NALLOC += 1000 ;
+	  MEMI = SIMLIB_INDEX.NALLOC * sizeof(int);
+	  MEML = SIMLIB_INDEX.NALLOC * sizeof(long);
+	  SIMLIB_INDEX.LIBID  = (int *) realloc(SIMLIB_INDEX.LIBID,  MEMI);
+	  SIMLIB_INDEX.OFFSET = (long*) realloc(SIMLIB_INDEX.OFFSET, MEML);
+	}
+	SIMLIB_INDEX.LIBID[NLIBID]  = LIBID ;
+	SIMLIB_INDEX.OFFSET[NLIBID] = OFFSET ;
+	NLIBID++ ;
+      }
+    }
+
+    NEWLINE = ( strchr(LINE,'\n') != NULL );
+    OFFSET  = ftell(fp_SIMLIB);
+  }
+
+  if ( NLIBID == 0 ) {
+    sprintf(c1err,"Found zero LIBID keys in SIMLIB_FILE");
+    sprintf(c2err,"%s", INPUTS.SIMLIB_OPENFILE);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ) ;
+  }
+
+  SIMLIB_INDEX.NLIBID = NLIBID ;
+  SIMLIB_INDEX.USE    = true ;
+
+  if ( SIMLIB_GLOBAL_HEADER.NLIBID <= 0 ) 
+    { SIMLIB_GLOBAL_HEADER.NLIBID = NLIBID; }
+
+  // return to location just after global header
+  clearerr(fp_SIMLIB);
+  fseek(fp_SIMLIB, SIMLIB_INDEX.OFFSET_BEGIN, SEEK_SET);
+
+  printf("\t Stored file offset for %d LIBIDs (%d seconds)\n",
+	 NLIBID, (int)(time(NULL)-t0) );
+  fflush(stdout);
+
+  return ;
+
+} // end SIMLIB_INIT_INDEX
+
+
+// ===================================
+int SIMLIB_seek_INDEX(int NSKIP_LIBID, int IDSEEK) {
+
+  // Created Oct 2026
+  // Use SIMLIB_INDEX to position fp_SIMLIB at the start of
+  //  + entry NSKIP_LIBID (i.e., after skipping NSKIP_LIBID LIBIDs), or
+  //  + first entry with LIBID >= IDSEEK (IDSEEK > 0)
+  // Functions returns 1 if file is positioned; returns 0 if
+  // index is not available so that caller uses legacy read-and-skip.
+
+  int  NLIBID = SIMLIB_INDEX.NLIBID ;
+  int  ENTRY  = -9, i ;
+  char fnam[] = "SIMLIB_seek_INDEX" ;
+
+  // ----------- BEGIN ---------
+
+  if ( !SIMLIB_INDEX.USE ) { return 0 ; }
+
+  if ( NSKIP_LIBID > 0 ) 
+    { ENTRY = NSKIP_LIBID % NLIBID ; }
+  else if ( IDSEEK > 0 ) {
+    for(i=0; i < NLIBID; i++ ) {
+      if ( SIMLIB_INDEX.LIBID[i] >= IDSEEK ) { ENTRY = i; break; }
+    }
+    if ( ENTRY < 0 ) {
+      sprintf(c1err,"Could not find LIBID >= %d in SIMLIB index", IDSEEK);
+      sprintf(c2err,"Try again with smaller SIMLIB_IDSTART or IDLOCK.");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err ) ;
+    }
+  }
+  else
+    { return 1 ; } // start at first LIBID
+
+  clearerr(fp_SIMLIB);
+  fseek(fp_SIMLIB, SIMLIB_INDEX.OFFSET[ENTRY], SEEK_SET);
+
+  return 1 ;
+
+} // end SIMLIB_seek_INDEX
+
+
+// ===================================
+void SIMLIB_INIT_CACHE(void) {
+
+  // Created Oct 2026
+  // For SIMLIB_MSKOPT += 2048, allocate LRU cache of parsed cadences.
+  // Each accepted LIBID is stored after parsing (SIMLIB_store_CACHE),
+  // and is restored from memory the next time the SIMLIB reader
+  // reaches this LIBID (SIMLIB_fetch_CACHE). Cuts in keep_SIMLIB_HEADER
+  // are re-applied for each restored cadence, so the generated events 
+  // and random sync are the same with or without cache.
+  // The cadence prep in SIMLIB_prepCadence depends on PEAKMJD and
+  // redshift, and therefore is done for each event as before.
+  //
+  // Cache is disabled for TAKE_SPECTRUM keys in SIMLIB header because
+  // parse_SIMLIB_GENRANGES loads these into global arrays.
+
+  int  USE   = INPUTS.SIMLIB_MSKOPT & SIMLIB_MSKOPT_CACHE_LIBID ;
+  int  NSLOT = MXSLOT_SIMLIB_CACHE ;
+  int  NLIBID, i ;
+
+  // ----------- BEGIN ---------
+
+  SIMLIB_CACHE.USE    = false ;
+  SIMLIB_CACHE.NSLOT  = 0 ;
+  SIMLIB_CACHE.STAMP  = SIMLIB_CACHE.NFETCH = 0 ;
+  SIMLIB_CACHE.NHIT   = SIMLIB_CACHE.NSTORE = 0 ;
+
+  if ( !USE ) { return ; }
+
+  if ( !SIMLIB_INDEX.USE ) {
+    printf("\t WARNING: SIMLIB cache requires LIBID index -> "
+	   "ignore SIMLIB_MSKOPT=%d bit\n", SIMLIB_MSKOPT_CACHE_LIBID);
+    fflush(stdout);
+    return ;
+  }
+
+  if ( INPUTS.USE_SIMLIB_TAKE_SPECTRUM ) {
+    printf("\t WARNING: SIMLIB cache not compatible with "
+	   "USE_SIMLIB_TAKE_SPECTRUM -> ignore cache\n");
+    fflush(stdout);
+    return ;
+  }
+
+  NLIBID = SIMLIB_INDEX.NLIBID ;
+  if ( NSLOT > NLIBID ) { NSLOT = NLIBID; }
+
+  SIMLIB_CACHE.SLOT_ENTRY = (int*) malloc(NLIBID*sizeof(int));
+  for(i=0; i < NLIBID; i++ ) { SIMLIB_CACHE.SLOT_ENTRY[i] = -9; }
+
+  SIMLIB_CACHE.SLOT = 
+    (SIMLIB_CACHE_SLOT_DEF*) malloc(NSLOT*sizeof(SIMLIB_CACHE_SLOT_DEF));
+  for(i=0; i < NSLOT; i++ ) {
+    SIMLIB_CACHE.SLOT[i].ENTRY  = -9 ;
+    SIMLIB_CACHE.SLOT[i].STAMP  =  0 ;
+    SIMLIB_CACHE.SLOT[i].NBYTE  =  0 ;
+    SIMLIB_CACHE.SLOT[i].BUFFER = NULL ;
+  }
+
+  SIMLIB_CACHE.NSLOT = NSLOT ;
+  SIMLIB_CACHE.USE   = true ;
+
+  printf("\t Cache up to %d parsed SIMLIB cadences (LRU)\n", NSLOT);
+  fflush(stdout);
+
+  return ;
+
+} // end SIMLIB_INIT_CACHE
+
+
+// ===================================
+int SIMLIB_fetch_CACHE(void) {
+
+  // Created Oct 2026
+  // If next LIBID in SIMLIB file is in cache, restore
+  // SIMLIB_HEADER, SIMLIB_TEMPLATE and SIMLIB_OBS_RAW from cache,
+  // re-apply header cuts, and fseek past this LIBID.
+  // Rejected LIBIDs are skipped here as in SIMLIB_readNextCadence_TEXT.
+  // Function returns 1 if cadence is restored; returns 0 to read 
+  // next cadence from SIMLIB text file.
+
+  int  NLIBID = SIMLIB_INDEX.NLIBID ;
+  int  ENTRY, islot, lo, hi, mid, USEFLAG_LIBID ;
+  int  NREPEAT, NFOUND[6];
+  long OFFSET ;
+  SIMLIB_CACHE_SLOT_DEF *SLOT ;
+
+  // ----------- BEGIN ---------
+
+  if ( !SIMLIB_CACHE.USE ) { return 0 ; }
+
+  SIMLIB_CACHE.NFETCH++ ;
+
+ NEXT:
+  // find first index entry at or after current file position
+  OFFSET = ftell(fp_SIMLIB);
+  if ( OFFSET > SIMLIB_INDEX.OFFSET[NLIBID-1] ) { return 0 ; }
+  lo = 0;  hi = NLIBID-1 ;
+  while ( lo < hi ) {
+    mid = (lo+hi)/2 ;
+    if ( SIMLIB_INDEX.OFFSET[mid] < OFFSET ) { lo = mid+1; } else { hi = mid; }
+  }
+  ENTRY = lo ;
+
+  islot = SIMLIB_CACHE.SLOT_ENTRY[ENTRY] ;
+  if ( islot < 0 ) { return 0 ; }
+
+  SLOT = &SIMLIB_CACHE.SLOT[islot] ;
+
+  // restore header, but keep counters that accumulate over LIBIDs
+  NREPEAT   = SIMLIB_HEADER.NREPEAT ;
+  NFOUND[0] = SIMLIB_HEADER.NFOUND_TOT ;
+  NFOUND[1] = SIMLIB_HEADER.NFOUND_MJD ;
+  NFOUND[2] = SIMLIB_HEADER.NFOUND_RA ;
+  NFOUND[3] = SIMLIB_HEADER.NFOUND_DEC ;
+  NFOUND[4] = SIMLIB_HEADER.NFOUND_FIELD ;
+  NFOUND[5] = SIMLIB_HEADER.NFOUND_GENCUTS ;
+
+  SIMLIB_HEADER = SLOT->HEADER ;
+
+  SIMLIB_HEADER.NREPEAT        = NREPEAT ;
+  SIMLIB_HEADER.NFOUND_TOT     = NFOUND[0] ;
+  SIMLIB_HEADER.NFOUND_MJD     = NFOUND[1] ;
+  SIMLIB_HEADER.NFOUND_RA      = NFOUND[2] ;
+  SIMLIB_HEADER.NFOUND_DEC     = NFOUND[3] ;
+  SIMLIB_HEADER.NFOUND_FIELD   = NFOUND[4] ;
+  SIMLIB_HEADER.NFOUND_GENCUTS = NFOUND[5] ;
+  SIMLIB_HEADER.NWRAP          = 0 ;
+  SIMLIB_HEADER.REGEN_FLAG     = 0 ;
+
+  SIMLIB_TEMPLATE = SLOT->TEMPLATE ;
+  SIMLIB_LIST_forSORT.MJD_LAST = -9.0 ;
+
+  SIMLIB_OBS_RAW.NOBS              = SLOT->NOBS ;
+  SIMLIB_OBS_RAW.NOBS_READ         = SLOT->NOBS_READ ;
+  SIMLIB_OBS_RAW.NOBS_SPECTROGRAPH = SLOT->NOBS_SPECTROGRAPH ;
+  SIMLIB_malloc_OBS(SLOT->NOBS+1);
+  SIMLIB_copyObs_CACHE(-1, SLOT->NOBS, SLOT->BUFFER);
+
+  // move file pointer past this LIBID
+  clearerr(fp_SIMLIB);
+  fseek(fp_SIMLIB, SLOT->OFFSET_END, SEEK_SET);
+
+  SIMLIB_CACHE.STAMP++ ;
+  SLOT->STAMP = SIMLIB_CACHE.STAMP ;
+
+  // apply header cuts exactly as in SIMLIB_readNextCadence_TEXT
+  compute_galactic_coords(); 
+  SIMLIB_randomize_skyCoords();
+  USEFLAG_LIBID = keep_SIMLIB_HEADER(); 
+  if ( USEFLAG_LIBID != ACCEPT_FLAG ) { 
+    SIMLIB_GLOBAL_HEADER.NLIBID_VALID-- ; 
+    goto NEXT ; 
+  }
+
+  SIMLIB_CACHE.NHIT++ ;
+
+  return 1 ;
+
+} // end SIMLIB_fetch_CACHE
+
+
+// ===================================
+void SIMLIB_store_CACHE(void) {
+
+  // Created Oct 2026
+  // Store cadence just read from SIMLIB text file into LRU cache.
+  // The cadence is identified by the last index entry before 
+  // the current file position, which is just after END_LIBID.
+
+  int  NLIBID = SIMLIB_INDEX.NLIBID ;
+  int  NSLOT  = SIMLIB_CACHE.NSLOT ;
+  int  NOBS   = SIMLIB_OBS_RAW.NOBS ;
+  int  ENTRY, islot, i, lo, hi, mid, NBYTE ;
+  long OFFSET ;
+  long long STAMP_MIN ;
+  SIMLIB_CACHE_SLOT_DEF *SLOT ;
+
+  // ----------- BEGIN ---------
+
+  if ( !SIMLIB_CACHE.USE ) { return ; }
+
+  OFFSET = ftell(fp_SIMLIB);
+  if ( OFFSET <= SIMLIB_INDEX.OFFSET[0] ) { return ; }
+
+  // find last index entry before OFFSET
+  lo = 0;  hi = NLIBID-1 ;
+  while ( lo < hi ) {
+    mid = (lo+hi+1)/2 ;
+    if ( SIMLIB_INDEX.OFFSET[mid] < OFFSET ) { lo = mid; } else { hi = mid-1; }
+  }
+  ENTRY = lo ;
+
+  if ( SIMLIB_INDEX.LIBID[ENTRY] != SIMLIB_HEADER.LIBID ) { return ; }
+  if ( SIMLIB_CACHE.SLOT_ENTRY[ENTRY] >= 0 ) { return ; }
+
+  // pick empty slot, or else least-recently used slot
+  islot = 0 ;  STAMP_MIN = SIMLIB_CACHE.SLOT[0].STAMP ;
+  for(i=0; i < NSLOT; i++ ) {
+    if ( SIMLIB_CACHE.SLOT[i].ENTRY < 0 ) { islot = i; break; }
+    if ( SIMLIB_CACHE.SLOT[i].STAMP < STAMP_MIN ) 
+      { islot = i;  STAMP_MIN = SIMLIB_CACHE.SLOT[i].STAMP ; }
+  }
+
+  SLOT = &SIMLIB_CACHE.SLOT[islot] ;
+  if ( SLOT->ENTRY >= 0 ) { SIMLIB_CACHE.SLOT_ENTRY[SLOT->ENTRY] = -9; }
+
+  NBYTE = SIMLIB_copyObs_CACHE(0, NOBS, NULL);
+  if ( NBYTE > SLOT->NBYTE ) {
+    if ( SLOT->BUFFER != NULL ) { free(SLOT->BUFFER); }
+    SLOT->BUFFER = (char*) malloc(NBYTE);
+    SLOT->NBYTE  = NBYTE ;
+  }
+  SIMLIB_copyObs_CACHE(+1, NOBS, SLOT->BUFFER);
+
+  SLOT->ENTRY             = ENTRY ;
+  SLOT->OFFSET_END        = OFFSET ;
+  SLOT->NOBS              = NOBS ;
+  SLOT->NOBS_READ         = SIMLIB_OBS_RAW.NOBS_READ ;
+  SLOT->NOBS_SPECTROGRAPH = SIMLIB_OBS_RAW.NOBS_SPECTROGRAPH ;
+  SLOT->HEADER            = SIMLIB_HEADER ;
+  SLOT->TEMPLATE          = SIMLIB_TEMPLATE ;
+
+  SIMLIB_CACHE.STAMP++ ;
+  SLOT->STAMP = SIMLIB_CACHE.STAMP ;
+  SIMLIB_CACHE.SLOT_ENTRY[ENTRY] = islot ;
+  SIMLIB_CACHE.NSTORE++ ;
+
+  return ;
+
+} // end SIMLIB_store_CACHE
+
+
+// ===================================
+int SIMLIB_copyObs_CACHE(int OPT, int NOBS, char *BUFFER) {
+
+  // Created Oct 2026
+  // OPT =  0 : return number of bytes to store NOBS from SIMLIB_OBS_RAW
+  // OPT = +1 : pack first NOBS of SIMLIB_OBS_RAW arrays into BUFFER
+  // OPT = -1 : unpack BUFFER into SIMLIB_OBS_RAW
+  // Function returns number of bytes.
+
+  int  NBYTE = 0 ;
+  char *ptr  = BUFFER ;
+
+#define COPYOBS_CACHE(ARR) {					      \
+    int nb = NOBS * (int)sizeof(SIMLIB_OBS_RAW.ARR[0]) ;	      \
+    if ( OPT > 0 ) { memcpy(ptr, SIMLIB_OBS_RAW.ARR, nb); ptr += nb; } \
+    if ( OPT < 0 ) { memcpy(SIMLIB_OBS_RAW.ARR, ptr, nb); ptr += nb; } \
+    NBYTE += nb ; }
+
+  // ----------- BEGIN ---------
+
+  COPYOBS_CACHE(OPTLINE);
+  COPYOBS_CACHE(IFILT_OBS);
+  COPYOBS_CACHE(BAND);
+  COPYOBS_CACHE(IDEXPT);
+  COPYOBS_CACHE(NEXPOSE);
+  COPYOBS_CACHE(DETNUM);
+  COPYOBS_CACHE(MJD);
+  COPYOBS_CACHE(CCDGAIN);
+  COPYOBS_CACHE(READNOISE);
+  COPYOBS_CACHE(SKYSIG);
+  COPYOBS_CACHE(PSFSIG1);
+  COPYOBS_CACHE(PSFSIG2);
+  COPYOBS_CACHE(PSFRATIO);
+  COPYOBS_CACHE(PSF_FWHM);
+  COPYOBS_CACHE(NEA);
+  COPYOBS_CACHE(ZPTADU);
+  COPYOBS_CACHE(ZPTERR);
+  COPYOBS_CACHE(MAG);
+  COPYOBS_CACHE(PIXSIZE);
+  COPYOBS_CACHE(FIELDNAME);
+  COPYOBS_CACHE(APPEND_PHOTFLAG);
+  COPYOBS_CACHE(TEMPLATE_SKYSIG);
+  COPYOBS_CACHE(TEMPLATE_READNOISE);
+  COPYOBS_CACHE(TEMPLATE_ZPT);
+  COPYOBS_CACHE(IFILT_SPECTROGRAPH);
+  COPYOBS_CACHE(INDX_TAKE_SPECTRUM);
+  COPYOBS_CACHE(TEXPOSE_SPECTROGRAPH);
+
+#undef COPYOBS_CACHE
+
+  return NBYTE ;
+
+} // end SIMLIB_copyObs_CACHE
+
+
+
 // ===================================
 void  print_SIMLIB_MSKOPT(void) {
   
@@ -18416,6 +19798,12 @@ void  print_SIMLIB_MSKOPT(void) {
   print_mask_comment(stdout, MSKOPT, SIMLIB_MSKOPT_IDEAL_GRID,
 		     "IDEAL GRID; compute PEAKMJD_FIX");
 
+  print_mask_comment(stdout, MSKOPT, SIMLIB_MSKOPT_INDEX_LIBID,
+		     "index LIBID file offsets; fseek to start LIBID");
+
+  print_mask_comment(stdout, MSKOPT, SIMLIB_MSKOPT_CACHE_LIBID,
+		     "cache parsed LIBID cadences (LRU)");
+
   return;
 
 } //end print_SIMLIB_MSKOPT
@@ -18566,6 +19954,9 @@ void SIMLIB_findStart(void) {
   //
   // Jul 5 2023: fix IDSEEK to stop 1 before LIBID to avoid SIMLIB wrap-around.
   //
+  // Oct 14 2026: if SIMLIB_INDEX is defined (SIMLIB_MSKOPT += 1024),
+  //              fseek to start instead of reading preceding LIBIDs.
+  //
   int IDSTART  = INPUTS.SIMLIB_IDSTART ;
   int IDLOCK   = INPUTS.SIMLIB_IDLOCK ;
   int NLIBID   = SIMLIB_GLOBAL_HEADER.NLIBID ;
@@ -18679,6 +20070,10 @@ void SIMLIB_findStart(void) {
 
  
 
+  // Oct 2026: jump directly to start LIBID if SIMLIB_INDEX exists
+  if ( SIMLIB_seek_INDEX(NSKIP_LIBID, IDSEEK) ) 
+    { NSKIP_LIBID = IDSEEK = -9; }
+
   // skip fixed number of LIBIDs
   // Jun 23 2023: few speed-ups:
   //   + Reading all MXPATHLEN chars is faster than reading only 40 !
@@ -18984,6 +20379,7 @@ void SIMLIB_READ_DRIVER(void) {
   // as ROOT or FITS.
   //
   // Nov 22 2019: init REPEAT=0
+  // Oct 14 2026: check SIMLIB_CACHE (SIMLIB_MSKOPT += 2048)
 
   int  REPEAT = 0 ;
   char fnam[] = "SIMLIB_READ_DRIVER" ;
@@ -18999,12 +20395,18 @@ void SIMLIB_READ_DRIVER(void) {
 
   if ( !REPEAT ) {  // process next cadence
 
-    // read next cadence from SIMLIB/Cadence file (any format)
-    SIMLIB_readNextCadence_TEXT(); 
+    // check option to restore previously parsed cadence (Oct 2026)
+    if ( !SIMLIB_fetch_CACHE() ) {
 
-    // expand SPECTROGRAPH keys (MJD,TEXPOSE) to include 
-    // each synthetic band as if they were in the SIMLIB file
-    SIMLIB_addCadence_SPECTROGRAPH(); 
+      // read next cadence from SIMLIB/Cadence file (any format)
+      SIMLIB_readNextCadence_TEXT(); 
+
+      // expand SPECTROGRAPH keys (MJD,TEXPOSE) to include 
+      // each synthetic band as if they were in the SIMLIB file
+      SIMLIB_addCadence_SPECTROGRAPH(); 
+
+      SIMLIB_store_CACHE();
+    }
   }
 
   // TAKE_SPECTRUM uses PEAKMJD and thus must always be
@@ -19250,6 +20652,7 @@ void  SIMLIB_readNextCadence_TEXT(void) {
       if ( strcmp(wd0,"NOBS:") == 0 )   {  
 	sscanf(wd1, "%d", &NOBS_EXPECT ); 
 	SIMLIB_HEADER.NOBS = NOBS_EXPECT ;      
+	SIMLIB_malloc_OBS(NOBS_EXPECT+1); // Oct 2026
 	iwd++; continue ;
       }
     
@@ -19312,6 +20715,7 @@ void  SIMLIB_readNextCadence_TEXT(void) {
 	// code aborts below if ISTORE is too big, but to avoid corrupting
 	// abort messages, don't exceed array bound here.
 	if ( KEEP_MJD &&  ISTORE < MXOBS_SIMLIB ) {
+	  SIMLIB_malloc_OBS(ISTORE+2);
 	  SIMLIB_OBS_RAW.OPTLINE[ISTORE] = OPTLINE ;
 	  SIMLIB_OBS_RAW.MJD[ISTORE]     = MJD;
 
@@ -19394,6 +20798,7 @@ void  SIMLIB_readNextCadence_TEXT(void) {
 	}
 
 	if ( KEEP_MJD &&  ISTORE < MXOBS_SIMLIB ) {
+	  SIMLIB_malloc_OBS(ISTORE+2);
 	  sscanf(WDLIST[iwd+1], "%le", &MJD );
 	  sscanf(WDLIST[iwd+2], "%le", &TEXPOSE_S );
 
@@ -19421,6 +20826,7 @@ void  SIMLIB_readNextCadence_TEXT(void) {
       // check APPEND_PHOTFLAG to NOT sort this MJD (Jan 2018)
       if ( OPTLINE && (OPTLINE_REJECT==0) )  {    
 	if ( APPEND_PHOTFLAG > 0 ) { SIMLIB_HEADER.NOBS_APPEND++ ; }
+	SIMLIB_malloc_OBS(ISTORE+1);
 	SIMLIB_OBS_RAW.APPEND_PHOTFLAG[ISTORE] = APPEND_PHOTFLAG ;
       }
 
@@ -19731,6 +21137,7 @@ void SIMLIB_addCadence_SPECTROGRAPH(void) {
 
   if ( NFILT_SPEC == 0 ) { NFILT_SPEC=1; }   // at least the spectrum
   ISTORE = NOBS;  NOBS_ADD=0;
+  SIMLIB_malloc_OBS(NOBS + NOBS_SPEC*NFILT_SPEC + 1); // Oct 2026
 
   for ( ispec=0; ispec < NOBS_SPEC; ispec++ ) {
 
@@ -19839,6 +21246,7 @@ void  SIMLIB_TAKE_SPECTRUM(void) {
   
 
   OBSRAW = SIMLIB_OBS_RAW.NOBS ;  NOBS_ADD=0;
+  SIMLIB_malloc_OBS(OBSRAW + NSPEC*NFILT + 1); // Oct 2026
  
   z = GENLC.REDSHIFT_CMB ;
 
@@ -20212,6 +21620,7 @@ void  SIMLIB_prepCadence(int REPEAT_CADENCE) {
       sprintf(c2err, "Either increase MXEPSIM or reduce library size.");
       errmsg(SEV_FATAL, 0, fnam, c1err, c2err) ; 
     }
+    SIMLIB_malloc_OBS(NEP+1); // Oct 2026: SIMLIB_OBS_GEN is indexed by NEP
 
     // determine epoch for trigger; either new epoch, or same as before.
     MJD_DIF = MJD - MJD_LAST_KEEP ;
@@ -22746,6 +24155,11 @@ void init_CIDRAN(void) {
   //
   // Jun 20 2022: restrict NPICKRAN_ABORT to 1 million
   // Aug 3 2022: skip CID on CIDRAN_SKIPLIST
+  // Oct 15 2026: 
+  //   for optional CIDRAN_METHOD=0, call init_CIDRAN_PERM and return;
+  //   CIDRAN is then computed per event from keyed permutation
+  //   with no list, no cidmask and no random calls. List method
+  //   below is the default (CIDRAN_METHOD=1).
 
   int NPICKRAN_ABORT ; // abort after this many tries
   int i, i2, j, NPICKRAN, NSTORE_ALL, NSTORE, CIDRAN, CIDTMP, CIDADD;
@@ -22799,6 +24213,9 @@ void init_CIDRAN(void) {
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
 
+  if ( INPUTS.CIDRAN_METHOD == CIDRAN_METHOD_PERM ) 
+    { init_CIDRAN_PERM(NSTORE_ALL);  return ; }
+
   if ( NSTORE_ALL >= CIDMAX ) {
     sprintf(c1err,"NSTORE_ALL=%d exceeds bound of CIDRAN_MAX = %d", 
 	    NSTORE_ALL, CIDMAX );
@@ -23003,13 +24420,20 @@ void sort_CIDRAN(void) {
 void load_CIDRAN(void) {
 
   // Created Jul 3 2022
+  // Oct 15 2026: for CIDRAN_METHOD=0, compute CIDRAN from permutation
+  //   of global index GENLC.CID - CIDRAN_MIN (same index as for
+  //   list method including CIDOFF), so that different CIDOFF 
+  //   ranges (splits) get different CIDs.
 
   int CID;
   char fnam[] = "load_CIDRAN" ;
 
   // -------------- BEGIN ----------
 
-  CID = INPUTS.CIDRAN_LIST[GENLC.CID-INPUTS.CIDOFF];
+  if ( INPUTS.CIDRAN_METHOD == CIDRAN_METHOD_PERM ) 
+    { CID = get_CIDRAN_PERM(GENLC.CID - INPUTS.CIDRAN_MIN); }
+  else
+    { CID = INPUTS.CIDRAN_LIST[GENLC.CID-INPUTS.CIDOFF]; }
   GENLC.CIDRAN    = CID ;
 
   if ( CID < 0 ) {
@@ -23022,6 +24446,133 @@ void load_CIDRAN(void) {
 } // end load_CIDRAN
 
 
+// ============================
+void init_CIDRAN_PERM(int NSTORE_ALL) {
+
+  // Created Oct 2026
+  // Prepare keyed Feistel permutation of the valid CID range
+  // CIDRAN_MIN < CID < CIDRAN_MAX, excluding CIDRAN_SKIPLIST.
+  // Permutation keys depend only on CIDRAN_SEED (not on RANSEED),
+  // so that every split job uses the same permutation and thus
+  // splits with different CIDOFF have unique CIDs. Alternative to
+  // list of NSTORE_ALL random CIDs, which needed a 1 bit/CID mask,
+  // a 4 byte/CID list and long init time for large NGEN.
+
+  int  CIDMIN = INPUTS.CIDRAN_MIN ;
+  int  CIDMAX = INPUTS.CIDRAN_MAX ;
+  int  NVALID = CIDMAX - CIDMIN - 1 ;
+  int  NSKIP  = 0, CID, j, j2, NBIT ;
+  unsigned long long KEY ;
+  char fnam[] = "init_CIDRAN_PERM" ;
+
+  // -------------- BEGIN ----------
+
+  // store sorted list of unique skip-CIDs that are in valid range
+  for(j=0; j < INPUTS.NCIDRAN_SKIPLIST; j++ ) {
+    CID = INPUTS.CIDRAN_SKIPLIST[j] ;
+    if ( CID <= CIDMIN || CID >= CIDMAX ) { continue; }
+    for(j2=0; j2 < NSKIP; j2++ ) 
+      { if ( CIDRAN_PERM.SKIPLIST[j2] == CID ) { CID = -9; } }
+    if ( CID < 0 ) { continue; }
+    CIDRAN_PERM.SKIPLIST[NSKIP++] = CID;
+  }
+  CIDRAN_PERM.NSKIP = NSKIP ;
+  if ( NSKIP > 1 ) { qsort(CIDRAN_PERM.SKIPLIST, NSKIP, sizeof(int), 
+			   compare_int_CIDRAN); }
+
+  if ( NSTORE_ALL >= NVALID - NSKIP ) {
+    sprintf(c1err,"NSTORE_ALL=%d exceeds %d valid CIDs in CIDRAN range", 
+	    NSTORE_ALL, NVALID-NSKIP );
+    sprintf(c2err,"NSTORE_ALL= %d(CIDOFF) + %d(NGEN_LC) + %d(NGENTOT_LC)",
+	    INPUTS.CIDOFF, INPUTS.NGEN_LC, INPUTS.NGENTOT_LC );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  CIDRAN_PERM.NCID = (unsigned int)(NVALID - NSKIP) ;
+
+  // Feistel halves must cover NCID: 2*NBIT_HALF bits >= log2(NCID)
+  NBIT = 1;
+  while ( (1ULL << (2*NBIT)) < (unsigned long long)CIDRAN_PERM.NCID ) 
+    { NBIT++ ; }
+  CIDRAN_PERM.NBIT_HALF = NBIT ;
+  CIDRAN_PERM.MASK_HALF = (1U << NBIT) - 1 ;
+
+  // splitmix64 sequence of round keys from CIDRAN_SEED
+  KEY = 0x9E3779B97F4A7C15ULL * (unsigned long long)(INPUTS.CIDRAN_SEED+1);
+  for(j=0; j < NROUND_CIDRAN_PERM; j++ ) {
+    KEY += 0x9E3779B97F4A7C15ULL ;
+    CIDRAN_PERM.KEY[j] = mix64_CIDRAN(KEY);
+  }
+
+  printf("	 CIDRAN_MIN/MAX = %d/%d   CIDOFF=%d   NSTORE_ALL=%d\n", 
+	 CIDMIN, CIDMAX, INPUTS.CIDOFF, NSTORE_ALL );
+  printf("	 Random CID from %d-round Feistel permutation of %u CIDs "
+	 "(CIDRAN_SEED=%d)\n",
+	 NROUND_CIDRAN_PERM, CIDRAN_PERM.NCID, INPUTS.CIDRAN_SEED );
+  fflush(stdout);
+
+  return ;
+
+} // end init_CIDRAN_PERM
+
+
+// ============================
+int get_CIDRAN_PERM(int INDEX) {
+
+  // Created Oct 2026
+  // Return random CID for global INDEX (0 <= INDEX < NCID).
+  // Balanced Feistel network on 2*NBIT_HALF bits is a bijection;
+  // cycle-walking (re-apply until result < NCID) restricts it to
+  // a bijection of [0,NCID). Permuted index is then mapped to the
+  // valid CIDs above CIDRAN_MIN, stepping over sorted SKIPLIST.
+
+  int          NBIT = CIDRAN_PERM.NBIT_HALF ;
+  unsigned int MASK = CIDRAN_PERM.MASK_HALF ;
+  unsigned int x    = (unsigned int)INDEX ;
+  unsigned int L, R, T ;
+  int          iround, j, CID ;
+  char fnam[] = "get_CIDRAN_PERM" ;
+
+  // -------------- BEGIN ----------
+
+  if ( INDEX < 0 || x >= CIDRAN_PERM.NCID ) {
+    sprintf(c1err,"Invalid INDEX=%d (NCID=%u)", INDEX, CIDRAN_PERM.NCID);
+    sprintf(c2err,"CID=%d CIDOFF=%d", GENLC.CID, INPUTS.CIDOFF);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  do {
+    L = x >> NBIT ;  R = x & MASK ;
+    for(iround=0; iround < NROUND_CIDRAN_PERM; iround++ ) {
+      T = L ^ ( (unsigned int)
+		mix64_CIDRAN((unsigned long long)R ^ CIDRAN_PERM.KEY[iround])
+		& MASK );
+      L = R;  R = T;
+    }
+    x = (L << NBIT) | R ;
+  } while ( x >= CIDRAN_PERM.NCID ) ;
+
+  CID = INPUTS.CIDRAN_MIN + 1 + (int)x ;
+  for(j=0; j < CIDRAN_PERM.NSKIP; j++ ) 
+    { if ( CID >= CIDRAN_PERM.SKIPLIST[j] ) { CID++ ; } }
+
+  return CID ;
+
+} // end get_CIDRAN_PERM
+
+unsigned long long mix64_CIDRAN(unsigned long long z) {
+  // splitmix64 finalizer for Feistel round function & keys
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL ;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL ;
+  return z ^ (z >> 31) ;
+}
+
+int compare_int_CIDRAN(const void *a, const void *b) {
+  int ia = *(const int*)a, ib = *(const int*)b ;
+  return (ia > ib) - (ia < ib) ;
+}
+
+
 // *****************************************
 void checkpar_SIMSED(void) {
 
@@ -24200,7 +25751,8 @@ void  LOAD_SEARCHEFF_DATA(void) {
 
     oldRan = SEARCHEFF_RANDOMS.FLAT_PIPELINE[NOBS] ;
     if ( oldRan < -0.001 ) 
-      { SEARCHEFF_RANDOMS.FLAT_PIPELINE[NOBS] = getRan_Flat1(1);  NRANTMP++ ; }
+      { SEARCHEFF_RANDOMS.FLAT_PIPELINE[NOBS] = 
+	  getRan_Flat1_stage(ISTAGE_RAN_TRIGGER,1);  NRANTMP++ ; }
     
 
     if ( NMAP_PHOTPROB > 0 ) {
@@ -24208,13 +25760,15 @@ void  LOAD_SEARCHEFF_DATA(void) {
       if ( ISCORR_PHOTRPBOB ) {
 	oldRan = SEARCHEFF_RANDOMS.GAUSS_PHOTPROB[NOBS] ;
 	if ( oldRan < -998.0 ) 
-	  { SEARCHEFF_RANDOMS.GAUSS_PHOTPROB[NOBS] = getRan_Gauss(1); }
+	  { SEARCHEFF_RANDOMS.GAUSS_PHOTPROB[NOBS] = 
+	      getRan_Gauss_stage(ISTAGE_RAN_TRIGGER,1); }
       }
       else {
 	// load flat randoms for uncorrelated PHOTPROB
 	oldRan = SEARCHEFF_RANDOMS.FLAT_PHOTPROB[NOBS] ;
 	if ( oldRan < -998.0 ) 
-	  { SEARCHEFF_RANDOMS.FLAT_PHOTPROB[NOBS] = getRan_Flat1(1); }	
+	  { SEARCHEFF_RANDOMS.FLAT_PHOTPROB[NOBS] = 
+	      getRan_Flat1_stage(ISTAGE_RAN_TRIGGER,1); }	
       }
     } // end NMAP_PHOTPROB
 
@@ -24230,7 +25784,8 @@ void  LOAD_SEARCHEFF_DATA(void) {
   for ( ifilt=0; ifilt <= MXFILTINDX; ifilt++ ) {
 
     if ( SEARCHEFF_RANDOMS.FLAT_SPEC[ifilt] < -0.01 ) 
-      { SEARCHEFF_RANDOMS.FLAT_SPEC[ifilt]  = getRan_Flat1(1); }
+      { SEARCHEFF_RANDOMS.FLAT_SPEC[ifilt] = 
+	  getRan_Flat1_stage(ISTAGE_RAN_TRIGGER,1); }
 
     if ( ifilt == MXFILTINDX ) { continue ; } // avoid array overwrite
     SEARCHEFF_DATA.PEAKMAG[ifilt] = MAG_UNDEFINED ;
@@ -26256,6 +27811,12 @@ void init_genmodel(void) {
     init_genmag_PySEDMODEL(INPUTS.GENMODEL, INPUTS.MODELPATH, 
 			   OPTMASK, ARGLIST_PySEDMODEL, NAMES_HOSTPAR);
 
+    // Oct 2026: optional SED cache (no cache if DTREST=0)
+    init_SEDCACHE_PySEDMODEL(INPUTS.GENMODEL_SEDCACHE[0],
+			     INPUTS.GENMODEL_SEDCACHE[1],
+			     INPUTS.GENMODEL_SEDCACHE_MXMB,
+			     INPUTS.GENMODEL_SEDCACHE_DIR );
+
     get_LAMRANGE_SEDMODEL(1,&GENLC.RESTLAM_MODEL[0], &GENLC.RESTLAM_MODEL[1] );
   }
 
@@ -26527,6 +28088,10 @@ void init_genSEDMODEL(void) {
 			 genSEDMODEL.TransREF, 
 			 lamshift );
 
+    // use ZP stored in calib file (if there) for consistency with fit
+    set_calibZP_SEDMODEL(ifilt_obs, 
+			 get_calib_ZP_SEDMODEL(OPT_FRAME[ifilt],ifilt_obs) );
+
     DONEFILT[ifilt_obs] = 1 ;
   }
 
@@ -26835,11 +28400,11 @@ int gen_TRIGGER_PEAKMAG_SPEC(void) {
     { return(1); }
 
   GENLC_ORIG.NEPOCH      = GENLC.NEPOCH;
-  GENLC_ORIG.IFILT_OBS   = (int*)malloc ( MEMI ) ; 
-  GENLC_ORIG.ISPEAK      = (int*)malloc ( MEMI ) ;
-  GENLC_ORIG.MJD         = (double*)malloc( MEMD ) ;
-  GENLC_ORIG.TOBS        = (double*)malloc( MEMD ) ;
-  GENLC_ORIG.TREST       = (double*)malloc( MEMD ) ;
+  GENLC_ORIG.IFILT_OBS   = (int*)   arena_alloc(&ARENA_EVENT, MEMI) ; 
+  GENLC_ORIG.ISPEAK      = (int*)   arena_alloc(&ARENA_EVENT, MEMI) ;
+  GENLC_ORIG.MJD         = (double*)arena_alloc(&ARENA_EVENT, MEMD) ;
+  GENLC_ORIG.TOBS        = (double*)arena_alloc(&ARENA_EVENT, MEMD) ;
+  GENLC_ORIG.TREST       = (double*)arena_alloc(&ARENA_EVENT, MEMD) ;
 
   for(iep=1; iep <= GENLC_ORIG.NEPOCH ; iep++ ) {
     GENLC_ORIG.ISPEAK[iep]    = GENLC.OBSFLAG_PEAK[iep] ;
@@ -26878,13 +28443,6 @@ int gen_TRIGGER_PEAKMAG_SPEC(void) {
     }
   }
 
-
-  free(GENLC_ORIG.IFILT_OBS);
-  free(GENLC_ORIG.ISPEAK);
-  free(GENLC_ORIG.MJD);
-  free(GENLC_ORIG.TOBS);
-  free(GENLC_ORIG.TREST);
-
   return(LFIND_SPEC) ;
 
 } // end gen_TRIGGER_PEAKMAG_SPEC
@@ -26938,6 +28496,96 @@ int gen_TRIGGER_zHOST(void) {
 
 } // end gen_TRIGGER_zHOST
 
+// ==========================================
+int gen_PRESCREEN_SNRMAX(void) {
+
+  // Created Oct 2026
+  // Pre-screen CUTWIN_SNRMAX cuts before GENMAG_DRIVER and
+  // GENFLUX_DRIVER to quickly reject hopeless events (e.g., high-z).
+  // For each band in the SNRMAX cuts, peak mag from gen_PEAKMAG 
+  // (brightened by user margin PRESCREEN_CUTWIN_SNRMAX) is used to
+  // compute an upper bound on the true SNR at each epoch in the
+  // cut Trest window using only source and sky+CCD noise from
+  // SIMLIB_OBS_GEN; a 3 sigma margin is added for the random flux
+  // fluctuation. Event is rejected if the number of bands above the 
+  // SNRMAX cut is less than required for any cut.
+  // 
+  // Return 1 if event may pass SNRMAX cuts; return 0 to reject.
+  //
+  // Pre-screen is skipped when noise can be scaled after this stage
+  // (FLUXERRMODEL_FILE, FUDGE_SNRMAX), or for models without a
+  // well-defined peak mag.
+
+#define NSIGMA_PRESCREEN_SNRMAX 3.0
+
+  double DMAG    = (double)INPUTS.PRESCREEN_CUTWIN_SNRMAX ;
+  int    NEP     = GENLC.NEPOCH ;
+  int    icut, i, ep, NFCUT, NPASS, ifilt_obs, IFILTOBS_LIST[MXFILTINDX] ;
+  double PEAKMAG[MXFILTINDX], SNRMAX_BOUND, SNR, Trest, arg ;
+  double flux_pe, gain, skysig_pe, rdnoise, nea, sqsig ;
+
+  // -------------- BEGIN ------------------
+
+  if ( DMAG <= 0.0 )                   { return 1; }
+  if ( INPUTS.APPLY_CUTWIN_OPT != 1 )  { return 1; }
+  if ( INPUTS.NCUTWIN_SNRMAX == 0 )    { return 1; }
+  if ( INPUTS.OPT_FUDGE_SNRMAX > 0 )   { return 1; }
+  if ( !IGNOREFILE(INPUTS.FLUXERRMODEL_FILE) ) { return 1; }
+  if ( GENLC.IFLAG_GENSOURCE == IFLAG_GENGRID  ) { return 1; }
+  if ( INDEX_GENMODEL == MODEL_LCLIB  )  { return 1; }
+  if ( INDEX_GENMODEL == MODEL_SIMLIB )  { return 1; }
+
+  // main may force accept for LIBID with too many generated events
+  if ( GENLC.NGEN_SIMLIB_ID >= SIMLIB_MXGEN_LIBID ) { return 1; }
+
+  for(i=0; i < MXFILTINDX; i++ ) { PEAKMAG[i] = MAG_UNDEFINED; }
+
+  for ( icut=1; icut <= INPUTS.NCUTWIN_SNRMAX; icut++ ) {
+
+    NFCUT  = PARSE_FILTLIST( INPUTS.CUTWIN_SNRMAX_FILTERS[icut], 
+			     IFILTOBS_LIST ); // <== returned
+    NPASS  = 0 ;
+
+    for ( i=0; i < NFCUT; i++ ) {
+
+      ifilt_obs = IFILTOBS_LIST[i] ;
+      if ( PEAKMAG[ifilt_obs] == MAG_UNDEFINED ) 
+	{ PEAKMAG[ifilt_obs] = gen_PEAKMAG(ifilt_obs) - DMAG ; }
+
+      SNRMAX_BOUND = 0.0 ;
+      for ( ep=1; ep <= NEP; ep++ ) {
+	if ( GENLC.IFILT_OBS[ep] != ifilt_obs ) { continue; }
+	Trest = GENLC.epoch_rest[ep] ;
+	if ( Trest < INPUTS.CUTWIN_SNRMAX_TREST[icut][0] ) { continue; }
+	if ( Trest > INPUTS.CUTWIN_SNRMAX_TREST[icut][1] ) { continue; }
+
+	gain      = SIMLIB_OBS_GEN.CCDGAIN[ep] ;
+	skysig_pe = SIMLIB_OBS_GEN.SKYSIG[ep] * gain ;
+	rdnoise   = SIMLIB_OBS_GEN.READNOISE[ep] ;
+	nea       = SIMLIB_OBS_GEN.NEA[ep] ;
+	arg       = 0.4 * ( SIMLIB_OBS_GEN.ZPTADU[ep] - PEAKMAG[ifilt_obs] );
+	flux_pe   = gain * pow(TEN,arg) ;
+	sqsig     = flux_pe + nea*(skysig_pe*skysig_pe + rdnoise*rdnoise) ;
+	if ( sqsig <= 0.0 ) { continue; }
+
+	SNR = flux_pe / sqrt(sqsig) ;
+	if ( SNR > SNRMAX_BOUND ) { SNRMAX_BOUND = SNR; }
+      }
+
+      SNRMAX_BOUND += NSIGMA_PRESCREEN_SNRMAX ;
+      if ( SNRMAX_BOUND > INPUTS.CUTWIN_SNRMAX[icut][0] ) { NPASS++ ; }
+
+    } // end i loop over cut filters
+
+    if ( NPASS < INPUTS.CUTWIN_SNRMAX_NFILT[icut] ) { return 0; }
+
+  } // end icut
+
+  return 1 ;
+
+} // end gen_PRESCREEN_SNRMAX
+
+
 // *********************************************
 void GENMAG_DRIVER(void) {
 
@@ -26946,6 +28594,8 @@ void GENMAG_DRIVER(void) {
   // Driver routine to generate true mags at each epoch & passband.
   //
   // Aut 17 2017: call get_lightCurveWidth
+  // Oct 14 2026: call genmodel_BATCH for models with a batch option
+  // Oct 15 2026: time genmodel calls with ISTAGE_TIMER_GENMODEL
 
   int ifilt, ifilt_obs, DOFILT, ncall_genmodel=0 ;
   char fnam[] = "GENMAG_DRIVER" ;
@@ -26953,21 +28603,28 @@ void GENMAG_DRIVER(void) {
   // -------------- BEGIN ---------------
   genran_modelSmear(); // randoms for intrinsic scatter
 
-  // this loop is to generate ideal mag in each filter.
-  for ( ifilt=0; ifilt < GENLC.NFILTDEF_OBS; ifilt++ ) {
-    ifilt_obs = GENLC.IFILTMAP_OBS[ifilt] ;
+  start_STAGE_TIMER(ISTAGE_TIMER_GENMODEL);
+  if ( USE_genmodel_BATCH() ) {
+    genmodel_BATCH(); // all filters & epochs in one call (Oct 2026)
+  }
+  else {
+    // this loop is to generate ideal mag in each filter.
+    for ( ifilt=0; ifilt < GENLC.NFILTDEF_OBS; ifilt++ ) {
+      ifilt_obs = GENLC.IFILTMAP_OBS[ifilt] ;
 
-    DOFILT = GENLC.DOFILT[ifilt_obs] ;
-    if ( DOFILT == 0 ) { continue ; }
-    ncall_genmodel++ ;
+      DOFILT = GENLC.DOFILT[ifilt_obs] ;
+      if ( DOFILT == 0 ) { continue ; }
+      ncall_genmodel++ ;
 
-    genmodel(ifilt_obs, 1, ncall_genmodel ); 
+      genmodel(ifilt_obs, 1, ncall_genmodel ); 
 
-    if ( GENFRAME_OPT == GENFRAME_REST ) {
-      genmodel(ifilt_obs, 2, ncall_genmodel);    // 2nd nearest filter
-      genmodel(ifilt_obs, 3, ncall_genmodel);    // 3rd nearest filter
-    } 
-  } // ifilt
+      if ( GENFRAME_OPT == GENFRAME_REST ) {
+        genmodel(ifilt_obs, 2, ncall_genmodel);    // 2nd nearest filter
+        genmodel(ifilt_obs, 3, ncall_genmodel);    // 3rd nearest filter
+      } 
+    } // ifilt
+  }
+  end_STAGE_TIMER(ISTAGE_TIMER_GENMODEL);
  
 
   // spaghetti hack to pass LCLIB redshift and compute HOSTLIB photo-z
@@ -27006,10 +28663,12 @@ void GENFLUX_DRIVER(void) {
   //           e.g., correlations for anomalous host noise.
   //
   // Oct 1 2023: for GENGRID, set  GENLC.NOBS_MODELFLUX = GENLC.NEPOCH
+  // Oct 14 2026: use SoA gen_fluxNoise_calc_batch for common path;
+  //              per-epoch gen_fluxNoise_calc only for rich options.
 
   int NEPOCH = GENLC.NEPOCH ;
   int MEM    = (NEPOCH+1)*sizeof(FLUXNOISE_DEF);
-  int epoch, icov;
+  int epoch, icov, USE_BATCH ;
   int VBOSE_CALC  = 0 ; 
   int VBOSE_FUDGE = 0 ;
   int VBOSE_APPLY = 0 ;
@@ -27035,13 +28694,19 @@ void GENFLUX_DRIVER(void) {
 
 
   for ( epoch = 1; epoch <= GENLC.NEPOCH; epoch++ ) {
-
     GENLC.flux[epoch]         = NULLFLOAT ; 
     GENLC.fluxerr_data[epoch] = NULLFLOAT ;     
     GENLC.FLUXNOISE[epoch].IFILT_OBS = -888 ;
+  }
+
+  // compute noise for all epochs at once if no rich-path option is set
+  USE_BATCH = gen_fluxNoise_calc_batch();
+
+  for ( epoch = 1; epoch <= GENLC.NEPOCH; epoch++ ) {
 
     if ( !GENLC.OBSFLAG_GEN[epoch]  )  { continue ; }
-    gen_fluxNoise_calc(epoch,VBOSE_CALC, &GENLC.FLUXNOISE[epoch]);
+    if ( !USE_BATCH ) 
+      { gen_fluxNoise_calc(epoch,VBOSE_CALC, &GENLC.FLUXNOISE[epoch]); }
 
     // check noise fudge-options; diagonal COV only
     gen_fluxNoise_fudge_diag(epoch, VBOSE_FUDGE, &GENLC.FLUXNOISE[epoch]);
@@ -27090,6 +28755,7 @@ void gen_fluxNoise_randoms(void) {
   //
   // Feb 14 2018: set GENLC.RANGauss_NOISE_ZP[ep] 
   //
+  // Oct 15 2026: with RANDOM_STAGE, draw from ISTAGE_RAN_NOISE substream
 
   double RAN1, RAN2;
   int ep, ifilt, ifilt_obs, ifield;
@@ -27112,8 +28778,8 @@ void gen_fluxNoise_randoms(void) {
     if ( !GENLC.OBSFLAG_GEN[ep]  ) { continue ; }
 
     // load randoms into global
-    RAN1 = getRan_Gauss(1) ;  
-    RAN2 = getRan_Gauss(1) ;  
+    RAN1 = getRan_Gauss_stage(ISTAGE_RAN_NOISE,1) ;  
+    RAN2 = getRan_Gauss_stage(ISTAGE_RAN_NOISE,1) ;  
     GENLC.RANGauss_NOISE_SEARCH[ep] = RAN1;
     GENLC.RANGauss_NOISE_ZP[ep]     = RAN2; // Jan 2020; soon to be obsolete
     GENLC.RANGauss_NOISE_FUDGE[ep]  = RAN2; // for refactored GENFLUX_DRIVER
@@ -27133,7 +28799,8 @@ void gen_fluxNoise_randoms(void) {
     if ( GENLC.DOFILT[ifilt_obs] == 0 ) { continue ; }
    
     for(ifield=0; ifield < MXFIELD_OVP; ifield++ ) {      
-      GENLC.RANGauss_NOISE_TEMPLATE[ifield][ifilt_obs] = getRan_Gauss(1) ; 
+      GENLC.RANGauss_NOISE_TEMPLATE[ifield][ifilt_obs] = 
+	getRan_Gauss_stage(ISTAGE_RAN_NOISE,1) ; 
     } 
     
   }
@@ -27144,6 +28811,7 @@ void gen_fluxNoise_randoms(void) {
 
 
 // *************************************
+ATTR_TARGET_CLONES
 void gen_fluxNoise_calc(int epoch, int vbose, FLUXNOISE_DEF *FLUXNOISE) {
 
   // Created Dec 27 2019
@@ -27384,6 +29052,198 @@ void gen_fluxNoise_calc(int epoch, int vbose, FLUXNOISE_DEF *FLUXNOISE) {
 
 } // end gen_fluxNoise_calc
 
+// ********************************************************
+int gen_fluxNoise_calc_batch(void) {
+
+  // Created Oct 2026
+  // SoA version of gen_fluxNoise_calc for the common path:
+  // no template noise, no LCLIB template flux, no host photo-stat
+  // noise, no MAGMONITOR_SNR and no SIMGEN_DUMP_NOISE.
+  // Observing conditions for all epochs with OBSFLAG_GEN are gathered
+  // into FLUXNOISE_BATCH arrays and the noise is computed in 
+  // branch-free loops; arithmetic is identical to gen_fluxNoise_calc
+  // so that fluxes and errors are unchanged.
+  // Fudges (gen_fluxNoise_fudge_diag), covariances and 
+  // gen_fluxNoise_apply are still evaluated per epoch by the caller.
+  //
+  // Function returns 1 if GENLC.FLUXNOISE is filled for every
+  // epoch with OBSFLAG_GEN; returns 0 if caller must use the
+  // per-epoch gen_fluxNoise_calc (rich path, or invalid observing
+  // conditions that are reported by gen_fluxNoise_calc).
+
+  int    NEPOCH      = GENLC.NEPOCH ;
+  int    OPT_ZP      = ( INPUTS.SMEARFLAG_ZEROPT > 0 ) ;
+  int    OPT_ZP_TRUE = ( (INPUTS.SMEARFLAG_ZEROPT & 1) > 0 ) ;
+  int    OPT_ZP_DATA = ( (INPUTS.SMEARFLAG_ZEROPT & 2) > 0 ) ;
+  double ZP_FLUXCAL  = INPUTS.ZP_FLUXCAL ;
+
+  int    NEP, NERR, iep, epoch, ifilt_obs, itype, MEMD, MEMI ;
+  double gain, skysig_pe, readnoise, nea, relerr, err ;
+  double NADU_over_FLUXCAL, fluxsn_pe, sqsig_noZ, sqsig_true, sqsig_data;
+  FLUXNOISE_DEF *FLUXNOISE ;
+  char fnam[] = "gen_fluxNoise_calc_batch" ;
+
+  // ------------- BEGIN ---------------
+
+  if ( GENLC.IFLAG_GENSOURCE == IFLAG_GENGRID  ) { return 0 ; }
+
+  // options that require the rich per-epoch path
+  if ( SIMLIB_TEMPLATE.USEFLAG                                   ) 
+    { return 0; }
+  if ( INPUTS.SMEARFLAG_HOSTGAL & SMEARMASK_HOSTGAL_PHOT          ) 
+    { return 0; }
+  if ( INPUTS.MAGMONITOR_SNR > 10 || INPUTS.SIMGEN_DUMP_NOISE     ) 
+    { return 0; }
+
+  // grow SoA arrays if needed
+  if ( NEPOCH+1 > FLUXNOISE_BATCH.NALLOC ) {
+    int NALLOC = NEPOCH + 1 + 100 ;
+    MEMD = NALLOC * sizeof(double);
+    MEMI = NALLOC * sizeof(int);
+    FLUXNOISE_BATCH.EPOCH     = (int   *)realloc(FLUXNOISE_BATCH.EPOCH,    MEMI);
+    FLUXNOISE_BATCH.ZPT       = (double*)realloc(FLUXNOISE_BATCH.ZPT,      MEMD);
+    FLUXNOISE_BATCH.CCDGAIN   = (double*)realloc(FLUXNOISE_BATCH.CCDGAIN,  MEMD);
+    FLUXNOISE_BATCH.SKYSIG    = (double*)realloc(FLUXNOISE_BATCH.SKYSIG,   MEMD);
+    FLUXNOISE_BATCH.READNOISE = (double*)realloc(FLUXNOISE_BATCH.READNOISE,MEMD);
+    FLUXNOISE_BATCH.NEA       = (double*)realloc(FLUXNOISE_BATCH.NEA,      MEMD);
+    FLUXNOISE_BATCH.ZPTERR    = (double*)realloc(FLUXNOISE_BATCH.ZPTERR,   MEMD);
+    FLUXNOISE_BATCH.GENMAG    = (double*)realloc(FLUXNOISE_BATCH.GENMAG,   MEMD);
+    FLUXNOISE_BATCH.FLUXSN_PE    = 
+      (double*)realloc(FLUXNOISE_BATCH.FLUXSN_PE,    MEMD);
+    FLUXNOISE_BATCH.SQSIG_SKY_PE = 
+      (double*)realloc(FLUXNOISE_BATCH.SQSIG_SKY_PE, MEMD);
+    FLUXNOISE_BATCH.SQSIG_CCD_PE = 
+      (double*)realloc(FLUXNOISE_BATCH.SQSIG_CCD_PE, MEMD);
+    FLUXNOISE_BATCH.SQSIG_ZP_PE  = 
+      (double*)realloc(FLUXNOISE_BATCH.SQSIG_ZP_PE,  MEMD);
+    FLUXNOISE_BATCH.Npe_over_FLUXCAL = 
+      (double*)realloc(FLUXNOISE_BATCH.Npe_over_FLUXCAL, MEMD);
+    FLUXNOISE_BATCH.NADU_over_Npe = 
+      (double*)realloc(FLUXNOISE_BATCH.NADU_over_Npe, MEMD);
+
+    if ( FLUXNOISE_BATCH.NADU_over_Npe == NULL ) {
+      sprintf(c1err,"Could not realloc SoA arrays for NEPOCH=%d", NEPOCH);
+      sprintf(c2err,"CID=%d", GENLC.CID);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+    }
+    FLUXNOISE_BATCH.NALLOC = NALLOC ;
+  }
+
+  // - - - - - - - - - - - - - - - - - - - - - - -
+  // gather; bail out to rich path for LCLIB template flux or 
+  // invalid observing conditions.
+  NEP = NERR = 0 ;
+  for ( epoch = 1; epoch <= NEPOCH; epoch++ ) {
+    if ( !GENLC.OBSFLAG_GEN[epoch] ) { continue; }
+    ifilt_obs = GENLC.IFILT_OBS[epoch] ;
+    if ( GENLC.genmag_obs_template[ifilt_obs] < 90.0 ) { return 0; }
+
+    if ( SIMLIB_OBS_GEN.ZPTADU[epoch]  < 10.0   ) { NERR++ ; }
+    if ( SIMLIB_OBS_GEN.PSFSIG1[epoch] < 0.0001 ) { NERR++ ; }
+    if ( SIMLIB_OBS_GEN.SKYSIG[epoch]  < 0.0001 ) { NERR++ ; }
+
+    FLUXNOISE_BATCH.EPOCH[NEP]     = epoch ;
+    FLUXNOISE_BATCH.ZPT[NEP]       = SIMLIB_OBS_GEN.ZPTADU[epoch] ;
+    FLUXNOISE_BATCH.CCDGAIN[NEP]   = SIMLIB_OBS_GEN.CCDGAIN[epoch] ;
+    FLUXNOISE_BATCH.SKYSIG[NEP]    = SIMLIB_OBS_GEN.SKYSIG[epoch] ;
+    FLUXNOISE_BATCH.READNOISE[NEP] = SIMLIB_OBS_GEN.READNOISE[epoch] ;
+    FLUXNOISE_BATCH.NEA[NEP]       = SIMLIB_OBS_GEN.NEA[epoch] ;
+    FLUXNOISE_BATCH.ZPTERR[NEP]    = SIMLIB_OBS_GEN.ZPTERR[epoch] ;
+    FLUXNOISE_BATCH.GENMAG[NEP]    = GENLC.genmag_obs[epoch] ;
+    NEP++ ;
+  }
+  FLUXNOISE_BATCH.NEP = NEP ;
+  if ( NERR > 0 ) { return 0; } // gen_fluxNoise_calc aborts with details
+
+  // - - - - - - - - - - - - - - - - - - - - - - -
+  // branch-free noise loops over compacted epochs
+  for ( iep = 0; iep < NEP; iep++ ) {
+    gain              = FLUXNOISE_BATCH.CCDGAIN[iep];
+    NADU_over_FLUXCAL = pow(TEN, 0.4*(FLUXNOISE_BATCH.ZPT[iep]-ZP_FLUXCAL));
+    FLUXNOISE_BATCH.Npe_over_FLUXCAL[iep] = NADU_over_FLUXCAL * gain ;
+    FLUXNOISE_BATCH.NADU_over_Npe[iep]    = 
+      NADU_over_FLUXCAL / FLUXNOISE_BATCH.Npe_over_FLUXCAL[iep] ;
+
+    fluxsn_pe  = 
+      pow(10.0, 0.4*(FLUXNOISE_BATCH.ZPT[iep]-FLUXNOISE_BATCH.GENMAG[iep]));
+    FLUXNOISE_BATCH.FLUXSN_PE[iep] = fluxsn_pe * gain ;
+
+    nea        = FLUXNOISE_BATCH.NEA[iep];
+    skysig_pe  = FLUXNOISE_BATCH.SKYSIG[iep] * gain ;
+    readnoise  = FLUXNOISE_BATCH.READNOISE[iep];
+    FLUXNOISE_BATCH.SQSIG_SKY_PE[iep] = nea * (skysig_pe*skysig_pe);
+    FLUXNOISE_BATCH.SQSIG_CCD_PE[iep] = nea * (readnoise*readnoise);
+    FLUXNOISE_BATCH.SQSIG_ZP_PE[iep]  = 0.0 ;
+  }
+
+  if ( OPT_ZP ) {
+    for ( iep = 0; iep < NEP; iep++ ) {
+      relerr = pow(TEN, 0.4*FLUXNOISE_BATCH.ZPTERR[iep]) - 1.0 ;
+      err    = FLUXNOISE_BATCH.FLUXSN_PE[iep] * relerr ;
+      FLUXNOISE_BATCH.SQSIG_ZP_PE[iep] = err*err ;
+    }
+  }
+
+  // - - - - - - - - - - - - - - - - - - - - - - -
+  // scatter into FLUXNOISE struct for each epoch
+  for ( iep = 0; iep < NEP; iep++ ) {
+    epoch     = FLUXNOISE_BATCH.EPOCH[iep];
+    ifilt_obs = GENLC.IFILT_OBS[epoch] ;
+    FLUXNOISE = &GENLC.FLUXNOISE[epoch];
+
+    fluxsn_pe  = FLUXNOISE_BATCH.FLUXSN_PE[iep];
+    sqsig_noZ  = fluxsn_pe + 
+      FLUXNOISE_BATCH.SQSIG_SKY_PE[iep] + FLUXNOISE_BATCH.SQSIG_CCD_PE[iep];
+    sqsig_true = sqsig_noZ ;
+    sqsig_data = sqsig_noZ ;
+    if ( OPT_ZP_TRUE ) { sqsig_true += FLUXNOISE_BATCH.SQSIG_ZP_PE[iep]; }
+    if ( OPT_ZP_DATA ) { sqsig_data += FLUXNOISE_BATCH.SQSIG_ZP_PE[iep]; }
+
+    FLUXNOISE->SQSIG_SRC       = fluxsn_pe ;
+    FLUXNOISE->SQSIG_TSRC      = 0.0 ;
+    FLUXNOISE->SQSIG_SKY       = 
+      FLUXNOISE_BATCH.SQSIG_SKY_PE[iep] + FLUXNOISE_BATCH.SQSIG_CCD_PE[iep];
+    FLUXNOISE->SQSIG_TSKY      = 0.0 ;
+    FLUXNOISE->SQSIG_ZP        = FLUXNOISE_BATCH.SQSIG_ZP_PE[iep] ;
+    FLUXNOISE->SQSIG_HOST_PHOT = 0.0 ;
+
+    FLUXNOISE->SQSIG_CALC_TRUE[TYPE_FLUXNOISE_S]    = sqsig_noZ ;
+    FLUXNOISE->SQSIG_CALC_TRUE[TYPE_FLUXNOISE_SZ]   = sqsig_true ;
+    FLUXNOISE->SQSIG_CALC_TRUE[TYPE_FLUXNOISE_T]    = 0.0 ;
+    FLUXNOISE->SQSIG_CALC_TRUE[TYPE_FLUXNOISE_Z]    = 
+      FLUXNOISE_BATCH.SQSIG_ZP_PE[iep] ;
+    FLUXNOISE->SQSIG_CALC_TRUE[TYPE_FLUXNOISE_F]    = 0.0 ;
+    FLUXNOISE->SQSIG_CALC_TRUE[TYPE_FLUXNOISE_SUM]  = sqsig_true ;
+
+    for(itype=0; itype < NTYPE_FLUXNOISE ; itype++ )  { 
+      FLUXNOISE->SQSIG_FUDGE_TRUE[itype] = 0.0 ;
+      FLUXNOISE->SQSIG_FINAL_TRUE[itype] = FLUXNOISE->SQSIG_CALC_TRUE[itype]; 
+    }
+
+    FLUXNOISE->SQSIG_CALC_DATA   = sqsig_data ;
+    FLUXNOISE->SQSIG_FUDGE_DATA  = 0.0 ;
+    FLUXNOISE->SQSIG_FINAL_DATA  = sqsig_data ;
+
+    FLUXNOISE->SNR_CALC_S        = fluxsn_pe / sqrt(sqsig_noZ) ;
+    FLUXNOISE->SNR_CALC_ST       = FLUXNOISE->SNR_CALC_S ;
+    FLUXNOISE->SNR_CALC_SZT      = fluxsn_pe / sqrt(sqsig_data) ;
+    FLUXNOISE->SNR_CALC_MON      = 0.0 ;
+    FLUXNOISE->SNR_FINAL_MON     = 0.0 ;
+
+    FLUXNOISE->NEA               = FLUXNOISE_BATCH.NEA[iep] ;
+    FLUXNOISE->GALMAG_NEA        = 0.0 ;
+    FLUXNOISE->Npe_over_FLUXCAL  = FLUXNOISE_BATCH.Npe_over_FLUXCAL[iep] ;
+    FLUXNOISE->NADU_over_Npe     = FLUXNOISE_BATCH.NADU_over_Npe[iep] ;
+
+    FLUXNOISE->IFILT_OBS = ifilt_obs ;
+    FLUXNOISE->BAND[0]   = FILTERSTRING[ifilt_obs] ;
+    FLUXNOISE->BAND[1]   = 0 ;
+  }
+
+  return 1 ;
+
+} // end gen_fluxNoise_calc_batch
+
 // ********************************************************
 void  gen_fluxNoise_fudge_diag(int epoch, int VBOSE, FLUXNOISE_DEF *FLUXNOISE){
 
@@ -27527,7 +29387,7 @@ void  gen_fluxNoise_fudge_diag(int epoch, int VBOSE, FLUXNOISE_DEF *FLUXNOISE){
     // keep track of NOBS per covariance matrix
     FLUXNOISE->INDEX_REDCOV = -9 ;
     if ( NREDCOV_FLUXERRMODEL > 0 ) {
-      ICOV = INDEX_REDCOV_FLUXERRMODEL(BAND,FIELD,2,fnam);      
+      ICOV = ICOV_DISPATCH_FLUXERRMODEL(BAND,FIELD,fnam);      
       COVINFO_FLUXERRMODEL[ICOV].NOBS++ ;
       FLUXNOISE->INDEX_REDCOV = ICOV;
     }
@@ -27708,6 +29568,14 @@ void gen_fluxNoise_fudge_cov(int icov) {
   // GENLC.NEPOCH total epochs, so watch indices.
   //
   // Sep 3 2023: make sparse list of epochs for speed.
+  //
+  // Oct 15 2026: REDCOV is a single correlation for all pairs in "icov"
+  //   group, so the reduced correlation matrix is equicorrelated and its
+  //   Cholesky factor has a closed form; see chol_equicorr_fluxNoise.
+  //   This is O(NOBS) instead of O(NOBS^3), and gives the same randoms
+  //   as the gsl Cholesky decomp. Full matrix + gsl is kept only for
+  //   LDMP cross-check.
+  // Oct 15 2026: scratch arrays from per-event ARENA_EVENT (no free)
 
   int  NOBS = COVINFO_FLUXERRMODEL[icov].NOBS ;
   int  MEMD0 = NOBS*sizeof(double);
@@ -27735,7 +29603,7 @@ void gen_fluxNoise_fudge_cov(int icov) {
 
   // create matrix for each cov matrix
 
-  epMAP          = (int   *) malloc( NOBS * sizeof(int) );
+  epMAP = (int*) arena_alloc(&ARENA_EVENT, NOBS*sizeof(int) );
 
   // make sparse list epMAP of epochs to process
   for(iep0=1; iep0 <= NEPOCH; iep0++ ) {
@@ -27755,7 +29623,7 @@ void gen_fluxNoise_fudge_cov(int icov) {
   // reset NOBS based on NEP passing SNR cut
   NOBS = COVINFO_FLUXERRMODEL[icov].NOBS = NEPOCH_USE;
 
-  if ( NOBS == 0 ) { free(epMAP); return; } // avoid crash on zero-size matrix below
+  if ( NOBS == 0 ) { return; } // avoid crash on zero-size matrix below
 
   /* xxx
   if ( SIMLIB_HEADER.LIBID == 1273 ) {
@@ -27764,9 +29632,29 @@ void gen_fluxNoise_fudge_cov(int icov) {
   }
   */
 
-  covFlux_1D     = (double*) malloc (NOBS*NOBS * sizeof(double) ) ;
-  covCholesky_2D = (double**)malloc(MEMD1) ;
-  for(o=0; o < NOBS; o++ ) { covCholesky_2D[o] = (double*) malloc(MEMD0); }
+  // - - - - - - 
+  // fast path: closed-form Cholesky of equicorrelated matrix.
+  // Sigma cancels in GAURAN_NEW = flux_scatter/SIG_F, so only the
+  // reduced correlation matrix is needed.
+  if ( !LDMP ) {
+    double *gauran_orig = (double*) arena_alloc(&ARENA_EVENT, MEMD0);
+    double *gauran_new  = (double*) arena_alloc(&ARENA_EVENT, MEMD0);
+    REDCOV = COVINFO_FLUXERRMODEL[icov].REDCOV;
+    for(o=0; o < NOBS; o++ ) 
+      { ep = epMAP[o]; gauran_orig[o] = GENLC.RANGauss_NOISE_FUDGE[ep]; }
+
+    chol_equicorr_fluxNoise(NOBS, REDCOV, gauran_orig, gauran_new);
+
+    for(o=0; o < NOBS; o++ ) 
+      { ep = epMAP[o]; GENLC.RANGauss_NOISE_FUDGE[ep] = gauran_new[o]; }
+
+    return ;
+  }
+
+  covFlux_1D     = (double*) arena_alloc(&ARENA_EVENT, NOBS*MEMD0) ;
+  covCholesky_2D = (double**)arena_alloc(&ARENA_EVENT, MEMD1) ;
+  for(o=0; o < NOBS; o++ ) 
+    { covCholesky_2D[o] = (double*) arena_alloc(&ARENA_EVENT, MEMD0); }
 
   // - - - - - - 
   for(obs0=0; obs0 < NOBS; obs0++ ) {
@@ -27810,7 +29698,7 @@ void gen_fluxNoise_fudge_cov(int icov) {
   double *flux_scatter, GAURAN, GAURAN_ORIG, GAURAN_NEW, SIG_F ;
   gsl_matrix_view chk;
 
-  flux_scatter = (double*) malloc( MEMD0 );
+  flux_scatter = (double*) arena_alloc(&ARENA_EVENT, MEMD0 );
   chk  = gsl_matrix_view_array ( covFlux_1D, NOBS, NOBS); 
   gsl_linalg_cholesky_decomp ( &chk.matrix )  ; // <== slowest step, beware
   
@@ -27846,19 +29734,58 @@ void gen_fluxNoise_fudge_cov(int icov) {
     GENLC.RANGauss_NOISE_FUDGE[ep] = GAURAN_NEW ;
   } // end o loop
 
+  return ;
+
+} // end of  gen_fluxNoise_fudge_cov
+
+
+// ******************************
+void chol_equicorr_fluxNoise(int N, double rho, double *gauran_in, 
+			     double *gauran_out) {
+
+  // Created Oct 2026
+  // Return gauran_out = L * gauran_in where L is the lower-triangular
+  // Cholesky factor of the NxN equicorrelation matrix
+  //     R_ij = 1 (i=j),  rho (i!=j)
+  //
+  // Column k of L has diagonal d_k and a constant value c_k below the
+  // diagonal, with
+  //     s_k = sum_{j<k} c_j^2
+  //     d_k = sqrt(1 - s_k)
+  //     c_k = (rho - s_k) / d_k
+  //
+  // so that L*g is evaluated with a running sum in O(N), identical
+  // to the gsl Cholesky decomp of the full matrix.
+
+  int    k;
+  double s = 0.0, d, c, sum_cg = 0.0 ;
+  double DTINY = 1.0E-12 ;
+  char fnam[] = "chol_equicorr_fluxNoise" ;
 
+  // ------------ BEGIN ------------
 
-  // free matrix memory.
-  free(covFlux_1D);
+  if ( N > 1 && (rho <= -1.0/(double)(N-1) || rho > 1.0) ) {
+    sprintf(c1err,"REDCOV=%f is not positive-definite for NOBS=%d", 
+	    rho, N);
+    sprintf(c2err,"Check FLUXERRMODEL_REDCOV keys.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err) ; 
+  }
 
-  for(o=0; o < NOBS; o++ ) { free(covCholesky_2D[o]); }
-  free(covCholesky_2D);
+  for(k=0; k < N; k++ ) {
+    d = 1.0 - s ;
+    d = ( d > 0.0 ) ? sqrt(d) : 0.0 ;
 
-  free(epMAP);  free(flux_scatter);
+    gauran_out[k] = sum_cg + d * gauran_in[k] ;
+
+    // rho=1 -> all remaining epochs are fully correlated with first one
+    c = ( d > DTINY ) ? (rho - s)/d : 0.0 ;
+    sum_cg += c * gauran_in[k] ;
+    s      += c * c ;
+  }
 
   return ;
 
-} // end of  gen_fluxNoise_fudge_cov
+} // end chol_equicorr_fluxNoise
 
 
 // *********************a****************
@@ -28491,14 +30418,15 @@ void compute_lightCurveWidths(void) {
   // These quantities are for SIMGEN_DUMP file
   // (varNames WIDTH_[band] ).
   // Apr 2023: also set PERIOD for Galactic recurring
+  // Oct 15 2026: call get_lightCurveWidth_bands for all bands at once
+  //   (one sort per event instead of per band, and no per-band malloc)
   //
 
-  int ifilt, ifilt_obs, N, ep, NEP[MXFILTINDX], ERRFLAG ;
-  int MEM = (GENLC.NEPOCH+1) * sizeof(double) ;
+  int ifilt, ifilt_obs, ep, NEP = GENLC.NEPOCH ;
   int OPTMASK = 1 ;
   int IPAR_PERIOD = LCLIB_INFO.IPAR_PERIOD ;
-  double *TLIST[MXFILTINDX], *MAGLIST[MXFILTINDX] ;
-  char FUNCALL[100], cfilt[2] ;
+  double WIDTH[MXFILTINDX], *SCRATCH ;
+  int    *IFILTLIST, *ISCRATCH ;
   char fnam[] = "compute_lightCurveWidths" ;
   
   // --------------- BEGIN -------------
@@ -28511,48 +30439,32 @@ void compute_lightCurveWidths(void) {
 
   if ( GENLC.NWIDTH_SIMGEN_DUMP == 0 ) { return ; }
 
-  // first allocate memory to store LC separately in each band.
-  for ( ifilt=0; ifilt < GENLC.NFILTDEF_OBS; ifilt++ ) {
-    ifilt_obs = GENLC.IFILTMAP_OBS[ifilt];
-    GENLC.WIDTH[ifilt_obs] = -9.0 ; // init to undefined
-    if ( GENLC.DOFILT[ifilt_obs] == 0 ) { continue ; }
-    TLIST[ifilt_obs]   = (double*)malloc(MEM);
-    MAGLIST[ifilt_obs] = (double*)malloc(MEM);
-    NEP[ifilt_obs]     = 0 ;
-  }
-
-  // load LC for each band
+  // scratch buffers for all epochs; epochs of unused bands are 
+  // flagged with IFILTLIST = -1
+  SCRATCH   = (double*)malloc( 3*(NEP+1)*sizeof(double) );
+  ISCRATCH  = (int   *)malloc(   (NEP+1)*sizeof(int)    );
+  IFILTLIST = (int   *)malloc(   (NEP+1)*sizeof(int)    );
 
-  for(ep=1; ep <= GENLC.NEPOCH; ep++ ) {
+  for(ep=1; ep <= NEP; ep++ ) {
     ifilt_obs = GENLC.IFILT_OBS[ep] ;    
-    if ( GENLC.DOFILT[ifilt_obs] == 0 ) { continue ; }
-    N = NEP[ifilt_obs];
-    TLIST[ifilt_obs][N]   = GENLC.epoch_obs[ep] ;
-    MAGLIST[ifilt_obs][N] = GENLC.genmag_obs[ep] ;
-    NEP[ifilt_obs]++ ;
+    IFILTLIST[ep-1] = ( GENLC.DOFILT[ifilt_obs] ) ? ifilt_obs : -1 ;
   }
- 
 
-  // compute Width, then free memory
+  get_lightCurveWidth_bands(OPTMASK, NEP, 
+			    &GENLC.epoch_obs[1], &GENLC.genmag_obs[1], 
+			    IFILTLIST, isSorted_double(NEP,&GENLC.epoch_obs[1]),
+			    SCRATCH, ISCRATCH,
+			    WIDTH, fnam);
+
   for ( ifilt=0; ifilt < GENLC.NFILTDEF_OBS; ifilt++ ) {
     ifilt_obs = GENLC.IFILTMAP_OBS[ifilt];
+    GENLC.WIDTH[ifilt_obs] = -9.0 ; // init to undefined
     if ( GENLC.DOFILT[ifilt_obs] == 0 ) { continue ; }
-
-    // construct error-message string
-    sprintf(cfilt, "%c", FILTERSTRING[ifilt_obs] );
-    sprintf(FUNCALL, "%s(%s)", fnam, cfilt);
-    
-    //      printf(" xxx ------------------ \n");
-    //      printf(" xxx PEAKMJD = %.3f  LIBID=%d \n",
-    //	     GENLC.PEAKMJD, GENLC.SIMLIB_ID );
-  GENLC.WIDTH[ifilt_obs] = 
-    get_lightCurveWidth(OPTMASK, NEP[ifilt_obs], 
-			TLIST[ifilt_obs], MAGLIST[ifilt_obs], &ERRFLAG,FUNCALL);
-    
-    // free memory for this band
-    free(TLIST[ifilt_obs]);  free(MAGLIST[ifilt_obs]);
+    GENLC.WIDTH[ifilt_obs] = WIDTH[ifilt_obs] ;
   }
 
+  free(SCRATCH);  free(ISCRATCH);  free(IFILTLIST);
+
   return ;
 
 } // end compute_lightCurveWidths
@@ -28594,6 +30506,127 @@ void compute_galactic_coords(void) {
 } // end compute_galactic_coords
 
 
+// *********************************************
+bool USE_genmodel_BATCH(void) {
+
+  // Created Oct 2026
+  // Returns true if model has an all-filter batch function that
+  // can be called from genmodel_BATCH. Restrictions:
+  //   + observer-frame model (no rest-frame filter neighbors)
+  //   + no model interpolation on epoch grid (TGRIDSTEP_MODEL_INTERP)
+  // Models are added here as genmag_[MODEL]_BATCH functions are written.
+
+  if ( GENFRAME_OPT != GENFRAME_OBS )              { return false; }
+  if ( INPUTS.TGRIDSTEP_MODEL_INTERP > 0.001 )     { return false; }
+  if ( INDEX_GENMODEL == MODEL_SALT2 )             { return true;  }
+  return false;
+
+} // end USE_genmodel_BATCH
+
+
+// *********************************************
+void genmodel_BATCH(void) {
+
+  // Created Oct 2026
+  // Unified entry to generate model mags for all filters and
+  // epochs of an event with a single call to genmag_[MODEL]_BATCH.
+  // Per-filter epoch lists are loaded into GENFILT (as in genmodel)
+  // and passed as pointers via GENMAG_BATCH; then intrinsic smearing
+  // and GENLC re-loading are done per filter as in genmodel.
+  // Must be called only if USE_genmodel_BATCH() is true.
+
+  int    ifilt, ifilt_obs, i, NEPFILT, OPTMASK ;
+  double z      = GENLC.REDSHIFT_HELIO ;
+  double mwebv  = GENLC.MWEBV_SMEAR ;
+  GENMAG_BATCH_DEF GENMAG_BATCH ;
+  char fnam[] = "genmodel_BATCH" ;
+
+  // ------------ BEGIN ------------
+
+  GENMAG_BATCH.NFILT = 0 ;
+  for ( ifilt=0; ifilt < GENLC.NFILTDEF_OBS; ifilt++ ) {
+    ifilt_obs = GENLC.IFILTMAP_OBS[ifilt] ;
+    if ( GENLC.DOFILT[ifilt_obs] == 0 ) { continue ; }
+
+    i = GENMAG_BATCH.NFILT ;
+    GENMAG_BATCH.IFILT_OBS[i] = ifilt_obs ;
+    GENMAG_BATCH.NEP[i]       = NEPFILT_GENLC(1,ifilt_obs);
+    GENMAG_BATCH.TOBS[i]      = &GENFILT.Tobs[ifilt_obs][1] ;
+    GENMAG_BATCH.MAG[i]       = &GENFILT.genmag_obs[ifilt_obs][1] ;
+    GENMAG_BATCH.MAGERR[i]    = &GENFILT.generr_obs[ifilt_obs][1] ;
+    GENMAG_BATCH.NFILT++ ;
+  }
+
+  sprintf(GENLC.SNTYPE_NAME, "%s", INPUTS.MODELNAME );
+
+  if ( INDEX_GENMODEL == MODEL_SALT2 ) {
+    double parList_SN[5], parList_HOST[3];
+    load_parList_SALT2_genmodel(parList_SN, parList_HOST);
+    OPTMASK = 0 ; // return mag
+    genmag_SALT2_BATCH(OPTMASK, &GENMAG_BATCH, parList_SN, parList_HOST,
+		       mwebv, z, z );
+  }
+  else {
+    sprintf(c1err,"No batch option for INDEX_GENMODEL=%d (%s)",
+	    INDEX_GENMODEL, INPUTS.MODELNAME );
+    sprintf(c2err,"Check USE_genmodel_BATCH");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  // intrinsic smearing and re-load GENLC for each filter
+  for ( i=0; i < GENMAG_BATCH.NFILT; i++ ) {
+    ifilt_obs = GENMAG_BATCH.IFILT_OBS[i] ;
+    NEPFILT   = GENMAG_BATCH.NEP[i];
+    genmodelSmear(NEPFILT, ifilt_obs, -9, z, GENMAG_BATCH.TOBS[i],
+		  GENMAG_BATCH.MAG[i], GENMAG_BATCH.MAGERR[i] ); 
+    NEPFILT_GENLC(-1, ifilt_obs);
+  }
+
+  return ;
+
+} // end genmodel_BATCH
+
+// *********************************************
+void load_parList_SALT2_genmodel(double *parList_SN, double *parList_HOST) {
+
+  // Created Oct 2026
+  // Load SALT2 parList_SN = {x0, x1, c, x1_forErr, x2} and
+  // parList_HOST = {RV, AV, logMass} for genmag_SALT2, including
+  // scatter matrix. Code moved from genmodel so that it can be
+  // also used by genmodel_BATCH.
+
+  double S2x0, S2x1, S2c, S2mB, tmp, logMass=-9.0 ;
+
+  // ------------ BEGIN ------------
+
+  // apply scatter matrix
+  S2mB = GENLC.SALT2mB + GENLC.COVMAT_SCATTER[0] ;
+  S2x1 = GENLC.SALT2x1 + GENLC.COVMAT_SCATTER[1] ;
+  S2c  = GENLC.SALT2c  + GENLC.COVMAT_SCATTER[2] ;
+  tmp  = -0.4 * GENLC.COVMAT_SCATTER[0] ;
+  S2x0 = GENLC.SALT2x0 * pow(10.0,tmp);
+
+  int m      = SNHOSTGAL.IMATCH_TRUE_SORT;
+  if(m >= 0 && HOSTLIB.IVAR_LOGMASS_TRUE > 0 ) {
+    int i_prop = getindex_HOSTGAL_PROPERTY(HOSTGAL_PROPERTY_BASENAME_LOGMASS);
+    logMass = SNHOSTGAL_DDLR_SORT[m].HOSTGAL_PROPERTY_VALUE[i_prop].VAL_TRUE;
+  }
+
+  parList_SN[0] = S2x0 ;
+  parList_SN[1] = S2x1 ;
+  parList_SN[2] = S2c ;
+  parList_SN[3] = S2x1 ; // x1 for error
+  parList_SN[4] = 0.0 ;  // x2 not generated
+
+  parList_HOST[0] = GENLC.RV ;
+  parList_HOST[1] = GENLC.AV ;
+  parList_HOST[2] = logMass ;
+
+  return ;
+
+} // end load_parList_SALT2_genmodel
+
+
 // *********************************************
 void genmodel(
 	      int ifilt_obs  // observer filter index 
@@ -28825,22 +30858,8 @@ void genmodel(
     printf(" xxx passing ifilt_obs=%d x0=%f x1=%f c=%f \n",
 	   ifilt_obs,GENLC.SALT2x0, GENLC.SALT2x1, GENLC.SALT2c );
     */
-    // apply scatter matrix
-    double S2x0, S2x1, S2c, S2mB, tmp, logMass=-9.0 ;
-    S2mB = GENLC.SALT2mB + GENLC.COVMAT_SCATTER[0] ;
-    S2x1 = GENLC.SALT2x1 + GENLC.COVMAT_SCATTER[1] ;
-    S2c  = GENLC.SALT2c  + GENLC.COVMAT_SCATTER[2] ;
-    tmp  = -0.4 * GENLC.COVMAT_SCATTER[0] ;
-    S2x0 = GENLC.SALT2x0 * pow(10.0,tmp);
-
-    int m      = SNHOSTGAL.IMATCH_TRUE_SORT;
-    if(m >= 0 && HOSTLIB.IVAR_LOGMASS_TRUE > 0 ) {
-      int i_prop = getindex_HOSTGAL_PROPERTY(HOSTGAL_PROPERTY_BASENAME_LOGMASS);
-      logMass = SNHOSTGAL_DDLR_SORT[m].HOSTGAL_PROPERTY_VALUE[i_prop].VAL_TRUE;
-    }
-
-    double parList_SN[4]   = { S2x0, S2x1, S2c, S2x1 } ;
-    double parList_HOST[3] = { RV, AV, logMass } ;
+    double parList_SN[5], parList_HOST[3];
+    load_parList_SALT2_genmodel(parList_SN, parList_HOST) ;
 
     genmag_SALT2 (
 		  OPTMASK         // (I) bit-mask options
@@ -29250,6 +31269,8 @@ void genmodelSmear(int NEPFILT, int ifilt_obs, int ifilt_rest,  double z,
   //
   // Jun 14 2016: load GENLC.MAGSMEAR_COH at end of function
   // Nov 15 2022: float -> double for lam[xyz]
+  // Oct 14 2026: set parList[3] (logMass) so that per-event genSmear
+  //              table is not invalidated by garbage.
 
   int
     iep, opt_frame, ifilt_local
@@ -29383,6 +31404,7 @@ void genmodelSmear(int NEPFILT, int ifilt_obs, int ifilt_rest,  double z,
       parList[0] = Trest;
       parList[1] = GENLC.SALT2x1;
       parList[2] = GENLC.SALT2c ;
+      parList[3] = -9.0 ; // logMass not used here
       // xxx .xyz parList[3] = SNHOSTGAL_DDLR_SORT[0].LOGMASS_TRUE ;
       get_genSmear(parList, ONE,  &lamrest, &magSmear_model);
       magSmear = magSmear_model ;
@@ -30354,6 +32376,11 @@ void init_simFiles(SIMFILE_AUX_DEF *SIMFILE_AUX) {
   //              it is easily found by batch script.
   sprintf(SIMFILE_AUX->YAML,  "%s.YAML",  INPUTS.GENVERSION ); // Aug 10, 2020
 
+  // Oct 2026: optional live status file, also local for workflow managers
+  SIMFILE_AUX->STATUS[0] = 0 ;
+  if ( INPUTS.STATUS_UPDATE_SEC > 0.0 ) 
+    { sprintf(SIMFILE_AUX->STATUS, "%s.STATUS", INPUTS.GENVERSION ); }
+
 
   // create mandatory files.
   SIMFILE_AUX->FP_LIST   = fopen(SIMFILE_AUX->LIST,   "wt") ;  
@@ -30550,6 +32577,9 @@ void end_simFiles(SIMFILE_AUX_DEF *SIMFILE_AUX) {
   if ( INPUTS.WRFLAG_YAML_FILE > 0 ) 
     { printf("  %s \n", SIMFILE_AUX->YAML ); }  // for batch mode, Aug 10 2020
 
+  if ( SIMFILE_AUX->STATUS[0] != 0 ) 
+    { printf("  %s \n", SIMFILE_AUX->STATUS ); }
+
   if ( WRFLAG_FILTERS ) 
     { printf("  %s \n", SIMFILE_AUX->PATH_FILTERS ); }  // it's a subdir
 
@@ -30590,6 +32620,11 @@ void end_simFiles(SIMFILE_AUX_DEF *SIMFILE_AUX) {
   // Aug 10 2020: in batch mode, write few stats to YAML formatted file
   if ( INPUTS.WRFLAG_YAML_FILE > 0 ) {  wr_SIMGEN_YAML_SUMMARY(SIMFILE_AUX); } 
 
+  // Oct 2026: final live-status update with STATE: DONE
+  update_SIMGEN_STATUS(OPT_STATUS_END, SIMFILE_AUX);
+
+  if ( IS_PySEDMODEL ) { end_SEDCACHE_PySEDMODEL(); }
+
 #ifdef MODELGRID_GEN
   if ( GENLC.IFLAG_GENSOURCE == IFLAG_GENGRID ) {
     printf("  %s\n", SIMFILE_AUX->GRIDGEN );
@@ -30601,6 +32636,8 @@ void end_simFiles(SIMFILE_AUX_DEF *SIMFILE_AUX) {
   if ( WRFLAG_FITS) { 
     if ( INPUTS.JOBID > 0 && INPUTS.GZIP_DATA_FILES ) 
       { OPTMASK = OPTMASK_SNFITSIO_END_GZIP; }
+    if ( WRFLAG_PACK ) 
+      { OPTMASK += OPTMASK_SNFITSIO_END_PACK; }  // Oct 2026
     WR_SNFITSIO_END(OPTMASK); 
   }
 
@@ -30646,6 +32683,1012 @@ void hide_readme_file(char *readme_file, char *hide_readme_file) {
   
 } // end hide_readme_file
 
+// ==================================
+void fork_simThreads(void) {
+
+  // Created Oct 2026
+  // For NTHREAD > 1, fork NTHREAD worker processes after the full init
+  // so that each worker inherits (copy-on-write) the HOSTLIB, SIMLIB
+  // header, calib tables and model inits without re-reading them.
+  // Each worker generates a contiguous range of the global event
+  // index ilc (so that CIDs are unique) and writes its own split
+  // version [GENVERSION]_THREADnn. The parent waits for all workers,
+  // merges the split versions into GENVERSION, and exits.
+  // Only worker processes return from this function.
+
+  int  NTHREAD = INPUTS.NTHREAD ;
+  int  ithread, NERR, wstatus ;
+  pid_t pid ;
+  char fnam[] = "fork_simThreads" ;
+
+  // ------------ BEGIN -------------
+
+  if ( NTHREAD > MXTHREAD_SIM ) {
+    sprintf(c1err,"NTHREAD=%d exceeds bound", NTHREAD );
+    sprintf(c2err,"Check MXTHREAD_SIM = %d", MXTHREAD_SIM );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  check_simThreads(NTHREAD, "NTHREAD");
+
+  sprintf(BANNER,"%s: fork %d workers for NGEN=%d", 
+	  fnam, NTHREAD, INPUTS.NGEN);
+  print_banner(BANNER);
+
+  // flush before fork to avoid duplicate buffered output in workers
+  fflush(stdout);
+
+  for(ithread=0; ithread < NTHREAD; ithread++ ) {
+    pid = fork();
+    if ( pid < 0 ) {
+      sprintf(c1err,"fork failed for ithread=%d", ithread );
+      sprintf(c2err,"NTHREAD=%d", NTHREAD );
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+    }
+    else if ( pid == 0 ) {
+      // worker process
+      prep_simThread(ithread);
+      return ;
+    }
+
+    SIMTHREAD_INFO.PID[ithread] = pid ;
+  }
+
+  // - - - - - - - - - - - - - - - - - - - - - 
+  // parent: wait for all workers
+  NERR = 0;
+  for(ithread=0; ithread < NTHREAD; ithread++ ) {
+    pid = waitpid(SIMTHREAD_INFO.PID[ithread], &wstatus, 0);
+    if ( pid < 0 || !WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0 ) {
+      printf(" ERROR: worker ithread=%d (pid=%d) failed\n", 
+	     ithread, (int)SIMTHREAD_INFO.PID[ithread] );
+      NERR++ ;
+    }
+  }
+
+  if ( NERR > 0 ) {
+    sprintf(c1err,"%d of %d workers failed", NERR, NTHREAD);
+    sprintf(c2err,"Check worker output above.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  merge_simThreads();
+
+  sprintf(BANNER,"%s: Done merging %d workers into %s", 
+	  fnam, NTHREAD, SIMTHREAD_INFO.GENVERSION_PARENT );
+  print_banner(BANNER);
+
+  exit(0);
+
+} // end fork_simThreads
+
+// ==================================
+void fork_GRIDthreads(int NTHREAD) {
+
+  // Created Oct 2026
+  // GRIDGEN option with NTHREAD > 1; called after grid-file header
+  // is written. Each forked worker generates a contiguous range of
+  // grid light curves and writes I2 blocks to [GRIDGEN]_THREADnn.
+  // Parent waits, copies the blocks into the grid file 
+  // (merge_GRIDthreads), and returns with all grid points written;
+  // ILC_MIN is set past NGEN so that the main loop does nothing.
+  // Workers exit here.
+
+  int  NGEN = INPUTS.NGEN ;
+  int  NGEN_PER_THREAD = NGEN / NTHREAD ;
+  int  ithread, ilc, ILC_MIN, ILC_MAX, istat, NERR, wstatus ;
+  char THREAD_FILE[MXPATHLEN], *GRIDGEN_FILE = GENLC.SIMFILE_AUX.GRIDGEN ;
+  pid_t pid ;
+  char fnam[] = "fork_GRIDthreads" ;
+
+  // ------------ BEGIN -------------
+
+  if ( NTHREAD > MXTHREAD_SIM ) {
+    sprintf(c1err,"NTHREAD=%d exceeds bound", NTHREAD );
+    sprintf(c2err,"Check MXTHREAD_SIM = %d", MXTHREAD_SIM );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  if ( OPT_GRIDGEN_FORMAT != OPT_GRIDGEN_FORMAT_FITS ) {
+    sprintf(c1err,"NTHREAD=%d requires GRID_FORMAT: FITS", NTHREAD );
+    sprintf(c2err,"but GRID_FORMAT = %s", GRIDGEN_INPUTS.FORMAT );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  sprintf(BANNER,"%s: fork %d workers for %d grid light curves", 
+	  fnam, NTHREAD, NGEN);
+  print_banner(BANNER);
+
+  // flush all streams before fork to avoid duplicate output
+  fflush(NULL);
+
+  for(ithread=0; ithread < NTHREAD; ithread++ ) {
+
+    ILC_MIN = 1 + ithread * NGEN_PER_THREAD ;
+    ILC_MAX = ILC_MIN + NGEN_PER_THREAD - 1 ;
+    if ( ithread == NTHREAD-1 ) { ILC_MAX = NGEN; }
+
+    pid = fork();
+    if ( pid < 0 ) {
+      sprintf(c1err,"fork failed for ithread=%d", ithread );
+      sprintf(c2err,"NTHREAD=%d", NTHREAD );
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+    }
+    else if ( pid == 0 ) {
+      // worker process
+      sprintf(THREAD_FILE,"%s_%s%2.2d", 
+	      GRIDGEN_FILE, SUFFIX_SIMTHREAD, ithread);
+      GRIDGEN_BLOCK.ITHREAD   = ithread ;
+      GRIDGEN_BLOCK.FP_THREAD = fopen(THREAD_FILE, "wb");
+      if ( !GRIDGEN_BLOCK.FP_THREAD ) {
+	sprintf(c1err,"Could not open worker grid file");
+	sprintf(c2err,"%s", THREAD_FILE );
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+      }
+
+      SIMTHREAD_INFO.ITHREAD = ithread ;
+      set_screen_update(ILC_MAX - ILC_MIN + 1);
+      for ( ilc = ILC_MIN; ilc <= ILC_MAX; ilc++ ) {
+	istat = gen_event_main(&ilc);
+	if ( istat == ISTAT_GENEVENT_STOP ) { break; }
+      }
+
+      flush_GRIDfile_fits();
+      fclose(GRIDGEN_BLOCK.FP_THREAD);
+      printf("\t %s ithread=%d : ilc=%d to %d done\n", 
+	     fnam, ithread, ILC_MIN, ILC_MAX);
+      fflush(stdout);
+
+      // _exit to avoid flushing parent's inherited file buffers
+      _exit(0);
+    }
+
+    SIMTHREAD_INFO.PID[ithread] = pid ;
+  }
+
+  // - - - - - - - - - - - - - - - - - - - - - 
+  // parent: wait for all workers
+  NERR = 0;
+  for(ithread=0; ithread < NTHREAD; ithread++ ) {
+    pid = waitpid(SIMTHREAD_INFO.PID[ithread], &wstatus, 0);
+    if ( pid < 0 || !WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0 ) {
+      printf(" ERROR: worker ithread=%d (pid=%d) failed\n", 
+	     ithread, (int)SIMTHREAD_INFO.PID[ithread] );
+      NERR++ ;
+    }
+  }
+
+  if ( NERR > 0 ) {
+    sprintf(c1err,"%d of %d workers failed", NERR, NTHREAD);
+    sprintf(c2err,"Check worker output above.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  merge_GRIDthreads(NTHREAD, GRIDGEN_FILE);
+
+  // set counters as if parent generated all grid light curves
+  GENLC.CID  = NGEN ;  // for pointer check in end_GRIDfile
+  NGENEV_TOT = NGENLC_TOT = NGENLC_WRITE = NGEN ;
+  SIMTHREAD_INFO.ILC_MIN = NGEN + 1 ;
+
+  return ;
+
+} // end fork_GRIDthreads
+
+// ==================================
+void check_simThreads(int NTHREAD, char *WHAT) {
+
+  // Created Oct 2026
+  // Abort on options that cannot be split among NTHREAD workers,
+  // and store parent version & path for merge_simThreads.
+  // WHAT = "NTHREAD" for forked workers or "NRANK" for MPI ranks.
+
+  char fnam[] = "check_simThreads" ;
+
+  // ------------ BEGIN -------------
+
+  // NGEN_LC stops on number written, which cannot be split a priori
+  if ( INPUTS.NGEN_LC > 0 ) {
+    sprintf(c1err,"%s=%d requires NGENTOT_LC or NGEN_SEASON", 
+	    WHAT, NTHREAD);
+    sprintf(c2err,"but NGEN_LC = %d", INPUTS.NGEN_LC );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  // sequential-read sources cannot be shared among workers
+  if ( INDEX_GENMODEL == MODEL_LCLIB || 
+       GENLC.IFLAG_GENSOURCE == IFLAG_GENGRID ) {
+    sprintf(c1err,"%s=%d not supported for GENMODEL=%s", 
+	    WHAT, NTHREAD, INPUTS.GENMODEL);
+    sprintf(c2err,"or for GENSOURCE=%s", INPUTS.GENSOURCE );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  SIMTHREAD_INFO.NTHREAD = NTHREAD ;
+  sprintf(SIMTHREAD_INFO.GENVERSION_PARENT,      "%s", INPUTS.GENVERSION);
+  sprintf(SIMTHREAD_INFO.PATH_SNDATA_SIM_PARENT, "%s", PATH_SNDATA_SIM);
+
+  return ;
+
+} // end check_simThreads
+
+// ==================================
+void init_simMPI(int *argc, char ***argv) {
+
+  // Created Oct 2026
+  // For USE_MPI build, init MPI and store rank & size.
+  // Every rank does the full init (HOSTLIB, SIMLIB header, calib ...)
+  // by reading the same files; prep_simMPI then assigns each rank
+  // a contiguous range of the global event index, as for the
+  // forked NTHREAD workers.
+
+#ifdef USE_MPI
+  int IRANK, NRANK;
+
+  // ------------ BEGIN -------------
+
+  MPI_Init(argc, argv);
+  MPI_Comm_rank(MPI_COMM_WORLD, &IRANK);
+  MPI_Comm_size(MPI_COMM_WORLD, &NRANK);
+  SIMTHREAD_INFO.IRANK = IRANK ;
+  SIMTHREAD_INFO.NRANK = NRANK ;
+
+  if ( IRANK == 0 ) 
+    { printf("\t init_simMPI: NRANK = %d \n", NRANK); fflush(stdout); }
+#endif
+
+  return ;
+
+} // end init_simMPI
+
+// ==================================
+void prep_simMPI(void) {
+
+  // Created Oct 2026
+  // Called after full init for MPI build with NRANK > 1.
+  // Each rank is prepared like a forked worker (prep_simThread):
+  // unique ilc range & CIDs, split version [GENVERSION]_THREADnn,
+  // and unique SIMLIB start. With RANDOM_COUNTER, each event is
+  // identical to the serial job regardless of NRANK.
+
+  int  NRANK = SIMTHREAD_INFO.NRANK ;
+  char fnam[] = "prep_simMPI" ;
+
+  // ------------ BEGIN -------------
+
+  if ( INPUTS.NTHREAD > 1 ) {
+    sprintf(c1err,"Cannot use NTHREAD=%d with MPI NRANK=%d", 
+	    INPUTS.NTHREAD, NRANK );
+    sprintf(c2err,"Set NTHREAD=1 or run with 1 MPI rank.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  check_simThreads(NRANK, "NRANK");
+
+  if ( SIMTHREAD_INFO.IRANK == 0 ) {
+    sprintf(BANNER,"%s: split NGEN=%d among %d MPI ranks", 
+	    fnam, INPUTS.NGEN, NRANK);
+    print_banner(BANNER);
+  }
+
+  prep_simThread(SIMTHREAD_INFO.IRANK);
+
+  return ;
+
+} // end prep_simMPI
+
+// ==================================
+void end_simMPI(void) {
+
+  // Created Oct 2026
+  // Called by each MPI rank after simEnd. Wait for all ranks to
+  // finish writing their split version, then rank 0 merges the 
+  // split versions into GENVERSION (LIST, DUMP, README, YAML).
+
+#ifdef USE_MPI
+  int IRANK = SIMTHREAD_INFO.IRANK ;
+
+  // ------------ BEGIN -------------
+
+  fflush(stdout);
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  if ( IRANK == 0 ) {
+    merge_simThreads();
+    sprintf(BANNER,"end_simMPI: Done merging %d ranks into %s", 
+	    SIMTHREAD_INFO.NRANK, SIMTHREAD_INFO.GENVERSION_PARENT );
+    print_banner(BANNER);
+  }
+
+  MPI_Finalize();
+#endif
+
+  return ;
+
+} // end end_simMPI
+
+// ==================================
+int snlc_sim_stream_init(int argc, char **argv) {
+
+  // Created Oct 2026
+  // Library API (snlc_sim_stream.h): full sim init with the same
+  // args as snlc_sim.exe, but without output files or forked workers.
+  // Returns number of events to generate (NGEN).
+
+  // ------------ BEGIN -------------
+
+  SIMSTREAM.USE     = true ;
+  SIMSTREAM.DONE    = false ;
+  SIMSTREAM.PENDING = false ;
+  SIMSTREAM.BATCH   = NULL ;
+
+  init_simMain(argc, argv);
+
+  SIMSTREAM.ILC = SIMTHREAD_INFO.ILC_MIN ;
+  print_banner( " Begin Generating Lightcurves for in-memory stream. " );
+  fflush(stdout);
+
+  return(INPUTS.NGEN) ;
+
+} // end snlc_sim_stream_init
+
+// ==================================
+int snlc_sim_stream_next(SIMSTREAM_BATCH_DEF *BATCH) {
+
+  // Created Oct 2026
+  // Library API: generate events until BATCH is full or generation
+  // is done. Accepted events are loaded into the caller buffers.
+  // An accepted event that does not fit is kept and returned first
+  // in the next batch. Returns number of events in BATCH 
+  // (0 => generation is done).
+
+  int istat ;
+  char fnam[] = "snlc_sim_stream_next" ;
+
+  // ------------ BEGIN -------------
+
+  if ( !SIMSTREAM.USE ) {
+    sprintf(c1err,"Must call snlc_sim_stream_init first.");
+    sprintf(c2err," ");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  BATCH->NEVT = BATCH->NOBS_TOT = 0 ;
+  SIMSTREAM.BATCH = BATCH ;
+
+  if ( SIMSTREAM.PENDING && !copy_simStream_event() ) {
+    sprintf(c1err,"Event with NOBS=%d does not fit in empty batch", 
+	    SNDATA.NOBS);
+    sprintf(c2err,"with MXEVT=%d and MXOBS=%d", BATCH->MXEVT, BATCH->MXOBS);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  while ( !SIMSTREAM.DONE ) {
+    if ( SIMSTREAM.PENDING || BATCH->NEVT >= BATCH->MXEVT ) { break; }
+    if ( SIMSTREAM.ILC > INPUTS.NGEN ) { SIMSTREAM.DONE = true; break; }
+
+    istat = gen_event_main(&SIMSTREAM.ILC);
+    SIMSTREAM.ILC++ ;
+    if ( istat == ISTAT_GENEVENT_STOP ) { SIMSTREAM.DONE = true; }
+  }
+
+  return(BATCH->NEVT);
+
+} // end snlc_sim_stream_next
+
+// ==================================
+void snlc_sim_stream_end(void) {
+
+  // Created Oct 2026
+  // Library API: print generation summary (no output files).
+
+  // ------------ BEGIN -------------
+
+  set_TIMERS(2);
+
+  sprintf(BANNER, " Done generating %d[%d] lightcurves[events] "
+	  "for in-memory stream.", NGENLC_TOT, NGENEV_TOT );
+  print_banner(BANNER);
+  printf("\t (%d lightcurves requested => %d were accepted) \n",
+	 INPUTS.NGEN, NGENLC_WRITE );
+  fflush(stdout);
+
+  SIMSTREAM.USE = false ;
+  return ;
+
+} // end snlc_sim_stream_end
+
+// ==================================
+void load_simStream_event(void) {
+
+  // Created Oct 2026
+  // Called for each accepted event (instead of update_simFiles)
+  // to load SNDATA and copy it into the current stream batch.
+
+  // ------------ BEGIN -------------
+
+  init_SNDATA_EVENT() ; 
+  snlc_to_SNDATA(0) ;
+
+  SIMSTREAM.PENDING = true ;
+  copy_simStream_event();
+
+  return ;
+
+} // end load_simStream_event
+
+// ==================================
+bool copy_simStream_event(void) {
+
+  // Created Oct 2026
+  // Copy accepted event in SNDATA to SIMSTREAM.BATCH.
+  // Returns false (and leaves event PENDING) if the batch is full.
+
+  SIMSTREAM_BATCH_DEF *BATCH = SIMSTREAM.BATCH ;
+  int ievt = BATCH->NEVT ;
+  int ep, NOBS = 0, o, ifilt_obs ;
+
+  // ------------ BEGIN -------------
+
+  for(ep=1; ep <= SNDATA.NEPOCH; ep++ ) 
+    { if ( SNDATA.OBSFLAG_WRITE[ep] ) { NOBS++ ; } }
+
+  if ( ievt >= BATCH->MXEVT || BATCH->NOBS_TOT + NOBS > BATCH->MXOBS ) 
+    { return(false); }
+
+  BATCH->CID[ievt]        = SNDATA.CID ;
+  BATCH->NOBS[ievt]       = NOBS ;
+  BATCH->IOBS_START[ievt] = BATCH->NOBS_TOT ;
+
+  if ( BATCH->SIM_GENTYPE ) 
+    { BATCH->SIM_GENTYPE[ievt]        = SNDATA.SIM_GENTYPE ; }
+  if ( BATCH->SIM_TEMPLATE_INDEX ) 
+    { BATCH->SIM_TEMPLATE_INDEX[ievt] = SNDATA.SIM_TEMPLATE_INDEX ; }
+  if ( BATCH->SIM_REDSHIFT_CMB ) 
+    { BATCH->SIM_REDSHIFT_CMB[ievt]   = SNDATA.SIM_REDSHIFT_CMB ; }
+  if ( BATCH->SIM_PEAKMJD ) 
+    { BATCH->SIM_PEAKMJD[ievt]        = SNDATA.SIM_PEAKMJD ; }
+  if ( BATCH->SIM_DLMU ) 
+    { BATCH->SIM_DLMU[ievt]           = SNDATA.SIM_DLMU ; }
+  if ( BATCH->SIM_SALT2x1 ) 
+    { BATCH->SIM_SALT2x1[ievt]        = SNDATA.SIM_SALT2x1 ; }
+  if ( BATCH->SIM_SALT2c ) 
+    { BATCH->SIM_SALT2c[ievt]         = SNDATA.SIM_SALT2c ; }
+  if ( BATCH->SIM_AV ) 
+    { BATCH->SIM_AV[ievt]             = SNDATA.SIM_AV ; }
+  if ( BATCH->SIM_RV ) 
+    { BATCH->SIM_RV[ievt]             = SNDATA.SIM_RV ; }
+  if ( BATCH->SIM_MWEBV ) 
+    { BATCH->SIM_MWEBV[ievt]          = SNDATA.SIM_MWEBV ; }
+  if ( BATCH->REDSHIFT_FINAL ) 
+    { BATCH->REDSHIFT_FINAL[ievt]     = SNDATA.REDSHIFT_FINAL ; }
+  if ( BATCH->SIM_HOSTLIB_GALID ) 
+    { BATCH->SIM_HOSTLIB_GALID[ievt]  = SNDATA.SIM_HOSTLIB_GALID ; }
+  if ( BATCH->HOSTGAL_OBJID ) 
+    { BATCH->HOSTGAL_OBJID[ievt]      = SNDATA.HOSTGAL_OBJID[0] ; }
+  if ( BATCH->HOSTGAL_PHOTOZ ) 
+    { BATCH->HOSTGAL_PHOTOZ[ievt]     = SNDATA.HOSTGAL_PHOTOZ[0] ; }
+  if ( BATCH->HOSTGAL_SPECZ ) 
+    { BATCH->HOSTGAL_SPECZ[ievt]      = SNDATA.HOSTGAL_SPECZ[0] ; }
+  if ( BATCH->HOSTGAL_LOGMASS_TRUE ) 
+    { BATCH->HOSTGAL_LOGMASS_TRUE[ievt] = SNDATA.HOSTGAL_LOGMASS_TRUE[0]; }
+  if ( BATCH->HOSTGAL_LOGMASS_OBS ) 
+    { BATCH->HOSTGAL_LOGMASS_OBS[ievt]  = SNDATA.HOSTGAL_LOGMASS_OBS[0]; }
+
+  o = BATCH->NOBS_TOT ;
+  for(ep=1; ep <= SNDATA.NEPOCH; ep++ ) {
+    if ( !SNDATA.OBSFLAG_WRITE[ep] ) { continue; }
+    ifilt_obs = SNDATA.FILTINDX[ep] ;
+    BATCH->MJD[o]         = SNDATA.MJD[ep] ;
+    BATCH->BAND[o]        = FILTERSTRING[ifilt_obs] ;
+    BATCH->FLUXCAL[o]     = SNDATA.FLUXCAL[ep] ;
+    BATCH->FLUXCAL_ERR[o] = SNDATA.FLUXCAL_ERRTOT[ep] ;
+    if ( BATCH->SIM_MAGOBS ) 
+      { BATCH->SIM_MAGOBS[o] = SNDATA.SIMEPOCH_MAG[ep] ; }
+    o++ ;
+  }
+
+  BATCH->NOBS_TOT += NOBS ;
+  BATCH->NEVT++ ;
+  SIMSTREAM.PENDING = false ;
+
+  return(true);
+
+} // end copy_simStream_event
+
+
+// ==================================
+void prep_simThread(int ithread) {
+
+  // Created Oct 2026
+  // Called by worker process after fork to
+  //  + set range of global ilc for this worker
+  //  + set split version name and path
+  //  + set JOBID/NJOBTOT logic so that SIMLIB starts at unique LIBID
+  //  + re-init random seed so that each worker is independent
+  //  + re-open SIMLIB so that file pointer is not shared with other workers
+
+  int NTHREAD = SIMTHREAD_INFO.NTHREAD ;
+  int NGEN    = INPUTS.NGEN;
+  int NGEN_PER_THREAD = NGEN / NTHREAD ;
+  int ILC_MIN = 1 + ithread * NGEN_PER_THREAD ;
+  int ILC_MAX = ILC_MIN + NGEN_PER_THREAD - 1 ;
+  char suffix[20], *ptr, PATH_BASE[MXPATHLEN] ;
+  char fnam[] = "prep_simThread" ;
+
+  // ------------ BEGIN -------------
+
+  if ( ithread == NTHREAD-1 ) { ILC_MAX = NGEN; } // last worker gets remainder
+
+  SIMTHREAD_INFO.ITHREAD = ithread ;
+  SIMTHREAD_INFO.ILC_MIN = ILC_MIN ;
+  SIMTHREAD_INFO.ILC_MAX = ILC_MAX ;
+
+  INPUTS.NGEN       = ILC_MAX ;
+  INPUTS.NGENTOT_LC = ILC_MAX - ILC_MIN + 1 ;
+  set_screen_update(INPUTS.NGENTOT_LC);
+
+  // nest worker index inside optional batch-job index
+  if ( INPUTS.NJOBTOT > 0 ) {
+    INPUTS.JOBID   = (INPUTS.JOBID-1) * NTHREAD + ithread + 1 ;
+    INPUTS.NJOBTOT = INPUTS.NJOBTOT * NTHREAD ;
+  }
+  else {
+    INPUTS.JOBID   = ithread + 1 ;
+    INPUTS.NJOBTOT = NTHREAD ;
+  }
+
+  // split version & path
+  sprintf(suffix, "_%s%2.2d", SUFFIX_SIMTHREAD, ithread);
+  strcat(INPUTS.GENVERSION, suffix);
+  strcat(INPUTS.GENPREFIX,  suffix);
+  sprintf(PATH_BASE, "%s", SIMTHREAD_INFO.PATH_SNDATA_SIM_PARENT);
+  ptr = strrchr(PATH_BASE,'/');   if ( ptr != NULL ) { *ptr = 0; }
+  sprintf(PATH_SNDATA_SIM, "%s/%s", PATH_BASE, INPUTS.GENVERSION);
+  sprintf(VERSION_INFO.NAME, "%s", INPUTS.GENVERSION );
+
+  // independent random stream per worker; worker 0 keeps ISEED.
+  // Counter-based randoms are keyed on global event index, so keep
+  // ISEED to get the same events regardless of NTHREAD.
+  if ( !GENRAN_INFO.USE_COUNTER ) 
+    { INPUTS.ISEED += (unsigned int)(ithread * 7919) ; }
+  init_random_seed(INPUTS.ISEED, INPUTS.NSTREAM_RAN);
+
+  SIMLIB_reopen_simThread();
+
+  printf("\t %s ithread=%d : ilc=%d to %d  VERSION=%s  ISEED=%u\n",
+	 fnam, ithread, ILC_MIN, ILC_MAX, INPUTS.GENVERSION, INPUTS.ISEED);
+  fflush(stdout);
+
+  return ;
+
+} // end prep_simThread
+
+// ==================================
+void SIMLIB_reopen_simThread(void) {
+
+  // Created Oct 2026
+  // Worker process re-opens SIMLIB so that the file offset is not
+  // shared with other workers, skips the global header (already
+  // parsed by parent), and then moves to the worker start using
+  // the JOBID/NJOBTOT logic in SIMLIB_findStart.
+
+  int  gzipFlag ;
+  char c_get[200];
+  char fnam[] = "SIMLIB_reopen_simThread" ;
+
+  // ------------ BEGIN -------------
+
+  fp_SIMLIB = open_TEXTgz(INPUTS.SIMLIB_OPENFILE, "rt", 1, &gzipFlag, fnam);
+  INPUTS.SIMLIB_GZIPFLAG = gzipFlag ;
+
+  while( (fscanf(fp_SIMLIB, "%s", c_get)) != EOF) 
+    { if ( strcmp(c_get,"BEGIN") == 0 ) { break; } }
+
+  SIMLIB_HEADER.LIBID = 0 ;
+  SIMLIB_HEADER.NWRAP = 0 ;
+  SIMLIB_findStart();
+
+  return ;
+
+} // end SIMLIB_reopen_simThread
+
+// ==================================
+void merge_simThreads(void) {
+
+  // Created Oct 2026
+  // Parent process merges worker versions [GENVERSION]_THREADnn into
+  // GENVERSION: data files are moved (names are unique because each 
+  // worker has a unique GENPREFIX), LIST and DUMP files are concatenated
+  // in worker order (= global event order), and README summary stats
+  // are merged (see merge_simThreads_README).
+  // Abort if a system call fails.
+
+  int  NTHREAD = SIMTHREAD_INFO.NTHREAD ;
+  char *VERSION = SIMTHREAD_INFO.GENVERSION_PARENT ;
+  char *PATH    = SIMTHREAD_INFO.PATH_SNDATA_SIM_PARENT ;
+  int  ithread ;
+  FILE *FP_LIST, *FP_DUMP=NULL, *fp ;
+  char PATH_THREAD[MXPATHLEN], VERSION_THREAD[MXPATHLEN], PATH_BASE[MXPATHLEN];
+  char fileName[2*MXPATHLEN], LINE[MXPATHLEN*4], cmd[4*MXPATHLEN];
+  char *ptr;
+  char fnam[] = "merge_simThreads" ;
+
+  // ------------ BEGIN -------------
+
+  print_banner(fnam);
+
+  sprintf(PATH_BASE, "%s", PATH);
+  ptr = strrchr(PATH_BASE,'/');   if ( ptr != NULL ) { *ptr = 0; }
+
+  sprintf(PATH_SNDATA_SIM, "%s", PATH);
+  clr_VERSION(VERSION, 0);
+  if ( mkdir(PATH, S_IRWXU | S_IRWXG ) != 0 ) {
+    sprintf(c1err,"Cannot create merged version directory");
+    sprintf(c2err,"%s", PATH);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  sprintf(fileName, "%s/%s.LIST", PATH, VERSION);
+  if ( (FP_LIST = fopen(fileName, "wt")) == NULL ) 
+    { abort_merge_simThreads(fileName, "LIST", fnam); }
+
+  merge_simThreads_README();
+
+  for(ithread=0; ithread < NTHREAD; ithread++ ) {
+
+    sprintf(VERSION_THREAD, "%s_%s%2.2d", 
+	    VERSION, SUFFIX_SIMTHREAD, ithread);
+    sprintf(PATH_THREAD, "%s/%s", PATH_BASE, VERSION_THREAD);
+
+    // append LIST
+    sprintf(fileName, "%s/%s.LIST", PATH_THREAD, VERSION_THREAD);
+    if ( (fp = fopen(fileName,"rt")) != NULL ) {
+      while ( fgets(LINE, sizeof(LINE), fp) != NULL ) 
+	{ fprintf(FP_LIST, "%s", LINE); }
+      fclose(fp); remove(fileName);
+    }
+
+    // append optional SIMGEN DUMP; keep comments & header from 1st worker
+    sprintf(fileName, "%s/%s.DUMP", PATH_THREAD, VERSION_THREAD);
+    if ( (fp = fopen(fileName,"rt")) != NULL ) {
+      if ( FP_DUMP == NULL ) {
+	sprintf(cmd, "%s/%s.DUMP", PATH, VERSION);
+	if ( (FP_DUMP = fopen(cmd, "wt")) == NULL ) 
+	  { abort_merge_simThreads(cmd, "DUMP", fnam); }
+      }
+      while ( fgets(LINE, sizeof(LINE), fp) != NULL ) {
+	if ( ithread > 0 && strncmp(LINE,"SN:",3) != 0 ) { continue; }
+	fprintf(FP_DUMP, "%s", LINE); 
+      }
+      fclose(fp); remove(fileName);
+    }
+
+    // worker README & YAML are already merged; remove them so that
+    // they are not moved next to (or over) the merged files.
+    sprintf(fileName, "%s/%s.README", PATH_THREAD, VERSION_THREAD);
+    remove(fileName);
+    sprintf(fileName, "%s/%s.YAML", PATH_THREAD, VERSION_THREAD);
+    remove(fileName);
+
+    // move everything else (data files & aux files with unique names);
+    // skip mv for empty dir so that mv status is meaningful.
+    sprintf(cmd, "if [ -n \"$(ls -A %s)\" ]; then mv %s/* %s/ ; fi", 
+	    PATH_THREAD, PATH_THREAD, PATH );
+    if ( system(cmd) != 0 ) {
+      sprintf(c1err,"Failed to move worker files from");
+      sprintf(c2err,"%s", PATH_THREAD);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+    }
+    if ( rmdir(PATH_THREAD) != 0 ) {
+      sprintf(c1err,"Failed to remove worker directory");
+      sprintf(c2err,"%s", PATH_THREAD);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+    }
+    printf("\t merged %s \n", VERSION_THREAD); fflush(stdout);
+  }
+
+  fclose(FP_LIST);
+  if ( FP_DUMP != NULL ) { fclose(FP_DUMP); }
+
+  if ( INPUTS.WRFLAG_YAML_FILE > 0 ) { merge_simThreads_YAML(); }
+
+  return ;
+
+} // end merge_simThreads
+
+// ==================================
+void merge_simThreads_YAML(void) {
+
+  // Created Oct 2026
+  // Sum integer stats from each worker YAML summary and write
+  // [GENVERSION].YAML for submit_batch_jobs.
+
+  int  NTHREAD = SIMTHREAD_INFO.NTHREAD ;
+  char *VERSION = SIMTHREAD_INFO.GENVERSION_PARENT ;
+  int  ithread, ival, istage, nrd ;
+  int  SUM_NGENEV=0, SUM_NGENLC=0, SUM_NWRITE=0, SUM_NSPEC=0 ;
+  double SUM_TSTAGE[NSTAGE_TIMER];
+  long long int SUM_NSTAGE[NSTAGE_TIMER], lval ;
+  char key_time[NSTAGE_TIMER][60], key_ncall[NSTAGE_TIMER][60];
+  double CPU_MAX = 0.0, dval ;
+  FILE *fp ;
+  char fileName[MXPATHLEN], key[100], SURVEY[60], IDSURVEY[20];
+  char fnam[] = "merge_simThreads_YAML" ;
+
+  // ------------ BEGIN -------------
+
+  SURVEY[0] = IDSURVEY[0] = 0 ;
+
+  for(istage=0; istage < NSTAGE_TIMER; istage++ ) {
+    SUM_TSTAGE[istage] = 0.0;  SUM_NSTAGE[istage] = 0 ;
+    sprintf(key_time[istage], "TIME_STAGE_%s:",  STAGE_TIMERS.NAME[istage]);
+    sprintf(key_ncall[istage],"NCALL_STAGE_%s:", STAGE_TIMERS.NAME[istage]);
+  }
+
+  for(ithread=0; ithread < NTHREAD; ithread++ ) {
+    sprintf(fileName, "%s_%s%2.2d.YAML", VERSION, SUFFIX_SIMTHREAD, ithread);
+    if ( (fp = fopen(fileName,"rt")) == NULL ) {
+      sprintf(c1err,"Cannot open worker YAML file");
+      sprintf(c2err,"%s", fileName);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+    }
+    while ( fscanf(fp, "%s", key) != EOF ) {
+      nrd = 1 ;
+      if ( strcmp(key,"SURVEY:") == 0 ) 
+	{ nrd = fscanf(fp, "%s", SURVEY); }
+      else if ( strcmp(key,"IDSURVEY:") == 0 ) 
+	{ nrd = fscanf(fp, "%s", IDSURVEY); }
+      else if ( strcmp(key,"NGENEV_TOT:") == 0 ) 
+	{ nrd = fscanf(fp, "%d", &ival); SUM_NGENEV += ival; }
+      else if ( strcmp(key,"NGENLC_TOT:") == 0 ) 
+	{ nrd = fscanf(fp, "%d", &ival); SUM_NGENLC += ival; }
+      else if ( strcmp(key,"NGENLC_WRITE:") == 0 ) 
+	{ nrd = fscanf(fp, "%d", &ival); SUM_NWRITE += ival; }
+      else if ( strcmp(key,"NGENSPEC_WRITE:") == 0 ) 
+	{ nrd = fscanf(fp, "%d", &ival); SUM_NSPEC += ival; }
+      else if ( strcmp(key,"CPU_MINUTES:") == 0 ) 
+	{ nrd = fscanf(fp, "%le", &dval); if (dval>CPU_MAX) {CPU_MAX=dval;} }
+      else if ( strncmp(key,"TIME_STAGE_",11) == 0 ||
+		strncmp(key,"NCALL_STAGE_",12) == 0 ) {
+	for(istage=0; istage < NSTAGE_TIMER; istage++ ) {
+	  if ( strcmp(key,key_time[istage]) == 0 ) 
+	    { nrd = fscanf(fp,"%le", &dval); SUM_TSTAGE[istage] += dval; }
+	  if ( strcmp(key,key_ncall[istage]) == 0 ) 
+	    { nrd = fscanf(fp,"%lld", &lval); SUM_NSTAGE[istage] += lval; }
+	}
+      }
+      if ( nrd != 1 ) { abort_merge_simThreads(fileName, key, fnam); }
+    }
+    fclose(fp);  remove(fileName);
+  }
+
+  sprintf(fileName, "%s.YAML", VERSION);
+  if ( (fp = fopen(fileName, "wt")) == NULL ) 
+    { abort_merge_simThreads(fileName, "YAML", fnam); }
+  fprintf(fp, "SURVEY:          %s\n",    SURVEY     );
+  fprintf(fp, "IDSURVEY:        %s\n",    IDSURVEY   );
+  fprintf(fp, "NGENEV_TOT:      %d\n",    SUM_NGENEV );
+  fprintf(fp, "NGENLC_TOT:      %d\n",    SUM_NGENLC );
+  fprintf(fp, "NGENLC_WRITE:    %d\n",    SUM_NWRITE );
+  fprintf(fp, "NGENSPEC_WRITE:  %d\n",    SUM_NSPEC  );
+  fprintf(fp, "CPU_MINUTES:     %.2f\n",  CPU_MAX    );
+  fprintf(fp, "NTHREAD:         %d\n",    NTHREAD    );
+  fprintf(fp, "GENMODEL_NAME:   %s\n",    INPUTS.MODELNAME );
+  for(istage=0; istage < NSTAGE_TIMER; istage++ ) {
+    fprintf(fp, "%s  %.3f   # sec, sum over workers\n", 
+	    key_time[istage], SUM_TSTAGE[istage] );
+    fprintf(fp, "%s %lld\n", key_ncall[istage], SUM_NSTAGE[istage] );
+  }
+  fprintf(fp, "%s:   %d\n",    YAMLKEY_ABORT_IF_ZERO, SUM_NWRITE );
+  fclose(fp);
+
+  return ;
+
+} // end merge_simThreads_YAML
+
+// ==================================
+void merge_simThreads_README(void) {
+
+  // Created Oct 2026
+  // Write [GENVERSION].README from the first worker README, with the
+  // output-summary stats merged over workers: event counters and the
+  // NACCEPT & NREJECT lists are summed, CPU_MINUTES is the max, and
+  // EFF, NACC_PER_SEASON and rates are re-computed from the sums.
+  // GENVERSION is the merged version; other lines (inputs, RANDOM_SYNC,
+  // sub-survey & host-match stats) are copied from the first worker.
+
+#define NKEY_README_SUM 8
+  int  NTHREAD = SIMTHREAD_INFO.NTHREAD ;
+  char *VERSION = SIMTHREAD_INFO.GENVERSION_PARENT ;
+  char *PATH    = SIMTHREAD_INFO.PATH_SNDATA_SIM_PARENT ;
+  char KEYLIST_SUM[NKEY_README_SUM][24] = {
+    "NGENEV_TOT:", "NGENLC_TOT:", "NGENLC_WRITE:", "NGENSPEC_WRITE:",
+    "NGENLC_LENS_TOT:", "NREJECT_CRAZYFLUX:", "NREJECT_PRESCREEN:",
+    "NWRONGHOST_WRITE:" 
+  } ;
+  // keys 4-7 are written only if non-zero
+  long long SUM[NKEY_README_SUM], lval ;
+  bool  FOUND0[NKEY_README_SUM] ;
+  int   NACCEPT[3] = { 0, 0, 0 }, NREJECT[4] = { 0, 0, 0, 0 };
+  int   ival[4], ithread, k, nrd, nrd_expect, NPAD ;
+  double CPU_MAX = 0.0, NGEN_PER_SEASON = 0.0, dval, t_gen ;
+  double XN0, XN1, EFF = 0.0, EFF_ERR = 1.0, NACC, NACCERR = 0.0 ;
+  double R[3] = { 0.0, 0.0, 0.0 } ;
+  FILE *fp, *FP_OUT ;
+  char PATH_BASE[MXPATHLEN], VERSION_THREAD[MXPATHLEN];
+  char fileName[3*MXPATHLEN], LINE[4*MXPATHLEN], key[100], pad[40];
+  char *ptr ;
+  char fnam[] = "merge_simThreads_README" ;
+
+  // ------------ BEGIN -------------
+
+  for(k=0; k < NKEY_README_SUM; k++ ) { SUM[k] = 0;  FOUND0[k] = false; }
+
+  sprintf(PATH_BASE, "%s", PATH);
+  ptr = strrchr(PATH_BASE,'/');   if ( ptr != NULL ) { *ptr = 0; }
+
+  // - - - - - - 
+  // sum stats from each worker README
+  for(ithread=0; ithread < NTHREAD; ithread++ ) {
+    sprintf(VERSION_THREAD, "%s_%s%2.2d", 
+	    VERSION, SUFFIX_SIMTHREAD, ithread);
+    sprintf(fileName, "%s/%s/%s.README", 
+	    PATH_BASE, VERSION_THREAD, VERSION_THREAD);
+    if ( (fp = fopen(fileName,"rt")) == NULL ) 
+      { abort_merge_simThreads(fileName, "README", fnam); }
+
+    while ( fgets(LINE, sizeof(LINE), fp) != NULL ) {
+      if ( sscanf(LINE, "%99s", key) != 1 ) { continue; }
+      nrd = nrd_expect = 1 ;
+      if ( strcmp(key,"CPU_MINUTES:") == 0 ) {
+	nrd = sscanf(LINE, "%*s %le", &dval);
+	if ( dval > CPU_MAX ) { CPU_MAX = dval; }
+      }
+      else if ( strcmp(key,"NGEN_PER_SEASON:") == 0 ) {
+	nrd = sscanf(LINE, "%*s %le", &dval);
+	if ( ithread == 0 ) { NGEN_PER_SEASON = dval; }
+      }
+      else if ( strcmp(key,"NACCEPT:") == 0 ) {
+	nrd_expect = 3 ;
+	nrd = sscanf(LINE, " NACCEPT: [ %d , %d , %d ]", 
+		     &ival[0], &ival[1], &ival[2] );
+	for(k=0; k < nrd; k++ ) { NACCEPT[k] += ival[k]; }
+      }
+      else if ( strcmp(key,"NREJECT:") == 0 ) {
+	nrd_expect = 4 ;
+	nrd = sscanf(LINE, " NREJECT: [ %d , %d , %d , %d ]", 
+		     &ival[0], &ival[1], &ival[2], &ival[3] );
+	for(k=0; k < nrd; k++ ) { NREJECT[k] += ival[k]; }
+      }
+      else {
+	for(k=0; k < NKEY_README_SUM; k++ ) {
+	  if ( strcmp(key,KEYLIST_SUM[k]) != 0 ) { continue; }
+	  nrd = sscanf(LINE, "%*s %lld", &lval);
+	  SUM[k] += lval ;
+	  if ( ithread == 0 ) { FOUND0[k] = true; }
+	}
+      }
+      if ( nrd != nrd_expect ) { abort_merge_simThreads(fileName, key, fnam); }
+    }
+    fclose(fp);
+  }
+
+  // - - - - - - 
+  // efficiency as in geneff_calc, and rates vs. max worker time
+  XN0 = (double)SUM[1] ;  XN1 = (double)SUM[2] ;
+  if ( XN0 > 0.0 ) {
+    EFF     = XN1 / XN0 ;
+    EFF_ERR = sqrt( XN1 * (XN0-XN1) / (XN0*XN0*XN0) );
+    if ( EFF_ERR == 0.0 ) { EFF_ERR = 1.0 / XN0 ; }
+  }
+
+  NACC = NGEN_PER_SEASON * EFF ;
+  if ( XN1 > 0.0 ) { NACCERR = NACC/sqrt(XN1); }
+
+  t_gen = 60.0 * CPU_MAX ;
+  if ( t_gen > 0.0 ) 
+    { for(k=0; k < 3; k++ ) { R[k] = (double)SUM[k] / t_gen; } }
+
+  // - - - - - - 
+  // write merged README using first worker README as template
+  sprintf(VERSION_THREAD, "%s_%s%2.2d", VERSION, SUFFIX_SIMTHREAD, 0);
+  sprintf(fileName, "%s/%s/%s.README", 
+	  PATH_BASE, VERSION_THREAD, VERSION_THREAD);
+  if ( (fp = fopen(fileName,"rt")) == NULL ) 
+    { abort_merge_simThreads(fileName, "README", fnam); }
+
+  sprintf(LINE, "%s/%s.README", PATH, VERSION);
+  if ( (FP_OUT = fopen(LINE,"wt")) == NULL ) 
+    { abort_merge_simThreads(LINE, "README", fnam); }
+
+  while ( fgets(LINE, sizeof(LINE), fp) != NULL ) {
+    key[0] = 0 ;
+    sscanf(LINE, "%99s", key);
+    NPAD = strspn(LINE," ");  if ( NPAD > 30 ) { NPAD = 30; }
+    sprintf(pad, "%.*s", NPAD, LINE);
+
+    if ( strcmp(key,"GENVERSION:") == 0 ) 
+      { fprintf(FP_OUT,"%s%-24s %s\n", pad, key, VERSION); }
+    else if ( strcmp(key,"CPU_MINUTES:") == 0 ) 
+      { fprintf(FP_OUT,"%sCPU_MINUTES:       %.2f  \n", pad, CPU_MAX); }
+    else if ( strcmp(key,KEYLIST_SUM[0]) == 0 ) {
+      fprintf(FP_OUT,"%sNGENEV_TOT:        %lld    "
+	      "# (%.f/sec, total events)\n", pad, SUM[0], R[0] );
+    }
+    else if ( strcmp(key,KEYLIST_SUM[1]) == 0 ) {
+      fprintf(FP_OUT,"%sNGENLC_TOT:        %lld    "
+	      "# (%.f/sec, total LC)\n", pad, SUM[1], R[1] );
+    }
+    else if ( strcmp(key,KEYLIST_SUM[2]) == 0 ) {
+      fprintf(FP_OUT,"%sNGENLC_WRITE:      %lld    "
+	      "# (%.f/sec, LC passing trigger)\n", pad, SUM[2], R[2] );
+    }
+    else if ( strcmp(key,KEYLIST_SUM[3]) == 0 ) 
+      { fprintf(FP_OUT,"%sNGENSPEC_WRITE:    %lld  \n", pad, SUM[3] ); }
+    else if ( strcmp(key,KEYLIST_SUM[4]) == 0 ) 
+      { fprintf(FP_OUT,"%sNGENLC_LENS_TOT:  %lld  \n", pad, SUM[4] ); }
+    else if ( strcmp(key,"EFF(SEARCH+CUTS):") == 0 ) {
+      fprintf(FP_OUT,"%sEFF(SEARCH+CUTS): %7.4f +- %7.4f\n", 
+	      pad, EFF, EFF_ERR );
+    }
+    else if ( strcmp(key,"NACCEPT:") == 0 ) {
+      fprintf(FP_OUT,"%sNACCEPT:  [ %d, %d, %d ]   "
+	      "# NSN(ACCEPT) for [ SpecID, noSpecID, zHOST]\n", 
+	      pad, NACCEPT[0], NACCEPT[1], NACCEPT[2] );
+    }
+    else if ( strcmp(key,"NACC_PER_SEASON:") == 0 ) {
+      fprintf(FP_OUT,"%sNACC_PER_SEASON:   %.0f +_ %.0f  "
+	      "# NSN(ACCEPT) per season  after trigger+cuts\n", 
+	      pad, NACC, NACCERR );
+    }
+    else if ( strcmp(key,"NREJECT:") == 0 ) {
+      ptr = strchr(LINE,']');  ptr = ( ptr != NULL ) ? ptr+1 : "\n" ;
+      fprintf(FP_OUT,"%sNREJECT:  [%d,   %d, %d, %d]%s", pad,
+	      NREJECT[0], NREJECT[1], NREJECT[2], NREJECT[3], ptr );
+      // optional counters that are zero for first worker
+      for(k=4; k < NKEY_README_SUM; k++ ) {
+	if ( FOUND0[k] || SUM[k] == 0 ) { continue; }
+	fprintf(FP_OUT,"%s%s  %lld \n", pad, KEYLIST_SUM[k], SUM[k] );
+      }
+    }
+    else if ( strcmp(key,KEYLIST_SUM[5]) == 0 ) 
+      { fprintf(FP_OUT,"%sNREJECT_CRAZYFLUX:  %lld \n", pad, SUM[5] ); }
+    else if ( strcmp(key,KEYLIST_SUM[6]) == 0 ) {
+      fprintf(FP_OUT,"%sNREJECT_PRESCREEN:  %lld   "
+	      "# SNRMAX upper bound before LC gen\n", pad, SUM[6] );
+    }
+    else if ( strcmp(key,KEYLIST_SUM[7]) == 0 ) {
+      dval = ( XN1 > 0.0 ) ? (double)SUM[7]/XN1 : 0.0 ;
+      fprintf(FP_OUT,"%sNWRONGHOST_WRITE:   %lld    # frac = %.4f\n", 
+	      pad, SUM[7], dval );
+    }
+    else
+      { fputs(LINE, FP_OUT); }
+  }
+
+  fclose(fp);  fclose(FP_OUT);
+
+  return ;
+
+} // end merge_simThreads_README
+
+// ==================================
+void abort_merge_simThreads(char *fileName, char *key, char *callFun) {
+
+  // Created Oct 2026
+  // Abort when a worker or merged file cannot be opened, 
+  // or when value(s) for key cannot be read.
+
+  char fnam[] = "abort_merge_simThreads" ;
+
+  sprintf(c1err,"%s: cannot open file or read value for key='%s'", 
+	  callFun, key);
+  sprintf(c2err,"%s", fileName);
+  errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+
+} // end abort_merge_simThreads
+
 // ===========================
 void set_screen_update(int NGEN) {
 
@@ -32082,9 +35125,13 @@ void MJDGAP(int NLIST, double *MJDLIST, double MJDGAP_IGNORE,
   // May 20 2017: INDEX_SORT[1000] -> INDEX_SORT[MXREAD_SIMLIB],
   //
   // Jan 25 2018: INDEX_SORT[MXREAD_SIMLIB] -> INDEX_SORT[MXOBS_SIMLIB]
+  //
+  // Oct 15 2026: skip sort if MJDLIST is already sorted (usual case for
+  //              SIMLIB), so that SIMLIB_DUMP cost is linear in NOBS.
 
   double  MJD, MJDLAST, GAP, GAPSUM ;
   int     INDEX_SORT[MXOBS_SIMLIB], ORDER_SORT, i, isort, NGAP ;
+  bool    IS_SORTED = true ;
 
   // --------------- BEGIN ---------
 
@@ -32092,10 +35139,18 @@ void MJDGAP(int NLIST, double *MJDLIST, double MJDGAP_IGNORE,
   *GAPMAX = 0.0;
   if ( NLIST <= 1 ) return ;
 
-  // first sort the MJDs to be chronological
+  // first sort the MJDs to be chronological (unless already sorted)
 
-  ORDER_SORT = +1 ; // increasing
-  sortDouble(NLIST, MJDLIST, ORDER_SORT, INDEX_SORT );
+  for ( i=1; i < NLIST; i++ ) 
+    { if ( MJDLIST[i] < MJDLIST[i-1] ) { IS_SORTED = false; break; } }
+
+  if ( IS_SORTED ) {
+    for ( i=0; i < NLIST; i++ ) { INDEX_SORT[i] = i; }
+  }
+  else {
+    ORDER_SORT = +1 ; // increasing
+    sortDouble(NLIST, MJDLIST, ORDER_SORT, INDEX_SORT );
+  }
 
 
   // note that we start at 2nd MJD on list
@@ -32143,13 +35198,17 @@ double SIMLIB_angsep_min(int NSTORE, double RA, double DEC,
   // OBSOLETE (Aug 2017) ??
   // return min angular separation (degrees) between RA,DEC and the
   // passed array of NSTORE RA,DEC values.
+  //
+  // Oct 15 2026: skip stored entries whose DEC difference exceeds the
+  //   current min separation (ANGSEP >= |DEC-DEC_TMP|), so that trig 
+  //   and acos are evaluated only for nearby candidates.
 
   int i;
 
   double     
      RA_TMP, DEC_TMP
     ,RA_RAD, DEC_RAD
-    ,ANGSEP, ANGSEP_MIN 
+    ,ANGSEP, ANGSEP_MIN, ANGSEP_MIN_DEG
     ,DOTPROD
     ,X, X_TMP
     ,Y, Y_TMP
@@ -32168,12 +35227,16 @@ double SIMLIB_angsep_min(int NSTORE, double RA, double DEC,
   Z = sin(DEC*RADIAN);
 
 
-  ANGSEP_MIN = 99999. ;
+  ANGSEP_MIN     = 99999. ;
+  ANGSEP_MIN_DEG = 99999. ;
 
   for ( i = 0; i < NSTORE; i++ ) {
     RA_TMP   = *(RA_STORE+i);     // phi
     DEC_TMP  = *(DEC_STORE+i);   // theta
 
+    // cannot be closer than DEC difference
+    if ( fabs(DEC - DEC_TMP) >= ANGSEP_MIN_DEG ) { continue; }
+
     RA_RAD   = RADIAN * RA_TMP ;
     DEC_RAD  = RADIAN * DEC_TMP ; 
     X_TMP = cos(RA_RAD) * cos(DEC_RAD);
@@ -32191,7 +35254,7 @@ double SIMLIB_angsep_min(int NSTORE, double RA, double DEC,
 
     ANGSEP  = acos(DOTPROD) ;
     if ( ANGSEP < ANGSEP_MIN )
-      {  ANGSEP_MIN = ANGSEP ; }
+      {  ANGSEP_MIN = ANGSEP ; ANGSEP_MIN_DEG = ANGSEP/RADIAN ; }
   }
 
   // return min angular sep in degrees.
@@ -32622,6 +35685,7 @@ void print_sim_help(void) {
     "",
     "# - - - - - -  CUTWIN - - - - - ",
     "APPLY_CUTWIN_OPT: 1   # apply cuts; see EPCUTWIN_ & CUTWIN_ in snana manual",
+    "PRESCREEN_CUTWIN_SNRMAX: 0.5  # reject hopeless SNRMAX before LC gen; arg=dmag margin",
     "",
     "#  One-row per accepted-SN dump to <GENVERSION>.DUMP",
     "#  If any var name is not valid, sim aborts and prints list of valid DUMP variables",
@@ -36,6 +36,12 @@
  Jan 28 2022: MXEPSIM -> 15k (was 10k)
  Aug 02 2024: MXSEASON_SIMLIB -> 30 (was 20) to handle LSST cadence artifact
  Sep 21 2024: MXCID_SIM = 300 million -> 500 million for DES-SN5YR reanalysis
+ Oct 14 2026: add SIMTHREAD_INFO for NTHREAD worker option
+ Oct 15 2026: add INPUTS.HOSTLIB_NTHREAD
+ Oct 15 2026: SIMLIB_OBS_DEF [obs] arrays are malloc'ed to actual NOBS
+ Oct 15 2026: add SIMTHREAD_INFO.IRANK,NRANK for USE_MPI build
+ Oct 15 2026: add SIMSTREAM for in-memory event stream (snlc_sim_stream.h)
+ Oct 15 2026: add INPUTS.GENMODEL_SEDCACHE[_MXMB,_DIR] for PySEDMODEL
 
 ********************************************/
 
@@ -58,6 +64,10 @@
 #define  MXGROUPID_SIMLIB 60      // max number of groupIDs per LIBID entry
 
 #define  MXSIMGEN_DUMP 600    // max number of variables to dump
+#define  FORMAT_SIMGEN_DUMP_TEXT   0  // text .DUMP file (default)
+#define  FORMAT_SIMGEN_DUMP_BIN    1  // columnar SNBIN table (Oct 2026)
+#define  FORMAT_SIMGEN_DUMP_BINZ   2  // compressed SNBIN table
+#define  IDTABLE_SIMGEN_DUMP     7700 // SNTABLE id for binary SIMGEN_DUMP
 #define  TABLEID_DUMP  7100   // for SNTABLE functions
 
 #define  SIMGEN_DUMP_NOISE_NEARPEAK 1
@@ -65,6 +75,7 @@
 
 #define  MXREAD_SIMLIB 150000  // max number of SIMLIB observations/entries
 #define  MXOBS_SIMLIB  MXEPOCH    // max number of observ. per simlib
+#define  MXOBS_SIMLIB_INIT  2000  // initial malloc size; grows to MXOBS_SIMLIB
 #define  MXOBS_SPECTROGRAPH 50 // max number of spectra per event
 
 #define  MXGENSKIP_PEAKMJD_SIMLIB  10
@@ -115,11 +126,28 @@
 #define FORMAT_MASK_MODEL        4   // dump obs model mag vs. Tobs
 #define FORMAT_MASK_BLINDTEST    8   // suppress SIM_XXX and other info
 #define FORMAT_MASK_CIDRAN      16   // use random CID (1-MXCID)
+
+// Oct 2026: optional random CID computed on demand from keyed Feistel
+// permutation of CID range (no list, no init time) with sim-input
+// key CIDRAN_METHOD: 0. Default is still the random list method.
+#define CIDRAN_METHOD_PERM  0   // opt-in: keyed permutation 
+#define CIDRAN_METHOD_LIST  1   // default: random list with unique CIDs
+#define NROUND_CIDRAN_PERM  4   // number of Feistel rounds
+struct {
+  unsigned int NCID ;       // number of valid CIDs (domain of permutation)
+  int          NBIT_HALF ;  // number of bits in each Feistel half
+  unsigned int MASK_HALF ;
+  unsigned long long KEY[NROUND_CIDRAN_PERM] ;
+  int          NSKIP ;                 // number of valid CIDs to skip
+  int          SKIPLIST[MXZRAN] ;      // sorted CIDRAN_SKIPLIST
+} CIDRAN_PERM ;
 #define FORMAT_MASK_FITS        32   // write to fits file instead of ascii
 #define FORMAT_MASK_COMPACT     64   // suppress non-essential PHOT output
 #define FORMAT_MASK_ATMOS      128  // write RA,DEC,AIRMASS per obs, for atmos corr
 #define FORMAT_MASK_FILTERS    256  // write filterTrans files (Aug 2016)
 #define FORMAT_MASK_noSPEC  2048  // suppress SPEC.FITS data; keep VERSION.SPEC dump file
+#define FORMAT_MASK_PACK    4096  // FITS: pack PHOT,SPEC into HEAD file (Oct 2026)
+#define FORMAT_MASK_PHOT_REDUCED 8192 // FITS: scaled int16 PHOT columns (Oct 2026)
 
 #define FLAG_NWD_ZERO 100 // flag that override word is a key with no arg
 
@@ -141,6 +169,7 @@ int WRFLAG_FILTERS   ;
 int WRFLAG_ATMOS    ; // May 2023
 int WRFLAG_COMPACT   ; // Jan 2018
 int WRFLAG_noSPEC ;    // Apr 2024
+int WRFLAG_PACK ;      // Oct 2026
 
 #define SIMLIB_PSF_PIXEL_SIGMA   "PIXEL_SIGMA"        // default
 #define SIMLIB_PSF_ARCSEC_FWHM   "ARCSEC_FWHM"        // option
@@ -159,6 +188,8 @@ int WRFLAG_noSPEC ;    // Apr 2024
 #define SIMLIB_MSKOPT_ENTIRE_SEASON          128 // keep entire SIMLIB season
 #define SIMLIB_MSKOPT_ENTIRE_SURVEY          256 // keep entire SIMLIB survey
 #define SIMLIB_MSKOPT_IDEAL_GRID             512 // allows shorter simlib; see manual
+#define SIMLIB_MSKOPT_INDEX_LIBID           1024 // index LIBID offsets for fast start
+#define SIMLIB_MSKOPT_CACHE_LIBID           2048 // cache parsed cadence per LIBID
 
 #define METHOD_TYPE_SPEC 1    // spec id
 #define METHOD_TYPE_PHOT 2    // phot id
@@ -171,6 +202,61 @@ struct {
   int    NGENTOT_LAST ;
 } TIMERS ;
 
+// Oct 2026: cumulative wall-time and call count per pipeline stage,
+// reported at end of job and in YAML summary.
+#define ISTAGE_TIMER_HOST      0  // GEN_SNHOST_DRIVER
+#define ISTAGE_TIMER_GENMAG    1  // GENMAG_DRIVER
+#define ISTAGE_TIMER_GENMODEL  2  // genmodel calls inside GENMAG_DRIVER
+#define ISTAGE_TIMER_GENSPEC   3  // GENSPEC_DRIVER
+#define ISTAGE_TIMER_GENFLUX   4  // GENFLUX_DRIVER
+#define ISTAGE_TIMER_TRIGGER   5  // trigger & search-eff
+#define ISTAGE_TIMER_OUTPUT    6  // update_simFiles
+#define NSTAGE_TIMER           7
+
+struct {
+  char   NAME[NSTAGE_TIMER][40];
+  double T_START[NSTAGE_TIMER] ; // wall time at start of current call
+  double T_SUM[NSTAGE_TIMER] ;   // cumulative seconds
+  long long int NCALL[NSTAGE_TIMER] ;
+} STAGE_TIMERS ;
+
+// Oct 2026: live status for workflow managers; see update_SIMGEN_STATUS
+#define OPT_STATUS_INIT   1
+#define OPT_STATUS_UPDATE 2
+#define OPT_STATUS_END    3
+struct {
+  double T_START, T_LAST ;  // wall time at init and at last status write
+  int    NGENLC_LAST ;      // NGENLC_TOT at last write (for recent rate)
+  int    NUPDATE ;          // number of status-file writes
+} SIMGEN_STATUS ;
+
+// Oct 2026: NTHREAD option forks worker processes after the full init;
+// each worker generates a contiguous range of the global event index.
+#define MXTHREAD_SIM     64
+#define SUFFIX_SIMTHREAD "THREAD"  // worker version = [GENVERSION]_THREADnn
+struct {
+  int   NTHREAD ;          // number of workers (1 => legacy serial loop)
+  int   ITHREAD ;          // worker index 0 to NTHREAD-1; -1 for parent
+  int   ILC_MIN, ILC_MAX ; // range of global ilc for this worker
+  int   IRANK, NRANK ;     // MPI rank & size (NRANK=1 w/o USE_MPI)
+  pid_t PID[MXTHREAD_SIM];
+  char  GENVERSION_PARENT[MXPATHLEN];
+  char  PATH_SNDATA_SIM_PARENT[MXPATHLEN];
+} SIMTHREAD_INFO ;
+
+// Oct 2026: in-memory event stream; see snlc_sim_stream.h
+#include "snlc_sim_stream.h"
+#define ISTAT_GENEVENT_DONE   0  // event processed (accept or reject)
+#define ISTAT_GENEVENT_SKIP   1  // negative LIBID
+#define ISTAT_GENEVENT_STOP   2  // stop generating
+struct {
+  bool  USE ;         // true => load batches instead of writing files
+  bool  DONE ;        // true => no more events
+  bool  PENDING ;     // accepted event in SNDATA did not fit in last batch
+  int   ILC ;         // next global event index
+  SIMSTREAM_BATCH_DEF *BATCH ; // current batch from caller
+} SIMSTREAM ;
+
 
 // define auxillary files produced with data files.
 typedef struct { // SIMFILE_AUX_DEF
@@ -190,6 +276,7 @@ typedef struct { // SIMFILE_AUX_DEF
   FILE *FP_DUMP_TRAINSALT;  char  DUMP_TRAINSALT[MXPATHLEN] ;  
   FILE *FP_DUMP_MWCL;   char  DUMP_MWCL[MXPATHLEN] ;  
   FILE *FP_YAML;        char  YAML[MXPATHLEN] ;  // Aug 10 2020, for submit_batch
+  char  STATUS[MXPATHLEN] ;  // Oct 2026: live status file (STATUS_UPDATE_SEC)
   char PATH_FILTERS[MXPATHLEN]; // directory instead of file
 
   // optional outputs (just filename, not pointer)
@@ -322,6 +409,12 @@ typedef struct {  // RATEPAR_DEF
   // max redshift wgt for generation in genz_hubble()
   double  ZGENWGT_MAX, ZGENMIN_STORE, ZGENMAX_STORE ;
 
+  // Oct 2026: inverse-CDF of dN/dz for genz_hubble (DNDZ_ICDF: 1)
+  int     NZ_ICDF ;        // number of z nodes (0 -> not built)
+  double  ZMIN_ICDF, DZ_ICDF ;
+  double *CDF_ICDF ;       // cumulative dN/dz at each z node
+  int    *GUIDE_ICDF ;     // first node with CDF >= k/NZ_ICDF (x total)
+
   // predicted SN count
   double SEASON_COUNT ;     // nominal SN count per season
   double SEASON_FRAC ;      // fracion among RATEPARs (SN,PEC1A)
@@ -454,6 +547,23 @@ typedef struct {
   double RHO_EVT, RHO_SUM, RHO_AVG ;
 } MONITOR_REDCOV_FLUXNOISE_DEF ;
 
+// Oct 2026: SoA batch of epochs for the common-path flux noise
+//   (diagonal noise only, no template/host-phot noise) so that
+//   gen_fluxNoise_calc_batch can compute all epochs in branch-free loops.
+//   Arrays are re-used for each event and grow as needed.
+struct {
+  int    NALLOC ;        // allocated array size
+  int    NEP ;           // number of epochs with OBSFLAG_GEN
+  int    *EPOCH ;        // compacted epoch index
+
+  // gathered inputs
+  double *ZPT, *CCDGAIN, *SKYSIG, *READNOISE, *NEA, *ZPTERR, *GENMAG ;
+
+  // computed noise (p.e.)
+  double *FLUXSN_PE, *SQSIG_SKY_PE, *SQSIG_CCD_PE, *SQSIG_ZP_PE ;
+  double *Npe_over_FLUXCAL, *NADU_over_Npe ;
+} FLUXNOISE_BATCH ;
+
 
 // Nov 2021: define struct for interpolating host photo-z resolution vs z
 //   Sim input key is HOSTLIB_GENZPHOT_FUDGEMAP: <STRING>
@@ -580,14 +690,18 @@ struct INPUTS {
   int  CIDRAN_SKIPLIST[MXZRAN];  // do not use these user-input CIDRANs
   int  NCIDRAN_SKIPLIST;
   char CIDRAN_SKIPLIST_STRING[200]; // for writing to readme
+  int  CIDRAN_METHOD ;      // see CIDRAN_METHOD_xxx (Oct 2026)
+  int  CIDRAN_SEED ;        // key for CIDRAN permutation; same for all splits
 
   int  JOBID;       // command-line only (for batch) to compute SIMLIB_IDSTART
   int  NJOBTOT;     // id em, for submit_batch_jobs.py
+  int  NTHREAD;     // number of forked worker processes (Oct 2026)
   int  GZIP_DATA_FILES ;  // flag to gzip FITS files  (default=1/true)
 
   int  HOSTLIB_USE ;            // 1=> used; 0 => not used, 2=>rewrite HOSTLIB
   char HOSTLIB_PLUS_COMMAND[60];        //e.g., +HOSTMAGS, +HOSTNBR, +HOSTAPPEND
   char HOSTLIB_FILE[MXPATHLEN]; // lib of Ztrue, Zphot, Zerr ...
+  char HOSTLIB_BINARY_FILE[MXPATHLEN]; // mmap'ed binary image of HOSTLIB
   char HOSTLIB_APPEND_FILE[MXPATHLEN];  // argument of +APPEND
   char HOSTLIB_WGTMAP_FILE[MXPATHLEN];  // optional wgtmap override
   char HOSTLIB_ZPHOTEFF_FILE[MXPATHLEN];  // optional EFF(zphot) vs. ZTRUE
@@ -597,6 +711,7 @@ struct INPUTS {
   int  HOSTLIB_MSKOPT ;         // user bitmask of options
   int  HOSTLIB_MSKOPT_ADD ;     // add to HOSTLIB_MSKOPT (command-line only)
   int  HOSTLIB_MAXREAD ;        // max entries to read (def= infinite)
+  int  HOSTLIB_NTHREAD ;        // threads to parse GAL rows (def=1)
   int  HOSTLIB_GALID_NULL ;     // value for no galaxy; default is -9
   int  HOSTLIB_GALID_UNIQUE;         // flag to force unique galid
   long long int HOSTLIB_GALID_PRIORITY[2] ;  // preferentially select this GALID range
@@ -690,12 +805,17 @@ struct INPUTS {
   char GENSNXT[20] ;        // SN hostgal extinction: CCM89 or SJPAR
   int  GENMODEL_MSKOPT;     // bit-mask of model options
   char GENMODEL_ARGLIST[400] ;
+  double GENMODEL_SEDCACHE[2] ;  // PySEDMODEL SED cache: DTREST, DPAR
+  double GENMODEL_SEDCACHE_MXMB ;
+  char   GENMODEL_SEDCACHE_DIR[MXPATHLEN] ;
   int  GENMAG_SMEAR_MSKOPT;   // bit-mask of GENSMEAR options
   unsigned int ISEED;         // random seed
   unsigned int ISEED_ORIG;    // for readme output
   int          NSTREAM_RAN;   // number of independent random streams
 
   int    RANLIST_START_GENSMEAR;  // to pick different genSmear randoms
+  int    RANDOM_COUNTER;   // 1 => counter-based randoms keyed on event index
+  int    RANDOM_STAGE;     // 1 => separate random substream per sim stage
 
   double OMEGA_MATTER;   // used to select random Z and SN magnitudes
   double OMEGA_LAMBDA;
@@ -730,6 +850,7 @@ struct INPUTS {
 
   RATEPAR_DEF RATEPAR ;
   RATEPAR_DEF RATEPAR_PEC1A ; // only for PEC1A in NON1A input
+  int DNDZ_ICDF ;      // 1 -> pick z from tabulated inverse-CDF (Oct 2026)
 
   MUREWGT_DEF MUREWGT ; // to select weighted MUSHIFT
 
@@ -885,6 +1006,8 @@ struct INPUTS {
   double GENSMEAR_RANFlat_FIX ;    // if >=0 then set Flat randoms to this
 
   char   STRONGLENS_FILE[MXPATHLEN] ;
+  char   STRONGLENS_CACHEFILE[MXPATHLEN] ; // binary cache of lens library
+  int    STRONGLENS_ORDER_ZSRC ; // 1 -> pick lens in ZSRC order (faster)
 
   /* xxx mark delete Feb 4 2025 xxxxx
   char   WEAKLENS_PROBMAP_FILE[MXPATHLEN];
@@ -916,6 +1039,7 @@ struct INPUTS {
   int  WRITE_MASK ;          ;  // computed from FORMAT_MASK
   int  WRFLAG_MODELPAR;    // write model pars to data files (e.g,SIMSED,LCLIB)
   int  WRFLAG_YAML_FILE ;  // write YAML file (Aug 12 2020)
+  double STATUS_UPDATE_SEC ; // >0 => update [VERSION].STATUS every this many sec
   int  WRSPEC_PRESCALE  ;  // prescale FITS output, but not SPEC-DUMPa
   
   int   SMEARFLAG_FLUX ;        // 0,1 => off,on for photo-stat smearing
@@ -974,6 +1098,7 @@ struct INPUTS {
 
   int   NCUTWIN_SNRMAX ;                      // number of SNRMAX cuts
   int   OVERRIDE_CUTWIN_SNRMAX ;              // flag to override SNRMAX cuts
+  float PRESCREEN_CUTWIN_SNRMAX ;  // >0 -> mag margin to pre-screen SNRMAX cut
   float CUTWIN_SNRMAX[MXCUTWIN_SNRMAX][2];    // SNRMAX window
   // list of obs filters to require SNRMAX
   char  CUTWIN_SNRMAX_FILTERS[MXCUTWIN_SNRMAX][MXFILTINDX];
@@ -1041,6 +1166,7 @@ struct INPUTS {
   bool IS_SIMSED_SIMGEN_DUMP[MXSIMGEN_DUMP];
   int  IFLAG_SIMGEN_DUMPALL ;  // 1 -> dump every generated SN
   int  PRESCALE_SIMGEN_DUMP ;  // prescale on writing to SIMGEN_DUMP file
+  int  FORMAT_SIMGEN_DUMP ;    // TEXT (default) or columnar BIN (Oct 2026)
 
   int  SIMGEN_DUMP_NOISE; // Aug 30 2014: diagnostic dump of noise per obs.
   int  SIMGEN_DUMP_TRAINSALT; // OCt 2024: write aux file with TMAX for trainsalt
@@ -1424,6 +1550,10 @@ struct GENLC {
 
 } GENLC ;
 
+// Oct 2026: per-event scratch arena (see arena_alloc in sntools.c);
+// reset in init_event_GENLC, so pointers must not outlive the event.
+ARENA_DEF ARENA_EVENT ;
+
 
 // strong lens structure (July 2019)
 struct GENSL {
@@ -1501,6 +1631,7 @@ struct NGEN_REJECT {
   int CUTWIN ;
   int NEPOCH ;   // counts NEPOCH < NEPOCH_MIN
   int CRAZYFLUX ;
+  int PRESCREEN ; // fails SNRMAX upper bound before GENMAG_DRIVER
 } NGEN_REJECT ;
 
 
@@ -1606,6 +1737,20 @@ struct {
 } SIMLIB_IDEAL_GRID ;
 
 
+// Oct 2026: optional byte-offset index of each LIBID in the SIMLIB file
+//   so that the start LIBID (IDSTART, IDLOCK, batch/thread skip) is
+//   reached with one fseek instead of parsing every preceding LIBID.
+//   Only for un-compressed SIMLIB because popen (gzip) cannot fseek.
+struct {
+  bool  USE;
+  int   NLIBID ;       // number of LIBID entries in file
+  int   NALLOC ;
+  int   *LIBID  ;      // LIBID value for each entry
+  long  *OFFSET ;      // file offset of "LIBID:" line for each entry
+  long  OFFSET_BEGIN;  // file offset just after global header BEGIN key
+} SIMLIB_INDEX ;
+
+
 struct SIMLIB_HEADER {
   // header info for each LIBID entry
 
@@ -1660,53 +1805,57 @@ struct SIMLIB_HEADER {
 
 // Define SIMLIB  struct for reading
 // Allocate for writing/reading entire array.
+// Oct 2026: [obs] arrays are malloc'ed with MXOBS_ALLOC elements,
+//   starting with MXOBS_SIMLIB_INIT and growing as needed up to
+//   MXOBS_SIMLIB; see SIMLIB_malloc_OBS.
 typedef struct  {
   int     NOBS;       // everything, including SPECTROGRAPH and TAKE_SPECTRUM
   int     NOBS_READ ; // orginal NOBS read from cadence (never changes)
   int     NOBS_SPECTROGRAPH ;
   int     NOBS_TAKE_SPECTRUM ;
-
-  int     OPTLINE[MXOBS_SIMLIB];
-  int     IFILT_OBS[MXOBS_SIMLIB];    // absolute filter index
-
-  char    *PTR_BAND[MXOBS_SIMLIB];
-  char    BAND[MXOBS_SIMLIB][20]; // Aug 11 2025: allow full filter name in SIMLIB
-
-  int     IDEXPT[MXOBS_SIMLIB];
-  int     NEXPOSE[MXOBS_SIMLIB];  // Jan 2018 (for saturation calc)
-  int     DETNUM[MXOBS_SIMLIB];   // Aug 2025 for IDEXPT(DETNUM) 
-  double  MJD[MXOBS_SIMLIB];
-  double  CCDGAIN[MXOBS_SIMLIB];
-  double  READNOISE[MXOBS_SIMLIB];
-  double  SKYSIG[MXOBS_SIMLIB];
-  double  PSFSIG1[MXOBS_SIMLIB];   // Gauss sigma core, pixels
-  double  PSFSIG2[MXOBS_SIMLIB];   // optional 2nd Gauss, pixels
-  double  PSFRATIO[MXOBS_SIMLIB];  // Gauss ratio at center
-  double  PSF_FWHM[MXOBS_SIMLIB];  // Gauss FWHM, arcsec (Jun 2023)
-  double  NEA[MXOBS_SIMLIB];
-  double  ZPTADU[MXOBS_SIMLIB];    // ZPT in ADU for entire exposure
-  double  ZPTERR[MXOBS_SIMLIB];    // ZPT error
-  double  MAG[MXOBS_SIMLIB];       // optional mag
-  double  PIXSIZE[MXOBS_SIMLIB] ;   // Nov 26, 2011
-
-  char    *PTR_FIELDNAME[MXOBS_SIMLIB];
-  char    FIELDNAME[MXOBS_SIMLIB][MXCHAR_FIELDNAME];
-  int     APPEND_PHOTFLAG[MXOBS_SIMLIB];  // Jan 201
-
-  double  TEMPLATE_SKYSIG[MXOBS_SIMLIB] ;
-  double  TEMPLATE_READNOISE[MXOBS_SIMLIB] ;
-  double  TEMPLATE_ZPT[MXOBS_SIMLIB] ;
-
-  int ISTORE_RAW[MXOBS_SIMLIB] ;
-  int ISEASON[MXOBS_SIMLIB] ;  // bracketed by 90+ day gaps
+  int     MXOBS_ALLOC ; // Oct 2026: allocated size of each [obs] array
+
+  int     *OPTLINE;
+  int     *IFILT_OBS;    // absolute filter index
+
+  char    **PTR_BAND;
+  char    (*BAND)[20]; // Aug 11 2025: allow full filter name in SIMLIB
+
+  int     *IDEXPT;
+  int     *NEXPOSE;  // Jan 2018 (for saturation calc)
+  int     *DETNUM;   // Aug 2025 for IDEXPT(DETNUM) 
+  double  *MJD;
+  double  *CCDGAIN;
+  double  *READNOISE;
+  double  *SKYSIG;
+  double  *PSFSIG1;   // Gauss sigma core, pixels
+  double  *PSFSIG2;   // optional 2nd Gauss, pixels
+  double  *PSFRATIO;  // Gauss ratio at center
+  double  *PSF_FWHM;  // Gauss FWHM, arcsec (Jun 2023)
+  double  *NEA;
+  double  *ZPTADU;    // ZPT in ADU for entire exposure
+  double  *ZPTERR;    // ZPT error
+  double  *MAG;       // optional mag
+  double  *PIXSIZE ;   // Nov 26, 2011
+
+  char    **PTR_FIELDNAME;
+  char    (*FIELDNAME)[MXCHAR_FIELDNAME];
+  int     *APPEND_PHOTFLAG;  // Jan 201
+
+  double  *TEMPLATE_SKYSIG ;
+  double  *TEMPLATE_READNOISE ;
+  double  *TEMPLATE_ZPT ;
+
+  int *ISTORE_RAW ;
+  int *ISEASON ;  // bracketed by 90+ day gaps
 
   // spectrograph info from SIMLIB or TAKE_SPECTRUM key
   int    OBSLIST_SPECTROGRAPH[MXOBS_SPECTROGRAPH];   // sparse list of SPECTROGRAPH obs
   int    OBSLIST_TAKE_SPECTRUM[MXOBS_SPECTROGRAPH];  // sparse list of TAKE_SPECTRUM
 
-  int    IFILT_SPECTROGRAPH[MXOBS_SIMLIB] ;  // synthetic filter index
-  int    INDX_TAKE_SPECTRUM[MXOBS_SIMLIB] ;  // 0 to NPEREVT_TAKE_SPECTRUM-1
-  double TEXPOSE_SPECTROGRAPH[MXOBS_SIMLIB]; // exposure time
+  int    *IFILT_SPECTROGRAPH ;  // synthetic filter index
+  int    *INDX_TAKE_SPECTRUM ;  // 0 to NPEREVT_TAKE_SPECTRUM-1
+  double *TEXPOSE_SPECTROGRAPH; // exposure time
 
 } SIMLIB_OBS_DEF ;
 
@@ -1719,8 +1868,8 @@ SIMLIB_OBS_DEF SIMLIB_OBS_GEN ;  // used to generate SN
 // Jan 6 2016 - define contiguous temp arrays used to sort SIMLIB by MJD.
 struct {
   int     NMJD ;
-  int     INDEX_SORT[MXOBS_SIMLIB] ;
-  double  MJD[MXOBS_SIMLIB] ;
+  int     *INDEX_SORT ;  // [MXOBS_ALLOC]
+  double  *MJD ;         // [MXOBS_ALLOC]
   double  MJD_LAST ;
   double  MJDOFF ;
 } SIMLIB_LIST_forSORT ;
@@ -1742,6 +1891,33 @@ struct SIMLIB_TEMPLATE {
 } SIMLIB_TEMPLATE ;
 
 
+// Oct 2026: bounded LRU cache of parsed cadences (SIMLIB_MSKOPT += 2048)
+//   so that re-reading a LIBID after SIMLIB wrap-around restores
+//   SIMLIB_HEADER, SIMLIB_TEMPLATE and SIMLIB_OBS_RAW from memory
+//   instead of parsing the text. Requires SIMLIB_INDEX.
+#define MXSLOT_SIMLIB_CACHE 200  // max number of cached LIBIDs
+
+typedef struct {
+  int    ENTRY ;         // SIMLIB_INDEX entry; -9 for empty slot
+  long   OFFSET_END ;    // file offset after END_LIBID line
+  long long STAMP ;      // last-use stamp for LRU replacement
+  int    NOBS, NOBS_READ, NOBS_SPECTROGRAPH ;
+  int    NBYTE ;
+  char   *BUFFER ;       // packed SIMLIB_OBS_RAW arrays (NOBS each)
+  struct SIMLIB_HEADER    HEADER ;
+  struct SIMLIB_TEMPLATE  TEMPLATE ;
+} SIMLIB_CACHE_SLOT_DEF ;
+
+struct {
+  bool USE ;
+  int  NSLOT ;
+  int  *SLOT_ENTRY ;   // slot index vs. SIMLIB_INDEX entry (-9 if none)
+  SIMLIB_CACHE_SLOT_DEF *SLOT ;
+  long long STAMP, NFETCH, NHIT, NSTORE ;
+} SIMLIB_CACHE ;
+
+
+
 // LEGACY FLUXERR_COR map structure (Dec 2011); COR <-> correction
 struct SIMLIB_FLUXERR_COR {
   int     USE ;
@@ -1888,12 +2064,20 @@ void   init_commandLine_simargs(int argc, char **argv);
 int    LUPDGEN(int N);
 
 void   SIMLIB_INIT_DRIVER(void);
+void   SIMLIB_malloc_OBS(int NOBS_NEED);
+void   SIMLIB_realloc_OBS(SIMLIB_OBS_DEF *OBS, int MXOLD, int MXNEW);
 void   SIMLIB_initGlobalHeader(void);
 void   SIMLIB_readGlobalHeader_TEXT(void);
 void   SIMLIB_prepGlobalHeader(void);
 void   SIMLIB_prep_fluxerrScale(void);
 void   SIMLIB_findStart(void);
 void   SIMLIB_INIT_IDEAL_GRID(void);
+void   SIMLIB_INIT_INDEX(void);
+int    SIMLIB_seek_INDEX(int NSKIP_LIBID, int IDSEEK);
+void   SIMLIB_INIT_CACHE(void);
+int    SIMLIB_fetch_CACHE(void);
+void   SIMLIB_store_CACHE(void);
+int    SIMLIB_copyObs_CACHE(int OPT, int NOBS, char *BUFFER);
 
 void   SIMLIB_READ_DRIVER(void);
 void   SIMLIB_readNextCadence_TEXT(void);
@@ -1913,6 +2097,11 @@ int    SIMLIB_read_templateNoise(char *field, char *whatNoise, char **wdlist);
 void   SIMLIB_TAKE_SPECTRUM(void) ;
 
 void   set_TIMERS(int flag);
+void   init_STAGE_TIMERS(void);
+void   start_STAGE_TIMER(int istage);
+void   end_STAGE_TIMER(int istage);
+void   print_STAGE_TIMERS(void);
+double get_wallTime_sec(void);
 
 int    SKIP_SIMLIB_FIELD(char *field);
 int    USE_SAME_SIMLIB_ID(int IFLAG) ;
@@ -2084,6 +2273,9 @@ void   gen_distanceMag(double zCMB, double zHEL, double vPEC, double GLON, doubl
 		       double *MU, double *lensDMU, double *MUSHIFT);
 
 double genz_hubble(double zmin, double zmax, RATEPAR_DEF *RATEPAR );
+double genz_hubble_ICDF(double zmin, double zmax, RATEPAR_DEF *RATEPAR );
+void   init_genz_ICDF(double zmin, double zmax, RATEPAR_DEF *RATEPAR );
+double genz_dNdz(double z, RATEPAR_DEF *RATEPAR);
 
 void   init_RATEPAR ( RATEPAR_DEF *RATEPAR ) ;
 void   set_RATEPAR(int ilc, INPUTS_NON1ASED_DEF *INP_NON1ASED ) ;
@@ -2098,6 +2290,25 @@ void update_simFiles(SIMFILE_AUX_DEF *SIMFILE_AUX);
 void end_simFiles(SIMFILE_AUX_DEF *SIMFILE_AUX);
 void hide_readme_file(char *readme_file, char *hide_readme_file);
 
+void fork_simThreads(void);
+void fork_GRIDthreads(int NTHREAD);
+void gen_event_grid(int ilc);
+void prep_simThread(int ithread);
+void SIMLIB_reopen_simThread(void);
+void check_simThreads(int NTHREAD, char *WHAT);
+void init_simMPI(int *argc, char ***argv);
+void prep_simMPI(void);
+void end_simMPI(void);
+
+void init_simMain(int argc, char **argv);
+int  gen_event_main(int *ILC);
+void load_simStream_event(void);
+bool copy_simStream_event(void);
+void merge_simThreads(void);
+void merge_simThreads_YAML(void);
+void merge_simThreads_README(void);
+void abort_merge_simThreads(char *fileName, char *key, char *callFun);
+
 
 void update_accept_counters(int ilc);
 void update_hostmatch_counters(void);
@@ -2113,6 +2324,7 @@ void   dump_PEAKMAG(char *callFun);
 double gen_PEAKMAG(int ifilt_obs);     // get peakmag in this band before GENMAG_DRIVER
 int    gen_TRIGGER_PEAKMAG_SPEC(void); // call GENMAG_DRIVER for peak only
 int    gen_TRIGGER_zHOST(void);        // evaluate zHOST trigger early
+int    gen_PRESCREEN_SNRMAX(void);     // SNRMAX upper bound before GENMAG_DRIVER
 
 void   GENMAG_DRIVER(void);    // driver to generate true mags
 void   DUMP_GENMAG_DRIVER(void);
@@ -2121,8 +2333,11 @@ void   GENFLUX_DRIVER(void);   // driver to generate observed fluxes
 void   set_GENFLUX_FLAGS(int ep);
 void   gen_fluxNoise_randoms(void);
 void   gen_fluxNoise_calc(int ep, int vbose, FLUXNOISE_DEF *FLUXNOISE);
+int    gen_fluxNoise_calc_batch(void); // common-path SoA version of _calc
 void   gen_fluxNoise_fudge_diag(int ep, int vbose, FLUXNOISE_DEF *FLUXNOISE);
 void   gen_fluxNoise_fudge_cov(int icov);
+void   chol_equicorr_fluxNoise(int N, double rho, double *gauran_in,
+			       double *gauran_out);
 void   gen_fluxNoise_driver_cov(void);
 void   gen_fluxNoise_apply(int ep, int vbose, FLUXNOISE_DEF *FLUXNOISE);
 void   dumpLine_fluxNoise(char *fnam, int ep, FLUXNOISE_DEF *FLUXNOISE);
@@ -2137,6 +2352,7 @@ void   GENSPEC_MJD_OBS(void); // list ideal spectrum for each obs
 bool   GENSPEC_PRESCALE_REJECT_SN(void) ;
 bool   DO_GENSPEC(int imjd);
 void   GENSPEC_INIT(int opt, int imjd);  // init arrays
+void   GENSPEC_MALLOC_LAM(int NMJD);   // malloc lambda arrays on demand
 void   GENSPEC_OBSFLUX_INIT(int imjd, int ILAM_MIN, int ILAM_MAX) ;
 void   GENSPEC_TRUE(int imjd);  
 void   GENSPEC_SYNMAG(int ifilt_obs, double *FLAM_LIST, double *FLAMERR_LIST,
@@ -2161,6 +2377,9 @@ void   wr_VERIFY_SED_TRUE(int FLAG_PROCESS, int ifilt_obs, double MJD,
 double find_genmag_obs(int ifilt_obs, double MJD);
 
 void   genmodel(int ifilt_obs, int inear, int ncall);   // generate model-mags
+bool   USE_genmodel_BATCH(void);
+void   genmodel_BATCH(void);  // model-mags for all filters & epochs
+void   load_parList_SALT2_genmodel(double *parList_SN, double *parList_HOST);
 void   genmodelSmear(int NEPFILT, int ifilt_obs, int ifilt_rest,
 		     double z, double *epoch, double *genmag, double *generr);
 
@@ -2179,6 +2398,10 @@ void   update_PARDEF_ZVAR(char *parName); // update PARDEF_ZVAR
 void   init_CIDRAN(void);
 void   sort_CIDRAN(void);
 void   load_CIDRAN(void);
+void   init_CIDRAN_PERM(int NSTORE_ALL);
+int    get_CIDRAN_PERM(int INDEX);
+unsigned long long mix64_CIDRAN(unsigned long long z);
+int    compare_int_CIDRAN(const void *a, const void *b);
 void   init_modelSmear(void);
 void   dump_modelSmearSigma(void);
 void   init_genSmear_filters(void);
@@ -2264,6 +2487,7 @@ void MJDGAP(int N, double *MJDLIST,  double MJDGAP_IGNORE,
 // xxx mark void wr_SIMGEN_FITLERS(char *path);
 
 void wr_SIMGEN_DUMP(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX);
+void wr_SIMGEN_DUMP_BIN(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX);
 void wr_SIMGEN_DUMP_SL(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX);
 void wr_SIMGEN_DUMP_DCR(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX);
 void wr_SIMGEN_DUMP_NOISE(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX,
@@ -2273,6 +2497,7 @@ void wr_SIMGEN_DUMP_TRAINSALT(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX);
 void wr_SIMGEN_DUMP_MWCL(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX);
 
 void wr_SIMGEN_YAML_SUMMARY(SIMFILE_AUX_DEF *SIMFILE_AUX);
+void update_SIMGEN_STATUS(int OPT, SIMFILE_AUX_DEF *SIMFILE_AUX);
 void rewrite_HOSTLIB_DRIVER(void);
 
 int  MATCH_INDEX_SIMGEN_DUMP(char *varName ) ;
@@ -0,0 +1,76 @@
+/*******************************************
+  snlc_sim_stream.h :  Created Oct 2026
+
+  In-memory event-stream API for using snlc_sim as a library
+  (make sim_lib -> $SNANA_DIR/lib/libsnlc_sim.a). Instead of writing
+  data files, accepted events are returned in batches into buffers
+  provided by the caller. Init is separated from generation:
+
+    SIMSTREAM_BATCH_DEF BATCH ;
+    snlc_sim_stream_init(argc, argv);  // same args as snlc_sim.exe
+    BATCH.MXEVT = 1000;  BATCH.MXOBS = 200000;
+    BATCH.CID = ... (malloc all buffers; optional buffers may be NULL)
+    while ( snlc_sim_stream_next(&BATCH) > 0 ) {
+      for(ievt=0; ievt < BATCH.NEVT; ievt++ ) {
+        o0 = BATCH.IOBS_START[ievt];
+        for(o=o0; o < o0+BATCH.NOBS[ievt]; o++ )
+          { use BATCH.MJD[o], BATCH.BAND[o], BATCH.FLUXCAL[o] ... }
+      }
+    }
+    snlc_sim_stream_end();
+
+  Events are the same as for snlc_sim.exe with the same input,
+  except that SIMGEN_DUMP and other auxiliary files are not written.
+  Only this header should be included by the caller; snlc_sim.h
+  defines globals and is private to the simulation.
+
+********************************************/
+
+#ifndef SNLC_SIM_STREAM_H
+#define SNLC_SIM_STREAM_H
+
+typedef struct {
+
+  // set by caller: capacity of each buffer
+  int    MXEVT ;      // max number of events per batch
+  int    MXOBS ;      // max number of observations per batch (all events)
+
+  // filled by snlc_sim_stream_next
+  int    NEVT ;       // number of events in this batch
+  int    NOBS_TOT ;   // number of observations in this batch
+
+  // per-event buffers [MXEVT]; required
+  int    *CID ;
+  int    *NOBS ;        // number of observations for this event
+  int    *IOBS_START ;  // index of first observation in per-obs buffers
+
+  // per-event truth & host buffers [MXEVT]; optional (NULL => skip)
+  int       *SIM_GENTYPE ;
+  int       *SIM_TEMPLATE_INDEX ;
+  float     *SIM_REDSHIFT_CMB ;
+  float     *SIM_PEAKMJD ;
+  float     *SIM_DLMU ;
+  float     *SIM_SALT2x1,  *SIM_SALT2c ;
+  float     *SIM_AV, *SIM_RV ;
+  float     *SIM_MWEBV ;
+  float     *REDSHIFT_FINAL ;        // observed redshift (CMB frame)
+  long long *SIM_HOSTLIB_GALID ;
+  long long *HOSTGAL_OBJID ;         // nearest host match
+  float     *HOSTGAL_PHOTOZ ;
+  float     *HOSTGAL_SPECZ ;
+  float     *HOSTGAL_LOGMASS_TRUE ;
+  float     *HOSTGAL_LOGMASS_OBS ;
+
+  // per-observation buffers [MXOBS]; required except SIM_MAGOBS
+  double *MJD ;
+  char   *BAND ;         // single-char band
+  float  *FLUXCAL, *FLUXCAL_ERR ;
+  float  *SIM_MAGOBS ;   // true mag; optional (NULL => skip)
+
+} SIMSTREAM_BATCH_DEF ;
+
+int  snlc_sim_stream_init(int argc, char **argv);
+int  snlc_sim_stream_next(SIMSTREAM_BATCH_DEF *BATCH);
+void snlc_sim_stream_end(void);
+
+#endif
@@ -45,6 +45,13 @@
 
  Jun 16 2019:  call  TABLEFILE_CLOSE(f), EXCEPT for TEXT format
 
+ Oct 15 2026: 
+   + map each row of the first table to a row in every other table
+     once (CID hash via match_cid_hash_load/list), then fill output
+     directly from SNTABLE_AUTOSTORE arrays. Replaces per-variable
+     SNTABLE_AUTOSTORE_READ calls that searched VARNAME and then
+     CCID with a linear scan (NROW^2 for each file).
+
 ===================================== */
 
 #include <stdio.h>
@@ -96,6 +103,7 @@ struct {
   float  *VAL_F ;
   double *VAL_D;
   char   **VAL_C ;
+  int    **IROW_FILE ; // [ifile][irow] = row in ifile for CID of irow 
 } OUTPUT ;
 
 // ================================
@@ -105,6 +113,7 @@ struct {
 void  PARSE_ARGV(int argc, char **argv);
 void  testRead(void);
 void  malloc_OUTPUT_STORAGE(void);
+void  map_rows_combine(void);
 void  openFile_combine(void);
 void  sntable_combine_init(void);
 void  sntable_combine_fill(int irow);
@@ -150,6 +159,9 @@ int main(int argc, char **argv) {
   // malloc globals to use for output storage
   malloc_OUTPUT_STORAGE();
 
+  // match rows of each file to rows of first file
+  map_rows_combine();
+
   // -------------------------------------
   // init output table
   openFile_combine();
@@ -251,6 +263,48 @@ void  malloc_OUTPUT_STORAGE(void) {
 } // end malloc_OUTPUT_STORE
 
 
+// ==============================
+void  map_rows_combine(void) {
+
+  // Created Oct 2026
+  // For each input file, store row index matching the CCID of
+  // each row in the first file (-9 if CCID is missing) so that
+  // sntable_combine_fill can read stored values directly.
+
+  int NROW = OUTPUT.NROW ;
+  int ifile, irow, NROW_FILE, NMATCH ;
+  char **CCID_LIST0 = SNTABLE_AUTOSTORE[0].CCID ;
+
+  // ------------- BEGIN -----------
+
+  OUTPUT.IROW_FILE = (int**)malloc( NFILE_AUTOSTORE * sizeof(int*) );
+
+  for(ifile=0; ifile < NFILE_AUTOSTORE; ifile++ ) {
+    OUTPUT.IROW_FILE[ifile] = (int*)malloc( (NROW+1) * sizeof(int) );
+
+    if ( ifile == 0 ) {
+      for(irow=0; irow < NROW; irow++ ) 
+	{ OUTPUT.IROW_FILE[ifile][irow] = irow; }
+      continue ;
+    }
+
+    NROW_FILE = SNTABLE_AUTOSTORE[ifile].NROW ;
+    match_cid_hash("", -1, 0); // reset hash table
+    match_cid_hash_load(NROW_FILE, SNTABLE_AUTOSTORE[ifile].CCID, 0);
+    NMATCH = match_cid_hash_list(NROW, CCID_LIST0, OUTPUT.IROW_FILE[ifile]);
+
+    printf("	 Matched %d of %d CIDs in %s\n", 
+	   NMATCH, NROW, INPUTS.INFILE_LIST[ifile] );
+    fflush(stdout);
+  }
+
+  match_cid_hash("", -1, 0);
+
+  return ;
+
+} // end map_rows_combine
+
+
 // ============================================
 void openFile_combine(void) {
 
@@ -349,9 +403,13 @@ void  sntable_combine_init(void) {
 // ============================================
 void  sntable_combine_fill(int irow) {
 
-  int ISTAT, iFile, NVAR, NVAR_TOT, ivar ,ICAST ;
+  // Oct 2026: read values directly from SNTABLE_AUTOSTORE
+  //           using row map from map_rows_combine.
+
+  int iFile, NVAR, NVAR_TOT, ivar ,ICAST, IROW ;
   double DVAL;
-  char CCID[MXCHAR_CCID], CVAL[40], *VARNAME ;
+  char CCID[MXCHAR_CCID], *CVAL ;
+  char CVAL_NULL[] = "NULL_COMBINE" ;
   //  char fnam[] = "sntable_combine_fill" ;
 
   // ------------- BEGIN ------------
@@ -369,13 +427,19 @@ void  sntable_combine_fill(int irow) {
 
   for(iFile=0; iFile < NFILE_AUTOSTORE ; iFile++ ) {
     NVAR = SNTABLE_AUTOSTORE[iFile].NVAR ;
+    IROW = OUTPUT.IROW_FILE[iFile][irow] ;
 
     for(ivar=0; ivar < NVAR; ivar++ ) {
-      VARNAME = SNTABLE_AUTOSTORE[iFile].VARNAME[ivar]; 
       ICAST   = SNTABLE_AUTOSTORE[iFile].ICAST_READ[ivar];
-
-      DVAL = -3333.0 ; sprintf(CVAL,"NULL_COMBINE");
-      SNTABLE_AUTOSTORE_READ(CCID, VARNAME, &ISTAT, &DVAL, CVAL );
+      if ( ICAST < 0 ) { continue ; } // same as sntable_combine_init
+
+      DVAL = -3333.0 ;  CVAL = CVAL_NULL ;
+      if ( IROW >= 0 ) {
+	if ( ICAST == ICAST_C ) 
+	  { CVAL = SNTABLE_AUTOSTORE[iFile].CVAL[ivar][IROW]; }
+	else
+	  { DVAL = SNTABLE_AUTOSTORE[iFile].DVAL[ivar][IROW]; }
+      }
 
       if ( ICAST == ICAST_C ) 
 	{ sprintf(OUTPUT.VAL_C[NVAR_TOT], "%s ", CVAL) ;  }
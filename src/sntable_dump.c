@@ -38,6 +38,17 @@
     sntable_dump.exe <tableFile>  <tableName>  NEVT
         (print number of events in table)
 
+    sntable_dump.exe <tableFile>  <tableName>  -v <varNames> \
+          -cut <var> <min> <max>  [-cut <var2> <min2> <max2> ...]
+        (dump only rows with min <= var <= max; cuts are evaluated
+         while parsing TEXT or SNBIN table, and cut-var need not 
+         be on the -v list)
+
+    sntable_dump.exe <tableFile>  <tableName>  -v <varNames> \
+          -o <outFile>  -format bin
+        (write columnar binary SNBIN file; read back with any
+         SNTABLE reader, or sntable_dump itself)
+
     sntable_dump.exe <tableFile>  <tableName>  -outlier_fit 3 4
     sntable_dump.exe <tableFile>  <tableName>  -outlier_sim 3 4
        (print 3-4 sigma outliers: '-outlier' for fit-data,
@@ -115,6 +126,13 @@
  Jun 22 2021: replace 200 -> MXPATHLEN for input file names.
                 [fixes failure found by Dillon]
 
+ Oct 15 2026: 
+   + new option '-cut <var> <min> <max>' evaluated while parsing
+     (only -v columns and cut columns are converted).
+   + new option '-format bin' to write projected columns to SNBIN.
+   + write_IGNORE_FILE reads values by row index instead of CID
+     lookup (was quadratic, and wrong for multiple outliers per CID).
+
 ********************************************/
 
 #include <stdio.h>
@@ -133,6 +151,8 @@ char msgerr1[80], msgerr2[80];
 
 
 #define MXVAR_DUMP 40 
+#define MXCUT_DUMP MXCUT_READTABLE
+#define TABLEID_DUMP_BIN 100   // table id for -format bin output
 
 struct INPUTS {
   char TABLE_FILE[MXPATHLEN];
@@ -144,6 +164,11 @@ struct INPUTS {
   char OUTFILE_IGNORE[MXPATHLEN] ;   // if --format IGNORE
   char FORMAT_OUTFILE[40];   
   int  ISFORMAT_CSV ;
+  int  ISFORMAT_BIN ;   // SNBIN output (Oct 2026)
+
+  int    NCUT ;                          // number of -cut options
+  char   CUTVAR[MXCUT_DUMP][60];
+  double CUTWIN[MXCUT_DUMP][2];
 
   int  ADD_HEADER ;  // add fitres header of NVAR > 0
   int  NVAR ;        // number of VARNAMES variables to dump
@@ -166,6 +191,7 @@ void  set_outlier_varnames(void);
 void  write_IGNORE_FILE(void) ;
 void  write_headerInfo(FILE *FP) ;
 bool  keyMatch_dash(char *arg, char *key_base);
+int   write_binFile(void);
 
 FILE *FP_OUTFILE ;
 char LINEKEY_DUMP[40];  // 'SN:' or  ''
@@ -229,8 +255,16 @@ int main(int argc, char **argv) {
 
     if ( DO_IGNORE ) { write_IGNORE_FILE(); }
   } 
+  else if ( INPUTS.ISFORMAT_BIN ) {
+    // read projected columns (after cuts) and write SNBIN file
+    NDUMP = write_binFile();
+  }
   else {
     // dump variable values to ascii/fitres file.
+    for(ivar=0; ivar < INPUTS.NCUT; ivar++ ) {
+      SNTABLE_DUMP_CUT(INPUTS.CUTVAR[ivar], 
+		       INPUTS.CUTWIN[ivar][0], INPUTS.CUTWIN[ivar][1]);
+    }
     NDUMP = SNTABLE_DUMP_VALUES(TFILE, TID, NVAR, TLIST, IVAR_NPT,
 				FP_OUTFILE, LINEKEY_DUMP, SEPKEY_DUMP );  
   }
@@ -256,8 +290,9 @@ int main(int argc, char **argv) {
 void parse_args(int NARG, char **argv) {
 
   // Feb 2 2018: parse OBS argument
+  // Oct 15 2026: parse -cut and '-format bin'
 
-  int i, NVAR, IFLAG_VARNAMES ;
+  int i, NVAR, NCUT, IFLAG_VARNAMES ;
   char fnam[] = "parse_args" ;
 
   // -------------- BEGIN -------------
@@ -283,6 +318,8 @@ void parse_args(int NARG, char **argv) {
   sprintf(INPUTS.OUTLIER_VARNAME_CHI2FLUX, "NULL_CHI2FLUX" );
 
   INPUTS.ISFORMAT_CSV = 0 ;
+  INPUTS.ISFORMAT_BIN = 0 ;
+  INPUTS.NCUT         = 0 ;
 
   IFLAG_VARNAMES   =  0 ; 
 
@@ -367,6 +404,27 @@ void parse_args(int NARG, char **argv) {
 	LINEKEY_DUMP[0] = 0 ;
 	SEPKEY_DUMP[0]  = 0 ;
       }
+      if ( strcmp_ignoreCase(INPUTS.FORMAT_OUTFILE,"bin") == 0 ) {
+	INPUTS.ISFORMAT_BIN = 1; 
+	if ( strcmp(INPUTS.OUTFILE_FITRES,"sntable_dump.fitres") == 0 )
+	  { sprintf(INPUTS.OUTFILE_FITRES, "sntable_dump.SNBIN" ); }
+      }
+    }
+
+    if ( keyMatch_dash(argv[i],"cut") ) {
+      IFLAG_VARNAMES = 0;
+      NCUT = INPUTS.NCUT ;
+      if ( i+3 >= NARG || NCUT >= MXCUT_DUMP ) {
+	sprintf(msgerr1,"Invalid or too many (MXCUT_DUMP=%d) cut options", 
+		MXCUT_DUMP);
+	sprintf(msgerr2,"USAGE: -cut <var> <min> <max>" );
+	errmsg(SEV_FATAL, 0, fnam, msgerr1, msgerr2 );
+      }
+      sprintf(INPUTS.CUTVAR[NCUT], "%s", argv[i+1] );
+      sscanf(argv[i+2], "%le", &INPUTS.CUTWIN[NCUT][0] );
+      sscanf(argv[i+3], "%le", &INPUTS.CUTWIN[NCUT][1] );
+      INPUTS.NCUT++ ;  i += 3 ;
+      continue ;
     }
 
 
@@ -396,6 +454,19 @@ void parse_args(int NARG, char **argv) {
   for(i=0; i < INPUTS.NVAR; i++ ) 
     { printf(" Table VARNAME(%d) : %s \n", i, INPUTS.VARNAMES[i] );  }
 
+  for(i=0; i < INPUTS.NCUT; i++ ) {
+    printf(" Table CUT(%d)     : %g <= %s <= %g \n", i,
+	   INPUTS.CUTWIN[i][0], INPUTS.CUTVAR[i], INPUTS.CUTWIN[i][1] );  
+  }
+
+  if ( (INPUTS.NCUT > 0 || INPUTS.ISFORMAT_BIN) && 
+       INPUTS.OUTLIER_NSIGMA[0] >= 0.0 ) {
+    sprintf(msgerr1,"-cut and '-format bin' are not implemented for "
+	    "outlier or OBS dump.");
+    sprintf(msgerr2,"Remove these options, or dump values with -v");
+    errmsg(SEV_FATAL, 0, fnam, msgerr1, msgerr2 );
+  }
+
 
   fflush(stdout);
   return ;
@@ -577,6 +648,7 @@ void  open_fitresFile(void) {
   FP_OUTFILE = NULL ;
 
   if ( INPUTS.NVAR == 0 ) { return ; }
+  if ( INPUTS.ISFORMAT_BIN ) { return ; } // see write_binFile
 
   if ( strcmp(INPUTS.OUTFILE_FITRES,"stdout") == 0 ) 
     { FP_OUTFILE = stdout ; }
@@ -663,10 +735,15 @@ void write_IGNORE_FILE(void) {
   //   $SNDATA_ROOT/lcmerge/[VERSION]/[VERSION].IGNORE
   //
 
+  // Oct 15 2026: read values by row index instead of calling
+  //   SNTABLE_AUTOSTORE_READ(CCID) for each row, which searched all
+  //   rows and returned the first row for a CID with multiple outliers.
+
   FILE *FP ;
-  int  OPTMASK=3, NROW, irow, ISTAT, IFILTOBS, REJECT ;
-  double DVAL, MJD, PSF, TOBS, CHI2 ;
-  char VARLIST[200], CCID[32], CCID_LAST[32], CVAL[32], BAND[2];
+  int  OPTMASK=3, NROW, irow, IFILTOBS, REJECT, ICAST ;
+  int  IVAR_MJD, IVAR_IFILT, IVAR_REJECT, IVAR_PSF, IVAR_TOBS, IVAR_CHI2 ;
+  double MJD, PSF, TOBS, CHI2, **DVAL ;
+  char VARLIST[200], CCID[32], CCID_LAST[32], BAND[2];
   char *VARNAME_CHI2 = INPUTS.OUTLIER_VARNAME_CHI2FLUX ;
   char TBLNAME[] = "OUTLIERS" ; 
   //  char fnam[] = "write_IGNORE_FILE" ;
@@ -682,6 +759,15 @@ void write_IGNORE_FILE(void) {
     SNTABLE_AUTOSTORE_INIT(INPUTS.OUTFILE_FITRES, TBLNAME, VARLIST, OPTMASK );
 
 
+  // column indices in autostore
+  IVAR_MJD    = IVAR_VARNAME_AUTOSTORE("MJD",      &ICAST);
+  IVAR_IFILT  = IVAR_VARNAME_AUTOSTORE("IFILTOBS", &ICAST);
+  IVAR_REJECT = IVAR_VARNAME_AUTOSTORE("REJECT",   &ICAST);
+  IVAR_PSF    = IVAR_VARNAME_AUTOSTORE("PSF",      &ICAST);
+  IVAR_TOBS   = IVAR_VARNAME_AUTOSTORE("TOBS",     &ICAST);
+  IVAR_CHI2   = IVAR_VARNAME_AUTOSTORE(VARNAME_CHI2, &ICAST);
+  DVAL        = SNTABLE_AUTOSTORE[0].DVAL ;
+
   // ------ open IGNORE file ------
   FP = fopen(INPUTS.OUTFILE_IGNORE, "wt") ;
   CCID_LAST[0] = 0 ;
@@ -697,23 +783,12 @@ void write_IGNORE_FILE(void) {
     if ( strcmp(CCID,CCID_LAST) != 0 ) 
       { fprintf(FP,"\n"); }
 
-    SNTABLE_AUTOSTORE_READ(CCID, "MJD",      &ISTAT, &DVAL, CVAL ); 
-    MJD = DVAL ;
-
-    SNTABLE_AUTOSTORE_READ(CCID, "IFILTOBS", &ISTAT, &DVAL, CVAL ); 
-    IFILTOBS = (int)DVAL ;
-
-    SNTABLE_AUTOSTORE_READ(CCID, "REJECT", &ISTAT, &DVAL, CVAL ); 
-    REJECT = (int)DVAL ;
-
-    SNTABLE_AUTOSTORE_READ(CCID, "PSF", &ISTAT, &DVAL, CVAL ); 
-    PSF = DVAL ;
-
-    SNTABLE_AUTOSTORE_READ(CCID, "TOBS", &ISTAT, &DVAL, CVAL ); 
-    TOBS = DVAL ;
-
-    SNTABLE_AUTOSTORE_READ(CCID, VARNAME_CHI2, &ISTAT, &DVAL, CVAL ); 
-    CHI2 = DVAL ;
+    MJD      = DVAL[IVAR_MJD][irow] ;
+    IFILTOBS = (int)DVAL[IVAR_IFILT][irow] ;
+    REJECT   = (int)DVAL[IVAR_REJECT][irow] ;
+    PSF      = DVAL[IVAR_PSF][irow] ;
+    TOBS     = DVAL[IVAR_TOBS][irow] ;
+    CHI2     = DVAL[IVAR_CHI2][irow] ;
 
     sprintf(BAND, "%c", FILTERSTRING[IFILTOBS] );
     fprintf(FP, "IGNORE: %s %.3f %s    "
@@ -728,3 +803,111 @@ void write_IGNORE_FILE(void) {
   return ;
 
 } // end write_IGNORE_FILE
+
+
+// ==================================
+int write_binFile(void) {
+
+  // Created Oct 2026
+  // Read only the -v columns (projection), apply -cut selection
+  // while parsing, and write the selected rows to a columnar 
+  // binary SNBIN file (see sntools_output_bin.c).
+  // Function returns number of rows written.
+
+  char *TFILE = INPUTS.TABLE_FILE ;
+  char *TID   = INPUTS.TABLE_ID ;
+  int   NVAR  = INPUTS.NVAR ;
+  int   OPTMASK = 3, IFILETYPE, NROW_TOT, NROW, irow, ivar, icut ;
+  int   ICAST[MXVAR_DUMP], MXLEN_STR = MXCHAR_VARNAME ;
+  double  *DVAL_LIST[MXVAR_DUMP], DVAL_ROW[MXVAR_DUMP] ;
+  char   **CVAL_LIST[MXVAR_DUMP], CVAL_ROW[MXVAR_DUMP][MXCHAR_VARNAME] ;
+  char   *ptrVar, tableVar[100], BLOCKVAR[] = "DUMP" ;
+  char   *OUTFILE = INPUTS.OUTFILE_FITRES ;
+  char   fnam[] = "write_binFile" ;
+
+  // ------------ BEGIN -------------
+
+  NROW_TOT = SNTABLE_NEVT(TFILE,TID);
+  if ( NROW_TOT <= 0 ) {
+    sprintf(msgerr1,"Found no rows in table=%s", TID);
+    sprintf(msgerr2,"of %s", TFILE);
+    errmsg(SEV_FATAL, 0, fnam, msgerr1, msgerr2 );
+  }
+
+  // - - - - read projected columns - - - - 
+  IFILETYPE = TABLEFILE_OPEN(TFILE, "read");
+  SNTABLE_READPREP(IFILETYPE,TID);
+
+  for(ivar=0; ivar < NVAR; ivar++ ) {
+    ptrVar      = INPUTS.VARNAMES[ivar] ;
+    ICAST[ivar] = ICAST_for_textVar(ptrVar);
+    if ( ICAST[ivar] == ICAST_C ) {
+      CVAL_LIST[ivar] = (char**)malloc(NROW_TOT*sizeof(char*));
+      for(irow=0; irow < NROW_TOT; irow++ ) 
+	{ CVAL_LIST[ivar][irow] = (char*)malloc(MXLEN_STR*sizeof(char)); }
+      SNTABLE_READPREP_VARDEF(ptrVar, CVAL_LIST[ivar], NROW_TOT, OPTMASK);
+    }
+    else {
+      DVAL_LIST[ivar] = (double*)malloc(NROW_TOT*sizeof(double));
+      SNTABLE_READPREP_VARDEF(ptrVar, DVAL_LIST[ivar], NROW_TOT, OPTMASK);
+    }
+  }
+
+  for(icut=0; icut < INPUTS.NCUT; icut++ ) {
+    SNTABLE_READPREP_CUT(INPUTS.CUTVAR[icut], 
+			 INPUTS.CUTWIN[icut][0], INPUTS.CUTWIN[icut][1]);
+  }
+
+  NROW = SNTABLE_READ_EXEC(); // TEXT & SNBIN readers close the file
+  if ( IFILETYPE != IFILETYPE_TEXT && IFILETYPE != IFILETYPE_BIN ) 
+    { TABLEFILE_CLOSE(TFILE); }
+
+  // - - - - write SNBIN table - - - - 
+  TABLEFILE_OPEN(OUTFILE, "new bin");
+  SNTABLE_CREATE(TABLEID_DUMP_BIN, TID, "KEY");
+
+  for(ivar=0; ivar < NVAR; ivar++ ) {
+    ptrVar = INPUTS.VARNAMES[ivar] ;
+    if ( ivar == 0 && strcmp(ptrVar,"CCID") == 0 ) { ptrVar = "CID"; }
+
+    if ( ICAST[ivar] == ICAST_C ) {
+      sprintf(tableVar, "%s:C*%d", ptrVar, MXLEN_STR);
+      SNTABLE_ADDCOL(TABLEID_DUMP_BIN, BLOCKVAR, CVAL_ROW[ivar], 
+		     tableVar, 1);
+    }
+    else {
+      sprintf(tableVar, "%s:D", ptrVar);
+      SNTABLE_ADDCOL(TABLEID_DUMP_BIN, BLOCKVAR, &DVAL_ROW[ivar], 
+		     tableVar, 1);
+    }
+  }
+
+  for(irow=0; irow < NROW; irow++ ) {
+    for(ivar=0; ivar < NVAR; ivar++ ) {
+      if ( ICAST[ivar] == ICAST_C ) 
+	{ sprintf(CVAL_ROW[ivar], "%s", CVAL_LIST[ivar][irow]); }
+      else
+	{ DVAL_ROW[ivar] = DVAL_LIST[ivar][irow]; }
+    }
+    SNTABLE_FILL(TABLEID_DUMP_BIN);
+  }
+
+  TABLEFILE_CLOSE(OUTFILE);
+
+  printf("\n Wrote %d of %d rows (%d columns) to %s \n",
+	 NROW, NROW_TOT, NVAR, OUTFILE);
+  fflush(stdout);
+
+  // - - - - free - - - - 
+  for(ivar=0; ivar < NVAR; ivar++ ) {
+    if ( ICAST[ivar] == ICAST_C ) {
+      for(irow=0; irow < NROW_TOT; irow++ ) { free(CVAL_LIST[ivar][irow]); }
+      free(CVAL_LIST[ivar]);
+    }
+    else
+      { free(DVAL_LIST[ivar]); }
+  }
+
+  return NROW ;
+
+} // end write_binFile
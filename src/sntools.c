@@ -10,6 +10,8 @@
 
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
+#include <fcntl.h>    // F_SETPIPE_SZ for gunzip pipe
 
 #include <gsl/gsl_sf_gamma.h>
 #include <gsl/gsl_sort.h>
@@ -511,10 +513,18 @@ int match_cidlist_init(char *fileName, int *OPTMASK, char *varList_store) {
     } // end varList_store
 
     
+    // Oct 2026: build hash directly from the CID column when
+    //           there is no IDSURVEY/FIELD suffix to append.
+    bool LOAD_CIDCOL = ( !USE_IDSURVEY && !USE_FIELD );
+    if ( LOAD_CIDCOL ) 
+      { match_cid_hash_load(NCID, SNTABLE_AUTOSTORE[IFILE].CCID, ISNOFF); }
+
     for(isn=0; isn < NCID; isn++ ) {
 
       // construct matching STRINGID based on match options
 
+      if ( LOAD_CIDCOL ) { goto STORE_VAR; }
+
       sprintf(CCID,"%s", SNTABLE_AUTOSTORE[IFILE].CCID[isn]);
       sprintf(STRINGID,"%s", CCID); 
 
@@ -532,7 +542,8 @@ int match_cidlist_init(char *fileName, int *OPTMASK, char *varList_store) {
       }
       
       match_cid_hash(STRINGID, ILIST, ISNOFF+isn);
-      
+
+    STORE_VAR:
       // check option to store extra columns of info
       for(ivar=0; ivar < NVAR; ivar++ ) {
 	IVAR_TABLE = HASH_STORAGE.IVAR_TABLE[ivar];
@@ -753,6 +764,97 @@ struct hash_table_def {
 } ;
 struct hash_table_def *hash_table_users = NULL; 
 
+// Oct 2026: hash entries are carved from pooled blocks instead of
+// one malloc per CID, and canonical integer CIDs are stored in a
+// compact open-addressing table (key -> isn) that avoids both the
+// string copy and the uthash handle.
+#define NENTRY_BLOCK_CIDHASH 65536
+struct {
+  int  NBLOCK, NUSED_LAST ;          // NUSED_LAST = used in last block
+  struct hash_table_def **BLOCK_LIST ;
+
+  int  NSLOT, NFILL ;                // NSLOT is power of 2
+  long long int *KEY ;
+  int           *ISN ;               // -9 -> empty slot
+} CIDHASH_STORE = { 0, 0, NULL, 0, 0, NULL, NULL } ;
+
+bool cid_hash_int(char *ccid, long long int *key) {
+
+  // Created Oct 2026
+  // Return true if ccid is a canonical decimal integer (no leading
+  // zeros or '+', at most 18 digits) so that the string <-> integer
+  // map is one-to-one; load *key.
+
+  char *c = ccid ;
+  long long int k = 0 ;
+  int  ndig = 0 ;
+  bool neg = ( *c == '-' ) ;
+
+  if ( neg ) { c++ ; }
+  if ( c[0] == '0' && c[1] != 0 ) { return false; }
+  if ( neg && c[0] == '0' )       { return false; }
+
+  for( ; *c != 0; c++ ) {
+    if ( *c < '0' || *c > '9' ) { return false; }
+    k = 10*k + (*c - '0') ;
+    ndig++ ;
+    if ( ndig > 18 ) { return false; }
+  }
+  if ( ndig == 0 ) { return false; }
+
+  *key = ( neg ? -k : k );
+  return true ;
+
+} // end cid_hash_int
+
+int cid_hash_int_slot(long long int key) {
+  // Created Oct 2026
+  // Return slot for key: either the slot holding key, or the
+  // first empty slot in the linear probe sequence.
+  unsigned long long int h = (unsigned long long int)key ;
+  int mask = CIDHASH_STORE.NSLOT - 1 ;
+  int slot ;
+  h ^= (h >> 33);  h *= 0xff51afd7ed558ccdULL;  h ^= (h >> 33);
+  slot = (int)(h & mask);
+  while ( CIDHASH_STORE.ISN[slot] >= 0 && CIDHASH_STORE.KEY[slot] != key ) 
+    { slot = (slot+1) & mask; }
+  return slot ;
+} // end cid_hash_int_slot
+
+void cid_hash_int_add(long long int key, int isn) {
+
+  // Created Oct 2026
+  // Add key -> isn to open-addressing table; double the table
+  // when it is half full. Repeated key overwrites isn, so that
+  // the most recently added entry wins (same as uthash lookup).
+
+  int NSLOT_OLD = CIDHASH_STORE.NSLOT ;
+  long long int *KEY_OLD = CIDHASH_STORE.KEY ;
+  int           *ISN_OLD = CIDHASH_STORE.ISN ;
+  int i, slot ;
+
+  if ( 2*(CIDHASH_STORE.NFILL+1) > NSLOT_OLD ) {
+    int NSLOT = ( NSLOT_OLD > 0 ? 2*NSLOT_OLD : 1024 );
+    CIDHASH_STORE.NSLOT = NSLOT ;
+    CIDHASH_STORE.KEY   = (long long int*)malloc(NSLOT*sizeof(long long int));
+    CIDHASH_STORE.ISN   = (int*)malloc(NSLOT*sizeof(int));
+    for(i=0; i < NSLOT; i++ ) { CIDHASH_STORE.ISN[i] = -9; }
+    for(i=0; i < NSLOT_OLD; i++ ) {
+      if ( ISN_OLD[i] < 0 ) { continue; }
+      slot = cid_hash_int_slot(KEY_OLD[i]);
+      CIDHASH_STORE.KEY[slot] = KEY_OLD[i] ;
+      CIDHASH_STORE.ISN[slot] = ISN_OLD[i] ;
+    }
+    if ( NSLOT_OLD > 0 ) { free(KEY_OLD); free(ISN_OLD); }
+  }
+
+  slot = cid_hash_int_slot(key);
+  if ( CIDHASH_STORE.ISN[slot] < 0 ) { CIDHASH_STORE.NFILL++ ; }
+  CIDHASH_STORE.KEY[slot] = key ;
+  CIDHASH_STORE.ISN[slot] = isn ;
+
+} // end cid_hash_int_add
+
 int match_cid_hash(char *ccid, int ilist, int isn) {
 
   // Created Jun 2021
@@ -763,25 +865,46 @@ int match_cid_hash(char *ccid, int ilist, int isn) {
   //                                                      
   // Function returns isn index for ilist=0
   // If there is no match, return -9.
+  //
+  // Oct 2026: integer CIDs use open-addressing table; string CIDs
+  //           use pooled uthash entries.
 
-  int isn0 = -9;
-  struct hash_table_def *s, *tmp;
-  char fnam[] = "match_cid_hash" ;
+  int isn0 = -9, ib, slot;
+  long long int key;
+  struct hash_table_def *s ;
+  // char fnam[] = "match_cid_hash" ;
 
   // ---------------- BEGIN ---------------
 
   if ( ilist < 0 ) {
     /* free the hash table contents */
-    HASH_ITER(hh, hash_table_users, s, tmp) {
-      HASH_DEL(hash_table_users, s);
-      free(s);
-    }
+    HASH_CLEAR(hh, hash_table_users);
+    for(ib=0; ib < CIDHASH_STORE.NBLOCK; ib++ ) 
+      { free(CIDHASH_STORE.BLOCK_LIST[ib]); }
+    if ( CIDHASH_STORE.NBLOCK > 0 ) { free(CIDHASH_STORE.BLOCK_LIST); }
+    if ( CIDHASH_STORE.NSLOT  > 0 ) 
+      { free(CIDHASH_STORE.KEY); free(CIDHASH_STORE.ISN); }
+    CIDHASH_STORE.NBLOCK = CIDHASH_STORE.NUSED_LAST = 0 ;
+    CIDHASH_STORE.NSLOT  = CIDHASH_STORE.NFILL = 0 ;
     return(-1);
   }
 
   if ( ilist == 0 ) {
     // create hash table        
-    s     = malloc(sizeof(struct hash_table_def));
+    if ( cid_hash_int(ccid,&key) ) 
+      { cid_hash_int_add(key,isn); return(isn); }
+
+    if ( CIDHASH_STORE.NBLOCK == 0 || 
+	 CIDHASH_STORE.NUSED_LAST == NENTRY_BLOCK_CIDHASH ) {
+      ib = CIDHASH_STORE.NBLOCK ;
+      CIDHASH_STORE.BLOCK_LIST = (struct hash_table_def**)
+	realloc(CIDHASH_STORE.BLOCK_LIST, (ib+1)*sizeof(struct hash_table_def*));
+      CIDHASH_STORE.BLOCK_LIST[ib] = (struct hash_table_def*)
+	malloc(NENTRY_BLOCK_CIDHASH*sizeof(struct hash_table_def));
+      CIDHASH_STORE.NBLOCK++ ;  CIDHASH_STORE.NUSED_LAST = 0 ;
+    }
+    ib = CIDHASH_STORE.NBLOCK - 1 ;
+    s  = &CIDHASH_STORE.BLOCK_LIST[ib][CIDHASH_STORE.NUSED_LAST++] ;
     s->id = isn;
 
     strcpy(s->name, ccid);
@@ -790,6 +913,12 @@ int match_cid_hash(char *ccid, int ilist, int isn) {
   }
   
   // if we get here, match input ccid to ilist=0               
+  if ( cid_hash_int(ccid,&key) ) {
+    if ( CIDHASH_STORE.NSLOT == 0 ) { return isn0; }
+    slot = cid_hash_int_slot(key);
+    return CIDHASH_STORE.ISN[slot] ; // -9 if not found
+  }
+
   HASH_FIND_STR( hash_table_users, ccid, s);
   if ( s ) {  isn0 = s->id; }
   
@@ -797,6 +926,38 @@ int match_cid_hash(char *ccid, int ilist, int isn) {
 
 } // end match_cid_hash
 
+int match_cid_hash_load(int NCID, char **cid_list, int isn_offset) {
+
+  // Created Oct 2026
+  // Batch version of match_cid_hash(cid,0,isn) to build hash table
+  // directly from an array of CIDs (e.g., CID column of an SNTABLE).
+  // Entry i is stored with isn = isn_offset + i.
+  // Returns NCID.
+
+  int i;
+  for(i=0; i < NCID; i++ ) 
+    { match_cid_hash(cid_list[i], 0, isn_offset+i); }
+  return NCID ;
+
+} // end match_cid_hash_load
+
+int match_cid_hash_list(int NCID, char **cid_list, int *isn_list) {
+
+  // Created Oct 2026
+  // Batch version of match_cid_hash(cid,1,-1): resolve NCID cids
+  // with one call. Output isn_list[i] is the isn from the original
+  // list, or -9 if there is no match.
+  // Function returns number of matches.
+
+  int i, NMATCH = 0 ;
+  for(i=0; i < NCID; i++ ) {
+    isn_list[i] = match_cid_hash(cid_list[i], 1, -1);
+    if ( isn_list[i] >= 0 ) { NMATCH++ ; }
+  }
+  return NMATCH ;
+
+} // end match_cid_hash_list
+
 int match_cid_hash__(char *cid, int *ilist, int *isn) {
   int isn0 = match_cid_hash(cid, *ilist, *isn);
   return(isn0);
@@ -1431,7 +1592,7 @@ void init_Cholesky(int OPT, CHOLESKY_DECOMP_DEF *DECOMP) {
   int MATSIZE = DECOMP->MATSIZE ;
   int MEMD0   = MATSIZE * sizeof(double ) ;
   int MEMD1   = MATSIZE * sizeof(double*) ;
-  int irow0, irow1;
+  int irow0, irow1, N;
   gsl_matrix_view chk; 
 
   // ------------ BEGIN -----------
@@ -1440,6 +1601,7 @@ void init_Cholesky(int OPT, CHOLESKY_DECOMP_DEF *DECOMP) {
     for(irow0 = 0; irow0 < MATSIZE; irow0++ )
       { free(DECOMP->CHOLESKY2D[irow0]); }
     free(DECOMP->CHOLESKY2D);
+    free(DECOMP->LOWER1D);
     return ;
   }
 
@@ -1461,6 +1623,18 @@ void init_Cholesky(int OPT, CHOLESKY_DECOMP_DEF *DECOMP) {
     }    
   }
 
+  // Oct 2026: store packed lower triangle, LOWER[i][j] = CHOLESKY2D[j][i]
+  //  for j<=i, so that getRan_GaussCorr skips the zeros and reads
+  //  contiguous memory.
+  DECOMP->LOWER1D = (double*) malloc(MEMD0*(MATSIZE+1)/2 );
+  N = 0 ;
+  for (irow0=0; irow0 < MATSIZE ; irow0++){
+    for (irow1 = 0; irow1 <= irow0 ; irow1++) {    
+      DECOMP->LOWER1D[N] = DECOMP->CHOLESKY2D[irow1][irow0];
+      N++ ;
+    }
+  }
+
   return ;
 
 } // end init_Cholesky
@@ -1472,27 +1646,55 @@ void getRan_GaussCorr(CHOLESKY_DECOMP_DEF *DECOMP,
   // Feb 2020
   // For input list of MATSIZE Gaussian randoms in RanList_noCorr,  
   // return correlated randoms in RanList_Corr
+  //
+  // Oct 14 2026: call block version with NVEC=1
+
+  getRan_GaussCorr_block(DECOMP, 1, RanList_noCorr, RanList_Corr);
 
-  int MATSIZE   = DECOMP->MATSIZE;
-  double GAURAN, tmpMat, tmpRan ;
-  int irow0, irow1;
-  char fnam[] = "getRan_GaussCorr" ;
+  return ;
+
+} // end getRan_GaussCorr
+
+
+void getRan_GaussCorr_block(CHOLESKY_DECOMP_DEF *DECOMP, int NVEC,
+			    double *RanList_noCorr, double *RanList_Corr) {
+
+  // Created Oct 2026
+  // Block version of getRan_GaussCorr: transform NVEC sets of
+  // MATSIZE uncorrelated Gaussian randoms, stored back-to-back in
+  // RanList_noCorr[NVEC*MATSIZE], into correlated randoms
+  // RanList_Corr[NVEC*MATSIZE]; i.e., the matrix product  L x Z
+  // with L = packed lower-triangle and Z = MATSIZE x NVEC matrix.
+  //
+  // Summation order for each element is the same as the original
+  // getRan_GaussCorr, so that results are identical; the only
+  // difference is that the upper-triangle zeros are skipped.
+  // Input and output lists must not overlap.
+
+  int    MATSIZE  = DECOMP->MATSIZE;
+  double *LOWER1D = DECOMP->LOWER1D ;
+  double GAURAN, *ptrL, *ptrRan, *ptrCorr ;
+  int    ivec, irow0, irow1 ;
+  //  char fnam[] = "getRan_GaussCorr_block" ;
 
   // ------------- BEGIN ------------
 
-  for(irow0=0; irow0 < MATSIZE; irow0++ ) {
-    GAURAN = 0.0 ;
-    for(irow1 = 0; irow1 < MATSIZE ; irow1++ ) {
-      tmpMat = DECOMP->CHOLESKY2D[irow1][irow0] ;
-      tmpRan = RanList_noCorr[irow1];
-      GAURAN += ( tmpMat * tmpRan) ;
+  for(ivec=0; ivec < NVEC; ivec++ ) {
+    ptrRan  = &RanList_noCorr[ivec*MATSIZE] ;
+    ptrCorr = &RanList_Corr[ivec*MATSIZE] ;
+    ptrL    = LOWER1D ;
+    for(irow0=0; irow0 < MATSIZE; irow0++ ) {
+      GAURAN = 0.0 ;
+      for(irow1 = 0; irow1 <= irow0 ; irow1++ ) 
+	{ GAURAN += ( ptrL[irow1] * ptrRan[irow1] ) ; }
+      ptrCorr[irow0] = GAURAN;
+      ptrL += (irow0+1);
     }
-    RanList_Corr[irow0] = GAURAN;
   }
 
   return ;
 
-} // end getRan_GaussCorr
+} // end getRan_GaussCorr_block
 
 // ==========================================================
 void init_obs_atFLUXMAX(int OPTMASK, double *PARLIST, int VBOSE) {
@@ -1549,6 +1751,68 @@ void get_obs_atFLUXMAX(char *CCID, int NOBS,
 		       double *MJD_LIST, int *IFILTOBS_LIST, 
 		       int *OBS_atFLUXMAX) {
 
+  // Created May 2019; see get_obs_atFLUXMAX_work.
+  // Oct 15 2026: 
+  //   sort index is stored in grow-only OBS_atFLUXMAX_WORK array,
+  //   and sort is skipped if MJD_LIST is already time-ordered.
+
+  int *INDEX_SORT = NULL ;
+  int  ORDER_SORT = +1;
+
+  // ------------ BEGIN -------------
+
+  OBS_atFLUXMAX[0] = -9; 
+  if ( INPUTS_OBS_atFLUXMAX.OPTMASK == 0 ) { return ; }
+  if ( NOBS < 3 ) { return ; }
+
+  if ( !isSorted_double(NOBS, MJD_LIST) ) {
+    if ( NOBS > OBS_atFLUXMAX_WORK.NOBS_ALLOC ) {
+      if ( OBS_atFLUXMAX_WORK.NOBS_ALLOC > 0 ) 
+	{ free(OBS_atFLUXMAX_WORK.INDEX_SORT); }
+      OBS_atFLUXMAX_WORK.INDEX_SORT = (int*) malloc(NOBS*sizeof(int)) ;
+      OBS_atFLUXMAX_WORK.NOBS_ALLOC = NOBS ;
+    }
+    INDEX_SORT = OBS_atFLUXMAX_WORK.INDEX_SORT ;
+    sortDouble(NOBS, MJD_LIST, ORDER_SORT, INDEX_SORT );
+  }
+
+  get_obs_atFLUXMAX_work(CCID, NOBS, FLUX_LIST, FLUXERR_LIST,
+			 MJD_LIST, IFILTOBS_LIST, INDEX_SORT, 
+			 OBS_atFLUXMAX);
+  return ;
+
+} // end get_obs_atFLUXMAX
+
+
+void get_obs_atFLUXMAX_sorted(char *CCID, int NOBS, 
+			      float *FLUX_LIST, float *FLUXERR_LIST,
+			      double *MJD_LIST, int *IFILTOBS_LIST, 
+			      int *OBS_atFLUXMAX) {
+
+  // Created Oct 2026
+  // Same as get_obs_atFLUXMAX, but caller guarantees that MJD_LIST
+  // is in increasing order; no sort and no malloc per call.
+  get_obs_atFLUXMAX_work(CCID, NOBS, FLUX_LIST, FLUXERR_LIST,
+			 MJD_LIST, IFILTOBS_LIST, NULL, OBS_atFLUXMAX);
+
+} // end get_obs_atFLUXMAX_sorted
+
+
+bool isSorted_double(int N, double *ARRAY) {
+  // Created Oct 2026
+  // Return true if ARRAY is in non-decreasing order.
+  int i;
+  for(i=1; i < N; i++ ) 
+    { if ( ARRAY[i] < ARRAY[i-1] ) { return false; } }
+  return true ;
+} // end isSorted_double
+
+
+void get_obs_atFLUXMAX_work(char *CCID, int NOBS, 
+			    float *FLUX_LIST, float *FLUXERR_LIST,
+			    double *MJD_LIST, int *IFILTOBS_LIST, 
+			    int *INDEX_SORT, int *OBS_atFLUXMAX) {
+
 
   // Created May 2019
   // Find observation index (o) at max flux.
@@ -1601,6 +1865,10 @@ void get_obs_atFLUXMAX(char *CCID, int NOBS,
   //
   // Mar 23 2021: bail if NOBS < 3
   // Apr 10 2024: init OBS_atFLUXMAX[0] before returning
+  // Oct 15 2026: 
+  //   + rename get_obs_atFLUXMAX -> get_obs_atFLUXMAX_work with 
+  //     INDEX_SORT passed by caller (NULL -> MJD_LIST is time-ordered)
+  //   + MJD-window arrays are grow-only in OBS_atFLUXMAX_WORK
   //
 
   OBS_atFLUXMAX[0] = -9;  // Apr 2024
@@ -1626,7 +1894,6 @@ void get_obs_atFLUXMAX(char *CCID, int NOBS,
   int     NOBS_SNRCUT=0, NSNRCUT_MAXSUM=0, *NSNRCUT;
   double  WGT_SNRCUT_MAXSUM, WGT_SNRCUT_SUM, *WGT_SNRCUT ; 
   int IFILTOBS, o, omin, omax, omin2, omax2, o_sort, NOTHING ;
-  int MALLOC=0 ;
   double SNR, SNRCUT=0.0, SNRMAX=0.0, FLUXMAX[MXFILTINDX] ;
   double MJD, MJDMIN, MJDMAX, FLUX, FLUXERR;
 
@@ -1643,12 +1910,6 @@ void get_obs_atFLUXMAX(char *CCID, int NOBS,
   WGT_SNRCUT_MAXSUM = 0.0;
   USE_BACKUP_SNRCUT = 0 ;
 
-  // sort by MJD (needed for FmaxClump method)
-  MEMI = NOBS*sizeof(int) ;
-  int  ORDER_SORT = +1;
-  int *INDEX_SORT   = (int*) malloc(MEMI) ;
-  sortDouble(NOBS, MJD_LIST, ORDER_SORT, INDEX_SORT );
-
   // find MJDMIN,MAX (obs may not be time-ordered)
   MJDMIN = +999999.0 ;
   MJDMAX = -999999.0 ;
@@ -1669,8 +1930,25 @@ void get_obs_atFLUXMAX(char *CCID, int NOBS,
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
   }
 
-  MEMI  = sizeof(int)    * MXWIN_SNRCUT ;
-  MEMD  = sizeof(double) * MXWIN_SNRCUT ;
+  if ( MXWIN_SNRCUT > OBS_atFLUXMAX_WORK.NWIN_ALLOC ) {
+    if ( OBS_atFLUXMAX_WORK.NWIN_ALLOC > 0 ) {
+      free(OBS_atFLUXMAX_WORK.NSNRCUT);     
+      free(OBS_atFLUXMAX_WORK.WGT_SNRCUT);
+      free(OBS_atFLUXMAX_WORK.oMIN_SNRCUT); 
+      free(OBS_atFLUXMAX_WORK.oMAX_SNRCUT);  
+    }
+    MEMI  = sizeof(int)    * MXWIN_SNRCUT ;
+    MEMD  = sizeof(double) * MXWIN_SNRCUT ;
+    OBS_atFLUXMAX_WORK.NSNRCUT     = (int*)malloc(MEMI);
+    OBS_atFLUXMAX_WORK.WGT_SNRCUT  = (double*)malloc(MEMD);
+    OBS_atFLUXMAX_WORK.oMIN_SNRCUT = (int*)malloc(MEMI);
+    OBS_atFLUXMAX_WORK.oMAX_SNRCUT = (int*)malloc(MEMI);
+    OBS_atFLUXMAX_WORK.NWIN_ALLOC  = MXWIN_SNRCUT ;
+  }
+  NSNRCUT     = OBS_atFLUXMAX_WORK.NSNRCUT ;
+  WGT_SNRCUT  = OBS_atFLUXMAX_WORK.WGT_SNRCUT ;
+  oMIN_SNRCUT = OBS_atFLUXMAX_WORK.oMIN_SNRCUT ;
+  oMAX_SNRCUT = OBS_atFLUXMAX_WORK.oMAX_SNRCUT ;
 
  START:
 
@@ -1692,13 +1970,6 @@ void get_obs_atFLUXMAX(char *CCID, int NOBS,
     SNRCUT  = SNRCUT_USER;
     if ( USE_BACKUP_SNRCUT ) { SNRCUT = SNRCUT_BACKUP; }
 
-    if ( MALLOC == 0 ) {
-      NSNRCUT       = (int*)malloc(MEMI);
-      WGT_SNRCUT    = (double*)malloc(MEMD);
-      oMIN_SNRCUT   = (int*)malloc(MEMI);
-      oMAX_SNRCUT   = (int*)malloc(MEMI);     
-      MALLOC        = 1 ; 
-    }
     // initialize quantities in each 10-day bin
     for(o=0; o < MXWIN_SNRCUT; o++ ) {
       NSNRCUT[o]       =  0 ;
@@ -1754,7 +2025,7 @@ void get_obs_atFLUXMAX(char *CCID, int NOBS,
     NOBS_SNRCUT=0;   SNRMAX = 0.0 ;
     for(o = omin; o <= omax; o++ ) {   // sorted index
 
-      o_sort = INDEX_SORT[o];
+      o_sort = ( INDEX_SORT != NULL ) ? INDEX_SORT[o] : o ;
       if ( o_sort < 0 || o_sort >= NOBS ) {
 	sprintf(c1err,"Invalid o_sort=%d for o=%d \n", o_sort, o);
 	sprintf(c2err,"problem sorting my MJD");
@@ -1880,15 +2151,9 @@ void get_obs_atFLUXMAX(char *CCID, int NOBS,
   } // end ITER loop
 
  FREE:
-  if ( MALLOC ) { 
-    free(NSNRCUT);     free(WGT_SNRCUT);
-    free(oMIN_SNRCUT); free(oMAX_SNRCUT);  
-  }
-  free(INDEX_SORT);  
-  
   return;
 
-} // end get_obs_atFLUXMAX
+} // end get_obs_atFLUXMAX_work
 
 
 void init_obs_atfluxmax__(int *OPTMASK, double *PARLIST, int *VBOSE)
@@ -2211,19 +2476,15 @@ double get_lightCurveWidth(int OPTMASK_LCWIDTH, int NOBS,
   //             If ERRFLAG != 0, Width -> -9.
   //
   // Feb 1 2019: add OPT_RISE (4-bit)
+  // Oct 15 2026: 
+  //   + width calculation moved to get_lightCurveWidth_sorted
+  //   + LAST_NOBS is allocated size and no longer shrinks, so that
+  //     realloc is not called after each smaller light curve.
   //
 
-  int  OPT_FWHM     = ( (OPTMASK_LCWIDTH & 1) > 0 ) ; // FWHM 
-  int  OPT_MINMAX   = ( (OPTMASK_LCWIDTH & 2) > 0 ) ; // TMAX-TMIN
-  int  OPT_RISE     = ( (OPTMASK_LCWIDTH & 4) > 0 ) ; // 10-100% rise time
-
-  int  ERRFLAG_LOCAL = 0 ;
-  int  obs, isort, obsFmax, FOUND ;
-  int  LDUMP_DEBUG =  0 ; // brute-force prints for debug, then abort
+  int  obs, isort ;
   int  ORDER_SORT  = +1 ; // sort with increasing epochs.
-
-  double Width = -9.0, MAG, FLUX, ARG, TMAX, FLUXMAX, T, F, T0,T1, F0,F1; 
-  double THALF_lo, THALF_hi, T_FWHM, FHALF, FMIN  ;
+  double Width = -9.0 ;
   char fnam[] = "get_lightCurveWidth" ;
 
   // ------------------- BEGIN -------------------
@@ -2245,32 +2506,152 @@ double get_lightCurveWidth(int OPTMASK_LCWIDTH, int NOBS,
     LCWIDTH.MAGLIST_SORTED  = (double*)realloc(LCWIDTH.MAGLIST_SORTED, MEMD );
     LCWIDTH.FLUXLIST_SORTED = (double*)realloc(LCWIDTH.FLUXLIST_SORTED,MEMD );
     LCWIDTH.INDEX_SORT      = (int   *)realloc(LCWIDTH.INDEX_SORT,     MEMI );
+    LCWIDTH.LAST_NOBS = NOBS ;   // update allocated size
   }
 
   // sort TLIST (since T=0 is usually at the end of the list)
   sortDouble(NOBS, TLIST, ORDER_SORT, LCWIDTH.INDEX_SORT );
 
+  // create local time-ordered lists for easier computation
+  for(obs=0; obs<NOBS; obs++ ) {
+    isort = LCWIDTH.INDEX_SORT[obs];      
+    LCWIDTH.TLIST_SORTED[obs]   = TLIST[isort]; 
+    LCWIDTH.MAGLIST_SORTED[obs] = MAGLIST[isort] ;
+  }
+
+  Width = get_lightCurveWidth_sorted(OPTMASK_LCWIDTH, NOBS, 
+				     LCWIDTH.TLIST_SORTED, 
+				     LCWIDTH.MAGLIST_SORTED, 
+				     LCWIDTH.FLUXLIST_SORTED,
+				     ERRFLAG, FUNCALL);
+  return(Width);
+
+} // end get_lightCurveWidth
+
+
+// ==========================================
+void get_lightCurveWidth_bands(int OPTMASK_LCWIDTH, int NOBS, 
+			       double *TLIST, double *MAGLIST, 
+			       int *IFILTLIST, bool SORTED,
+			       double *SCRATCH, int *ISCRATCH,
+			       double *WIDTH, char *FUNCALL ) {
+
+  // Created Oct 2026
+  // Compute light curve width for every band of an event in one call.
+  // Inputs:
+  //   OPTMASK_LCWIDTH : see get_lightCurveWidth
+  //   NOBS      : total number of observations (all bands)
+  //   TLIST     : time (days) for each obs
+  //   MAGLIST   : mag for each obs
+  //   IFILTLIST : absolute filter index for each obs; < 0 -> ignore obs
+  //   SORTED    : true if TLIST is already in increasing order
+  //   SCRATCH   : caller buffer with at least 3*NOBS doubles
+  //   ISCRATCH  : caller buffer with at least NOBS ints
+  //   FUNCALL   : name of calling function (for error msg only)
+  //
+  // Output:
+  //   WIDTH[ifilt_obs] : width for each band; -9 if band has no obs.
+  //
+  // Obs are sorted (once, if needed) and scattered into time-ordered
+  // contiguous per-band segments, so no per-band sort or malloc.
+
+  int    NOBS_BAND[MXFILTINDX], OFFSET[MXFILTINDX], IFILL[MXFILTINDX];
+  int    ifilt, obs, isort, i, ERRFLAG, NOFF = 0 ;
+  double *T_BAND   = SCRATCH ;
+  double *MAG_BAND = SCRATCH + NOBS ;
+  double *F_BAND   = SCRATCH + 2*NOBS ;
+  int    *INDEX_SORT = ISCRATCH ;
+  int    ORDER_SORT  = +1 ;
+  char   fnam[] = "get_lightCurveWidth_bands" ;
+
+  // ------------ BEGIN ------------
+
+  if ( OPTMASK_LCWIDTH == 0 ) {
+    sprintf(c1err,"Invalid OPTMASK=%d passed by %s", 
+	    OPTMASK_LCWIDTH, FUNCALL);
+    sprintf(c2err,"Check valid options in function get_lightCurveWidth");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  for(ifilt=0; ifilt < MXFILTINDX; ifilt++ ) 
+    { WIDTH[ifilt] = -9.0 ;  NOBS_BAND[ifilt] = 0 ; }
+
+  if ( !SORTED ) { sortDouble(NOBS, TLIST, ORDER_SORT, INDEX_SORT); }
+
+  for(obs=0; obs < NOBS; obs++ ) {
+    ifilt = IFILTLIST[obs];
+    if ( ifilt >= 0 ) { NOBS_BAND[ifilt]++ ; }
+  }
+
+  for(ifilt=0; ifilt < MXFILTINDX; ifilt++ ) 
+    { OFFSET[ifilt] = IFILL[ifilt] = NOFF;  NOFF += NOBS_BAND[ifilt]; }
+
+  for(obs=0; obs < NOBS; obs++ ) {
+    isort = SORTED ? obs : INDEX_SORT[obs] ;
+    ifilt = IFILTLIST[isort];
+    if ( ifilt < 0 ) { continue; }
+    i = IFILL[ifilt]++ ;
+    T_BAND[i]   = TLIST[isort] ;
+    MAG_BAND[i] = MAGLIST[isort] ;
+  }
+
+  for(ifilt=0; ifilt < MXFILTINDX; ifilt++ ) {
+    if ( NOBS_BAND[ifilt] == 0 ) { continue; }
+    i = OFFSET[ifilt];
+    WIDTH[ifilt] = 
+      get_lightCurveWidth_sorted(OPTMASK_LCWIDTH, NOBS_BAND[ifilt],
+				 &T_BAND[i], &MAG_BAND[i], &F_BAND[i],
+				 &ERRFLAG, FUNCALL);
+  }
+
+  return ;
+
+} // end get_lightCurveWidth_bands
+
+
+// ==========================================
+double get_lightCurveWidth_sorted(int OPTMASK_LCWIDTH, int NOBS, 
+				  double *TLIST_SORTED, 
+				  double *MAGLIST_SORTED,
+				  double *FLUXLIST_SORTED,
+				  int *ERRFLAG, char *FUNCALL ) {
+
+  // Created Oct 2026 from get_lightCurveWidth.
+  // Same as get_lightCurveWidth, but TLIST_SORTED & MAGLIST_SORTED
+  // are already time-ordered, and FLUXLIST_SORTED is caller scratch 
+  // buffer (NOBS) that is filled here.
+
+  int  OPT_FWHM     = ( (OPTMASK_LCWIDTH & 1) > 0 ) ; // FWHM 
+  int  OPT_MINMAX   = ( (OPTMASK_LCWIDTH & 2) > 0 ) ; // TMAX-TMIN
+  int  OPT_RISE     = ( (OPTMASK_LCWIDTH & 4) > 0 ) ; // 10-100% rise time
+
+  int  ERRFLAG_LOCAL = 0 ;
+  int  obs, obsFmax, FOUND ;
+  int  LDUMP_DEBUG =  0 ; // brute-force prints for debug, then abort
+
+  double Width = -9.0, MAG, FLUX, ARG, TMAX, FLUXMAX, T, F, T0,T1, F0,F1; 
+  double THALF_lo, THALF_hi, T_FWHM, FHALF, FMIN  ;
+  char fnam[] = "get_lightCurveWidth_sorted" ;
+
+  // ------------------- BEGIN -------------------
+
   if ( LDUMP_DEBUG ) { printf("\n DEBUG DUMP of SORTED Tobs,mag: \n");  }
 
-  // create local time-ordered lists for easier computation,
-  // and store fluxes and epoch of peak flux
+  // store fluxes and epoch of peak flux
   TMAX=-999.0; FLUXMAX = 0.0 ; obsFmax=-9;
   for(obs=0; obs<NOBS; obs++ ) {
-      isort = LCWIDTH.INDEX_SORT[obs];      
-      T     = TLIST[isort];
-      MAG   = MAGLIST[isort] ;
-      LCWIDTH.TLIST_SORTED[obs]   = T; 
-      LCWIDTH.MAGLIST_SORTED[obs] = MAG ;
+      T     = TLIST_SORTED[obs];
+      MAG   = MAGLIST_SORTED[obs] ;
 
       // xxx mark delete ARG = 0.4*(ZEROPOINT_FLUXCAL_DEFAULT - MAG);
       ARG = 0.4*(ZEROPOINT_FLUXCAL_nJy - MAG); // any ZP works here since only flux-vs-MJD shape matters
       FLUX = pow(TEN,ARG);
-      LCWIDTH.FLUXLIST_SORTED[obs] = FLUX ;
+      FLUXLIST_SORTED[obs] = FLUX ;
       if ( FLUX > FLUXMAX ) { TMAX=T; FLUXMAX=FLUX; obsFmax=obs; }
 
       if ( LDUMP_DEBUG && MAG < 40.0 ) {
-	printf("\t obs=%3d isort=%3d  T=%7.2f  MAG=%.2f  F=%10.6f\n",
-	       obs, isort, T, MAG, FLUX ) ;
+	printf("\t obs=%3d  T=%7.2f  MAG=%.2f  F=%10.6f\n",
+	       obs, T, MAG, FLUX ) ;
 	fflush(stdout);
       }
   }
@@ -2281,7 +2662,7 @@ double get_lightCurveWidth(int OPTMASK_LCWIDTH, int NOBS,
   if ( OPT_MINMAX ) {
     // Tmin - Tmax option is for illustration only
     if ( NOBS > 1 ) 
-      { Width = LCWIDTH.TLIST_SORTED[NOBS-1] - LCWIDTH.TLIST_SORTED[0]; }
+      { Width = TLIST_SORTED[NOBS-1] - TLIST_SORTED[0]; }
 
   }
   else if ( OPT_FWHM ) {
@@ -2292,12 +2673,12 @@ double get_lightCurveWidth(int OPTMASK_LCWIDTH, int NOBS,
     // find half max before peak
     FOUND=0;
     for (obs=obsFmax; obs>=0; obs-- ) {
-      T=LCWIDTH.TLIST_SORTED[obs] ; F=LCWIDTH.FLUXLIST_SORTED[obs] ; 
+      T=TLIST_SORTED[obs] ; F=FLUXLIST_SORTED[obs] ; 
       if ( F > FHALF ) { FOUND=0; THALF_lo=-9999.0 ; }
       if ( F < FHALF && F>FMIN && FOUND==0 ) {
 	FOUND=1;
-	T0 = T; T1=LCWIDTH.TLIST_SORTED[obs+1] ; 
-	F0 = F; F1=LCWIDTH.FLUXLIST_SORTED[obs+1] ; 
+	T0 = T; T1=TLIST_SORTED[obs+1] ; 
+	F0 = F; F1=FLUXLIST_SORTED[obs+1] ; 
 	if ( LDUMP_DEBUG ) {
 	  printf("\t xxx BEFORE PEAK T0=%.2f T1=%.2f  F0=%.3f F1=%.3f \n",
 		 T0, T1, F0, F1 ); 
@@ -2309,12 +2690,12 @@ double get_lightCurveWidth(int OPTMASK_LCWIDTH, int NOBS,
     // identify last half-max epoch.
     FOUND=0;
     for (obs=obsFmax; obs<NOBS; obs++ ) {
-      T=LCWIDTH.TLIST_SORTED[obs] ; F=LCWIDTH.FLUXLIST_SORTED[obs] ;
+      T=TLIST_SORTED[obs] ; F=FLUXLIST_SORTED[obs] ;
       if ( F > FHALF ) { FOUND=0; THALF_hi=-9.0 ; }
       if ( F < FHALF && F>FMIN && FOUND==0 ) {
 	FOUND=1;
-	T1 = T; T0=LCWIDTH.TLIST_SORTED[obs-1] ; 
-	F1 = F; F0=LCWIDTH.FLUXLIST_SORTED[obs-1] ;
+	T1 = T; T0=TLIST_SORTED[obs-1] ; 
+	F1 = F; F0=FLUXLIST_SORTED[obs-1] ;
 	if ( LDUMP_DEBUG ) {
 	  printf("\t xxx AFTER PEAK T0=%.2f T1=%.2f  F0=%.3f F1=%.3f \n",
 		 T0, T1, F0, F1 ); 
@@ -2338,12 +2719,12 @@ double get_lightCurveWidth(int OPTMASK_LCWIDTH, int NOBS,
 
     FOUND=0;
     for (obs=obsFmax; obs>=0; obs-- ) {
-      T=LCWIDTH.TLIST_SORTED[obs] ; F=LCWIDTH.FLUXLIST_SORTED[obs] ; 
+      T=TLIST_SORTED[obs] ; F=FLUXLIST_SORTED[obs] ; 
       if ( F > FHALF ) { FOUND=0; THALF_lo=-9999.0 ; }
       if ( F < FHALF && F>FMIN && FOUND==0 ) {
 	FOUND=1;
-	T0 = T; T1=LCWIDTH.TLIST_SORTED[obs+1] ; 
-	F0 = F; F1=LCWIDTH.FLUXLIST_SORTED[obs+1] ; 
+	T0 = T; T1=TLIST_SORTED[obs+1] ; 
+	F0 = F; F1=FLUXLIST_SORTED[obs+1] ; 
 	if ( LDUMP_DEBUG ) {
 	  printf("\t xxx BEFORE PEAK T0=%.2f T1=%.2f  F0=%.3f F1=%.3f \n",
 		 T0, T1, F0, F1 ); 
@@ -2359,7 +2740,6 @@ double get_lightCurveWidth(int OPTMASK_LCWIDTH, int NOBS,
 
 
   *ERRFLAG = ERRFLAG_LOCAL ; // load output arg
-  LCWIDTH.LAST_NOBS = NOBS ;   // update last NOBS
 
   if ( LDUMP_DEBUG ) {
     printf("  Inputs:  OPTMASK=%d  FUNCALL=%s \n", OPTMASK_LCWIDTH, FUNCALL);
@@ -2374,7 +2754,7 @@ double get_lightCurveWidth(int OPTMASK_LCWIDTH, int NOBS,
 
   return(Width);
 
-} // end get_lightCurveWidth
+} // end get_lightCurveWidth_sorted
 
 
 
@@ -2412,6 +2792,11 @@ void  update_covMatrix(char *name, int OPTMASK, int MATSIZE,
   //  + replace fortran rs_ with C version of rs using eispack.c[h] 
   //  + move function from SALT2mu.c into sntools.c
   //
+  // Oct 15 2026:
+  //  + for MATSIZE=3 (mB,x1,c), use closed-form eigenvalues to return
+  //    early for valid cov; rs is called only for (nearly) bad cov
+  //    that needs eigenvectors to be fixed.
+  //
 
 
   int nm = MATSIZE ;
@@ -2456,14 +2841,25 @@ void  update_covMatrix(char *name, int OPTMASK, int MATSIZE,
 
   if(LDMP){ printf("\t 1. xxx %s \n", fnam); fflush(stdout); }
 
+  EIGEN_MIN = 0.0 ;
+  if ( ALLOW_ZERODIAG ) { EIGEN_MIN = -1.0E-6 ; }
+
+  // fast path for per-SN cov; require safe margin above EIGEN_MIN
+  // so that borderline matrices get exactly the same rs treatment.
+  if ( MATSIZE == 3 && !LDMP ) {
+    double eig3[3], eigmin, eigmax, TOL ;
+    if ( eigval_sym3x3(covMat, eig3) == 0 ) {
+      eigmin = eig3[0] ;  eigmax = eig3[2];
+      TOL    = 1.0E-9 * fabs(eigmax) ;
+      if ( eigmin > EIGEN_MIN + TOL ) { return ; }
+    }
+  }
+
   matz = true;
   ierr = rs(nm, &covMat[0][0], eigval, matz, &eigvec[0][0] );
 
   if(LDMP){ printf("\t 2. xxx %s \n", fnam); fflush(stdout); }
 
-  EIGEN_MIN = 0.0 ;
-  if ( ALLOW_ZERODIAG ) { EIGEN_MIN = -1.0E-6 ; }
-
   NBAD_EIGVAL = 0 ;
   for(ipar=0; ipar < MATSIZE; ipar++ )  { 
     if (eigval[ipar] <= EIGEN_MIN ){NBAD_EIGVAL += 1;}  
@@ -2541,6 +2937,66 @@ void update_covmatrix__(char *name, int *OPTMASK, int *MATSIZE,
 } 
 
 
+// ==================================================
+int eigval_sym3x3(double (*A)[3], double *eigval) {
+
+  // Created Oct 2026
+  // Closed-form (trigonometric) eigenvalues of real symmetric 3x3
+  // matrix A; see Smith, Comm. ACM 4, 168 (1961).
+  // Output eigval is sorted in increasing order, as for rs().
+  // Function returns 0 on success, or -1 if any eigenvalue is not
+  // finite (caller should then use rs).
+
+  double p1, p2, p, q, r, phi, det, B[3][3] ;
+  double a00 = A[0][0], a11 = A[1][1], a22 = A[2][2];
+  double a01 = A[0][1], a02 = A[0][2], a12 = A[1][2];
+  int i, j;
+
+  // ------------ BEGIN ------------
+
+  p1 = a01*a01 + a02*a02 + a12*a12 ;
+  q  = (a00 + a11 + a22) / 3.0 ;
+
+  if ( p1 == 0.0 ) {
+    // diagonal matrix
+    eigval[0] = a00;  eigval[1] = a11;  eigval[2] = a22;
+  }
+  else {
+    p2 = (a00-q)*(a00-q) + (a11-q)*(a11-q) + (a22-q)*(a22-q) + 2.0*p1 ;
+    p  = sqrt(p2/6.0);
+    for(i=0; i < 3; i++ ) {
+      for(j=0; j < 3; j++ ) 
+	{ B[i][j] = ( A[i][j] - (i==j ? q : 0.0) ) / p ; }
+    }
+    det = 
+      B[0][0]*(B[1][1]*B[2][2] - B[1][2]*B[2][1]) -
+      B[0][1]*(B[1][0]*B[2][2] - B[1][2]*B[2][0]) +
+      B[0][2]*(B[1][0]*B[2][1] - B[1][1]*B[2][0]) ;
+    r = 0.5 * det ;
+    if ( r < -1.0 ) { r = -1.0; }
+    if ( r >  1.0 ) { r =  1.0; }
+    phi = acos(r) / 3.0 ;
+
+    eigval[2] = q + 2.0*p*cos(phi);                  // largest
+    eigval[0] = q + 2.0*p*cos(phi + 2.0*M_PI/3.0);   // smallest
+    eigval[1] = 3.0*q - eigval[0] - eigval[2] ;
+  }
+
+  // sort (only needed for diagonal matrix)
+  for(i=0; i < 2; i++ ) {
+    for(j=i+1; j < 3; j++ ) {
+      if ( eigval[j] < eigval[i] ) 
+	{ double tmp = eigval[i]; eigval[i]=eigval[j]; eigval[j]=tmp; }
+    }
+  }
+
+  for(i=0; i < 3; i++ ) { if ( !isfinite(eigval[i]) ) { return(-1); } }
+
+  return(0);
+
+} // end eigval_sym3x3
+
+
 
 // *******************************************************
 int store_PARSE_WORDS(int OPT, char *FILENAME, char *callFun ) {
@@ -2553,6 +3009,8 @@ int store_PARSE_WORDS(int OPT, char *FILENAME, char *callFun ) {
   // OPT +=  2 --> FILENAME is a string to parse, parse by space or comma
   // OPT +=  4 --> ignore comma in parsing string: space-sep only
   // OPT +=  8 --> ignore after comment char
+  // OPT += 16 --> read first few lines only
+  // OPT += 32 --> (file only) zero-copy; see store_PARSE_WORDS_VIEW
   //                
   // Function returns number of stored words separated by either
   // space or comma.
@@ -2566,6 +3024,9 @@ int store_PARSE_WORDS(int OPT, char *FILENAME, char *callFun ) {
   // Feb 18 2022: read 2 lines for FIRSTLINE
   // Aug 31 2023: minor refactor to handle strlen > 10k (see NWD_APPROX)
   // Nov 16 2023: pass callFun arg for abort message
+  // Oct 15 2026: move per-line parsing to store_PARSE_WORDS_LINE, and
+  //              final checks to end_PARSE_WORDS (for store_PARSE_WORDS_BUFFER)
+  // Oct 15 2026: new VIEW option (MSKOPT_PARSE_WORDS_VIEW) 
 
   bool DO_STRING       = ( (OPT & MSKOPT_PARSE_WORDS_STRING) > 0 );
   bool DO_FILE         = ( (OPT & MSKOPT_PARSE_WORDS_FILE)   > 0 );
@@ -2573,9 +3034,9 @@ int store_PARSE_WORDS(int OPT, char *FILENAME, char *callFun ) {
   bool IGNORE_COMMENTS = ( (OPT & MSKOPT_PARSE_WORDS_IGNORECOMMENT) > 0 );
   bool FIRSTLINE       = ( (OPT & MSKOPT_PARSE_WORDS_FIRSTLINE) > 0 );
   int LENF = strlen(FILENAME);
-  int NWD, MXWD, iwdStart=0, GZIPFLAG, iwd, nline ;
+  int NWD, MXWD, GZIPFLAG, iwd, nline ;
   int NWD_APPROX, i;
-  char LINE[MXCHARLINE_PARSE_WORDS], *pos, sepKey[4] = " ";
+  char LINE[MXCHARLINE_PARSE_WORDS], sepKey[4] = " ";
   FILE *fp;
   PARSE_WORDS.DEBUG_FLAG = 0; // (LENF > 6665000);
   int LDMP =  PARSE_WORDS.DEBUG_FLAG ;
@@ -2609,6 +3070,12 @@ int store_PARSE_WORDS(int OPT, char *FILENAME, char *callFun ) {
     fflush(stdout);
   }
 
+  // zero-copy option: words point into retained file buffer (Oct 2026)
+  if ( OPT > 0 && DO_FILE && (OPT & MSKOPT_PARSE_WORDS_VIEW) > 0 )
+    { return store_PARSE_WORDS_VIEW(OPT, FILENAME, NULL, callFun); }
+
+  set_PARSE_WORDS_VIEW(false); // restore malloced WDLIST
+
   if ( OPT < 0 ) {
     PARSE_WORDS.BUFSIZE = PARSE_WORDS.NWD = 0 ;
     PARSE_WORDS.FILENAME[0] = 0 ;
@@ -2676,27 +3143,7 @@ int store_PARSE_WORDS(int OPT, char *FILENAME, char *callFun ) {
     while( fgets(LINE, MXCHARLINE_PARSE_WORDS, fp)  != NULL ) {
       if ( strlen(LINE) == 0 ) { continue; }
       nline++ ;
-      // xxx mark delete malloc_PARSE_WORDS(MXWORDLINE_PARSE_WORDS);
-      malloc_PARSE_WORDS(PARSE_WORDS.NWD);
-
-      if ( (pos=strchr(LINE,'\n') ) != NULL )  { *pos = '\0' ; }
-
-      if ( PARSE_WORDS.NWD < MXWORDFILE_PARSE_WORDS ) 
-	{ iwdStart = PARSE_WORDS.NWD; }
-
-      splitString2(LINE, sepKey, MXWORDLINE_PARSE_WORDS, 
-		   &NWD, &PARSE_WORDS.WDLIST[iwdStart] ); // <== returned
-
-      if ( IGNORE_COMMENTS ) { // 7.2020
-	int NWD_TMP = 0 ; bool FOUND_COMMENT=false;  char *ptrWD ;
-	for(iwd = iwdStart; iwd < (iwdStart + NWD); iwd++ ) {
-	  ptrWD = PARSE_WORDS.WDLIST[iwd] ; 
-	  if ( commentchar(ptrWD) ) { FOUND_COMMENT = true ; }
-	  if ( !FOUND_COMMENT ) { NWD_TMP++; }
-	}
-	NWD = NWD_TMP; // reset NWD to ignore comments
-      }
-      PARSE_WORDS.NWD += NWD;
+      store_PARSE_WORDS_LINE(LINE, sepKey, IGNORE_COMMENTS);
       if ( FIRSTLINE && nline > 2 ) { break; }
     } // end while
     NWD = PARSE_WORDS.NWD ;
@@ -2711,6 +3158,251 @@ int store_PARSE_WORDS(int OPT, char *FILENAME, char *callFun ) {
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
 
+  end_PARSE_WORDS(NWD, FILENAME, fnam);
+
+  if ( LDMP ) {
+    printf(" xxx %s: NWD_STORE = %d \n", fnam, NWD);
+    printf("\n");
+    fflush(stdout);
+  }
+
+  return(NWD);;
+
+} // end store_PARSE_WORDS
+
+
+// ==================================================
+void store_PARSE_WORDS_LINE(char *LINE, char *sepKey, bool IGNORE_COMMENTS) {
+
+  // Created Oct 2026 (moved out of store_PARSE_WORDS)
+  // Split one text LINE (destroyed) and append words to PARSE_WORDS.
+
+  int NWD, iwd, iwdStart = 0 ;
+  char *pos ;
+
+  // ------------- BEGIN --------------
+
+  malloc_PARSE_WORDS(PARSE_WORDS.NWD);
+
+  if ( (pos=strchr(LINE,'\n') ) != NULL )  { *pos = '\0' ; }
+
+  if ( PARSE_WORDS.NWD < MXWORDFILE_PARSE_WORDS ) 
+    { iwdStart = PARSE_WORDS.NWD; }
+
+  splitString2(LINE, sepKey, MXWORDLINE_PARSE_WORDS, 
+	       &NWD, &PARSE_WORDS.WDLIST[iwdStart] ); // <== returned
+
+  if ( IGNORE_COMMENTS ) { // 7.2020
+    int NWD_TMP = 0 ; bool FOUND_COMMENT=false;  char *ptrWD ;
+    for(iwd = iwdStart; iwd < (iwdStart + NWD); iwd++ ) {
+      ptrWD = PARSE_WORDS.WDLIST[iwd] ; 
+      if ( commentchar(ptrWD) ) { FOUND_COMMENT = true ; }
+      if ( !FOUND_COMMENT ) { NWD_TMP++; }
+    }
+    NWD = NWD_TMP; // reset NWD to ignore comments
+  }
+  PARSE_WORDS.NWD += NWD;
+
+  return ;
+
+} // end store_PARSE_WORDS_LINE
+
+
+// ==================================================
+int store_PARSE_WORDS_BUFFER(int OPT, char *NAME, char *BUFFER, 
+			     char *callFun) {
+
+  // Created Oct 2026
+  // Same as store_PARSE_WORDS for a file, except that the entire
+  // file contents is already in memory (null-terminated BUFFER);
+  // e.g., read ahead by a prefetch thread. *NAME is the file name
+  // used to skip re-parsing the same file, and for error messages.
+  // Lines are split the same way as fgets with MXCHARLINE_PARSE_WORDS.
+  // BUFFER is not modified.
+
+  bool IGNORE_COMMENTS = ( (OPT & MSKOPT_PARSE_WORDS_IGNORECOMMENT) > 0 );
+  bool FIRSTLINE       = ( (OPT & MSKOPT_PARSE_WORDS_FIRSTLINE) > 0 );
+  int  MXCHAR = MXCHARLINE_PARSE_WORDS - 1 ;
+  int  NWD, nline = 0, len ;
+  char LINE[MXCHARLINE_PARSE_WORDS], sepKey[4] = " ", *ptr, *pos ;
+  char fnam[200];
+  concat_callfun_plus_fnam(callFun, "store_PARSE_WORDS_BUFFER", fnam);
+
+  // ------------- BEGIN --------------
+
+  if ( strlen(NAME) > 0 && strcmp(PARSE_WORDS.FILENAME,NAME)==0 ) 
+    { return(PARSE_WORDS.NWD); }
+
+  if ( (OPT & MSKOPT_PARSE_WORDS_VIEW) > 0 ) 
+    { return store_PARSE_WORDS_VIEW(OPT, NAME, BUFFER, callFun); }
+
+  set_PARSE_WORDS_VIEW(false);
+  PARSE_WORDS.NWD = 0 ;
+  ptr = BUFFER ;
+  while ( *ptr != '\0' ) {
+    // mimic fgets: read up to and including '\n', or MXCHAR chars
+    pos = strchr(ptr,'\n');
+    len = ( pos == NULL ) ? strlen(ptr) : (int)(pos - ptr) + 1 ;
+    if ( len > MXCHAR ) { len = MXCHAR; }
+    memcpy(LINE, ptr, len);  LINE[len] = '\0' ;
+    ptr += len ;
+    nline++ ;
+
+    store_PARSE_WORDS_LINE(LINE, sepKey, IGNORE_COMMENTS);
+    if ( FIRSTLINE && nline > 2 ) { break; }
+  }
+  NWD = PARSE_WORDS.NWD ;
+
+  end_PARSE_WORDS(NWD, NAME, fnam);
+
+  return(NWD);
+
+} // end store_PARSE_WORDS_BUFFER
+
+
+// ==================================================
+int store_PARSE_WORDS_VIEW(int OPT, char *FILENAME, char *BUFFER, 
+			   char *callFun) {
+
+  // Created Oct 2026
+  // Zero-copy version of store_PARSE_WORDS for a file:
+  // the entire file (or copy of BUFFER if not NULL) is stored in
+  // retained buffer PARSE_WORDS.VIEW_BUF, words are null-terminated
+  // in place, and PARSE_WORDS.WDLIST[iwd] points to each word.
+  // Avoids per-line fgets and a malloced copy of each word.
+  // Words are separated by blank space or end-of-line (no comma);
+  // words are read-only and valid until the next store_PARSE_WORDS.
+  // Unlike fgets-based reading, lines are not split at 
+  // MXCHARLINE_PARSE_WORDS.
+
+  bool IGNORE_COMMENTS = ( (OPT & MSKOPT_PARSE_WORDS_IGNORECOMMENT) > 0 );
+  bool FIRSTLINE       = ( (OPT & MSKOPT_PARSE_WORDS_FIRSTLINE) > 0 );
+  bool SKIP_LINE       = false ;
+  int  ADDBUF  = ADDBUF_PARSE_WORDS ;
+  int  NWD = 0, nline = 0, GZIPFLAG ;
+  long LEN = 0, NRD ;
+  char *ptr ;
+  FILE *fp ;
+  char fnam[200];
+  concat_callfun_plus_fnam(callFun, "store_PARSE_WORDS_VIEW", fnam);
+
+  // ------------- BEGIN --------------
+
+  set_PARSE_WORDS_VIEW(true);
+  PARSE_WORDS.NWD = 0 ;   PARSE_WORDS.FILENAME[0] = 0 ;
+
+  // - - - - - 
+  // load file contents into VIEW_BUF
+  if ( BUFFER != NULL ) {
+    LEN = strlen(BUFFER);
+    if ( LEN+1 > PARSE_WORDS.VIEW_MXBUF ) {
+      PARSE_WORDS.VIEW_MXBUF = LEN+1 ;
+      PARSE_WORDS.VIEW_BUF = 
+	(char*)realloc(PARSE_WORDS.VIEW_BUF, (LEN+1)*sizeof(char) );
+    }
+    memcpy(PARSE_WORDS.VIEW_BUF, BUFFER, LEN+1);
+  }
+  else {
+    fp = open_TEXTgz(FILENAME,"rt", 0, &GZIPFLAG, fnam );
+    if ( !fp ) {
+      sprintf(c1err,"Could not open text file ");
+      sprintf(c2err,"%s", FILENAME);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+    }
+    // fread in chunks (works for gzip pipe with unknown size)
+    while ( 1 ) {
+      if ( LEN + ADDBUF + 1 > PARSE_WORDS.VIEW_MXBUF ) {
+	PARSE_WORDS.VIEW_MXBUF = 2*PARSE_WORDS.VIEW_MXBUF + ADDBUF + 1;
+	PARSE_WORDS.VIEW_BUF = 
+	  (char*)realloc(PARSE_WORDS.VIEW_BUF, 
+			 PARSE_WORDS.VIEW_MXBUF*sizeof(char) );
+      }
+      NRD = fread(&PARSE_WORDS.VIEW_BUF[LEN], 1, ADDBUF, fp);
+      LEN += NRD ;
+      if ( NRD < ADDBUF ) { break; }
+    }
+    PARSE_WORDS.VIEW_BUF[LEN] = 0 ;
+    fclose(fp);
+  }
+
+  // - - - - - 
+  // tokenize in place
+  ptr = PARSE_WORDS.VIEW_BUF ;
+  while ( *ptr != 0 ) {
+
+    if ( *ptr == '\n' ) {
+      *ptr++ = 0 ;  nline++ ;  SKIP_LINE = false ;
+      if ( FIRSTLINE && nline > 2 ) { break; }
+      continue ;
+    }
+    if ( *ptr == ' ' || *ptr == '\r' ) { *ptr++ = 0 ; continue; }
+
+    // start of new word; check comment char (see commentchar)
+    if ( IGNORE_COMMENTS && strchr("#!%@",*ptr) != NULL ) 
+      { SKIP_LINE = true; }
+
+    if ( !SKIP_LINE ) {
+      if ( NWD >= PARSE_WORDS.VIEW_MXWD ) {
+	PARSE_WORDS.VIEW_MXWD += ADDBUF ;
+	PARSE_WORDS.VIEW_WDLIST = 
+	  (char**)realloc(PARSE_WORDS.VIEW_WDLIST,
+			  PARSE_WORDS.VIEW_MXWD*sizeof(char*) );
+      }
+      PARSE_WORDS.VIEW_WDLIST[NWD] = ptr;  NWD++ ;
+    }
+
+    while ( *ptr != 0 && *ptr != ' ' && *ptr != '\n' && *ptr != '\r' ) 
+      { ptr++ ; }
+  }
+
+  PARSE_WORDS.WDLIST = PARSE_WORDS.VIEW_WDLIST ; // in case of realloc
+  PARSE_WORDS.NWD    = NWD ;
+
+  end_PARSE_WORDS(NWD, FILENAME, fnam);
+
+  return(NWD);
+
+} // end store_PARSE_WORDS_VIEW
+
+
+// ==================================================
+void set_PARSE_WORDS_VIEW(bool VIEW) {
+
+  // Created Oct 2026
+  // Switch PARSE_WORDS.WDLIST between malloced word copies (VIEW=false)
+  // and pointers into VIEW_BUF (VIEW=true). Stored words are cleared.
+
+  // ------------- BEGIN --------------
+
+  if ( VIEW == PARSE_WORDS.VIEW ) { return; }
+
+  if ( VIEW ) {
+    PARSE_WORDS.WDLIST_COPY = PARSE_WORDS.WDLIST ;
+    PARSE_WORDS.WDLIST      = PARSE_WORDS.VIEW_WDLIST ;
+  }
+  else {
+    PARSE_WORDS.WDLIST      = PARSE_WORDS.WDLIST_COPY ;
+  }
+
+  PARSE_WORDS.VIEW        = VIEW ;
+  PARSE_WORDS.NWD         = 0 ;
+  PARSE_WORDS.FILENAME[0] = 0 ;
+
+  return ;
+
+} // end set_PARSE_WORDS_VIEW
+
+
+// ==================================================
+void end_PARSE_WORDS(int NWD, char *FILENAME, char *fnam) {
+
+  // Created Oct 2026 (moved out of store_PARSE_WORDS)
+  // Common checks after parsing, and store FILENAME so that
+  // the next call with the same file/string returns immediately.
+
+  int iwd, LENF = strlen(FILENAME);
+
+  // ------------- BEGIN --------------
 
   if ( NWD >= MXWORDFILE_PARSE_WORDS ) {
     sprintf(c1err,"NWD=%d exceeds bound, MXWORDFILE_PARSE_WORDS=%d ",
@@ -2735,16 +3427,9 @@ int store_PARSE_WORDS(int OPT, char *FILENAME, char *callFun ) {
   else
     { PARSE_WORDS.FILENAME[0] = 0 ; }
 
+  return ;
 
-  if ( LDMP ) {
-    printf(" xxx %s: NWD_STORE = %d \n", fnam, NWD);
-    printf("\n");
-    fflush(stdout);
-  }
-
-  return(NWD);;
-
-} // end store_PARSE_WORDS
+} // end end_PARSE_WORDS
 
 int store_parse_words__(int *OPT, char *FILENAME, char *callFun) 
 { return store_PARSE_WORDS(*OPT, FILENAME, callFun); }
@@ -2815,14 +3500,30 @@ void get_PARSE_WORD(int langFlag, int iwd, char *word, char *callFun) {
   // langFlag=1 ==> called by fortran ==> leave pad space
   //
   // Jun 12 2025: long overdue addition of *callFun arg to use in abort message
+  // Oct 15 2026: bound check moved to get_PARSE_WORD_PTR
+
+  sprintf(word, "%s", get_PARSE_WORD_PTR(iwd, callFun) );
+  if ( langFlag==0 ) 
+    { trim_blank_spaces(word); }  // remove <CR>
+  else
+    { strcat(word," "); }     // extra space for fortran
+  
+  return ;
+} // end get_PARSE_WORD
+
+char *get_PARSE_WORD_PTR(int iwd, char *callFun) {
+
+  // Created Oct 2026
+  // Return pointer to stored word iwd (no copy); abort if iwd is 
+  // out of range. Do not modify the returned word.
 
   int NWD = PARSE_WORDS.NWD ;
-  char fnam[200] = "get_PARSE_WORD" ;
+  char fnam[200] = "get_PARSE_WORD_PTR" ;
   concat_callfun_plus_fnam(callFun, "get_PARSE_WORDS", fnam);
 
   // ----------- BEGIN ---------
 
-  if ( iwd >= NWD ) {
+  if ( iwd >= NWD || iwd < 0 ) {
     print_preAbort_banner(fnam);
     int i;
     for(i=0; i < NWD; i++ ) 
@@ -2832,23 +3533,22 @@ void get_PARSE_WORD(int langFlag, int iwd, char *word, char *callFun) {
     sprintf(c2err,"Check FILENAME = '%s' ", PARSE_WORDS.FILENAME);
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
-  
-  sprintf(word, "%s", PARSE_WORDS.WDLIST[iwd] );
-  if ( langFlag==0 ) 
-    { trim_blank_spaces(word); }  // remove <CR>
-  else
-    { strcat(word," "); }     // extra space for fortran
-  
-  return ;
-} // end get_PARSE_WORD
 
+  return PARSE_WORDS.WDLIST[iwd] ;
+
+} // end get_PARSE_WORD_PTR
+
+// Oct 15 2026: numeric words are parsed in place (no word copy);
+//   output value is unchanged if word is not a number (as with sscanf)
 void get_PARSE_WORD_INT(int langFlag, int iwd, int *i_val, char *callFun) {
-  char word[100];   get_PARSE_WORD(langFlag, iwd, word, callFun);
-  sscanf(word, "%d", i_val);
+  char *word = get_PARSE_WORD_PTR(iwd, callFun), *end ;
+  long  lval = strtol(word, &end, 10);
+  if ( end != word ) { *i_val = (int)lval; }
 }
 void get_PARSE_WORD_FLT(int langFlag, int iwd, float *f_val, char *callFun) {
-  char word[100];   get_PARSE_WORD(langFlag, iwd, word, callFun);
-  sscanf(word, "%f", f_val);
+  char *word = get_PARSE_WORD_PTR(iwd, callFun), *end ;
+  float fval = strtof(word, &end);
+  if ( end != word ) { *f_val = fval; }
 }
 void get_PARSE_WORD_NFLT(int langFlag, int NFLT, int iwd, float *f_val, char *callFun) {
   // Created Dec 10 2021
@@ -2871,8 +3571,9 @@ void get_PARSE_WORD_NFILTDEF(int langFlag, int iwd, float *f_val, char *callFun)
 } // end get_PARSE_WORD_NFILTDEF
 
 void get_PARSE_WORD_DBL(int langFlag, int iwd, double *d_val, char *callFun) {
-  char word[100];   get_PARSE_WORD(langFlag, iwd, word, callFun );
-  sscanf(word, "%le", d_val);
+  char   *word = get_PARSE_WORD_PTR(iwd, callFun), *end ;
+  double  dval = strtod(word, &end);
+  if ( end != word ) { *d_val = dval; }
 }
 
 void get_parse_word__(int *langFlag, int *iwd, char *word, char *callFun) 
@@ -6952,6 +7653,9 @@ void init_random_seed(int ISEED, int NSTREAM) {
   // Init random seed(s) 
   // NSTREAM = 1 -> one random stream and regular init with srandom()
   // NSTREAM = 2 -> two independent streams, use srandom_r
+  //
+  // Oct 2026: if GENRAN_INFO.USE_COUNTER is set by calling program,
+  //           init counter-based generator instead of srandom.
 
   GENRAN_INFO.NSTREAM = NSTREAM ;
   int i ;
@@ -6961,7 +7665,9 @@ void init_random_seed(int ISEED, int NSTREAM) {
 
   // ----------- BEGIN ----------------
 
-  if ( NSTREAM == 1 ) 
+  if ( GENRAN_INFO.USE_COUNTER ) 
+    { init_random_counter(ISEED); }
+  else if ( NSTREAM == 1 ) 
     {   srandom(ISEED); }
   else {
 
@@ -7039,82 +7745,353 @@ void fill_RANLISTs(void) {
 
   return ;
 
-}  // end of fill_RANLISTs
+}  // end of fill_RANLISTs
+
+// **********************************
+void sumstat_RANLISTs(int FLAG) {
+
+  // Created Jun 4 2020
+  // called by fill_RANLISTs
+  // FLAG = 0 -> increment stats
+  // FLAG = 2 -> print final symmary stats
+
+  int NLIST_RAN = GENRAN_INFO.NLIST_RAN ;
+  int ilist, NCALL ;
+  double XNWRAP, XN1, XN0 = (double)MXSTORE_RAN ;
+
+  // --------- BEGIN ----------
+
+  if ( FLAG == 0 ) {
+    if ( GENRAN_INFO.NSTORE_RAN[1] == 0 ) { return; }   
+    GENRAN_INFO.NCALL_fill_RANSTATs++ ;
+    for (ilist = 1; ilist <= NLIST_RAN; ilist++ ) {      
+      // increment stats for previous wrap-usage
+      XN1 = GENRAN_INFO.NSTORE_RAN[ilist];
+      GENRAN_INFO.NWRAP[ilist]       += (XN1/XN0) ;
+      XNWRAP = GENRAN_INFO.NWRAP[ilist];     
+      GENRAN_INFO.NWRAP_SUM[ilist]   += XNWRAP;
+      GENRAN_INFO.NWRAP_SUMSQ[ilist] += (XNWRAP*XNWRAP);      
+      GENRAN_INFO.NWRAP[ilist]        = 0.0 ;
+    } // end ilist
+  }
+  else {
+    // compute final AVG and RMS
+    double SUM, SUMSQ ;
+    for (ilist = 1; ilist <= NLIST_RAN; ilist++ ) { 
+      SUM   = GENRAN_INFO.NWRAP_SUM[ilist] ;
+      SUMSQ = GENRAN_INFO.NWRAP_SUMSQ[ilist] ;
+      NCALL = GENRAN_INFO.NCALL_fill_RANSTATs ;
+      GENRAN_INFO.NWRAP_AVG[ilist] = SUM/(double)NCALL ; 
+      GENRAN_INFO.NWRAP_RMS[ilist] = STD_from_SUMS(NCALL, SUM, SUMSQ);
+    }
+  }
+
+  return;
+
+} // end sumstat_RANLISTs
+
+// **********************************
+double unix_getRan_Flat1(int istream) {
+  // Created Jun 9 2018
+  // Input istream is the random stream: 0 or 1
+  // Return random between 0 and 1.
+  //
+  // Jul 30 2020: check pre-proc flag ONE_RANDOM_STREAM
+  // Oct 2026: check counter-based option
+
+  int NSTREAM = GENRAN_INFO.NSTREAM ;
+  int JRAN ;
+  char fnam[] = "unix_getRan_Flat1";
+  // ------------ BEGIN ----------------
+  if ( GENRAN_INFO.USE_COUNTER ) {
+    return( getRan_Flat1_counter(istream) );
+  }
+  else if ( NSTREAM == 1 )  { 
+    JRAN = random(); 
+  }
+  else {
+#ifdef ONE_RANDOM_STREAM
+    sprintf(c1err,"Cannot use 2nd random stream because");
+    sprintf(c1err,"ONE_RANDOM_STREAM pre-proc flag is set in sntools.h");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+#else
+    random_r(&GENRAN_INFO.ranStream[istream], &JRAN); 
+#endif
+  }
+
+  double r8 = (double)JRAN / (double)RAND_MAX ;  // 0 < r8 < 1 
+  return(r8);
+}
+
+double unix_getRan_Flat1__(int *istream) 
+{ return( unix_getRan_Flat1(*istream) ); }
+
+// **********************************
+void init_random_counter(int ISEED) {
+
+  // Created Oct 2026
+  // Init counter-based (Philox4x32-10) generator. Calling program
+  // must set GENRAN_INFO.USE_COUNTER=true before init_random_seed.
+  // Randoms drawn before the first call to set_random_event
+  // use EVENT=0.
+
+  int istream;
+  char fnam[] = "init_random_counter" ;
+
+  // ----------- BEGIN ----------------
+
+  GENRAN_INFO.USE_COUNTER    = true ;
+  GENRAN_INFO.COUNTER_KEY[0] = (unsigned int)ISEED ;
+  GENRAN_INFO.COUNTER_KEY[1] = 0x5A4E414E ; // fixed 2nd key word
+
+  printf("\t %s: counter-based randoms with ISEED=%d \n", fnam, ISEED);
+  fflush(stdout);
+
+  set_random_event(0,0);
+
+  for(istream=0; istream < MXSTREAM_RAN; istream++ ) 
+    { GENRAN_INFO.COUNTER_NCALL[istream] = 0 ; }
+
+  return ;
+
+} // end init_random_counter
+
+// **********************************
+void set_random_event(int EVENT, int RETRY) {
+
+  // Created Oct 2026
+  // For counter-based randoms, reset draw counters so that all
+  // subsequent randoms depend only on (ISEED, EVENT, RETRY, istream).
+  // EVENT is a global event index (e.g., CIDOFF+ilc) and RETRY counts
+  // re-generation of the same EVENT (e.g., after GENRANGE reject).
+  // Does nothing for legacy sequential randoms.
+
+  int istream ;
+
+  // ----------- BEGIN ----------------
+
+  // per-stage blocks are keyed on event for either generator (Oct 2026)
+  if ( RANSTAGE_INFO.USE ) {
+    int istage, itype ;
+    RANSTAGE_INFO.EVENT = (unsigned int)EVENT ;
+    RANSTAGE_INFO.RETRY = (unsigned int)RETRY ;
+    for(istage=0; istage < MXSTAGE_RAN; istage++ ) {
+      for(itype=0; itype < 2; itype++ ) {
+	RANSTAGE_INFO.NBLOCK[istage][itype] = 0 ;
+	RANSTAGE_INFO.NUSED[istage][itype]  = MXBLOCK_RAN ; // force fill
+      }
+    }
+  }
+
+  if ( !GENRAN_INFO.USE_COUNTER ) { return; }
+
+  GENRAN_INFO.COUNTER_EVENT = (unsigned int)EVENT ;
+  GENRAN_INFO.COUNTER_RETRY = (unsigned int)RETRY ;
+  for(istream=0; istream < MXSTREAM_RAN; istream++ ) 
+    { GENRAN_INFO.COUNTER_NCALL[istream] = 0 ; }
+
+  return ;
+
+} // end set_random_event
+
+// **********************************
+void philox4x32_10(unsigned int *ctr, unsigned int *key, unsigned int *out) {
+
+  // Created Oct 2026
+  // Philox4x32 with 10 rounds (Salmon et al. 2011, "Parallel Random
+  // Numbers: As Easy as 1, 2, 3"). Returns 4 uniform 32-bit words
+  // that depend only on the 4-word counter and 2-word key.
+
+  const unsigned int M0 = 0xD2511F53, M1 = 0xCD9E8D57 ;
+  const unsigned int W0 = 0x9E3779B9, W1 = 0xBB67AE85 ;
+  unsigned int c0=ctr[0], c1=ctr[1], c2=ctr[2], c3=ctr[3];
+  unsigned int k0=key[0], k1=key[1], hi0, lo0, hi1, lo1 ;
+  unsigned long long prod0, prod1 ;
+  int iround ;
+
+  // ----------- BEGIN ----------------
+
+  for(iround=0; iround < 10; iround++ ) {
+    prod0 = (unsigned long long)M0 * (unsigned long long)c0 ;
+    prod1 = (unsigned long long)M1 * (unsigned long long)c2 ;
+    hi0 = (unsigned int)(prod0 >> 32);  lo0 = (unsigned int)prod0 ;
+    hi1 = (unsigned int)(prod1 >> 32);  lo1 = (unsigned int)prod1 ;
+
+    c0 = hi1 ^ c1 ^ k0 ;    c1 = lo1 ;
+    c2 = hi0 ^ c3 ^ k1 ;    c3 = lo0 ;
+    k0 += W0 ;              k1 += W1 ;
+  }
+
+  out[0] = c0;  out[1] = c1;  out[2] = c2;  out[3] = c3;
+
+  return ;
+
+} // end philox4x32_10
+
+// **********************************
+double getRan_Flat1_counter(int istream) {
+
+  // Created Oct 2026
+  // Return counter-based random between 0 and 1 for istream.
+  // Each Philox call gives 4 randoms, so a new block is computed
+  // every 4th draw.
+
+  unsigned int NCALL = GENRAN_INFO.COUNTER_NCALL[istream] ;
+  unsigned int iword = NCALL & 3 ;
+  unsigned int ctr[4];
+
+  // ----------- BEGIN ----------------
+
+  if ( iword == 0 ) {
+    ctr[0] = GENRAN_INFO.COUNTER_EVENT ;
+    ctr[1] = GENRAN_INFO.COUNTER_RETRY ;
+    ctr[2] = (unsigned int)istream ;
+    ctr[3] = NCALL >> 2 ;  // block index
+    philox4x32_10(ctr, GENRAN_INFO.COUNTER_KEY, 
+		  GENRAN_INFO.COUNTER_OUT[istream]);
+  }
+
+  GENRAN_INFO.COUNTER_NCALL[istream]++ ;
+
+  // add 0.5 so that 0 < r8 < 1
+  double r8 = ((double)GENRAN_INFO.COUNTER_OUT[istream][iword] + 0.5) 
+    / 4294967296.0 ;
+  return(r8);
+
+} // end getRan_Flat1_counter
+
+
+// **********************************
+void init_random_stage(int ISEED) {
+
+  // Created Oct 2026
+  // Init per-stage random blocks (RANSTAGE_INFO). Calling program
+  // must call set_random_event for each event; randoms drawn before 
+  // the first call use EVENT=0.
+
+  char fnam[] = "init_random_stage" ;
+
+  // ----------- BEGIN ----------------
+
+  RANSTAGE_INFO.USE    = true ;
+  RANSTAGE_INFO.KEY[0] = (unsigned int)ISEED ;
+  RANSTAGE_INFO.KEY[1] = 0x53544147 ; // differs from COUNTER_KEY[1]
+
+  printf("\t %s: per-stage random substreams with ISEED=%d \n", 
+	 fnam, ISEED);
+  fflush(stdout);
+
+  set_random_event(0,0);
+
+  return ;
+
+} // end init_random_stage
+
 
 // **********************************
-void sumstat_RANLISTs(int FLAG) {
+ATTR_TARGET_CLONES
+void fill_RANSTAGE(int ISTAGE, int ITYPE) {
 
-  // Created Jun 4 2020
-  // called by fill_RANLISTs
-  // FLAG = 0 -> increment stats
-  // FLAG = 2 -> print final symmary stats
+  // Created Oct 2026
+  // Fill next block of MXBLOCK_RAN randoms for this stage and type
+  // (ITYPE_RAN_FLAT or ITYPE_RAN_GAUSS). Each Philox call gives 4 
+  // uniform words; Gaussians use Box-Muller on pairs of words, so 
+  // that the number of words per block is fixed (no rejection).
 
-  int NLIST_RAN = GENRAN_INFO.NLIST_RAN ;
-  int ilist, NCALL ;
-  double XNWRAP, XN1, XN0 = (double)MXSTORE_RAN ;
+  unsigned int ctr[4], out[4], iblk ;
+  double  *BLOCK = RANSTAGE_INFO.BLOCK[ISTAGE][ITYPE] ;
+  double  u[4], r, phi ;
+  int     i, j ;
 
-  // --------- BEGIN ----------
+  // ----------- BEGIN ----------------
 
-  if ( FLAG == 0 ) {
-    if ( GENRAN_INFO.NSTORE_RAN[1] == 0 ) { return; }   
-    GENRAN_INFO.NCALL_fill_RANSTATs++ ;
-    for (ilist = 1; ilist <= NLIST_RAN; ilist++ ) {      
-      // increment stats for previous wrap-usage
-      XN1 = GENRAN_INFO.NSTORE_RAN[ilist];
-      GENRAN_INFO.NWRAP[ilist]       += (XN1/XN0) ;
-      XNWRAP = GENRAN_INFO.NWRAP[ilist];     
-      GENRAN_INFO.NWRAP_SUM[ilist]   += XNWRAP;
-      GENRAN_INFO.NWRAP_SUMSQ[ilist] += (XNWRAP*XNWRAP);      
-      GENRAN_INFO.NWRAP[ilist]        = 0.0 ;
-    } // end ilist
-  }
-  else {
-    // compute final AVG and RMS
-    double SUM, SUMSQ ;
-    for (ilist = 1; ilist <= NLIST_RAN; ilist++ ) { 
-      SUM   = GENRAN_INFO.NWRAP_SUM[ilist] ;
-      SUMSQ = GENRAN_INFO.NWRAP_SUMSQ[ilist] ;
-      NCALL = GENRAN_INFO.NCALL_fill_RANSTATs ;
-      GENRAN_INFO.NWRAP_AVG[ilist] = SUM/(double)NCALL ; 
-      GENRAN_INFO.NWRAP_RMS[ilist] = STD_from_SUMS(NCALL, SUM, SUMSQ);
+  ctr[0] = RANSTAGE_INFO.EVENT ;
+  ctr[1] = RANSTAGE_INFO.RETRY ;
+  ctr[2] = 0x100 + 2*ISTAGE + ITYPE ; // independent substream per stage
+  iblk   = RANSTAGE_INFO.NBLOCK[ISTAGE][ITYPE] * (MXBLOCK_RAN/4) ;
+
+  for(i=0; i < MXBLOCK_RAN; i+=4 ) {
+    ctr[3] = iblk++ ;
+    philox4x32_10(ctr, RANSTAGE_INFO.KEY, out);
+    for(j=0; j < 4; j++ ) { u[j] = ((double)out[j] + 0.5) / 4294967296.0; }
+
+    if ( ITYPE == ITYPE_RAN_FLAT ) {
+      for(j=0; j < 4; j++ ) { BLOCK[i+j] = u[j]; }
+    }
+    else {
+      for(j=0; j < 4; j+=2 ) {
+	r   = sqrt(-2.0*log(u[j])) ;
+	phi = TWOPI * u[j+1] ;
+	BLOCK[i+j]   = r * cos(phi) ;
+	BLOCK[i+j+1] = r * sin(phi) ;
+      }
     }
   }
 
-  return;
+  RANSTAGE_INFO.NBLOCK[ISTAGE][ITYPE]++ ;
+  RANSTAGE_INFO.NUSED[ISTAGE][ITYPE] = 0 ;
+
+  return ;
+
+} // end fill_RANSTAGE
 
-} // end sumstat_RANLISTs
 
 // **********************************
-double unix_getRan_Flat1(int istream) {
-  // Created Jun 9 2018
-  // Input istream is the random stream: 0 or 1
-  // Return random between 0 and 1.
-  //
-  // Jul 30 2020: check pre-proc flag ONE_RANDOM_STREAM
+double *getRan_slice_stage(int ISTAGE, int ITYPE, int NRAN) {
 
-  int NSTREAM = GENRAN_INFO.NSTREAM ;
-  int JRAN ;
-  char fnam[] = "unix_getRan_Flat1";
-  // ------------ BEGIN ----------------
-  if ( NSTREAM == 1 )  { 
-    JRAN = random(); 
-  }
-  else {
-#ifdef ONE_RANDOM_STREAM
-    sprintf(c1err,"Cannot use 2nd random stream because");
-    sprintf(c1err,"ONE_RANDOM_STREAM pre-proc flag is set in sntools.h");
+  // Created Oct 2026
+  // Return pointer to NRAN consecutive randoms for this stage & type.
+  // Slice is valid until the next call for the same stage & type.
+  // If current block has fewer than NRAN unused randoms, the rest
+  // of the block is skipped and a new block is filled.
+
+  double *ptr ;
+  char fnam[] = "getRan_slice_stage" ;
+
+  // ----------- BEGIN ----------------
+
+  if ( ISTAGE < 0 || ISTAGE >= MXSTAGE_RAN || NRAN > MXBLOCK_RAN ) {
+    sprintf(c1err,"Invalid ISTAGE=%d or NRAN=%d", ISTAGE, NRAN);
+    sprintf(c2err,"Valid ISTAGE < %d and NRAN <= %d", 
+	    MXSTAGE_RAN, MXBLOCK_RAN );
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
-#else
-    random_r(&GENRAN_INFO.ranStream[istream], &JRAN); 
-#endif
   }
 
-  double r8 = (double)JRAN / (double)RAND_MAX ;  // 0 < r8 < 1 
-  return(r8);
-}
+  if ( RANSTAGE_INFO.NUSED[ISTAGE][ITYPE] + NRAN > MXBLOCK_RAN ) 
+    { fill_RANSTAGE(ISTAGE,ITYPE); }
 
-double unix_getRan_Flat1__(int *istream) 
-{ return( unix_getRan_Flat1(*istream) ); }
+  ptr = &RANSTAGE_INFO.BLOCK[ISTAGE][ITYPE][RANSTAGE_INFO.NUSED[ISTAGE][ITYPE]];
+  RANSTAGE_INFO.NUSED[ISTAGE][ITYPE] += NRAN ;
+  return(ptr);
+
+} // end getRan_slice_stage
+
+// **********************************
+double getRan_Flat1_stage(int ISTAGE, int ilist) {
+  // Created Oct 2026
+  // Return flat random from stage block; if stage blocks are
+  // not used, return legacy getRan_Flat1(ilist).
+  if ( !RANSTAGE_INFO.USE ) { return getRan_Flat1(ilist); }
+  return *getRan_slice_stage(ISTAGE, ITYPE_RAN_FLAT, 1);
+} 
+
+double getRan_Gauss_stage(int ISTAGE, int ilist) {
+  // Created Oct 2026; Gaussian analog of getRan_Flat1_stage.
+  if ( !RANSTAGE_INFO.USE ) { return getRan_Gauss(ilist); }
+  return *getRan_slice_stage(ISTAGE, ITYPE_RAN_GAUSS, 1);
+} 
+
+double getRan_GaussClip_stage(int ISTAGE, int ilist, 
+			      double ranGmin, double ranGmax) {
+  // Created Oct 2026; clipped analog of getRan_Gauss_stage.
+  double ranG ;
+  if ( !RANSTAGE_INFO.USE ) 
+    { return getRan_GaussClip(ilist, ranGmin, ranGmax); }
+ PICK_RANGAUSS:
+  ranG = *getRan_slice_stage(ISTAGE, ITYPE_RAN_GAUSS, 1);
+  if ( ranG < ranGmin || ranG > ranGmax ) { goto PICK_RANGAUSS; }
+  return(ranG);
+} 
 
 // ***********************************
 double getRan_Gauss(int ilist) {
@@ -9717,6 +10694,8 @@ FILE *open_TEXTgz(char *FILENAME, const char *mode, int OPTMASK_NOFILE,
   //  + if 0 files found for full path (has leading slash), try again in 5 sec.
   //
   // Oct 29 2025: return fp=NULL if OPTMASK_NOFILE=0
+  // Oct 14 2026: use get_CMD_GUNZIP to choose parallel unzip tool
+  //              (bgzip or pigz) if available, and enlarge pipe buffer.
 
   bool NOFILE_ABORT      = (OPTMASK_NOFILE & 1) > 0;
   bool NOFILE_TRY_AGAIN  = (OPTMASK_NOFILE & 2) > 0;
@@ -9799,8 +10778,15 @@ FILE *open_TEXTgz(char *FILENAME, const char *mode, int OPTMASK_NOFILE,
     if ( FOUND_0FILES && NOFILE_RETURN ) { return(NULL);  } // Oct 29 2025
 
     if ( istat_gzip == 0 ) {
-      sprintf(cmd_zcat, "gunzip -c %s", gzipFile);
+      char cmd_gunzip[100];
+      get_CMD_GUNZIP(gzipFile, cmd_gunzip);
+      sprintf(cmd_zcat, "%s %s", cmd_gunzip, gzipFile);
       fp = popen(cmd_zcat,"r");
+#ifdef F_SETPIPE_SZ
+      // larger pipe -> fewer context switches with unzip process;
+      // failure (e.g., above pipe-max-size) is harmless.
+      if ( fp ) { fcntl(fileno(fp), F_SETPIPE_SZ, 1048576); }
+#endif
       *GZIPFLAG = 1 ;
       return(fp);
     }
@@ -9813,6 +10799,97 @@ FILE *open_TEXTgz(char *FILENAME, const char *mode, int OPTMASK_NOFILE,
 } // end open_TEXTgz
 
 
+// =====================================
+void get_CMD_GUNZIP(char *gzipFile, char *CMD_GUNZIP) {
+
+  // Created Oct 2026
+  // Return command to unzip gzipFile to stdout (for popen).
+  // Unzipping already runs in a separate process, in parallel with
+  // the reading code; here choose the fastest tool found in $PATH:
+  //
+  //  BGZF file (blocked gzip) and bgzip         -> bgzip -dc -@NTHREAD
+  //     (true multi-threaded inflate of independent blocks)
+  //  pigz                                       -> pigz -dc
+  //     (separate threads for read, inflate, write & check)
+  //  else                                       -> gunzip -c
+  //
+  // All options give identical output, including multi-member gzip.
+  // PATH is searched only on first call.
+
+  static int FOUND_PIGZ = -1, FOUND_BGZIP = -1 ;
+  int NTHREAD ;
+
+  // ----------- BEGIN ------------
+
+  if ( FOUND_PIGZ < 0 ) {
+    FOUND_PIGZ  = find_in_PATH("pigz");
+    FOUND_BGZIP = find_in_PATH("bgzip");
+  }
+
+  if ( FOUND_BGZIP && is_BGZF(gzipFile) ) {
+    NTHREAD = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if ( NTHREAD < 1 ) { NTHREAD = 1; }
+    if ( NTHREAD > 8 ) { NTHREAD = 8; }
+    sprintf(CMD_GUNZIP, "bgzip -dc -@%d", NTHREAD);
+  }
+  else if ( FOUND_PIGZ ) 
+    { sprintf(CMD_GUNZIP, "pigz -dc"); }
+  else
+    { sprintf(CMD_GUNZIP, "gunzip -c"); }
+
+  return ;
+
+} // end get_CMD_GUNZIP
+
+// =====================================
+bool find_in_PATH(char *prog) {
+
+  // Created Oct 2026
+  // Return true if executable *prog is found in $PATH.
+
+  char *PATH = getenv("PATH");
+  char *PATH_LOCAL, *ptrtok, fullName[MXPATHLEN];
+  bool FOUND = false;
+
+  if ( PATH == NULL ) { return FOUND; }
+  PATH_LOCAL = (char*)malloc(strlen(PATH)+1);
+  sprintf(PATH_LOCAL, "%s", PATH);
+
+  ptrtok = strtok(PATH_LOCAL,":");
+  while ( ptrtok != NULL && !FOUND ) {
+    snprintf(fullName, MXPATHLEN, "%s/%s", ptrtok, prog);
+    if ( access(fullName, X_OK) == 0 ) { FOUND = true; }
+    ptrtok = strtok(NULL,":");
+  }
+
+  free(PATH_LOCAL);
+  return FOUND ;
+
+} // end find_in_PATH
+
+// =====================================
+bool is_BGZF(char *gzipFile) {
+
+  // Created Oct 2026
+  // Return true if gzipFile is BGZF (blocked gzip, e.g., from bgzip):
+  // gzip magic, FEXTRA flag, and 'BC' subfield in first member header.
+
+  unsigned char HEAD[14];
+  FILE *fp = fopen(gzipFile, "rb");
+  bool IS_BGZF = false ;
+
+  if ( fp == NULL ) { return IS_BGZF; }
+  if ( fread(HEAD, 1, 14, fp) == 14 ) {
+    IS_BGZF = 
+      ( HEAD[0] == 0x1f && HEAD[1] == 0x8b && (HEAD[3] & 4) > 0 &&
+	HEAD[12] == 'B' && HEAD[13] == 'C' ) ;
+  }
+  fclose(fp);
+  return IS_BGZF ;
+
+} // end is_BGZF
+
+
 // =====================================
 void snana_rewind(FILE *fp, char *FILENAME, int GZIPFLAG) {
 
@@ -10824,6 +11901,133 @@ void print_debug_malloc(int opt, char *fnam) {
 }  // end print_debug_malloc  
 
 
+// ***************************************
+void *arena_alloc(ARENA_DEF *ARENA, size_t NBYTE) {
+
+  // Created Oct 2026
+  // Return pointer to NBYTE of scratch memory from bump arena.
+  // Memory remains valid until next arena_reset/arena_free.
+  // Blocks come from malloc (16-byte aligned on 64-bit glibc), and
+  // offsets are rounded to NBYTE_ARENA_ALIGN to preserve alignment.
+  // If last block is full, a new block is added (existing pointers
+  // stay valid) with size >= NBYTE and >= twice previous block.
+
+  int    NBLOCK = ARENA->NBLOCK ;
+  size_t NALIGN = NBYTE_ARENA_ALIGN;
+  size_t NBYTE_ALIGN = (NBYTE + NALIGN - 1) & ~(NALIGN - 1);
+  size_t SIZE ;
+  char  *ptr ;
+  char fnam[] = "arena_alloc" ;
+
+  // ----------- BEGIN -------------
+
+  if ( NBYTE_ALIGN == 0 ) { NBYTE_ALIGN = NALIGN; }
+
+  if ( NBLOCK == 0 || ARENA->USED + NBYTE_ALIGN > ARENA->SIZE[NBLOCK-1] ) {
+
+    if ( NBLOCK >= MXBLOCK_ARENA ) {
+      sprintf(c1err,"NBLOCK=%d exceeds bound (MXBLOCK_ARENA)", NBLOCK);
+      sprintf(c2err,"NBYTE_TOT=%zu  NBYTE=%zu", ARENA->NBYTE_TOT, NBYTE);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+    }
+
+    SIZE = NBYTE_ARENA_MIN ;
+    if ( NBLOCK > 0   ) { SIZE = 2 * ARENA->SIZE[NBLOCK-1]; }
+    if ( SIZE < NBYTE_ALIGN ) { SIZE = NBYTE_ALIGN; }
+
+    ARENA->BLOCK[NBLOCK] = (char*) malloc(SIZE);
+    if ( ARENA->BLOCK[NBLOCK] == NULL ) {
+      sprintf(c1err,"Could not allocate %zu bytes for block %d", 
+	      SIZE, NBLOCK);
+      sprintf(c2err,"NBYTE_TOT=%zu", ARENA->NBYTE_TOT);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+    }
+    ARENA->SIZE[NBLOCK] = SIZE;
+    ARENA->USED         = 0 ;
+    ARENA->NBLOCK++ ;  NBLOCK++ ;
+  }
+
+  ptr = ARENA->BLOCK[NBLOCK-1] + ARENA->USED ;
+  ARENA->USED      += NBYTE_ALIGN ;
+  ARENA->NBYTE_TOT += NBYTE_ALIGN ;
+  if ( ARENA->NBYTE_TOT > ARENA->NBYTE_PEAK ) 
+    { ARENA->NBYTE_PEAK = ARENA->NBYTE_TOT; }
+
+  return (void*)ptr ;
+
+} // end arena_alloc
+
+// ***************************************
+void arena_reset(ARENA_DEF *ARENA) {
+
+  // Created Oct 2026
+  // Recycle all arena memory. If more than one block was needed,
+  // replace them with a single block large enough for the peak
+  // usage so that subsequent cycles need only one block.
+
+  int    NBLOCK = ARENA->NBLOCK ;
+  size_t SIZE ;
+
+  // ----------- BEGIN -------------
+
+  if ( NBLOCK > 1 ) {
+    SIZE = ARENA->NBYTE_PEAK ;
+    arena_free(ARENA);
+    ARENA->NBYTE_PEAK = SIZE ;
+    ARENA->BLOCK[0] = (char*) malloc(SIZE);
+    ARENA->SIZE[0]  = SIZE ;
+    ARENA->NBLOCK   = 1 ;
+  }
+
+  ARENA->USED      = 0 ;
+  ARENA->NBYTE_TOT = 0 ;
+
+} // end arena_reset
+
+// ***************************************
+size_t arena_mark(ARENA_DEF *ARENA) {
+  // Created Oct 2026
+  // Return current arena position for later arena_rewind.
+  return ARENA->NBYTE_TOT ;
+} // end arena_mark
+
+// ***************************************
+void arena_rewind(ARENA_DEF *ARENA, size_t MARK) {
+
+  // Created Oct 2026
+  // Release everything allocated since arena_mark returned MARK.
+  // If a new block was started since MARK, do nothing; the memory
+  // is then recycled at the next arena_reset.
+
+  size_t NBYTE_POP = ARENA->NBYTE_TOT - MARK ;
+
+  // ----------- BEGIN -------------
+
+  if ( MARK > ARENA->NBYTE_TOT ) { return; }
+  if ( NBYTE_POP > ARENA->USED ) { return; }
+
+  ARENA->USED      -= NBYTE_POP ;
+  ARENA->NBYTE_TOT  = MARK ;
+
+} // end arena_rewind
+
+// ***************************************
+void arena_free(ARENA_DEF *ARENA) {
+
+  // Created Oct 2026
+  // Release all arena memory.
+  int iblock;
+  for(iblock=0; iblock < ARENA->NBLOCK; iblock++ ) 
+    { free(ARENA->BLOCK[iblock]); }
+
+  ARENA->NBLOCK     = 0 ;
+  ARENA->USED       = 0 ;
+  ARENA->NBYTE_TOT  = 0 ;
+  ARENA->NBYTE_PEAK = 0 ;
+
+} // end arena_free
+
+
 float malloc_shortint2D(int opt, int LEN1, int LEN2, short int ***array2D ) {
   // Created Sep 2021
   // Malloc array2D[LEN1][LEN2]  (intended for LEN1=NSN, LEN2=NCLPAR)
@@ -11111,3 +12315,321 @@ float malloc_shortint4D(int opt, int LEN1, int LEN2, int LEN3, int LEN4,
   return(f_MEMTOT);
 
 }   // end malloc_shortint4D
+
+
+// ******************************************************
+int fork_snlc_workers(int NTHREAD, char *TEXTFILE_PREFIX) {
+
+  // Created Oct 2026
+  // Fork NTHREAD worker processes for snana.exe/snlc_fit.exe after
+  // the one-time init (calib tables, filters, cuts) so that workers
+  // inherit this init copy-on-write. Each worker returns its 
+  // thread index (0 to NTHREAD-1) and the fortran caller sets a
+  // JOBSPLIT-nested event subset and TEXTFILE_PREFIX_THREADnn.
+  // The parent waits for all workers, merges their text tables with
+  // merge_snlc_workers, and exits; parent never returns.
+
+  int   ithread, NERR = 0, wstatus ;
+  pid_t pid, PID_LIST[MXTHREAD_SNLC];
+  char  BANNER[100];
+  char  fnam[] = "fork_snlc_workers" ;
+
+  // ----------- BEGIN ------------
+
+  if ( NTHREAD > MXTHREAD_SNLC ) {
+    sprintf(c1err,"NTHREAD=%d exceeds bound", NTHREAD );
+    sprintf(c2err,"Check MXTHREAD_SNLC = %d", MXTHREAD_SNLC );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  sprintf(BANNER,"%s: fork %d workers", fnam, NTHREAD);
+  print_banner(BANNER);
+
+  // flush before fork to avoid duplicate buffered output in workers
+  fflush(stdout);
+
+  for(ithread=0; ithread < NTHREAD; ithread++ ) {
+    pid = fork();
+    if ( pid < 0 ) {
+      sprintf(c1err,"fork failed for ithread=%d", ithread );
+      sprintf(c2err,"NTHREAD=%d", NTHREAD );
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+    }
+    else if ( pid == 0 ) 
+      { return ithread ; }  // worker
+    PID_LIST[ithread] = pid ;
+  }
+
+  // - - - - - parent - - - - - 
+  for(ithread=0; ithread < NTHREAD; ithread++ ) {
+    pid = waitpid(PID_LIST[ithread], &wstatus, 0);
+    if ( pid < 0 || !WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0 ) {
+      printf(" ERROR: worker ithread=%d (pid=%d) failed\n", 
+	     ithread, (int)PID_LIST[ithread] );
+      NERR++ ;
+    }
+  }
+
+  if ( NERR > 0 ) {
+    sprintf(c1err,"%d of %d workers failed", NERR, NTHREAD);
+    sprintf(c2err,"Check worker output above.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  merge_snlc_workers(NTHREAD, TEXTFILE_PREFIX);
+
+  sprintf(BANNER,"%s: Done merging %d workers", fnam, NTHREAD );
+  print_banner(BANNER);
+  fflush(stdout);
+
+  exit(0);
+
+} // end fork_snlc_workers
+
+int fork_snlc_workers__(int *NTHREAD, char *TEXTFILE_PREFIX) 
+{ return fork_snlc_workers(*NTHREAD, TEXTFILE_PREFIX); }
+
+
+// ******************************************************
+void merge_snlc_workers(int NTHREAD, char *TEXTFILE_PREFIX) {
+
+  // Created Oct 2026
+  // Merge text-table output of fork_snlc_workers:
+  //   [PREFIX]_THREADnn.[SUFFIX] -> [PREFIX].[SUFFIX]
+  // + YAML: sum integer and float values over workers;
+  //         non-numeric values (SURVEY, FILTERS) from first worker.
+  // + other tables: first worker file is copied, then only
+  //         data rows (validRowKey_TEXT) are appended from others.
+  // gzipped files cannot be merged line by line and are left as is.
+  // Merged worker files are removed.
+
+  int   validRowKey_TEXT(char *string) ; // see sntools_output_text.c
+  char  PREFIX[MXPATHLEN], PREFIX_THREAD[MXPATHLEN+20];
+  char  wildcard[MXPATHLEN+40], SUFFIX[MXPATHLEN];
+  char  fileName_out[2*MXPATHLEN], fileName_in[2*MXPATHLEN];
+  char  LINE[MXPATHLEN*4], ROWKEY[40] ;
+  int   NFILE, ifile, ithread, NMERGE=0 ;
+  FILE  *FP_OUT, *FP_IN ;
+  glob_t globbuf;
+  char  fnam[] = "merge_snlc_workers" ;
+
+  // ----------- BEGIN ------------
+
+  sprintf(PREFIX, "%s", TEXTFILE_PREFIX);
+  ENVreplace(PREFIX, fnam, 1);
+
+  sprintf(PREFIX_THREAD, "%s_%s00", PREFIX, SUFFIX_SNLC_THREAD);
+  sprintf(wildcard, "%s.*", PREFIX_THREAD);
+  glob(wildcard, 0, NULL, &globbuf);
+  NFILE = (int)globbuf.gl_pathc ;
+
+  for(ifile=0; ifile < NFILE; ifile++ ) {
+
+    sprintf(SUFFIX, "%s", globbuf.gl_pathv[ifile] + strlen(PREFIX_THREAD) );
+    if ( strstr(SUFFIX,".gz") != NULL ) {
+      printf("\t %s: cannot merge gzipped *%s -> leave worker files\n",
+	     fnam, SUFFIX); 
+      continue ;
+    }
+
+    sprintf(fileName_out, "%s%s", PREFIX, SUFFIX);
+    FP_OUT = fopen(fileName_out, "wt");
+    if ( !FP_OUT ) {
+      sprintf(c1err,"Cannot open merged file");
+      sprintf(c2err,"%s", fileName_out);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+    }
+
+    if ( strcmp(SUFFIX,".YAML") == 0 ) 
+      { merge_snlc_workers_YAML(NTHREAD, PREFIX, FP_OUT); }
+    else {
+      for(ithread=0; ithread < NTHREAD; ithread++ ) {
+	sprintf(fileName_in, "%s_%s%2.2d%s", 
+		PREFIX, SUFFIX_SNLC_THREAD, ithread, SUFFIX);
+	FP_IN = fopen(fileName_in, "rt");
+	if ( !FP_IN ) { continue; }
+	while ( fgets(LINE, sizeof(LINE), FP_IN) != NULL ) {
+	  if ( ithread > 0 ) {
+	    ROWKEY[0] = 0;  sscanf(LINE, "%39s", ROWKEY);
+	    if ( !validRowKey_TEXT(ROWKEY) ) { continue; }
+	  }
+	  fputs(LINE, FP_OUT);
+	}
+	fclose(FP_IN);
+      }
+    }
+
+    fclose(FP_OUT);
+    NMERGE++ ;
+    printf("\t Merged %d workers -> %s\n", NTHREAD, fileName_out);
+
+    for(ithread=0; ithread < NTHREAD; ithread++ ) {
+      sprintf(fileName_in, "%s_%s%2.2d%s", 
+	      PREFIX, SUFFIX_SNLC_THREAD, ithread, SUFFIX);
+      remove(fileName_in);
+    }
+  }
+
+  globfree(&globbuf);
+
+  if ( NMERGE == 0 ) {
+    printf("\t %s: WARNING found no worker files %s\n", fnam, wildcard);
+  }
+  fflush(stdout);
+
+  return ;
+
+} // end merge_snlc_workers
+
+// ******************************************************
+void merge_snlc_workers_YAML(int NTHREAD, char *PREFIX, FILE *FP_OUT) {
+
+  // Created Oct 2026
+  // Write merged YAML to FP_OUT from worker YAML files.
+  //  + event counters (NEVT*, ABORT_IF_ZERO) and stage timers 
+  //      (TIME_STAGE_*, NCALL_STAGE_*) -> sum over workers
+  //  + CPU_MINUTES -> max over workers (workers run in parallel)
+  //  + "  - MASK: N1 N2" list rows -> key is parent KEY/MASK; 
+  //       sum N1 and N2 over workers
+  //  + comments, non-numeric values (SURVEY, FILTERS) and other
+  //      numeric keys (e.g., IDSURVEY) -> first worker
+  // List rows that appear only in later workers are inserted 
+  // after the last row of the same parent key.
+
+#define MXLINE_YAML_MERGE 400
+#define MERGE_YAML_FIRST  0
+#define MERGE_YAML_SUM    1
+#define MERGE_YAML_MAX    2
+  int    NLINE = 0, iline, jline, ithread, NVAL, ival, NRD, MODE ;
+  int    NVAL_LIST[MXLINE_YAML_MERGE], MODE_LIST[MXLINE_YAML_MERGE];
+  bool   ISINT_LIST[MXLINE_YAML_MERGE];
+  double VAL_LIST[MXLINE_YAML_MERGE][2], VAL[2];
+  char   ID_LIST[MXLINE_YAML_MERGE][120], HEAD_LIST[MXLINE_YAML_MERGE][200];
+  char   fileName[2*MXPATHLEN], LINE[400], ID[120], HEAD[200];
+  char   KEY_PARENT[60], key[60], rest[300], *end, *ptr ;
+  bool   ISINT ;
+  FILE  *FP_IN ;
+  char   fnam[] = "merge_snlc_workers_YAML" ;
+
+  // ----------- BEGIN ------------
+
+  for(ithread=0; ithread < NTHREAD; ithread++ ) {
+    sprintf(fileName, "%s_%s%2.2d.YAML", PREFIX, SUFFIX_SNLC_THREAD, ithread);
+    FP_IN = fopen(fileName, "rt");
+    if ( !FP_IN ) { continue; }
+    KEY_PARENT[0] = 0 ;
+
+    while ( fgets(LINE, sizeof(LINE), FP_IN) != NULL ) {
+      if ( (ptr=strchr(LINE,'\n')) != NULL ) { *ptr = 0; }
+      NVAL = 0;  ISINT = true ;  ID[0] = 0 ;  MODE = MERGE_YAML_FIRST ;
+      snprintf(HEAD, sizeof(HEAD), "%s", LINE);
+
+      key[0] = rest[0] = 0;
+      NRD = sscanf(LINE, "%59s %299[^\n]", key, rest);
+      ptr = strchr(LINE,':');
+
+      if ( NRD >= 1 && key[0] != '#' && ptr != NULL ) {
+	if ( strcmp(key,"-") == 0 ) {
+	  // list row below KEY_PARENT
+	  snprintf(HEAD, sizeof(HEAD), "%.*s", (int)(ptr-LINE+1), LINE);
+	  sscanf(rest, "%59[^:]", key);
+	  snprintf(ID, sizeof(ID), "%s/%s", KEY_PARENT, key);
+	  ptr++ ;
+	  MODE = MERGE_YAML_SUM ;
+	}
+	else {
+	  snprintf(KEY_PARENT, sizeof(KEY_PARENT), "%s", key);
+	  snprintf(ID,   sizeof(ID),   "%s", key);
+	  snprintf(HEAD, sizeof(HEAD), "%-17s", key);
+	  ptr = rest ;
+	  if ( strncmp(key,"NEVT",4)           == 0 || 
+	       strncmp(key,"TIME_STAGE_",11)   == 0 ||
+	       strncmp(key,"NCALL_STAGE_",12)  == 0 ||
+	       strcmp (key,"ABORT_IF_ZERO:")   == 0 ) 
+	    { MODE = MERGE_YAML_SUM ; }
+	  else if ( strcmp(key,"CPU_MINUTES:") == 0 )
+	    { MODE = MERGE_YAML_MAX ; }
+	}
+	// read up to 2 numeric values; otherwise treat as text
+	while ( NVAL < 2 ) {
+	  VAL[NVAL] = strtod(ptr, &end);
+	  if ( end == ptr ) { break; }
+	  for(; ptr < end; ptr++ ) { if ( *ptr == '.' ) { ISINT = false; } }
+	  NVAL++ ;
+	}
+	while ( *ptr == ' ' ) { ptr++ ; }
+	if ( *ptr != 0 && *ptr != '#' ) { NVAL = 0; }   // non-numeric
+	if ( NVAL == 0 ) { snprintf(HEAD, sizeof(HEAD), "%s", LINE); }
+      }
+
+      // find existing line with same ID
+      jline = -1;
+      if ( ID[0] != 0 ) {
+	for(iline=0; iline < NLINE; iline++ ) 
+	  { if ( strcmp(ID_LIST[iline],ID) == 0 ) { jline = iline; break; } }
+      }
+
+      if ( jline >= 0 ) {
+	for(ival=0; ival < NVAL && ival < NVAL_LIST[jline]; ival++ ) {
+	  if ( MODE_LIST[jline] == MERGE_YAML_SUM ) 
+	    { VAL_LIST[jline][ival] += VAL[ival]; }
+	  else if ( MODE_LIST[jline] == MERGE_YAML_MAX && 
+		    VAL[ival] > VAL_LIST[jline][ival] ) 
+	    { VAL_LIST[jline][ival] = VAL[ival]; }
+	}
+	continue ;
+      }
+
+      // new line: only first worker contributes comments, text 
+      // and values that are not merged
+      if ( ithread > 0 && (NVAL == 0 || MODE == MERGE_YAML_FIRST) ) 
+	{ continue; }
+      if ( NLINE >= MXLINE_YAML_MERGE ) {
+	sprintf(c1err,"NLINE exceeds MXLINE_YAML_MERGE=%d", MXLINE_YAML_MERGE);
+	sprintf(c2err,"Check %s", fileName);
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+      }
+
+      // insert after last line with same parent (later workers)
+      jline = NLINE;
+      if ( ithread > 0 ) {
+	for(iline=0; iline < NLINE; iline++ ) {
+	  if ( strncmp(ID_LIST[iline], KEY_PARENT, strlen(KEY_PARENT))==0 ) 
+	    { jline = iline+1; }
+	}
+	for(iline=NLINE; iline > jline; iline-- ) {
+	  sprintf(ID_LIST[iline],   "%s", ID_LIST[iline-1]);
+	  sprintf(HEAD_LIST[iline], "%s", HEAD_LIST[iline-1]);
+	  NVAL_LIST[iline]  = NVAL_LIST[iline-1];
+	  MODE_LIST[iline]  = MODE_LIST[iline-1];
+	  ISINT_LIST[iline] = ISINT_LIST[iline-1];
+	  VAL_LIST[iline][0] = VAL_LIST[iline-1][0];
+	  VAL_LIST[iline][1] = VAL_LIST[iline-1][1];
+	}
+      }
+
+      sprintf(ID_LIST[jline],   "%s", ID);
+      sprintf(HEAD_LIST[jline], "%s", HEAD);
+      NVAL_LIST[jline]  = NVAL ;
+      MODE_LIST[jline]  = MODE ;
+      ISINT_LIST[jline] = ISINT ;
+      for(ival=0; ival < NVAL; ival++ ) { VAL_LIST[jline][ival] = VAL[ival]; }
+      NLINE++ ;
+    }
+    fclose(FP_IN);
+  }
+
+  for(iline=0; iline < NLINE; iline++ ) {
+    fprintf(FP_OUT, "%s", HEAD_LIST[iline]);
+    for(ival=0; ival < NVAL_LIST[iline]; ival++ ) {
+      if ( ISINT_LIST[iline] ) 
+	{ fprintf(FP_OUT, " %10lld", (long long)VAL_LIST[iline][ival]); }
+      else
+	{ fprintf(FP_OUT, " %8.2f", VAL_LIST[iline][ival]); }
+    }
+    fprintf(FP_OUT, "\n");
+  }
+
+  return ;
+
+} // end merge_snlc_workers_YAML
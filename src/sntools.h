@@ -40,6 +40,22 @@
 //    This flag is to isolate code for future removal.
 //#define USE_KCOR_FORTRAN
 
+// Oct 15 2026: ATTR_TARGET_CLONES on a function definition builds
+//   AVX-512, AVX2 and default (-m64 baseline) versions of the function;
+//   the version is selected once at program load from the CPU features
+//   (gcc ifunc), so one binary runs on all x86 nodes. FMA is not 
+//   enabled in the clones, and -O2 does not reassociate FP sums, so 
+//   results are identical on every node. Applied only to hot numeric
+//   loops. Build with -DNO_TARGET_CLONES to disable.
+//   (aarch64: NEON is in the baseline, so no clones are needed.)
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 6) && \
+  defined(__x86_64__) && defined(__linux__) && !defined(NO_TARGET_CLONES)
+#define ATTR_TARGET_CLONES \
+  __attribute__((target_clones("avx512f","avx2","default")))
+#else
+#define ATTR_TARGET_CLONES
+#endif
+
 #define KEYNAME_DOCANA_REQUIRED   "DOCUMENTATION:"
 #define KEYNAME2_DOCANA_REQUIRED  "DOCUMENTATION_END:"
 #define OPENMASK_VERBOSE        1  // see snana_openTextFile
@@ -213,6 +229,15 @@ struct {
   struct random_data  ranStream[MXSTREAM_RAN];
   char stateBuf[MXSTREAM_RAN][BUFSIZE_RAN];
 
+  // Oct 2026: optional counter-based generator (Philox4x32-10) so that
+  // randoms for each event depend only on (ISEED, event index, retry),
+  // and not on the number of prior events or on how NGEN is split.
+  bool          USE_COUNTER ;
+  unsigned int  COUNTER_KEY[2];                 // from ISEED
+  unsigned int  COUNTER_EVENT, COUNTER_RETRY ;  // set per event
+  unsigned int  COUNTER_NCALL[MXSTREAM_RAN];    // draws per stream & event
+  unsigned int  COUNTER_OUT[MXSTREAM_RAN][4];   // last Philox block
+
   // wrap-around stats for how often each random is re-used.
   int    NCALL_fill_RANSTATs;
   double NWRAP_MIN[MXLIST_RAN+1] ;
@@ -225,6 +250,30 @@ struct {
 
 } GENRAN_INFO ;
 
+// Oct 2026: optional per-stage random blocks (RANSTAGE). Each stage
+// draws from its own Philox substream keyed on (ISEED, EVENT, RETRY, 
+// stage), so that the number of randoms used by one stage (e.g., an
+// extra trigger option) does not shift randoms for any other stage.
+// Randoms are generated a block at a time and handed out as slices.
+#define ISTAGE_RAN_HOST     0
+#define ISTAGE_RAN_POP      1
+#define ISTAGE_RAN_SMEAR    2
+#define ISTAGE_RAN_NOISE    3
+#define ISTAGE_RAN_TRIGGER  4
+#define MXSTAGE_RAN         5
+#define ITYPE_RAN_FLAT      0
+#define ITYPE_RAN_GAUSS     1
+#define MXBLOCK_RAN       256   // randoms per stage block (multiple of 4)
+
+struct {
+  bool          USE ;
+  unsigned int  KEY[2];                    // from ISEED
+  unsigned int  EVENT, RETRY ;             // set per event
+  unsigned int  NBLOCK[MXSTAGE_RAN][2];    // blocks filled this event
+  int           NUSED[MXSTAGE_RAN][2];     // randoms used in current block
+  double        BLOCK[MXSTAGE_RAN][2][MXBLOCK_RAN] ;
+} RANSTAGE_INFO ;
+
 
 // errsmsg parameters
 char c1err[200];   // for kcorerr utility
@@ -325,6 +374,10 @@ typedef struct {
   double *COVMAT1D ;   // user-input COV matrix
   double **CHOLESKY2D; // Cholesky decomp matrix used to get correlated ran
   //  gsl_matrix_view chk; // internal matrix
+
+  // Oct 2026: packed lower-triangle (transpose of CHOLESKY2D) so that
+  // each correlated random is a contiguous dot product.
+  double *LOWER1D ;    // size = MATSIZE*(MATSIZE+1)/2
 } CHOLESKY_DECOMP_DEF ;
 
 
@@ -360,6 +413,7 @@ struct {
 #define MSKOPT_PARSE_WORDS_IGNORECOMMA    4  // parse blank space; ignore comma
 #define MSKOPT_PARSE_WORDS_IGNORECOMMENT  8  // ignore after comment char
 #define MSKOPT_PARSE_WORDS_FIRSTLINE     16  // read only 1st line only
+#define MSKOPT_PARSE_WORDS_VIEW          32  // no word copy (file only)
 #define LANGFLAG_PARSE_WORDS_C  0  // PARSE_WORDS language flag for C
 
 struct {
@@ -368,6 +422,14 @@ struct {
   int   NWD;
   char **WDLIST;
   bool  DEBUG_FLAG;
+
+  // Oct 2026: for VIEW option, WDLIST points to VIEW_WDLIST whose
+  // words are null-terminated in place in the retained file buffer
+  // VIEW_BUF; malloced word copies are saved in WDLIST_COPY.
+  bool  VIEW ;
+  char **WDLIST_COPY ;
+  char **VIEW_WDLIST ;  int VIEW_MXWD ;
+  char  *VIEW_BUF ;     long VIEW_MXBUF ;
 } PARSE_WORDS ;
 
 
@@ -394,7 +456,7 @@ struct {
 } STRING_UNIQUE ;
 
 struct {
-  int     LAST_NOBS ;  // to know when a new malloc is needed.
+  int     LAST_NOBS ;  // allocated size; to know when realloc is needed.
   double *TLIST_SORTED, *MAGLIST_SORTED, *FLUXLIST_SORTED ;
   int    *INDEX_SORT;
 } LCWIDTH ;
@@ -411,6 +473,14 @@ struct {
   double MJDWIN ;
 } INPUTS_OBS_atFLUXMAX ;
 
+// work arrays for get_obs_atFLUXMAX; grow-only (Oct 2026)
+struct {
+  int    NOBS_ALLOC, NWIN_ALLOC ;
+  int    *INDEX_SORT ;
+  int    *NSNRCUT, *oMIN_SNRCUT, *oMAX_SNRCUT ;
+  double *WGT_SNRCUT ;
+} OBS_atFLUXMAX_WORK ;
+
 
 #define MXFILE_ENVreplace 100
 struct {
@@ -475,6 +545,8 @@ void catVarList_with_sep(char *varList, char *addVarName, char *sep);
 void init_Cholesky(int OPT, CHOLESKY_DECOMP_DEF *DECOMP ) ;
 void getRan_GaussCorr(CHOLESKY_DECOMP_DEF *DECOMP,
 		      double *RanList_noCorr, double *RanList_corr);
+void getRan_GaussCorr_block(CHOLESKY_DECOMP_DEF *DECOMP, int NVEC,
+			    double *RanList_noCorr, double *RanList_corr);
 
 void INIT_SNANA_DUMP(char *STRING);
 int  CHECK_SNANA_DUMP(char *FUNNAME, char *CCID, char *BAND, double MJD );
@@ -557,8 +629,15 @@ void update_covMatrix(char *name, int OPTMASK, int MATSIZE,
 void update_covmatrix__(char *name, int *OPTMASK, int *MATSIZE,
 			double (*covMat)[*MATSIZE], double *EIGMIN,
 			int *istat_cov ) ;
+int  eigval_sym3x3(double (*A)[3], double *eigval);
 
 int  store_PARSE_WORDS(int OPT, char *FILENAME, char *callFun);
+int  store_PARSE_WORDS_BUFFER(int OPT, char *NAME, char *BUFFER, char *callFun);
+void store_PARSE_WORDS_LINE(char *LINE, char *sepKey, bool IGNORE_COMMENTS);
+int  store_PARSE_WORDS_VIEW(int OPT, char *FILENAME, char *BUFFER, char *callFun);
+void set_PARSE_WORDS_VIEW(bool VIEW);
+void end_PARSE_WORDS(int NWD, char *FILENAME, char *fnam);
+char *get_PARSE_WORD_PTR(int iwd, char *callFun);
 void malloc_PARSE_WORDS(int NWD);
 void get_PARSE_WORD(int langFlag, int iwd, char *word, char *callFun );
 void get_PARSE_WORD_INT(int langFlag, int iwd, int   *i_val, char *callFun );
@@ -664,6 +743,8 @@ void  dumpUniqueKey(char *key) ;
 int   ivar_matchList(char *varName, int NVAR, char **varList);
 int   match_cid_hash(char *cid, int ilist, int isn);
 int   match_cid_hash__(char *cid, int *ilist, int *isn);
+int   match_cid_hash_load(int NCID, char **cid_list, int isn_offset);
+int   match_cid_hash_list(int NCID, char **cid_list, int *isn_list);
 
 void read_VARNAMES_KEYS(FILE *fp, int MXVAR, int NVAR_SKIP, char *callFun,
 			int *NVAR, int *NKEY, int *UNIQUE, char **VARNAMES );
@@ -801,12 +882,23 @@ double prob_chi2ndof__(double *chi2, int *Ndof);
 float edgedist(float XPIX, float YPIX,  int NXPIX, int NYPIX);
 
 void print_banner ( const char *banner ) ;
+
+// Oct 2026: fork workers for snana.exe/snlc_fit.exe (NTHREAD key)
+#define MXTHREAD_SNLC       64
+#define SUFFIX_SNLC_THREAD  "THREAD"
+int  fork_snlc_workers(int NTHREAD, char *TEXTFILE_PREFIX);
+int  fork_snlc_workers__(int *NTHREAD, char *TEXTFILE_PREFIX);
+void merge_snlc_workers(int NTHREAD, char *TEXTFILE_PREFIX);
+void merge_snlc_workers_YAML(int NTHREAD, char *PREFIX, FILE *FP_OUT);
 void fprint_banner (FILE *FP, const char *banner ) ;
 
 // shells to open text file
 void find_pathfile(char *fileName, char *PATH_LIST, char *FILENAME, char *callFun);
 
 FILE *open_TEXTgz(char *FILENAME, const char *mode, int OPTMASK, int *GZIPFLAG, char *fnam) ;
+void get_CMD_GUNZIP(char *gzipFile, char *CMD_GUNZIP);
+bool find_in_PATH(char *prog);
+bool is_BGZF(char *gzipFile);
 FILE *snana_openTextFile (int OPTMASK, char *PATH_LIST, char *fileName,
 			  char *fullName, int *gzipFlag );
 void snana_rewind(FILE *fp, char *FILENAME, int GZIPFLAG);
@@ -856,6 +948,17 @@ double host_confusion__(char *CID, int *N_DDLR, double *DDLR_LIST_SORTED);
 // random-number generators.
 // May 2014: snran1 -> Flatran1,  float rangen -> double FlatRan
 void   init_random_seed(int ISEED, int NSTREAM);
+void   init_random_counter(int ISEED);
+void   set_random_event(int EVENT, int RETRY);
+void   philox4x32_10(unsigned int *ctr, unsigned int *key, unsigned int *out);
+double getRan_Flat1_counter(int istream);
+void   init_random_stage(int ISEED);
+void   fill_RANSTAGE(int ISTAGE, int ITYPE);
+double *getRan_slice_stage(int ISTAGE, int ITYPE, int NRAN);
+double getRan_Flat1_stage(int ISTAGE, int ilist);
+double getRan_Gauss_stage(int ISTAGE, int ilist);
+double getRan_GaussClip_stage(int ISTAGE, int ilist, 
+			      double ranGmin, double ranGmax);
 void   fill_RANLISTs(void);
 void   sumstat_RANLISTs(int FLAG);
 
@@ -924,6 +1027,14 @@ void   init_lightCurveWidth(void);
 double get_lightCurveWidth(int OPTMASK, int NOBS, double *TLIST,
 			   double *MAGLIST, int *ERRFLAG, char *FUNCALL ) ;
 
+double get_lightCurveWidth_sorted(int OPTMASK, int NOBS, double *TLIST, 
+				  double *MAGLIST, double *FLUX_SCRATCH,
+				  int *ERRFLAG, char *FUNCALL);
+void   get_lightCurveWidth_bands(int OPTMASK, int NOBS, double *TLIST, 
+				 double *MAGLIST, int *IFILTLIST, bool SORTED,
+				 double *SCRATCH, int *ISCRATCH, 
+				 double *WIDTH, char *FUNCALL);
+
 void   init_lightcurvewidth__(void);
 double get_lightcurvewidth__(int *OPTMASK, int *NOBS, double *TLIST,
 			   double *MAGLIST, int *ERRFLAG, char *FUNCALL ) ;
@@ -931,6 +1042,13 @@ double get_lightcurvewidth__(int *OPTMASK, int *NOBS, double *TLIST,
 void init_obs_atFLUXMAX(int OPTMASK, double *PARLIST, int VBOSE);
 void get_obs_atFLUXMAX(char *CCID, int NOBS, float *FLUX, float *FLUXERR,
 		       double *MJD, int *IFILTOBS, int *EP_atFLUXMAX);
+void get_obs_atFLUXMAX_sorted(char *CCID, int NOBS, float *FLUX, 
+			      float *FLUXERR, double *MJD, int *IFILTOBS,
+			      int *EP_atFLUXMAX);
+void get_obs_atFLUXMAX_work(char *CCID, int NOBS, float *FLUX, 
+			    float *FLUXERR, double *MJD, int *IFILTOBS,
+			    int *INDEX_SORT, int *EP_atFLUXMAX);
+bool isSorted_double(int N, double *ARRAY);
 
 void init_obs_atfluxmax__(int *OPTMASK, double *PARLIST, int *VBOSE);
 
@@ -964,4 +1082,28 @@ float malloc_shortint2D(int opt, int LEN1, int LEN2,
 float malloc_shortint4D(int opt, int LEN1, int LEN2, int LEN3, int LEN4,
 			short int *****array4D );
 
+// Oct 2026: bump arena for short-lived (per-event) scratch arrays.
+// arena_alloc returns 16-byte aligned memory that is never freed
+// individually (arena_rewind can pop back to an arena_mark for
+// scratch used inside iterations); arena_reset recycles all, and
+// consolidates into one block sized for the peak usage so that
+// steady-state events do not call malloc at all.
+#define MXBLOCK_ARENA      32
+#define NBYTE_ARENA_MIN    65536
+#define NBYTE_ARENA_ALIGN  16
+typedef struct {
+  int    NBLOCK ;                 // number of allocated blocks
+  char   *BLOCK[MXBLOCK_ARENA] ;  // memory blocks
+  size_t SIZE[MXBLOCK_ARENA] ;    // size of each block
+  size_t USED ;                   // bytes used in last block
+  size_t NBYTE_TOT ;              // bytes handed out since reset
+  size_t NBYTE_PEAK ;             // max NBYTE_TOT over all resets
+} ARENA_DEF ;
+
+void *arena_alloc(ARENA_DEF *ARENA, size_t NBYTE);
+void  arena_reset(ARENA_DEF *ARENA);
+size_t arena_mark(ARENA_DEF *ARENA);
+void  arena_rewind(ARENA_DEF *ARENA, size_t MARK);
+void  arena_free(ARENA_DEF *ARENA);
+
 // ============== END OF FILE =============
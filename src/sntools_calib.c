@@ -32,8 +32,27 @@
   The maps are prepared in a set of "prepare_kcor_table_XXX" functions, 
   and they are evaluated in a set of "eval_kcor_table_XXX functions. 
 
+  Oct 14 2026: 
+    If $SNANA_KCOR_CACHE_DIR is set, prepared KCOR tables are written
+    to a binary cache file named by a hash of the calib-file contents and
+    options. Subsequent jobs mmap the cache file instead of re-computing
+    LCMAG, MWXT, AVWARP and KCOR tables. See PREPARE_KCOR_TABLES.
+
+  Oct 15 2026:
+    Read optional ZP(SEDMODEL) column from ZPoff table; see
+    get_calib_ZP_SEDMODEL().
+
+  Oct 14 2026:
+    New eval_kcor_table_XXX_batch functions evaluate many epochs
+    that share z and filter(s) with one call; see interp_GRIDMAP_batch.
+
 ***************************************************/
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
 #include "fitsio.h"
 #include "sntools.h"
 #include "sntools_data.h"
@@ -231,6 +250,7 @@ void  read_calib_open(void) {
   }
 
   printf("  Opened %s\n", kcorFile); fflush(stdout);
+  sprintf(CALIB_INFO.FILENAME_OPEN, "%s", kcorFile);
 
   return ;
 
@@ -546,6 +566,8 @@ void read_calib_zpoff(void) {
   int ICOL_PRIMARY_MAG        = 3 ;
   int ICOL_PRIMARY_ZPOFF_SYN  = 4 ;
   int ICOL_PRIMARY_ZPOFF_FILE = 5 ;
+  int ICOL_ZP_SEDMODEL        = 6 ; // optional, Oct 2026
+  int NCOL ;
 
   long FIRSTROW, NROW, FIRSTELEM = 1;
   
@@ -603,6 +625,20 @@ void read_calib_zpoff(void) {
 		    NULL_1D, CALIB_INFO.PRIMARY_ZPOFF_FILE, &anynul, &istat );  
   snfitsio_errorCheck("Read PRIMARY_ZPOFF_FILE", istat);
 
+  // read optional zeropoint computed by kcor.exe in the convention
+  // of SED models (genmag_SEDtools); older calib files don't have it.
+  fits_get_num_cols(FP, &NCOL, &istat);
+  snfitsio_errorCheck("get_num_cols for ZPOFF table", istat);
+  if ( NCOL >= ICOL_ZP_SEDMODEL ) {
+    fits_read_col_dbl(FP, ICOL_ZP_SEDMODEL, FIRSTROW, FIRSTELEM, NROW,
+		      NULL_1D, CALIB_INFO.PRIMARY_ZP_SEDMODEL, &anynul, &istat);
+    snfitsio_errorCheck("Read ZP_SEDMODEL", istat);
+  }
+  else {
+    for(ifilt=0; ifilt < NFILTDEF; ifilt++ ) 
+      { CALIB_INFO.PRIMARY_ZP_SEDMODEL[ifilt] = -99.0 ; }
+  }
+
   if ( KCOR_VERBOSE_FLAG  ) {
     printf("\n");
     printf(" xxx  %s DUMP: \n", fnam);
@@ -1024,6 +1060,14 @@ void addFilter_kcor(int ifiltdef, char *FILTER_NAME, FILTERCAL_DEF *MAP){
   MAP->PRIMARY_ZPOFF_FILE[NF] = 
     CALIB_INFO.PRIMARY_ZPOFF_FILE[kfilt];
 
+  // ZP(SEDMODEL) includes primary mag, so apply same shift
+  if ( CALIB_INFO.PRIMARY_ZP_SEDMODEL[kfilt] > 0.0 ) {
+    MAP->ZP_SEDMODEL[NF] = 
+      CALIB_INFO.PRIMARY_ZP_SEDMODEL[kfilt] + ptr_SHIFT[ifiltdef] ;
+  }
+  else
+    { MAP->ZP_SEDMODEL[NF] = -99.0 ; }
+
   return ;
 
 } // end  addFilter_kcor
@@ -2385,6 +2429,36 @@ double get_calib_zpoff_file__(int *OPT_FRAME, int *ifiltdef)
 { return get_calib_zpoff_file(*OPT_FRAME, *ifiltdef); }
 
 
+double get_calib_ZP_SEDMODEL(int OPT_FRAME, int ifiltdef) {
+
+  // Created Oct 2026
+  // Return zeropoint computed by kcor.exe in the convention of
+  // init_filter_SEDMODEL (genmag_SEDtools.c), including user shift
+  // of primary mag. Returns -99 for older calib files without
+  // the ZP(SEDMODEL) column.
+
+  FILTERCAL_DEF *FILTERCAL;
+  char fnam[] = "get_calib_ZP_SEDMODEL" ;
+
+  // ----------- BEGIN -------------
+  if ( OPT_FRAME == OPT_FRAME_REST ) 
+    { FILTERCAL = &CALIB_INFO.FILTERCAL_REST; }
+  else if ( OPT_FRAME == OPT_FRAME_OBS ) 
+    { FILTERCAL = &CALIB_INFO.FILTERCAL_OBS; }
+  else 
+    { abort_calib_frame(OPT_FRAME, fnam);  }
+
+  int    ifilt = FILTERCAL->IFILTDEF_INV[ifiltdef];
+  if ( ifilt < 0 ) { return -99.0 ; }
+
+  return FILTERCAL->ZP_SEDMODEL[ifilt] ;
+
+} // end get_calib_ZP_SEDMODEL
+
+double get_calib_zp_sedmodel__(int *OPT_FRAME, int *ifiltdef)
+{ return get_calib_ZP_SEDMODEL(*OPT_FRAME, *ifiltdef); }
+
+
 void abort_calib_frame(int OPT_FRAME, char *callFun) {
   sprintf(c1err,"Invalid OPT_FRAME = %d", OPT_FRAME);
   sprintf(c2err,"Must be either OPT_FRAME_REST=%d or OPT_FRAME_OBS=%d",
@@ -2405,18 +2479,319 @@ void PREPARE_KCOR_TABLES(void) {
 
   // prepare multi-dimensional tables for fast kcor lookup.
   // Uses GRIDMAP utility.
+  //
+  // Oct 14 2026: if ENV_CACHE_KCOR_TABLE is set, check for cached
+  //   tables from previous job with same calib file and options;
+  //   if no cache exists, prepare tables and write cache.
+
+  char cacheFile[MXPATHLEN];
+  bool USE_CACHE;
   char fnam[] = "PREPARE_KCOR_TABLES";
 
   printf("\n %s\n", fnam );
+
+  USE_CACHE = get_kcor_table_cache_file(cacheFile);
+  if ( USE_CACHE && read_kcor_table_cache(cacheFile) ) { return; }
+
   prepare_kcor_table_LCMAG();
   prepare_kcor_table_MWXT();
   prepare_kcor_table_AVWARP();
   prepare_kcor_table_KCOR();
 
+  if ( USE_CACHE ) { write_kcor_table_cache(cacheFile); }
+
   return;
 
 } // end PREPARE_KCOR_TABLES
 
+// ==============================================
+bool get_kcor_table_cache_file(char *cacheFile) {
+
+  // Created Oct 2026
+  // If ENV_CACHE_KCOR_TABLE is defined, return true and load 
+  // cacheFile = [cacheDir]/KCOR_TABLE_[hash].bin 
+  // Otherwise return false (no cache).
+
+  char *cacheDir = getenv(ENV_CACHE_KCOR_TABLE);
+  unsigned long long hash ;
+
+  // ---------- BEGIN ----------
+
+  cacheFile[0] = 0 ;
+  if ( cacheDir == NULL    ) { return false; }
+  if ( strlen(cacheDir)==0 ) { return false; }
+
+  hash = hash_kcor_table_cache();
+  if ( hash == 0 ) { return false; }
+
+  sprintf(cacheFile, "%s/KCOR_TABLE_%016llx.bin", cacheDir, hash);
+  return true ;
+
+} // end get_kcor_table_cache_file
+
+// ==============================================
+unsigned long long hash_kcor_table_cache(void) {
+
+  // Created Oct 2026
+  // Return 64-bit FNV-1a hash of calib file contents, 
+  // and of options that affect the prepared tables.
+  // Return 0 if calib file cannot be read.
+
+  unsigned long long hash  = 14695981039346656037ULL ;
+  unsigned long long prime = 1099511628211ULL ;
+  unsigned char buf[65536];
+  size_t nread, i;
+  int    opt_list[4];
+  FILE  *fp;
+  char fnam[] = "hash_kcor_table_cache" ;
+
+#define HASH_BYTES_KCOR(ptr,n) {					\
+    const unsigned char *b = (const unsigned char*)(ptr); size_t j;	\
+    for(j=0; j < (size_t)(n); j++ ) { hash ^= b[j]; hash *= prime; } }
+
+  // ---------- BEGIN ----------
+
+  fp = fopen(CALIB_INFO.FILENAME_OPEN, "rb");
+  if ( fp == NULL ) {
+    printf("\t %s: WARNING cannot read %s -> no cache\n",
+	   fnam, CALIB_INFO.FILENAME_OPEN);
+    fflush(stdout);
+    return 0 ;
+  }
+
+  while ( (nread = fread(buf, 1, sizeof(buf), fp)) > 0 ) 
+    { for(i=0; i < nread; i++ ) { hash ^= buf[i]; hash *= prime; } }
+  fclose(fp);
+
+  opt_list[0] = VERSION_CACHE_KCOR_TABLE ;
+  opt_list[1] = OPT_EXTRAP_KCOR ;
+  opt_list[2] = (int)CALIB_OPTIONS.USE_AVWARPTABLE ;
+  opt_list[3] = (int)sizeof(double) ;
+  HASH_BYTES_KCOR(opt_list, sizeof(opt_list) );
+  HASH_BYTES_KCOR(CALIB_INFO.FILTERS_SURVEY, strlen(CALIB_INFO.FILTERS_SURVEY));
+  HASH_BYTES_KCOR(CALIB_INFO.MAGREST_SHIFT_PRIMARY, 
+		  sizeof(CALIB_INFO.MAGREST_SHIFT_PRIMARY) );
+  HASH_BYTES_KCOR(CALIB_INFO.MAGOBS_SHIFT_PRIMARY, 
+		  sizeof(CALIB_INFO.MAGOBS_SHIFT_PRIMARY) );
+
+  if ( hash == 0 ) { hash = 1; } // 0 is reserved for no-cache
+  return hash ;
+
+} // end hash_kcor_table_cache
+
+// ==============================================
+bool read_kcor_table_cache(char *cacheFile) {
+
+  // Created Oct 2026
+  // If cacheFile exists, mmap it and point KCOR_TABLE GRIDMAPs
+  // into the mapped memory. Return true on success; return false
+  // if cache does not exist or is invalid (then caller prepares tables).
+  // Mapped memory is read-only and is never unmapped.
+
+  GRIDMAP_DEF *GRIDMAP_LIST[NMAP_CACHE_KCOR_TABLE] = {
+    &KCOR_TABLE.GRIDMAP_LCMAG, &KCOR_TABLE.GRIDMAP_MWXT, 
+    &KCOR_TABLE.GRIDMAP_AVWARP, &KCOR_TABLE.GRIDMAP_KCOR } ;
+  struct stat st;
+  long long SIZE, OFFSET, *HEAD ;
+  char *MAPBUF ;
+  int   fd, imap;
+  char fnam[] = "read_kcor_table_cache" ;
+
+  // ---------- BEGIN ----------
+
+  fd = open(cacheFile, O_RDONLY);
+  if ( fd < 0 ) { return false; }
+
+  if ( fstat(fd, &st) != 0 ) { close(fd); return false; }
+  SIZE = (long long)st.st_size ;
+  if ( SIZE < 32 ) { close(fd); return false; }
+
+  MAPBUF = (char*)mmap(NULL, (size_t)SIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if ( MAPBUF == MAP_FAILED ) { return false; }
+
+  HEAD = (long long*)MAPBUF;
+  if ( memcmp(MAPBUF, MAGIC_CACHE_KCOR_TABLE, 8) != 0 ||
+       HEAD[1] != VERSION_CACHE_KCOR_TABLE ||
+       HEAD[3] != NMAP_CACHE_KCOR_TABLE ) {
+    printf("\t %s: WARNING invalid cache -> ignore\n", fnam);
+    fflush(stdout);
+    munmap(MAPBUF, (size_t)SIZE);
+    return false;
+  }
+
+  OFFSET = 4 * sizeof(long long);
+  for(imap=0; imap < NMAP_CACHE_KCOR_TABLE; imap++ ) {
+    OFFSET = map_gridmap_cache(MAPBUF, OFFSET, SIZE, GRIDMAP_LIST[imap]);
+    if ( OFFSET < 0 ) {
+      // corrupted/truncated cache; GRIDMAPs filled so far are 
+      // re-initialized by prepare functions.
+      printf("\t %s: WARNING truncated cache -> ignore\n", fnam);
+      fflush(stdout);
+      return false;
+    }
+  }
+
+  NERR_KCOR_AVWARP = 0 ;
+  printf("\t Load LCMAG, MWXT, AVWARP, KCOR tables from cache\n");
+  printf("\t   %s  (%.1f MB)\n", cacheFile, 1.0E-6*(double)SIZE );
+  fflush(stdout);
+
+  return true ;
+
+} // end read_kcor_table_cache
+
+// ==============================================
+long long map_gridmap_cache(char *MAPBUF, long long OFFSET, long long SIZE,
+			    GRIDMAP_DEF *gridmap) {
+
+  // Created Oct 2026
+  // Point *gridmap arrays into mmap'ed cache MAPBUF starting at OFFSET.
+  // Layout matches write_gridmap_cache. Returns offset of next map,
+  // or -1 if map extends beyond SIZE.
+  // Only FUNVAL pointer array is allocated here.
+
+  long long *HEAD = (long long*)(MAPBUF + OFFSET);
+  long long  NDIM, NFUN, NROW, NBYTE_D, NBYTE_I, NBYTE ;
+  double    *DPTR ;
+  int       *IPTR ;
+  int        ifun ;
+
+  // ---------- BEGIN ----------
+
+  if ( OFFSET + 6*(long long)sizeof(long long) > SIZE ) { return -1; }
+
+  NDIM = HEAD[1];  NFUN = HEAD[2];  NROW = HEAD[3];
+  NBYTE_D = sizeof(double) * ( 4*NDIM + 2*NFUN + NFUN*NROW );
+  NBYTE_I = sizeof(int)    * ( NDIM + NROW );
+  NBYTE_I = 8 * ((NBYTE_I+7)/8);   // pad to 8-byte boundary
+  NBYTE   = 6*sizeof(long long) + NBYTE_D + NBYTE_I ;
+  if ( NDIM < 1 || NFUN < 1 || NROW < 1 ) { return -1; }
+  if ( OFFSET + NBYTE > SIZE )            { return -1; }
+
+  gridmap->ID         = (int)HEAD[0] ;
+  gridmap->NDIM       = (int)NDIM ;
+  gridmap->NFUN       = (int)NFUN ;
+  gridmap->NROW       = (int)NROW ;
+  gridmap->OPT_EXTRAP = (int)HEAD[4] ;
+  gridmap->MEMORY     = 1.0E-6 * (float)NBYTE ;
+  gridmap->FUNVAL_DENSE = NULL ;
+  gridmap->FAST_INIT    = false ;
+  gridmap->CACHE_IROW   = NULL ;
+
+  DPTR = (double*)(MAPBUF + OFFSET + 6*sizeof(long long));
+  gridmap->VALMIN = DPTR;   DPTR += NDIM;
+  gridmap->VALMAX = DPTR;   DPTR += NDIM;
+  gridmap->VALBIN = DPTR;   DPTR += NDIM;
+  gridmap->RANGE  = DPTR;   DPTR += NDIM;
+  gridmap->FUNMIN = DPTR;   DPTR += NFUN;
+  gridmap->FUNMAX = DPTR;   DPTR += NFUN;
+  gridmap->FUNVAL = (double**)malloc(NFUN*sizeof(double*));
+  for(ifun=0; ifun < NFUN; ifun++ ) 
+    { gridmap->FUNVAL[ifun] = DPTR;  DPTR += NROW; }
+
+  IPTR = (int*)DPTR;
+  gridmap->NBIN   = IPTR;   IPTR += NDIM;
+  gridmap->INVMAP = IPTR;  
+
+  // index map is not stored; re-create it from NBIN
+  init_1DINDEX(gridmap->ID, gridmap->NDIM, gridmap->NBIN);
+
+  return OFFSET + NBYTE ;
+
+} // end map_gridmap_cache
+
+// ==============================================
+void write_kcor_table_cache(char *cacheFile) {
+
+  // Created Oct 2026
+  // Write prepared KCOR_TABLE GRIDMAPs to binary cacheFile.
+  // Write to temp file and rename so that concurrent jobs 
+  // never read a partial cache. Failure to write is not fatal.
+
+  GRIDMAP_DEF *GRIDMAP_LIST[NMAP_CACHE_KCOR_TABLE] = {
+    &KCOR_TABLE.GRIDMAP_LCMAG, &KCOR_TABLE.GRIDMAP_MWXT, 
+    &KCOR_TABLE.GRIDMAP_AVWARP, &KCOR_TABLE.GRIDMAP_KCOR } ;
+  long long HEAD[4];
+  char tmpFile[MXPATHLEN+40];
+  FILE *fp;
+  int  imap, istat;
+  char fnam[] = "write_kcor_table_cache" ;
+
+  // ---------- BEGIN ----------
+
+  sprintf(tmpFile, "%s.tmp%d", cacheFile, (int)getpid() );
+  fp = fopen(tmpFile, "wb");
+  if ( fp == NULL ) {
+    printf("\t %s: WARNING cannot write %s\n", fnam, tmpFile );
+    fflush(stdout);
+    return ;
+  }
+
+  memcpy(&HEAD[0], MAGIC_CACHE_KCOR_TABLE, 8);
+  HEAD[1] = VERSION_CACHE_KCOR_TABLE ;
+  HEAD[2] = 0 ;  // reserved
+  HEAD[3] = NMAP_CACHE_KCOR_TABLE ;
+  fwrite(HEAD, sizeof(long long), 4, fp);
+
+  for(imap=0; imap < NMAP_CACHE_KCOR_TABLE; imap++ ) 
+    { write_gridmap_cache(fp, GRIDMAP_LIST[imap]); }
+
+  istat = ferror(fp);
+  fclose(fp);
+
+  if ( istat != 0 || rename(tmpFile, cacheFile) != 0 ) {
+    printf("\t %s: WARNING failed to write %s\n", fnam, cacheFile);
+    fflush(stdout);
+    remove(tmpFile);
+    return ;
+  }
+
+  printf("\t Wrote KCOR table cache: %s\n", cacheFile);
+  fflush(stdout);
+
+  return ;
+
+} // end write_kcor_table_cache
+
+// ==============================================
+void write_gridmap_cache(FILE *fp, GRIDMAP_DEF *gridmap) {
+
+  // Created Oct 2026
+  // Write one GRIDMAP to binary cache; 
+  // doubles first, then ints padded to 8-byte boundary.
+
+  int  NDIM = gridmap->NDIM;
+  int  NFUN = gridmap->NFUN;
+  int  NROW = gridmap->NROW;
+  long long HEAD[6], NBYTE_I;
+  char PAD[8] = { 0,0,0,0,0,0,0,0 } ;
+  int  ifun;
+
+  // ---------- BEGIN ----------
+
+  HEAD[0] = gridmap->ID;   HEAD[1] = NDIM;   HEAD[2] = NFUN;
+  HEAD[3] = NROW;          HEAD[4] = gridmap->OPT_EXTRAP;   HEAD[5] = 0;
+  fwrite(HEAD, sizeof(long long), 6, fp);
+
+  fwrite(gridmap->VALMIN, sizeof(double), NDIM, fp);
+  fwrite(gridmap->VALMAX, sizeof(double), NDIM, fp);
+  fwrite(gridmap->VALBIN, sizeof(double), NDIM, fp);
+  fwrite(gridmap->RANGE,  sizeof(double), NDIM, fp);
+  fwrite(gridmap->FUNMIN, sizeof(double), NFUN, fp);
+  fwrite(gridmap->FUNMAX, sizeof(double), NFUN, fp);
+  for(ifun=0; ifun < NFUN; ifun++ ) 
+    { fwrite(gridmap->FUNVAL[ifun], sizeof(double), NROW, fp); }
+
+  fwrite(gridmap->NBIN,   sizeof(int), NDIM, fp);
+  fwrite(gridmap->INVMAP, sizeof(int), NROW, fp);
+  NBYTE_I = sizeof(int) * (NDIM + NROW);
+  if ( NBYTE_I % 8 ) { fwrite(PAD, 1, 8 - NBYTE_I%8, fp); }
+
+  return ;
+
+} // end write_gridmap_cache
+
 void prepare_kcor_table_LCMAG(void) {
 
   FILTERCAL_DEF *FILTERCAL_REST = &CALIB_INFO.FILTERCAL_REST ;
@@ -3332,6 +3707,48 @@ double eval_kcor_table_lcmag__(int *ifiltdef_rest, double *Trest,
   return eval_kcor_table_LCMAG(*ifiltdef_rest, *Trest, *z, *AVwarp);
 }
 
+// ==========================================================
+void eval_kcor_table_LCMAG_batch(int ifiltdef_rest, int NEP, double *Trest_list,
+				 double z, double AVwarp, double *LCMAG_list) {
+
+  // Created Oct 2026
+  // Batch version of eval_kcor_table_LCMAG for NEP epochs with 
+  // same filter, z and AVwarp. Output is LCMAG_list[0:NEP-1].
+
+  GRIDMAP_DEF   *KCOR_GRIDMAP = &KCOR_TABLE.GRIDMAP_LCMAG ;
+  FILTERCAL_DEF *FILTERCAL    = &CALIB_INFO.FILTERCAL_REST;
+  int            ifilt_r      = FILTERCAL->IFILTDEF_INV[ifiltdef_rest];
+  int           NFILTDEF_REST = FILTERCAL->NFILTDEF;
+  double GRIDVAL_LIST[4] ;
+  char fnam[] = "eval_kcor_table_LCMAG_batch" ;
+
+  // --------------- BEGIN ------------
+
+  if ( ifilt_r < 0 || ifilt_r >= NFILTDEF_REST ) {
+    sprintf(c1err,"Invalid sparse index ifilt_r=%d for ifiltdef_r=%d",
+	    ifilt_r, ifiltdef_rest);
+    sprintf(c2err,"Rest frame filter is not defined");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);    
+  }
+
+  GRIDVAL_LIST[0] = 0.0;  // Trest from Trest_list
+  GRIDVAL_LIST[1] = z;
+  GRIDVAL_LIST[2] = AVwarp ;
+  GRIDVAL_LIST[3] = (double)ifilt_r ;
+
+  interp_GRIDMAP_batch(KCOR_GRIDMAP, 0, NEP, GRIDVAL_LIST, Trest_list,
+		       LCMAG_list);
+  return ;
+
+} // end eval_kcor_table_LCMAG_batch
+
+void eval_kcor_table_lcmag_batch__(int *ifiltdef_rest, int *NEP, 
+				   double *Trest_list, double *z, 
+				   double *AVwarp, double *LCMAG_list) {
+  eval_kcor_table_LCMAG_batch(*ifiltdef_rest, *NEP, Trest_list, *z, *AVwarp,
+			      LCMAG_list);
+}
+
 double eval_kcor_table_MWXT(int ifiltdef_obs, double Trest, double z, double AVwarp,
                      double MWEBV, double RV, int OPT_MWCOLORLAW) {
 
@@ -3378,6 +3795,54 @@ double eval_kcor_table_mwxt__(int *ifiltdef_obs, double *Trest,
 			      *MWEBV, *RV, *OPT_MWCOLORLAW);
 }
 
+// ==========================================================
+void eval_kcor_table_MWXT_batch(int ifiltdef_obs, int NEP, double *Trest_list,
+				double z, double AVwarp, double MWEBV, double RV,
+				int OPT_MWCOLORLAW, double *MWXT_list) {
+
+  // Created Oct 2026
+  // Batch version of eval_kcor_table_MWXT for NEP epochs with
+  // same obs-frame filter, z, AVwarp and MWEBV.
+
+  GRIDMAP_DEF   *KCOR_GRIDMAP = &KCOR_TABLE.GRIDMAP_MWXT ;
+  FILTERCAL_DEF *FILTERCAL    = &CALIB_INFO.FILTERCAL_OBS;
+  int            ifilt_o      = FILTERCAL->IFILTDEF_INV[ifiltdef_obs];
+  int            NFILTDEF_OBS = FILTERCAL->NFILTDEF;
+  int    ep ;
+  double GRIDVAL_LIST[4] ;
+  char fnam[] = "eval_kcor_table_MWXT_batch";
+
+  // --------------- BEGIN ------------
+
+  if ( ifilt_o < 0 || ifilt_o >= NFILTDEF_OBS ) {
+    sprintf(c1err,"Invalid sparse index ifilt_o=%d for ifiltdef_obs=%d",
+	    ifilt_o, ifiltdef_obs);
+    sprintf(c2err,"Obs frame filter is not defined");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);    
+  }
+
+  GRIDVAL_LIST[0] = 0.0;  // Trest from Trest_list
+  GRIDVAL_LIST[1] = z;
+  GRIDVAL_LIST[2] = AVwarp;
+  GRIDVAL_LIST[3] = (double)ifilt_o ;
+
+  interp_GRIDMAP_batch(KCOR_GRIDMAP, 0, NEP, GRIDVAL_LIST, Trest_list,
+		       MWXT_list);
+
+  for(ep=0; ep < NEP; ep++ ) { MWXT_list[ep] *= MWEBV; }
+
+  return ;
+
+} // end eval_kcor_table_MWXT_batch
+
+void eval_kcor_table_mwxt_batch__(int *ifiltdef_obs, int *NEP, 
+				  double *Trest_list, double *z, double *AVwarp,
+				  double *MWEBV, double *RV, int *OPT_MWCOLORLAW,
+				  double *MWXT_list) {
+  eval_kcor_table_MWXT_batch(*ifiltdef_obs, *NEP, Trest_list, *z, *AVwarp,
+			     *MWEBV, *RV, *OPT_MWCOLORLAW, MWXT_list);
+}
+
 // ==========================================================
 double eval_kcor_table_AVWARP(int ifiltdef_a, int ifiltdef_b, 
 			      double mag_a, double mag_b, 
@@ -3439,6 +3904,63 @@ double eval_kcor_table_avwarp__(int *ifiltdef_a, int *ifiltdef_b,
 				*Trest, istat);
 }
 
+// ==========================================================
+void eval_kcor_table_AVWARP_batch(int ifiltdef_a, int ifiltdef_b, int NEP,
+				  double *mag_a_list, double *mag_b_list, 
+				  double *Trest_list, double *AVwarp_list,
+				  int *istat_list ) {
+
+  // Created Oct 2026
+  // Batch version of eval_kcor_table_AVWARP for NEP epochs with
+  // same pair of rest-frame filters. Since both Trest and color 
+  // vary per epoch, only the filter lookups and range checks are 
+  // shared; each epoch is interpolated along color with 
+  // interp_GRIDMAP_batch (dense table, no INVMAP lookup).
+
+  GRIDMAP_DEF  *KCOR_GRIDMAP = &KCOR_TABLE.GRIDMAP_AVWARP ;
+  KCOR_BININFO_DEF *BININFO_AV = &CALIB_INFO.BININFO_AV;
+  int ifilt_a   = CALIB_INFO.FILTERCAL_REST.IFILTDEF_INV[ifiltdef_a];
+  int ifilt_b   = CALIB_INFO.FILTERCAL_REST.IFILTDEF_INV[ifiltdef_b];
+  double AVMIN  = BININFO_AV->RANGE[0];
+  double AVMAX  = BININFO_AV->RANGE[1];
+  double C, AVwarp, GRIDVAL_LIST[4];
+  int    ep ;
+
+  // -------------- BEGIN ------------
+
+  GRIDVAL_LIST[2] = (double)ifilt_b ;
+  GRIDVAL_LIST[3] = (double)ifilt_a ;
+
+  for(ep=0; ep < NEP; ep++ ) {
+    istat_list[ep]  = 0;
+    AVwarp_list[ep] = 0.0 ;
+
+    // skip crazy values as in eval_kcor_table_AVWARP
+    if ( mag_a_list[ep] >  40.0 || mag_b_list[ep] >  40.0 ) { continue; }
+    if ( Trest_list[ep] < -19.0 || Trest_list[ep] > 200.0 ) { continue; }
+
+    C = mag_a_list[ep] - mag_b_list[ep] ;
+    GRIDVAL_LIST[0] = Trest_list[ep] ;
+    interp_GRIDMAP_batch(KCOR_GRIDMAP, 1, 1, GRIDVAL_LIST, &C, &AVwarp);
+
+    if ( AVwarp <= (AVMIN+1.0E-6) ) { AVwarp = AVMIN;  istat_list[ep] = -1; }
+    if ( AVwarp >= (AVMAX-1.0E-6) ) { AVwarp = AVMAX;  istat_list[ep] = +1; }
+    AVwarp_list[ep] = AVwarp;
+  }
+
+  return ;
+
+} // end eval_kcor_table_AVWARP_batch
+
+void eval_kcor_table_avwarp_batch__(int *ifiltdef_a, int *ifiltdef_b, int *NEP,
+				    double *mag_a_list, double *mag_b_list,
+				    double *Trest_list, double *AVwarp_list,
+				    int *istat_list) {
+  eval_kcor_table_AVWARP_batch(*ifiltdef_a, *ifiltdef_b, *NEP, 
+			       mag_a_list, mag_b_list, Trest_list,
+			       AVwarp_list, istat_list);
+}
+
 
 // =====================================================================
 double eval_kcor_table_KCOR(int ifiltdef_rest, int ifiltdef_obs, double Trest,
@@ -3467,4 +3989,39 @@ double eval_kcor_table_KCOR(int ifiltdef_rest, int ifiltdef_obs, double Trest,
 
 } // end eval_kcor_table_KCOR
 
+// =====================================================================
+void eval_kcor_table_KCOR_batch(int ifiltdef_rest, int ifiltdef_obs, int NEP,
+				double *Trest_list, double z, double AVwarp, 
+				double *KCOR_list) {
+
+  // Created Oct 2026
+  // Batch version of eval_kcor_table_KCOR for NEP epochs with
+  // same rest & obs filters, z and AVwarp.
+
+  int ifilt_r = CALIB_INFO.FILTERCAL_REST.IFILTDEF_INV[ifiltdef_rest];
+  int ifilt_o = CALIB_INFO.FILTERCAL_OBS.IFILTDEF_INV[ifiltdef_obs];
+  GRIDMAP_DEF *KCOR_GRIDMAP =  &KCOR_TABLE.GRIDMAP_KCOR ;
+  double GRIDVAL_LIST[10];
+
+  // ------------- BEGIN ---------------
+  
+  GRIDVAL_LIST[0] = 0.0;  // Trest from Trest_list
+  GRIDVAL_LIST[1] = z;
+  GRIDVAL_LIST[2] = AVwarp;
+  GRIDVAL_LIST[3] = (double)ifilt_r ;
+  GRIDVAL_LIST[4] = (double)ifilt_o ;
+
+  interp_GRIDMAP_batch(KCOR_GRIDMAP, 0, NEP, GRIDVAL_LIST, Trest_list,
+		       KCOR_list);
+  return ;
+
+} // end eval_kcor_table_KCOR_batch
+
+void eval_kcor_table_kcor_batch__(int *ifiltdef_rest, int *ifiltdef_obs, 
+				  int *NEP, double *Trest_list, double *z, 
+				  double *AVwarp, double *KCOR_list) {
+  eval_kcor_table_KCOR_batch(*ifiltdef_rest, *ifiltdef_obs, *NEP, Trest_list,
+			     *z, *AVwarp, KCOR_list);
+}
+
 // ===== END =====
@@ -36,6 +36,12 @@
 #define OPT_KCORERR_SMOOTH  1  // to avoid kinks 
 #define OPT_KCORERR_ORIG    2
 
+// Oct 2026: binary cache of prepared KCOR tables (GRIDMAPs)
+#define ENV_CACHE_KCOR_TABLE   "SNANA_KCOR_CACHE_DIR" // cache dir from ENV
+#define MAGIC_CACHE_KCOR_TABLE "SNKCORC1"
+#define VERSION_CACHE_KCOR_TABLE 1
+#define NMAP_CACHE_KCOR_TABLE    4
+
 
 int KCOR_VERBOSE_FLAG;
 int IFILTDEF_BESS_BX;
@@ -81,6 +87,7 @@ typedef struct {
   double PRIMARY_MAG[MXFILT_CALIB];
   double PRIMARY_ZPOFF_SYN[MXFILT_CALIB]; // from synthetic vs. native
   double PRIMARY_ZPOFF_FILE[MXFILT_CALIB]; // from ZPOFF.DAT file
+  double ZP_SEDMODEL[MXFILT_CALIB];  // SEDMODEL-convention ZP (or -99)
   int    PRIMARY_KINDX[MXFILT_CALIB];  // index to CALIB_INFO.PRIMARY_XXX[]
   int    NBIN_LAM_PRIMARY ;
   double *PRIMARY_LAM, *PRIMARY_FLUX;
@@ -103,6 +110,7 @@ struct CALIB_INFO {
 
   // info passed to driver
   char FILENAME[MXPATHLEN] ;
+  char FILENAME_OPEN[MXPATHLEN] ; // full name after search (for cache key)
   fitsfile *FP ;
 
   char FILTERS_SURVEY[MXFILT_CALIB]; // filter list read from SIMLIB file
@@ -122,6 +130,7 @@ struct CALIB_INFO {
   double PRIMARY_MAG[MXFILT_CALIB];          // native mag
   double PRIMARY_ZPOFF_SYN[MXFILT_CALIB];    // mag(native) - mag(synth)
   double PRIMARY_ZPOFF_FILE[MXFILT_CALIB];   // from ZPOFF.DAT
+  double PRIMARY_ZP_SEDMODEL[MXFILT_CALIB];  // optional, Oct 2026
 
   int   NFILTDEF;
   char *FILTER_NAME[MXFILT_CALIB] ;
@@ -273,6 +282,8 @@ void get_calib_filtindex_map__(int *OPT_FRAME, int *NFILTDEF, int *IFILTDEF_MAP,
 
 double get_calib_zpoff_file(int OPT_FRAME, int ifiltdef);
 double get_calib_zpoff_file__(int *OPT_FRAME, int *ifiltdef);
+double get_calib_ZP_SEDMODEL(int OPT_FRAME, int ifiltdef);
+double get_calib_zp_sedmodel__(int *OPT_FRAME, int *ifiltdef);
 
 void abort_calib_frame(int OPT_FRAME, char *callFun) ;
 
@@ -286,6 +297,14 @@ void prepare_kcor_table_AVWARP(void);
 double fit_AVWARP(int ifiltdef_a, int ifiltdef_b, double T, double C);
 void prepare_kcor_table_KCOR(void);
 
+bool get_kcor_table_cache_file(char *cacheFile);
+unsigned long long hash_kcor_table_cache(void);
+bool read_kcor_table_cache(char *cacheFile);
+void write_kcor_table_cache(char *cacheFile);
+void write_gridmap_cache(FILE *fp, GRIDMAP_DEF *gridmap);
+long long map_gridmap_cache(char *MAPBUF, long long OFFSET, long long SIZE,
+			    GRIDMAP_DEF *gridmap);
+
 int nearest_ifiltdef_rest( int opt, int ifiltdef, int rank, double z, char *callFun,
 			   double *lamdif_min );
 int nearest_ifiltdef_rest__(int *opt, int *ifiltdef, int *rank, double *z, char *callFun,
@@ -326,6 +345,34 @@ double eval_kcor_table_avwarp__(int *ifiltdef_a, int *ifiltdef_b,
 double eval_kcor_table_KCOR(int ifiltdef_rest, int ifiltdef_obs, double Trest, 
 			    double z, double AVwarp);
 
+// Oct 2026: batch versions for many epochs with same z & filter(s)
+void eval_kcor_table_LCMAG_batch(int ifiltdef_rest, int NEP, double *Trest_list,
+				 double z, double AVwarp, double *LCMAG_list);
+void eval_kcor_table_lcmag_batch__(int *ifiltdef_rest, int *NEP, 
+				   double *Trest_list, double *z, 
+				   double *AVwarp, double *LCMAG_list);
+void eval_kcor_table_MWXT_batch(int ifiltdef_obs, int NEP, double *Trest_list,
+				double z, double AVwarp, double MWEBV, double RV,
+				int OPT_MWCOLORLAW, double *MWXT_list);
+void eval_kcor_table_mwxt_batch__(int *ifiltdef_obs, int *NEP, 
+				  double *Trest_list, double *z, double *AVwarp,
+				  double *MWEBV, double *RV, int *OPT_MWCOLORLAW,
+				  double *MWXT_list);
+void eval_kcor_table_AVWARP_batch(int ifiltdef_a, int ifiltdef_b, int NEP,
+				  double *mag_a_list, double *mag_b_list, 
+				  double *Trest_list, double *AVwarp_list,
+				  int *istat_list );
+void eval_kcor_table_avwarp_batch__(int *ifiltdef_a, int *ifiltdef_b, int *NEP,
+				    double *mag_a_list, double *mag_b_list,
+				    double *Trest_list, double *AVwarp_list,
+				    int *istat_list);
+void eval_kcor_table_KCOR_batch(int ifiltdef_rest, int ifiltdef_obs, int NEP,
+				double *Trest_list, double z, double AVwarp, 
+				double *KCOR_list);
+void eval_kcor_table_kcor_batch__(int *ifiltdef_rest, int *ifiltdef_obs, 
+				  int *NEP, double *Trest_list, double *z, 
+				  double *AVwarp, double *KCOR_list);
+
 void get_kcor_zrange(double *zmin, double *zmax, double *zbin);
 void get_kcor_zrange__(double *zmin, double *zmax, double *zbin);
 
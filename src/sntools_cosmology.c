@@ -25,6 +25,7 @@ void init_HzFUN_INFO(int VBOSE, double *cosPar, char *fileName,
   // Increase checkval_D range for wa, and add range check for w0.
   //
   // Jun 12 2024: increase allowed wa range from +_5 to +_10
+  // Oct 14 2026: init HzINV_TABLE.NZBIN=0 (no table)
   
   int ipar;
   int MEMD   = MXMAP_HzFUN * sizeof(double);
@@ -41,6 +42,7 @@ void init_HzFUN_INFO(int VBOSE, double *cosPar, char *fileName,
     { HzFUN_INFO->COSPAR_LIST[ipar] = cosPar[ipar]; }
 
   HzFUN_INFO->Nzbin_MAP = 0;
+  HzFUN_INFO->HzINV_TABLE.NZBIN = 0 ; // no table unless init_HzINV_TABLE
 
   // - - - - - - 
   HzFUN_INFO->USE_MAP = !IGNOREFILE(fileName) ;
@@ -340,8 +342,7 @@ double dvdz_integral__(int *OPT, double *zmax, double *COSPAR) {
 double dVdz(double z, HzFUN_INFO_DEF *HzFUN_INFO) {
   // returns dV/dz = r(z)^2 / H(z)
   double r, H, tmp ;
-  double zmin = 0.0;
-  r = Hzinv_integral (zmin, z, HzFUN_INFO);
+  r = Hzinv_integral_table (z, HzFUN_INFO); // Oct 2026: was Hzinv_integral
   H = Hzfun ( z, HzFUN_INFO);
   tmp = LIGHT_km * r * r / H ;
   return tmp;
@@ -453,6 +454,183 @@ double Hainv_integral(double amin, double amax, HzFUN_INFO_DEF *HzFUN_INFO) {
 
 
 
+// ******************************************
+void malloc_HzINV_TABLE(double zmax, double dzbin, HzINV_TABLE_DEF *TABLE) {
+
+  // Created Oct 2026
+  // Allocate table for cumulative integral of H0/H(z) from z=0 to zmax
+  // in bins of dzbin, and define ZGRID (bin edges and bin centers)
+  // where caller evaluates H0/H(z) into TABLE->EINV.
+
+  int NZBIN  = (int)ceil(zmax/dzbin) ;
+  int NZGRID = 2*NZBIN + 1 ;
+  int k;
+  char fnam[] = "malloc_HzINV_TABLE" ;
+
+  // ----------- BEGIN ------------
+
+  if ( NZBIN < 1 ) {
+    sprintf(c1err,"Invalid NZBIN=%d for zmax=%f, dzbin=%f", 
+	    NZBIN, zmax, dzbin);
+    sprintf(c2err,"Check zmax and dzbin args.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  TABLE->NZBIN  = NZBIN ;
+  TABLE->DZBIN  = dzbin ;
+  TABLE->ZMAX   = dzbin * (double)NZBIN ;
+  TABLE->NZGRID = NZGRID ;
+  TABLE->ZGRID  = (double*) malloc( NZGRID    * sizeof(double) );
+  TABLE->EINV   = (double*) malloc( NZGRID    * sizeof(double) );
+  TABLE->SUM    = (double*) malloc( (NZBIN+1) * sizeof(double) );
+
+  for(k=0; k < NZGRID; k++ ) 
+    { TABLE->ZGRID[k] = 0.5 * dzbin * (double)k ; }
+
+  return ;
+
+} // end malloc_HzINV_TABLE
+
+// ******************************************
+void free_HzINV_TABLE(HzINV_TABLE_DEF *TABLE) {
+  if ( TABLE->NZBIN == 0 ) { return; }
+  free(TABLE->ZGRID);  free(TABLE->EINV);  free(TABLE->SUM);
+  TABLE->NZBIN = 0 ;
+} // end free_HzINV_TABLE
+
+// ******************************************
+void integrate_HzINV_TABLE(HzINV_TABLE_DEF *TABLE) {
+
+  // Created Oct 2026
+  // After caller fills TABLE->EINV on ZGRID, compute cumulative
+  // integral at each bin edge using Simpson's rule in each z bin.
+
+  int    NZBIN = TABLE->NZBIN ;
+  double dz    = TABLE->DZBIN ;
+  double *f    = TABLE->EINV ;
+  int    i;
+
+  TABLE->SUM[0] = 0.0 ;
+  for(i=0; i < NZBIN; i++ ) {
+    TABLE->SUM[i+1] = TABLE->SUM[i] + 
+      dz * ( f[2*i] + 4.0*f[2*i+1] + f[2*i+2] ) / 6.0 ;
+  }
+
+  return ;
+
+} // end integrate_HzINV_TABLE
+
+// ******************************************
+double eval_HzINV_TABLE(double z, HzINV_TABLE_DEF *TABLE) {
+
+  // Created Oct 2026
+  // Return dimensionless int_0^z [H0/H(z')] dz' from table.
+  // Within each z bin, H0/H is approximated by the quadratic through
+  // the bin edges and center, and this quadratic is integrated
+  // analytically; at bin edges the result is exactly the Simpson sum.
+  // Caller must ensure 0 <= z <= TABLE->ZMAX.
+
+  int    NZBIN = TABLE->NZBIN ;
+  double dz    = TABLE->DZBIN ;
+  int    i     = (int)(z/dz) ;
+  double t, f0, fm, f1, b, c ;
+
+  if ( i >= NZBIN ) { i = NZBIN-1; }
+  if ( i < 0      ) { i = 0; }
+  t  = z/dz - (double)i ;
+  f0 = TABLE->EINV[2*i] ;
+  fm = TABLE->EINV[2*i+1] ;
+  f1 = TABLE->EINV[2*i+2] ;
+  b  = -3.0*f0 + 4.0*fm - f1 ;
+  c  =  2.0*f0 - 4.0*fm + 2.0*f1 ;
+
+  return TABLE->SUM[i] + dz * t * ( f0 + t*(b/2.0 + t*c/3.0) ) ;
+
+} // end eval_HzINV_TABLE
+
+// ******************************************
+void init_HzINV_TABLE(double zmax, HzFUN_INFO_DEF *HzFUN_INFO) {
+
+  // Created Oct 2026
+  // Fill HzFUN_INFO->HzINV_TABLE from 0 to zmax using Hzfun, so that
+  // subsequent dLmag (and Hzinv_integral_table) calls with 
+  // zCMB < zmax use fast table interpolation instead of an integral.
+  // Must be called again if COSPAR_LIST or the H(z) map is changed.
+  // For H(z) map (USE_MAP), zmax is clipped so that the table stays
+  // within the map z-range; no table if the map does not start at z=0 
+  // or is shorter than one z bin. Beyond the table, Hzinv_integral 
+  // is used as before.
+
+  HzINV_TABLE_DEF *TABLE = &HzFUN_INFO->HzINV_TABLE ;
+  double H0 = HzFUN_INFO->COSPAR_LIST[ICOSPAR_HzFUN_H0];
+  double dz = DZBIN_HzINV_TABLE ;
+  int    k;
+
+  // ----------- BEGIN ------------
+
+  free_HzINV_TABLE(TABLE);
+
+  if ( HzFUN_INFO->USE_MAP ) {
+    int    Nzbin    = HzFUN_INFO->Nzbin_MAP ;
+    double zmin_map = HzFUN_INFO->zCMB_MAP[0] ;
+    int    NBIN_MAP = (int)floor(HzFUN_INFO->zCMB_MAP[Nzbin-1]/dz) ;
+    if ( zmin_map > 0.0 || NBIN_MAP < 1 ) { return; }
+    // half-bin below edge so that ceil in malloc gives NBIN_MAP
+    if ( zmax > dz*(double)NBIN_MAP ) { zmax = dz*((double)NBIN_MAP-0.5); }
+  }
+
+  malloc_HzINV_TABLE(zmax, DZBIN_HzINV_TABLE, TABLE);
+
+  for(k=0; k < TABLE->NZGRID; k++ ) 
+    { TABLE->EINV[k] = H0 / Hzfun(TABLE->ZGRID[k], HzFUN_INFO); }
+
+  integrate_HzINV_TABLE(TABLE);
+
+  printf("\t Store %d z bins (zmax=%.2f) for H0/H(z) integral table\n",
+	 TABLE->NZBIN, TABLE->ZMAX);
+  fflush(stdout);
+
+  return ;
+
+} // end init_HzINV_TABLE
+
+// ******************************************
+double Hzinv_integral_table(double zmax, HzFUN_INFO_DEF *HzFUN_INFO) {
+
+  // Created Oct 2026
+  // Same output as Hzinv_integral(0,zmax,HzFUN_INFO), but use 
+  // HzINV_TABLE if it exists and covers zmax; otherwise 
+  // compute integral.
+
+  HzINV_TABLE_DEF *TABLE = &HzFUN_INFO->HzINV_TABLE ;
+  double H0 = HzFUN_INFO->COSPAR_LIST[ICOSPAR_HzFUN_H0];
+  double OM = HzFUN_INFO->COSPAR_LIST[ICOSPAR_HzFUN_OM];
+  double OL = HzFUN_INFO->COSPAR_LIST[ICOSPAR_HzFUN_OL];
+  double sum, Hzinv, KAPPA, SQRT_KAPPA ;
+
+  // ----------- BEGIN ------------
+
+  if ( TABLE->NZBIN == 0 || zmax < 0.0 || zmax > TABLE->ZMAX ) 
+    { return Hzinv_integral(0.0, zmax, HzFUN_INFO); }
+
+  sum = eval_HzINV_TABLE(zmax, TABLE);
+
+  // check for curvature (same as in Hzinv_integral)
+  KAPPA      = 1.0 - OM - OL ; 
+  SQRT_KAPPA = sqrt(fabs(KAPPA));
+
+  if ( KAPPA < -0.00001 ) 
+    { Hzinv = sin( SQRT_KAPPA * sum ) / SQRT_KAPPA ; }
+  else if ( KAPPA > 0.00001 ) 
+    { Hzinv = sinh( SQRT_KAPPA * sum ) / SQRT_KAPPA ; }
+  else
+    { Hzinv = sum ; }
+
+  // return Hzinv with c/H0 factor
+  return (Hzinv * LIGHT_km / H0 ) ;
+
+} // end Hzinv_integral_table
+
 // ******************************************
 double Hzfun(double zCMB, HzFUN_INFO_DEF *HzFUN_INFO ) {
 
@@ -532,13 +710,14 @@ double dLmag ( double zCMB, double zHEL, double vPEC,
   //
   // Feb 2023: pass ANISOTROPY_INFO to enable anistropy models
   // Jan 2024: add vPEC relativistic beaming
+  // Oct 2026: use HzINV_TABLE if defined (see init_HzINV_TABLE)
 
   bool  DO_VPEC_COR = true; // default should be true
-  double rz, dl, arg, mu, zero=0.0 ;
+  double rz, dl, arg, mu ;
   char fnam[] = "dLmag";
   
   // ----------- BEGIN -----------
-  rz     = Hzinv_integral(zero,zCMB,HzFUN_INFO) ;
+  rz     = Hzinv_integral_table(zCMB,HzFUN_INFO) ; // Oct 2026: use table
   rz    *= (1.0E6*PC_km);  // H -> 1/sec units
   dl     = ( 1.0 + zHEL ) * rz ; 
 
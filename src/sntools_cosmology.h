@@ -14,6 +14,19 @@
 
 #define MXMAP_HzFUN 5000  
 
+// Oct 2026: tabulated cumulative integral of H0/H(z) so that distances
+// for many redshifts at fixed cosmology cost one interpolation each.
+#define DZBIN_HzINV_TABLE  0.01  // default z-bin size for table
+
+typedef struct {
+  int    NZBIN ;   // number of z bins; 0 -> no table
+  double DZBIN, ZMAX ;
+  int    NZGRID ;  // 2*NZBIN+1 : bin edges and bin centers
+  double *ZGRID ;  // z-grid where H0/H(z) is evaluated
+  double *EINV ;   // H0/H(z) at each ZGRID value (filled by caller)
+  double *SUM ;    // int_0^z [H0/H(z')] dz' at each bin edge (NZBIN+1)
+} HzINV_TABLE_DEF ;
+
 typedef struct {
   double COSPAR_LIST[NCOSPAR_HzFUN];
   
@@ -23,6 +36,9 @@ typedef struct {
   int    Nzbin_MAP;
   double *zCMB_MAP, *HzFUN_MAP ;
 
+  // optional table to speed up Hzinv_integral (Oct 2026)
+  HzINV_TABLE_DEF HzINV_TABLE ;
+
 } HzFUN_INFO_DEF ;
 
 
@@ -61,6 +77,13 @@ double Hzinv_integral(double zmin, double zmax, HzFUN_INFO_DEF *HzFUN_INFO);
 
 double Hainv_integral(double amin, double amax, HzFUN_INFO_DEF *HzFUN_INFO); 
 
+void   malloc_HzINV_TABLE(double zmax, double dzbin, HzINV_TABLE_DEF *TABLE);
+void   free_HzINV_TABLE(HzINV_TABLE_DEF *TABLE);
+void   integrate_HzINV_TABLE(HzINV_TABLE_DEF *TABLE);
+double eval_HzINV_TABLE(double z, HzINV_TABLE_DEF *TABLE);
+void   init_HzINV_TABLE(double zmax, HzFUN_INFO_DEF *HzFUN_INFO);
+double Hzinv_integral_table(double zmax, HzFUN_INFO_DEF *HzFUN_INFO);
+
 double Hzfun ( double z, HzFUN_INFO_DEF *HzFUN_INFO); 
 double Hzfun_wCDM ( double z, HzFUN_INFO_DEF *HzFUN_INFO); 
 double Hzfun_interp ( double z, HzFUN_INFO_DEF *HzFUN_INFO); 
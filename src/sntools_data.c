@@ -861,10 +861,13 @@ void copy_SNDATA_OBS(int copyFlag, char *key, int NVAL,
   //   NVAL  : number of values to copy
   // 
   // Apr 19 2025; fix to set SNDATA.FILTNAME[obs] for 'FLT' or 'BAND' with copyFlag>0
+  // Oct 15 2026: numeric keys use slot map (IKEY_SNDATA_OBS) instead
+  //              of long if-else chain. Callers in event loop should
+  //              resolve IKEY once and call copy_SNDATA_OBS_IKEY[BULK].
 
   int  NOBS       = SNDATA.NOBS ;
   int  NOBS_STORE = SNDATA.NOBS_STORE ;
-  int  obs, OBS, NSPLIT, MSKOPT, NVAL_TMP ;
+  int  obs, OBS, NSPLIT, MSKOPT, NVAL_TMP, ikey ;
   char **str2d ;
   char fnam[] = "copy_SNDATA_OBS" ;
 
@@ -878,11 +881,9 @@ void copy_SNDATA_OBS(int copyFlag, char *key, int NVAL,
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
 
-  if ( strcmp(key,"MJD") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {  // sparse index
-      OBS = SNDATA.OBS_STORE_LIST[obs];     // index to full list
-      copy_dbl(copyFlag, &parVal[obs], &SNDATA.MJD[OBS]) ; 
-    }  
+  if ( (ikey = IKEY_SNDATA_OBS(key)) >= 0 ) {
+    // numeric column: copy via key->slot map (Oct 2026)
+    copy_SNDATA_OBS_IKEY(copyFlag, ikey, NVAL, parVal);
   } 
   else if ( strcmp(key,"FLT") == 0 || strcmp(key,"BAND") == 0 ) {
 
@@ -941,192 +942,189 @@ void copy_SNDATA_OBS(int copyFlag, char *key, int NVAL,
     }
 
   }
-  else if ( strcmp(key,"DETNUM") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_int(copyFlag, &parVal[obs], &SNDATA.DETNUM[OBS]) ; 
-    }  
-  }
-  else if ( strcmp(key,"IMGNUM") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_int(copyFlag, &parVal[obs], &SNDATA.IMGNUM[OBS]) ; 
-    }  
-  }
-  else if ( strcmp(key,"PHOTFLAG") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_int(copyFlag, &parVal[obs], &SNDATA.PHOTFLAG[OBS]) ; 
-    }  
-  }
-  else if ( strcmp(key,"PHOTPROB") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.PHOTPROB[OBS]) ; 
-    }  
+  else {
+    // error message
+    sprintf(c1err,"Unknown key = %s (copyFlag=%d)", key, copyFlag);
+    sprintf(c2err,"stringVal='%s'  parVal=%f", stringVal, parVal[0] );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
 
-  else if ( strcmp(key,"FLUXCAL") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.FLUXCAL[OBS]) ; 
-    }  
-  }
-  else if ( strcmp(key,"FLUXCALERR") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.FLUXCAL_ERRTOT[OBS]) ; 
-    }  
+  if  ( NVAL != NOBS_STORE ) {
+    sprintf(c1err,"Copied %d values (NOBS_STORE)", NOBS_STORE);
+    sprintf(c2err,"but expected NVAL=%d", NVAL);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);     
   }
 
-  else if ( strcmp(key,"PSF_SIG1") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.PSF_SIG1[OBS]) ; 
-    }  
-  }
-  else if ( strcmp(key,"PSF_SIG2") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.PSF_SIG2[OBS]) ; 
-    }  
-  }
-  else if ( strcmp(key,"PSF_RATIO") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.PSF_RATIO[OBS]) ; 
-    }  
-  }
-  else if ( strcmp(key,"PSF_NEA") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.PSF_NEA[OBS]) ; 
-    }  
-  }
+  return ;
 
-  else if ( strcmp(key,"SKY_SIG") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.SKY_SIG[OBS]) ; 
-    }  
-  }
-  else if ( strcmp(key,"SKY_SIG_T") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.SKY_SIG_T[OBS]) ; 
-    }  
-  }
-  else if ( strcmp(key,"ZEROPT") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.ZEROPT[OBS]) ; 
-    }  
-  }
-  else if ( strcmp(key,"ZEROPT_ERR") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.ZEROPT_ERR[OBS]) ; 
-    }  
-  }
-  else if ( strcmp(key,"TEXPOSE") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.TEXPOSE[OBS]) ; 
-    }  
-  }
-  else if ( strcmp(key,"GAIN") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.GAIN[OBS]) ; 
-    }  
-  }
-  else if ( strcmp(key,"XPIX") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.XPIX[OBS]) ; 
-    }  
-  }
-  else if ( strcmp(key,"YPIX") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.YPIX[OBS]) ; 
-    }  
-  }
+} // end copy_SNDATA_OBS
 
-  // - - - -  Atmos/DCR variables - - - - -
-  else if ( strcmp(key,"dRA") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.dRA[OBS]) ; 
-    }  
-  }
-  else if ( strcmp(key,"dDEC") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.dDEC[OBS]) ; 
-    }  
-  }
 
-  else if ( strcmp(key,"AIRMASS") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.AIRMASS[OBS]) ; 
-    }  
-  }
+// ==========================================
+void init_SNDATA_OBS_SLOTMAP(void) {
 
-  else if ( strcmp(key,"SIM_DCR_dRA") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.SIMEPOCH_DCR_dRA[OBS]) ; 
-    }  
-  }
+  // Created Oct 2026
+  // One-time init of key -> slot map for numeric OBS columns so that
+  // event-loop callers can resolve key once (IKEY_SNDATA_OBS) and 
+  // then copy without string compare (copy_SNDATA_OBS_IKEY).
+  // To add a new numeric OBS column, add one line here.
 
-  else if ( strcmp(key,"SIM_DCR_dDEC") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.SIMEPOCH_DCR_dDEC[OBS]) ; 
-    }  
-  }
+  // ----------- BEGIN ------------
+
+  SNDATA_OBS_SLOTMAP.NSLOT = 0 ;
+
+  add_SNDATA_OBS_SLOT("MJD",        ITYPE_SLOT_DBL, SNDATA.MJD );
+  add_SNDATA_OBS_SLOT("DETNUM",     ITYPE_SLOT_INT, SNDATA.DETNUM );
+  add_SNDATA_OBS_SLOT("IMGNUM",     ITYPE_SLOT_INT, SNDATA.IMGNUM );
+  add_SNDATA_OBS_SLOT("PHOTFLAG",   ITYPE_SLOT_INT, SNDATA.PHOTFLAG );
+  add_SNDATA_OBS_SLOT("PHOTPROB",   ITYPE_SLOT_FLT, SNDATA.PHOTPROB );
+  add_SNDATA_OBS_SLOT("FLUXCAL",    ITYPE_SLOT_FLT, SNDATA.FLUXCAL );
+  add_SNDATA_OBS_SLOT("FLUXCALERR", ITYPE_SLOT_FLT, SNDATA.FLUXCAL_ERRTOT );
+  add_SNDATA_OBS_SLOT("PSF_SIG1",   ITYPE_SLOT_FLT, SNDATA.PSF_SIG1 );
+  add_SNDATA_OBS_SLOT("PSF_SIG2",   ITYPE_SLOT_FLT, SNDATA.PSF_SIG2 );
+  add_SNDATA_OBS_SLOT("PSF_RATIO",  ITYPE_SLOT_FLT, SNDATA.PSF_RATIO );
+  add_SNDATA_OBS_SLOT("PSF_NEA",    ITYPE_SLOT_FLT, SNDATA.PSF_NEA );
+  add_SNDATA_OBS_SLOT("SKY_SIG",    ITYPE_SLOT_FLT, SNDATA.SKY_SIG );
+  add_SNDATA_OBS_SLOT("SKY_SIG_T",  ITYPE_SLOT_FLT, SNDATA.SKY_SIG_T );
+  add_SNDATA_OBS_SLOT("ZEROPT",     ITYPE_SLOT_FLT, SNDATA.ZEROPT );
+  add_SNDATA_OBS_SLOT("ZEROPT_ERR", ITYPE_SLOT_FLT, SNDATA.ZEROPT_ERR );
+  add_SNDATA_OBS_SLOT("TEXPOSE",    ITYPE_SLOT_FLT, SNDATA.TEXPOSE );
+  add_SNDATA_OBS_SLOT("GAIN",       ITYPE_SLOT_FLT, SNDATA.GAIN );
+  add_SNDATA_OBS_SLOT("XPIX",       ITYPE_SLOT_FLT, SNDATA.XPIX );
+  add_SNDATA_OBS_SLOT("YPIX",       ITYPE_SLOT_FLT, SNDATA.YPIX );
+
+  // Atmos/DCR variables
+  add_SNDATA_OBS_SLOT("dRA",        ITYPE_SLOT_FLT, SNDATA.dRA );
+  add_SNDATA_OBS_SLOT("dDEC",       ITYPE_SLOT_FLT, SNDATA.dDEC );
+  add_SNDATA_OBS_SLOT("AIRMASS",    ITYPE_SLOT_FLT, SNDATA.AIRMASS );
+  add_SNDATA_OBS_SLOT("SIM_DCR_dRA",  ITYPE_SLOT_FLT, SNDATA.SIMEPOCH_DCR_dRA );
+  add_SNDATA_OBS_SLOT("SIM_DCR_dDEC", ITYPE_SLOT_FLT, SNDATA.SIMEPOCH_DCR_dDEC);
+  add_SNDATA_OBS_SLOT("SIM_DCR_dMAG", ITYPE_SLOT_FLT, SNDATA.SIMEPOCH_DCR_dMAG);
+
+  add_SNDATA_OBS_SLOT("SIM_MAGOBS", ITYPE_SLOT_FLT, SNDATA.SIMEPOCH_MAG );
+
+  // key name for SNRMON depends on sim input; see IKEY_SNDATA_OBS
+  SNDATA_OBS_SLOTMAP.ISLOT_SNRMON = SNDATA_OBS_SLOTMAP.NSLOT ;
+  add_SNDATA_OBS_SLOT("SIM_SNRMON", ITYPE_SLOT_FLT, SNDATA.SIMEPOCH_SNRMON );
+
+  return ;
 
-  else if ( strcmp(key,"SIM_DCR_dMAG") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.SIMEPOCH_DCR_dMAG[OBS]) ; 
-    }  
+} // end init_SNDATA_OBS_SLOTMAP
+
+void add_SNDATA_OBS_SLOT(char *key, int ITYPE, void *PTR) {
+  int  NSLOT = SNDATA_OBS_SLOTMAP.NSLOT ;
+  char fnam[] = "add_SNDATA_OBS_SLOT" ;
+  if ( NSLOT >= MXSLOT_SNDATA_OBS ) {
+    sprintf(c1err,"NSLOT=%d exceeds bound for key=%s", NSLOT, key);
+    sprintf(c2err,"Check MXSLOT_SNDATA_OBS");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
+  sprintf(SNDATA_OBS_SLOTMAP.KEY[NSLOT], "%s", key);
+  SNDATA_OBS_SLOTMAP.ITYPE[NSLOT] = ITYPE ;
+  SNDATA_OBS_SLOTMAP.PTR[NSLOT]   = PTR ;
+  SNDATA_OBS_SLOTMAP.NSLOT++ ;
+} // end add_SNDATA_OBS_SLOT
+
+
+// ==========================================
+int IKEY_SNDATA_OBS(char *key) {
 
-  // - - - - 
+  // Created Oct 2026
+  // Return slot index for numeric OBS *key, or -9 if key is not
+  // a numeric OBS column (e.g., BAND, FIELD).
 
-  else if ( strcmp(key,"SIM_MAGOBS") == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.SIMEPOCH_MAG[OBS]) ; 
-    }  
+  int ikey ;
+
+  // ----------- BEGIN ------------
+
+  if ( SNDATA_OBS_SLOTMAP.NSLOT == 0 ) { init_SNDATA_OBS_SLOTMAP(); }
+
+  for(ikey=0; ikey < SNDATA_OBS_SLOTMAP.NSLOT; ikey++ ) {
+    if ( strcmp(key,SNDATA_OBS_SLOTMAP.KEY[ikey]) == 0 ) { return ikey; }
   }
 
-  else if ( strcmp(key,SNDATA.VARNAME_SNRMON) == 0 ) {
-    for(obs=0; obs < NOBS_STORE; obs++ ) {
-      OBS = SNDATA.OBS_STORE_LIST[obs];  
-      copy_flt(copyFlag, &parVal[obs], &SNDATA.SIMEPOCH_SNRMON[OBS]) ; 
-    }  
+  if ( strcmp(key,SNDATA.VARNAME_SNRMON) == 0 ) 
+    { return SNDATA_OBS_SLOTMAP.ISLOT_SNRMON ; }
+
+  return -9 ;
+
+} // end IKEY_SNDATA_OBS
+
+
+// ==========================================
+void copy_SNDATA_OBS_IKEY(int copyFlag, int ikey, int NVAL, double *parVal) {
+
+  // Created Oct 2026
+  // Same as copy_SNDATA_OBS for numeric column, but key is 
+  // specified by slot index ikey from IKEY_SNDATA_OBS.
+  // Avoids string compare per key per event.
+
+  int   NOBS_STORE = SNDATA.NOBS_STORE ;
+  int   *OBS_LIST  = SNDATA.OBS_STORE_LIST ;
+  int   ITYPE, obs ;
+  void  *PTR ;
+  char fnam[] = "copy_SNDATA_OBS_IKEY" ;
+
+  // ----------- BEGIN ------------
+
+  if ( ikey < 0 || ikey >= SNDATA_OBS_SLOTMAP.NSLOT ) {
+    sprintf(c1err,"Invalid ikey=%d (NSLOT=%d)", 
+	    ikey, SNDATA_OBS_SLOTMAP.NSLOT);
+    sprintf(c2err,"Check IKEY_SNDATA_OBS call");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
 
-  else {
-    // error message
-    sprintf(c1err,"Unknown key = %s (copyFlag=%d)", key, copyFlag);
-    sprintf(c2err,"stringVal='%s'  parVal=%f", stringVal, parVal[0] );
+  if ( NOBS_STORE < 0 ) {
+    sprintf(c1err,"Must call select_MJD_SNDATA to set MJD window");
+    sprintf(c2err,"for which obs to copy (CID=%s)", SNDATA.CCID );
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
 
   if  ( NVAL != NOBS_STORE ) {
-    sprintf(c1err,"Copied %d values (NOBS_STORE)", NOBS_STORE);
-    sprintf(c2err,"but expected NVAL=%d", NVAL);
+    sprintf(c1err,"NVAL=%d for %s", NVAL, SNDATA_OBS_SLOTMAP.KEY[ikey]);
+    sprintf(c2err,"but expected NVAL=NOBS_STORE=%d", NOBS_STORE);
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err);     
   }
 
+  ITYPE = SNDATA_OBS_SLOTMAP.ITYPE[ikey] ;
+  PTR   = SNDATA_OBS_SLOTMAP.PTR[ikey] ;
+
+  if ( ITYPE == ITYPE_SLOT_INT ) {
+    int *IPTR = (int*)PTR ;
+    for(obs=0; obs < NOBS_STORE; obs++ ) 
+      { copy_int(copyFlag, &parVal[obs], &IPTR[OBS_LIST[obs]]) ; }
+  }
+  else if ( ITYPE == ITYPE_SLOT_FLT ) {
+    float *FPTR = (float*)PTR ;
+    for(obs=0; obs < NOBS_STORE; obs++ ) 
+      { copy_flt(copyFlag, &parVal[obs], &FPTR[OBS_LIST[obs]]) ; }
+  }
+  else {
+    double *DPTR = (double*)PTR ;
+    for(obs=0; obs < NOBS_STORE; obs++ ) 
+      { copy_dbl(copyFlag, &parVal[obs], &DPTR[OBS_LIST[obs]]) ; }
+  }
+
   return ;
 
-} // end copy_SNDATA_OBS
+} // end copy_SNDATA_OBS_IKEY
+
+
+// ==========================================
+void copy_SNDATA_OBS_BULK(int copyFlag, int NKEY, int *IKEY_LIST, 
+			  int NVAL, double *parVal) {
+
+  // Created Oct 2026
+  // Copy NKEY numeric OBS columns in one call;
+  // column IKEY_LIST[k] is parVal[k*NVAL + obs].
+
+  int k;
+  for(k=0; k < NKEY; k++ ) 
+    { copy_SNDATA_OBS_IKEY(copyFlag, IKEY_LIST[k], NVAL, &parVal[k*NVAL]); }
+
+  return ;
+
+} // end copy_SNDATA_OBS_BULK
 
 
 // ==========================================
@@ -1747,6 +1745,15 @@ void copy_sndata_obs__(int *copyFlag, char *key, int *NVAL,
 		       char *stringVal, double *parVal ) 
 { copy_SNDATA_OBS(*copyFlag, key, *NVAL, stringVal, parVal); }
 
+int ikey_sndata_obs__(char *key) { return IKEY_SNDATA_OBS(key); }
+
+void copy_sndata_obs_ikey__(int *copyFlag, int *ikey, int *NVAL, double *parVal) 
+{ copy_SNDATA_OBS_IKEY(*copyFlag, *ikey, *NVAL, parVal); }
+
+void copy_sndata_obs_bulk__(int *copyFlag, int *NKEY, int *IKEY_LIST, 
+			    int *NVAL, double *parVal) 
+{ copy_SNDATA_OBS_BULK(*copyFlag, *NKEY, IKEY_LIST, *NVAL, parVal); }
+
 void copy_genspec__(int *copyFlag, char *key, int *ispec, double *parVal ) 
 { copy_GENSPEC(*copyFlag, key, *ispec, parVal); }
 
@@ -35,6 +35,20 @@ struct {
 } RD_OVERRIDE;
 
 
+// Oct 2026: key -> slot map for numeric OBS columns in copy_SNDATA_OBS
+#define MXSLOT_SNDATA_OBS  40
+#define ITYPE_SLOT_INT  1
+#define ITYPE_SLOT_FLT  2
+#define ITYPE_SLOT_DBL  3
+struct {
+  int   NSLOT ;
+  char  KEY[MXSLOT_SNDATA_OBS][40] ;
+  int   ITYPE[MXSLOT_SNDATA_OBS] ;   // ITYPE_SLOT_[INT,FLT,DBL]
+  void *PTR[MXSLOT_SNDATA_OBS] ;     // SNDATA array for each slot
+  int   ISLOT_SNRMON ;               // slot for SNDATA.VARNAME_SNRMON
+} SNDATA_OBS_SLOTMAP ;
+
+
 #define FORMAT_SNDATA_FITS 32
 #define FORMAT_SNDATA_TEXT  2
 
@@ -50,6 +64,12 @@ void copy_SNDATA_HEAD(int copyFlag, char *key,
 void copy_SNDATA_OBS(int copyFlag, char *key,
                      int NVAL,char *stringVal, double *parVal);
 int  select_MJD_SNDATA(double *CUTWIN_MJD);
+void init_SNDATA_OBS_SLOTMAP(void);
+void add_SNDATA_OBS_SLOT(char *key, int ITYPE, void *PTR);
+int  IKEY_SNDATA_OBS(char *key);
+void copy_SNDATA_OBS_IKEY(int copyFlag, int ikey, int NVAL, double *parVal);
+void copy_SNDATA_OBS_BULK(int copyFlag, int NKEY, int *IKEY_LIST, 
+			  int NVAL, double *parVal);
 void host_property_list_sndata(char *HOST_PROPERTY_LIST);
 
 void copy_GENSPEC(int copyFlag, char *key, int ispec, double *parVal);
@@ -82,6 +102,10 @@ void copy_sndata_head__(int *copyFlag, char *key,
 void copy_sndata_obs__(int *copyFlag, char *key,
                        int *NVAL,char *stringVal, double *parVal);
 int  select_mjd_sndata__(double *MJD_WINDOW);
+int  ikey_sndata_obs__(char *key);
+void copy_sndata_obs_ikey__(int *copyFlag, int *ikey, int *NVAL, double *parVal);
+void copy_sndata_obs_bulk__(int *copyFlag, int *NKEY, int *IKEY_LIST, 
+			    int *NVAL, double *parVal);
 void host_property_list_sndata__(char *HOST_PROPERTY_LIST);
 
 void copy_genspec__(int *copyFlag, char *key, int *ispec, double *parVal ) ;
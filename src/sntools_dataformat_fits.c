@@ -80,6 +80,17 @@
               only SIM_FLAM to save disk space. This compact write feature
               was developed for OpenUniverse2024.
 
+ Oct 14 2026: optional prefetch thread (ENV SNANA_FITS_PREFETCH = NRING)
+              reads PHOT rows for next NRING events into ring buffer.
+ Oct 14 2026: optional bulk read of PHOT column blocks 
+              (ENV SNANA_FITS_NEVT_BLOCK = number of events per block).
+ Oct 14 2026: buffer HEAD/PHOT/SPEC rows and write every 100 events
+              with one fits_write_col per column 
+              (ENV SNANA_FITS_NEVT_WRBUF overrides; 0 -> no buffer).
+ Oct 15 2026: optional writer thread (ENV SNANA_FITS_ASYNC_WRITE = 1)
+              writes full buffer while next events are read and
+              filled in a second buffer; e.g., for snana.exe reformat.
+
 **************************************************/
 
 #include "fitsio.h"
@@ -120,6 +131,7 @@ void WR_SNFITSIO_INIT(char *path, char *version, char *prefix, int writeFlag,
   // Sep 10 2020: begin refactor with BYOSED -> PySEDMODEL
   // Oct 14 2021: change simFlag to writeFlag that has spectra bit
   // Jul 30 2023: check WRITE_MASK_COMPACT_noFLUXCAL to suppress FLUXCAL[ERR]
+  // Oct 15 2026: check WRITE_MASK_PHOT_REDUCED
 
   int  MEMC = MXPATHLEN * sizeof(char);
   int  itype, ipar, OVP, lenpath, lenfile, lentot ;
@@ -146,6 +158,7 @@ void WR_SNFITSIO_INIT(char *path, char *version, char *prefix, int writeFlag,
   SNFITSIO_COMPACT_FLAG         = false ; 
   SNFITSIO_COMPACT_noFLUXCAL_FLAG = false;
   SNFITSIO_SPECTRA_FLAG         = false ; // Oct 14, 2021
+  SNFITSIO_PHOT_REDUCED_FLAG    = false ; // Oct 2026
 
   NSNLC_WR_SNFITSIO_TOT = 0 ;
   NSPEC_WR_SNFITSIO_TOT = 0 ;
@@ -198,6 +211,9 @@ void WR_SNFITSIO_INIT(char *path, char *version, char *prefix, int writeFlag,
   OVP = ( writeFlag & WRITE_MASK_ATMOS ) ;
   if ( OVP > 0 ) { SNFITSIO_ATMOS = true; } // July 2023
 
+  OVP = ( writeFlag & WRITE_MASK_PHOT_REDUCED ) ;
+  if ( OVP > 0 ) { SNFITSIO_PHOT_REDUCED_FLAG = true; } // Oct 2026
+
   IFILE_WR_SNFITSIO = 1;     // only one file written here.
 
   // store path and VERSION in globals 
@@ -239,6 +255,9 @@ void WR_SNFITSIO_INIT(char *path, char *version, char *prefix, int writeFlag,
 
   // misc inits
 
+  wr_snfitsio_init_wrbuf(); // Oct 2026
+  wr_snfitsio_async_init(); // Oct 2026
+
   for ( itype=0 ; itype < MXTYPE_SNFITSIO; itype++ ) {
     NPAR_WR_SNFITSIO[itype] = 0;
     WR_SNFITSIO_TABLEVAL[itype].NROW  = 0 ;
@@ -659,11 +678,79 @@ void wr_snfitsio_addCol(char *tform, char *name, int itype) {
   // set unit to blank
   WR_SNFITSIO_TABLEDEF[itype].ptrUnit[NPAR] = stringBlank ;
 
+  WR_SNFITSIO_TABLEDEF[itype].TSCAL[NPAR] = 0.0 ; // no scale
+  WR_SNFITSIO_TABLEDEF[itype].TZERO[NPAR] = 0.0 ;
+
   return;
 
 } // end of wr_snfitsio_addCol
 
 
+// ==========================================
+void wr_snfitsio_addCol_scaled(char *name, double tscal, double tzero,
+			       int itype) {
+
+  // Created Oct 2026
+  // If SNFITSIO_PHOT_REDUCED_FLAG, add float column stored as 16-bit
+  // int with FITS scaling value = TZERO + TSCAL*int; otherwise add
+  // normal float (1E) column. cfitsio applies TSCAL/TZERO on both
+  // write and read, so callers fill and read float values as usual.
+  // Valid range is TZERO +_ 32767*TSCAL; values are clipped on write.
+
+  int NPAR;
+
+  // ------------- BEGIN -------------------
+
+  if ( !SNFITSIO_PHOT_REDUCED_FLAG ) 
+    { wr_snfitsio_addCol("1E", name, itype);  return; }
+
+  wr_snfitsio_addCol("1I", name, itype);
+  NPAR = NPAR_WR_SNFITSIO[itype] ;
+  WR_SNFITSIO_TABLEDEF[itype].TSCAL[NPAR] = tscal ;
+  WR_SNFITSIO_TABLEDEF[itype].TZERO[NPAR] = tzero ;
+
+  return;
+
+} // end of wr_snfitsio_addCol_scaled
+
+
+// ==========================================
+void wr_snfitsio_set_tscale(int itype) {
+
+  // Created Oct 2026
+  // After fits_create_tbl, write TSCALn & TZEROn keys for scaled
+  // columns, and set scaling for the open table (cfitsio does not
+  // re-parse keys that are added after the table is created).
+
+  fitsfile *fp = fp_wr_snfitsio[itype];
+  int  NPAR  = NPAR_WR_SNFITSIO[itype] ;
+  int  ipar, istat = 0 ;
+  double TSCAL, TZERO ;
+  char keyName[20];
+
+  // ------------- BEGIN -------------------
+
+  for ( ipar=1; ipar <= NPAR; ipar++ ) {
+    TSCAL = WR_SNFITSIO_TABLEDEF[itype].TSCAL[ipar] ;
+    TZERO = WR_SNFITSIO_TABLEDEF[itype].TZERO[ipar] ;
+    if ( TSCAL == 0.0 ) { continue; }
+
+    sprintf(keyName, "TSCAL%d", ipar);
+    fits_update_key(fp, TDOUBLE, keyName, &TSCAL, "scaled float", &istat);
+    sprintf(keyName, "TZERO%d", ipar);
+    fits_update_key(fp, TDOUBLE, keyName, &TZERO, "scaled float", &istat);
+    fits_set_tscale(fp, ipar, TSCAL, TZERO, &istat);
+
+    sprintf(c1err, "set TSCAL for %s", 
+	    WR_SNFITSIO_TABLEDEF[itype].name[ipar] );
+    snfitsio_errorCheck(c1err, istat) ;
+  }
+
+  return;
+
+} // end of wr_snfitsio_set_tscale
+
+
 void wr_snfitsio_addCol_filters(char *cast, char *prefix, int itype ) {
 
   // Created Aug 4 2023
@@ -753,7 +840,7 @@ void wr_snfitsio_init_phot(void) {
     wr_snfitsio_addCol( FMT, "FIELD"       , itype ) ; 
     
     wr_snfitsio_addCol( "1J",  "PHOTFLAG"    , itype ) ; 
-    wr_snfitsio_addCol( "1E",  "PHOTPROB"    , itype ) ; 
+    wr_snfitsio_addCol_scaled("PHOTPROB", 1.0E-4, 0.0, itype); 
   } // end WRFULL
 
   if ( !SNFITSIO_COMPACT_noFLUXCAL_FLAG ) {
@@ -768,25 +855,25 @@ void wr_snfitsio_init_phot(void) {
     }
     else {
       // traditional PSF params
-      wr_snfitsio_addCol( "1E" , "PSF_SIG1"   , itype ) ; 
-      wr_snfitsio_addCol( "1E" , "PSF_SIG2"   , itype ) ; 
-      wr_snfitsio_addCol( "1E" , "PSF_RATIO"  , itype ) ;   
+      wr_snfitsio_addCol_scaled("PSF_SIG1",  1.0E-3, 0.0, itype); 
+      wr_snfitsio_addCol_scaled("PSF_SIG2",  1.0E-3, 0.0, itype); 
+      wr_snfitsio_addCol_scaled("PSF_RATIO", 1.0E-4, 0.0, itype);   
     }
     
     wr_snfitsio_addCol( "1E" , "SKY_SIG"    , itype ) ; 
     wr_snfitsio_addCol( "1E" , "SKY_SIG_T"  , itype ) ; 
-    wr_snfitsio_addCol( "1E" , "RDNOISE"    , itype ) ; // e- per pix
-    wr_snfitsio_addCol( "1E" , "ZEROPT"     , itype ) ; 
-    wr_snfitsio_addCol( "1E" , "ZEROPT_ERR" , itype ) ;
+    wr_snfitsio_addCol_scaled("RDNOISE",    1.0E-2, 0.0,  itype); // e-/pix
+    wr_snfitsio_addCol_scaled("ZEROPT",     1.0E-3, 30.0, itype); 
+    wr_snfitsio_addCol_scaled("ZEROPT_ERR", 1.0E-4, 0.0,  itype);
     wr_snfitsio_addCol( "1E" , "TEXPOSE"    , itype ) ; 
-    wr_snfitsio_addCol( "1E" , "GAIN"       , itype ) ; 
+    wr_snfitsio_addCol_scaled("GAIN", 1.0E-3, 0.0, itype); 
     wr_snfitsio_addCol( "1E" , "XPIX" , itype ) ;
     wr_snfitsio_addCol( "1E" , "YPIX" , itype ) ;
 
     if ( SNFITSIO_ATMOS ) {  // July 2023
       wr_snfitsio_addCol( "1E" , "dRA" ,     itype ) ; // RA(obs) - RA_AVG(band)
       wr_snfitsio_addCol( "1E" , "dDEC" ,    itype ) ; // same for DEC
-      wr_snfitsio_addCol( "1E" , "AIRMASS" , itype ) ;
+      wr_snfitsio_addCol_scaled("AIRMASS", 1.0E-4, 2.0, itype);
       if ( SNFITSIO_SIMFLAG_SNANA ) {
 	wr_snfitsio_addCol( "1E" , "SIM_DCR_dRA" ,     itype ) ;
 	wr_snfitsio_addCol( "1E" , "SIM_DCR_dDEC" ,    itype ) ;
@@ -816,6 +903,7 @@ void wr_snfitsio_init_phot(void) {
   sprintf(BANNER,"fits_create_tbl for %s", TBLname );
   snfitsio_errorCheck(BANNER, istat) ;
 
+  if ( SNFITSIO_PHOT_REDUCED_FLAG ) { wr_snfitsio_set_tscale(itype); }
 
   return ;
 
@@ -1479,6 +1567,13 @@ void WR_SNFITSIO_UPDATE(void) {
     }
   }
 
+  // Oct 2026: write buffered rows every NEVT_FLUSH events
+  if ( WRBUF_SNFITSIO.NEVT_FLUSH > 0 ) {
+    WRBUF_SNFITSIO.NEVT_BUF++ ;
+    if ( WRBUF_SNFITSIO.NEVT_BUF >= WRBUF_SNFITSIO.NEVT_FLUSH ) 
+      { wr_snfitsio_flush(); }
+  }
+
   return ;
 
 } // end of WR_SNFITSIO_UPDATE
@@ -2236,8 +2331,14 @@ void wr_snfitsio_fillTable(int *COLNUM, char *parName, int itype ) {
   // Sep 20 2017: define logical ALLOW_BLANK to allow exceptions
   //              for the no-blank rule on strins. See SUBSURVEY.
   //
+  // Oct 14 2026: if WRBUF_SNFITSIO.NEVT_FLUSH > 0, store value in
+  //              write-buffer; see wr_snfitsio_flush.
+  // Oct 15 2026: float value for scaled 1I column (PHOT_REDUCED)
+
   int istat, colnum, firstelem, firstrow, nrow, LEN, OPTMASK ;
+  int datatype = -9, size = 0 ;
   int LDMP = 0 ;
+  void *ptrVal = NULL ;
   fitsfile *fp ;
   char *ptrForm, cfirst[2], clast[2] ;
   char fnam[] = "wr_snfitsio_fillTable";
@@ -2277,31 +2378,42 @@ void wr_snfitsio_fillTable(int *COLNUM, char *parName, int itype ) {
       sprintf(c2err,"to colnum=%d of table=%s", colnum, snfitsType[itype]);
       errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
     }
-    fits_write_col(fp, TSTRING, colnum, firstrow, firstelem, nrow,
-		   &WR_SNFITSIO_TABLEVAL[itype].value_A, &istat);  
+    datatype = TSTRING ;   size = atoi(ptrForm) + 1 ;
+    if ( size < 2 ) { size = 2; }   // "A" form is one char
+    ptrVal   = &WR_SNFITSIO_TABLEVAL[itype].value_A ;
   }
   else if ( strcmp(ptrForm,"1D") == 0 ) {
-    fits_write_col(fp, TDOUBLE, colnum, firstrow, firstelem, nrow,
-		   &WR_SNFITSIO_TABLEVAL[itype].value_1D, &istat);  
+    datatype = TDOUBLE ;   size = sizeof(double);
+    ptrVal   = &WR_SNFITSIO_TABLEVAL[itype].value_1D ;
   }
   else if ( strcmp(ptrForm,"1E") == 0 ) {
-    fits_write_col(fp, TFLOAT, colnum, firstrow, firstelem, nrow,
-		   &WR_SNFITSIO_TABLEVAL[itype].value_1E, &istat);  
+    datatype = TFLOAT ;    size = sizeof(float);
+    ptrVal   = &WR_SNFITSIO_TABLEVAL[itype].value_1E ;
+  }
+  else if ( WR_SNFITSIO_TABLEDEF[itype].TSCAL[colnum] != 0.0 ) {
+    // Oct 2026: float stored as scaled 1I; clip to avoid int16 overflow
+    double TSCAL = WR_SNFITSIO_TABLEDEF[itype].TSCAL[colnum] ;
+    double TZERO = WR_SNFITSIO_TABLEDEF[itype].TZERO[colnum] ;
+    float  VMIN  = (float)(TZERO - 32767.0*TSCAL) ;
+    float  VMAX  = (float)(TZERO + 32767.0*TSCAL) ;
+    float *ptrE  = &WR_SNFITSIO_TABLEVAL[itype].value_1E ;
+    if ( *ptrE < VMIN ) { *ptrE = VMIN; }
+    if ( *ptrE > VMAX ) { *ptrE = VMAX; }
+    datatype = TFLOAT ;    size = sizeof(float);
+    ptrVal   = ptrE ;
   }
   else if ( strcmp(ptrForm,"1J") == 0 ) {  // 32-bit signed int
-    fits_write_col(fp, TINT, colnum, firstrow, firstelem, nrow,
-		   &WR_SNFITSIO_TABLEVAL[itype].value_1J, &istat);  
+    datatype = TINT ;      size = sizeof(int);
+    ptrVal   = &WR_SNFITSIO_TABLEVAL[itype].value_1J ;
   }
   else if ( strcmp(ptrForm,"1I") == 0 ) {  // 16-bit unsigned int
-    fits_write_col(fp, TSHORT, colnum, firstrow, firstelem, nrow,
-		   &WR_SNFITSIO_TABLEVAL[itype].value_1I, &istat);  
+    datatype = TSHORT ;    size = sizeof(short);
+    ptrVal   = &WR_SNFITSIO_TABLEVAL[itype].value_1I ;
   }
   else if ( strcmp(ptrForm,"1K") == 0 ) {  // 64 bit long long
-    fits_write_col(fp, TLONGLONG, colnum, firstrow, firstelem, nrow,
-		   &WR_SNFITSIO_TABLEVAL[itype].value_1K, &istat);  
+    datatype = TLONGLONG ; size = sizeof(long long);
+    ptrVal   = &WR_SNFITSIO_TABLEVAL[itype].value_1K ;
   }
-
-
   else {
     sprintf(c1err,"Unrecognized Form = '%s' for param='%s' ", 
 	    ptrForm, parName) ;
@@ -2309,6 +2421,14 @@ void wr_snfitsio_fillTable(int *COLNUM, char *parName, int itype ) {
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
   }
 
+  if ( WRBUF_SNFITSIO.NEVT_FLUSH > 0 ) {
+    wr_snfitsio_fillBuffer(itype, colnum, datatype, size, ptrVal);
+    return ;
+  }
+
+  fits_write_col(fp, datatype, colnum, firstrow, firstelem, nrow,
+		 ptrVal, &istat);  
+
   sprintf(BANNER,"fits_write_col for %s-param: %s", 
 	  snfitsType[itype], parName );
 
@@ -2319,6 +2439,359 @@ void wr_snfitsio_fillTable(int *COLNUM, char *parName, int itype ) {
 } //  end of wr_snfitsio_fillTable
 
 
+// ==============================================
+void wr_snfitsio_init_wrbuf(void) {
+
+  // Created Oct 14 2026
+  // Init write-buffer. Default is to flush every 
+  // NEVT_WRBUF_SNFITSIO_DEFAULT events; ENV_NEVT_WRBUF_SNFITSIO 
+  // overrides, and 0 writes each row as it is filled.
+
+  char *cenv = getenv(ENV_NEVT_WRBUF_SNFITSIO);
+  int  itype, colnum, NEVT = NEVT_WRBUF_SNFITSIO_DEFAULT ;
+  SNFITSIO_WRBUF_DEF *TABLE ;
+
+  // ------------ BEGIN -----------
+
+  if ( cenv != NULL ) { sscanf(cenv, "%d", &NEVT); }
+  if ( NEVT < 0 ) { NEVT = 0; }
+
+  WRBUF_SNFITSIO.NEVT_FLUSH = NEVT ;
+  WRBUF_SNFITSIO.NEVT_BUF   = 0 ;
+
+  for ( itype=0 ; itype < MXTYPE_SNFITSIO; itype++ ) {
+    TABLE = &WRBUF_SNFITSIO.TABLE[itype] ;
+    TABLE->ROW0 = 1 ;
+    for ( colnum=0; colnum < MXPAR_SNFITSIO; colnum++ ) {
+      TABLE->DATATYPE[colnum]  = -9 ;
+      TABLE->SIZE[colnum]      =  0 ;
+      TABLE->MXROW[colnum]     =  0 ;
+      TABLE->NROW_FILL[colnum] =  0 ;
+      if ( TABLE->BUF[colnum] != NULL ) { free(TABLE->BUF[colnum]); }
+      TABLE->BUF[colnum]       = NULL ;
+    }
+  }
+
+  if ( NEVT > 0 ) {
+    printf("   Buffer FITS rows and write every %d events.\n", NEVT);
+    fflush(stdout);
+  }
+
+  return ;
+
+} // end wr_snfitsio_init_wrbuf
+
+
+// ==============================================
+void wr_snfitsio_fillBuffer(int itype, int colnum, int datatype, 
+			    int size, void *ptrVal) {
+
+  // Created Oct 14 2026
+  // Store value *ptrVal for current row of table itype and
+  // column colnum in write-buffer. Rows that are not filled
+  // before the flush are written as zero (or blank string),
+  // which is the same as cfitsio's fill for new rows.
+
+  SNFITSIO_WRBUF_DEF *TABLE = &WRBUF_SNFITSIO.TABLE[itype] ;
+  int  irow  = WR_SNFITSIO_TABLEVAL[itype].NROW - TABLE->ROW0 ;
+  int  MXROW = TABLE->MXROW[colnum] ;
+  int  MXROW_NEW ;
+  char *ptrBuf ;
+  char fnam[] = "wr_snfitsio_fillBuffer" ;
+
+  // ------------ BEGIN -----------
+
+  if ( irow < 0 ) {
+    sprintf(c1err,"Invalid buffer row = %d for colnum=%d of %s table", 
+	    irow, colnum, snfitsType[itype] );
+    sprintf(c2err,"NROW=%d  ROW0=%d", 
+	    WR_SNFITSIO_TABLEVAL[itype].NROW, TABLE->ROW0);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  // allocate or extend buffer; unfilled rows are zero
+  if ( irow >= MXROW ) {
+    MXROW_NEW = 2*MXROW ;
+    if ( MXROW_NEW < 1000     ) { MXROW_NEW = 1000; }
+    if ( MXROW_NEW < irow + 1 ) { MXROW_NEW = irow + 1; }
+    TABLE->BUF[colnum] = (char*)realloc(TABLE->BUF[colnum], MXROW_NEW*size);
+    memset(TABLE->BUF[colnum] + MXROW*size, 0, (MXROW_NEW-MXROW)*size);
+    TABLE->MXROW[colnum]    = MXROW_NEW ;
+    TABLE->DATATYPE[colnum] = datatype ;
+    TABLE->SIZE[colnum]     = size ;
+  }
+
+  ptrBuf = TABLE->BUF[colnum] + irow*size ;
+  if ( datatype == TSTRING ) 
+    { snprintf(ptrBuf, size, "%s", *(char**)ptrVal); }
+  else
+    { memcpy(ptrBuf, ptrVal, size); }
+
+  if ( irow+1 > TABLE->NROW_FILL[colnum] ) 
+    { TABLE->NROW_FILL[colnum] = irow+1; }
+
+  return ;
+
+} // end wr_snfitsio_fillBuffer
+
+
+// ==============================================
+void wr_snfitsio_flush(void) {
+
+  // Created Oct 14 2026
+  // Write buffered rows for each table with one fits_write_col 
+  // call per column, then reset buffer.
+  //
+  // Oct 15 2026: if writer thread is used, wait for thread to finish
+  //   previous buffer, swap buffers, and return while thread writes.
+
+  int  itype ;
+  SNFITSIO_WRBUF_DEF TABLE_TMP ;
+
+  // ------------ BEGIN -----------
+
+  if ( WRBUF_SNFITSIO.NEVT_FLUSH == 0 ) { return ; }
+
+  if ( ASYNCWR_SNFITSIO.USE ) {
+    wr_snfitsio_async_wait();
+    for ( itype=0 ; itype < MXTYPE_SNFITSIO; itype++ ) {
+      TABLE_TMP = ASYNCWR_SNFITSIO.TABLE[itype] ;
+      ASYNCWR_SNFITSIO.TABLE[itype] = WRBUF_SNFITSIO.TABLE[itype] ;
+      WRBUF_SNFITSIO.TABLE[itype]   = TABLE_TMP ;
+    }
+    pthread_mutex_lock(&ASYNCWR_SNFITSIO.MUTEX);
+    ASYNCWR_SNFITSIO.BUSY = true ;
+    pthread_cond_signal(&ASYNCWR_SNFITSIO.COND_START);
+    pthread_mutex_unlock(&ASYNCWR_SNFITSIO.MUTEX);
+  }
+  else {
+    wr_snfitsio_write_wrbuf(WRBUF_SNFITSIO.TABLE);
+  }
+
+  for ( itype=0 ; itype < MXTYPE_SNFITSIO; itype++ ) 
+    { WRBUF_SNFITSIO.TABLE[itype].ROW0 = WR_SNFITSIO_TABLEVAL[itype].NROW + 1; }
+
+  WRBUF_SNFITSIO.NEVT_BUF = 0 ;
+
+  return ;
+
+} // end wr_snfitsio_flush
+
+
+// ==============================================
+void wr_snfitsio_write_wrbuf(SNFITSIO_WRBUF_DEF *TABLE_LIST) {
+
+  // Created Oct 15 2026 (moved from wr_snfitsio_flush)
+  // Write buffered rows in TABLE_LIST[itype] with one fits_write_col
+  // call per column, then zero the rows so that buffer can be re-used.
+  // Called by main thread, or by writer thread for ASYNCWR_SNFITSIO.
+
+  int  itype, colnum, NROW, irow, istat, size ;
+  int  firstelem = 1 ;
+  char **ptrStr ;
+  char banner[100];
+  SNFITSIO_WRBUF_DEF *TABLE ;
+  fitsfile *fp ;
+
+  // ------------ BEGIN -----------
+
+  for ( itype=0 ; itype < MXTYPE_SNFITSIO; itype++ ) {
+    TABLE = &TABLE_LIST[itype] ;
+    fp    = fp_wr_snfitsio[itype] ;
+
+    for ( colnum=1; colnum < MXPAR_SNFITSIO; colnum++ ) {
+      NROW = TABLE->NROW_FILL[colnum] ;
+      if ( NROW == 0 ) { continue ; }
+      size  = TABLE->SIZE[colnum] ;
+      istat = 0 ;
+
+      if ( TABLE->DATATYPE[colnum] == TSTRING ) {
+	ptrStr = (char**)malloc(NROW * sizeof(char*) );
+	for(irow=0; irow < NROW; irow++ ) 
+	  { ptrStr[irow] = TABLE->BUF[colnum] + irow*size ; }
+	fits_write_col(fp, TSTRING, colnum, TABLE->ROW0, firstelem, NROW,
+		       ptrStr, &istat);  
+	free(ptrStr);
+      }
+      else {
+	fits_write_col(fp, TABLE->DATATYPE[colnum], colnum, 
+		       TABLE->ROW0, firstelem, NROW,
+		       TABLE->BUF[colnum], &istat);  
+      }
+
+      // local banner because global BANNER is used by main thread
+      sprintf(banner,"fits_write_col for %d %s-rows of colnum=%d", 
+	      NROW, snfitsType[itype], colnum );
+      snfitsio_errorCheck(banner, istat);
+
+      memset(TABLE->BUF[colnum], 0, NROW*size);
+      TABLE->NROW_FILL[colnum] = 0 ;
+    }
+  }
+
+  return ;
+
+} // end wr_snfitsio_write_wrbuf
+
+
+// ==============================================
+void wr_snfitsio_async_init(void) {
+
+  // Created Oct 15 2026
+  // If ENV_ASYNCWR_SNFITSIO is set (and write-buffer is used),
+  // start writer thread for wr_snfitsio_flush. Not used with
+  // PHOT prefetch thread since cfitsio calls from the two threads
+  // would not be serialized; reader entry points RD_SNFITSIO_PREP
+  // and RD_SNFITSIO_EVENT wait for the writer to finish so that
+  // FITS->FITS reformat never reads and writes at the same time.
+
+  char *cenv = getenv(ENV_ASYNCWR_SNFITSIO);
+  int  itype, colnum, USE = 0 ;
+  SNFITSIO_WRBUF_DEF *TABLE ;
+  char fnam[] = "wr_snfitsio_async_init" ;
+
+  // ------------ BEGIN -----------
+
+  ASYNCWR_SNFITSIO.USE    = false ;
+  ASYNCWR_SNFITSIO.BUSY   = false ;
+  ASYNCWR_SNFITSIO.STOP   = false ;
+  ASYNCWR_SNFITSIO.NFLUSH = 0 ;
+
+  if ( cenv == NULL ) { return ; }
+  sscanf(cenv, "%d", &USE);
+  if ( USE <= 0 ) { return ; }
+
+  if ( WRBUF_SNFITSIO.NEVT_FLUSH == 0 ) {
+    printf("   %s ignored because %s = 0\n",
+	   ENV_ASYNCWR_SNFITSIO, ENV_NEVT_WRBUF_SNFITSIO);
+    fflush(stdout);
+    return ;
+  }
+  if ( getenv(ENV_PREFETCH_SNFITSIO) != NULL ) {
+    printf("   %s ignored because %s is set\n",
+	   ENV_ASYNCWR_SNFITSIO, ENV_PREFETCH_SNFITSIO);
+    fflush(stdout);
+    return ;
+  }
+
+  for ( itype=0 ; itype < MXTYPE_SNFITSIO; itype++ ) {
+    TABLE = &ASYNCWR_SNFITSIO.TABLE[itype] ;
+    TABLE->ROW0 = 1 ;
+    for ( colnum=0; colnum < MXPAR_SNFITSIO; colnum++ ) {
+      TABLE->DATATYPE[colnum]  = -9 ;
+      TABLE->SIZE[colnum]      =  0 ;
+      TABLE->MXROW[colnum]     =  0 ;
+      TABLE->NROW_FILL[colnum] =  0 ;
+      if ( TABLE->BUF[colnum] != NULL ) { free(TABLE->BUF[colnum]); }
+      TABLE->BUF[colnum]       = NULL ;
+    }
+  }
+
+  pthread_mutex_init(&ASYNCWR_SNFITSIO.MUTEX,      NULL);
+  pthread_cond_init(&ASYNCWR_SNFITSIO.COND_START,  NULL);
+  pthread_cond_init(&ASYNCWR_SNFITSIO.COND_DONE,   NULL);
+
+  if ( pthread_create(&ASYNCWR_SNFITSIO.THREAD, NULL,
+		      wr_snfitsio_async_thread, NULL) != 0 ) {
+    sprintf(c1err,"Cannot create FITS writer thread.");
+    sprintf(c2err,"Unset %s", ENV_ASYNCWR_SNFITSIO);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  ASYNCWR_SNFITSIO.USE = true ;
+  printf("   %s: write FITS buffer with separate thread.\n",
+	 ENV_ASYNCWR_SNFITSIO);
+  fflush(stdout);
+
+  return ;
+
+} // end wr_snfitsio_async_init
+
+
+// ==============================================
+void *wr_snfitsio_async_thread(void *arg) {
+
+  // Created Oct 15 2026
+  // Writer thread: wait for wr_snfitsio_flush to hand over a
+  // full buffer, write it, and signal when done.
+
+  // ------------ BEGIN -----------
+
+  while ( true ) {
+    pthread_mutex_lock(&ASYNCWR_SNFITSIO.MUTEX);
+    while ( !ASYNCWR_SNFITSIO.BUSY && !ASYNCWR_SNFITSIO.STOP ) {
+      pthread_cond_wait(&ASYNCWR_SNFITSIO.COND_START,
+			&ASYNCWR_SNFITSIO.MUTEX);
+    }
+    if ( !ASYNCWR_SNFITSIO.BUSY ) {   // STOP and nothing to write
+      pthread_mutex_unlock(&ASYNCWR_SNFITSIO.MUTEX);
+      break ;
+    }
+    pthread_mutex_unlock(&ASYNCWR_SNFITSIO.MUTEX);
+
+    wr_snfitsio_write_wrbuf(ASYNCWR_SNFITSIO.TABLE);
+
+    pthread_mutex_lock(&ASYNCWR_SNFITSIO.MUTEX);
+    ASYNCWR_SNFITSIO.BUSY = false ;
+    ASYNCWR_SNFITSIO.NFLUSH++ ;
+    pthread_cond_signal(&ASYNCWR_SNFITSIO.COND_DONE);
+    pthread_mutex_unlock(&ASYNCWR_SNFITSIO.MUTEX);
+  }
+
+  return NULL ;
+
+} // end wr_snfitsio_async_thread
+
+
+// ==============================================
+void wr_snfitsio_async_wait(void) {
+
+  // Created Oct 15 2026
+  // Wait until writer thread is done with its buffer.
+
+  if ( !ASYNCWR_SNFITSIO.USE ) { return ; }
+
+  pthread_mutex_lock(&ASYNCWR_SNFITSIO.MUTEX);
+  while ( ASYNCWR_SNFITSIO.BUSY ) {
+    pthread_cond_wait(&ASYNCWR_SNFITSIO.COND_DONE,
+		      &ASYNCWR_SNFITSIO.MUTEX);
+  }
+  pthread_mutex_unlock(&ASYNCWR_SNFITSIO.MUTEX);
+
+} // end wr_snfitsio_async_wait
+
+
+// ==============================================
+void wr_snfitsio_async_end(void) {
+
+  // Created Oct 15 2026
+  // Wait for last buffer, then stop and join writer thread.
+
+  char fnam[] = "wr_snfitsio_async_end" ;
+
+  // ------------ BEGIN -----------
+
+  if ( !ASYNCWR_SNFITSIO.USE ) { return ; }
+
+  wr_snfitsio_async_wait();
+
+  pthread_mutex_lock(&ASYNCWR_SNFITSIO.MUTEX);
+  ASYNCWR_SNFITSIO.STOP = true ;
+  pthread_cond_signal(&ASYNCWR_SNFITSIO.COND_START);
+  pthread_mutex_unlock(&ASYNCWR_SNFITSIO.MUTEX);
+
+  pthread_join(ASYNCWR_SNFITSIO.THREAD, NULL);
+  ASYNCWR_SNFITSIO.USE = false ;
+
+  printf("   %s: writer thread wrote %d buffers.\n",
+	 fnam, ASYNCWR_SNFITSIO.NFLUSH);
+  fflush(stdout);
+
+  return ;
+
+} // end wr_snfitsio_async_end
+
+
 void wr_snfitsio_fillTable_filters(int *COLNUM_INDX, char *PREFIX, int ITYPE, float *VAL) {
 
   // Created Aug 4 2023
@@ -2909,15 +3382,21 @@ void WR_SNFITSIO_END(int OPTMASK) {
 
   // Close FITS files
   // Dec 20 2021: pass OPTMASK and check for GZIP flag.
+  // Oct 15 2026: check PACK flag to leave one FITS file per job.
 
   int istat, extver, ifile, itype, NTYPE, isys ;
   bool DO_GZIP = ( (OPTMASK & OPTMASK_SNFITSIO_END_GZIP) > 0 ) ;
+  bool DO_PACK = ( (OPTMASK & OPTMASK_SNFITSIO_END_PACK) > 0 ) ;
   fitsfile *fp ;
   char cmd[MXPATHLEN*2];    
   char fnam[] = "WR_SNFITSIO_END";
 
   // ------------ BEGIN -------------
 
+  // Oct 2026: write remaining buffered rows before closing
+  wr_snfitsio_flush();
+  wr_snfitsio_async_end();
+
   printf(" %s: wrote %d events and %d spectra to FITS format\n",
 	 fnam, NSNLC_WR_SNFITSIO_TOT, NSPEC_WR_SNFITSIO_TOT);
   fflush(stdout);
@@ -2937,6 +3416,8 @@ void WR_SNFITSIO_END(int OPTMASK) {
     snfitsio_errorCheck(c1err, istat);  
   }
 
+  if ( DO_PACK ) { wr_snfitsio_pack(); }
+
   for ( itype=0; itype < NTYPE; itype++ ) {
     fp    = fp_wr_snfitsio[itype];
     istat = 0 ;
@@ -2945,6 +3426,15 @@ void WR_SNFITSIO_END(int OPTMASK) {
     snfitsio_errorCheck(c1err, istat);
   }
 
+  if ( DO_PACK ) {
+    // remove PHOT [and SPEC] files after tables are copied to HEAD file
+    ifile = IFILE_WR_SNFITSIO ;
+    for ( itype=ITYPE_SNFITSIO_PHOT; itype < NTYPE; itype++ ) {
+      if ( itype == ITYPE_SNFITSIO_SPECTMP ) { continue; } // removed below
+      remove(wr_snfitsFile_plusPath[ifile][itype]);
+    }
+  }
+
 
   if ( SNFITSIO_SPECTRA_FLAG ) {
     // remove SPECTMP file after its table has been
@@ -2971,6 +3461,71 @@ void wr_snfitsio_end__(int *OPTMASK) {
   WR_SNFITSIO_END(*OPTMASK);
 }
 
+// ===============================================
+void wr_snfitsio_pack(void) {
+
+  // Created Oct 2026
+  // Append PHOT table, and optional SPEC summary + flux tables,
+  // to the end of the HEAD file so that each job leaves a single
+  // FITS file instead of 2-3 files; this reduces the inode (metadata)
+  // load for very large sims. Random access per event is unchanged:
+  // PTROBS_MIN/MAX in HEAD still point to PHOT rows, and 
+  // PTRSPEC_MIN/MAX in SPEC summary still point to flux rows.
+  //
+  // In the primary header of the HEAD file, PHOTFILE and SPECFILE 
+  // are reset to the HEAD file name, and PHOT_HDU & SPEC_HDU give
+  // the absolute HDU number of each table for the reader.
+  // Caller closes all files and removes the PHOT and SPEC files.
+
+  int  ifile = IFILE_WR_SNFITSIO ;
+  int  istat = 0, hdutype, HDU_PHOT=3, HDU_SPEC=4 ;
+  fitsfile *fp_head = fp_wr_snfitsio[ITYPE_SNFITSIO_HEAD] ;
+  fitsfile *fp ;
+  char *headFile = wr_snfitsFile[ifile][ITYPE_SNFITSIO_HEAD] ;
+
+  // ------------ BEGIN -------------
+
+  // PHOT table is 1st extension of PHOT file
+  fp = fp_wr_snfitsio[ITYPE_SNFITSIO_PHOT] ;
+  fits_movabs_hdu(fp, 2, &hdutype, &istat);
+  fits_copy_hdu(fp, fp_head, 0, &istat) ;
+  sprintf(c1err, "Pack PHOT table into HEAD file" );
+  snfitsio_errorCheck(c1err, istat);  
+
+  // SPEC summary & flux tables are 1st & 2nd extensions of SPEC file
+  if ( SNFITSIO_SPECTRA_FLAG ) {
+    fp = fp_wr_snfitsio[ITYPE_SNFITSIO_SPEC] ;
+    fits_movabs_hdu(fp, 2, &hdutype, &istat);
+    fits_copy_hdu(fp, fp_head, 0, &istat) ;
+    fits_movabs_hdu(fp, 3, &hdutype, &istat);
+    fits_copy_hdu(fp, fp_head, 0, &istat) ;
+    sprintf(c1err, "Pack SPEC tables into HEAD file" );
+    snfitsio_errorCheck(c1err, istat);  
+  }
+
+  // update primary header so that readers find the tables
+  fits_movabs_hdu(fp_head, 1, &hdutype, &istat);
+  fits_update_key(fp_head, TSTRING, "PHOTFILE", headFile,
+		  "Photometry FITS file (packed)", &istat );
+  fits_update_key(fp_head, TINT, "PHOT_HDU", &HDU_PHOT,
+		  "HDU number of PHOT table", &istat );
+  if ( SNFITSIO_SPECTRA_FLAG ) {
+    fits_update_key(fp_head, TSTRING, "SPECFILE", headFile,
+		    "Spectra FITS file (packed)", &istat );
+    fits_update_key(fp_head, TINT, "SPEC_HDU", &HDU_SPEC,
+		    "HDU number of SPEC summary table", &istat );
+  }
+  sprintf(c1err, "Update packed keys in %s", headFile );
+  snfitsio_errorCheck(c1err, istat);  
+
+  printf("\t Packed PHOT%s tables into %s\n", 
+	 (SNFITSIO_SPECTRA_FLAG ? "+SPEC" : ""), headFile );
+  fflush(stdout);
+
+  return ;
+
+} // end wr_snfitsio_pack
+
 // ===============================================
 void rd_snfitsFile_close(int ifile, int itype) {
   int istat ;
@@ -3070,6 +3625,8 @@ int RD_SNFITSIO_PREP(int MSKOPT, char *PATH, char *version) {
 
   // ------------- BEGIN -----------
 
+  wr_snfitsio_async_wait(); // Oct 2026: don't read while writing
+
   sprintf(SNFITSIO_PHOT_VERSION, "%s", version);
   sprintf(SNFITSIO_DATA_PATH,    "%s", PATH);
   
@@ -3132,6 +3689,10 @@ int RD_SNFITSIO_PREP(int MSKOPT, char *PATH, char *version) {
   // Mar 2022: check option to treat sim like real data
   SNFITSIO_noSIMFLAG_SNANA  = ( (MSKOPT & 256) > 0) ;
 
+  // Oct 2026: check ENV for optional PHOT prefetch thread
+  rd_snfitsio_prefetch_init();
+  rd_snfitsio_blockread_init();
+
   // loop over all header files to get total number of SN.
   // Close each file after reading the NAXIS2 key.
 
@@ -3197,6 +3758,9 @@ int RD_SNFITSIO_EVENT(int OPT, int isn) {
   //
   // Mar 04 2025: open and close FITS files here instead of in RD_SNFITSIO_PARVAL
   // Mar 09 2025: fix memory leak bug from Mar 04
+  // Oct 14 2026: PHOT reads may come from prefetch ring buffer; see
+  //              rd_snfitsio_prefetch_init.
+  // Oct 15 2026: wait for FITS writer thread (if any) before reading.
 
   bool LRD_HEAD  = ( OPT & OPTMASK_SNFITSIO_HEAD );
   bool LRD_PHOT  = ( OPT & OPTMASK_SNFITSIO_PHOT );
@@ -3222,6 +3786,8 @@ int RD_SNFITSIO_EVENT(int OPT, int isn) {
 
   // ------------- BEGIN ------------
 
+  wr_snfitsio_async_wait();
+
   // Mar 9 2025:
   // close out last version; this only matters if processing multiple data versions
   if ( LVER_DONE ) { 
@@ -3886,6 +4452,7 @@ int RD_SNFITSIO_EVENT(int OPT, int isn) {
 
   if ( NSPEC > 0 ) {
 
+    lock_fits_snfitsio(+1); // serialize with PHOT prefetch thread
     for(irow = ROWMIN; irow <= ROWMAX; irow++ ) {
 
       NBLAM = RDSPEC_SNFITSIO_HEADER.NLAMBIN[irow] ;
@@ -3908,6 +4475,7 @@ int RD_SNFITSIO_EVENT(int OPT, int isn) {
 			   ,GENSPEC.GENFLAM_LIST[ispec]   ) ;
       ispec++ ;
     } // end irow loop over rows
+    lock_fits_snfitsio(-1);
 
   } // end LRD_SPEC
 
@@ -3936,6 +4504,9 @@ void RD_SNFITSIO_CLOSE(char *version) {
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
 
+  rd_snfitsio_prefetch_stop(); // Oct 2026: stop thread before closing
+  rd_snfitsio_blockread_free();
+
   rd_snfitsFile_close(IFILE_RD_SNFITSIO, ITYPE_SNFITSIO_HEAD );
   rd_snfitsFile_close(IFILE_RD_SNFITSIO, ITYPE_SNFITSIO_PHOT );   
 
@@ -4134,9 +4705,10 @@ void rd_snfitsio_open(int ifile, int photflag_open, int vbose) {
   // Jun 24, 2022: call rd_snfitsio_check_gzip() to abort if both
   //                unzip and gzip files exist.
   // July 23 2025: read ZP_FLUXCAL
+  // Oct 15 2026: read optional PHOT_HDU & SPEC_HDU for packed file.
 
   fitsfile *fp ;
-  int istat, itype, istat_spec, NVAR, hdutype, nrow, nmove = 1, FLAG  ;
+  int istat, itype, istat_spec, NVAR, hdutype, nrow, FLAG  ;
   char keyname[60], comment[200], *ptrFile ;
   char fnam[] = "rd_snfitsio_open" ;
 
@@ -4269,6 +4841,15 @@ void rd_snfitsio_open(int ifile, int photflag_open, int vbose) {
   sprintf(rd_snfitsFile_plusPath[ifile][itype], "%s/%s", 
 	  SNFITSIO_DATA_PATH, rd_snfitsFile[ifile][itype] );
 
+  // Oct 2026: if PHOT & SPEC are packed into HEAD file, read HDU numbers;
+  // default is 1st extension of separate file.
+  fits_read_key(fp, TINT, "PHOT_HDU", &RD_SNFITSIO_HDU_PHOT, comment, &istat);
+  if ( istat != 0 ) { RD_SNFITSIO_HDU_PHOT = 2; }
+  istat = 0 ;
+  fits_read_key(fp, TINT, "SPEC_HDU", &RD_SNFITSIO_HDU_SPEC, comment, &istat);
+  if ( istat != 0 ) { RD_SNFITSIO_HDU_SPEC = 2; }
+  istat = 0 ;
+
 
   // - - - - - - - - - - - - - - - - - -  - -
   // read name of optional SPEC file from HEADER file (Apri 2019)
@@ -4384,11 +4965,14 @@ void rd_snfitsio_open(int ifile, int photflag_open, int vbose) {
   }
 
   // move to table in each file
+  int HDU ;
   for ( itype = 0; itype < NFILE_OPEN ; itype++ ) {
     istat   = 0 ;
     fp      = fp_rd_snfitsio[itype] ;
-    fits_movrel_hdu( fp, nmove, &hdutype, &istat );
-    sprintf(c1err,"movrel to %s table (%s)", snfitsType[itype], fnam ) ;
+    HDU     = 2 ;
+    if ( itype == ITYPE_SNFITSIO_PHOT ) { HDU = RD_SNFITSIO_HDU_PHOT; }
+    fits_movabs_hdu( fp, HDU, &hdutype, &istat );
+    sprintf(c1err,"move to %s table (%s)", snfitsType[itype], fnam ) ;
     snfitsio_errorCheck(c1err, istat);
   }
 
@@ -4706,6 +5290,7 @@ void rd_snfitsio_tblpar(int ifile, int itype) {
 
   // Read and store info for each column.
   // Mar 2022: if noSIM option, ignore column names begining with SIM
+  // Oct 15 2026: treat scaled 1I column as 1E (see WRITE_MASK_PHOT_REDUCED)
 
   long NCOLUMN, NCOLUMN_USE ;
   int  istat, icol, iform, npar, ncol ;
@@ -4759,6 +5344,16 @@ void rd_snfitsio_tblpar(int ifile, int itype) {
     sprintf(c1err, "read %s key", keyname);
     snfitsio_errorCheck(c1err, istat);
 
+    // Oct 2026: scaled 1I column (TSCALn key) is float for reader;
+    // cfitsio applies TSCAL/TZERO when reading as float.
+    if ( strcmp(ptrTmp,"1I") == 0 ) {
+      double TSCAL ;
+      sprintf(keyname,"TSCAL%d", icol );
+      fits_read_key(fp, TDOUBLE, keyname, &TSCAL, comment, &istat );
+      if ( istat == 0 ) { sprintf(ptrTmp,"1E"); }
+      istat = 0 ;
+    }
+
     // keep track of how many header parameters are of each form
     iform = formIndex_snfitsio(ptrTmp);
     RD_SNFITSIO_TABLEDEF[itype].iform[icol] = iform ;
@@ -5020,12 +5615,57 @@ void rd_snfitsio_tblcol(int itype, int icol, int firstRow, int lastRow) {
   // RD_SNFITSIO_TABLEVAL[itype].value_FORM[ipar][1], 
   //
   // Feb 20 2013:  fits_read_col_usht -> fits_read_col_sht
-  //
+  // Oct 14 2026:  move cfitsio calls to rd_snfitsio_colbuf so that
+  //               prefetch thread can read into its own buffers.
+
+  int  iform, ipar ;
+  void *BUF = NULL ;
+  char fnam[] = "rd_snfitsio_tblcol"  ;
+
+  // ------------ BEGIN --------------
+
+  iform = RD_SNFITSIO_TABLEDEF[itype].iform[icol];
+
+  // get sparse ipar for this form.
+  ipar  = RD_SNFITSIO_TABLEVAL[itype].IPARINV[iform][icol] ;
+
+  if ( iform == IFORM_A ) 
+    { BUF = &RD_SNFITSIO_TABLEVAL_A[itype][ipar][1] ; }
+  else if ( iform == IFORM_1J ) 
+    { BUF = &RD_SNFITSIO_TABLEVAL_1J[itype][ipar][1] ; }
+  else if ( iform == IFORM_1I ) 
+    { BUF = &RD_SNFITSIO_TABLEVAL_1I[itype][ipar][1] ; }
+  else if ( iform == IFORM_1E ) 
+    { BUF = &RD_SNFITSIO_TABLEVAL_1E[itype][ipar][1] ; }
+  else if ( iform == IFORM_1D ) 
+    { BUF = &RD_SNFITSIO_TABLEVAL_1D[itype][ipar][1] ; }
+  else if ( iform == IFORM_1K ) 
+    { BUF = &RD_SNFITSIO_TABLEVAL_1K[itype][ipar][1] ; }
+  else {
+    sprintf(c1err,"Invalid iform = %d", iform);
+    sprintf(c2err,"itype=%d  icol=%d", itype, icol);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  rd_snfitsio_colbuf(itype, icol, firstRow, lastRow, BUF);
+
+} // end of rd_snfitsio_tblcol
+
+
+// ================================
+void rd_snfitsio_colbuf(int itype, int icol, int firstRow, int lastRow,
+			void *BUF) {
+
+  // Created Oct 14 2026 (from rd_snfitsio_tblcol)
+  // Read rows firstRow to lastRow of table column 'icol' into
+  // BUF, which must have the native cast of the column;
+  // for IFORM_A, BUF is an array of char pointers.
+  // There is no abort here because this function is also
+  // called by the prefetch thread.
 
   long NROW, FIRSTROW, FIRSTELEM ;
-  int  istat, iform, ipar, anynul ;
+  int  istat, iform, anynul ;
   fitsfile *fp ;
-  char fnam[] = "rd_snfitsio_tblcol"  ;
 
   // ------------ BEGIN --------------
 
@@ -5039,51 +5679,637 @@ void rd_snfitsio_tblcol(int itype, int icol, int firstRow, int lastRow) {
   iform     = RD_SNFITSIO_TABLEDEF[itype].iform[icol];
   istat = 0;
 
-  // get sparse ipar for this form.
-  ipar =     RD_SNFITSIO_TABLEVAL[itype].IPARINV[iform][icol] ;
-
-
   if ( iform == IFORM_A ) {
     fits_read_col_str(fp, icol, FIRSTROW, FIRSTELEM, NROW, NULL_A,
-		      &RD_SNFITSIO_TABLEVAL_A[itype][ipar][1], 
-		      &anynul, &istat );
+		      (char**)BUF, &anynul, &istat );
   }
   else if ( iform == IFORM_1J ) {
     fits_read_col_int(fp, icol, FIRSTROW, FIRSTELEM, NROW, NULL_1J,
-		      &RD_SNFITSIO_TABLEVAL_1J[itype][ipar][1], 
-		      &anynul, &istat );
+		      (int*)BUF, &anynul, &istat );
   }
   else if ( iform == IFORM_1I ) {
     // usht -> sht (Feb 20 2013)
     fits_read_col_sht(fp, icol, FIRSTROW, FIRSTELEM, NROW, NULL_1I,
-		      &RD_SNFITSIO_TABLEVAL_1I[itype][ipar][1], 
-		      &anynul, &istat );
+		      (short*)BUF, &anynul, &istat );
   }  
   else if ( iform == IFORM_1E ) {
     fits_read_col_flt(fp, icol, FIRSTROW, FIRSTELEM, NROW, NULL_1E,
-		      &RD_SNFITSIO_TABLEVAL_1E[itype][ipar][1], 
-		      &anynul, &istat );
+		      (float*)BUF, &anynul, &istat );
   }
   else if ( iform == IFORM_1D ) {
     fits_read_col_dbl(fp, icol, FIRSTROW, FIRSTELEM, NROW, NULL_1D,
-		      &RD_SNFITSIO_TABLEVAL_1D[itype][ipar][1], 
-		      &anynul, &istat );    
+		      (double*)BUF, &anynul, &istat );    
   }
   else if ( iform == IFORM_1K ) {
     fits_read_col_lnglng(fp, icol, FIRSTROW, FIRSTELEM, NROW, NULL_1K,
-		      &RD_SNFITSIO_TABLEVAL_1K[itype][ipar][1], 
-		      &anynul, &istat );
+			 (long long*)BUF, &anynul, &istat );
   }
 
-  else {
-    sprintf(c1err,"Invalid iform = %d", iform);
-    sprintf(c2err,"itype=%d  icol=%d", itype, icol);
+} // end of rd_snfitsio_colbuf
+
+
+// ===================================================
+void rd_snfitsio_prefetch_init(void) {
+
+  // Created Oct 14 2026
+  // Check ENV_PREFETCH_SNFITSIO for the number of events (NRING)
+  // whose PHOT rows are read ahead by a background thread while
+  // the current event is processed. Default (ENV not set) is the
+  // original synchronous read. Only PHOT rows are prefetched
+  // because the entire HEAD table is read when each file is opened.
+
+  char *cenv = getenv(ENV_PREFETCH_SNFITSIO);
+  int  NRING = 0 ;
+  char fnam[] = "rd_snfitsio_prefetch_init" ;
+
+  // ------------ BEGIN --------------
+
+  PREFETCH_SNFITSIO.USE      = false ;
+  PREFETCH_SNFITSIO.ACTIVE   = false ;
+  PREFETCH_SNFITSIO.NRING    = 0 ;
+  PREFETCH_SNFITSIO.SLOT_USE = NULL ;
+  PREFETCH_SNFITSIO.ISN_USE  = -9 ;
+
+  if ( cenv == NULL ) { return ; }
+  sscanf(cenv, "%d", &NRING);
+  if ( NRING <= 1 ) { return ; }
+
+  if ( NRING > MXRING_PREFETCH_SNFITSIO ) {
+    sprintf(c1err,"%s = %d exceeds bound", ENV_PREFETCH_SNFITSIO, NRING);
+    sprintf(c2err,"Check MXRING_PREFETCH_SNFITSIO = %d",
+	    MXRING_PREFETCH_SNFITSIO );
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
-  
-  
 
-} // end of rd_snfitsio_tblcol
+  if ( !PREFETCH_SNFITSIO.INIT_MUTEX ) {
+    pthread_mutex_init(&PREFETCH_SNFITSIO.MUTEX,      NULL);
+    pthread_mutex_init(&PREFETCH_SNFITSIO.MUTEX_FITS, NULL);
+    pthread_cond_init(&PREFETCH_SNFITSIO.COND_FILL,   NULL);
+    pthread_cond_init(&PREFETCH_SNFITSIO.COND_READY,  NULL);
+    PREFETCH_SNFITSIO.INIT_MUTEX = true ;
+  }
+
+  PREFETCH_SNFITSIO.USE   = true ;
+  PREFETCH_SNFITSIO.NRING = NRING ;
+
+  printf("   %s: prefetch PHOT rows for next %d events.\n", 
+	 ENV_PREFETCH_SNFITSIO, NRING);
+  fflush(stdout);
+
+  return ;
+
+} // end rd_snfitsio_prefetch_init
+
+
+// ===================================================
+void rd_snfitsio_prefetch_start(void) {
+
+  // Created Oct 14 2026
+  // Allocate ring-buffer slots for current PHOT file and launch
+  // thread. Called on first PHOT read in each file so that all
+  // cfitsio calls to open/read HEAD & SPEC tables are finished.
+
+  int  itype  = ITYPE_SNFITSIO_PHOT ;
+  int  NRING  = PREFETCH_SNFITSIO.NRING ;
+  int  MXROW  = MXOBS_SNFITSIO ;
+  int  iform, npar, ipar, icol, NCOL=0, islot, i ;
+  PREFETCH_SLOT_SNFITSIO *SLOT ;
+  char fnam[] = "rd_snfitsio_prefetch_start" ;
+
+  // ------------ BEGIN --------------
+
+  if ( MXROW <= 0 ) { MXROW = 10; } // same as rd_snfitsio_malloc
+
+  // store list of PHOT columns (skip SIM columns if noSIM option)
+  for ( iform=1; iform < MXFORM_SNFITSIO; iform++ ) {
+    npar = RD_SNFITSIO_TABLEVAL[itype].NPAR[iform] ;
+    for ( ipar=1; ipar <= npar; ipar++ ) {
+      icol = RD_SNFITSIO_TABLEVAL[itype].IPAR[iform][ipar] ;
+      PREFETCH_SNFITSIO.ICOL_LIST[NCOL] = icol;  NCOL++ ;
+    }
+  }
+
+  for ( islot=0; islot < NRING; islot++ ) {
+    SLOT = &PREFETCH_SNFITSIO.SLOT[islot] ;
+    SLOT->isn_file = -9 ;
+    SLOT->STATE    = STATE_PREFETCH_EMPTY ;
+    SLOT->firstRow = SLOT->NROW = 0 ;
+
+    for ( i=0; i < NCOL; i++ ) {
+      icol  = PREFETCH_SNFITSIO.ICOL_LIST[i] ;
+      iform = RD_SNFITSIO_TABLEDEF[itype].iform[icol] ;
+      SLOT->COLBUF[icol] = malloc_colbuf_snfitsio(iform, MXROW);
+    }
+  } // end islot
+
+  PREFETCH_SNFITSIO.NCOL        = NCOL ;
+  PREFETCH_SNFITSIO.MXROW       = MXROW ;
+  PREFETCH_SNFITSIO.NSN_FILE    = NSNLC_RD_SNFITSIO[IFILE_RD_SNFITSIO] ;
+  PREFETCH_SNFITSIO.ISN_NEXT    = 1 ;
+  PREFETCH_SNFITSIO.ISN_CURRENT = 1 ;
+  PREFETCH_SNFITSIO.ISN_USE     = -9 ;
+  PREFETCH_SNFITSIO.SLOT_USE    = NULL ;
+  PREFETCH_SNFITSIO.NEVT_RING   = 0 ;
+  PREFETCH_SNFITSIO.NEVT_SYNC   = 0 ;
+  PREFETCH_SNFITSIO.STOP        = false ;
+
+  if ( pthread_create(&PREFETCH_SNFITSIO.THREAD, NULL,
+		      rd_snfitsio_prefetch_thread, NULL) != 0 ) {
+    sprintf(c1err,"Unable to create prefetch thread for");
+    sprintf(c2err,"%s", rd_snfitsFile[IFILE_RD_SNFITSIO][itype]);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  PREFETCH_SNFITSIO.ACTIVE = true ;
+
+  return ;
+
+} // end rd_snfitsio_prefetch_start
+
+
+// ===================================================
+void rd_snfitsio_prefetch_stop(void) {
+
+  // Created Oct 14 2026
+  // Stop prefetch thread and free ring buffers; 
+  // must be called before PHOT file is closed.
+
+  int  itype = ITYPE_SNFITSIO_PHOT ;
+  int  islot, i, icol, iform ;
+  PREFETCH_SLOT_SNFITSIO *SLOT ;
+
+  // ------------ BEGIN --------------
+
+  if ( !PREFETCH_SNFITSIO.ACTIVE ) { return ; }
+
+  pthread_mutex_lock(&PREFETCH_SNFITSIO.MUTEX);
+  PREFETCH_SNFITSIO.STOP = true ;
+  pthread_cond_broadcast(&PREFETCH_SNFITSIO.COND_FILL);
+  pthread_mutex_unlock(&PREFETCH_SNFITSIO.MUTEX);
+  pthread_join(PREFETCH_SNFITSIO.THREAD, NULL);
+
+  PREFETCH_SNFITSIO.ACTIVE = false ;
+
+  for ( islot=0; islot < PREFETCH_SNFITSIO.NRING; islot++ ) {
+    SLOT = &PREFETCH_SNFITSIO.SLOT[islot] ;
+    for ( i=0; i < PREFETCH_SNFITSIO.NCOL; i++ ) {
+      icol  = PREFETCH_SNFITSIO.ICOL_LIST[i] ;
+      iform = RD_SNFITSIO_TABLEDEF[itype].iform[icol] ;
+      free_colbuf_snfitsio(iform, SLOT->COLBUF[icol]);
+      SLOT->COLBUF[icol] = NULL ;
+    }
+  }
+
+  printf("\t Prefetch summary: %d events from ring buffer, "
+	 "%d synchronous reads.\n",
+	 PREFETCH_SNFITSIO.NEVT_RING, PREFETCH_SNFITSIO.NEVT_SYNC );
+  fflush(stdout);
+
+  PREFETCH_SNFITSIO.SLOT_USE = NULL ;
+  PREFETCH_SNFITSIO.ISN_USE  = -9 ;
+
+  return ;
+
+} // end rd_snfitsio_prefetch_stop
+
+
+// ===================================================
+void *rd_snfitsio_prefetch_thread(void *arg) {
+
+  // Created Oct 14 2026
+  // Background thread: read PHOT rows for events ISN_NEXT, ISN_NEXT+1 ...
+  // into ring slot isn_file % NRING, staying less than NRING events
+  // ahead of ISN_CURRENT so that the slot in use is never overwritten.
+
+  int  NRING = PREFETCH_SNFITSIO.NRING ;
+  int  isn_file ;
+  PREFETCH_SLOT_SNFITSIO *SLOT ;
+
+  // ------------ BEGIN --------------
+
+  while ( 1 ) {
+
+    pthread_mutex_lock(&PREFETCH_SNFITSIO.MUTEX);
+    while ( !PREFETCH_SNFITSIO.STOP &&
+	    ( PREFETCH_SNFITSIO.ISN_NEXT > PREFETCH_SNFITSIO.NSN_FILE ||
+	      PREFETCH_SNFITSIO.ISN_NEXT >= 
+	      PREFETCH_SNFITSIO.ISN_CURRENT + NRING ) ) {
+      pthread_cond_wait(&PREFETCH_SNFITSIO.COND_FILL, 
+			&PREFETCH_SNFITSIO.MUTEX);
+    }
+
+    if ( PREFETCH_SNFITSIO.STOP ) 
+      { pthread_mutex_unlock(&PREFETCH_SNFITSIO.MUTEX);  break; }
+
+    isn_file = PREFETCH_SNFITSIO.ISN_NEXT ;
+    PREFETCH_SNFITSIO.ISN_NEXT++ ;
+    SLOT = &PREFETCH_SNFITSIO.SLOT[isn_file % NRING] ;
+    SLOT->isn_file = isn_file ;
+    SLOT->STATE    = STATE_PREFETCH_LOADING ;
+    pthread_mutex_unlock(&PREFETCH_SNFITSIO.MUTEX);
+
+    pthread_mutex_lock(&PREFETCH_SNFITSIO.MUTEX_FITS);
+    rd_snfitsio_prefetch_event(isn_file, SLOT);
+    pthread_mutex_unlock(&PREFETCH_SNFITSIO.MUTEX_FITS);
+
+    pthread_mutex_lock(&PREFETCH_SNFITSIO.MUTEX);
+    SLOT->STATE = STATE_PREFETCH_READY ;
+    pthread_cond_broadcast(&PREFETCH_SNFITSIO.COND_READY);
+    pthread_mutex_unlock(&PREFETCH_SNFITSIO.MUTEX);
+  }
+
+  return NULL ;
+
+} // end rd_snfitsio_prefetch_thread
+
+
+// ===================================================
+void rd_snfitsio_prefetch_event(int isn_file, PREFETCH_SLOT_SNFITSIO *SLOT) {
+
+  // Created Oct 14 2026
+  // Read all PHOT columns for local SN index isn_file into SLOT.
+  // Row range is from the HEAD table, which is already in memory.
+
+  int  itype = ITYPE_SNFITSIO_PHOT ;
+  int  *IPTR = RD_SNFITSIO_TABLEVAL[ITYPE_SNFITSIO_HEAD].IPARINV[IFORM_1J] ; 
+  int  iparRow, firstRow, lastRow, i, icol ;
+
+  // ------------ BEGIN --------------
+
+  iparRow  = *(IPTR+IPAR_SNFITSIO_PTROBS_MIN) ; 
+  firstRow = RD_SNFITSIO_TABLEVAL_1J[ITYPE_SNFITSIO_HEAD][iparRow][isn_file];
+  iparRow  = *(IPTR+IPAR_SNFITSIO_PTROBS_MAX) ; 
+  lastRow  = RD_SNFITSIO_TABLEVAL_1J[ITYPE_SNFITSIO_HEAD][iparRow][isn_file];
+
+  SLOT->firstRow = firstRow ;
+  SLOT->NROW     = lastRow - firstRow + 1 ;
+
+  // protect against corrupt row pointer; main thread reads synchronously
+  if ( SLOT->NROW <= 0 || SLOT->NROW > PREFETCH_SNFITSIO.MXROW ) 
+    { SLOT->NROW = -9;  return ; }
+
+  for ( i=0; i < PREFETCH_SNFITSIO.NCOL; i++ ) {
+    icol = PREFETCH_SNFITSIO.ICOL_LIST[i] ;
+    rd_snfitsio_colbuf(itype, icol, firstRow, lastRow, SLOT->COLBUF[icol]);
+  }
+
+  return ;
+
+} // end rd_snfitsio_prefetch_event
+
+
+// ===================================================
+PREFETCH_SLOT_SNFITSIO *rd_snfitsio_prefetch_get(int isn_file) {
+
+  // Created Oct 14 2026
+  // Return ring slot for local SN index isn_file after waiting
+  // for thread to finish reading it. Return NULL if this event
+  // was skipped by the thread (e.g., reading backwards), in which
+  // case caller must read synchronously. If caller jumps ahead,
+  // thread is moved to isn_file.
+
+  int NRING = PREFETCH_SNFITSIO.NRING ;
+  PREFETCH_SLOT_SNFITSIO *SLOT = &PREFETCH_SNFITSIO.SLOT[isn_file % NRING] ;
+
+  // ------------ BEGIN --------------
+
+  if ( isn_file < 1 || isn_file > PREFETCH_SNFITSIO.NSN_FILE ) 
+    { return NULL; }
+
+  pthread_mutex_lock(&PREFETCH_SNFITSIO.MUTEX);
+
+  PREFETCH_SNFITSIO.ISN_CURRENT = isn_file ;
+  if ( SLOT->isn_file != isn_file && isn_file >= PREFETCH_SNFITSIO.ISN_NEXT ) 
+    { PREFETCH_SNFITSIO.ISN_NEXT = isn_file ; }
+  pthread_cond_broadcast(&PREFETCH_SNFITSIO.COND_FILL);
+
+  if ( SLOT->isn_file == isn_file || isn_file >= PREFETCH_SNFITSIO.ISN_NEXT ) {
+    while ( SLOT->isn_file != isn_file || 
+	    SLOT->STATE    != STATE_PREFETCH_READY ) {
+      pthread_cond_wait(&PREFETCH_SNFITSIO.COND_READY, 
+			&PREFETCH_SNFITSIO.MUTEX);
+    }
+    if ( SLOT->NROW < 0 ) { SLOT = NULL; }
+  }
+  else
+    { SLOT = NULL; }
+
+  pthread_mutex_unlock(&PREFETCH_SNFITSIO.MUTEX);
+
+  if ( SLOT == NULL ) 
+    { PREFETCH_SNFITSIO.NEVT_SYNC++ ; }
+  else
+    { PREFETCH_SNFITSIO.NEVT_RING++ ; }
+
+  return SLOT ;
+
+} // end rd_snfitsio_prefetch_get
+
+
+// ===================================================
+void rd_snfitsio_prefetch_tblcol(int isn_file, int icol, 
+				 int firstRow, int lastRow) {
+
+  // Created Oct 14 2026
+  // Prefetch version of rd_snfitsio_tblcol for PHOT table:
+  // copy column from ring slot to RD_SNFITSIO_TABLEVAL_XXX arrays.
+  // If event is not in ring, read synchronously while holding
+  // MUTEX_FITS.
+
+  int  itype = ITYPE_SNFITSIO_PHOT ;
+  int  NROW ;
+  PREFETCH_SLOT_SNFITSIO *SLOT ;
+  char fnam[] = "rd_snfitsio_prefetch_tblcol" ;
+
+  // ------------ BEGIN --------------
+
+  if ( !PREFETCH_SNFITSIO.ACTIVE ) { rd_snfitsio_prefetch_start(); }
+
+  if ( PREFETCH_SNFITSIO.ISN_USE != isn_file ) {
+    PREFETCH_SNFITSIO.SLOT_USE = rd_snfitsio_prefetch_get(isn_file);
+    PREFETCH_SNFITSIO.ISN_USE  = isn_file ;
+  }
+  SLOT = PREFETCH_SNFITSIO.SLOT_USE ;
+
+  if ( SLOT == NULL ) {
+    lock_fits_snfitsio(+1);
+    rd_snfitsio_tblcol(itype, icol, firstRow, lastRow);
+    lock_fits_snfitsio(-1);
+    return ;
+  }
+
+  NROW  = lastRow - firstRow + 1 ;
+  if ( SLOT->firstRow != firstRow || SLOT->NROW != NROW ) {
+    sprintf(c1err,"Prefetch rows %d-%d do not match rows %d-%d",
+	    SLOT->firstRow, SLOT->firstRow + SLOT->NROW - 1, 
+	    firstRow, lastRow );
+    sprintf(c2err,"for isn_file=%d, icol=%d", isn_file, icol);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  copy_colbuf_snfitsio(itype, icol, SLOT->COLBUF[icol], 0, NROW);
+
+  return ;
+
+} // end rd_snfitsio_prefetch_tblcol
+
+
+// ===================================================
+void lock_fits_snfitsio(int flag) {
+
+  // Created Oct 14 2026
+  // flag = +1 -> lock cfitsio mutex, -1 -> unlock.
+  // Only used while prefetch thread is active because cfitsio
+  // is not guaranteed to be thread-safe.
+
+  if ( !PREFETCH_SNFITSIO.ACTIVE ) { return; }
+
+  if ( flag > 0 )
+    { pthread_mutex_lock(&PREFETCH_SNFITSIO.MUTEX_FITS);   }
+  else
+    { pthread_mutex_unlock(&PREFETCH_SNFITSIO.MUTEX_FITS); }
+
+} // end lock_fits_snfitsio
+
+
+// ===================================================
+void *malloc_colbuf_snfitsio(int iform, int NROW) {
+
+  // Created Oct 14 2026
+  // Return buffer for NROW values of FITS form iform. 
+  // For IFORM_A, return array of NROW pointers into one
+  // contiguous block of strings (as needed by fits_read_col_str).
+
+  char **PTR_A ;
+  int  MEM, irow ;
+
+  // ------------ BEGIN --------------
+
+  if ( iform == IFORM_A ) {
+    PTR_A    = (char**)malloc( NROW * sizeof(char*) );
+    PTR_A[0] = (char* )malloc( NROW * 40 );
+    for(irow=1; irow < NROW; irow++ ) { PTR_A[irow] = PTR_A[0] + 40*irow; }
+    return (void*)PTR_A ;
+  }
+
+  if      ( iform == IFORM_1J ) { MEM = sizeof(int);       }
+  else if ( iform == IFORM_1I ) { MEM = sizeof(short);     }
+  else if ( iform == IFORM_1E ) { MEM = sizeof(float);     }
+  else if ( iform == IFORM_1D ) { MEM = sizeof(double);    }
+  else                          { MEM = sizeof(long long); }
+
+  return malloc( NROW * MEM );
+
+} // end malloc_colbuf_snfitsio
+
+void free_colbuf_snfitsio(int iform, void *BUF) {
+  if ( BUF == NULL ) { return; }
+  if ( iform == IFORM_A ) { free( ((char**)BUF)[0] ); }
+  free(BUF);
+} // end free_colbuf_snfitsio
+
+
+// ===================================================
+void copy_colbuf_snfitsio(int itype, int icol, void *BUF, int OFFSET, int NROW) {
+
+  // Created Oct 14 2026
+  // Copy NROW values starting at BUF[OFFSET] into 
+  // RD_SNFITSIO_TABLEVAL_XXX[itype][ipar][1:NROW], 
+  // i.e., same storage as filled by rd_snfitsio_tblcol.
+
+  int  iform = RD_SNFITSIO_TABLEDEF[itype].iform[icol];
+  int  ipar  = RD_SNFITSIO_TABLEVAL[itype].IPARINV[iform][icol] ;
+  int  irow ;
+  char **PTR_A ;
+
+  // ------------ BEGIN --------------
+
+  if ( iform == IFORM_A ) {
+    PTR_A = (char**)BUF ;
+    for ( irow=0; irow < NROW; irow++ ) { 
+      sprintf(RD_SNFITSIO_TABLEVAL_A[itype][ipar][irow+1], "%s", 
+	      PTR_A[OFFSET+irow]); 
+    }
+  }
+  else if ( iform == IFORM_1J ) {
+    memcpy(&RD_SNFITSIO_TABLEVAL_1J[itype][ipar][1], (int*)BUF + OFFSET,
+	   NROW*sizeof(int) );
+  }
+  else if ( iform == IFORM_1I ) {
+    memcpy(&RD_SNFITSIO_TABLEVAL_1I[itype][ipar][1], (short*)BUF + OFFSET,
+	   NROW*sizeof(short) );
+  }
+  else if ( iform == IFORM_1E ) {
+    memcpy(&RD_SNFITSIO_TABLEVAL_1E[itype][ipar][1], (float*)BUF + OFFSET,
+	   NROW*sizeof(float) );
+  }
+  else if ( iform == IFORM_1D ) {
+    memcpy(&RD_SNFITSIO_TABLEVAL_1D[itype][ipar][1], (double*)BUF + OFFSET,
+	   NROW*sizeof(double) );
+  }
+  else if ( iform == IFORM_1K ) {
+    memcpy(&RD_SNFITSIO_TABLEVAL_1K[itype][ipar][1], (long long*)BUF + OFFSET,
+	   NROW*sizeof(long long) );
+  }
+
+  return ;
+
+} // end copy_colbuf_snfitsio
+
+
+// ===================================================
+void rd_snfitsio_blockread_init(void) {
+
+  // Created Oct 14 2026
+  // Check ENV_NEVT_BLOCK_SNFITSIO for number of events per 
+  // PHOT block read. Default (ENV not set) is to read each 
+  // column for each event.
+
+  char *cenv = getenv(ENV_NEVT_BLOCK_SNFITSIO);
+  int  icol, NEVT = 0 ;
+
+  // ------------ BEGIN --------------
+
+  BLOCKREAD_SNFITSIO.NEVT_BLOCK = 0 ;
+  BLOCKREAD_SNFITSIO.ISN_MIN    = BLOCKREAD_SNFITSIO.ISN_MAX = -9 ;
+  BLOCKREAD_SNFITSIO.ROWMIN     = BLOCKREAD_SNFITSIO.ROWMAX  = -9 ;
+  BLOCKREAD_SNFITSIO.NBLOCK     = BLOCKREAD_SNFITSIO.NCOLREAD = 0 ;
+  for(icol=0; icol < MXPAR_SNFITSIO; icol++ ) {
+    BLOCKREAD_SNFITSIO.LOADED[icol] = false ;
+    BLOCKREAD_SNFITSIO.MXROW[icol]  = 0 ;
+    BLOCKREAD_SNFITSIO.COLBUF[icol] = NULL ;
+  }
+
+  if ( cenv == NULL ) { return ; }
+  sscanf(cenv, "%d", &NEVT);
+  if ( NEVT <= 1 ) { return ; }
+
+  BLOCKREAD_SNFITSIO.NEVT_BLOCK = NEVT ;
+  printf("   %s: read PHOT columns in blocks of %d events.\n",
+	 ENV_NEVT_BLOCK_SNFITSIO, NEVT);
+  fflush(stdout);
+
+  return ;
+
+} // end rd_snfitsio_blockread_init
+
+
+// ===================================================
+void rd_snfitsio_blockread_free(void) {
+
+  // Created Oct 14 2026
+  // Free column blocks; called before PHOT file is closed
+  // because column forms can change in next file.
+
+  int itype = ITYPE_SNFITSIO_PHOT ;
+  int icol, iform ;
+
+  // ------------ BEGIN --------------
+
+  if ( BLOCKREAD_SNFITSIO.NEVT_BLOCK == 0 ) { return ; }
+
+  for(icol=0; icol < MXPAR_SNFITSIO; icol++ ) {
+    if ( BLOCKREAD_SNFITSIO.COLBUF[icol] == NULL ) { continue; }
+    iform = RD_SNFITSIO_TABLEDEF[itype].iform[icol];
+    free_colbuf_snfitsio(iform, BLOCKREAD_SNFITSIO.COLBUF[icol]);
+    BLOCKREAD_SNFITSIO.COLBUF[icol] = NULL ;
+    BLOCKREAD_SNFITSIO.MXROW[icol]  = 0 ;
+    BLOCKREAD_SNFITSIO.LOADED[icol] = false ;
+  }
+
+  printf("\t Block-read summary: %d blocks, %d column reads.\n",
+	 BLOCKREAD_SNFITSIO.NBLOCK, BLOCKREAD_SNFITSIO.NCOLREAD);
+  fflush(stdout);
+
+  BLOCKREAD_SNFITSIO.ISN_MIN = BLOCKREAD_SNFITSIO.ISN_MAX = -9 ;
+  BLOCKREAD_SNFITSIO.NBLOCK  = BLOCKREAD_SNFITSIO.NCOLREAD = 0 ;
+
+  return ;
+
+} // end rd_snfitsio_blockread_free
+
+
+// ===================================================
+void rd_snfitsio_blockread_tblcol(int isn_file, int icol, 
+				  int firstRow, int lastRow) {
+
+  // Created Oct 14 2026
+  // Block version of rd_snfitsio_tblcol for PHOT table.
+  // If isn_file is outside current block, define new block of
+  // events isn_file to isn_file+NEVT_BLOCK-1 and its contiguous
+  // PHOT row range. Each requested column is read once per block
+  // with a single fits_read_col over the row range, and the
+  // rows for isn_file are copied to RD_SNFITSIO_TABLEVAL_XXX.
+  // Epoch mask (SET_RDMASK_SNFITSIO) is applied afterwards by
+  // RD_SNFITSIO_PARVAL, as for the per-event read.
+  // Falls back to per-event read if rows are not in the block
+  // (e.g., non-monotonic PTROBS).
+
+  int  itype = ITYPE_SNFITSIO_PHOT ;
+  int  *IPTR = RD_SNFITSIO_TABLEVAL[ITYPE_SNFITSIO_HEAD].IPARINV[IFORM_1J] ; 
+  int  NSN_FILE = NSNLC_RD_SNFITSIO[IFILE_RD_SNFITSIO] ;
+  int  i, iform, iparRow, ISN_MAX, ROWMAX, NROW_BLOCK, NROW ;
+  void *BUF ;
+
+  // ------------ BEGIN --------------
+
+  if ( isn_file < BLOCKREAD_SNFITSIO.ISN_MIN || 
+       isn_file > BLOCKREAD_SNFITSIO.ISN_MAX ) {
+    
+    // new block
+    ISN_MAX = isn_file + BLOCKREAD_SNFITSIO.NEVT_BLOCK - 1 ;
+    if ( ISN_MAX > NSN_FILE ) { ISN_MAX = NSN_FILE; }
+
+    iparRow = *(IPTR+IPAR_SNFITSIO_PTROBS_MAX) ; 
+    ROWMAX  = RD_SNFITSIO_TABLEVAL_1J[ITYPE_SNFITSIO_HEAD][iparRow][ISN_MAX];
+
+    // shrink block if it has too many rows or if row order is unexpected
+    while ( ISN_MAX > isn_file && 
+	    (ROWMAX < lastRow || ROWMAX - firstRow+1 > MXROW_BLOCK_SNFITSIO) ) {
+      ISN_MAX-- ; 
+      ROWMAX = RD_SNFITSIO_TABLEVAL_1J[ITYPE_SNFITSIO_HEAD][iparRow][ISN_MAX];
+    }
+
+    BLOCKREAD_SNFITSIO.ISN_MIN = isn_file ;
+    BLOCKREAD_SNFITSIO.ISN_MAX = ISN_MAX ;
+    BLOCKREAD_SNFITSIO.ROWMIN  = firstRow ;
+    BLOCKREAD_SNFITSIO.ROWMAX  = ROWMAX ;
+    for(i=0; i < MXPAR_SNFITSIO; i++ ) 
+      { BLOCKREAD_SNFITSIO.LOADED[i] = false; }
+    BLOCKREAD_SNFITSIO.NBLOCK++ ;
+  }
+
+  if ( firstRow < BLOCKREAD_SNFITSIO.ROWMIN || 
+       lastRow  > BLOCKREAD_SNFITSIO.ROWMAX ) {
+    rd_snfitsio_tblcol(itype, icol, firstRow, lastRow);
+    return ;
+  }
+
+  // read this column for entire block 
+  if ( !BLOCKREAD_SNFITSIO.LOADED[icol] ) {
+    iform      = RD_SNFITSIO_TABLEDEF[itype].iform[icol];
+    NROW_BLOCK = BLOCKREAD_SNFITSIO.ROWMAX - BLOCKREAD_SNFITSIO.ROWMIN + 1 ;
+    if ( NROW_BLOCK > BLOCKREAD_SNFITSIO.MXROW[icol] ) {
+      free_colbuf_snfitsio(iform, BLOCKREAD_SNFITSIO.COLBUF[icol]);
+      BLOCKREAD_SNFITSIO.COLBUF[icol] = malloc_colbuf_snfitsio(iform,NROW_BLOCK);
+      BLOCKREAD_SNFITSIO.MXROW[icol]  = NROW_BLOCK ;
+    }
+    rd_snfitsio_colbuf(itype, icol, 
+		       BLOCKREAD_SNFITSIO.ROWMIN, BLOCKREAD_SNFITSIO.ROWMAX,
+		       BLOCKREAD_SNFITSIO.COLBUF[icol] );
+    BLOCKREAD_SNFITSIO.LOADED[icol] = true ;
+    BLOCKREAD_SNFITSIO.NCOLREAD++ ;
+  }
+
+  BUF  = BLOCKREAD_SNFITSIO.COLBUF[icol] ;
+  NROW = lastRow - firstRow + 1 ;
+  copy_colbuf_snfitsio(itype, icol, BUF, firstRow - BLOCKREAD_SNFITSIO.ROWMIN,
+		       NROW);
+
+  return ;
+
+} // end rd_snfitsio_blockread_tblcol
+
 
 
 
@@ -5236,9 +6462,10 @@ void  rd_snfitsio_specFile( int ifile ) {
   // read and store one-row-per spectrum; note that 
   // a given SNID can have multiple spectra and thus multiple rows.
 
-  // move to next table : HEADER (one row per spectrum)
-  fits_movrel_hdu( fp, nmove, &hdutype, &istat );
-  sprintf(c1err,"movrel to %s HEADER table", snfitsType[itype] ) ;
+  // move to HEADER table (one row per spectrum); 
+  // HDU=2 unless packed into HEAD file (Oct 2026)
+  fits_movabs_hdu( fp, RD_SNFITSIO_HDU_SPEC, &hdutype, &istat );
+  sprintf(c1err,"move to %s HEADER table", snfitsType[itype] ) ;
   snfitsio_errorCheck(c1err, istat);
 
   // ??  if ( RDSPEC_SNFITSIO_HEADER.NROW > 0 ) { rd_snfitsio_mallocSpec(-1,ifile); }
@@ -5801,7 +7028,12 @@ int RD_SNFITSIO_PARVAL(int     isn        // (I) internal SN index
       fflush(stdout);
     }
 
-    rd_snfitsio_tblcol( itype, icol, firstRow, lastRow) ;
+    if ( PREFETCH_SNFITSIO.USE ) 
+      { rd_snfitsio_prefetch_tblcol(isn_file, icol, firstRow, lastRow); }
+    else if ( BLOCKREAD_SNFITSIO.NEVT_BLOCK > 0 ) 
+      { rd_snfitsio_blockread_tblcol(isn_file, icol, firstRow, lastRow); }
+    else
+      { rd_snfitsio_tblcol( itype, icol, firstRow, lastRow) ; }
 
     NPARVAL = lastRow - firstRow + 1 ;
     JMIN = 1;
@@ -44,6 +44,7 @@
 
 // Dec 20 2021: define OPTMASK bits for WR_SNFITSIO_END
 #define OPTMASK_SNFITSIO_END_GZIP 1
+#define OPTMASK_SNFITSIO_END_PACK 2  // Oct 2026: pack PHOT,SPEC into HEAD file
 
 #define OPTMASK_SNFITSIO_IGNORESIM 256 // flag to treat sim like real data
 
@@ -104,10 +105,13 @@ bool  SNFITSIO_HOSTGAL2_FLAG    ;   // include HOSTGAL2 info
 bool  SNFITSIO_COMPACT_FLAG ;            // Jan 2018
 bool  SNFITSIO_COMPACT_noFLUXCAL_FLAG ;  // Jul 2023
 bool  SNFITSIO_SPECTRA_FLAG ;            // write or read spectra, Oct 2021
+bool  SNFITSIO_PHOT_REDUCED_FLAG ;       // scaled int16 PHOT columns, Oct 2026
 bool  SNFITSIO_SPECTRA_SKIPREAD;        // flag to skip reading spectra (see OPTMASK in RD_SNFITSIO_PREP)
 
 bool  SNFITSIO_noSIMFLAG_SNANA     ;  // treat sim like real data 
 int   SNFITSIO_NSUBSAMPLE_MARK ; // indicates how many marked sub-samples
+int   RD_SNFITSIO_HDU_PHOT ;  // abs HDU of PHOT table (2, or 3 if packed)
+int   RD_SNFITSIO_HDU_SPEC ;  // abs HDU of SPEC summary table
 
 typedef struct {
   // name of each header paramater (SNID, REDSHIFT, etc ...)
@@ -123,6 +127,9 @@ typedef struct {
 
   int iform[MXPAR_SNFITSIO] ;
 
+  // Oct 2026: TSCAL,TZERO for float stored as scaled 1I; TSCAL=0 -> no scale
+  double TSCAL[MXPAR_SNFITSIO], TZERO[MXPAR_SNFITSIO] ;
+
 } SNFITSIO_TABLEDEF ;
 
 SNFITSIO_TABLEDEF RD_SNFITSIO_TABLEDEF[MXTYPE_SNFITSIO];
@@ -148,6 +155,27 @@ struct {
 } WR_SNFITSIO_TABLEVAL[MXTYPE_SNFITSIO] ;  // index is itype
 
 
+// Oct 2026: buffer rows in memory and write NEVT events per
+// fits_write_col call for each column (see wr_snfitsio_flush).
+#define ENV_NEVT_WRBUF_SNFITSIO     "SNANA_FITS_NEVT_WRBUF" // 0 -> no buffer
+#define NEVT_WRBUF_SNFITSIO_DEFAULT  100
+
+typedef struct {
+  int   ROW0 ;                      // first table row in buffer
+  int   DATATYPE[MXPAR_SNFITSIO] ;  // [colnum] TSTRING, TDOUBLE, ...
+  int   SIZE[MXPAR_SNFITSIO] ;      // [colnum] bytes per row
+  int   MXROW[MXPAR_SNFITSIO] ;     // [colnum] allocated rows
+  int   NROW_FILL[MXPAR_SNFITSIO] ; // [colnum] rows to write; 0 -> none
+  char *BUF[MXPAR_SNFITSIO] ;       // [colnum] row values
+} SNFITSIO_WRBUF_DEF ;
+
+struct {
+  int  NEVT_FLUSH ;  // flush after this many events; 0 -> no buffer
+  int  NEVT_BUF ;    // number of events in buffer
+  SNFITSIO_WRBUF_DEF TABLE[MXTYPE_SNFITSIO] ;
+} WRBUF_SNFITSIO ;
+
+
 #define IFORM_A   1
 #define IFORM_1J  2
 #define IFORM_1I  3
@@ -196,6 +224,80 @@ int NEP_RDMASK_SNFITSIO_PARVAL ;
 int RDMASK_SNFITSIO_PARVAL[MXEPOCH] ;
 
 
+// Oct 2026: optional background thread to prefetch PHOT rows for the
+// next NRING events into a ring buffer (see rd_snfitsio_prefetch_xxx).
+#include <pthread.h>
+#define ENV_PREFETCH_SNFITSIO    "SNANA_FITS_PREFETCH" // ENV = NRING
+#define MXRING_PREFETCH_SNFITSIO  64
+#define STATE_PREFETCH_EMPTY      0
+#define STATE_PREFETCH_LOADING    1
+#define STATE_PREFETCH_READY      2
+
+typedef struct {
+  int   isn_file, STATE ;   // local SN index in file, and load status
+  int   firstRow, NROW ;    // PHOT row range for this event
+  void *COLBUF[MXPAR_SNFITSIO] ; // [icol] row buffer with native FITS cast
+} PREFETCH_SLOT_SNFITSIO ;
+
+struct {
+  bool USE ;          // ENV_PREFETCH_SNFITSIO is set
+  bool INIT_MUTEX ;
+  bool ACTIVE ;       // thread is running for current PHOT file
+  bool STOP ;         // tell thread to quit
+
+  int  NRING, MXROW ;
+  int  ISN_NEXT ;     // next isn_file for thread to read
+  int  ISN_CURRENT ;  // isn_file being processed by main thread
+  int  NSN_FILE ;
+  int  NCOL, ICOL_LIST[MXPAR_SNFITSIO] ; // PHOT columns to prefetch
+
+  int  ISN_USE ;                    // isn_file for SLOT_USE
+  PREFETCH_SLOT_SNFITSIO *SLOT_USE ; // NULL -> synchronous read
+  PREFETCH_SLOT_SNFITSIO  SLOT[MXRING_PREFETCH_SNFITSIO] ;
+
+  int  NEVT_RING, NEVT_SYNC ;       // summary stats
+
+  pthread_t        THREAD ;
+  pthread_mutex_t  MUTEX ;        // protects ring state above
+  pthread_mutex_t  MUTEX_FITS ;   // serializes cfitsio calls
+  pthread_cond_t   COND_FILL, COND_READY ;
+} PREFETCH_SNFITSIO ;
+
+
+// Oct 2026: optional writer thread; wr_snfitsio_flush hands the full
+// write-buffer to the thread and keeps filling a second buffer, so that
+// fits_write_col overlaps reading/processing of the next events.
+#define ENV_ASYNCWR_SNFITSIO  "SNANA_FITS_ASYNC_WRITE" // 1 -> writer thread
+
+struct {
+  bool USE ;          // ENV_ASYNCWR_SNFITSIO is set and thread is running
+  bool BUSY ;         // thread is writing TABLE
+  bool STOP ;         // tell thread to quit
+  int  NFLUSH ;       // number of buffers written by thread
+  SNFITSIO_WRBUF_DEF TABLE[MXTYPE_SNFITSIO] ; // buffer owned by thread
+
+  pthread_t        THREAD ;
+  pthread_mutex_t  MUTEX ;
+  pthread_cond_t   COND_START, COND_DONE ;
+} ASYNCWR_SNFITSIO ;
+
+
+// Oct 2026: optional bulk read of PHOT column blocks spanning
+// NEVT_BLOCK events (see rd_snfitsio_blockread_xxx).
+#define ENV_NEVT_BLOCK_SNFITSIO  "SNANA_FITS_NEVT_BLOCK" // ENV = NEVT_BLOCK
+#define MXROW_BLOCK_SNFITSIO     2000000  // max rows per column block
+
+struct {
+  int   NEVT_BLOCK ;                // 0 -> read each event (default)
+  int   ISN_MIN, ISN_MAX ;          // local SN range of current block
+  int   ROWMIN,  ROWMAX ;           // PHOT row range of current block
+  bool  LOADED[MXPAR_SNFITSIO] ;    // [icol] column read for this block
+  int   MXROW[MXPAR_SNFITSIO] ;     // [icol] allocated rows in COLBUF
+  void *COLBUF[MXPAR_SNFITSIO] ;    // [icol] column values, native cast
+  int   NBLOCK, NCOLREAD ;          // summary stats
+} BLOCKREAD_SNFITSIO ;
+
+
 // define indices to speed up param lookup
 int SNFITSIO_READINDX_HEAD[MXPAR_SNFITSIO];
 int SNFITSIO_READINDX_PHOT[MXPAR_SNFITSIO];
@@ -240,6 +342,9 @@ void wr_snfitsio_init_head(void);
 void wr_snfitsio_init_phot(void);
 void wr_snfitsio_init_spec(void);
 void wr_snfitsio_addCol(char *tform, char *name, int  itype);
+void wr_snfitsio_addCol_scaled(char *name, double tscal, double tzero,
+			       int itype);
+void wr_snfitsio_set_tscale(int itype);
 void wr_snfitsio_addCol_filters(char *cast, char *prefix, int itype); 
 void wr_snfitsio_addCol_HOSTGAL_PROERTIES(char *prefix, int itype);
 
@@ -251,7 +356,18 @@ void wr_snfitsio_fillTable(int *COLNUM, char *parName, int itype );
 void wr_snfitsio_fillTable_filters (int *COLNUM_INDX, char *PREFIX, int ITYPE, float *VAL) ;
 void wr_snfitsio_fillTable_filtersD(int *COLNUM_INDX, char *PREFIX, int ITYPE, double *VAL) ;
 
+void wr_snfitsio_init_wrbuf(void);
+void wr_snfitsio_fillBuffer(int itype, int colnum, int datatype, 
+			    int size, void *ptrVal);
+void wr_snfitsio_flush(void);
+void wr_snfitsio_write_wrbuf(SNFITSIO_WRBUF_DEF *TABLE_LIST);
+void  wr_snfitsio_async_init(void);
+void *wr_snfitsio_async_thread(void *arg);
+void  wr_snfitsio_async_wait(void);
+void  wr_snfitsio_async_end(void);
+
 void WR_SNFITSIO_END(int OPTMASK);
+void wr_snfitsio_pack(void);
 
 void rd_snfitsFile_close(int ifile, int itype);
 void wr_snfitsFile_close(int ifile, int itype);
@@ -285,6 +401,27 @@ void  rd_snfitsio_malloc(int ifile, int itype, int LEN);
 void  rd_snfitsio_head(int ifile);
 void  rd_snfitsio_tblpar(int ifile, int itype);
 void  rd_snfitsio_tblcol(int itype, int icol, int firstRow, int lastRow);
+void  rd_snfitsio_colbuf(int itype, int icol, int firstRow, int lastRow,
+			 void *BUF);
+
+void  rd_snfitsio_prefetch_init(void);
+void  rd_snfitsio_prefetch_start(void);
+void  rd_snfitsio_prefetch_stop(void);
+void *rd_snfitsio_prefetch_thread(void *arg);
+void  rd_snfitsio_prefetch_event(int isn_file, PREFETCH_SLOT_SNFITSIO *SLOT);
+PREFETCH_SLOT_SNFITSIO *rd_snfitsio_prefetch_get(int isn_file);
+void  rd_snfitsio_prefetch_tblcol(int isn_file, int icol, 
+				  int firstRow, int lastRow);
+void  lock_fits_snfitsio(int flag);
+
+void *malloc_colbuf_snfitsio(int iform, int NROW);
+void  free_colbuf_snfitsio(int iform, void *BUF);
+void  copy_colbuf_snfitsio(int itype, int icol, void *BUF, int OFFSET, int NROW);
+
+void  rd_snfitsio_blockread_init(void);
+void  rd_snfitsio_blockread_free(void);
+void  rd_snfitsio_blockread_tblcol(int isn_file, int icol, 
+				   int firstRow, int lastRow);
 
 void  rd_snfitsio_specFile(int ifile); 
 void  rd_snfitsio_mallocSpec(int opt, int ifile );
@@ -14,7 +14,7 @@
 #define HEAD_REQUIRE_FAKE       6
 #define NHEAD_REQUIRE         7
 
-#define MSKOPT_PARSE_TEXT_FILE  MSKOPT_PARSE_WORDS_FILE + MSKOPT_PARSE_WORDS_IGNORECOMMENT
+#define MSKOPT_PARSE_TEXT_FILE  MSKOPT_PARSE_WORDS_FILE + MSKOPT_PARSE_WORDS_IGNORECOMMENT + MSKOPT_PARSE_WORDS_VIEW
 
 
 #define MXVAROBS_TEXT 20
@@ -68,6 +68,45 @@ struct {
 } SNTEXTIO_FILE_INFO ;
 
 
+// Oct 2026: optional background thread to read the next NRING data
+// files into memory while current file is parsed
+// (see rd_sntextio_prefetch_xxx).
+#include <pthread.h>
+#define ENV_PREFETCH_SNTEXTIO    "SNANA_TEXT_PREFETCH" // ENV = NRING
+#define MXRING_PREFETCH_SNTEXTIO  64
+#ifndef STATE_PREFETCH_EMPTY
+#define STATE_PREFETCH_EMPTY      0
+#define STATE_PREFETCH_LOADING    1
+#define STATE_PREFETCH_READY      2
+#endif
+
+typedef struct {
+  int   ifile, STATE ;  // file index (C index), and load status
+  long  LEN, MXLEN ;    // file size (LEN<0 -> read synchronously), BUF size
+  char *BUF ;           // entire file contents, null-terminated
+} PREFETCH_SLOT_SNTEXTIO ;
+
+struct {
+  bool USE ;          // ENV_PREFETCH_SNTEXTIO is set
+  bool INIT_MUTEX ;
+  bool ACTIVE ;       // thread is running for current version
+  bool STOP ;         // tell thread to quit
+
+  int  NRING ;
+  int  IFILE_NEXT ;     // next file for thread to read
+  int  IFILE_CURRENT ;  // file being parsed by main thread
+  int  NFILE ;
+
+  PREFETCH_SLOT_SNTEXTIO  SLOT[MXRING_PREFETCH_SNTEXTIO] ;
+
+  int  NFILE_RING, NFILE_SYNC ;     // summary stats
+
+  pthread_t        THREAD ;
+  pthread_mutex_t  MUTEX ;  
+  pthread_cond_t   COND_FILL, COND_READY ;
+} PREFETCH_SNTEXTIO ;
+
+
 bool WRITE_VALID_SNTEXTIO; // flag to write only valid values (Jan 2022)
 
 bool DEBUG_FLAG_SNTEXTIO ;
@@ -105,6 +144,7 @@ void rd_sntextio_malloc_list(int OPT, int NFILE) ;
 void rd_sntextio_malloc_spec(int ISPEC, int NBLAM);
 
 void RD_SNTEXTIO_EVENT(int OPTMASK, int ifile);
+int  rd_sntextio_store_words(int ifile, char *FILENAME);
 void rd_sntextio_event__(int *OPTMASK, int *ifile);
 bool parse_SNTEXTIO_HEAD(int *iwd);
 bool parse_SNTEXTIO_OBS(int *iwd);
@@ -118,5 +158,13 @@ void copy_keyword_nocolon(char *key_in, char *key_out) ;
 void check_head_sntextio(int OPT);
 
 double get_dbl_sntextio_obs(int IVAROBS, int ep);
+
+void  rd_sntextio_prefetch_init(void);
+void  rd_sntextio_prefetch_start(void);
+void  rd_sntextio_prefetch_stop(void);
+void *rd_sntextio_prefetch_thread(void *arg);
+void  rd_sntextio_prefetch_file(int ifile, PREFETCH_SLOT_SNTEXTIO *SLOT);
+PREFETCH_SLOT_SNTEXTIO *rd_sntextio_prefetch_get(int ifile);
+void  rd_sntextio_prefetch_release(int ifile);
 bool allow_but_ignore_sntextio(int opt, char *varName);
 
@@ -11,6 +11,10 @@
   Mar 16 2019: 
     refactor INIT_FLUXERRMODEL to use read_GRIDMAP, and to read OPT_EXTRAP.
 
+  Oct 15 2026:
+    add DISPATCH_FLUXERRMODEL table to resolve map & REDCOV indices
+    once per FIELD/BAND; see IMAP[ICOV]_DISPATCH_FLUXERRMODEL.
+
 ****************************************************/
 
 
@@ -231,6 +235,9 @@ void INIT_FLUXERRMODEL(int OPTMASK, char *fileName,
 	  { strcat(FLUXERRMAP[NMAP].MAP.VARLIST,TMP_STRING); }
       }
 
+      // store last-column option as int to avoid strcmp per epoch
+      FLUXERRMAP[NMAP].IPAR_APPLY = FLUXERRMAP[NMAP].IVARLIST[NVAR-1];
+
       IDMAP = IDGRIDMAP_FLUXERRMODEL_OFFSET + NMAP ;
       NDIM  = NVAR-1;  NFUN=1;
       read_GRIDMAP(fp, "FLUXERR", "ROW:", "ENDMAP:", 
@@ -254,6 +261,9 @@ void INIT_FLUXERRMODEL(int OPTMASK, char *fileName,
   // check for reduced flux covarianve
   parse_REDCOV_FLUXERRMODEL(STRING_REDCOV);
 
+  // map & REDCOV indices are resolved later per FIELD/BAND
+  init_DISPATCH_FLUXERRMODEL();
+
   // close map file.
   if ( gzipFlag == 0 ) 
     { fclose(fp); }
@@ -730,6 +740,7 @@ void get_FLUXERRMODEL(int OPT, double FLUXERR_IN, char *BAND, char *FIELD,
   //
   // Jan 22 2020: refactor to use INDEX_MAP_FLUXERRMODEL.
   // Feb 08 2020: scale errors with SCALE_FLUXERR_DATA[TRUE]
+  // Oct 15 2026: use IMAP_DISPATCH_FLUXERRMODEL (no string match per call)
 
   //  int NMAP      = NMAP_FLUXERRMODEL; 
   int NSPARSE[MXMAP_FLUXERRMAP];
@@ -763,7 +774,7 @@ void get_FLUXERRMODEL(int OPT, double FLUXERR_IN, char *BAND, char *FIELD,
   for(isp=0; isp<NINDEX_SPARSE_FLUXERRMAP; isp++ ) 
     { NSPARSE[isp] = 0 ; }
 
-  imap = INDEX_MAP_FLUXERRMODEL(BAND, FIELD, fnam);
+  imap = IMAP_DISPATCH_FLUXERRMODEL(BAND, FIELD, fnam);
   if ( imap < 0 ) { return ; }
     
   // have valid map; increment number of times this MAPNAME is used.
@@ -962,26 +973,144 @@ int INDEX_REDCOV_FLUXERRMODEL(char *BAND, char *FIELD, int OPT_FIELD,
 } // end of INDEX_REDCOV_FLUXERRMODEL
 
 
+// ==========================================================
+void init_DISPATCH_FLUXERRMODEL(void) {
+
+  // Created Oct 2026
+  // Reset dispatch table; entries are filled on first use of each FIELD.
+
+  // ------------ BEGIN -----------
+  DISPATCH_FLUXERRMODEL.NFIELD      =  0 ;
+  DISPATCH_FLUXERRMODEL.IFIELD_LAST = -9 ;
+  return ;
+
+} // end init_DISPATCH_FLUXERRMODEL
+
+
+// ==========================================================
+int ifield_DISPATCH_FLUXERRMODEL(char *BAND, char *FIELD) {
+
+  // Created Oct 2026
+  // Return row of DISPATCH_FLUXERRMODEL table for input FIELD; 
+  // add new row if FIELD is not yet in table.
+  // Return -1 if FIELD/BAND cannot be stored in table, in which case
+  // caller must fall back to string matching.
+
+  int  NFIELD = DISPATCH_FLUXERRMODEL.NFIELD ;
+  int  ifield, ib ;
+
+  // ------------ BEGIN -----------
+
+  if ( strlen(BAND)  != 1 ) { return(-1); }
+  if ( (unsigned char)BAND[0] >= MXBAND_DISPATCH_FLUXERRMODEL ) 
+    { return(-1); }
+  if ( strlen(FIELD) >= MXCHAR_DISPATCH_FLUXERRMODEL ) { return(-1); }
+
+  ifield = DISPATCH_FLUXERRMODEL.IFIELD_LAST ;
+  if ( ifield >= 0 && 
+       strcmp(FIELD,DISPATCH_FLUXERRMODEL.FIELD[ifield]) == 0 ) 
+    { return(ifield); }
+
+  for(ifield=0; ifield < NFIELD; ifield++ ) {
+    if ( strcmp(FIELD,DISPATCH_FLUXERRMODEL.FIELD[ifield]) == 0 ) 
+      { DISPATCH_FLUXERRMODEL.IFIELD_LAST = ifield;  return(ifield); }
+  }
+
+  // new field; start over if table is full
+  if ( NFIELD >= MXFIELD_DISPATCH_FLUXERRMODEL ) 
+    { init_DISPATCH_FLUXERRMODEL(); NFIELD = 0; }
+
+  ifield = NFIELD ;
+  sprintf(DISPATCH_FLUXERRMODEL.FIELD[ifield], "%s", FIELD);
+  for(ib=0; ib < MXBAND_DISPATCH_FLUXERRMODEL; ib++ ) {
+    DISPATCH_FLUXERRMODEL.IMAP[ifield][ib] = 
+      IDX_UNDEFINED_DISPATCH_FLUXERRMODEL ;
+    DISPATCH_FLUXERRMODEL.ICOV[ifield][ib] = 
+      IDX_UNDEFINED_DISPATCH_FLUXERRMODEL ;
+  }
+  DISPATCH_FLUXERRMODEL.NFIELD++ ;
+  DISPATCH_FLUXERRMODEL.IFIELD_LAST = ifield ;
+
+  return(ifield);
+
+} // end ifield_DISPATCH_FLUXERRMODEL
+
+
+// ==========================================================
+int IMAP_DISPATCH_FLUXERRMODEL(char *BAND, char *FIELD, char *FUNCALL) {
+
+  // Created Oct 2026
+  // Same as INDEX_MAP_FLUXERRMODEL, but the string matching is done
+  // only the first time each FIELD/BAND is requested.
+
+  int ifield = ifield_DISPATCH_FLUXERRMODEL(BAND,FIELD);
+  int ib, IMAP ;
+
+  // ------------ BEGIN -----------
+
+  if ( ifield < 0 ) { return INDEX_MAP_FLUXERRMODEL(BAND,FIELD,FUNCALL); }
+
+  ib   = (unsigned char)BAND[0] ;
+  IMAP = DISPATCH_FLUXERRMODEL.IMAP[ifield][ib] ;
+  if ( IMAP == IDX_UNDEFINED_DISPATCH_FLUXERRMODEL ) {
+    IMAP = INDEX_MAP_FLUXERRMODEL(BAND,FIELD,FUNCALL);
+    DISPATCH_FLUXERRMODEL.IMAP[ifield][ib] = (short)IMAP ;
+  }
+
+  return(IMAP);
+
+} // end IMAP_DISPATCH_FLUXERRMODEL
+
+
+// ==========================================================
+int ICOV_DISPATCH_FLUXERRMODEL(char *BAND, char *FIELD, char *FUNCALL) {
+
+  // Created Oct 2026
+  // Same as INDEX_REDCOV_FLUXERRMODEL with OPT_FIELD=2, but the string 
+  // matching is done only the first time each FIELD/BAND is requested.
+
+  int OPT_FIELD = 2 ;
+  int ifield = ifield_DISPATCH_FLUXERRMODEL(BAND,FIELD);
+  int ib, ICOV ;
+
+  // ------------ BEGIN -----------
+
+  if ( ifield < 0 ) 
+    { return INDEX_REDCOV_FLUXERRMODEL(BAND,FIELD,OPT_FIELD,FUNCALL); }
+
+  ib   = (unsigned char)BAND[0] ;
+  ICOV = DISPATCH_FLUXERRMODEL.ICOV[ifield][ib] ;
+  if ( ICOV == IDX_UNDEFINED_DISPATCH_FLUXERRMODEL ) {
+    ICOV = INDEX_REDCOV_FLUXERRMODEL(BAND,FIELD,OPT_FIELD,FUNCALL);
+    DISPATCH_FLUXERRMODEL.ICOV[ifield][ib] = (short)ICOV ;
+  }
+
+  return(ICOV);
+
+} // end ICOV_DISPATCH_FLUXERRMODEL
+
+
 // =========================================================
 double apply_FLUXERRMODEL(int imap, double errModelVal, double fluxErr) {
 
   
+  // Oct 15 2026: check IPAR_APPLY set at init instead of strcmp
+
   int  NVAR     = FLUXERRMAP[imap].NVAR;
   char *VARNAME = FLUXERRMAP[imap].VARNAMES[NVAR-1];
   char *NAME    = FLUXERRMAP[imap].NAME ;
-  int  IPAR1    = IPAR_FLUXERRMAP_ERRSCALE ;
-  int  IPAR2    = IPAR_FLUXERRMAP_ERRADD ;
+  int  IPAR     = FLUXERRMAP[imap].IPAR_APPLY ;
   double FLUXERR_OUT=0.0 ;
   char   fnam[] = "apply_FLUXERRMODEL" ;
 
   // ------------ BEGIN ------------
   
 
-  if ( strcmp(VARNAME,VARNAMES_FLUXERRMAP[IPAR1])==0 ) {
+  if ( IPAR == IPAR_FLUXERRMAP_ERRSCALE ) {
     // scale error
     FLUXERR_OUT = (fluxErr * errModelVal) ;
   }
-  else if ( strcmp(VARNAME,VARNAMES_FLUXERRMAP[IPAR2])==0 ) {
+  else if ( IPAR == IPAR_FLUXERRMAP_ERRADD ) {
     // add err in quadrature, FLUXCAL units
     FLUXERR_OUT = sqrt(fluxErr*fluxErr + errModelVal*errModelVal) ;
   }
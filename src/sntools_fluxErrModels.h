@@ -41,6 +41,7 @@ struct {
   int  IVARLIST[MXVAR_FLUXERRMAP] ; // list of IVAR from full list
   int  MASK_APPLY ;   // bit0 for sim, bit1 for data
   int  INDEX_SPARSE; 
+  int  IPAR_APPLY ;   // IPAR_FLUXERRMAP_ERRSCALE or ERRADD (Oct 2026)
 
   GRIDMAP_DEF  MAP ;
   double SCALE_FLUXERR_DATA; // scale reported error, but not true error
@@ -94,6 +95,21 @@ struct {
 } COVINFO_FLUXERRMODEL[MXREDCOV_FLUXERRMAP];
 
 
+// Oct 2026: dispatch table so that map and REDCOV indices are resolved
+// once per (FIELD,BAND) instead of string-matching for every epoch.
+#define MXFIELD_DISPATCH_FLUXERRMODEL  400
+#define MXCHAR_DISPATCH_FLUXERRMODEL    40
+#define MXBAND_DISPATCH_FLUXERRMODEL   128  // index by band char
+#define IDX_UNDEFINED_DISPATCH_FLUXERRMODEL -99
+struct {
+  int  NFIELD ;
+  int  IFIELD_LAST ;  // consecutive epochs usually have same field
+  char FIELD[MXFIELD_DISPATCH_FLUXERRMODEL][MXCHAR_DISPATCH_FLUXERRMODEL];
+  short IMAP[MXFIELD_DISPATCH_FLUXERRMODEL][MXBAND_DISPATCH_FLUXERRMODEL];
+  short ICOV[MXFIELD_DISPATCH_FLUXERRMODEL][MXBAND_DISPATCH_FLUXERRMODEL];
+} DISPATCH_FLUXERRMODEL ;
+
+
 // ======== functions ==============
 void  INIT_FLUXERRMODEL(int optmask, char *fileName, char *redcorString,
 			char *mapList_ignore_dataErr);
@@ -104,6 +120,10 @@ void  set_FIELDLIST_FLUXERRMODEL(char *FIELDGROUP, char *FIELDLIST);
 int   INDEX_MAP_FLUXERRMODEL(char *BAND, char *FIELD, char *FUNCALL);
 int   INDEX_REDCOV_FLUXERRMODEL(char *BAND, char *FIELD, int opt_FIELD, 
 				char *FUNCALL);
+void  init_DISPATCH_FLUXERRMODEL(void);
+int   ifield_DISPATCH_FLUXERRMODEL(char *BAND, char *FIELD);
+int   IMAP_DISPATCH_FLUXERRMODEL(char *BAND, char *FIELD, char *FUNCALL);
+int   ICOV_DISPATCH_FLUXERRMODEL(char *BAND, char *FIELD, char *FUNCALL);
 
 void  DUMP_MAP_FLUXERRMODEL(int imap);
 void  END_FLUXERRMODEL(void);
@@ -5,6 +5,8 @@
 //  Jun 24 2021: dillon added parse_input_gengauss,checkVal_GENGAUSS
 //               from snlc_sim.c to use in SALT2mu subprocess
 //  Dec 20 2023: implement PROB_EXPON_REWGT  
+//  Oct 14 2026: add inverse-CDF option (OPT_FAST_GENGAUSS_ASYM) to
+//               draw truncated asymGauss without rejection loop.
 //
 // =============================
 
@@ -18,6 +20,7 @@
 
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_spline.h>
+#include <gsl/gsl_cdf.h>
 
 #include "sntools.h"
 //#include "sntools_genGauss_asym.h"
@@ -485,6 +488,13 @@ double getRan_GENGAUSS_ASYM(GENGAUSS_ASYM_DEF *genGauss) {
 
   if ( !genGauss->USE ) {  return(ranval);  }
 
+  // Oct 2026: check option for inverse-CDF method (no skew)
+  if ( OPT_FAST_GENGAUSS_ASYM ) {
+    bool IS_SKEW = ( fabs(genGauss->SKEW[0]) > 1.0E-9 || 
+		     fabs(genGauss->SKEW[1]) > 1.0E-9 ) ;
+    if ( !IS_SKEW ) { return getRan_GENGAUSS_ASYM_fast(genGauss,ran1); }
+  }
+
   rewgt_sig = 1.0/genGauss->SQRT_PROB_EXPON_REWGT ;
 
   lo          = genGauss->RANGE[0] ;
@@ -634,6 +644,188 @@ double getRan_GENGAUSS_ASYM(GENGAUSS_ASYM_DEF *genGauss) {
 } // end of getRan_GENGAUSS_ASYM
 
 
+// ********************************************************
+double getRan_GENGAUSS_ASYM_fast(GENGAUSS_ASYM_DEF *genGauss, double ran1) {
+
+  // Created Oct 2026
+  // Same distribution as getRan_GENGAUSS_ASYM (without SKEW), but
+  // instead of rejecting values outside RANGE, the truncated
+  // asymGauss is sampled directly with inverse CDF; the cost is
+  // independent of how much probability is outside RANGE.
+  // For the double-Gauss option, each peak is weighted by its
+  // normalized probability inside RANGE, which is what the
+  // rejection loop effectively does.
+  //
+  // Input ran1 is the already-burned flat random from the caller,
+  // and is used here to select lo-half, peak-interval, or hi-half.
+
+  double rewgt_sig = 1.0/genGauss->SQRT_PROB_EXPON_REWGT ;
+  double PROB2     = genGauss->PROB2 ;
+  int    NGRID     = genGauss->NGRID ;
+  double PI_HALF_SQRT = 1.2533141373155 ; // sqrt(PI/2)
+
+  double peakrange[2][2], siglo[2], sighi[2], lo[2], hi[2], grid0[2];
+  double gridsize[2], MASS[2][3], PROB_PEAK[2], sigmax, ran2, ranCDF ;
+  double ranval, x0, P ;
+  bool   DO_GRID[2];
+  int    ipk, NPEAK = 1, IPK = 0 ;
+  //  char fnam[] = "getRan_GENGAUSS_ASYM_fast" ;
+
+  // ---------- BEGIN -------------
+
+  if ( PROB2 > 0.0000001 ) { NPEAK = 2; }
+
+  for(ipk=0; ipk < NPEAK; ipk++ ) {
+    if ( ipk == 0 ) {
+      peakrange[0][0] = genGauss->PEAKRANGE[0] ;
+      peakrange[0][1] = genGauss->PEAKRANGE[1] ;
+      siglo[0] = genGauss->SIGMA[0] * rewgt_sig ;
+      sighi[0] = genGauss->SIGMA[1] * rewgt_sig ;
+    }
+    else {
+      peakrange[1][0] = peakrange[1][1] = genGauss->PEAK2 ;
+      siglo[1] = genGauss->SIGMA2[0] * rewgt_sig ;
+      sighi[1] = genGauss->SIGMA2[1] * rewgt_sig ;
+    }
+
+    lo[ipk] = genGauss->RANGE[0] ;
+    hi[ipk] = genGauss->RANGE[1] ;
+    DO_GRID[ipk] = ( NGRID >=2 && hi[ipk]>lo[ipk] && 
+		     siglo[ipk]>0.0 && sighi[ipk]>0.0 );
+    if ( DO_GRID[ipk] ) {
+      gridsize[ipk] = (hi[ipk]-lo[ipk])/(double)(NGRID-1) ;
+      grid0[ipk]    = lo[ipk] ;
+      lo[ipk]      -= gridsize[ipk]/2.0 ;
+      hi[ipk]      += gridsize[ipk]/2.0 ;
+    }
+
+    // normalized probability inside [lo,hi]
+    x0 = peakrange[ipk][0];  P = peakrange[ipk][1] - x0 ;
+    PROB_PEAK[ipk] = 
+      mass_GaussAsym_trunc(siglo[ipk], sighi[ipk], P, 
+			   lo[ipk]-x0, hi[ipk]-x0, MASS[ipk]) /
+      ( (siglo[ipk]+sighi[ipk])*PI_HALF_SQRT + P ) ;
+  }
+
+  // select peak
+  if ( NPEAK == 2 ) {
+    ran2 = getRan_Flat1(ILIST_GETRAN_GENGAUSS) ;
+    PROB_PEAK[0] *= (1.0-PROB2) ;
+    PROB_PEAK[1] *= PROB2 ;
+    if ( ran2*(PROB_PEAK[0]+PROB_PEAK[1]) < PROB_PEAK[1] ) { IPK = 1; }
+  }
+
+  sigmax = 10.0*(hi[IPK]-lo[IPK]) ;
+  x0 = peakrange[IPK][0];  P = peakrange[IPK][1] - x0 ;
+
+  if ( lo[IPK] == hi[IPK] ) {
+    ranval = lo[IPK] ;    // delta function
+  }
+  else if ( siglo[IPK] > sigmax && sighi[IPK] > sigmax ) {
+    ranval = lo[IPK] + (hi[IPK]-lo[IPK])*ran1 ;  // flat distribution
+  }
+  else {
+    ranCDF = getRan_Flat1(ILIST_GETRAN_GENGAUSS) ;
+    ranval = x0 + 
+      getRan_GaussAsym_trunc(siglo[IPK], sighi[IPK], P, 
+			     lo[IPK]-x0, hi[IPK]-x0, MASS[IPK], ran1, ranCDF);
+  }
+
+  if ( DO_GRID[IPK] ) {
+    int ibin = (int)((ranval-lo[IPK])/gridsize[IPK]) ;
+    ranval   = grid0[IPK] + ((double)ibin*gridsize[IPK]) ;
+  }
+
+  return(ranval) ;
+
+} // end getRan_GENGAUSS_ASYM_fast
+
+
+// ********************************************************
+double mass_GaussAsym_trunc(double siglo, double sighi, double peakinterval,
+			    double xlo, double xhi, double *MASS) {
+
+  // Created Oct 2026
+  // For asymGauss with PROB=1 from 0 to peakinterval, return integral
+  // between xlo and xhi. Also return integral of each component:
+  //   MASS[0] = lo-side Gaussian (x<0)
+  //   MASS[1] = flat peak interval
+  //   MASS[2] = hi-side Gaussian (x>peakinterval)
+
+  double SQRT_2PI = 2.5066282746310 ;
+  double P = peakinterval, a, b ;
+
+  // ---------- BEGIN -------------
+
+  MASS[0] = MASS[1] = MASS[2] = 0.0 ;
+
+  // lo side: z = x/siglo <= 0
+  a = xlo;  b = ( xhi < 0.0 ? xhi : 0.0 ) ;
+  if ( siglo > 0.0 && a < b ) {
+    MASS[0] = siglo * SQRT_2PI * 
+      ( gsl_cdf_ugaussian_P(b/siglo) - gsl_cdf_ugaussian_P(a/siglo) ) ;
+  }
+
+  // peak interval
+  a = ( xlo > 0.0 ? xlo : 0.0 ) ;  b = ( xhi < P ? xhi : P ) ;
+  if ( a < b ) { MASS[1] = b - a ; }
+
+  // hi side: z = (x-P)/sighi >= 0 ; use upper tail Q for precision
+  a = ( xlo-P > 0.0 ? xlo-P : 0.0 ) ;  b = xhi - P ;
+  if ( sighi > 0.0 && a < b ) {
+    MASS[2] = sighi * SQRT_2PI * 
+      ( gsl_cdf_ugaussian_Q(a/sighi) - gsl_cdf_ugaussian_Q(b/sighi) ) ;
+  }
+
+  return( MASS[0] + MASS[1] + MASS[2] );
+
+} // end mass_GaussAsym_trunc
+
+
+// ********************************************************
+double getRan_GaussAsym_trunc(double siglo, double sighi, double peakinterval,
+			      double xlo, double xhi, double *MASS, 
+			      double ranSelect, double ranCDF) {
+
+  // Created Oct 2026
+  // Return random from asymGauss (peak interval 0 to peakinterval)
+  // truncated to xlo < x < xhi. Component masses MASS[3] are from
+  // mass_GaussAsym_trunc. ranSelect picks the component, and 
+  // ranCDF is used for the inverse CDF within that component.
+
+  double P = peakinterval, MTOT, a, b, za, zb, pa, pb, x ;
+
+  // ---------- BEGIN -------------
+
+  MTOT = MASS[0] + MASS[1] + MASS[2] ;
+  if ( MTOT <= 0.0 ) { return(0.5*(xlo+xhi)); } // should never happen
+
+  if ( ranSelect*MTOT < MASS[0] ) {
+    a  = xlo;  b = ( xhi < 0.0 ? xhi : 0.0 ) ;
+    za = a/siglo;  zb = b/siglo ;
+    pa = gsl_cdf_ugaussian_P(za);  pb = gsl_cdf_ugaussian_P(zb); 
+    x  = siglo * gsl_cdf_ugaussian_Pinv( pa + ranCDF*(pb-pa) ) ;
+  }
+  else if ( ranSelect*MTOT < MASS[0]+MASS[1] ) {
+    a = ( xlo > 0.0 ? xlo : 0.0 ) ;  b = ( xhi < P ? xhi : P ) ;
+    x = a + ranCDF*(b-a) ;
+  }
+  else {
+    a  = ( xlo-P > 0.0 ? xlo-P : 0.0 ) ;  b = xhi - P ;
+    za = a/sighi;  zb = b/sighi ;
+    pa = gsl_cdf_ugaussian_Q(za);  pb = gsl_cdf_ugaussian_Q(zb); 
+    x  = P + sighi * gsl_cdf_ugaussian_Qinv( pa - ranCDF*(pa-pb) ) ;
+  }
+
+  // protect against round-off
+  if ( x < xlo ) { x = xlo; }
+  if ( x > xhi ) { x = xhi; }
+
+  return(x);
+
+} // end getRan_GaussAsym_trunc
+
+
 // ****************************************
 void dump_GENGAUSS_ASYM(GENGAUSS_ASYM_DEF *genGauss) {
 
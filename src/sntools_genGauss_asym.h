@@ -6,6 +6,7 @@
 #define ILIST_GETRAN_GENGAUSS 1
 #define MXGENGAUSS 100
 int NFUN_GENGAUSS_ASYM ; // used in conjunction with FUNINDEX       
+int OPT_FAST_GENGAUSS_ASYM ; // Oct 2026: 1 -> inverse-CDF (no rejection)
 
 
 typedef struct  {
@@ -43,6 +44,12 @@ void   init_GENGAUSS_ASYM(GENGAUSS_ASYM_DEF *genGauss, double VAL );
 
 double getRan_GENGAUSS_ASYM(GENGAUSS_ASYM_DEF *genGauss);
 double getRan_GENGAUSS_ASYM_bug(GENGAUSS_ASYM_DEF *genGauss);
+double getRan_GENGAUSS_ASYM_fast(GENGAUSS_ASYM_DEF *genGauss, double ran1);
+double mass_GaussAsym_trunc(double siglo, double sighi, double peakinterval,
+			    double xlo, double xhi, double *MASS);
+double getRan_GaussAsym_trunc(double siglo, double sighi, double peakinterval,
+			      double xlo, double xhi, double *MASS, 
+			      double ranSelect, double ranCDF);
 double funVal_GENGAUSS_ASYM(double x, GENGAUSS_ASYM_DEF *genGauss);
 void   copy_GENGAUSS_ASYM(GENGAUSS_ASYM_DEF *genGauss1,
                           GENGAUSS_ASYM_DEF *genGauss2) ;
@@ -27,6 +27,9 @@
   Jun 4 2025: enable reading GEN[PEAK,SIGMA,RANGE]_SALT2c so that asyn Gauss
               profile can go into genPDF map file.
 
+  Oct 14 2026: GENPDF_OPTMASK += 16 -> compiled O(1) alias sampler for
+               genPDF maps, and inverse-CDF method for asymGauss.
+
  ****************************************************/
 
 #ifndef USE_SUBPROCESS
@@ -57,6 +60,7 @@ void init_genPDF(int OPTMASK, FILE *FP, char *fileName, char *ignoreList) {
   //         1 : allow extrapolation outside range of map
   //               (e.g, LOGMASS in HOSTLIB extends beyone map)
   //         8 : use already opened FP
+  //        16 : fast O(1) sampler (alias tables; inverse-CDF asymGauss)
   //
   //   fileName -> name of file with map(s)
   //   ignoreList -> comma-separated list of map(s) to ignore 
@@ -115,6 +119,9 @@ void init_genPDF(int OPTMASK, FILE *FP, char *fileName, char *ignoreList) {
 
   OPTMASK_GENPDF = OPTMASK ; // Dec 23 2020
 
+  // Oct 2026: flag for asymGauss is needed even without map file
+  if ( (OPTMASK & OPTMASK_GENPDF_FAST) > 0 ) { OPT_FAST_GENGAUSS_ASYM = 1; }
+
   NMAP_GENPDF = NCALL_GENPDF = 0;
   MAG_OFFSET_GENPDF = 0.0 ;
   
@@ -157,6 +164,10 @@ void init_genPDF(int OPTMASK, FILE *FP, char *fileName, char *ignoreList) {
     printf("\t use speed-trick: select from range bounded by PROB ~ 0. \n");
   }
 
+  if ( (OPTMASK & OPTMASK_GENPDF_FAST) > 0 ) { 
+    printf("\t use fast sampler: alias tables and inverse-CDF asymGauss.\n");
+  }
+
   if ( (OPTMASK & OPTMASK_GENPDF_KEYSOURCE_ARG) > 0 ) {
     printf("\t GENPDF_FILE is from command line -> allow overrides.\n");
     KEYSOURCE = 2; // genpdf_file was from command line
@@ -264,6 +275,7 @@ void init_genPDF(int OPTMASK, FILE *FP, char *fileName, char *ignoreList) {
       GENPDF[NMAP].N_ITER_SUM  = 0 ;
       GENPDF[NMAP].N_ITER_MAX  = 0 ;
       GENPDF[NMAP].PROB_EXPON_REWGT = 1.0 ; // default is no rewgt 
+      GENPDF[NMAP].SAMPLER.INIT     = false ;
       /*
       int NROW = GENPDF[NMAP].GRIDMAP.NROW;
       char *VARLIST = GENPDF[NMAP].GRIDMAP.VARLIST ;
@@ -419,6 +431,7 @@ void init_genPDF_from_GenGauss(int IMAP, GENGAUSS_ASYM_DEF *GENGAUSS) {
 			   &GENPDF[IMAP].GRIDMAP ); // <== returned
 
   GENPDF[IMAP].PROB_EXPON_REWGT = 1.0 ; // Mar 14, 2024
+  GENPDF[IMAP].SAMPLER.INIT     = false ;
 
   assign_VARNAME_GENPDF(IMAP, 0, NAME );
 
@@ -459,11 +472,138 @@ void free_memory_genPDF(void) {
 
     malloc_GRIDMAP(-1, &GENPDF[imap].GRIDMAP, NFUN, NDIM, MAPSIZE);
     for(ivar=0; ivar<NVAR; ivar++ )  { free(GENPDF[imap].VARNAMES[ivar]); }
+    free_sampler_genPDF(imap);
   }
 
   return;
 } // end free_memory_genPDF
 
+
+// =======================================
+void init_sampler_genPDF(int IMAP) {
+
+  // Created Oct 2026
+  // Compile alias tables for GENPDF[IMAP] so that each random draw
+  // is O(1) instead of the rejection loop in getRan_genPDF.
+  //
+  // The map is viewed as NSLICE 1D slices along the generated
+  // variable (ivar=0), one slice per grid point of the other
+  // (HOSTLIB) variables. For each slice, the linearly interpolated
+  // PROB integrates to 0.5*(P[k]+P[k+1]) per cell, and those cell
+  // weights define Walker/Vose alias tables. See getRan_sampler_genPDF
+  // for how the slices are combined.
+  //
+  // Map is not valid for sampler if there are missing grid nodes,
+  // if PROB_EXPON_REWGT != 1 (interpolation not linear in PROB),
+  // or too many dimensions. Caller then uses the rejection method.
+
+  GENPDF_SAMPLER_DEF *SAMPLER = &GENPDF[IMAP].SAMPLER ;
+  GRIDMAP_DEF        *GRIDMAP = &GENPDF[IMAP].GRIDMAP ;
+  int    NDIM  = GRIDMAP->NDIM ;
+  int    NBIN  = GRIDMAP->NBIN[0] ;
+  int    NCELL = NBIN - 1 ;
+  int    NSLICE = 1, idim, islice, k, irow, NSMALL, NLARGE, ks, kl ;
+  int   *SMALL, *LARGE, *ALIAS_INDEX ;
+  double *PROB, *SCALED, *ALIAS_PROB, SUM, XNCELL = (double)NCELL ;
+  char fnam[] = "init_sampler_genPDF" ;
+
+  // ------------ BEGIN ------------
+
+  SAMPLER->INIT  = true ;
+  SAMPLER->VALID = false ;
+
+  if ( NDIM > MXDIM_SAMPLER_GENPDF            ) { return; }
+  if ( NCELL < 1                              ) { return; }
+  if ( GENPDF[IMAP].PROB_EXPON_REWGT != 1.0   ) { return; }
+
+  for(idim=1; idim < NDIM; idim++ ) { NSLICE *= GRIDMAP->NBIN[idim]; }
+
+  SAMPLER->NBIN        = NBIN ;
+  SAMPLER->NCELL       = NCELL ;
+  SAMPLER->NSLICE      = NSLICE ;
+  SAMPLER->PROB_NODE   = (double*) malloc(NSLICE*NBIN*sizeof(double));
+  SAMPLER->SLICE_SUM   = (double*) malloc(NSLICE*sizeof(double));
+  SAMPLER->ALIAS_PROB  = (double*) malloc(NSLICE*NCELL*sizeof(double));
+  SAMPLER->ALIAS_INDEX = (int   *) malloc(NSLICE*NCELL*sizeof(int));
+
+  SCALED = (double*) malloc(NCELL*sizeof(double));
+  SMALL  = (int   *) malloc(NCELL*sizeof(int));
+  LARGE  = (int   *) malloc(NCELL*sizeof(int));
+
+  // dimension 0 has unit stride in 1D index (see init_1DINDEX),
+  // so slice islice covers 1D index islice*NBIN + k.
+  for(islice=0; islice < NSLICE; islice++ ) {
+    PROB = &SAMPLER->PROB_NODE[islice*NBIN] ;
+    for(k=0; k < NBIN; k++ ) {
+      irow = GRIDMAP->INVMAP[islice*NBIN + k] ;
+      if ( irow < 0 || irow >= GRIDMAP->NROW ) { goto CLEANUP ; }
+      PROB[k] = GRIDMAP->FUNVAL[0][irow] ;
+      if ( PROB[k] < 0.0 ) { PROB[k] = 0.0 ; }
+    }
+
+    SUM = 0.0 ;
+    for(k=0; k < NCELL; k++ ) 
+      { SCALED[k] = 0.5*(PROB[k]+PROB[k+1]);  SUM += SCALED[k]; }
+    SAMPLER->SLICE_SUM[islice] = SUM ;
+
+    ALIAS_PROB  = &SAMPLER->ALIAS_PROB[islice*NCELL] ;
+    ALIAS_INDEX = &SAMPLER->ALIAS_INDEX[islice*NCELL] ;
+
+    // Vose alias method
+    NSMALL = NLARGE = 0 ;
+    for(k=0; k < NCELL; k++ ) {
+      ALIAS_INDEX[k] = k ;
+      if ( SUM > 0.0 ) { SCALED[k] *= (XNCELL/SUM); } else { SCALED[k]=1.0; }
+      if ( SCALED[k] < 1.0 ) { SMALL[NSMALL++] = k; } 
+      else                   { LARGE[NLARGE++] = k; }
+    }
+    while ( NSMALL > 0 && NLARGE > 0 ) {
+      ks = SMALL[--NSMALL];  kl = LARGE[--NLARGE];
+      ALIAS_PROB[ks]  = SCALED[ks] ;
+      ALIAS_INDEX[ks] = kl ;
+      SCALED[kl]     -= (1.0 - SCALED[ks]) ;
+      if ( SCALED[kl] < 1.0 ) { SMALL[NSMALL++] = kl; } 
+      else                    { LARGE[NLARGE++] = kl; }
+    }
+    while ( NLARGE > 0 ) { ALIAS_PROB[LARGE[--NLARGE]] = 1.0 ; }
+    while ( NSMALL > 0 ) { ALIAS_PROB[SMALL[--NSMALL]] = 1.0 ; } // roundoff
+  }
+
+  SAMPLER->VALID = true ;
+
+ CLEANUP:
+  free(SCALED); free(SMALL); free(LARGE);
+
+  if ( !SAMPLER->VALID ) { 
+    free_sampler_genPDF(IMAP); 
+    SAMPLER->INIT = true ; // don't try again
+  }
+
+  printf("\t %s: %s alias sampler with %d slices x %d cells (valid=%d)\n",
+	 fnam, GENPDF[IMAP].MAPNAME, NSLICE, NCELL, SAMPLER->VALID );
+  fflush(stdout);
+
+  return ;
+
+} // end init_sampler_genPDF
+
+
+// =======================================
+void free_sampler_genPDF(int IMAP) {
+
+  // Created Oct 2026
+  GENPDF_SAMPLER_DEF *SAMPLER = &GENPDF[IMAP].SAMPLER ;
+
+  if ( SAMPLER->INIT && SAMPLER->VALID ) {
+    free(SAMPLER->PROB_NODE);   free(SAMPLER->SLICE_SUM);
+    free(SAMPLER->ALIAS_PROB);  free(SAMPLER->ALIAS_INDEX);
+  }
+  SAMPLER->INIT = SAMPLER->VALID = false;
+
+  return ;
+
+} // end free_sampler_genPDF
+
 // =======================================
 void assign_VARNAME_GENPDF(int imap, int ivar, char *varName) {
 
@@ -600,6 +740,13 @@ double getRan_genPDF(char *parName, GENGAUSS_ASYM_DEF *GENGAUSS) {
 	val_inputs[ivar] = get_VALUE_HOSTLIB(IVAR_HOSTLIB,IGAL);
       }
 
+      // Oct 2026: check option for O(1) alias sampler;
+      // if sampler is not valid, fall back to rejection method below.
+      if ( (OPTMASK_GENPDF & OPTMASK_GENPDF_FAST) > 0 ) {
+	istat = getRan_sampler_genPDF(IMAP, val_inputs, &r);
+	if ( istat == SUCCESS ) { N_ITER = 1;  goto END_GENPDF_SELECT; }
+      }
+
       // get min/max VALUE range for random selection;
       // function here returns VAL_RANGE
 
@@ -682,6 +829,8 @@ double getRan_genPDF(char *parName, GENGAUSS_ASYM_DEF *GENGAUSS) {
 
       } // end while loop over prob
 
+    END_GENPDF_SELECT:
+      ;
     } // end IDMAP >= 0
 
     // track N_ITER stats
@@ -834,6 +983,112 @@ int IMAP_GENPDF(char *parName, bool *FOUND_LOGPARAM) {
 
 } // end IMAP_GENPDF
 
+
+// ==========================================================
+int getRan_sampler_genPDF(int IMAP, double *val_inputs, double *ranval) {
+
+  // Created Oct 2026
+  // O(1) random draw of generated variable from GENPDF[IMAP],
+  // for HOSTLIB values val_inputs[1:NDIM-1]. 
+  //
+  // The multi-linear GRIDMAP interpolation at fixed HOSTLIB values is
+  //   PROB(x) = sum_c  W_c * PROB_c(x)
+  // where c runs over the 2^(NDIM-1) corners of the HOSTLIB cell,
+  // W_c are the usual interpolation weights, and PROB_c is the 1D
+  // slice at corner c. Hence we pick corner c with weight 
+  // W_c * SLICE_SUM[c], pick a cell from the slice alias table, and
+  // then sample the linear PROB within that cell. 
+  // This is the exact distribution of the interpolated map.
+  //
+  // Functions returns SUCCESS, or ERROR if the sampler cannot be
+  // used (caller then uses rejection method).
+
+  GENPDF_SAMPLER_DEF *SAMPLER = &GENPDF[IMAP].SAMPLER ;
+  GRIDMAP_DEF        *GRIDMAP = &GENPDF[IMAP].GRIDMAP ;
+  int    NDIM  = GRIDMAP->NDIM ;
+  int    NBIN  = SAMPLER->NBIN ;
+  int    NCELL = SAMPLER->NCELL ;
+  int    ILIST_RAN = 1 ;
+  int    idim, icorner, NCORNER, ISEL, islice, slice_stride, g, k, istat ;
+  int    IGRID[MXDIM_SAMPLER_GENPDF] ;
+  int    SLICE_LIST[1<<(MXDIM_SAMPLER_GENPDF-1)] ;
+  double WGT_LIST[1<<(MXDIM_SAMPLER_GENPDF-1)] ;
+  double FRAC[MXDIM_SAMPLER_GENPDF], WGT, WSUM, u, a, b, t, den, *PROB ;
+  bool   ONEBIN[MXDIM_SAMPLER_GENPDF];
+  //  char fnam[] = "getRan_sampler_genPDF" ;
+
+  // ------------ BEGIN ------------
+
+  if ( !SAMPLER->INIT  ) { init_sampler_genPDF(IMAP); }
+  if ( !SAMPLER->VALID ) { return(ERROR); }
+
+  // locate cell for each HOSTLIB variable
+  for(idim=1; idim < NDIM; idim++ ) {
+    ONEBIN[idim] = ( GRIDMAP->NBIN[idim] < 2 ) ;
+    if ( ONEBIN[idim] ) { IGRID[idim] = 0; FRAC[idim] = 0.0; continue; }
+    istat = get_cell_GRIDMAP(GRIDMAP, idim, val_inputs[idim], 
+			     &IGRID[idim], &FRAC[idim]);
+    if ( istat != SUCCESS ) { return(ERROR); }
+    if ( IGRID[idim] > GRIDMAP->NBIN[idim]-2 ) 
+      { IGRID[idim] = GRIDMAP->NBIN[idim]-2;  FRAC[idim] = 1.0; }
+    if ( FRAC[idim] < 0.0 ) { FRAC[idim] = 0.0; }
+    if ( FRAC[idim] > 1.0 ) { FRAC[idim] = 1.0; }
+  }
+
+  // weight of each corner slice
+  NCORNER = 1 << (NDIM-1) ;
+  WSUM = 0.0 ;
+  for(icorner=0; icorner < NCORNER; icorner++ ) {
+    WGT = 1.0;  islice = 0;  slice_stride = 1;
+    for(idim=1; idim < NDIM; idim++ ) {
+      g = IGRID[idim] ;
+      if ( (icorner >> (idim-1)) & 1 ) {
+	WGT *= FRAC[idim] ;  
+	if ( ONEBIN[idim] ) { WGT = 0.0; } else { g++ ; }
+      }
+      else
+	{ WGT *= (1.0 - FRAC[idim]) ; }
+      islice       += g * slice_stride ;
+      slice_stride *= GRIDMAP->NBIN[idim] ;
+    }
+    SLICE_LIST[icorner] = islice ;
+    if ( WGT > 0.0 ) { WGT *= SAMPLER->SLICE_SUM[islice]; }
+    WGT_LIST[icorner]   = WGT ;
+    WSUM += WGT ;
+  }
+  if ( WSUM <= 0.0 ) { return(ERROR); }
+
+  // select corner slice; protect against round-off with ISEL
+  u = getRan_Flat1(ILIST_RAN) * WSUM ;
+  ISEL = -9 ;
+  for(icorner=0; icorner < NCORNER; icorner++ ) {
+    if ( WGT_LIST[icorner] <= 0.0 ) { continue; }
+    ISEL = icorner ;
+    if ( u < WGT_LIST[icorner] ) { break; }
+    u -= WGT_LIST[icorner] ;
+  }
+  islice = SLICE_LIST[ISEL] ;
+
+  // select cell with alias table
+  u = getRan_Flat1(ILIST_RAN) * (double)NCELL ;
+  k = (int)u ;  if ( k >= NCELL ) { k = NCELL-1; }
+  if ( (u - (double)k) >= SAMPLER->ALIAS_PROB[islice*NCELL+k] ) 
+    { k = SAMPLER->ALIAS_INDEX[islice*NCELL+k] ; }
+
+  // sample linear PROB within cell:  CDF(t) = (a*t + (b-a)*t^2/2)/((a+b)/2)
+  PROB = &SAMPLER->PROB_NODE[islice*NBIN] ;
+  a = PROB[k];  b = PROB[k+1] ;
+  u = getRan_Flat1(ILIST_RAN);
+  den = a + sqrt(a*a + (b*b-a*a)*u) ;
+  if ( den > 0.0 ) { t = (a+b)*u/den ; } else { t = u; }
+  if ( t > 1.0 ) { t = 1.0; }
+
+  *ranval = GRIDMAP->VALMIN[0] + ((double)k + t) * GRIDMAP->VALBIN[0] ;
+
+  return(SUCCESS);
+
+} // end getRan_sampler_genPDF
+
 // =============================
 void iter_summary_genPDF(void) {
 
@@ -3,6 +3,7 @@
 
   Oct 22 2020: MXITER_GENPDF -> 1000 (was 200)
   Apr 18 2022: MXVAR_GENPDF -> 20 (was 10)
+  Oct 14 2026: add OPTMASK_GENPDF_FAST for compiled alias sampler
 
  *******************************/
 
@@ -16,6 +17,9 @@
 #define  OPTMASK_GENPDF_SLOW          2  // use full val range
 #define  OPTMASK_GENPDF_KEYSOURCE_ARG 4  // arg is from command line
 #define  OPTMASK_GENPDF_EXTERNAL_FP   8
+#define  OPTMASK_GENPDF_FAST         16  // O(1) alias/inverse-CDF sampler
+
+#define  MXDIM_SAMPLER_GENPDF  8  // max NDIM for alias sampler (2^7 corners)
 
 int      NMAP_GENPDF;
 int      NCALL_GENPDF ;
@@ -25,6 +29,21 @@ int      KEYSOURCE_GENPDF; // 1=file, 2=arg; used for prioritization
 
 double MAG_OFFSET_GENPDF;  // read from MAG_OFFSET key in GENPDF_FILE
 
+// Oct 2026: alias tables over the cells of each 1D slice along the
+// generated variable; one slice per grid point of the HOSTLIB
+// variables. Compiled on first use (after PROB_EXPON_REWGT is set).
+typedef struct {
+  bool    INIT ;        // true -> compiled
+  bool    VALID ;       // false -> use rejection method
+  int     NBIN ;        // number of nodes along generated variable
+  int     NCELL ;       // NBIN-1
+  int     NSLICE ;      // number of 1D slices 
+  double *PROB_NODE ;   // [NSLICE*NBIN] PROB at each node (>=0)
+  double *SLICE_SUM ;   // [NSLICE] integral of each slice (per cell)
+  double *ALIAS_PROB ;  // [NSLICE*NCELL] alias acceptance prob
+  int    *ALIAS_INDEX ; // [NSLICE*NCELL] alias cell
+} GENPDF_SAMPLER_DEF ;
+
 struct {
   char     MAPNAME[40];
   char     *VARNAMES[MXVAR_GENPDF];
@@ -39,6 +58,8 @@ struct {
   // option to rewgot PROB -> PROB^PROB_EXPON_REWGT
   double PROB_EXPON_REWGT;
 
+  GENPDF_SAMPLER_DEF SAMPLER ; // Oct 2026
+
 } GENPDF[MXMAP_GENPDF] ;
 
 float TMPSTORE_PROB_REF_GENPDF[MXITER_GENPDF];
@@ -62,6 +83,10 @@ void   free_memory_genPDF(void); // release memory of all genPDF maps
 int  IMAP_GENPDF(char *parName, bool *LOGPARAM);
 void iter_summary_genPDF(void);
 
+void init_sampler_genPDF(int IMAP);
+void free_sampler_genPDF(int IMAP);
+int  getRan_sampler_genPDF(int IMAP, double *val_inputs, double *ranval);
+
 // xxx mark bool matchVar_GENPDF_GENGAUSS(char *varName_GENPDF, char *varName_GENGAUSS);
 
 // END
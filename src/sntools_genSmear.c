@@ -138,6 +138,15 @@ void  init_genSmear_FLAGS(int MSKOPT, char *SCALE_STRING) {
 
   GENSMEAR.NSET_RANGauss  = 0 ;
   GENSMEAR.NSET_RANFlat   = 0 ;
+  GENSMEAR.NLOAD_RAN      = 0 ;
+  GENSMEAR_TABLE.USE      = false ;
+  GENSMEAR_TABLE.FILL_ACTIVE = false ;
+
+  // Oct 2026: force correlated randoms for first event
+  GENSMEAR_C11.NLOAD_RAN_LAST    = -9 ;
+  GENSMEAR_VCR.NLOAD_RAN_LAST    = -9 ;
+  GENSMEAR_OIR.NLOAD_RAN_LAST    = -9 ;
+  GENSMEAR_COVSED.NLOAD_RAN_LAST = -9 ;
   GENSMEAR.MSKOPT         = MSKOPT ; // Oct 2019
 
   // hard-wire wavelengths to monitor COVARIANCE between 
@@ -269,6 +278,12 @@ void load_genSmear_randoms(int CID, double gmin, double gmax, double RANFIX) {
   //    gmin = min Gauran to clip Gaussian
   //    gmax = max Gauran to clip Gaussian
   //    RANFIX is a user option to fix random Gaussians for debug
+  //
+  // Oct 14 2026: increment GENSMEAR.NLOAD_RAN so that models with
+  //   correlated randoms (C11,VCR,OIR,COVSED) compute them once per
+  //   event instead of once per get_genSmear call.
+  // Oct 15 2026: use ISTAGE_RAN_SMEAR substream if init_random_stage 
+  //   was called (sim RANDOM_STAGE option); else legacy ILIST_RAN.
 
   int  NRANGauss = GENSMEAR.NGEN_RANGauss ;
   int  NRANFlat  = GENSMEAR.NGEN_RANFlat ;
@@ -285,14 +300,16 @@ void load_genSmear_randoms(int CID, double gmin, double gmax, double RANFIX) {
   // generate Guassian randoms for intrinsic scatter [genSmear] model
   if ( NRANGauss < MXFILTINDX-1 ) { NRANGauss = MXFILTINDX-1; } 
   for(iran=0; iran < NRANGauss; iran++ ) {                 
-    GENSMEAR.RANGauss_LIST[iran] = getRan_GaussClip(ILIST_RAN,gmin,gmax); 
+    GENSMEAR.RANGauss_LIST[iran] = 
+      getRan_GaussClip_stage(ISTAGE_RAN_SMEAR,ILIST_RAN,gmin,gmax); 
   }
 
  
   // repeat for 0-1 [flat] randoms
   if ( NRANFlat < MXFILTINDX-1 ) { NRANFlat = MXFILTINDX-1; }
   for ( iran=0; iran < NRANFlat; iran++ ) 
-    {  GENSMEAR.RANFlat_LIST[iran]  = getRan_Flat1(ILIST_RAN);  } 
+    {  GENSMEAR.RANFlat_LIST[iran] = 
+	getRan_Flat1_stage(ISTAGE_RAN_SMEAR,ILIST_RAN);  } 
   
   if ( LDMP ) {
     double GFIRST = GENSMEAR.RANGauss_LIST[0];
@@ -310,12 +327,14 @@ void load_genSmear_randoms(int CID, double gmin, double gmax, double RANFIX) {
     }
   }
 
+  GENSMEAR.NLOAD_RAN++ ;
+
   // Feb 12 2020: check randoms for phaseCor model
   if ( GENSMEAR_PHASECOR.USE  ) {  
     int NBIN = GENSMEAR_PHASECOR.NBIN ;
     for(iran=0; iran < NBIN; iran++ ) {                 
       GENSMEAR_PHASECOR.RANGauss_LIST[iran] = 
-	getRan_GaussClip(ILIST_RAN,gmin,gmax); 
+	getRan_GaussClip_stage(ISTAGE_RAN_SMEAR,ILIST_RAN,gmin,gmax); 
     }
   }
 
@@ -346,6 +365,7 @@ void get_genSmear(double *parList, int NLam, double *Lam,
   // Nov 30 2019: MAGSMEAR_COH -> MAGSMEAR_COH[2]
   // Feb 17 2020: add c & x1 input args
   // May 31 2021: refactor to pass parList that includes logMass
+  // Oct 14 2026: check option to interpolate per-event table
 
   double Trest   = parList[0];
   double x1      = parList[1];
@@ -362,6 +382,12 @@ void get_genSmear(double *parList, int NLam, double *Lam,
   repeat = repeat_genSmear(Trest,NLam,Lam);
   if ( repeat ) {  goto SET_LAST; }
 
+  if ( GENSMEAR_TABLE.USE && !GENSMEAR_TABLE.FILL_ACTIVE ) {
+    // table already includes SCALE and sets MAGSMEAR_COH
+    get_genSmear_TABLE(parList, NLam, Lam, magSmear);
+    goto SET_LAST;
+  }
+
   // abort if more than one model has been initialized.
   if ( GENSMEAR.NUSE > 1 ) {
     sprintf(c1err,"%d GENSMEAR models initilialized", GENSMEAR.NUSE);
@@ -441,6 +467,9 @@ int repeat_genSmear(double Trest, int NLam, double *Lam) {
   //   GENMAG_SMEAR_MSKOPT:  32
   // then always return NEW (no repeats).
   //
+  // See init_genSmear_TABLE for MSKOPT=64 option to interpolate
+  // per-event table in (lambda,Trest).
+  //
 
   int REPEAT  = 1;
   int NEW     = 0;
@@ -455,7 +484,7 @@ int repeat_genSmear(double Trest, int NLam, double *Lam) {
   // so always re-calculate.
   if ( NLam == 1 ) { return(NEW); }
 
-  if ( (GENSMEAR.MSKOPT & 32 )>0 ) { return(NEW); }
+  if ( (GENSMEAR.MSKOPT & MSKOPT_GENSMEAR_NOREPEAT )>0 ) { return(NEW); }
 
   if ( LDMP ) {
     printf(" xxx ---------------------------------- \n");
@@ -478,6 +507,172 @@ int repeat_genSmear(double Trest, int NLam, double *Lam) {
 } // end repeat_genSmear
 
 
+// ********************************************************
+void init_genSmear_TABLE(double *LAMRANGE) {
+
+  // Created Oct 2026
+  // Init optional table of magSmear vs. (rest-lambda, Trest) so that
+  // each event evaluates the smear model on a compact grid, and then
+  // all filters, epochs and spectra interpolate from this table.
+  // Enabled with sim-input key
+  //    GENMAG_SMEAR_MSKOPT: 64
+  //
+  // Input LAMRANGE = rest-frame wavelength range of table.
+
+  int    NBIN_LAM, NBIN_TREST, ilam, itrest, MEMD ;
+  double LAMBIN   = LAMBIN_GENSMEAR_TABLE ;
+  double TRESTBIN = TRESTBIN_GENSMEAR_TABLE ;
+  char fnam[] = "init_genSmear_TABLE" ;
+
+  // ------------ BEGIN ------------
+
+  if ( (GENSMEAR.MSKOPT & MSKOPT_GENSMEAR_TABLE) == 0 ) { return; }
+
+  if ( LAMRANGE[1] <= LAMRANGE[0] ) {
+    sprintf(c1err,"Invalid LAMRANGE = %.1f to %.1f", 
+	    LAMRANGE[0], LAMRANGE[1] );
+    sprintf(c2err,"Check GENMAG_SMEAR_MSKOPT");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  NBIN_LAM   = (int)((LAMRANGE[1] - LAMRANGE[0])/LAMBIN + 0.5) + 1 ;
+  NBIN_TREST = (int)((TRESTMAX_GENSMEAR_TABLE - TRESTMIN_GENSMEAR_TABLE)/
+		     TRESTBIN + 0.5) + 1 ;
+
+  GENSMEAR_TABLE.USE        = true ;
+  GENSMEAR_TABLE.NBIN_LAM   = NBIN_LAM ;
+  GENSMEAR_TABLE.NBIN_TREST = NBIN_TREST ;
+  GENSMEAR_TABLE.LAMMIN     = LAMRANGE[0] ;
+  GENSMEAR_TABLE.LAMBIN     = LAMBIN ;
+  GENSMEAR_TABLE.TRESTMIN   = TRESTMIN_GENSMEAR_TABLE ;
+  GENSMEAR_TABLE.TRESTBIN   = TRESTBIN ;
+  GENSMEAR_TABLE.NFILL_ROW  = 0 ;
+  GENSMEAR_TABLE.NCALL      = 0 ;
+
+  MEMD = NBIN_LAM * sizeof(double);
+  GENSMEAR_TABLE.LAM      = (double*) malloc(MEMD);
+  GENSMEAR_TABLE.MAGSMEAR = (double*) malloc(MEMD*NBIN_TREST);
+  GENSMEAR_TABLE.NLOAD_RAN_ROW = (int*) malloc(NBIN_TREST*sizeof(int));
+
+  for(ilam=0; ilam < NBIN_LAM; ilam++ ) 
+    { GENSMEAR_TABLE.LAM[ilam] = LAMRANGE[0] + LAMBIN*(double)ilam; }
+
+  for(itrest=0; itrest < NBIN_TREST; itrest++ ) 
+    { GENSMEAR_TABLE.NLOAD_RAN_ROW[itrest] = -9 ; }
+
+  printf("\t Smear-mode: interpolate per-event table with \n");
+  printf("\t    %d lam bins (%.0f-%.0f A) x %d Trest bins (%.0f to %.0f d)\n",
+	 NBIN_LAM, GENSMEAR_TABLE.LAM[0], GENSMEAR_TABLE.LAM[NBIN_LAM-1],
+	 NBIN_TREST, TRESTMIN_GENSMEAR_TABLE, TRESTMAX_GENSMEAR_TABLE );
+  fflush(stdout);
+
+  return ;
+
+} // end init_genSmear_TABLE
+
+
+// ********************************************************
+void get_genSmear_TABLE(double *parList, int NLam, double *Lam, 
+			double *magSmear) {
+
+  // Created Oct 2026
+  // Return magSmear[NLam] by bilinear interpolation of per-event
+  // table in (lambda,Trest). Trest rows are filled on first use
+  // for each new set of genSmear randoms or new SN params.
+  // Values outside the table are evaluated at the table edge.
+
+  int    NBIN_LAM   = GENSMEAR_TABLE.NBIN_LAM ;
+  int    NBIN_TREST = GENSMEAR_TABLE.NBIN_TREST ;
+  int    NLOAD_RAN  = GENSMEAR.NLOAD_RAN ;
+  double Trest      = parList[0];
+  int    ilam, itrest, ipar, jlam ;
+  bool   NEWPAR = false ;
+  double TT, tfrac, LL, lfrac, *ROW0, *ROW1, M0, M1 ;
+  //  char fnam[] = "get_genSmear_TABLE" ;
+
+  // ------------ BEGIN ------------
+
+  GENSMEAR_TABLE.NCALL++ ;
+
+  // if SN params change (e.g., for SCALE), invalidate all rows
+  for(ipar=1; ipar < 4; ipar++ ) {
+    if ( parList[ipar] != GENSMEAR_TABLE.PARLIST_LAST[ipar] ) 
+      { NEWPAR = true; }
+    GENSMEAR_TABLE.PARLIST_LAST[ipar] = parList[ipar];
+  }
+  if ( NEWPAR ) {
+    for(itrest=0; itrest < NBIN_TREST; itrest++ ) 
+      { GENSMEAR_TABLE.NLOAD_RAN_ROW[itrest] = -9 ; }
+  }
+
+  // locate Trest bin and fractional position
+  TT     = (Trest - GENSMEAR_TABLE.TRESTMIN) / GENSMEAR_TABLE.TRESTBIN ;
+  itrest = (int)floor(TT);
+  if ( itrest < 0            ) { itrest = 0; }
+  if ( itrest > NBIN_TREST-2 ) { itrest = NBIN_TREST-2; }
+  tfrac  = TT - (double)itrest ;
+  if ( tfrac < 0.0 ) { tfrac = 0.0; }
+  if ( tfrac > 1.0 ) { tfrac = 1.0; }
+
+  if ( GENSMEAR_TABLE.NLOAD_RAN_ROW[itrest] != NLOAD_RAN ) 
+    { fill_genSmear_TABLE(itrest, parList); }
+  if ( GENSMEAR_TABLE.NLOAD_RAN_ROW[itrest+1] != NLOAD_RAN ) 
+    { fill_genSmear_TABLE(itrest+1, parList); }
+
+  ROW0 = &GENSMEAR_TABLE.MAGSMEAR[itrest*NBIN_LAM] ;
+  ROW1 = &GENSMEAR_TABLE.MAGSMEAR[(itrest+1)*NBIN_LAM] ;
+
+  for(ilam=0; ilam < NLam; ilam++ ) {
+    LL   = (Lam[ilam] - GENSMEAR_TABLE.LAMMIN) / GENSMEAR_TABLE.LAMBIN ;
+    jlam = (int)floor(LL);
+    if ( jlam < 0          ) { jlam = 0; }
+    if ( jlam > NBIN_LAM-2 ) { jlam = NBIN_LAM-2; }
+    lfrac = LL - (double)jlam ;
+    if ( lfrac < 0.0 ) { lfrac = 0.0; }
+    if ( lfrac > 1.0 ) { lfrac = 1.0; }
+
+    M0 = ROW0[jlam] + lfrac * ( ROW0[jlam+1] - ROW0[jlam] ) ;
+    M1 = ROW1[jlam] + lfrac * ( ROW1[jlam+1] - ROW1[jlam] ) ;
+    magSmear[ilam] = M0 + tfrac * ( M1 - M0 ) ;
+  }
+
+  return ;
+
+} // end get_genSmear_TABLE
+
+
+// ********************************************************
+void fill_genSmear_TABLE(int itrest, double *parList) {
+
+  // Created Oct 2026
+  // Evaluate smear model for all table wavelengths at Trest row itrest.
+  // Force re-compute (no repeat) by resetting CID_LAST, and disable
+  // table lookup while calling get_genSmear.
+
+  int    NBIN_LAM = GENSMEAR_TABLE.NBIN_LAM ;
+  double parTmp[4];
+  int    ipar ;
+
+  // ------------ BEGIN ------------
+
+  for(ipar=0; ipar < 4; ipar++ ) { parTmp[ipar] = parList[ipar]; }
+  parTmp[0] = GENSMEAR_TABLE.TRESTMIN + 
+    GENSMEAR_TABLE.TRESTBIN * (double)itrest ;
+
+  GENSMEAR.CID_LAST          = -9 ;
+  GENSMEAR_TABLE.FILL_ACTIVE = true ;
+  get_genSmear(parTmp, NBIN_LAM, GENSMEAR_TABLE.LAM, 
+	       &GENSMEAR_TABLE.MAGSMEAR[itrest*NBIN_LAM] );
+  GENSMEAR_TABLE.FILL_ACTIVE = false ;
+
+  GENSMEAR_TABLE.NLOAD_RAN_ROW[itrest] = GENSMEAR.NLOAD_RAN ;
+  GENSMEAR_TABLE.NFILL_ROW++ ;
+
+  return ;
+
+} // end fill_genSmear_TABLE
+
+
 // ***********************************
 void init_genSmear_COVLAM_debug(double *lam, double COVMAT[2][2]) {
 
@@ -1802,7 +1997,8 @@ void get_genSmear_Chotard11(double Trest, int NLam, double *Lam,
 
   
   int    ilam, IFILT ;
-  double lam, tmp, SCATTER_VALUES[NBAND_C11] ;
+  double lam, tmp ;
+  double *SCATTER_VALUES = GENSMEAR_C11.SCATTER_VALUES ;
 
   double LAMCEN[NBAND_C11] = 
     { 2500.0, 3560.0, 4390.0, 5490.0, 6545.0, 8045.0 } ;
@@ -1812,8 +2008,12 @@ void get_genSmear_Chotard11(double Trest, int NLam, double *Lam,
   // ---------- BEGIN -------
 
   // Feb 17 2020: use new utility for correlated randoms
-  getRan_GaussCorr(&GENSMEAR_C11.DECOMP, GENSMEAR.RANGauss_LIST, // (I)
-		   SCATTER_VALUES );            // (O)
+  // Oct 14 2026: only for new set of randoms
+  if ( GENSMEAR_C11.NLOAD_RAN_LAST != GENSMEAR.NLOAD_RAN ) {
+    getRan_GaussCorr(&GENSMEAR_C11.DECOMP, GENSMEAR.RANGauss_LIST, // (I)
+		     SCATTER_VALUES );            // (O)
+    GENSMEAR_C11.NLOAD_RAN_LAST = GENSMEAR.NLOAD_RAN ;
+  }
 
   // -------------
   for ( ilam=0; ilam < NLam; ilam++ ) {
@@ -2391,7 +2591,6 @@ void get_genSmear_VCR(double Trest, int NLam, double *Lam,
 
   double 
     VSI, VSI_zShift, SUMPROB, tmp, lam, ranB, sigB, magSmearB
-    ,colorSmear[MXFILTINDX]
     ,LAMCEN[MXFILTINDX] 
     ,MAGSMEAR[MXFILTINDX]
     ;
@@ -2447,14 +2646,18 @@ void get_genSmear_VCR(double Trest, int NLam, double *Lam,
   MAGSMEAR[GENSMEAR_VCR.IFILT_B] = magSmearB ;
 
   //Matrix Multiply to get color-scatter values = ch^T normalvector
-
-  for (i = 0 ; i < NC ; i++) {
-    colorSmear[i] = 0.0 ;  
-    for (j = 0 ; j < NC ; j++){
-      //transpose cholesky matrix
-      tmp = GENSMEAR_VCR.Cholesky[j][i] ;      
-      colorSmear[i] += tmp * GENSMEAR.RANGauss_LIST[j] ;
+  // Oct 14 2026: only for new set of randoms; upper triangle is zero.
+  double *colorSmear = GENSMEAR_VCR.COLOR_SMEAR ;
+  if ( GENSMEAR_VCR.NLOAD_RAN_LAST != GENSMEAR.NLOAD_RAN ) {
+    for (i = 0 ; i < NC ; i++) {
+      colorSmear[i] = 0.0 ;  
+      for (j = 0 ; j <= i ; j++){
+	//transpose cholesky matrix
+	tmp = GENSMEAR_VCR.Cholesky[j][i] ;      
+	colorSmear[i] += tmp * GENSMEAR.RANGauss_LIST[j] ;
+      }
     }
+    GENSMEAR_VCR.NLOAD_RAN_LAST = GENSMEAR.NLOAD_RAN ;
   }
 
 
@@ -2952,7 +3155,8 @@ void get_genSmear_OIR(double Trest, int NLam, double *Lam,
   double RANGauss_COH = GENSMEAR.RANGauss_LIST[NBAND];
 
   int    ilam, i, j, IFILT ;
-  double lam, tmp, SCATTER_VALUES[NBAND_OIR], LAMCEN[NBAND_OIR] ;
+  double lam, tmp, LAMCEN[NBAND_OIR] ;
+  double *SCATTER_VALUES = GENSMEAR_OIR.SCATTER_VALUES ;
   double SCATTER_COH;
   char fnam[] = "get_genSmear_OIR";
 
@@ -2971,13 +3175,17 @@ void get_genSmear_OIR(double Trest, int NLam, double *Lam,
 
   //Matrix Multiply
   //scatter_values = ch^T normalvector
-  for (i = 0 ; i < NBAND_OIR ; i++) {
-    SCATTER_VALUES[i] = 0.0 ;  
-    for (j = 0 ; j < NBAND_OIR ; j++){
-      //transpose cholesky matrix
-      tmp = GENSMEAR_OIR.Cholesky[j][i] ;      
-      SCATTER_VALUES[i] += tmp * GENSMEAR.RANGauss_LIST[j] ;
+  // Oct 14 2026: only for new set of randoms; upper triangle is zero.
+  if ( GENSMEAR_OIR.NLOAD_RAN_LAST != GENSMEAR.NLOAD_RAN ) {
+    for (i = 0 ; i < NBAND_OIR ; i++) {
+      SCATTER_VALUES[i] = 0.0 ;  
+      for (j = 0 ; j <= i ; j++){
+	//transpose cholesky matrix
+	tmp = GENSMEAR_OIR.Cholesky[j][i] ;      
+	SCATTER_VALUES[i] += tmp * GENSMEAR.RANGauss_LIST[j] ;
+      }
     }
+    GENSMEAR_OIR.NLOAD_RAN_LAST = GENSMEAR.NLOAD_RAN ;
   }
 
 
@@ -3503,8 +3711,12 @@ void get_genSmear_COVSED(double Trest, int NWAVE, double *WAVE,
 
 
   // Feb 17 2020: new utility to fetch correlated randoms
-  getRan_GaussCorr(&GENSMEAR_COVSED.DECOMP, GENSMEAR.RANGauss_LIST, // (I)
-		   GENSMEAR_COVSED.SCATTER_VALUES );        // (O)
+  // Oct 14 2026: only for new set of randoms
+  if ( GENSMEAR_COVSED.NLOAD_RAN_LAST != GENSMEAR.NLOAD_RAN ) {
+    getRan_GaussCorr(&GENSMEAR_COVSED.DECOMP, GENSMEAR.RANGauss_LIST, // (I)
+		     GENSMEAR_COVSED.SCATTER_VALUES );        // (O)
+    GENSMEAR_COVSED.NLOAD_RAN_LAST = GENSMEAR.NLOAD_RAN ;
+  }
 
   // -------------
   for ( iwave=0; iwave < NWAVE; iwave++ ) {
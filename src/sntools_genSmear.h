@@ -2,10 +2,14 @@
 //
 // Mar 30 2018: MXLAM_GENSMEAR_SALT2 --> 4000 (was 1000)
 // Oct 18 2019: add COVSED model
+// Oct 14 2026: add optional per-event (lambda x Trest) magSmear table
 
 #define MASK_GENSMEAR_APPLY 1 // apply genSmear, old or new
 #define MASK_GENSMEAR_NEW   2 // re-compute genSmear
 
+#define MSKOPT_GENSMEAR_NOREPEAT  32 // always re-compute (no repeats)
+#define MSKOPT_GENSMEAR_TABLE     64 // interpolate per-event lam x T table
+
 void  init_genSmear_FLAGS(int MSKOPT, char *SCALE_STRING); 
 int   istat_genSmear(void) ;
 
@@ -62,6 +66,10 @@ void  SETSNPAR_genSmear(double shape, double color, double redshift) ;
 void get_genSmear(double *parList, int NLam, double *Lam, double *magSmear) ;
 
 int  repeat_genSmear(double Trest, int NLam, double *Lam);
+void init_genSmear_TABLE(double *LAMRANGE);
+void get_genSmear_TABLE(double *parList, int NLam, double *Lam, 
+			double *magSmear) ;
+void fill_genSmear_TABLE(int itrest, double *parList);
 void load_genSmear_randoms(int CID, double rmin, double rmax, double RANFIX);
 
 void init_genSmear_COVLAM_debug(double *lam, double COVMAT[2][2] );
@@ -135,6 +143,7 @@ struct GENSMEAR {
   double *RANGauss_LIST; // [MXRAN_GENSMEAR] ; 
   double *RANFlat_LIST; // [MXRAN_GENSMEAR] ;
   int    CID; // CID for each set of randoms
+  int    NLOAD_RAN ; // Oct 2026: incremented each load_genSmear_randoms
 
   double SHAPE, COLOR ; // allows more complex magSmear models
   double REDSHIFT ;       // allows for redshift evolution (Jan 2014)
@@ -227,6 +236,10 @@ struct GENSMEAR_C11 {
   int USE ;
   CHOLESKY_DECOMP_DEF DECOMP ;
   int OPT_farUV;  // see sub-models C11_0, C11_1, C11_2
+
+  // Oct 2026: correlated randoms computed once per event
+  int    NLOAD_RAN_LAST ;
+  double SCATTER_VALUES[NBAND_C11];
 } GENSMEAR_C11 ;
 
 // ------------ OIR struct ----------------------
@@ -259,6 +272,9 @@ struct GENSMEAR_OIR {
   int       LAMCEN[MXFILTINDX] ;  // <LAM> vs. IFILTDEF
   int       IFILT_B ;
 
+  // Oct 2026: correlated randoms computed once per event
+  int    NLOAD_RAN_LAST ;
+  double SCATTER_VALUES[NBAND_OIR];
 
 } GENSMEAR_OIR;
 
@@ -281,6 +297,7 @@ struct GENSMEAR_COVSED {
 
   // magSmear scatter values for each event.
   double *SCATTER_VALUES; 
+  int    NLOAD_RAN_LAST ; // Oct 2026: SCATTER_VALUES computed once per event
 
 } GENSMEAR_COVSED;
 
@@ -353,6 +370,10 @@ struct GENSMEAR_VCR {
   double   GENRAN_VSI ;  // generated VSI
   double   GENRAN_COLORSHIFT[MXCOLOR_VCR];  // broadband color shift
 
+  // Oct 2026: correlated color smear computed once per event
+  int      NLOAD_RAN_LAST ;
+  double   COLOR_SMEAR[MXCOLOR_VCR];
+
 } GENSMEAR_VCR ;
 
 
@@ -394,6 +415,26 @@ struct {
 } GENSMEAR_PHASECOR ;
 
 
+// Oct 2026: optional table of magSmear vs. (rest-lambda, Trest) for each
+// event (GENMAG_SMEAR_MSKOPT += 64). Each Trest row is evaluated once per
+// event on first use; all filters, epochs and spectra then interpolate.
+#define LAMBIN_GENSMEAR_TABLE    20.0  // Angstroms
+#define TRESTBIN_GENSMEAR_TABLE   2.0  // days
+#define TRESTMIN_GENSMEAR_TABLE -40.0
+#define TRESTMAX_GENSMEAR_TABLE 200.0
+struct {
+  bool    USE ;
+  bool    FILL_ACTIVE ;  // true while evaluating model for table
+  int     NBIN_LAM, NBIN_TREST ;
+  double  LAMMIN, LAMBIN, TRESTMIN, TRESTBIN ;
+  double *LAM ;          // [NBIN_LAM]
+  double *MAGSMEAR ;     // [NBIN_TREST*NBIN_LAM]
+  int    *NLOAD_RAN_ROW ; // NLOAD_RAN when each Trest row was filled
+  double  PARLIST_LAST[4] ;
+  int     NFILL_ROW, NCALL ; // diagnostics
+} GENSMEAR_TABLE ;
+
+
 // --------- private struct for testing --------------
 struct GENSMEAR_PRIVATE {
   int USE ;
@@ -279,6 +279,9 @@ void malloc_GRIDMAP(int OPT, GRIDMAP_DEF *gridmap, int NFUN, int NDIM, int MAPSI
 
     sprintf(string,"allocate %.2f MB for %d bins", MEMORY, MAPSIZE);
     gridmap->MEMORY = MEMORY ;
+    gridmap->FUNVAL_DENSE = NULL ; // Oct 2026
+    gridmap->FAST_INIT    = false ;
+    gridmap->CACHE_IROW   = NULL ;
   }
   else {
     sprintf(string,"free GRIDMAP %d ", gridmap->ID );
@@ -294,6 +297,11 @@ void malloc_GRIDMAP(int OPT, GRIDMAP_DEF *gridmap, int NFUN, int NDIM, int MAPSI
 
     for(ifun=0; ifun < NFUN; ifun++ ) { free(gridmap->FUNVAL[ifun]); }
     free(gridmap->FUNVAL);
+    if ( gridmap->FUNVAL_DENSE != NULL ) 
+      { free(gridmap->FUNVAL_DENSE); gridmap->FUNVAL_DENSE = NULL; }
+    if ( gridmap->CACHE_IROW != NULL ) 
+      { free(gridmap->CACHE_IROW); gridmap->CACHE_IROW = NULL; }
+    gridmap->FAST_INIT = false ;
   }
 
   printf("\t %s: %s\n", fnam, string);
@@ -333,6 +341,7 @@ void init_interp_GRIDMAP(int ID, char *MAPNAME, int MAPSIZE,
   //   + fix bug malloc-ing FUNVAL : I8p -> I8p * NFUN
   //
   // May 26 2021: move malloc calls into malloc_GRIDMAP()
+  // Oct 14 2026: call init_fast_GRIDMAP to select interp kernel.
   //
 
   int idim, ifun, i, NBIN, igrid_tmp, igrid_1d[100] ;
@@ -460,12 +469,16 @@ void init_interp_GRIDMAP(int ID, char *MAPNAME, int MAPSIZE,
       gridmap->INVMAP[igrid_tmp] = i ;
 
   } // end loop over MAPSIZE
+
+  // Oct 2026: init strides, cell cache and kernel for interp_fast_GRIDMAP
+  if ( NDIM <= MXDIM_FAST_GRIDMAP ) { init_fast_GRIDMAP(gridmap); }
   
   return ;
 
 } // end of init_interp_GRIDMAP
 
 
+ATTR_TARGET_CLONES
 int interp_GRIDMAP(GRIDMAP_DEF *gridmap, double *data, double *interpFun ) {
 
   // Created Jul 3, 2011
@@ -492,6 +505,10 @@ int interp_GRIDMAP(GRIDMAP_DEF *gridmap, double *data, double *interpFun ) {
   //  + return SUCCESS or ERROR instead of hard-coded values.
   //
   // Mar 15 2020: allow numerical glitches in TMPMIN and TMPMAX
+  //
+  // Oct 14 2026: for NDIM <= MXDIM_FAST_GRIDMAP, use interp_fast_GRIDMAP
+  //   with pre-computed strides and last-cell cache; code below is 
+  //   used only for larger NDIM.
 
   int 
     ivar, ifun, NFUN, NVAR, ID, igrid, MSK, NBIN, OPT_EXTRAP
@@ -527,6 +544,9 @@ int interp_GRIDMAP(GRIDMAP_DEF *gridmap, double *data, double *interpFun ) {
     return(SUCCESS);
   }
 
+  if ( NVAR <= MXDIM_FAST_GRIDMAP ) 
+    { return interp_fast_GRIDMAP(gridmap, data, interpFun); }
+
   for  ( ifun=0; ifun < NFUN; ifun++ )   {  
     interpFun[ifun] = 0.0 ; 
     WGT_SUM[ifun] = 0.0 ;
@@ -708,6 +728,505 @@ int interp_GRIDMAP(GRIDMAP_DEF *gridmap, double *data, double *interpFun ) {
 } // end of interp_GRIDMAP
 
 
+
+// ================================================
+void init_fast_GRIDMAP(GRIDMAP_DEF *gridmap) {
+
+  // Created Oct 2026
+  // Store 1D-index stride for each dimension (same as init_1DINDEX,
+  // but stored per gridmap) and allocate last-cell cache with
+  // FUNVAL row for each of the 2^NDIM cell corners.
+  // Note that init_interp_GRIDMAP aborts on non-uniform bins, so 
+  // cell index in each dimension is always computed in O(1).
+
+  int NDIM = gridmap->NDIM ;
+  int NCORNER = 1 << NDIM ;
+  int idim ;
+
+  // ---------- BEGIN ----------
+
+  gridmap->STRIDE[0] = 1 ;
+  for(idim=1; idim < NDIM; idim++ ) 
+    { gridmap->STRIDE[idim] = gridmap->STRIDE[idim-1]*gridmap->NBIN[idim-1]; }
+
+  for(idim=0; idim < NDIM; idim++ ) { gridmap->CACHE_IGRID[idim] = -9; }
+
+  if ( gridmap->CACHE_IROW != NULL ) { free(gridmap->CACHE_IROW); }
+  gridmap->CACHE_IROW = (int*)malloc(NCORNER*sizeof(int));
+  gridmap->FAST_INIT  = true ;
+
+  // select compile-time specialized kernel (see interp_kernel_GRIDMAP)
+  if ( NDIM <= 4 && gridmap->NFUN <= 3 ) 
+    { gridmap->IKERNEL = 10*NDIM + gridmap->NFUN ; }
+  else
+    { gridmap->IKERNEL = 0 ; }
+
+  return ;
+
+} // end init_fast_GRIDMAP
+
+
+// ================================================
+ATTR_TARGET_CLONES
+int interp_fast_GRIDMAP(GRIDMAP_DEF *gridmap, double *data, double *interpFun) {
+
+  // Created Oct 2026
+  // Fast version of interp_GRIDMAP (valid for NDIM <= MXDIM_FAST_GRIDMAP)
+  // with identical result:
+  //  + cell index & fraction per dimension from get_cell_GRIDMAP
+  //  + if cell is the same as on previous call (coherent queries), 
+  //    re-use FUNVAL rows for each corner; otherwise compute them
+  //    from per-gridmap strides instead of get_1DINDEX.
+  //  + corner weights are built incrementally (one multiply per corner
+  //    per dimension, in the same order as interp_GRIDMAP).
+  //
+  // Function returns SUCCESS, or ERROR if *data is outside grid
+  // and OPT_EXTRAP=0.
+
+  int    NVAR    = gridmap->NDIM ;
+  int    NFUN    = gridmap->NFUN ;
+  int    NCORNER = 1 << NVAR ;
+  int    IGRID_VAR[MXDIM_GRIDMAP];
+  double GRIDFRAC[MXDIM_GRIDMAP], f ;
+  double CORNER_WGT[1<<MXDIM_FAST_GRIDMAP], WGT, CORNER_WGTSUM = 0.0 ;
+  int    *IROW_LIST, ivar, ifun, icorner, NC, g, INDEX_1D, IROW, istat ;
+  bool   SAME_CELL = true ;
+  char fnam[] = "interp_fast_GRIDMAP" ;
+
+  // ---------- BEGIN ----------
+
+  if ( !gridmap->FAST_INIT ) { init_fast_GRIDMAP(gridmap); }
+
+  for ( ivar=0; ivar < NVAR; ivar++ ) {
+    istat = get_cell_GRIDMAP(gridmap, ivar, data[ivar], 
+			     &IGRID_VAR[ivar], &GRIDFRAC[ivar] );
+    if ( istat != SUCCESS ) { return(ERROR); }
+    if ( IGRID_VAR[ivar] != gridmap->CACHE_IGRID[ivar] ) { SAME_CELL = false; }
+  }
+
+  IROW_LIST = gridmap->CACHE_IROW ;
+
+  if ( !SAME_CELL ) {
+    for ( icorner=0; icorner < NCORNER; icorner++ ) {
+      INDEX_1D = 0 ;
+      for ( ivar=0; ivar < NVAR; ivar++ ) {
+	g = IGRID_VAR[ivar] + ( (icorner >> ivar) & 1 ) ;
+	if ( g < 0 || g >= gridmap->NBIN[ivar] ) {
+	  print_preAbort_banner(fnam);
+	  printf("\t ID=%d  NBIN=%d  icorner=%d\n",
+		 gridmap->ID, gridmap->NBIN[ivar], icorner);
+	  printf("\t grep IDGRIDMAP $SNANA_DIR/src/sntools_gridmap.h");
+	  sprintf(c1err, "Invalid igrid_var[ivar=%d]=%d", ivar, g);
+	  sprintf(c2err, "VAL=%f  VALMIN/MAX = %f / %f", 
+		  data[ivar], gridmap->VALMIN[ivar], gridmap->VALMAX[ivar]);
+	  errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+	}
+	INDEX_1D += gridmap->STRIDE[ivar] * g ;
+      }
+
+      IROW = gridmap->INVMAP[INDEX_1D] ;
+      if ( IROW < 0 || IROW > gridmap->NROW ) {
+	sprintf(c1err,"Invalid igrid_1D=%d (should be 0 to %d)",
+		IROW, gridmap->NROW-1); 
+	sprintf(c2err,"ID=%d  NVAR=%d ", gridmap->ID, NVAR ); 
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+      }
+      IROW_LIST[icorner] = IROW ;
+    }
+    for ( ivar=0; ivar < NVAR; ivar++ ) 
+      { gridmap->CACHE_IGRID[ivar] = IGRID_VAR[ivar]; }
+  }
+
+  // Oct 2026: specialized kernel for common NDIM & NFUN
+  if ( gridmap->IKERNEL > 0 ) {
+    CORNER_WGTSUM = interp_kernel_GRIDMAP(gridmap, GRIDFRAC, interpFun);
+    goto DIVIDE_WGTSUM ;
+  }
+
+  // corner weights: bit ivar of icorner selects GRIDFRAC or 1-GRIDFRAC
+  CORNER_WGT[0] = 1.0 ;   NC = 1;
+  for ( ivar=0; ivar < NVAR; ivar++ ) {
+    f = GRIDFRAC[ivar] ;
+    for ( icorner=0; icorner < NC; icorner++ ) {
+      CORNER_WGT[icorner+NC]  = CORNER_WGT[icorner] * f ;
+      CORNER_WGT[icorner]    *= (1.0 - f) ;
+    }
+    NC *= 2 ;
+  }
+
+  for ( ifun=0; ifun < NFUN; ifun++ ) { interpFun[ifun] = 0.0 ; }
+
+  for ( icorner=0; icorner < NCORNER; icorner++ ) {
+    WGT            = CORNER_WGT[icorner] ;
+    IROW           = IROW_LIST[icorner] ;
+    CORNER_WGTSUM += WGT ;
+    for ( ifun=0; ifun < NFUN; ifun++ ) 
+      { interpFun[ifun] += ( WGT * gridmap->FUNVAL[ifun][IROW] ); }
+  }
+
+ DIVIDE_WGTSUM:
+  if ( CORNER_WGTSUM <= 0.0 ) {
+    sprintf(c1err,"Could not compute CORNER_WGT for gridmap ID=%d", 
+	    gridmap->ID );
+    sprintf(c2err,"%s", "data = ") ;
+    for ( ivar=0; ivar < NVAR; ivar++ ) 
+      { sprintf(c2err,"%s %f", c2err, data[ivar] ) ; }
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  for ( ifun=0; ifun < NFUN; ifun++ ) { interpFun[ifun] /= CORNER_WGTSUM ; }
+
+  return(SUCCESS);
+
+} // end interp_fast_GRIDMAP
+
+
+
+// ================================================
+// Oct 2026: compile-time specialized corner sums for interp_fast_GRIDMAP.
+// With constant NDIM_K and NFUN_K the compiler fully unrolls the loops.
+// Weights and sums are accumulated in the same order as the generic
+// code in interp_fast_GRIDMAP, so results are identical.
+// Kernel returns sum of corner weights; interpFun is not yet normalized.
+
+#define DEFINE_INTERP_KERNEL_GRIDMAP(NAME, NDIM_K, NFUN_K)                \
+  double NAME(GRIDMAP_DEF *gridmap, double *GRIDFRAC, double *interpFun) { \
+    double W[1<<NDIM_K], SUM[NFUN_K], WSUM = 0.0, f ;                     \
+    int   *IROW_LIST = gridmap->CACHE_IROW ;                              \
+    int    ivar, icorner, ifun, NC = 1, IROW ;                            \
+    W[0] = 1.0 ;                                                          \
+    for ( ivar=0; ivar < NDIM_K; ivar++ ) {                               \
+      f = GRIDFRAC[ivar] ;                                                \
+      for ( icorner=0; icorner < NC; icorner++ ) {                        \
+	W[icorner+NC]  = W[icorner] * f ;                                 \
+	W[icorner]    *= (1.0 - f) ;                                      \
+      }                                                                   \
+      NC *= 2 ;                                                           \
+    }                                                                     \
+    for ( ifun=0; ifun < NFUN_K; ifun++ ) { SUM[ifun] = 0.0; }            \
+    for ( icorner=0; icorner < (1<<NDIM_K); icorner++ ) {                 \
+      IROW  = IROW_LIST[icorner] ;                                        \
+      WSUM += W[icorner] ;                                                \
+      for ( ifun=0; ifun < NFUN_K; ifun++ )                               \
+	{ SUM[ifun] += ( W[icorner] * gridmap->FUNVAL[ifun][IROW] ); }    \
+    }                                                                     \
+    for ( ifun=0; ifun < NFUN_K; ifun++ ) { interpFun[ifun] = SUM[ifun]; } \
+    return WSUM ;                                                         \
+  }
+
+DEFINE_INTERP_KERNEL_GRIDMAP(interp_kernel_GRIDMAP_11, 1, 1)
+DEFINE_INTERP_KERNEL_GRIDMAP(interp_kernel_GRIDMAP_12, 1, 2)
+DEFINE_INTERP_KERNEL_GRIDMAP(interp_kernel_GRIDMAP_13, 1, 3)
+DEFINE_INTERP_KERNEL_GRIDMAP(interp_kernel_GRIDMAP_21, 2, 1)
+DEFINE_INTERP_KERNEL_GRIDMAP(interp_kernel_GRIDMAP_22, 2, 2)
+DEFINE_INTERP_KERNEL_GRIDMAP(interp_kernel_GRIDMAP_23, 2, 3)
+DEFINE_INTERP_KERNEL_GRIDMAP(interp_kernel_GRIDMAP_31, 3, 1)
+DEFINE_INTERP_KERNEL_GRIDMAP(interp_kernel_GRIDMAP_32, 3, 2)
+DEFINE_INTERP_KERNEL_GRIDMAP(interp_kernel_GRIDMAP_33, 3, 3)
+DEFINE_INTERP_KERNEL_GRIDMAP(interp_kernel_GRIDMAP_41, 4, 1)
+DEFINE_INTERP_KERNEL_GRIDMAP(interp_kernel_GRIDMAP_42, 4, 2)
+DEFINE_INTERP_KERNEL_GRIDMAP(interp_kernel_GRIDMAP_43, 4, 3)
+
+double interp_kernel_GRIDMAP(GRIDMAP_DEF *gridmap, double *GRIDFRAC, 
+			     double *interpFun) {
+
+  // Created Oct 2026
+  // Call specialized kernel selected by gridmap->IKERNEL 
+  // (set in init_fast_GRIDMAP).
+
+  int  IKERNEL = gridmap->IKERNEL ;
+  char fnam[] = "interp_kernel_GRIDMAP" ;
+
+  // ---------- BEGIN ----------
+
+  switch ( IKERNEL ) {
+  case 11: return interp_kernel_GRIDMAP_11(gridmap, GRIDFRAC, interpFun);
+  case 12: return interp_kernel_GRIDMAP_12(gridmap, GRIDFRAC, interpFun);
+  case 13: return interp_kernel_GRIDMAP_13(gridmap, GRIDFRAC, interpFun);
+  case 21: return interp_kernel_GRIDMAP_21(gridmap, GRIDFRAC, interpFun);
+  case 22: return interp_kernel_GRIDMAP_22(gridmap, GRIDFRAC, interpFun);
+  case 23: return interp_kernel_GRIDMAP_23(gridmap, GRIDFRAC, interpFun);
+  case 31: return interp_kernel_GRIDMAP_31(gridmap, GRIDFRAC, interpFun);
+  case 32: return interp_kernel_GRIDMAP_32(gridmap, GRIDFRAC, interpFun);
+  case 33: return interp_kernel_GRIDMAP_33(gridmap, GRIDFRAC, interpFun);
+  case 41: return interp_kernel_GRIDMAP_41(gridmap, GRIDFRAC, interpFun);
+  case 42: return interp_kernel_GRIDMAP_42(gridmap, GRIDFRAC, interpFun);
+  case 43: return interp_kernel_GRIDMAP_43(gridmap, GRIDFRAC, interpFun);
+  default:
+    sprintf(c1err,"Invalid IKERNEL=%d for gridmap ID=%d", 
+	    IKERNEL, gridmap->ID);
+    sprintf(c2err,"NDIM=%d  NFUN=%d", gridmap->NDIM, gridmap->NFUN);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  return 0.0 ;
+
+} // end interp_kernel_GRIDMAP
+
+// ================================================
+int interp_GRIDMAP_vec(GRIDMAP_DEF *gridmap, int NPT, double *data, 
+		       double *interpFun, int *istat_list) {
+
+  // Created Oct 2026
+  // Vector version of interp_GRIDMAP for NPT arbitrary points:
+  //   data[ipt*NDIM + ivar]       = input point ipt
+  //   interpFun[ipt*NFUN + ifun]  = output function values
+  //   istat_list[ipt]             = SUCCESS or ERROR (NULL -> ignore)
+  // Sorting (or otherwise grouping) nearby points before calling
+  // makes best use of the last-cell cache in interp_fast_GRIDMAP.
+  // For points that differ only in one variable, interp_GRIDMAP_batch
+  // is faster.
+  //
+  // Function returns SUCCESS if all points are valid; returns ERROR
+  // if any point is outside grid with OPT_EXTRAP=0 (interpFun=0 there).
+
+  int NDIM = gridmap->NDIM ;
+  int NFUN = gridmap->NFUN ;
+  int ipt, ifun, istat, istat_return = SUCCESS ;
+
+  // ---------- BEGIN ----------
+
+  for ( ipt=0; ipt < NPT; ipt++ ) {
+    istat = interp_GRIDMAP(gridmap, &data[ipt*NDIM], &interpFun[ipt*NFUN]);
+    if ( istat != SUCCESS ) {
+      for(ifun=0; ifun < NFUN; ifun++ ) { interpFun[ipt*NFUN+ifun] = 0.0; }
+      istat_return = ERROR ;
+    }
+    if ( istat_list != NULL ) { istat_list[ipt] = istat; }
+  }
+
+  return(istat_return);
+
+} // end interp_GRIDMAP_vec
+
+// ================================================
+void init_dense_GRIDMAP(GRIDMAP_DEF *gridmap) {
+
+  // Created Oct 2026
+  // Store function values in dense array ordered by 1D grid index
+  // (first dimension varies fastest), so that interp_GRIDMAP_batch
+  // can skip INVMAP lookup and read neighbor bins in first dimension 
+  // from contiguous memory:
+  //   FUNVAL_DENSE[ifun*NGRID + 1DINDEX]
+  // where NGRID = product of NBIN.
+
+  int  NDIM = gridmap->NDIM ;
+  int  NFUN = gridmap->NFUN ;
+  int  NROW = gridmap->NROW ;
+  long long NGRID = 1, MEMD ;
+  int  idim, ifun, igrid, irow ;
+  char fnam[] = "init_dense_GRIDMAP" ;
+
+  // ---------- BEGIN ----------
+
+  if ( gridmap->FUNVAL_DENSE != NULL ) { return; }
+
+  for(idim=0; idim < NDIM; idim++ ) { NGRID *= gridmap->NBIN[idim]; }
+
+  if ( NGRID != NROW ) {
+    sprintf(c1err,"NGRID=%lld != NROW=%d for gridmap ID=%d", 
+	    NGRID, NROW, gridmap->ID );
+    sprintf(c2err,"Dense storage requires full rectangular grid.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  MEMD = sizeof(double) * NGRID * NFUN ;
+  gridmap->FUNVAL_DENSE = (double*) malloc(MEMD);
+  for(ifun=0; ifun < NFUN; ifun++ ) {
+    for(igrid=0; igrid < NGRID; igrid++ ) {
+      irow = gridmap->INVMAP[igrid];
+      gridmap->FUNVAL_DENSE[ifun*NGRID + igrid] = gridmap->FUNVAL[ifun][irow];
+    }
+  }
+
+  gridmap->MEMORY += 1.0E-6 * (float)MEMD ;
+  return ;
+
+} // end init_dense_GRIDMAP
+
+// ================================================
+int get_cell_GRIDMAP(GRIDMAP_DEF *gridmap, int ivar, double VAL,
+		     int *igrid, double *gridfrac) {
+
+  // Created Oct 2026
+  // For variable ivar, return lower grid index *igrid and relative
+  // cell location *gridfrac (0-1); same logic as in interp_GRIDMAP.
+  // Function returns ERROR if VAL is outside grid and OPT_EXTRAP=0.
+
+  double EPSILON  = 1.0E-8 ;
+  double TMPMIN   = gridmap->VALMIN[ivar] ;
+  double TMPMAX   = gridmap->VALMAX[ivar] ;
+  double TMPBIN   = gridmap->VALBIN[ivar] ;
+  double TMPRANGE = TMPMAX - TMPMIN ;
+  double TMPVAL   = VAL, TMPDIF, XNBIN ;
+  int    OPT_EXTRAP = gridmap->OPT_EXTRAP ;
+  int    g ;
+  bool   too_lo, too_hi ;
+
+  // ---------- BEGIN ----------
+
+  TMPMAX += (1.0E-14*TMPRANGE);
+  TMPMIN -= (1.0E-14*TMPRANGE);
+  too_lo  = ( TMPVAL < TMPMIN );
+  too_hi  = ( TMPVAL > TMPMAX );
+
+  if ( too_lo || too_hi ) {
+    if ( OPT_EXTRAP > 0 ) {
+      if ( too_lo ) { TMPVAL = TMPMIN + (TMPRANGE*1.0E-12); }
+      if ( too_hi ) { TMPVAL = TMPMAX - (TMPRANGE*1.0E-12); }
+    }
+    else if ( OPT_EXTRAP == 0 ) 
+      { return(ERROR); }
+  }
+
+  TMPDIF = TMPVAL - TMPMIN ;
+  if ( TMPBIN == 0.0 )
+    { XNBIN = 0.0 ; g = 0; }
+  else if ( (TMPMAX - TMPVAL)/TMPRANGE < EPSILON  )  { 
+    XNBIN = (TMPDIF - TMPRANGE*EPSILON)/TMPBIN ;
+    g     = (int)(XNBIN) ; 
+  }
+  else {
+    XNBIN = (TMPDIF + TMPRANGE*EPSILON ) / TMPBIN ;
+    g     = (int)(XNBIN); 
+  }
+
+  *igrid = g;
+  if ( TMPBIN > 0.0 ) 
+    { *gridfrac = TMPDIF/TMPBIN - (double)g ; }
+  else
+    { *gridfrac = 1.0 ; }
+
+  return(SUCCESS);
+
+} // end get_cell_GRIDMAP
+
+// ================================================
+ATTR_TARGET_CLONES
+int interp_GRIDMAP_batch(GRIDMAP_DEF *gridmap, int IVAR_BATCH, int NBATCH,
+			 double *data, double *VAL_BATCH, double *interpFun) {
+
+  // Created Oct 2026
+  // Batch version of interp_GRIDMAP for NBATCH points that differ only
+  // in variable IVAR_BATCH. Cell indices and weights for the other
+  // (fixed) variables in data[] are computed once; data[IVAR_BATCH] 
+  // is ignored and VAL_BATCH[ibatch] is used instead.
+  // Uses FUNVAL_DENSE (see init_dense_GRIDMAP); for IVAR_BATCH=0 the 
+  // two neighbor bins are adjacent in memory.
+  //
+  // Output: interpFun[ifun*NBATCH + ibatch]
+  //
+  // Function returns SUCCESS if all points are valid; returns ERROR
+  // if any point is outside grid with OPT_EXTRAP=0 (interpFun=0 there).
+
+#define MXCORNER_BATCH_GRIDMAP 512
+  int    NVAR   = gridmap->NDIM ;
+  int    NFUN   = gridmap->NFUN ;
+  long long NGRID = gridmap->NROW ;
+  int    NBIN_BATCH = gridmap->NBIN[IVAR_BATCH];
+  long long BASE_CORNER[MXCORNER_BATCH_GRIDMAP];
+  double WGT_CORNER[MXCORNER_BATCH_GRIDMAP];
+  long long STRIDE[MXDIM_GRIDMAP], STRIDE_BATCH, OFF0, OFF1 ;
+  int    IGRID_VAR[MXDIM_GRIDMAP];
+  double GRIDFRAC[MXDIM_GRIDMAP];
+  int    ivar, jvar, NFIX, NCORNER, icorner, ibatch, ifun, g, g1, MSK ;
+  int    istat, istat_return = SUCCESS ;
+  double WGT_SUM = 0.0, WGT, f, SUM, *FUN ;
+  char fnam[] = "interp_GRIDMAP_batch" ;
+
+  // ---------- BEGIN ----------
+
+  if ( gridmap->FUNVAL_DENSE == NULL ) { init_dense_GRIDMAP(gridmap); }
+
+  NFIX    = NVAR - 1 ;
+  NCORNER = 1 << NFIX ;
+  if ( NCORNER > MXCORNER_BATCH_GRIDMAP ) {
+    sprintf(c1err,"NCORNER=%d exceeds bound for NDIM=%d (ID=%d)", 
+	    NCORNER, NVAR, gridmap->ID );
+    sprintf(c2err,"Check MXCORNER_BATCH_GRIDMAP");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  // 1D-index stride for each variable (first variable is fastest)
+  STRIDE[0] = 1;
+  for(ivar=1; ivar < NVAR; ivar++ ) 
+    { STRIDE[ivar] = STRIDE[ivar-1] * gridmap->NBIN[ivar-1]; }
+  STRIDE_BATCH = STRIDE[IVAR_BATCH];
+
+  // cell for each fixed variable
+  for(ivar=0; ivar < NVAR; ivar++ ) {
+    if ( ivar == IVAR_BATCH ) { continue; }
+    istat = get_cell_GRIDMAP(gridmap, ivar, data[ivar], 
+			     &IGRID_VAR[ivar], &GRIDFRAC[ivar] );
+    if ( istat != SUCCESS ) {
+      for(ibatch=0; ibatch < NBATCH*NFUN; ibatch++ ) { interpFun[ibatch]=0.0; }
+      return(ERROR); 
+    }
+  }
+
+  // 1D-index offset and weight for each corner of fixed variables
+  for(icorner=0; icorner < NCORNER; icorner++ ) {
+    BASE_CORNER[icorner] = 0;
+    WGT = 1.0 ;
+    jvar = 0;
+    for(ivar=0; ivar < NVAR; ivar++ ) {
+      if ( ivar == IVAR_BATCH ) { continue; }
+      MSK = 1 << jvar;  jvar++ ;
+      g   = IGRID_VAR[ivar];
+      if ( icorner & MSK ) {
+	if ( g+1 < gridmap->NBIN[ivar] ) { g++ ; }
+	WGT *= GRIDFRAC[ivar];
+      }
+      else
+	{ WGT *= (1.0 - GRIDFRAC[ivar]) ; }
+      BASE_CORNER[icorner] += STRIDE[ivar] * g ;
+    }
+    WGT_CORNER[icorner] = WGT ;
+    WGT_SUM += WGT;
+  }
+
+  if ( WGT_SUM <= 0.0 ) {
+    sprintf(c1err,"Could not compute corner weights for gridmap ID=%d", 
+	    gridmap->ID );
+    sprintf(c2err,"NVAR=%d  IVAR_BATCH=%d", NVAR, IVAR_BATCH);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+  for(icorner=0; icorner < NCORNER; icorner++ ) 
+    { WGT_CORNER[icorner] /= WGT_SUM; }
+
+  // loop over batch points
+  for(ibatch=0; ibatch < NBATCH; ibatch++ ) {
+
+    istat = get_cell_GRIDMAP(gridmap, IVAR_BATCH, VAL_BATCH[ibatch], &g, &f);
+    if ( istat != SUCCESS ) {
+      for(ifun=0; ifun < NFUN; ifun++ ) 
+	{ interpFun[ifun*NBATCH + ibatch] = 0.0 ; }
+      istat_return = ERROR;
+      continue ;
+    }
+
+    g1   = ( g+1 < NBIN_BATCH ) ? g+1 : g ;
+    OFF0 = STRIDE_BATCH * g ;
+    OFF1 = STRIDE_BATCH * g1 ;
+
+    for(ifun=0; ifun < NFUN; ifun++ ) {
+      FUN = &gridmap->FUNVAL_DENSE[ifun*NGRID];
+      SUM = 0.0 ;
+      for(icorner=0; icorner < NCORNER; icorner++ ) {
+	SUM += WGT_CORNER[icorner] * 
+	  ( (1.0-f)*FUN[BASE_CORNER[icorner]+OFF0] + 
+	    f      *FUN[BASE_CORNER[icorner]+OFF1] ) ;
+      }
+      interpFun[ifun*NBATCH + ibatch] = SUM ;
+    }
+
+  } // end ibatch
+
+  return(istat_return) ;
+
+} // end interp_GRIDMAP_batch
+
+
 // ================================================
 int  get_1DINDEX(int ID, int NDIM, int *indx ) {
 
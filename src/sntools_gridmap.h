@@ -1,9 +1,13 @@
 // Created July 2021 [moved from sntools.h]
 // Apr 2024: change typedef GRIDMAP to GRIDMAP_DEF (follow SNANA convention)
+// Oct 2026: add FUNVAL_DENSE and interp_GRIDMAP_batch
+// Oct 2026: add fast interp with last-cell cache, and interp_GRIDMAP_vec
+// Oct 2026: add specialized interp kernels for NDIM=1-4 and NFUN=1-3
 
 
 // define prototype for multi-dimensionl grid; used for interpolation
 #define MXDIM_GRIDMAP 20
+#define MXDIM_FAST_GRIDMAP 12  // max NDIM for fast interp (2^NDIM corners)
 typedef struct GRIDMAP_DEF {
   int     ID;        //    
   int     NDIM;     // Number of dimensions      
@@ -23,6 +27,15 @@ typedef struct GRIDMAP_DEF {
   char VARLIST[80];   // comma-sep list of variables (optional to fill)   
   char *VARNAMES[MXDIM_GRIDMAP];    // array of variable names (internally computed)
 
+  double *FUNVAL_DENSE; // optional FUNVAL[ifun*NGRID + 1DINDEX] for batch interp
+
+  // Oct 2026: fast-interp info (see init_fast_GRIDMAP)
+  bool  FAST_INIT ;                    // true -> STRIDE & CACHE are set
+  int   STRIDE[MXDIM_GRIDMAP] ;        // 1D-index stride per dimension
+  int   CACHE_IGRID[MXDIM_GRIDMAP] ;   // lower cell index from last call
+  int  *CACHE_IROW ;                   // [icorner] FUNVAL row for last cell
+  int   IKERNEL ;  // 10*NDIM+NFUN for specialized kernel; 0 -> generic
+
   float MEMORY; // alloated memory, MB
 
 } GRIDMAP_DEF ;
@@ -68,6 +81,19 @@ void init_interp_GRIDMAP(int ID, char *MAPNAME, int MAPSIZE, int NDIM, int NFUN,
                          GRIDMAP_DEF *gridmap ); 
                                                                            
 int  interp_GRIDMAP(GRIDMAP_DEF *gridmap, double *data, double *interpFun );
+
+void init_fast_GRIDMAP(GRIDMAP_DEF *gridmap);
+int  interp_fast_GRIDMAP(GRIDMAP_DEF *gridmap, double *data, double *interpFun);
+double interp_kernel_GRIDMAP(GRIDMAP_DEF *gridmap, double *GRIDFRAC, 
+			     double *interpFun);
+int  interp_GRIDMAP_vec(GRIDMAP_DEF *gridmap, int NPT, double *data, 
+			double *interpFun, int *istat_list);
+
+void init_dense_GRIDMAP(GRIDMAP_DEF *gridmap);
+int  get_cell_GRIDMAP(GRIDMAP_DEF *gridmap, int ivar, double VAL,
+		      int *igrid, double *gridfrac);
+int  interp_GRIDMAP_batch(GRIDMAP_DEF *gridmap, int IVAR_BATCH, int NBATCH,
+			  double *data, double *VAL_BATCH, double *interpFun);
                                                                 
 void read_GRIDMAP(FILE *fp, char *MAPNAME, char *KEY_ROW, char *KEY_STOP,
                   int IDMAP, int NDIM, int NFUN, int OPT_EXTRAP, int MXROW,
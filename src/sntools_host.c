@@ -93,6 +93,18 @@
  Apr 13 2023: implement GROUPID match between SIMLIB and HOSTLIB
               (enable Large-scale structure)
 
+ Oct 14 2026: optional binary HOSTLIB image (HOSTLIB_BINARY_FILE) 
+              is mmap'ed to skip reading & sorting text HOSTLIB.
+ Oct 14 2026: HOSTLIB_MSKOPT += 65536 -> weight-tree host selection
+ Oct 15 2026: genSpec_HOSTLIB sums spec basis as matrix-vector product
+ Oct 15 2026: O(1) lookup of R/Re vs. Sersic integral for SN position
+ Oct 15 2026: HOSTLIB_NTHREAD > 1 -> parse GAL rows in parallel chunks
+ Oct 15 2026: HOSTLIB_MSKOPT += 131072 -> float storage for non-critical
+              columns; use get_VALUE_ZSORTED_HOSTLIB to read them.
+ Oct 15 2026: cache per-galaxy WGTMAP weights & SN mag shifts in
+              [HOSTLIB_BINARY_FILE].WGTMAP; re-interpolate only SNVAR
+              bins whose WGTMAP rows changed.
+
 =========================================================== */
 
 #include <stdio.h>
@@ -102,6 +114,11 @@
 #include <string.h>
 #include <time.h>
 #include <math.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <pthread.h>
+#undef MAP_FILE  // mman.h flag conflicts with INPUTS.GENPDF.MAP_FILE
 
 #include "sntools.h"
 #include "sntools_cosmology.h"
@@ -167,19 +184,27 @@ void INIT_HOSTLIB(void) {
   // check for match among spec templates and hostlib varnames (Jun 2019)
   match_specTable_HOSTVAR();
 
-  // re-open hostlib for GAL keys so that it works for gzipped files.
-  // (cannot rewind gzip file, so close and re-open is only way)
-  open_HOSTLIB(&fp_hostlib);     // re-open
+  // summarize SNPARams that were/weren't found
+  summary_snpar_HOSTLIB();
 
-  read_gal_HOSTLIB(fp_hostlib);  // read "GAL:" keys
+  // Oct 2026: check for pre-processed (cut + z-sorted) binary image;
+  // if found, mmap image and skip reading GAL rows and sorting.
+  if ( !read_binary_HOSTLIB() ) {
 
-  close_HOSTLIB(fp_hostlib);     // close HOSTLIB
+    // re-open hostlib for GAL keys so that it works for gzipped files.
+    // (cannot rewind gzip file, so close and re-open is only way)
+    open_HOSTLIB(&fp_hostlib);     // re-open
 
-  // summarize SNPARams that were/weren't found
-  summary_snpar_HOSTLIB();
+    read_gal_HOSTLIB(fp_hostlib);  // read "GAL:" keys (or use threads)
+
+    close_HOSTLIB(fp_hostlib);     // close HOSTLIB
+
+    // sort HOSTLIB entries by redshift
+    sortz_HOSTLIB();
 
-  // sort HOSTLIB entries by redshift
-  sortz_HOSTLIB();
+    // write binary image for next job(s) to mmap
+    write_binary_HOSTLIB();
+  }
 
   // abort if any GALID+ZTRUE pair appears more than once
 
@@ -205,6 +230,9 @@ void INIT_HOSTLIB(void) {
   // init options for re-using same host
   init_SAMEHOST();
 
+  // optional weight tree for fast host selection (Oct 2026)
+  init_HOSTLIB_WGTTREE();
+
   // init parameters and Gauss2d integrals for galaxy aperture mag
   init_GALMAG_HOSTLIB();
 
@@ -278,6 +306,12 @@ void print_HOSTLIB_MSKOPT(void) {
   print_mask_comment(stdout, MSKOPT, HOSTLIB_MSKOPT_ZPHOT_QGAUSS,
 		     "write Gauss quantiles for zPHOT (for debug)" );
 
+  print_mask_comment(stdout, MSKOPT, HOSTLIB_MSKOPT_WGTTREE,
+		     "weight-tree host selection (fast for USEONCE)" );
+
+  print_mask_comment(stdout, MSKOPT, HOSTLIB_MSKOPT_FLOAT32,
+		     "float storage except GALID, ZTRUE, RA, DEC" );
+
   //   print_mask_comment(stdout, MSKOPT, 0,		     "" );
 
 
@@ -2136,6 +2170,8 @@ void genSpec_HOSTLIB(double zhel, double MWEBV, int DUMPFLAG,
   // May 6 2021: check ABMAG_FORCE
   // Dec 17 2021: exclude last LAM bin from LAMBIN_CHECK test;
   //             -> avoids mysterious abort.
+  // Oct 15 2026: fetch basis coefficients once and sum templates
+  //              as a matrix-vector product over basis rows.
   //
 
   int  NBLAM_SPECTRO    = INPUTS_SPECTRO.NBIN_LAM;
@@ -2194,7 +2230,7 @@ void genSpec_HOSTLIB(double zhel, double MWEBV, int DUMPFLAG,
     // pick out the one spectrum in IDSPECDATA column of HOSTLIB
     ISPEC_MIN = 0;  ISPEC_MAX = 1;
     ivar_HOSTLIB = HOSTSPEC.IVAR_HOSTLIB[0];
-    COEFF        = HOSTLIB.VALUE_ZSORTED[ivar_HOSTLIB][IGAL] ; 
+    COEFF        = get_VALUE_ZSORTED_HOSTLIB(ivar_HOSTLIB,IGAL) ; 
     IDSPEC       = (int)COEFF ;
     HOSTSPEC.IDSPECDATA = IDSPEC ;
     if  ( IDSPEC < 0 || IDSPEC > HOSTSPEC.NSPECDATA ) {
@@ -2205,26 +2241,42 @@ void genSpec_HOSTLIB(double zhel, double MWEBV, int DUMPFLAG,
     }
   }
 
-  // construct total rest-frame spectrum using specbasis/specdata binning
-  for(ilam_basis=0; ilam_basis < NBLAM_BASIS; ilam_basis++ ) {
-    FLAM_SUM     = 0.0 ;
-    LAM_BASIS    = HOSTSPEC.WAVE_CEN[ilam_basis]; // basis or data
-    for(i=ISPEC_MIN; i < ISPEC_MAX; i++ ) {
+  // construct total rest-frame spectrum using specbasis/specdata binning.
+  // For specbasis, FLAM_EVT = sum_i COEFF[i] * FLAM_BASIS[i][*] is
+  // accumulated one basis row at a time (contiguous memory), and 
+  // COEFF[i] is fetched from HOSTLIB once instead of per wave bin.
+  double *FLAM_EVT = HOSTSPEC.FLAM_EVT ;
+  double *FLAM_ROW ;
+  if ( IS_SPECBASIS ) {
+    for(ilam_basis=0; ilam_basis < NBLAM_BASIS; ilam_basis++ ) 
+      { FLAM_EVT[ilam_basis] = 0.0 ; }
 
-      if ( IS_SPECBASIS ) { 
-	ivar_HOSTLIB = HOSTSPEC.IVAR_HOSTLIB[i];
-	COEFF        = HOSTLIB.VALUE_ZSORTED[ivar_HOSTLIB][IGAL] ; 
-	FLAM_TMP     = HOSTSPEC.FLAM_BASIS[i][ilam_basis] ;
-	FLAM_SUM    += ( COEFF * FLAM_TMP );
-      }
-      else {
-	FLAM_SUM   = HOSTSPEC.FLAM_BASIS[IDSPEC][ilam_basis] ; 
-      }
-      if ( DUMPFLAG && ilam_basis == 0 && COEFF > 0.0 ) {
+    for(i=ISPEC_MIN; i < ISPEC_MAX; i++ ) {
+      ivar_HOSTLIB = HOSTSPEC.IVAR_HOSTLIB[i];
+      COEFF        = get_VALUE_ZSORTED_HOSTLIB(ivar_HOSTLIB,IGAL) ; 
+      if ( DUMPFLAG && COEFF > 0.0 ) {
 	printf(" xxx COEFF(%2d) = %le  (ivar_HOSTLIB=%d)\n", 
 	       i, COEFF, ivar_HOSTLIB );
       }
+      if ( COEFF == 0.0 ) { continue; }
+      FLAM_ROW = HOSTSPEC.FLAM_BASIS[i] ;
+      for(ilam_basis=0; ilam_basis < NBLAM_BASIS; ilam_basis++ ) 
+	{ FLAM_EVT[ilam_basis] += ( COEFF * FLAM_ROW[ilam_basis] ); }
+    }
+  }
+  else {
+    if ( DUMPFLAG && COEFF > 0.0 ) {
+      printf(" xxx COEFF(%2d) = %le  (ivar_HOSTLIB=%d)\n", 
+	     0, COEFF, ivar_HOSTLIB );
     }
+    FLAM_ROW = HOSTSPEC.FLAM_BASIS[IDSPEC] ;
+    for(ilam_basis=0; ilam_basis < NBLAM_BASIS; ilam_basis++ ) 
+      { FLAM_EVT[ilam_basis] = FLAM_ROW[ilam_basis] ; }
+  }
+
+  for(ilam_basis=0; ilam_basis < NBLAM_BASIS; ilam_basis++ ) {
+    LAM_BASIS    = HOSTSPEC.WAVE_CEN[ilam_basis]; // basis or data
+    FLAM_SUM     = FLAM_EVT[ilam_basis];
 
     // global scale for physical units
     HOSTSPEC.FLAM_EVT[ilam_basis] = (FLAM_SUM * HOSTSPEC.FLAM_SCALE * znorm);
@@ -3028,6 +3080,9 @@ void read_gal_HOSTLIB(FILE *fp) {
   // Jan 22 2021: print WARNING if HOSTLIB.NSTAR > 0
   // Apr 30 2021: abort on NaN.
   // Mar 10 2025: increment and print NCUT_FAIL (extra diagnostic)
+  // Oct 14 2026: move cut-window definitions to init_cuts_HOSTLIB()
+  // Oct 15 2026: if HOSTLIB_NTHREAD > 1 and HOSTLIB is not gzipped,
+  //              parse GAL rows with read_gal_HOSTLIB_THREADS.
 
   bool DO_SWAPZPHOT = (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_SWAPZPHOT)>0 ;
   bool DO_PLUSNBR   = (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_PLUSNBR)>0;
@@ -3042,7 +3097,7 @@ void read_gal_HOSTLIB(FILE *fp) {
   int  ivar_ALL, ivar_STORE, NVAR_STORE, NGAL, NGAL_READ, MEMC ;
   int  NPRIORITY, NCUT_FAIL = 0 ;
   bool ISCHAR ;
-  double xval[MXVAR_HOSTLIB], val, ZTMP, LOGZCUT[2], DLOGZ_SAFETY ;
+  double xval[MXVAR_HOSTLIB], val ;
 
   char fnam[] = "read_gal_HOSTLIB"  ;
 
@@ -3055,24 +3110,26 @@ void read_gal_HOSTLIB(FILE *fp) {
   NPRIORITY = 0 ;
 
   // define cut windows
-  HOSTLIB_CUTS.RAWIN[0] = INPUTS.HOSTLIB_GENRANGE_RA[0] - .0001 ;
-  HOSTLIB_CUTS.RAWIN[1] = INPUTS.HOSTLIB_GENRANGE_RA[1] + .0001 ;
+  init_cuts_HOSTLIB();
 
-  HOSTLIB_CUTS.DECWIN[0] = INPUTS.HOSTLIB_GENRANGE_DEC[0] - .0001 ;
-  HOSTLIB_CUTS.DECWIN[1] = INPUTS.HOSTLIB_GENRANGE_DEC[1] + .0001 ;
-
-  // define redshift cut as user GENRANGE_REDSHIFT with
-  // an extra safety margin (in logz space) of 3 bins.
-  DLOGZ_SAFETY = 3.0 * DZPTR_HOSTLIB ;
-  ZTMP       = INPUTS.GENRANGE_REDSHIFT[0] ;
-  LOGZCUT[0] = log10(ZTMP-0.01) - DLOGZ_SAFETY ;
-  ZTMP       = INPUTS.GENRANGE_REDSHIFT[1] ;
-  LOGZCUT[1] = log10(ZTMP+0.01) + DLOGZ_SAFETY ;
-  HOSTLIB_CUTS.ZWIN[0] = pow(10.0, LOGZCUT[0] );
-  HOSTLIB_CUTS.ZWIN[1] = pow(10.0, LOGZCUT[1] );
+  // flag mag columns for ABMAG_FORCE/OFFSET (used in parse_galRow_HOSTLIB)
+  int len_suffix_magobs = strlen(HOSTLIB_SUFFIX_MAGOBS);
+  char *varName ;
+  for(ivar_ALL=0; ivar_ALL < HOSTLIB.NVAR_ALL; ivar_ALL++ ) {
+    varName = HOSTLIB.VARNAME_ALL[ivar_ALL] ;
+    ISMAGOBS_HOSTLIB[ivar_ALL] = 
+      ( strstr(varName,HOSTLIB_SUFFIX_MAGOBS) != NULL &&
+	strlen(varName) == len_suffix_magobs+1 ) ;
+  }
 
   NGAL = -9;
 
+  if ( INPUTS.HOSTLIB_NTHREAD > 1 && HOSTLIB.GZIPFLAG == 0 ) {
+    NPRIORITY = read_gal_HOSTLIB_THREADS(INPUTS.HOSTLIB_NTHREAD);
+    NCUT_FAIL = HOSTLIB.NGAL_READ - HOSTLIB.NGAL_STORE ;
+    goto DONE_RDGAL ;
+  }
+
   while( (fscanf(fp, "%s", c_get)) != EOF) {
 
     if ( strcmp(c_get,"GAL:") == 0 ) {
@@ -3092,7 +3149,8 @@ void read_gal_HOSTLIB(FILE *fp) {
       if ( HOSTLIB.NGAL_READ > INPUTS.HOSTLIB_MAXREAD ) 
 	{ goto DONE_RDGAL ; } 
 
-      if ( passCuts_HOSTLIB(xval) == 0 ) { NCUT_FAIL++; continue; }
+      if ( passCuts_HOSTLIB(xval,&HOSTLIB.NSTAR) == 0 ) 
+	{ NCUT_FAIL++; continue; }
 
       // count how many priority entries (for print summary below)
       if ( GALID_MIN < GALID_MAX ) {
@@ -3210,6 +3268,40 @@ void read_gal_HOSTLIB(FILE *fp) {
 
 } // end of read_gal_HOSTLIB
 
+// ================================
+void init_cuts_HOSTLIB(void) {
+
+  // Created Oct 14 2026
+  // [code moved from read_gal_HOSTLIB]
+  // Define RA, DEC and redshift cut-windows used by passCuts_HOSTLIB.
+  // Windows are also part of the binary-HOSTLIB signature, so they
+  // must be defined before checking for a binary image.
+
+  double ZTMP, LOGZCUT[2], DLOGZ_SAFETY ;
+  // char fnam[] = "init_cuts_HOSTLIB" ;
+
+  // ------------ BEGIN -----------
+
+  HOSTLIB_CUTS.RAWIN[0] = INPUTS.HOSTLIB_GENRANGE_RA[0] - .0001 ;
+  HOSTLIB_CUTS.RAWIN[1] = INPUTS.HOSTLIB_GENRANGE_RA[1] + .0001 ;
+
+  HOSTLIB_CUTS.DECWIN[0] = INPUTS.HOSTLIB_GENRANGE_DEC[0] - .0001 ;
+  HOSTLIB_CUTS.DECWIN[1] = INPUTS.HOSTLIB_GENRANGE_DEC[1] + .0001 ;
+
+  // define redshift cut as user GENRANGE_REDSHIFT with
+  // an extra safety margin (in logz space) of 3 bins.
+  DLOGZ_SAFETY = 3.0 * DZPTR_HOSTLIB ;
+  ZTMP       = INPUTS.GENRANGE_REDSHIFT[0] ;
+  LOGZCUT[0] = log10(ZTMP-0.01) - DLOGZ_SAFETY ;
+  ZTMP       = INPUTS.GENRANGE_REDSHIFT[1] ;
+  LOGZCUT[1] = log10(ZTMP+0.01) + DLOGZ_SAFETY ;
+  HOSTLIB_CUTS.ZWIN[0] = pow(10.0, LOGZCUT[0] );
+  HOSTLIB_CUTS.ZWIN[1] = pow(10.0, LOGZCUT[1] );
+
+  return ;
+
+} // end init_cuts_HOSTLIB
+
 // ================================
 void check_redshift_HOSTLIB(void) {
 
@@ -3262,9 +3354,10 @@ void check_redshift_HOSTLIB(void) {
 }  // end check_redshift_HOSTLIB
 
 // ====================================
-int passCuts_HOSTLIB(double *xval ) {
+int passCuts_HOSTLIB(double *xval, int *NSTAR ) {
 
   // Return 1 if cuts are satisfied; zero otherwise.
+  // Oct 15 2026: pass NSTAR counter so that threads can use own counter.
   int ivar_ALL, i, LRA ,LRA2;
   double ZTRUE, RA, RA2, DEC;
   char fnam[] = "passCuts_HOSTLIB" ;
@@ -3277,7 +3370,7 @@ int passCuts_HOSTLIB(double *xval ) {
   // REDSHIFT
   ivar_ALL    = HOSTLIB.IVAR_ALL[HOSTLIB.IVAR_ZTRUE] ; 
   ZTRUE       = xval[ivar_ALL];
-  if ( ZTRUE < ZMAX_STAR ) { HOSTLIB.NSTAR++; }      // diagnostic
+  if ( ZTRUE < ZMAX_STAR ) { (*NSTAR)++; }      // diagnostic
   if ( ZTRUE < HOSTLIB_CUTS.ZWIN[0] ) { return(0); }
   if ( ZTRUE > HOSTLIB_CUTS.ZWIN[1] ) { return(0); }
 
@@ -3333,18 +3426,11 @@ void read_galRow_HOSTLIB(FILE *fp, int NVAL, double *VALUES,
   //              Replace WDLIST with global TMPWORD_HOSTLIB.
   //
   // Sep 16 2024: check HOSTLIB_ABMAG_OFFSET;
+  // Oct 15 2026: move parsing to thread-safe parse_galRow_HOSTLIB
   
   int MXCHAR          = MXCHAR_LINE_HOSTLIB;
-  double ABMAG_FORCE  = INPUTS.HOSTLIB_ABMAG_FORCE;
-  double ABMAG_OFFSET = INPUTS.HOSTLIB_ABMAG_OFFSET;
-
-  int len_suffix_magobs = strlen(HOSTLIB_SUFFIX_MAGOBS);
-  int len_varName;
-  
-  int MXWD = NVAL;
-  int ival_FIELD, ival_NBR_LIST, ival, NWD=0, len, NCHAR ;
-  char sepKey[] = " " ;
-  char tmpWORD[200], tmpLine[MXCHAR_LINE_HOSTLIB], *pos, *varName ;
+  int NCHAR ;
+  char tmpLine[MXCHAR_LINE_HOSTLIB] ;
   char fnam[] = "read_galRow_HOSTLIB" ;
   
   // ---------------- BEGIN -----------------
@@ -3361,63 +3447,91 @@ void read_galRow_HOSTLIB(FILE *fp, int NVAL, double *VALUES,
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
 
-  // remove line feed
-  if ( (pos=strchr(tmpLine,'\n') ) != NULL )  { *pos = '\0' ; }
+  parse_galRow_HOSTLIB(tmpLine, NVAL, VALUES, FIELD, NBR_LIST, 
+		       &HOSTLIB.NERR_NAN);
+
+  return ;
+
+}  // read_galRow_HOSTLIB
+
+// ==========================================
+void parse_galRow_HOSTLIB(char *LINE, int NVAL, double *VALUES, 
+			  char *FIELD, char *NBR_LIST, int *NERR_NAN ) {
 
-  // split string into words
-  splitString2(tmpLine, sepKey, MXWD, &NWD, TMPWORD_HOSTLIB);
+  // Created Oct 2026
+  // [code moved from read_galRow_HOSTLIB]
+  // Parse *LINE (contents after GAL: key) into NVAL VALUES, 
+  // and optional FIELD and NBR_LIST strings. 
+  // LINE is split in place (destroyed). No global scratch arrays
+  // are used, so this function can be called from multiple threads;
+  // NaN values are counted in *NERR_NAN.
+
+  double ABMAG_FORCE  = INPUTS.HOSTLIB_ABMAG_FORCE;
+  double ABMAG_OFFSET = INPUTS.HOSTLIB_ABMAG_OFFSET;
+
+  int  ival_FIELD = -9, ival_NBR_LIST = -9, ival, NWD=0, len ;
+  char *WDLIST[MXVAR_HOSTLIB], *ptr, *endptr ;
+  char fnam[] = "parse_galRow_HOSTLIB" ;
+
+  // ---------------- BEGIN -----------------
+
+  // split line into words (in place), skipping blanks, tabs and <CR>
+  ptr = LINE;
+  while ( *ptr != '\0' && NWD < NVAL ) {
+    while ( *ptr==' ' || *ptr=='\t' || *ptr=='\r' ) { ptr++ ; }
+    if ( *ptr == '\n' || *ptr == '\0' ) { break; }
+    WDLIST[NWD++] = ptr ;
+    while ( *ptr!='\0' && *ptr!=' ' && *ptr!='\t' && 
+	    *ptr!='\r' && *ptr!='\n' ) { ptr++ ; }
+    if ( *ptr != '\0' ) { *ptr = '\0'; ptr++ ; }
+  }
 
   // abort if too few columns, but allow extra columns
   // (e..g, comment or catenated files with extra columns)
   if ( NWD < NVAL ) {
     print_preAbort_banner(fnam);
     printf("\t NGAL_READ = %d \n",  HOSTLIB.NGAL_READ );
-    printf("\t LINE = '%s %s %s  ... ' \n", 
-	   TMPWORD_HOSTLIB[0], TMPWORD_HOSTLIB[1], TMPWORD_HOSTLIB[2] );
+    if ( NWD > 0 ) { printf("\t LINE = '%s  ... ' \n", WDLIST[0] ); }
     sprintf(c1err,"Found %d words after GAL key", NWD);
     sprintf(c2err,"but expected %d words.", NVAL );
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
 
-  sprintf(FIELD,"NULL"); ival_FIELD = -9;
+  sprintf(FIELD,"NULL"); 
   if ( HOSTLIB.IVAR_FIELD > 0 ) 
     { ival_FIELD = HOSTLIB.IVAR_ALL[HOSTLIB.IVAR_FIELD] ;  }
 
-  sprintf(NBR_LIST,"NULL"); ival_NBR_LIST = -9;
+  sprintf(NBR_LIST,"NULL"); 
   if ( HOSTLIB.IVAR_NBR_LIST > 0 ) 
     { ival_NBR_LIST = HOSTLIB.IVAR_ALL[HOSTLIB.IVAR_NBR_LIST] ;  }
 
   for(ival=0; ival < NVAL; ival++ ) {
     VALUES[ival] = -9.0 ; 
-    varName      = HOSTLIB.VARNAME_ALL[ival] ;
-    len_varName  = strlen(varName);
+    ptr          = WDLIST[ival];
       
     if ( ival == ival_FIELD )  { 
-      sprintf(tmpWORD, "%s", TMPWORD_HOSTLIB[ival] );
-      len = strlen(tmpWORD);
+      len = strlen(ptr);
       if ( len > MXCHAR_FIELDNAME ) {
 	sprintf(c1err,"strlen(FIELD=%s) = %d exceeds storage array of %d",
-		tmpWORD, len, MXCHAR_FIELDNAME);
+		ptr, len, MXCHAR_FIELDNAME);
 	sprintf(c2err,"Check HOSTLIB or increase MXCHAR_FIELDNAME");
 	errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
       }
-      sscanf(tmpWORD, "%s", FIELD ); 
+      sprintf(FIELD, "%s", ptr ); 
     }
 
     else if ( ival == ival_NBR_LIST )  { 
-      sprintf(tmpWORD, "%s", TMPWORD_HOSTLIB[ival] );
-      len = strlen(tmpWORD);
+      len = strlen(ptr);
       if ( len > MXCHAR_NBR_LIST ) {
 	sprintf(c1err,"strlen(NBR_LIST=%s) = %d exceeds storage array of %d",
-		tmpWORD, len, MXCHAR_NBR_LIST);
+		ptr, len, MXCHAR_NBR_LIST);
 	sprintf(c2err,"Check HOSTLIB or increase MXCHAR_NBR_LIST");
 	errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
       }
-      sscanf(tmpWORD, "%s", NBR_LIST ); 
+      sprintf(NBR_LIST, "%s", ptr );
 
       if ( strstr(NBR_LIST,".") != NULL ) {
 	long long  GALID = (long long)VALUES[0];
-	//	print_preAbort_banner(fnam);
 	sprintf(c1err,"Invalid NBR_LIST='%s'", NBR_LIST);
 	sprintf(c2err,"No decimals allowed; GALID=%lld", GALID);
 	errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
@@ -3425,37 +3539,279 @@ void read_galRow_HOSTLIB(FILE *fp, int NVAL, double *VALUES,
     }
 
     else {
-      // float or int (non-string) value
-      sscanf(TMPWORD_HOSTLIB[ival], "%le", &VALUES[ival] ); 
+      // float or int (non-string) value; keep -9 if not a number
+      double dval = strtod(ptr, &endptr);
+      if ( endptr != ptr ) { VALUES[ival] = dval; }
 
-      bool MATCH_STRMAG = ( strstr(varName,HOSTLIB_SUFFIX_MAGOBS) != NULL );
-      bool MATCH_STRLEN = ( len_varName == len_suffix_magobs+1 ) ;
-      if ( MATCH_STRMAG && MATCH_STRLEN ) {
+      if ( ISMAGOBS_HOSTLIB[ival] ) {
 	if ( ABMAG_FORCE   > -8.0 ) {  VALUES[ival]  = ABMAG_FORCE  ; }
 	if ( ABMAG_OFFSET !=  0.0 ) {  VALUES[ival] += ABMAG_OFFSET ; } 	
       }
       
       // check for NaN (NaN abort is after reading entire HOSTLIB)
       if ( isnan(VALUES[ival]) )  {
-	HOSTLIB.NERR_NAN++ ;
-	if ( HOSTLIB.NERR_NAN < 20 ) 
-	  { printf("\t ERROR: HOSTLIB %s = NaN \n", varName );	}
+	(*NERR_NAN)++ ;
+	if ( *NERR_NAN < 20 ) 
+	  { printf("\t ERROR: HOSTLIB %s = NaN \n", 
+		   HOSTLIB.VARNAME_ALL[ival] );	}
       }
-
     }
 
   } // end ival loop
 
-  
-  /*
-  printf(" xxx NVAL=%d  N1=%d  N2=%d  FIELD=%s  ZTRUE=%.5f\n",
-	 NVAL, N1, N2, FIELD, VALUES[2]);
-  debugexit("read row"); // xxx
-  */
-
   return ;
 
-}  // read_galRow_HOSTLIB
+}  // parse_galRow_HOSTLIB
+
+// ==========================================
+int read_gal_HOSTLIB_THREADS(int NTHREAD) {
+
+  // Created Oct 2026
+  // Multi-threaded alternative to the fscanf loop in read_gal_HOSTLIB.
+  // HOSTLIB file is mmap'ed and split into NTHREAD byte ranges on
+  // newline boundaries. Each thread parses its GAL rows, applies
+  // passCuts_HOSTLIB, and keeps only the stored columns of rows
+  // that pass cuts. Chunks are then merged in file order so that
+  // NGAL_READ, LIBINDEX_READ, VALMIN/VALMAX ... are identical to
+  // serial reading. Function returns number of GALID-priority rows.
+
+  bool DO_SWAPZPHOT = (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_SWAPZPHOT)>0 ;
+  int  NVAR_STORE   = HOSTLIB.NVAR_STORE ;
+  int  IVAR_ZPHOT   = HOSTLIB.IVAR_ZPHOT ; // ivar_STORE
+  int  IVAR_ZTRUE   = HOSTLIB.IVAR_ZTRUE ;
+  long long GALID_MIN = INPUTS.HOSTLIB_GALID_PRIORITY[0] ;
+  long long GALID_MAX = INPUTS.HOSTLIB_GALID_PRIORITY[1] ;
+
+  HOSTLIB_THREAD_DEF THREAD[MXTHREAD_HOSTLIB];
+  pthread_t          TID[MXTHREAD_HOSTLIB];
+  struct stat st;
+  int    fd, t, irow, ikeep, ivar_STORE, NGAL, NGAL_READ ;
+  int    NPRIORITY = 0 ;
+  size_t NBYTE ;
+  char   *ADDR, *ptr, *ptr_end ;
+  double val, *VALUES ;
+  long long GALID ;
+  bool   ISCHAR ;
+  char fnam[] = "read_gal_HOSTLIB_THREADS" ;
+
+  // ---------------- BEGIN -----------------
+
+  if ( NTHREAD > MXTHREAD_HOSTLIB ) {
+    sprintf(c1err,"HOSTLIB_NTHREAD=%d exceeds bound", NTHREAD);
+    sprintf(c2err,"Check MXTHREAD_HOSTLIB = %d", MXTHREAD_HOSTLIB);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  fd = open(HOSTLIB.FILENAME, O_RDONLY);
+  if ( fd < 0 || fstat(fd,&st) != 0 ) {
+    sprintf(c1err,"Unable to open HOSTLIB for mmap:");
+    sprintf(c2err,"%s", HOSTLIB.FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+  NBYTE = (size_t)st.st_size ;
+  ADDR  = (char*)mmap(NULL, NBYTE, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if ( ADDR == MAP_FAILED ) {
+    sprintf(c1err,"mmap failed for HOSTLIB");
+    sprintf(c2err,"%s", HOSTLIB.FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+  madvise(ADDR, NBYTE, MADV_SEQUENTIAL);
+
+  printf("\t Parse GAL rows with %d threads. \n", NTHREAD);
+  fflush(stdout);
+
+  // split file into byte ranges; each range starts after a newline
+  ptr_end = ADDR + NBYTE ;
+  for(t=0; t < NTHREAD; t++ ) {
+    ptr = ADDR + (NBYTE * t) / NTHREAD ;
+    if ( t > 0 ) {
+      while ( ptr < ptr_end && *(ptr-1) != '\n' ) { ptr++ ; }
+    }
+    THREAD[t].PTR_START = ptr ;
+    if ( t > 0 ) { THREAD[t-1].PTR_END = ptr; }
+  }
+  THREAD[NTHREAD-1].PTR_END = ptr_end ;
+
+  for(t=0; t < NTHREAD; t++ ) {
+    THREAD[t].ITHREAD = t;
+    pthread_create(&TID[t], NULL, read_galThread_HOSTLIB, &THREAD[t]);
+  }
+  for(t=0; t < NTHREAD; t++ )  { pthread_join(TID[t], NULL); }
+
+  // merge chunks in file order; emulate serial bookkeeping
+  for(t=0; t < NTHREAD; t++ ) {
+    HOSTLIB.NSTAR    += THREAD[t].NSTAR ;
+    HOSTLIB.NERR_NAN += THREAD[t].NERR_NAN ;
+    ikeep = 0 ;
+
+    for(irow=0; irow < THREAD[t].NREAD; irow++ ) {
+      malloc_HOSTLIB(HOSTLIB.NGAL_STORE,HOSTLIB.NGAL_READ);
+
+      NGAL_READ = HOSTLIB.NGAL_READ; // C-like index
+      HOSTLIB.NGAL_READ++ ;          // fortran-like index
+
+      if ( (HOSTLIB.NGAL_READ % 400000)==0  ) {
+	printf("\t\t read %6d GAL rows\n", HOSTLIB.NGAL_READ);
+	fflush(stdout);
+      }
+
+      if ( HOSTLIB.NGAL_READ > INPUTS.HOSTLIB_MAXREAD ) { goto DONE ; } 
+
+      if ( ikeep >= THREAD[t].NKEEP ) { continue; }
+      if ( THREAD[t].IREAD_KEEP[ikeep] != irow ) { continue; }
+
+      VALUES = &THREAD[t].VALUES[ikeep*NVAR_STORE] ;
+      NGAL   = HOSTLIB.NGAL_STORE ;   HOSTLIB.NGAL_STORE++ ;   
+
+      if ( GALID_MIN < GALID_MAX ) {
+	GALID = (long long)VALUES[HOSTLIB.IVAR_GALID];
+	if ( GALID >= GALID_MIN && GALID <= GALID_MAX ) { NPRIORITY++ ; }
+      }
+
+      for ( ivar_STORE=0; ivar_STORE < NVAR_STORE; ivar_STORE++ ) {
+	val = VALUES[ivar_STORE];
+	HOSTLIB.VALUE_UNSORTED[ivar_STORE][NGAL] = val ;
+	ISCHAR = ISCHAR_HOSTLIB(ivar_STORE);
+	if ( ISCHAR == false ) {
+	  if ( val > HOSTLIB.VALMAX[ivar_STORE] ) 
+	    { HOSTLIB.VALMAX[ivar_STORE] = val; }
+	  if ( val < HOSTLIB.VALMIN[ivar_STORE] ) 
+	    { HOSTLIB.VALMIN[ivar_STORE] = val; }
+	}
+      }
+
+      if ( HOSTLIB.IVAR_FIELD > 0  ) {
+	sprintf(HOSTLIB.FIELD_UNSORTED[NGAL],"%s", THREAD[t].FIELD[ikeep]);
+      }
+
+      // transfer NBR_LIST pointer (malloc'ed in thread)
+      if ( HOSTLIB.IVAR_NBR_LIST > 0 ) {
+	HOSTLIB.NBR_UNSORTED[NGAL]  = THREAD[t].NBR_LIST[ikeep];
+	THREAD[t].NBR_LIST[ikeep]   = NULL ;
+      }
+
+      if ( DO_SWAPZPHOT ) {
+	HOSTLIB.VALUE_UNSORTED[IVAR_ZTRUE][NGAL] = 
+	  HOSTLIB.VALUE_UNSORTED[IVAR_ZPHOT][NGAL] ;
+      }
+
+      HOSTLIB.LIBINDEX_READ[NGAL_READ] = NGAL ; 
+      ikeep++ ;
+    }
+  }
+
+ DONE:
+
+  // free chunk storage
+  for(t=0; t < NTHREAD; t++ ) {
+    if ( THREAD[t].NBR_LIST != NULL ) {
+      for(ikeep=0; ikeep < THREAD[t].NKEEP; ikeep++ ) 
+	{ if ( THREAD[t].NBR_LIST[ikeep] ) free(THREAD[t].NBR_LIST[ikeep]); }
+      free(THREAD[t].NBR_LIST);
+    }
+    free(THREAD[t].IREAD_KEEP);
+    free(THREAD[t].VALUES);
+    if ( THREAD[t].FIELD != NULL ) { free(THREAD[t].FIELD); }
+  }
+  munmap(ADDR, NBYTE);
+
+  return(NPRIORITY) ;
+
+} // end read_gal_HOSTLIB_THREADS
+
+// ==========================================
+void *read_galThread_HOSTLIB(void *arg) {
+
+  // Created Oct 2026
+  // Thread worker for read_gal_HOSTLIB_THREADS: parse GAL rows in 
+  // byte range [PTR_START,PTR_END), apply cuts, and store only 
+  // the NVAR_STORE columns of rows passing cuts.
+
+  HOSTLIB_THREAD_DEF *THREAD = (HOSTLIB_THREAD_DEF*)arg ;
+  int  NVAL       = HOSTLIB.NVAR_ALL ;
+  int  NVAR_STORE = HOSTLIB.NVAR_STORE ;
+  bool DO_FIELD   = ( HOSTLIB.IVAR_FIELD    > 0 );
+  bool DO_NBR     = ( HOSTLIB.IVAR_NBR_LIST > 0 );
+  int  MXCHAR     = MXCHAR_LINE_HOSTLIB ;
+
+  char  *ptr     = THREAD->PTR_START ;
+  char  *ptr_end = THREAD->PTR_END ;
+  char  *ptr_eol, tmpLine[MXCHAR_LINE_HOSTLIB] ;
+  char  FIELD[MXCHAR_FIELDNAME+1], NBR_LIST[MXCHAR_NBR_LIST+1] ;
+  double xval[MXVAR_HOSTLIB];
+  int   NCHAR, ivar_STORE, NKEEP, MXKEEP ;
+  char fnam[] = "read_galThread_HOSTLIB" ;
+
+  // ---------------- BEGIN -----------------
+
+  THREAD->NREAD = THREAD->NKEEP = THREAD->MXKEEP = 0 ;
+  THREAD->NSTAR = THREAD->NERR_NAN = 0 ;
+  THREAD->IREAD_KEEP = NULL;  THREAD->VALUES = NULL ;
+  THREAD->FIELD      = NULL;  THREAD->NBR_LIST = NULL ;
+
+  while ( ptr < ptr_end ) {
+
+    ptr_eol = memchr(ptr, '\n', ptr_end - ptr);
+    if ( ptr_eol == NULL ) { ptr_eol = ptr_end; }
+
+    // skip leading blanks, then require GAL: key
+    while ( ptr < ptr_eol && (*ptr==' ' || *ptr=='\t') ) { ptr++ ; }
+    if ( ptr_eol - ptr < 5 || strncmp(ptr,"GAL:",4) != 0 ||
+	 (ptr[4] != ' ' && ptr[4] != '\t') ) 
+      { ptr = ptr_eol + 1;  continue; }
+
+    ptr  += 4 ;
+    NCHAR = ptr_eol - ptr ;
+    if ( NCHAR >= MXCHAR-5 ) {
+      sprintf(c1err,"LINE likely exceeds bound of %d", MXCHAR);
+      sprintf(c2err,"Shorten HOSTLIB lines, or increase MXCHAR_LINE_HOSTLIB");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+    }
+    memcpy(tmpLine, ptr, NCHAR);  tmpLine[NCHAR] = '\0' ;
+    ptr = ptr_eol + 1;
+
+    THREAD->NREAD++ ;
+    parse_galRow_HOSTLIB(tmpLine, NVAL, xval, FIELD, NBR_LIST, 
+			 &THREAD->NERR_NAN);
+
+    if ( passCuts_HOSTLIB(xval,&THREAD->NSTAR) == 0 ) { continue; }
+
+    // keep this row; extend storage in MALLOCSIZE_HOSTLIB steps
+    NKEEP = THREAD->NKEEP ;
+    if ( NKEEP == THREAD->MXKEEP ) {
+      MXKEEP = THREAD->MXKEEP + MALLOCSIZE_HOSTLIB ;
+      THREAD->IREAD_KEEP = (int*)realloc(THREAD->IREAD_KEEP, 
+					 MXKEEP*sizeof(int));
+      THREAD->VALUES = (double*)realloc(THREAD->VALUES,
+				(size_t)MXKEEP*NVAR_STORE*sizeof(double));
+      if ( DO_FIELD ) {
+	THREAD->FIELD = realloc(THREAD->FIELD, 
+				MXKEEP*sizeof(THREAD->FIELD[0]));
+      }
+      if ( DO_NBR ) {
+	THREAD->NBR_LIST = (char**)realloc(THREAD->NBR_LIST,
+					   MXKEEP*sizeof(char*));
+      }
+      THREAD->MXKEEP = MXKEEP ;
+    }
+
+    THREAD->IREAD_KEEP[NKEEP] = THREAD->NREAD - 1 ;
+    for(ivar_STORE=0; ivar_STORE < NVAR_STORE; ivar_STORE++ ) {
+      THREAD->VALUES[NKEEP*NVAR_STORE + ivar_STORE] = 
+	xval[HOSTLIB.IVAR_ALL[ivar_STORE]] ;
+    }
+    if ( DO_FIELD ) { sprintf(THREAD->FIELD[NKEEP], "%s", FIELD); }
+    if ( DO_NBR ) {
+      THREAD->NBR_LIST[NKEEP] = (char*)malloc(strlen(NBR_LIST)+1);
+      sprintf(THREAD->NBR_LIST[NKEEP], "%s", NBR_LIST);
+    }
+    THREAD->NKEEP++ ;
+  }
+
+  return(NULL);
+
+} // end read_galThread_HOSTLIB
 
 // ==========================================
 void  summary_snpar_HOSTLIB(void) {
@@ -3758,10 +4114,20 @@ void sortz_HOSTLIB(void) {
   HOSTLIB.LIBINDEX_UNSORT  = (int*)malloc( MEMI ); MEMTOT += (double)MEMI ;
   HOSTLIB.LIBINDEX_ZSORT   = (int*)malloc( MEMI ); MEMTOT += (double)MEMI ;
 
-  // allocate memory for sorted values
+  // allocate memory for sorted values; Oct 2026: float for
+  // non-critical columns if HOSTLIB_MSKOPT_FLOAT32 is set.
+  int MEMF  = (NGAL+1) * sizeof(float) ;
   for ( ival=0; ival < NVAR_STORE; ival++ )  {
-    HOSTLIB.VALUE_ZSORTED[ival] = (double*)malloc(MEMD);
-    MEMTOT += (double)MEMD ;
+    HOSTLIB.ISFLOAT32[ival] = ISFLOAT32_HOSTLIB(ival);
+    if ( HOSTLIB.ISFLOAT32[ival] ) {
+      HOSTLIB.VALUE_ZSORTED[ival]   = NULL ;
+      HOSTLIB.VALUE32_ZSORTED[ival] = (float*)malloc(MEMF);
+      MEMTOT += (double)MEMF ;
+    }
+    else {
+      HOSTLIB.VALUE_ZSORTED[ival] = (double*)malloc(MEMD);
+      MEMTOT += (double)MEMD ;
+    }
   }
 
   if ( DO_FIELD  ) {
@@ -3824,7 +4190,7 @@ void sortz_HOSTLIB(void) {
 
     for ( ival=0; ival < NVAR_STORE; ival++ ) {
       VAL = HOSTLIB.VALUE_UNSORTED[ival][unsort] ; 
-      HOSTLIB.VALUE_ZSORTED[ival][igal] = VAL;
+      set_VALUE_ZSORTED_HOSTLIB(ival,igal,VAL);
     }
 
     if ( DO_FIELD ) {
@@ -3863,7 +4229,7 @@ void sortz_HOSTLIB(void) {
     }
 
     if ( DO_VPEC ) {
-      VPEC = HOSTLIB.VALUE_ZSORTED[IVAR_VPEC][igal];
+      VPEC = get_VALUE_ZSORTED_HOSTLIB(IVAR_VPEC,igal);
       if ( VPEC > HOSTLIB.VPEC_MAX ) { HOSTLIB.VPEC_MAX = VPEC; }
       if ( VPEC < HOSTLIB.VPEC_MIN ) { HOSTLIB.VPEC_MIN = VPEC; }
       VSUM += VPEC;  VSUMSQ += (VPEC*VPEC);
@@ -3912,6 +4278,343 @@ void sortz_HOSTLIB(void) {
 
 } // end of sortz_HOSTLIB
 
+// =============================================
+bool use_binary_HOSTLIB(void) {
+
+  // Created Oct 14 2026
+  // Return true if user requested binary HOSTLIB image
+  // and HOSTLIB has only contents that can be stored in image.
+  // The variable-length NBR_LIST strings and the +HOSTXXX
+  // rewrite options (which need unsorted & uncut library) are 
+  // not supported; for these the text HOSTLIB is always read.
+  // Oct 15 2026: also not supported for float storage (MSKOPT_FLOAT32).
+
+  char *BINFILE = INPUTS.HOSTLIB_BINARY_FILE ;
+  char fnam[] = "use_binary_HOSTLIB" ;
+
+  // ------------ BEGIN -----------
+
+  if ( IGNOREFILE(BINFILE) ) { return false; }
+
+  if ( INPUTS.HOSTLIB_USE == HOSTLIB_FLAG_REWRITE || 
+       HOSTLIB.IVAR_NBR_LIST > 0 ||
+       (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_FLOAT32) > 0 ) {
+    printf("\t %s: ignore HOSTLIB_BINARY_FILE for NBR_LIST, FLOAT32 "
+	   "or +HOST option\n", fnam);
+    fflush(stdout);
+    return false ;
+  }
+
+  return true ;
+
+} // end use_binary_HOSTLIB
+
+// =============================================
+void get_signature_binary_HOSTLIB(char *SIGNATURE) {
+
+  // Created Oct 14 2026
+  // Return SIGNATURE string that uniquely identifies the stored 
+  // contents of a binary HOSTLIB image: text-HOSTLIB name, size and
+  // modification time, list of stored variables, and every input 
+  // that can change which galaxies pass cuts or how they are stored.
+  // USEVPEC is included because VPEC stats & checks are done only
+  // in the sort step, which is skipped for a binary image.
+  // Binary image is used only if its signature matches exactly.
+  // SIGNATURE must be allocated with MXCHAR_SIGNATURE_HOSTLIB.
+
+  struct stat STAT ;
+  int  ivar, NVAR_STORE = HOSTLIB.NVAR_STORE ;
+  int  DO_SWAPZPHOT = (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_SWAPZPHOT)>0 ;
+  int  DO_VPEC      = (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_USEVPEC)>0 ;
+  long long SIZE = -9, MTIME = -9 ;
+  char fnam[] = "get_signature_binary_HOSTLIB" ;
+
+  // ------------ BEGIN -----------
+
+  if ( stat(HOSTLIB.FILENAME, &STAT) == 0 ) 
+    { SIZE = (long long)STAT.st_size;  MTIME = (long long)STAT.st_mtime; }
+  else {
+    sprintf(c1err,"Cannot stat HOSTLIB file");
+    sprintf(c2err,"%s", HOSTLIB.FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  sprintf(SIGNATURE, 
+	  "FILE=%s SIZE=%lld MTIME=%lld MAXREAD=%d "
+	  "ZWIN=%.8f,%.8f RAWIN=%.6f,%.6f DECWIN=%.6f,%.6f "
+	  "SWAPZPHOT=%d USEVPEC=%d FRAME_ZTRUE=%d NSPECBASIS=%d "
+	  "FIELD=%d NVAR_STORE=%d VARNAMES=",
+	  HOSTLIB.FILENAME, SIZE, MTIME, INPUTS.HOSTLIB_MAXREAD,
+	  HOSTLIB_CUTS.ZWIN[0],   HOSTLIB_CUTS.ZWIN[1],
+	  HOSTLIB_CUTS.RAWIN[0],  HOSTLIB_CUTS.RAWIN[1],
+	  HOSTLIB_CUTS.DECWIN[0], HOSTLIB_CUTS.DECWIN[1],
+	  DO_SWAPZPHOT, DO_VPEC, HOSTLIB.FRAME_ZTRUE, HOSTSPEC.NSPECBASIS,
+	  (HOSTLIB.IVAR_FIELD > 0), NVAR_STORE );
+
+  for ( ivar=0; ivar < NVAR_STORE; ivar++ ) {
+    strcat(SIGNATURE, HOSTLIB.VARNAME_STORE[ivar] );
+    strcat(SIGNATURE, ",");
+  }
+
+  return ;
+
+} // end get_signature_binary_HOSTLIB
+
+// =============================================
+void write_binary_HOSTLIB(void) {
+
+  // Created Oct 14 2026
+  // Write z-sorted HOSTLIB (after cuts) to binary image file
+  // INPUTS.HOSTLIB_BINARY_FILE so that subsequent jobs can mmap
+  // this image with read_binary_HOSTLIB instead of parsing the 
+  // text HOSTLIB. Image is written to a temp file and then renamed
+  // so that concurrent jobs never mmap a partially written image.
+  // Failure to write is not fatal; jobs just read the text HOSTLIB.
+  //
+  // Layout: header, signature string, VALMIN[NVAR], VALMAX[NVAR],
+  //   VALUE_ZSORTED[NVAR][NGAL], LIBINDEX_ZSORT[NGAL], 
+  //   LIBINDEX_READ[NGAL_READ], optional FIELD[NGAL][MXCHAR_FIELDNAME]
+
+  int  NVAR = HOSTLIB.NVAR_STORE ;
+  int  NGAL = HOSTLIB.NGAL_STORE ;
+  int  NGAL_READ = HOSTLIB.NGAL_READ ;
+  int  DO_FIELD  = ( HOSTLIB.IVAR_FIELD > 0 ) ;
+  int  ivar, igal, NCHAR_SIG, NERR = 0 ;
+  long long MEMSIG ;
+  HOSTLIB_BINARY_HEADER_DEF HEAD ;
+  FILE *fp ;
+  char *SIGNATURE, TMPFILE[MXPATHLEN+20], *BINFILE = INPUTS.HOSTLIB_BINARY_FILE;
+  char fnam[] = "write_binary_HOSTLIB" ;
+
+  // ------------ BEGIN -----------
+
+  if ( !use_binary_HOSTLIB() ) { return; }
+
+  SIGNATURE = (char*)malloc(MXCHAR_SIGNATURE_HOSTLIB*sizeof(char));
+  get_signature_binary_HOSTLIB(SIGNATURE);
+  NCHAR_SIG = strlen(SIGNATURE) + 1 ;
+  MEMSIG    = 8 * ((NCHAR_SIG+7)/8) ; // pad to keep doubles aligned
+
+  memset(&HEAD, 0, sizeof(HOSTLIB_BINARY_HEADER_DEF));
+  sprintf(HEAD.MAGIC, "%s", MAGIC_BINARY_HOSTLIB);
+  HEAD.NCHAR_SIGNATURE = (int)MEMSIG ;
+  HEAD.NVAR_STORE  = NVAR ;
+  HEAD.NGAL_STORE  = NGAL ;
+  HEAD.NGAL_READ   = NGAL_READ ;
+  HEAD.NSTAR       = HOSTLIB.NSTAR ;
+  HEAD.DO_FIELD    = DO_FIELD ;
+  HEAD.ZMIN        = HOSTLIB.ZMIN ;
+  HEAD.ZMAX        = HOSTLIB.ZMAX ;
+  HEAD.ZGAPMAX     = HOSTLIB.ZGAPMAX ;
+  HEAD.ZGAPAVG     = HOSTLIB.ZGAPAVG ;
+  HEAD.Z_ATGAPMAX[0] = HOSTLIB.Z_ATGAPMAX[0] ;
+  HEAD.Z_ATGAPMAX[1] = HOSTLIB.Z_ATGAPMAX[1] ;
+  HEAD.VPEC_RMS    = HOSTLIB.VPEC_RMS ;
+  HEAD.VPEC_AVG    = HOSTLIB.VPEC_AVG ;
+  HEAD.VPEC_MIN    = HOSTLIB.VPEC_MIN ;
+  HEAD.VPEC_MAX    = HOSTLIB.VPEC_MAX ;
+  HEAD.NBYTE_TOTAL = 
+    (long long)sizeof(HOSTLIB_BINARY_HEADER_DEF) + MEMSIG +
+    (long long)sizeof(double) * (long long)NVAR * (long long)(NGAL+2) +
+    (long long)sizeof(int) * (long long)(NGAL + NGAL_READ) ;
+  if ( DO_FIELD ) 
+    { HEAD.NBYTE_TOTAL += (long long)NGAL * (long long)MXCHAR_FIELDNAME ; }
+
+  sprintf(TMPFILE, "%s.tmp%d", BINFILE, (int)getpid() );
+  fp = fopen(TMPFILE, "wb");
+  if ( !fp ) {
+    printf("\n\t *** WARNING: %s cannot open \n\t\t %s \n", fnam, TMPFILE);
+    printf("\t *** -> skip writing binary HOSTLIB. *** \n\n");
+    fflush(stdout);
+    free(SIGNATURE);
+    return ;
+  }
+
+  printf("\t %s: write %.1f MB to \n\t\t %s \n",
+	 fnam, (double)HEAD.NBYTE_TOTAL*1.0E-6, BINFILE);
+  fflush(stdout);
+
+  memset(&SIGNATURE[NCHAR_SIG-1], 0, MEMSIG-NCHAR_SIG+1);
+  if ( fwrite(&HEAD, sizeof(HOSTLIB_BINARY_HEADER_DEF), 1, fp) != 1 ) 
+    { NERR++; }
+  if ( fwrite(SIGNATURE, sizeof(char), MEMSIG, fp) != (size_t)MEMSIG ) 
+    { NERR++; }
+  
+  fwrite(HOSTLIB.VALMIN, sizeof(double), NVAR, fp);
+  fwrite(HOSTLIB.VALMAX, sizeof(double), NVAR, fp);
+  for ( ivar=0; ivar < NVAR; ivar++ ) {
+    if ( fwrite(HOSTLIB.VALUE_ZSORTED[ivar], sizeof(double), NGAL, fp) 
+	 != (size_t)NGAL ) { NERR++; }
+  }
+  fwrite(HOSTLIB.LIBINDEX_ZSORT, sizeof(int), NGAL,      fp);
+  fwrite(HOSTLIB.LIBINDEX_READ,  sizeof(int), NGAL_READ, fp);
+
+  if ( DO_FIELD ) {
+    char FIELD[MXCHAR_FIELDNAME] ;
+    for ( igal=0; igal < NGAL; igal++ ) {
+      memset(FIELD, 0, MXCHAR_FIELDNAME);
+      sprintf(FIELD, "%s", HOSTLIB.FIELD_ZSORTED[igal]);
+      fwrite(FIELD, sizeof(char), MXCHAR_FIELDNAME, fp);
+    }
+  }
+
+  if ( ferror(fp) ) { NERR++ ; }
+  if ( fclose(fp) != 0 ) { NERR++ ; }
+
+  if ( NERR > 0 || rename(TMPFILE,BINFILE) != 0 ) {
+    printf("\n\t *** WARNING: %s failed writing \n\t\t %s \n", 
+	   fnam, BINFILE);
+    fflush(stdout);
+    remove(TMPFILE);
+  }
+
+  free(SIGNATURE);
+
+  return ;
+
+} // end write_binary_HOSTLIB
+
+// =============================================
+int read_binary_HOSTLIB(void) {
+
+  // Created Oct 14 2026
+  // If binary HOSTLIB image (INPUTS.HOSTLIB_BINARY_FILE) exists and 
+  // its signature matches this job, mmap the image and set HOSTLIB 
+  // pointers into the mapped memory; return 1.
+  // If image does not exist or is stale, return 0 so that caller
+  // reads the text HOSTLIB (and then writes a new image).
+  //
+  // The mapping is MAP_PRIVATE so that all jobs on a node share the
+  // same physical (page-cache) memory; the few init/event-level
+  // modifications of VALUE_ZSORTED (e.g., FIXSERSIC, strong lens RA/DEC)
+  // trigger a private copy of only the modified pages.
+
+  char *BINFILE = INPUTS.HOSTLIB_BINARY_FILE ;
+  int  NVAR = HOSTLIB.NVAR_STORE ;
+  int  fd, ivar, igal, NGAL, NGAL_READ, MEMCp ;
+  char *SIGNATURE, *ADDR, *PTR ;
+  struct stat STAT ;
+  HOSTLIB_BINARY_HEADER_DEF HEAD ;
+  char fnam[] = "read_binary_HOSTLIB" ;
+
+  // ------------ BEGIN -----------
+
+  if ( !use_binary_HOSTLIB() ) { return 0; }
+
+  fd = open(BINFILE, O_RDONLY);
+  if ( fd < 0 ) {
+    printf("\t %s: binary HOSTLIB not found -> read text HOSTLIB\n", fnam);
+    fflush(stdout);
+    return 0 ;
+  }
+
+  if ( fstat(fd, &STAT) != 0 ||
+       (size_t)STAT.st_size < sizeof(HOSTLIB_BINARY_HEADER_DEF) ||
+       read(fd, &HEAD, sizeof(HOSTLIB_BINARY_HEADER_DEF)) != 
+       sizeof(HOSTLIB_BINARY_HEADER_DEF) ||
+       strcmp(HEAD.MAGIC, MAGIC_BINARY_HOSTLIB) != 0 ||
+       HEAD.NBYTE_TOTAL != (long long)STAT.st_size ) {
+    printf("\t %s: invalid binary HOSTLIB -> read text HOSTLIB\n", fnam);
+    fflush(stdout);
+    close(fd);  return 0 ;
+  }
+
+  // map entire image
+  ADDR = (char*)mmap(NULL, (size_t)HEAD.NBYTE_TOTAL, PROT_READ | PROT_WRITE,
+		     MAP_PRIVATE, fd, 0);
+  close(fd);
+  if ( ADDR == MAP_FAILED ) {
+    sprintf(c1err,"Cannot mmap %.1f MB binary HOSTLIB",
+	    (double)HEAD.NBYTE_TOTAL*1.0E-6 );
+    sprintf(c2err,"%s", BINFILE);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  // compare signature with current job
+  init_cuts_HOSTLIB();
+  SIGNATURE = (char*)malloc(MXCHAR_SIGNATURE_HOSTLIB*sizeof(char));
+  get_signature_binary_HOSTLIB(SIGNATURE);
+  PTR = ADDR + sizeof(HOSTLIB_BINARY_HEADER_DEF);
+  if ( HEAD.NVAR_STORE != NVAR || strcmp(PTR,SIGNATURE) != 0 ) {
+    printf("\t %s: stale binary HOSTLIB -> read text HOSTLIB\n", fnam);
+    fflush(stdout);
+    munmap(ADDR, (size_t)HEAD.NBYTE_TOTAL);
+    free(SIGNATURE);
+    return 0 ;
+  }
+  free(SIGNATURE);
+  PTR += HEAD.NCHAR_SIGNATURE ;
+
+  // load scalars
+  NGAL      = HOSTLIB.NGAL_STORE = HEAD.NGAL_STORE ;
+  NGAL_READ = HOSTLIB.NGAL_READ  = HEAD.NGAL_READ ;
+  HOSTLIB.NSTAR      = HEAD.NSTAR ;
+  HOSTLIB.ZMIN       = HEAD.ZMIN ;
+  HOSTLIB.ZMAX       = HEAD.ZMAX ;
+  HOSTLIB.ZGAPMAX    = HEAD.ZGAPMAX ;
+  HOSTLIB.ZGAPAVG    = HEAD.ZGAPAVG ;
+  HOSTLIB.Z_ATGAPMAX[0] = HEAD.Z_ATGAPMAX[0] ;
+  HOSTLIB.Z_ATGAPMAX[1] = HEAD.Z_ATGAPMAX[1] ;
+  HOSTLIB.VPEC_RMS   = HEAD.VPEC_RMS ;
+  HOSTLIB.VPEC_AVG   = HEAD.VPEC_AVG ;
+  HOSTLIB.VPEC_MIN   = HEAD.VPEC_MIN ;
+  HOSTLIB.VPEC_MAX   = HEAD.VPEC_MAX ;
+  HOSTLIB.SORTFLAG   = 1 ;
+
+  memcpy(HOSTLIB.VALMIN, PTR, NVAR*sizeof(double));  
+  PTR += NVAR*sizeof(double);
+  memcpy(HOSTLIB.VALMAX, PTR, NVAR*sizeof(double));  
+  PTR += NVAR*sizeof(double);
+
+  // point to mapped arrays (no copy)
+  for ( ivar=0; ivar < NVAR; ivar++ ) {
+    HOSTLIB.VALUE_ZSORTED[ivar] = (double*)PTR ;
+    PTR += (size_t)NGAL * sizeof(double);
+  }
+  HOSTLIB.LIBINDEX_ZSORT = (int*)PTR ;  PTR += (size_t)NGAL * sizeof(int);
+  HOSTLIB.LIBINDEX_READ  = (int*)PTR ;  PTR += (size_t)NGAL_READ*sizeof(int);
+
+  if ( HEAD.DO_FIELD ) {
+    MEMCp = (NGAL+1) * sizeof(char*) ;
+    HOSTLIB.FIELD_ZSORTED = (char**)malloc( MEMCp );
+    for ( igal=0; igal < NGAL; igal++ ) {
+      HOSTLIB.FIELD_ZSORTED[igal] = PTR ;
+      PTR += MXCHAR_FIELDNAME ;
+    }
+  }
+
+  HOSTLIB_BINARY.ADDR  = ADDR ;
+  HOSTLIB_BINARY.NBYTE = (size_t)HEAD.NBYTE_TOTAL ;
+
+  // store IGAL if GALID_FORCE is set (same as in sortz_HOSTLIB)
+  if ( INPUTS.HOSTLIB_GALID_FORCE > 0 ) {
+    for ( igal=0; igal < NGAL; igal++ ) {
+      if ( INPUTS.HOSTLIB_GALID_FORCE == get_GALID_HOSTLIB(igal) ) 
+	{ HOSTLIB.IGAL_FORCE = igal; }
+    }
+  }
+
+  printf("\t %s: mmap %d galaxies (%.1f MB) from \n\t\t %s \n",
+	 fnam, NGAL, (double)HEAD.NBYTE_TOTAL*1.0E-6, BINFILE );
+
+  // same post-read steps as in read_gal_HOSTLIB
+  if ( INPUTS.HOSTLIB_GENZPHOT_OUTLIER[0] < 0.0 ) {
+    INPUTS.HOSTLIB_GENZPHOT_OUTLIER[0] = HOSTLIB.ZMIN ;
+    INPUTS.HOSTLIB_GENZPHOT_OUTLIER[1] = HOSTLIB.ZMAX ;
+  }
+
+  if ( HOSTLIB.NSTAR > 0 ) {
+    printf("\n\t *** WARNING: %d entries might be stars (z<%.4f) **** \n\n",
+	   HOSTLIB.NSTAR, ZMAX_STAR);
+  }
+  fflush(stdout);
+
+  check_redshift_HOSTLIB();
+
+  return 1 ;
+
+} // end read_binary_HOSTLIB
+
 
 // =============================================
 double transform_ZTRUE_HOSTLIB(int igal) {
@@ -4110,10 +4813,14 @@ void init_HOSTLIB_WGTMAP(int OPT_INIT, int IGAL_START, int IGAL_END) {
   // Jun 25 2019: check GAMMA_GRID option
   // May 03 2022: check new HOSTLIB feature for TRUE column (IVAR_TRUE_MATCH)
   // Jun 19 2022: if [band]_obs==99, set to VALMAX-0.001 to avoid abort.
+  // Oct 15 2026: 
+  //   + load SNVAR bins from WGTMAP cache (read_WGTCACHE_HOSTLIB), 
+  //     and interpolate only bins not in cache; then update cache.
+  //   + move CHECKLIST_IGAL search out of ibin loop.
 
   bool IS_SNVAR ;
   int  i, NDIM, ivar, ivar_STORE, NFUN, NROW, ibin, istat ;
-  int  NGAL, igal, isparse, IVAL ;
+  int  NGAL, igal, isparse, IVAL, NBIN_CACHE ;
   short int I2MAG;
   bool VBOSE, LDMPWGT ;
 
@@ -4170,9 +4877,28 @@ void init_HOSTLIB_WGTMAP(int OPT_INIT, int IGAL_START, int IGAL_END) {
 
 
 
+  // store IGAL for each GALID on the check-list
+  for ( igal=IGAL_START ; igal <= IGAL_END ; igal++ ) {
+    GALID  = get_GALID_HOSTLIB(igal);
+    ZTRUE  = get_ZTRUE_HOSTLIB(igal);
+    for ( i=0; i < HOSTLIB_WGTMAP.NCHECKLIST; i++ ) {
+      GALID_CHECK = HOSTLIB_WGTMAP.CHECKLIST_GALID[i];
+      ZTRUE_CHECK = HOSTLIB_WGTMAP.CHECKLIST_ZTRUE[i] ;
+      ZDIF        = fabs(ZTRUE - ZTRUE_CHECK) ;
+      if ( GALID == GALID_CHECK && ZDIF < 2.0E-4 ) 
+	{ HOSTLIB_WGTMAP.CHECKLIST_IGAL[i] = igal ; }
+    }
+  }
+
+  // Oct 2026: load cached weights; DO_BIN=false for each loaded bin
+  bool *DO_BIN = (bool*)malloc(NBTOT_SNVAR*sizeof(bool));
+  NBIN_CACHE = read_WGTCACHE_HOSTLIB(IGAL_START, IGAL_END, DO_BIN);
+
   // - - - - - - - -
   for(ibin=0; ibin < NBTOT_SNVAR ; ibin++ ) {
 
+    if ( !DO_BIN[ibin] ) { continue; }
+
     if ( N_SNVAR > 0 )  // fetch SN grid values
       { getVal_SNVAR_HOSTLIB_WGTMAP(ibin,VAL_SNVAR); }
 
@@ -4201,7 +4927,7 @@ void init_HOSTLIB_WGTMAP(int OPT_INIT, int IGAL_START, int IGAL_END) {
 	if ( !IS_SNVAR ) {
 	  // get VAL from HOSTLIB
 	  ivar_STORE   = HOSTLIB.IVAR_STORE[ivar];
-	  VAL          = HOSTLIB.VALUE_ZSORTED[ivar_STORE][igal] ;
+	  VAL          = get_VALUE_ZSORTED_HOSTLIB(ivar_STORE,igal) ;
 	}
 	else {
 	  // get VAL from SN property
@@ -4234,7 +4960,7 @@ void init_HOSTLIB_WGTMAP(int OPT_INIT, int IGAL_START, int IGAL_END) {
 	  if ( IS_SNVAR ) { continue; }
  	  ivar_STORE   = HOSTLIB.IVAR_STORE[ivar];
 	  varName      = HOSTLIB.VARNAME_STORE[ivar_STORE] ;
-	  VAL          = HOSTLIB.VALUE_ZSORTED[ivar_STORE][igal] ;
+	  VAL          = get_VALUE_ZSORTED_HOSTLIB(ivar_STORE,igal) ;
 	  VALMIN       = HOSTLIB_WGTMAP.GRIDMAP.VALMIN[ivar];
 	  VALMAX       = HOSTLIB_WGTMAP.GRIDMAP.VALMAX[ivar];
 	  printf("\t %s = %f  (WGTMAP range: %f to %f)\n", 
@@ -4279,17 +5005,6 @@ void init_HOSTLIB_WGTMAP(int OPT_INIT, int IGAL_START, int IGAL_END) {
 
       WGTSUM_LAST  =  WGTSUM ;
 	
-      // store IGAL if this GALID is on the check-list
-      
-      for ( i=0; i < HOSTLIB_WGTMAP.NCHECKLIST; i++ ) {
-	GALID_CHECK = HOSTLIB_WGTMAP.CHECKLIST_GALID[i];
-	ZTRUE_CHECK = HOSTLIB_WGTMAP.CHECKLIST_ZTRUE[i] ;
-	ZDIF        = fabs(ZTRUE - ZTRUE_CHECK) ;
-	if ( GALID == GALID_CHECK && ZDIF < 2.0E-4 ) 
-	  { HOSTLIB_WGTMAP.CHECKLIST_IGAL[i] = igal ; }
-      }
-	
-	
       LDMPWGT = ( igal == -9 ) ; //  INPUTS.HOSTLIB_MAXREAD - 10  );
       if ( LDMPWGT ) {
 	sprintf(cvar,"%s", HOSTLIB_WGTMAP.VARNAME[0] );
@@ -4301,6 +5016,10 @@ void init_HOSTLIB_WGTMAP(int OPT_INIT, int IGAL_START, int IGAL_END) {
     }   // end if igal loop
   }   // end NBTOT
 
+  // update cache if any bin was interpolated
+  if ( NBIN_CACHE < NBTOT_SNVAR ) 
+    { write_WGTCACHE_HOSTLIB(IGAL_START, IGAL_END); }
+  free(DO_BIN);
 
   // --------------------------
   // verify interpolated WGTMAP values against optional list of 
@@ -4358,6 +5077,289 @@ void malloc_HOSTLIB_WGTMAP(void) {
 
 } // end malloc_HOSTLIB_WGTMAP
 
+// =========================================
+unsigned long long hash_HOSTLIB(unsigned long long HASH, void *PTR, 
+				size_t NBYTE) {
+  // Created Oct 2026
+  // Update 64-bit FNV-1a HASH with NBYTE bytes starting at PTR.
+  unsigned char *BYTE = (unsigned char*)PTR ;
+  size_t i;
+  for(i=0; i < NBYTE; i++ ) 
+    { HASH ^= (unsigned long long)BYTE[i];  HASH *= 1099511628211ULL; }
+  return(HASH);
+} // end hash_HOSTLIB
+
+// =========================================
+int key_WGTCACHE_HOSTLIB(int IGAL_START, int IGAL_END, 
+			 unsigned long long *KEY_GLOBAL, 
+			 unsigned long long *KEY_BIN) {
+
+  // Created Oct 2026
+  // Compute keys for WGTMAP cache:
+  //  *KEY_GLOBAL : binary-HOSTLIB signature, WGTMAP grid definition
+  //                and options that change weights for every bin.
+  //  KEY_BIN[ibin] : KEY_GLOBAL + every WGTMAP row whose SNVAR grid
+  //                indices match SNVAR bin ibin. SNVAR bins are grid 
+  //                nodes, so weights for ibin depend only on these rows.
+  // Function returns 1 if keys are valid, or 0 if WGTMAP is not a 
+  // full grid (cache not used).
+
+  GRIDMAP_DEF *GRIDMAP = &HOSTLIB_WGTMAP.GRIDMAP ;
+  int  NDIM    = GRIDMAP->NDIM ;
+  int  NFUN    = GRIDMAP->NFUN ;
+  int  N_SNVAR = HOSTLIB_WGTMAP.N_SNVAR ;
+  int  NBTOT   = HOSTLIB_WGTMAP.NBTOT_SNVAR ;
+  int  idim, ivar_SN, ifun, igrid, irow, ibin, NGRID, IB1D ;
+  int  STRIDE[MXDIM_GRIDMAP], OPTLIST[10] ;
+  unsigned long long HASH = 14695981039346656037ULL ;
+  char *SIGNATURE ;
+
+  // ------------ BEGIN -----------
+
+  NGRID = 1 ;
+  for(idim=0; idim < NDIM; idim++ ) 
+    { STRIDE[idim] = NGRID;  NGRID *= GRIDMAP->NBIN[idim]; }
+  if ( NGRID != GRIDMAP->NROW ) { return 0; }
+
+  SIGNATURE = (char*)malloc(MXCHAR_SIGNATURE_HOSTLIB*sizeof(char));
+  get_signature_binary_HOSTLIB(SIGNATURE);
+  HASH = hash_HOSTLIB(HASH, SIGNATURE, strlen(SIGNATURE));
+  free(SIGNATURE);
+
+  OPTLIST[0] = IGAL_START ;
+  OPTLIST[1] = IGAL_END ;
+  OPTLIST[2] = HOSTLIB.NGAL_STORE ;
+  OPTLIST[3] = NDIM ;
+  OPTLIST[4] = NFUN ;
+  OPTLIST[5] = N_SNVAR ;
+  OPTLIST[6] = GRIDMAP->OPT_EXTRAP ;
+  OPTLIST[7] = HOSTLIB.IVAR_TRUE_MATCH ;
+  OPTLIST[8] = (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_FLOAT32) ;
+  OPTLIST[9] = 0 ;
+  HASH = hash_HOSTLIB(HASH, OPTLIST, sizeof(OPTLIST) );
+  HASH = hash_HOSTLIB(HASH, INPUTS.BIASCOR_SALT2GAMMA_GRID, 2*sizeof(double));
+
+  for(idim=0; idim < NDIM; idim++ ) {
+    HASH = hash_HOSTLIB(HASH, HOSTLIB_WGTMAP.VARNAME[idim], 
+			strlen(HOSTLIB_WGTMAP.VARNAME[idim]) );
+    HASH = hash_HOSTLIB(HASH, &GRIDMAP->NBIN[idim],   sizeof(int) );
+    HASH = hash_HOSTLIB(HASH, &GRIDMAP->VALMIN[idim], sizeof(double) );
+    HASH = hash_HOSTLIB(HASH, &GRIDMAP->VALBIN[idim], sizeof(double) );
+    HASH = hash_HOSTLIB(HASH, &HOSTLIB_WGTMAP.IS_SNVAR[idim], sizeof(bool));
+  }
+  *KEY_GLOBAL = HASH ;
+
+  // per-bin keys: ibin index is the same as in prep_SNVAR_HOSTLIB_WGTMAP
+  // (first SNVAR is most significant)
+  for(ibin=0; ibin < NBTOT; ibin++ ) { KEY_BIN[ibin] = HASH; }
+
+  for(igrid=0; igrid < NGRID; igrid++ ) {
+    irow = GRIDMAP->INVMAP[igrid] ;
+    ibin = 0 ;
+    for(ivar_SN=0; ivar_SN < N_SNVAR; ivar_SN++ ) {
+      idim = HOSTLIB_WGTMAP.ISPARSE_SNVAR[ivar_SN] ;
+      IB1D = (igrid / STRIDE[idim]) % GRIDMAP->NBIN[idim] ;
+      ibin = ibin * HOSTLIB_WGTMAP.NB1D_SNVAR[ivar_SN] + IB1D ;
+    }
+    KEY_BIN[ibin] = hash_HOSTLIB(KEY_BIN[ibin], &igrid, sizeof(int));
+    for(ifun=0; ifun < NFUN; ifun++ ) {
+      KEY_BIN[ibin] = hash_HOSTLIB(KEY_BIN[ibin], &GRIDMAP->FUNVAL[ifun][irow],
+				   sizeof(double) );
+    }
+  }
+
+  return 1 ;
+
+} // end key_WGTCACHE_HOSTLIB
+
+// =========================================
+int read_WGTCACHE_HOSTLIB(int IGAL_START, int IGAL_END, bool *DO_BIN) {
+
+  // Created Oct 2026
+  // If binary HOSTLIB image is used, check for cache of per-galaxy
+  // WGTMAP results in [HOSTLIB_BINARY_FILE].WGTMAP and load WGTSUM
+  // and I2SNMAGSHIFT for each SNVAR bin whose key matches.
+  // Output DO_BIN[ibin] = false for loaded bins, true for bins that
+  // must be interpolated. If only SN-dependent WGTMAP rows change, 
+  // only those bins are re-interpolated; since WGTMAX may change,
+  // cached WGTSUM are re-normalized to current WGTMAX.
+  // Function returns number of loaded bins.
+
+  int  NBTOT = HOSTLIB_WGTMAP.NBTOT_SNVAR ;
+  int  NGAL  = HOSTLIB.NGAL_STORE ;
+  int  ibin, igal, NLOAD = 0 ;
+  long long OFFSET, NBYTE_BIN ;
+  double *WGTSUM, WGTSCALE ;
+  short int *I2MAG ;
+  unsigned long long KEY_GLOBAL, *KEY_BIN, *KEY_BIN_CACHE ;
+  char CACHEFILE[MXPATHLEN+20] ;
+  struct stat STAT ;
+  HOSTLIB_WGTCACHE_HEADER_DEF HEAD ;
+  FILE *fp ;
+  char fnam[] = "read_WGTCACHE_HOSTLIB" ;
+
+  // ------------ BEGIN -----------
+
+  for(ibin=0; ibin < NBTOT; ibin++ ) { DO_BIN[ibin] = true; }
+
+  if ( HOSTLIB_WGTMAP.GRIDMAP.NROW == 0 ) { return 0; }
+  if ( !use_binary_HOSTLIB() ) { return 0; }
+
+  KEY_BIN = (unsigned long long*)malloc(NBTOT*sizeof(unsigned long long));
+  if ( !key_WGTCACHE_HOSTLIB(IGAL_START, IGAL_END, &KEY_GLOBAL, KEY_BIN) )
+    { free(KEY_BIN); return 0; }
+
+  sprintf(CACHEFILE, "%s.%s", 
+	  INPUTS.HOSTLIB_BINARY_FILE, SUFFIX_WGTCACHE_HOSTLIB);
+  fp = fopen(CACHEFILE, "rb");
+  if ( !fp ) { free(KEY_BIN); return 0; }
+
+  if ( stat(CACHEFILE, &STAT) != 0 ||
+       fread(&HEAD, sizeof(HOSTLIB_WGTCACHE_HEADER_DEF), 1, fp) != 1 ||
+       strcmp(HEAD.MAGIC, MAGIC_WGTCACHE_HOSTLIB) != 0   ||
+       HEAD.NBYTE_TOTAL != (long long)STAT.st_size      ||
+       HEAD.NGAL != NGAL || HEAD.NBTOT_SNVAR != NBTOT   ||
+       HEAD.KEY_GLOBAL != KEY_GLOBAL || HEAD.WGTMAX <= 0.0 ) {
+    printf("\t %s: stale WGTMAP cache -> interpolate all bins\n", fnam);
+    fflush(stdout);
+    fclose(fp);  free(KEY_BIN);  return 0 ;
+  }
+
+  KEY_BIN_CACHE = (unsigned long long*)malloc(NBTOT*sizeof(unsigned long long));
+  fread(KEY_BIN_CACHE, sizeof(unsigned long long), NBTOT, fp);
+
+  WGTSCALE  = HEAD.WGTMAX / HOSTLIB_WGTMAP.WGTMAX ;
+  NBYTE_BIN = (long long)NGAL * (long long)(sizeof(double)+sizeof(short int));
+  for(ibin=0; ibin < NBTOT; ibin++ ) {
+    if ( KEY_BIN_CACHE[ibin] != KEY_BIN[ibin] ) { continue; }
+
+    if ( HOSTLIB_WGTMAP.N_SNVAR > 0 ) {
+      WGTSUM = HOSTLIB_WGTMAP.WGTSUM_SNVAR[ibin] ;
+      I2MAG  = HOSTLIB_WGTMAP.I2SNMAGSHIFT_SNVAR[ibin] ;
+    }
+    else {
+      WGTSUM = HOSTLIB_WGTMAP.WGTSUM ;
+      I2MAG  = HOSTLIB_WGTMAP.I2SNMAGSHIFT ;
+    }
+
+    OFFSET = (long long)sizeof(HOSTLIB_WGTCACHE_HEADER_DEF) + 
+      (long long)NBTOT * sizeof(unsigned long long) + 
+      (long long)ibin  * NBYTE_BIN ;
+    fseek(fp, OFFSET, SEEK_SET);
+    if ( fread(WGTSUM, sizeof(double),    NGAL, fp) != (size_t)NGAL ||
+	 fread(I2MAG,  sizeof(short int), NGAL, fp) != (size_t)NGAL ) 
+      { continue; }  // bin is interpolated instead
+
+    if ( WGTSCALE != 1.0 ) 
+      { for(igal=0; igal < NGAL; igal++ ) { WGTSUM[igal] *= WGTSCALE; } }
+
+    DO_BIN[ibin] = false;  NLOAD++ ;
+  }
+
+  fclose(fp);
+  free(KEY_BIN);  free(KEY_BIN_CACHE);
+
+  printf("\t %s: load %d of %d SNVAR bins from \n\t\t %s \n",
+	 fnam, NLOAD, NBTOT, CACHEFILE );
+  fflush(stdout);
+
+  return NLOAD ;
+
+} // end read_WGTCACHE_HOSTLIB
+
+// =========================================
+void write_WGTCACHE_HOSTLIB(int IGAL_START, int IGAL_END) {
+
+  // Created Oct 2026
+  // Write per-galaxy WGTSUM and I2SNMAGSHIFT for every SNVAR bin to
+  // [HOSTLIB_BINARY_FILE].WGTMAP (see read_WGTCACHE_HOSTLIB).
+  // As for write_binary_HOSTLIB, write to temp file and rename,
+  // and failure to write is not fatal.
+  //
+  // Layout: header, KEY_BIN[NBTOT], then for each bin
+  //         WGTSUM[NGAL], I2SNMAGSHIFT[NGAL]
+
+  int  NBTOT = HOSTLIB_WGTMAP.NBTOT_SNVAR ;
+  int  NGAL  = HOSTLIB.NGAL_STORE ;
+  int  ibin, NERR = 0 ;
+  double *WGTSUM ;
+  short int *I2MAG ;
+  unsigned long long KEY_GLOBAL, *KEY_BIN ;
+  char CACHEFILE[MXPATHLEN+20], TMPFILE[MXPATHLEN+40] ;
+  HOSTLIB_WGTCACHE_HEADER_DEF HEAD ;
+  FILE *fp ;
+  char fnam[] = "write_WGTCACHE_HOSTLIB" ;
+
+  // ------------ BEGIN -----------
+
+  if ( HOSTLIB_WGTMAP.GRIDMAP.NROW == 0 ) { return ; }
+  if ( !use_binary_HOSTLIB() ) { return ; }
+
+  KEY_BIN = (unsigned long long*)malloc(NBTOT*sizeof(unsigned long long));
+  if ( !key_WGTCACHE_HOSTLIB(IGAL_START, IGAL_END, &KEY_GLOBAL, KEY_BIN) )
+    { free(KEY_BIN); return ; }
+
+  memset(&HEAD, 0, sizeof(HOSTLIB_WGTCACHE_HEADER_DEF));
+  sprintf(HEAD.MAGIC, "%s", MAGIC_WGTCACHE_HOSTLIB);
+  HEAD.NGAL        = NGAL ;
+  HEAD.NBTOT_SNVAR = NBTOT ;
+  HEAD.KEY_GLOBAL  = KEY_GLOBAL ;
+  HEAD.WGTMAX      = HOSTLIB_WGTMAP.WGTMAX ;
+  HEAD.NBYTE_TOTAL = (long long)sizeof(HOSTLIB_WGTCACHE_HEADER_DEF) +
+    (long long)NBTOT * sizeof(unsigned long long) + 
+    (long long)NBTOT * (long long)NGAL * (sizeof(double)+sizeof(short int));
+
+  sprintf(CACHEFILE, "%s.%s", 
+	  INPUTS.HOSTLIB_BINARY_FILE, SUFFIX_WGTCACHE_HOSTLIB);
+  sprintf(TMPFILE, "%s.tmp%d", CACHEFILE, (int)getpid() );
+  fp = fopen(TMPFILE, "wb");
+  if ( !fp ) {
+    printf("\n\t *** WARNING: %s cannot open \n\t\t %s \n", fnam, TMPFILE);
+    fflush(stdout);
+    free(KEY_BIN);  return ;
+  }
+
+  if ( fwrite(&HEAD, sizeof(HOSTLIB_WGTCACHE_HEADER_DEF), 1, fp) != 1 ) 
+    { NERR++; }
+  if ( fwrite(KEY_BIN, sizeof(unsigned long long), NBTOT, fp) != 
+       (size_t)NBTOT ) { NERR++; }
+
+  for(ibin=0; ibin < NBTOT; ibin++ ) {
+    if ( HOSTLIB_WGTMAP.N_SNVAR > 0 ) {
+      WGTSUM = HOSTLIB_WGTMAP.WGTSUM_SNVAR[ibin] ;
+      I2MAG  = HOSTLIB_WGTMAP.I2SNMAGSHIFT_SNVAR[ibin] ;
+    }
+    else {
+      WGTSUM = HOSTLIB_WGTMAP.WGTSUM ;
+      I2MAG  = HOSTLIB_WGTMAP.I2SNMAGSHIFT ;
+    }
+    if ( fwrite(WGTSUM, sizeof(double),    NGAL, fp) != (size_t)NGAL ) 
+      { NERR++; }
+    if ( fwrite(I2MAG,  sizeof(short int), NGAL, fp) != (size_t)NGAL ) 
+      { NERR++; }
+  }
+
+  if ( ferror(fp) ) { NERR++ ; }
+  if ( fclose(fp) != 0 ) { NERR++ ; }
+
+  if ( NERR > 0 || rename(TMPFILE,CACHEFILE) != 0 ) {
+    printf("\n\t *** WARNING: %s failed writing \n\t\t %s \n", 
+	   fnam, CACHEFILE);
+    fflush(stdout);
+    remove(TMPFILE);
+  }
+  else {
+    printf("\t %s: write %d SNVAR bins to \n\t\t %s \n",
+	   fnam, NBTOT, CACHEFILE );
+    fflush(stdout);
+  }
+
+  free(KEY_BIN);
+
+  return ;
+
+} // end write_WGTCACHE_HOSTLIB
+
 
 // =========================================
 void runCheck_HOSTLIB_WGTMAP(void) {
@@ -5181,27 +6183,27 @@ void get_Sersic_info(int IGAL, SERSIC_DEF *SERSIC) {
 
     // check for option(s) to fix Sersic params
     if ( FIXa > 0.0 ) 
-      { HOSTLIB.VALUE_ZSORTED[IVAR_a][IGAL] = FIXa; }
+      { set_VALUE_ZSORTED_HOSTLIB(IVAR_a,IGAL,FIXa); }
     if ( FIXb > 0.0 ) 
-      { HOSTLIB.VALUE_ZSORTED[IVAR_b][IGAL] = FIXb; }
+      { set_VALUE_ZSORTED_HOSTLIB(IVAR_b,IGAL,FIXb); }
     if ( FIXn > -998.0 && IVAR_n >= 0 ) 
-      { HOSTLIB.VALUE_ZSORTED[IVAR_n][IGAL] = FIXn; }
+      { set_VALUE_ZSORTED_HOSTLIB(IVAR_n,IGAL,FIXn); }
     if ( FIXn > -998.0 && IVAR_n < 0 ) 
       { SERSIC_PROFILE.FIXn[j] = FIXn; }
     if ( FIXANG > -998.0 ) 
-      { HOSTLIB.VALUE_ZSORTED[IVAR_ANGLE][IGAL] = FIXANG; }
+      { set_VALUE_ZSORTED_HOSTLIB(IVAR_ANGLE,IGAL,FIXANG); }
 
     // - - - - - - 
     if ( IVAR_n >= 0 ) 
-      { n = HOSTLIB.VALUE_ZSORTED[IVAR_n][IGAL] ; }
+      { n = get_VALUE_ZSORTED_HOSTLIB(IVAR_n,IGAL) ; }
     else
       { n = SERSIC_PROFILE.FIXn[j] ; }
 
-    SERSIC->a[j]  = HOSTLIB.VALUE_ZSORTED[IVAR_a][IGAL] ; 
-    SERSIC->b[j]  = HOSTLIB.VALUE_ZSORTED[IVAR_b][IGAL] ; 
+    SERSIC->a[j]  = get_VALUE_ZSORTED_HOSTLIB(IVAR_a,IGAL) ; 
+    SERSIC->b[j]  = get_VALUE_ZSORTED_HOSTLIB(IVAR_b,IGAL) ; 
     SERSIC->n[j]  = n ;
     SERSIC->bn[j] = get_Sersic_bn(n);
-    SERSIC->a_rot = HOSTLIB.VALUE_ZSORTED[IVAR_ANGLE][IGAL] ; 
+    SERSIC->a_rot = get_VALUE_ZSORTED_HOSTLIB(IVAR_ANGLE,IGAL) ; 
 
     // apply user-scale on size (Mar 28 2018)
     SERSIC->a[j] *= INPUTS.HOSTLIB_SCALE_SERSIC_SIZE ;
@@ -5238,7 +6240,7 @@ void get_Sersic_info(int IGAL, SERSIC_DEF *SERSIC) {
     IVAR_w = SERSIC_PROFILE.IVAR_w[j] ;
     if ( IVAR_w > 0 ) { 
       NWGT++ ;
-      WGT     = HOSTLIB.VALUE_ZSORTED[IVAR_w][IGAL] ;
+      WGT     = get_VALUE_ZSORTED_HOSTLIB(IVAR_w,IGAL) ;
       WGTSUM += WGT;
       SERSIC->w[j] = WGT ;
     }
@@ -5321,8 +6323,10 @@ void init_Sersic_integrals(int j) {
   //
   // Input 'j' is a lookup-table index from 1 to NSERSIC_TABLE
   // (j is NOT the index over hostlib-sersic profiles)
+  //
+  // Oct 15 2026: fill IBIN_LOOKUP[j] for interp_Sersic_logR
 
-  int    NBIN, ir, MEM ;
+  int    NBIN, ir, MEM, m ;
   double 
     inv_n, xj
     ,logRbin, logRmin, logRmax, logR0, logR1, R0, R1, R
@@ -5452,11 +6456,60 @@ void init_Sersic_integrals(int j) {
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
   }
 
+  // store R/Re bin vs. uniform integral bin so that the R/Re bin
+  // containing a random integral is found without a bin search.
+  MEM  = (NBIN_LOOKUP_SERSIC+1) * sizeof(int) ;
+  SERSIC_TABLE.TABLEMEMORY    += MEM ;
+  SERSIC_TABLE.IBIN_LOOKUP[j]  = (int *)malloc(MEM);
+  ir = 0 ;
+  for ( m=0; m <= NBIN_LOOKUP_SERSIC; m++ ) {
+    FTMP = (double)m / (double)NBIN_LOOKUP_SERSIC ;
+    while ( ir < NBIN-1 && SERSIC_TABLE.INTEG_CUM[j][ir+1] <= FTMP ) 
+      { ir++ ; }
+    SERSIC_TABLE.IBIN_LOOKUP[j][m] = ir ;
+  }
+
   return ;
 
 } // end of init_Sersic_integrals
 
 
+// =======================================
+double interp_Sersic_logR(int j, double FINTEG) {
+
+  // Created Oct 2026
+  // Return log10(R/Re) for which cumulative Sersic integral
+  // INTEG_CUM[j] = FINTEG. Same linear interpolation as 
+  // interp_1DFUN, but the starting R/Re bin is read from 
+  // IBIN_LOOKUP[j] so that only a few bins are scanned.
+  // If lookup table is not defined, or FINTEG is outside the
+  // table range, use interp_1DFUN (which aborts on range error).
+
+  int    NBIN     = SERSIC_TABLE.NBIN_reduced ; 
+  double *INTEG   = SERSIC_TABLE.INTEG_CUM[j] ;
+  double *logR    = SERSIC_TABLE.reduced_logR ;
+  int    m, ir ;
+  double frac ;
+  char fnam[] = "interp_Sersic_logR" ;
+
+  // ------------ BEGIN -------------
+
+  if ( SERSIC_TABLE.IBIN_LOOKUP[j] == NULL || 
+       FINTEG < INTEG[0] || FINTEG > INTEG[NBIN] ) {
+    return interp_1DFUN(1, FINTEG, NBIN+1, INTEG, logR, fnam);
+  }
+
+  m = (int)(FINTEG * (double)NBIN_LOOKUP_SERSIC) ;
+  if ( m > NBIN_LOOKUP_SERSIC ) { m = NBIN_LOOKUP_SERSIC; }
+  ir = SERSIC_TABLE.IBIN_LOOKUP[j][m] ;
+  while ( ir < NBIN-1 && INTEG[ir+1] < FINTEG ) { ir++ ; }
+
+  frac = (FINTEG - INTEG[ir]) / (INTEG[ir+1] - INTEG[ir]) ;
+  return( logR[ir] + frac*(logR[ir+1] - logR[ir]) ) ;
+
+} // end interp_Sersic_logR
+
+
 // =======================================
 double get_Sersic_bn(double n) {
 
@@ -5609,7 +6662,7 @@ double get_VALUE_HOSTLIB(int ivar, int igal) {
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
 
-  if ( ivar >= 0 )  { VALUE = HOSTLIB.VALUE_ZSORTED[ivar][igal] ; }
+  if ( ivar >= 0 )  { VALUE = get_VALUE_ZSORTED_HOSTLIB(ivar,igal) ; }
 
   return(VALUE) ;
 
@@ -5721,6 +6774,41 @@ int IVAR_HOSTLIB_PREFIX(char *prefix, int FLAG) {
   }
 } // end of IVAR_HOSTLIB_PREFIX
 
+bool ISFLOAT32_HOSTLIB(int IVAR) {
+  // Created Oct 2026
+  // return true if stored column IVAR is to be stored as float;
+  // i.e., HOSTLIB_MSKOPT_FLOAT32 is set and IVAR is not one of the
+  // columns needing full precision: GALID, ZTRUE, RA, DEC.
+  if ( (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_FLOAT32) == 0 ) 
+    { return(false); }
+  if ( IVAR == HOSTLIB.IVAR_GALID ) { return(false); }
+  if ( IVAR == HOSTLIB.IVAR_ZTRUE ) { return(false); }
+  if ( IVAR == HOSTLIB.IVAR_RA    ) { return(false); }
+  if ( IVAR == HOSTLIB.IVAR_DEC   ) { return(false); }
+  return(true);
+} // end ISFLOAT32_HOSTLIB
+
+// ========================================
+double get_VALUE_ZSORTED_HOSTLIB(int ivar, int igal) {
+  // Created Oct 2026
+  // Return z-sorted value for stored column ivar, regardless of
+  // double or float storage. No SORTFLAG check here because this
+  // function is called in event loops.
+  if ( HOSTLIB.ISFLOAT32[ivar] ) 
+    { return( (double)HOSTLIB.VALUE32_ZSORTED[ivar][igal] ); }
+  else
+    { return( HOSTLIB.VALUE_ZSORTED[ivar][igal] ); }
+} // end get_VALUE_ZSORTED_HOSTLIB
+
+void set_VALUE_ZSORTED_HOSTLIB(int ivar, int igal, double val) {
+  // Created Oct 2026; store val in double or float array.
+  if ( HOSTLIB.ISFLOAT32[ivar] ) 
+    { HOSTLIB.VALUE32_ZSORTED[ivar][igal] = (float)val ; }
+  else
+    { HOSTLIB.VALUE_ZSORTED[ivar][igal] = val ; }
+} // end set_VALUE_ZSORTED_HOSTLIB
+
+// ========================================
 bool ISCHAR_HOSTLIB(int IVAR) {
   // Feb 25 2020
   // return true if input IVAR corresponds to a string variable.
@@ -5921,6 +7009,7 @@ void GEN_SNHOST_GALID(double ZGEN) {
   //
   // Nov 23 2019: for MODEL_SIMLIB, force GALID to value in SIMLIB header.
   // Dec 30 2021: minor refactor to make igal loops faster with binary search.
+  // Oct 14 2026: check HOSTLIB_MSKOPT_WGTTREE option for weight-tree select.
 
   bool DO_SN2GAL_Z  = (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_SN2GAL_Z);
 
@@ -6125,6 +7214,14 @@ void GEN_SNHOST_GALID(double ZGEN) {
     goto DONE_SELECT_GALID ;
   }
 
+  // Oct 2026: check option for O(log NGAL) weight-tree selection;
+  // if no host is selected here, continue with legacy search.
+  if ( HOSTLIB_WGTTREE.USE && NGROUPID == 0 ) {
+    IGAL_SELECT = GEN_SNHOST_GALID_WGTTREE(ibin_SNVAR, igal_start, igal_end,
+					   FlatRan1_GALID);
+    if ( IGAL_SELECT >= 0 ) { goto DONE_SELECT_GALID ; }
+  }
+
   // ---------------------------------------------------
 
   // perform binary search to restrict igal range to within a few galaxies
@@ -6559,6 +7656,188 @@ void FREEHOST_GALID(int IGAL) {
 
 } // end UNUSE_HOST_GALID
 
+// =========================================
+void init_HOSTLIB_WGTTREE(void) {
+
+  // Created Oct 14 2026
+  // For HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_WGTTREE, build Fenwick tree
+  // (binary indexed tree) of host weights for each SNVAR bin.
+  // Each tree allows weighted host selection within arbitrary 
+  // z-sorted igal window in O(log NGAL), and removal of a used host 
+  // (USEONCE) in O(log NGAL) so that exhausted hosts are never 
+  // scanned. Per-galaxy weights are differences of WGTSUM, so the 
+  // selection probabilities are the same as for the legacy search.
+
+  bool USE_TREE = (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_WGTTREE) > 0 ;
+  int  NGAL     = HOSTLIB.NGAL_STORE ;
+  int  N_SNVAR  = HOSTLIB_WGTMAP.N_SNVAR ;
+  int  NTREE    = HOSTLIB_WGTMAP.NBTOT_SNVAR ;
+  int  MEMD     = (NGAL+1) * sizeof(double);
+  int  ibin, igal, j, POW2 ;
+  double *ptrWGT, *TREE, MEMTOT = 0.0 ;
+  char fnam[] = "init_HOSTLIB_WGTTREE" ;
+
+  // ------------ BEGIN ------------
+
+  HOSTLIB_WGTTREE.USE = false ;
+  if ( !USE_TREE ) { return; }
+
+  if ( NTREE < 1 ) { NTREE = 1; }
+  HOSTLIB_WGTTREE.USE   = true ;
+  HOSTLIB_WGTTREE.NGAL  = NGAL ;
+  HOSTLIB_WGTTREE.NTREE = NTREE ;
+  HOSTLIB_WGTTREE.TREE  = (double**)malloc(NTREE * sizeof(double*) );
+  HOSTLIB_WGTTREE.REMOVED = (char*)malloc(NGAL * sizeof(char) );
+  for(igal=0; igal < NGAL; igal++ ) { HOSTLIB_WGTTREE.REMOVED[igal] = 0; }
+
+  POW2 = 1;
+  while ( 2*POW2 <= NGAL ) { POW2 *= 2; }
+  HOSTLIB_WGTTREE.POW2_NGAL = POW2 ;
+
+  for(ibin=0; ibin < NTREE; ibin++ ) {
+    if ( N_SNVAR > 0 ) 
+      { ptrWGT = HOSTLIB_WGTMAP.WGTSUM_SNVAR[ibin]; }
+    else
+      { ptrWGT = HOSTLIB_WGTMAP.WGTSUM; }
+
+    TREE = (double*)malloc(MEMD);  MEMTOT += (double)MEMD ;
+    HOSTLIB_WGTTREE.TREE[ibin] = TREE ;
+
+    // O(NGAL) build; tree index is fortran-like 1..NGAL
+    TREE[0] = 0.0 ;
+    for(igal=0; igal < NGAL; igal++ ) 
+      { TREE[igal+1] = get_WGT_HOSTLIB_WGTTREE(ptrWGT,igal) ; }
+    for(j=1; j <= NGAL; j++ ) {
+      int jp = j + (j & (-j)) ;
+      if ( jp <= NGAL ) { TREE[jp] += TREE[j]; }
+    }
+  }
+
+  printf("\t %s: %d weight tree(s) for %d hosts (%.2f MB) \n",
+	 fnam, NTREE, NGAL, MEMTOT*1.0E-6 );
+  fflush(stdout);
+
+  return ;
+
+} // end init_HOSTLIB_WGTTREE
+
+// =========================================
+double get_WGT_HOSTLIB_WGTTREE(double *ptrWGTSUM, int igal) {
+  // Created Oct 2026
+  // Return weight of igal from cumulative weight-sum array.
+  if ( igal == 0 ) 
+    { return ptrWGTSUM[0]; }
+  else
+    { return ptrWGTSUM[igal] - ptrWGTSUM[igal-1]; }
+} // end get_WGT_HOSTLIB_WGTTREE
+
+// =========================================
+double sumWgt_HOSTLIB_WGTTREE(int ibin, int igal) {
+
+  // Created Oct 2026
+  // Return sum of remaining weights for galaxies 0 to igal (inclusive).
+  // igal < 0 returns zero.
+
+  double *TREE = HOSTLIB_WGTTREE.TREE[ibin];
+  double SUM  = 0.0 ;
+  int    j ;
+  for ( j = igal+1; j > 0; j -= (j & (-j)) ) { SUM += TREE[j]; }
+  return SUM ;
+
+} // end sumWgt_HOSTLIB_WGTTREE
+
+// =========================================
+int select_HOSTLIB_WGTTREE(int ibin, double WGT_TARGET) {
+
+  // Created Oct 2026
+  // Return smallest igal for which remaining weight-sum 
+  // through igal exceeds WGT_TARGET (standard Fenwick descent).
+
+  double *TREE = HOSTLIB_WGTTREE.TREE[ibin];
+  int    NGAL  = HOSTLIB_WGTTREE.NGAL ;
+  int    STEP, j = 0 ;
+
+  for ( STEP = HOSTLIB_WGTTREE.POW2_NGAL; STEP > 0; STEP /= 2 ) {
+    if ( j+STEP <= NGAL && TREE[j+STEP] <= WGT_TARGET ) 
+      { j += STEP;  WGT_TARGET -= TREE[j];  }
+  }
+
+  // j is fortran-like index of last galaxy with sum <= target,
+  // which is the C-like index of the selected galaxy.
+  if ( j >= NGAL ) { j = NGAL-1; }
+  return j ;
+
+} // end select_HOSTLIB_WGTTREE
+
+// =========================================
+void remove_HOSTLIB_WGTTREE(int IGAL) {
+
+  // Created Oct 2026
+  // Remove IGAL from all weight trees so that it cannot be 
+  // selected again (for USEONCE option).
+
+  int  N_SNVAR = HOSTLIB_WGTMAP.N_SNVAR ;
+  int  NGAL    = HOSTLIB_WGTTREE.NGAL ;
+  int  ibin, j ;
+  double WGT, *ptrWGT, *TREE ;
+
+  // --------- BEGIN ----------
+
+  if ( IGAL < 0 || IGAL >= NGAL )        { return; }
+  if ( HOSTLIB_WGTTREE.REMOVED[IGAL] )  { return; }
+  HOSTLIB_WGTTREE.REMOVED[IGAL] = 1 ;
+
+  for(ibin=0; ibin < HOSTLIB_WGTTREE.NTREE; ibin++ ) {
+    if ( N_SNVAR > 0 ) 
+      { ptrWGT = HOSTLIB_WGTMAP.WGTSUM_SNVAR[ibin]; }
+    else
+      { ptrWGT = HOSTLIB_WGTMAP.WGTSUM; }
+
+    WGT  = get_WGT_HOSTLIB_WGTTREE(ptrWGT, IGAL);
+    TREE = HOSTLIB_WGTTREE.TREE[ibin];
+    for ( j = IGAL+1; j <= NGAL; j += (j & (-j)) ) { TREE[j] -= WGT; }
+  }
+
+  return ;
+
+} // end remove_HOSTLIB_WGTTREE
+
+// =========================================
+int GEN_SNHOST_GALID_WGTTREE(int ibin, int igal_start, int igal_end, 
+			     double FlatRan) {
+
+  // Created Oct 2026
+  // Use weight tree to select random host between igal_start and 
+  // igal_end. Return selected IGAL, or -9 if there is no remaining
+  // weight or if USEHOST_GALID rejects the host (e.g., MINDAYSEP);
+  // for -9, caller falls back to legacy search.
+
+  double WGT0, WGT1, WGT_TARGET ;
+  int    IGAL ;
+
+  // --------- BEGIN ----------
+
+  if ( ibin < 0 ) { ibin = 0; }
+
+  WGT0 = sumWgt_HOSTLIB_WGTTREE(ibin, igal_start-1);
+  WGT1 = sumWgt_HOSTLIB_WGTTREE(ibin, igal_end);
+  if ( WGT1 - WGT0 <= 0.0 ) { return -9; }
+
+  WGT_TARGET = WGT0 + FlatRan * (WGT1-WGT0);
+  IGAL       = select_HOSTLIB_WGTTREE(ibin, WGT_TARGET);
+
+  // protect against round-off at window edges
+  if ( IGAL < igal_start ) { IGAL = igal_start; }
+  if ( IGAL > igal_end   ) { IGAL = igal_end;   }
+
+  if ( USEHOST_GALID(IGAL) == 0 ) { return -9; }
+
+  if ( SAMEHOST.REUSE_FLAG == 0 ) { remove_HOSTLIB_WGTTREE(IGAL); }
+
+  return IGAL ;
+
+} // end GEN_SNHOST_GALID_WGTTREE
+
 // =========================================
 void GEN_SNHOST_ZPHOT(int IGAL) {
 
@@ -7383,6 +8662,8 @@ void GEN_SNHOST_POS(int IGAL) {
   // Aug 21 2023:
   //   for LSN2GAL_RADEC, also set GENLC.RA[DEC]_OBS_AVG
   //
+  // Oct 15 2026: use interp_Sersic_logR instead of interp_1DFUN
+  //
 
   // strip off user options passed via sim-input file
   int LSN2GAL = ( INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_SN2GAL_RADEC ) ;
@@ -7392,7 +8673,7 @@ void GEN_SNHOST_POS(int IGAL) {
   int IVAR_ANGLE  = HOSTLIB.IVAR_ANGLE ;
   double RAD       = RADIAN ;
 
-  int  j, JPROF, k_table, NBIN ;
+  int  j, JPROF, k_table ;
 
   double 
     RA_GAL, DEC_GAL
@@ -7400,7 +8681,7 @@ void GEN_SNHOST_POS(int IGAL) {
     ,reduced_logR0, reduced_logR1, reduced_logR, reduced_R
     ,Ran0, Ran1, WGT, RanInteg, dif, bin, fbin
     ,a, b, a_half, b_half, a_rot, n, inv_n, DTMP, COSDEC, SNSEP, DLR    
-    ,*ptr, *ptr_r, *ptr_integ0, *ptr_integ1
+    ,*ptr
     ;
 
   int  DEBUG_MODE_SIMLIB = 0 ;
@@ -7521,15 +8802,9 @@ void GEN_SNHOST_POS(int IGAL) {
   RanInteg    = MNINTFLUX +  Ran1 * (MXINTFLUX - MNINTFLUX) ;
 
   if ( RanInteg > 0.0 ) {
-    ptr_r       = SERSIC_TABLE.reduced_logR ;  
-    ptr_integ0  = SERSIC_TABLE.INTEG_CUM[k_table] ;
-    ptr_integ1  = SERSIC_TABLE.INTEG_CUM[k_table+1] ;
-    NBIN        = NBIN_RADIUS_SERSIC + 1 ;
-
-    reduced_logR0  = interp_1DFUN(1, RanInteg, NBIN, ptr_integ0, ptr_r, 
-				  "reduced_logR0" );
-    reduced_logR1  = interp_1DFUN(1, RanInteg, NBIN, ptr_integ1, ptr_r, 
-				  "reduced_logR1" );
+    // O(1) table lookup (Oct 2026)
+    reduced_logR0  = interp_Sersic_logR(k_table,   RanInteg);
+    reduced_logR1  = interp_Sersic_logR(k_table+1, RanInteg);
     // interpolate integral tables in 1/n space
     dif  = inv_n -  1./SERSIC_TABLE.n[k_table] ;
     fbin = dif/bin ;		
@@ -8227,8 +9502,8 @@ void GEN_SNHOST_DDLR(int i_nbr) {
   // check option to use specialized a_DLR, b_DLR for DLR calculation 
   // (Helen Qu, 1/25/2022)
   if (HOSTLIB.IVAR_a_DLR > 0) {
-    a_half = HOSTLIB.VALUE_ZSORTED[HOSTLIB.IVAR_a_DLR][IGAL]; 
-    b_half = HOSTLIB.VALUE_ZSORTED[HOSTLIB.IVAR_b_DLR][IGAL]; 
+    a_half = get_VALUE_ZSORTED_HOSTLIB(HOSTLIB.IVAR_a_DLR,IGAL); 
+    b_half = get_VALUE_ZSORTED_HOSTLIB(HOSTLIB.IVAR_b_DLR,IGAL); 
   }
 
   // Jun 21 2022 RK - check option to PSF-smear a,b 
@@ -9033,7 +10308,7 @@ void GEN_SNHOST_GALMAG(int IGAL) {
       sprintf(cfilt,"%c", FILTERSTRING[ifilt_obs] );
 
       if ( IVAR >= 0 ) {
-	MAGOBS_LIB = HOSTLIB.VALUE_ZSORTED[IVAR][IGAL] ; 
+	MAGOBS_LIB = get_VALUE_ZSORTED_HOSTLIB(IVAR,IGAL) ; 
 	MAGOBS     = MAGOBS_LIB + MWXT[ifilt_obs] ; // dim  with Gal extinction
       }
       else {
@@ -9332,7 +10607,7 @@ void  STORE_SNHOST_MISC(int IGAL, int ibin_SNVAR) {
     if ( HOSTLIB_WGTMAP.IS_SNVAR[ivar] ) 
       { VAL = -999.0 ; }    
     else 
-      { VAL = HOSTLIB.VALUE_ZSORTED[IVAR_STORE][IGAL]; }
+      { VAL = get_VALUE_ZSORTED_HOSTLIB(IVAR_STORE,IGAL); }
     SNHOSTGAL.WGTMAP_VALUES[ivar] = VAL ;
   }
 
@@ -9362,14 +10637,14 @@ void LOAD_OUTVAR_HOSTLIB(int IGAL) {
 
   for(ivar=0; ivar < NVAR_OUT; ivar++ ) {
     IVAR_STORE = HOSTLIB_OUTVAR_EXTRA.IVAR_STORE[ivar] ;
-    DVAL       = HOSTLIB.VALUE_ZSORTED[IVAR_STORE][IGAL] ;
+    DVAL       = get_VALUE_ZSORTED_HOSTLIB(IVAR_STORE,IGAL) ;
     HOSTLIB_OUTVAR_EXTRA.VALUE[ivar][0] = DVAL ;   
 
     i_NBR    = 1; 
     HOSTLIB_OUTVAR_EXTRA.VALUE[ivar][i_NBR] = NULLDOUBLE ;
     if ( NNBR > 1 ) {
       IGAL_NBR = SNHOSTGAL.IGAL_NBR_LIST[i_NBR];
-      DVAL     = HOSTLIB.VALUE_ZSORTED[IVAR_STORE][IGAL_NBR] ;
+      DVAL     = get_VALUE_ZSORTED_HOSTLIB(IVAR_STORE,IGAL_NBR) ;
       HOSTLIB_OUTVAR_EXTRA.VALUE[ivar][i_NBR] = DVAL ;
       
       //	   printf("xxx %s: IGAL_NBR = %d, %s = %f\n", 
@@ -9430,7 +10705,7 @@ double modelPar_from_SNHOST(double PARVAL_ORIG, char *PARNAME) {
 
   if ( IVAR > 0 ) {
     IGAL        = SNHOSTGAL.IGAL ;
-    PARVAL_OUT  = HOSTLIB.VALUE_ZSORTED[IVAR][IGAL] ;
+    PARVAL_OUT  = get_VALUE_ZSORTED_HOSTLIB(IVAR,IGAL) ;
   }
 
 
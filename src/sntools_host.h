@@ -28,6 +28,14 @@
  
  Aug 11 2023: MXROW_HOSTLIB -> 40M (was 10M)
  Oct 03 2023: MXROW_HOSTLIB -> 60M
+ Oct 14 2026: add HOSTLIB_BINARY_HEADER_DEF and HOSTLIB_BINARY for
+              mmap of pre-processed binary HOSTLIB image.
+ Oct 14 2026: add HOSTLIB_WGTTREE for weight-tree host selection.
+ Oct 15 2026: add HOSTLIB_THREAD_DEF for multi-threaded GAL-row parsing.
+ Oct 15 2026: HOSTLIB_MSKOPT += 131072 -> store non-critical columns 
+              as float (VALUE32_ZSORTED).
+ Oct 15 2026: add HOSTLIB_WGTCACHE_HEADER_DEF to cache per-galaxy WGTMAP
+              weights & SN mag shifts next to binary HOSTLIB image.
 
 ==================================================== */
 
@@ -49,6 +57,8 @@
 #define HOSTLIB_MSKOPT_PLUSMAGS   8192  // compute & add host mags from SED
 #define HOSTLIB_MSKOPT_PLUSNBR   16384  // append list of nbr to HOSTLIB
 #define HOSTLIB_MSKOPT_ZPHOT_QGAUSS 32768  // write Gauss quantiles for zPHOT
+#define HOSTLIB_MSKOPT_WGTTREE    65536  // weight-tree host select (Oct 2026)
+#define HOSTLIB_MSKOPT_FLOAT32   131072  // float storage except GALID,z,RA,DEC
 
 #define HOSTLIB_FLAG_USE      1   // for INPUTS.HOSTLIB_USE
 #define HOSTLIB_FLAG_REWRITE  2   // for INPUTS.HOSTLIB_USE
@@ -76,6 +86,7 @@
 #define NBIN_RADIUS_SERSIC  200    // Number of R/Re bins to store integrals
 #define MAXRADIUS_SERSIC   100.0   // max R/Re value for integ table
 #define MINRADIUS_SERSIC  1.0E-4   // min R/Re value for integ table
+#define NBIN_LOOKUP_SERSIC 1000   // uniform integral bins for R/Re lookup
 
 #define NRBIN_GALMAG        100    // No. of radius bins for Galmag 
 #define NTHBIN_GALMAG        36    // No. theta bins for galmag
@@ -212,6 +223,8 @@ struct HOSTLIB_DEF {
 
   // define pointers used to malloc memory with MALLOCSIZE_HOSTLIB
   double *VALUE_ZSORTED[MXVAR_HOSTLIB];  // sorted by redshift
+  float  *VALUE32_ZSORTED[MXVAR_HOSTLIB]; // idem if ISFLOAT32 (Oct 2026)
+  bool    ISFLOAT32[MXVAR_HOSTLIB];       // true -> stored as float
   double *VALUE_UNSORTED[MXVAR_HOSTLIB]; // same order as in HOSTLIB
   int    *LIBINDEX_UNSORT;    // map between z-sorted and unsorted (w/cuts)
   int    *LIBINDEX_ZSORT;     // inverse map 
@@ -347,6 +360,56 @@ struct {
   double ZWIN[2], RAWIN[2], DECWIN[2];
 } HOSTLIB_CUTS;
 
+// Oct 2026: binary image of cut + z-sorted HOSTLIB for mmap
+#define MAGIC_BINARY_HOSTLIB       "SNANA_HOSTLIB_BINARY_V1"
+#define MXCHAR_SIGNATURE_HOSTLIB   (MXVAR_HOSTLIB*42 + 2*MXPATHLEN)
+
+typedef struct {
+  char   MAGIC[32];
+  int    NCHAR_SIGNATURE ; // padded length of signature after header
+  int    NVAR_STORE, NGAL_STORE, NGAL_READ, NSTAR, DO_FIELD ;
+  double ZMIN, ZMAX, ZGAPMAX, ZGAPAVG, Z_ATGAPMAX[2] ;
+  double VPEC_RMS, VPEC_AVG, VPEC_MIN, VPEC_MAX ;
+  long long NBYTE_TOTAL ;  // size of image file (truncation check)
+} HOSTLIB_BINARY_HEADER_DEF ;
+
+struct {
+  char   *ADDR ;   // start of mmap'ed image (NULL if not used)
+  size_t NBYTE ;   // size of mapping
+} HOSTLIB_BINARY ;
+
+// Oct 2026: cache of per-galaxy WGTMAP results [HOSTLIB_BINARY_FILE].WGTMAP
+// Each SNVAR bin has its own key so that only bins with modified
+// WGTMAP rows are re-interpolated.
+#define MAGIC_WGTCACHE_HOSTLIB   "SNANA_HOSTLIB_WGTCACHE_V1"
+#define SUFFIX_WGTCACHE_HOSTLIB  "WGTMAP"
+
+typedef struct {
+  char   MAGIC[32];
+  int    NGAL, NBTOT_SNVAR ;
+  unsigned long long KEY_GLOBAL ; // HOSTLIB signature + WGTMAP grid/options
+  double WGTMAX ;                 // normalization used for WGTSUM
+  long long NBYTE_TOTAL ;         // size of cache file (truncation check)
+} HOSTLIB_WGTCACHE_HEADER_DEF ;
+
+
+// Oct 2026: per-thread output of chunked (multi-threaded) GAL-row parsing.
+// Only rows passing cuts are kept, and only the stored columns.
+#define MXTHREAD_HOSTLIB 64
+
+typedef struct {
+  int    ITHREAD ;
+  char   *PTR_START, *PTR_END ; // byte range of HOSTLIB (newline aligned)
+  int    NREAD, NKEEP, MXKEEP ; // number read, number kept, malloc size
+  int    *IREAD_KEEP ;          // read-index (within chunk) for each kept row
+  double *VALUES ;              // [NKEEP*NVAR_STORE] stored columns
+  char   (*FIELD)[MXCHAR_FIELDNAME+1] ; // optional FIELD per kept row
+  char   **NBR_LIST ;           // optional NBR_LIST per kept row
+  int    NSTAR, NERR_NAN ;      // diagnostics summed after threads finish
+} HOSTLIB_THREAD_DEF ;
+
+bool ISMAGOBS_HOSTLIB[MXVAR_HOSTLIB]; // true -> apply ABMAG_FORCE/OFFSET
+
 
 struct SAMEHOST_DEF {
   int REUSE_FLAG ;          // 1-> re-use host
@@ -397,6 +460,10 @@ struct SERSIC_TABLE_DEF {
 
   int  BIN_HALFINTEGRAL[NSERSIC_TABLE+1]; // bin where integral is total/2
 
+  // Oct 2026: for each uniform integral bin m (integral = m/NBIN_LOOKUP),
+  // largest R/Re bin with INTEG_CUM <= integral; gives O(1) search
+  int *IBIN_LOOKUP[NSERSIC_TABLE+1];
+
   int  NBIN_reduced ;  // number of reduced R/Re bins
   double *reduced_logR ;     // list of R/Re upper-interal limit
   double  reduced_logRmax ;  // max R/Re in table
@@ -470,6 +537,16 @@ struct HOSTLIB_WGTMAP_DEF {
 
 } HOSTLIB_WGTMAP ;
 
+// Oct 2026: Fenwick tree of host weights for fast selection and
+// removal of used hosts (HOSTLIB_MSKOPT_WGTTREE)
+struct {
+  bool    USE ;
+  int     NGAL, NTREE ;  // NTREE = NBTOT_SNVAR
+  int     POW2_NGAL ;    // largest power of 2 <= NGAL
+  double **TREE ;        // [ibin][1..NGAL] partial weight sums
+  char   *REMOVED ;      // [igal] 1 -> removed from tree
+} HOSTLIB_WGTTREE ;
+
 
 
 typedef struct { 
@@ -686,6 +763,13 @@ void   GEN_DDLR_STRONGLENS(int IMGNUM);
 void   GEN_SNHOST_PROPERTY(int ivar_property); 
 int    USEHOST_GALID(int IGAL) ;
 void   FREEHOST_GALID(int IGAL) ;
+void   init_HOSTLIB_WGTTREE(void);
+double get_WGT_HOSTLIB_WGTTREE(double *ptrWGTSUM, int igal);
+double sumWgt_HOSTLIB_WGTTREE(int ibin, int igal);
+int    select_HOSTLIB_WGTTREE(int ibin, double WGT_TARGET);
+void   remove_HOSTLIB_WGTTREE(int IGAL);
+int    GEN_SNHOST_GALID_WGTTREE(int ibin, int igal_start, int igal_end,
+				double FlatRan);
 void   checkAbort_noHOSTLIB(void) ;
 void   checkAbort_HOSTLIB(void) ;
 
@@ -713,6 +797,13 @@ void   checkModel_HOSTLIB_WGTMAP(int NMODEL, int *MODEL_LIST, char *varName,
 
 void   runCheck_HOSTLIB_WGTMAP(void);
 void   malloc_HOSTLIB_WGTMAP(void); 
+unsigned long long hash_HOSTLIB(unsigned long long HASH, void *PTR, 
+				size_t NBYTE);
+int    key_WGTCACHE_HOSTLIB(int IGAL_START, int IGAL_END, 
+			    unsigned long long *KEY_GLOBAL, 
+			    unsigned long long *KEY_BIN);
+int    read_WGTCACHE_HOSTLIB(int IGAL_START, int IGAL_END, bool *DO_BIN);
+void   write_WGTCACHE_HOSTLIB(int IGAL_START, int IGAL_END);
 void   malloc_HOSTGAL_PROPERTY(void);
 int    getindex_HOSTGAL_PROPERTY(char *PROPERTY);
 // xxx mark double get_VALUE_HOSTGAL_PROPERTY(char *PROPERTY, char *WHICH); 
@@ -734,7 +825,16 @@ void   read_gal_HOSTLIB(FILE *fp);
 void   read_galRow_HOSTLIB(FILE *fp, int nval, double *values, 
 			   char *field, char *nbr_list  );
 void   check_redshift_HOSTLIB(void);
-int    passCuts_HOSTLIB(double *xval);
+void   init_cuts_HOSTLIB(void);
+bool   use_binary_HOSTLIB(void);
+void   get_signature_binary_HOSTLIB(char *SIGNATURE);
+void   write_binary_HOSTLIB(void);
+int    read_binary_HOSTLIB(void);
+int    passCuts_HOSTLIB(double *xval, int *NSTAR);
+void   parse_galRow_HOSTLIB(char *LINE, int NVAL, double *VALUES, 
+			    char *FIELD, char *NBR_LIST, int *NERR_NAN);
+int    read_gal_HOSTLIB_THREADS(int NTHREAD);
+void  *read_galThread_HOSTLIB(void *arg);
 void   summary_snpar_HOSTLIB(void) ;
 void   malloc_HOSTLIB(int NGAL_STORE, int NGAL_READ);
 void   sortz_HOSTLIB(void);
@@ -754,6 +854,7 @@ void   Sersic_names(int j, char *a, char *b, char *w, char *n);
 void   get_Sersic_info(int IGAL, SERSIC_DEF *SERSIC) ;
 void   test_Sersic_interp(void);
 double get_Sersic_bn(double n);
+double interp_Sersic_logR(int j, double FINTEG);
 void   init_OUTVAR_HOSTLIB(void) ;
 void   LOAD_OUTVAR_HOSTLIB(int IGAL) ;
 void   append_HOSTLIB_STOREPAR(void);
@@ -770,6 +871,9 @@ bool   ISCHAR_HOSTLIB(int IVAR);
 long long get_GALID_HOSTLIB(int igal);
 double get_ZTRUE_HOSTLIB(int igal);
 double get_VALUE_HOSTLIB(int ivar, int igal);
+double get_VALUE_ZSORTED_HOSTLIB(int ivar, int igal);
+void   set_VALUE_ZSORTED_HOSTLIB(int ivar, int igal, double val);
+bool   ISFLOAT32_HOSTLIB(int IVAR);
 double get_GALFLUX_HOSTLIB(double a, double b);
 
 double interp_GALMAG_HOSTLIB(int ifilt_obs, double PSF ); 
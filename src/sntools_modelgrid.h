@@ -8,6 +8,8 @@
  Mar 16, 2016: add IFILTOBS[ifilt]
  Aug 27, 2017:  NON1A_NAME -> 200 chars instead of 40
  Sep 15, 2027:  MXGRIDGEN-> 500 (was 200)
+ Oct 15, 2026:  add GRIDGEN_BLOCK for block writes & NTHREAD workers
+ Oct 15, 2026:  add OPTMASK_SNGRID_MMAP for memory-mapped I2 arrays
 
 **************/
 
@@ -131,6 +133,18 @@ int OPT_SNOOPY_FLUXPACK ;
 
 int NROW_WRITE_TOT ;
 
+// Oct 2026: buffer to write NLC_BLOCK_GRIDGEN light curves per FITS
+// write; for NTHREAD workers, blocks are written to a binary file
+// and copied to the FITS file by merge_GRIDthreads.
+#define NLC_BLOCK_GRIDGEN  2000
+struct {
+  int    NLC ;             // number of LCs in buffer
+  int    ILC_FIRST ;       // ilc of first LC in buffer
+  short *I2MAG, *I2ERR ;   // [NLC_BLOCK_GRIDGEN * NWD_I2GRIDGEN]
+  int    ITHREAD ;         // -1 for parent; >=0 for worker
+  FILE  *FP_THREAD ;       // worker output for I2 blocks
+} GRIDGEN_BLOCK ;
+
 // ==========================
 
 
@@ -151,6 +165,9 @@ void   wrhead_GRIDfile_text(void);
 void   wrhead_GRIDfile_fits(void);
 void   append_GRIDfile_text(void);
 void   append_GRIDfile_fits(void);
+void   flush_GRIDfile_fits(void);
+void   write_GRIDblock_fits(int ILC_FIRST, int NLC, short *I2MAG, short *I2ERR);
+void   merge_GRIDthreads(int NTHREAD, char *GRIDGEN_FILE);
 
 void   end_GRIDfile(void);
 void   get_GRIDKEY(void) ;
@@ -159,9 +176,23 @@ int    SNTYPE_GRIDGEN(void);
 void   load_EXTNAME_GRIDGEN(void);  // load EXTNAME_GRIDGEN array
 
 // read back utils
+#define OPTMASK_SNGRID_VERBOSE  1  // fits_read_SNGRID option: verbose
+#define OPTMASK_SNGRID_MMAP     2  // idem: mmap I2 arrays from .I2MMAP file
+#define SUFFIX_SNGRID_MMAP  "I2MMAP"  // [sngridFile].I2MMAP
+#define MAGIC_SNGRID_MMAP   20261015
+
+typedef struct {
+  int       MAGIC, IVERSION ;
+  int       NWD ;                     // number of I2 words per array
+  int       PAD ;
+  long long FITS_SIZE, FITS_MTIME ;   // to check if FITS file changed
+} SNGRID_MMAP_HEAD_DEF ;
+
 void   load_EXTNAME_GRIDREAD(int IVERSION); // idem for different ifdef 
 void   fits_read_SNGRID(int OPTMASK, char *sngridFile, 
 			SNGRID_DEF *SNGRID); 
+int    mmap_I2_SNGRID(char *sngridFile, int NWD, SNGRID_DEF *SNGRID);
+int    write_mmap_I2_SNGRID(char *sngridFile, int NWD, SNGRID_DEF *SNGRID);
 
 void   check_fitserror(char *comment, int status);
 
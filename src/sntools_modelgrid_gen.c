@@ -35,6 +35,11 @@
 
      HISTORY
 
+ Oct 15 2026: 
+   + FITS output is written in blocks of NLC_BLOCK_GRIDGEN light curves
+     instead of one fits_write_col per light curve.
+   + new merge_GRIDthreads to combine I2 blocks from NTHREAD workers
+     (see fork_GRIDthreads in snlc_sim.c).
 
 *********************************/
 
@@ -342,6 +347,15 @@ void init0_GRIDsource(void) {
   SNGRID_WRITE.PTR_GRIDGEN_LC  = 
     (int   *)malloc(4*SNGRID_WRITE.NGRIDGEN_LC+8);
 
+  // buffer for block writes (Oct 2026)
+  int MEMBLOCK = sizeof(short) * NLC_BLOCK_GRIDGEN * SNGRID_WRITE.NWD_I2GRIDGEN;
+  GRIDGEN_BLOCK.NLC       = 0 ;
+  GRIDGEN_BLOCK.ILC_FIRST = 0 ;
+  GRIDGEN_BLOCK.ITHREAD   = -1 ;
+  GRIDGEN_BLOCK.FP_THREAD = NULL ;
+  GRIDGEN_BLOCK.I2MAG     = (short *)malloc(MEMBLOCK);
+  GRIDGEN_BLOCK.I2ERR     = (short *)malloc(MEMBLOCK);
+
   // total size include 2 2-bytes words (MAG + ERR),
   // hence the factor of 4 for each LC point.
   SNGRID_WRITE.SIZEOF_GRIDGEN = 
@@ -1363,34 +1377,151 @@ void update_GRIDarrays(void) {
 // ******************************
 void append_GRIDfile_fits(void) {
 
-  int ilc, colnum, firstrow, firstelem, nrow, istat ;
+  // Oct 15 2026: copy LC to block buffer; buffer is written to
+  //   FITS file by flush_GRIDfile_fits when full, or if next ilc
+  //   is not contiguous with buffer.
+
+  int ilc, nrow, ioff ;
+  int MEMLC = SNGRID_WRITE.NWD_I2GRIDGEN * sizeof(short);
   //  char fnam[] = "append_GRIDfile_fits";
 
   // -------------- BEGIN --------------
 
-  istat     = 0;
   ilc       = GENLC.CID;
-  firstelem = 1 ;  
-  firstrow  = SNGRID_WRITE.PTR_GRIDGEN_LC[ilc];
   nrow      = SNGRID_WRITE.NWD_I2GRIDGEN ;
 
   NROW_WRITE_TOT += nrow ;
 
+  if ( GRIDGEN_BLOCK.NLC > 0 && 
+       ilc != GRIDGEN_BLOCK.ILC_FIRST + GRIDGEN_BLOCK.NLC ) 
+    { flush_GRIDfile_fits(); }
+
+  if ( GRIDGEN_BLOCK.NLC == 0 ) { GRIDGEN_BLOCK.ILC_FIRST = ilc; }
+
+  ioff = GRIDGEN_BLOCK.NLC * nrow ;
+  memcpy(&GRIDGEN_BLOCK.I2MAG[ioff], SNGRID_WRITE.I2GRIDGEN_LCMAG, MEMLC);
+  memcpy(&GRIDGEN_BLOCK.I2ERR[ioff], SNGRID_WRITE.I2GRIDGEN_LCERR, MEMLC);
+  GRIDGEN_BLOCK.NLC++ ;
+
+  if ( GRIDGEN_BLOCK.NLC == NLC_BLOCK_GRIDGEN ) { flush_GRIDfile_fits(); }
+
+}  // append_GRIDfile_fits
+
+
+// ******************************
+void flush_GRIDfile_fits(void) {
+
+  // Created Oct 2026
+  // Write buffered light curves: to FITS file for parent, or to
+  // binary block file for NTHREAD worker. 
+  // Block format for worker is ILC_FIRST, NLC, I2MAG[], I2ERR[].
+
+  int NLC  = GRIDGEN_BLOCK.NLC ;
+  int ILC  = GRIDGEN_BLOCK.ILC_FIRST ;
+  int NWD  = NLC * SNGRID_WRITE.NWD_I2GRIDGEN ;
+  FILE *fp = GRIDGEN_BLOCK.FP_THREAD ;
+
+  // -------------- BEGIN --------------
+
+  if ( NLC == 0 ) { return; }
+
+  if ( GRIDGEN_BLOCK.ITHREAD >= 0 ) {
+    fwrite(&ILC, sizeof(int), 1, fp);
+    fwrite(&NLC, sizeof(int), 1, fp);
+    fwrite(GRIDGEN_BLOCK.I2MAG, sizeof(short), NWD, fp);
+    fwrite(GRIDGEN_BLOCK.I2ERR, sizeof(short), NWD, fp);
+  }
+  else {
+    write_GRIDblock_fits(ILC, NLC, GRIDGEN_BLOCK.I2MAG, GRIDGEN_BLOCK.I2ERR);
+  }
+
+  GRIDGEN_BLOCK.NLC = 0 ;
+
+} // end flush_GRIDfile_fits
+
+
+// ******************************
+void write_GRIDblock_fits(int ILC_FIRST, int NLC, short *I2MAG, short *I2ERR) {
+
+  // Created Oct 2026 (moved from append_GRIDfile_fits)
+  // Write NLC contiguous light curves starting at ILC_FIRST.
+
+  int colnum, firstrow, firstelem, nrow, istat ;
+
+  // -------------- BEGIN --------------
+
+  istat     = 0;
+  firstelem = 1 ;  
+  firstrow  = SNGRID_WRITE.PTR_GRIDGEN_LC[ILC_FIRST];
+  nrow      = NLC * SNGRID_WRITE.NWD_I2GRIDGEN ;
+
   colnum    = 1 ;  
   fits_write_col(fp_GRIDGEN_FITS, TSHORT, colnum, firstrow, firstelem, nrow,
-		 SNGRID_WRITE.I2GRIDGEN_LCMAG, &istat);
-  sprintf(BANNER,"fits_write_tbl for I2MAG and ilc = %d", ilc );
+		 I2MAG, &istat);
+  sprintf(BANNER,"fits_write_tbl for I2MAG and ilc = %d-%d", 
+	  ILC_FIRST, ILC_FIRST+NLC-1 );
   check_fitserror(BANNER, istat) ;
 
-
   colnum    = 2 ;  
   fits_write_col(fp_GRIDGEN_FITS, TSHORT, colnum, firstrow, firstelem, nrow,
-		 SNGRID_WRITE.I2GRIDGEN_LCERR, &istat);
-  sprintf(BANNER,"fits_write_tbl for I2ERR and ilc = %d", ilc );
+		 I2ERR, &istat);
+  sprintf(BANNER,"fits_write_tbl for I2ERR and ilc = %d-%d", 
+	  ILC_FIRST, ILC_FIRST+NLC-1 );
   check_fitserror(BANNER, istat) ;
 
+} // end write_GRIDblock_fits
 
-}  // append_GRIDfile_fits
+
+// ******************************
+void merge_GRIDthreads(int NTHREAD, char *GRIDGEN_FILE) {
+
+  // Created Oct 2026
+  // Called by parent after NTHREAD GRIDGEN workers are done.
+  // Copy I2 blocks from each worker file ([GRIDGEN_FILE]_THREADnn)
+  // into FITS file, then remove worker file.
+
+  int  ithread, ILC_FIRST, NLC, NWD, NBLOCK=0 ;
+  char THREAD_FILE[MXPATHLEN];
+  FILE *fp;
+  char fnam[] = "merge_GRIDthreads" ;
+
+  // -------------- BEGIN --------------
+
+  for(ithread=0; ithread < NTHREAD; ithread++ ) {
+    sprintf(THREAD_FILE,"%s_%s%2.2d", 
+	    GRIDGEN_FILE, SUFFIX_SIMTHREAD, ithread);
+    fp = fopen(THREAD_FILE, "rb");
+    if ( !fp ) {
+      sprintf(c1err,"Could not open worker grid file");
+      sprintf(c2err,"%s", THREAD_FILE);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+    }
+
+    while ( fread(&ILC_FIRST, sizeof(int), 1, fp) == 1 ) {
+      fread(&NLC, sizeof(int), 1, fp);
+      if ( NLC < 1 || NLC > NLC_BLOCK_GRIDGEN ) {
+	sprintf(c1err,"Invalid NLC=%d for ILC_FIRST=%d", NLC, ILC_FIRST);
+	sprintf(c2err,"in %s", THREAD_FILE);
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+      }
+      NWD = NLC * SNGRID_WRITE.NWD_I2GRIDGEN ;
+      fread(GRIDGEN_BLOCK.I2MAG, sizeof(short), NWD, fp);
+      fread(GRIDGEN_BLOCK.I2ERR, sizeof(short), NWD, fp);
+      write_GRIDblock_fits(ILC_FIRST, NLC, 
+			   GRIDGEN_BLOCK.I2MAG, GRIDGEN_BLOCK.I2ERR);
+      NROW_WRITE_TOT += NWD ;
+      NBLOCK++ ;
+    }
+
+    fclose(fp);
+    remove(THREAD_FILE);
+  }
+
+  printf("\t %s: copied %d blocks from %d workers\n", 
+	 fnam, NBLOCK, NTHREAD);
+  fflush(stdout);
+
+} // end merge_GRIDthreads
 
 // ******************************
 void append_GRIDfile_text(void) {
@@ -1509,6 +1640,7 @@ void end_GRIDfile(void) {
   if ( OPT_GRIDGEN_FORMAT == OPT_GRIDGEN_FORMAT_TEXT ) 
     { fclose(fp_GRIDGEN_TEXT); }
   else if ( OPT_GRIDGEN_FORMAT == OPT_GRIDGEN_FORMAT_FITS ) {
+    flush_GRIDfile_fits(); // write remaining buffer
     istat = 0;
     fits_close_file(fp_GRIDGEN_FITS, &istat);
     check_fitserror("close fits file", istat) ;
@@ -35,12 +35,20 @@
 
      HISTORY
 
+ Oct 15 2026: 
+   OPTMASK_SNGRID_MMAP option for fits_read_SNGRID: I2 mag & error
+   arrays are memory-mapped (read-only, shared by all jobs on a node)
+   from binary file [sngridFile].I2MMAP, which is created from the
+   FITS file on first use.
 
 ***************/
 
 #include "sntools.h"      // general snana stuff
 #include "fitsio.h"
 #include "sntools_modelgrid.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
 
 #define ITYPE_PEC1A  11
 #define ITYPE_MODEL  12
@@ -84,10 +92,13 @@ void fits_read_SNGRID(int OPTMASK, char *sngridFile,
   //
   //
   // Aug 12 2016: check for PEC1A
+  // Oct 15 2026: 
+  //   bit2 (OPTMASK_SNGRID_MMAP) : mmap I2 arrays from binary file;
+  //   see mmap_I2_SNGRID.
 
   fitsfile *fp_SNGRID;
 
-  int VERBOSE, IVERSION, ITYPE, istat, anynul, irow, colnum;
+  int VERBOSE, USE_MMAP, IVERSION, ITYPE, istat, anynul, irow, colnum;
   int ipar, ifilt, nwdtmp, extver = 0 ;
 
   short  I2TMP[NPAR_GRIDGEN+1];
@@ -116,7 +127,8 @@ void fits_read_SNGRID(int OPTMASK, char *sngridFile,
 
   // ---------------- BEGIN -------------------
 
-  VERBOSE = (OPTMASK & 1 );
+  VERBOSE  = (OPTMASK & OPTMASK_SNGRID_VERBOSE );
+  USE_MMAP = (OPTMASK & OPTMASK_SNGRID_MMAP );
 
   printf("\n  Begin %s for \n  %s \n", fnam, sngridFile ) ;
 
@@ -462,6 +474,13 @@ void fits_read_SNGRID(int OPTMASK, char *sngridFile,
 
   SNGRID->SIZEOF_GRIDGEN = 4 * nwdtmp ; // July 9, 2012
 
+  // check option to map I2 arrays from binary file (Oct 2026)
+  if ( USE_MMAP && mmap_I2_SNGRID(sngridFile, nwdtmp, SNGRID) ) {
+    fits_close_file(fp_SNGRID, &istat);
+    check_fitserror("Close FITS file", istat) ;
+    return ;
+  }
+
   if ( VERBOSE ) {
     printf("\t read %d  I2LCMAG  values for GRID \n", nwdtmp );
     printf("\t read %d  I2LCERR  values for GRID \n", nwdtmp );
@@ -487,11 +506,132 @@ void fits_read_SNGRID(int OPTMASK, char *sngridFile,
   fits_close_file(fp_SNGRID, &istat);
   check_fitserror("Close FITS file", istat) ;
 
+  // write binary file for next job, and switch to shared mapping
+  if ( USE_MMAP && write_mmap_I2_SNGRID(sngridFile, nwdtmp, SNGRID) ) {
+    short *I2MAG = SNGRID->I2GRIDGEN_LCMAG ;
+    short *I2ERR = SNGRID->I2GRIDGEN_LCERR ;
+    if ( mmap_I2_SNGRID(sngridFile, nwdtmp, SNGRID) ) 
+      { free(I2MAG);  free(I2ERR); }
+  }
 
   //  debugexit("fits read"); // xxxxxxxxx
 
 } // end of read_GRIDfile_fits
 
+// ==================================
+int mmap_I2_SNGRID(char *sngridFile, int NWD, SNGRID_DEF *SNGRID) {
+
+  // Created Oct 2026
+  // Map I2 mag & error arrays from binary file [sngridFile].I2MMAP 
+  // (read-only; pages are shared among all processes reading the
+  // same grid). File layout is SNGRID_MMAP_HEAD_DEF followed by 
+  // I2MAG[0:NWD] and I2ERR[0:NWD], where index 0 is unused to 
+  // match fortran-like indices of fits_read_SNGRID.
+  // Returns 1 if mapped; returns 0 if file does not exist or does
+  // not match the FITS file (size, mtime or NWD).
+
+  char mmapFile[MXPATHLEN];
+  struct stat statFits, statMmap ;
+  SNGRID_MMAP_HEAD_DEF *HEAD ;
+  size_t SIZE_EXPECT ;
+  void  *ADDR ;
+  int    fd ;
+  char   fnam[] = "mmap_I2_SNGRID" ;
+
+  // ------------ BEGIN --------------
+
+  sprintf(mmapFile, "%s.%s", sngridFile, SUFFIX_SNGRID_MMAP);
+  if ( stat(sngridFile, &statFits) != 0 ) { return 0; }
+
+  fd = open(mmapFile, O_RDONLY);
+  if ( fd < 0 ) { return 0; }
+
+  SIZE_EXPECT = sizeof(SNGRID_MMAP_HEAD_DEF) + 
+    2 * sizeof(short) * (size_t)(NWD+1) ;
+  if ( fstat(fd, &statMmap) != 0 || statMmap.st_size != SIZE_EXPECT ) 
+    { close(fd); return 0; }
+
+  ADDR = mmap(NULL, SIZE_EXPECT, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd); // mapping remains valid
+  if ( ADDR == MAP_FAILED ) { return 0; }
+
+  HEAD = (SNGRID_MMAP_HEAD_DEF*)ADDR ;
+  if ( HEAD->MAGIC      != MAGIC_SNGRID_MMAP           || 
+       HEAD->NWD        != NWD                         ||
+       HEAD->FITS_SIZE  != (long long)statFits.st_size || 
+       HEAD->FITS_MTIME != (long long)statFits.st_mtime ) {
+    printf("\t %s: %s is stale -> ignore\n", fnam, mmapFile);
+    munmap(ADDR, SIZE_EXPECT);
+    return 0;
+  }
+
+  SNGRID->I2GRIDGEN_LCMAG = (short*)(HEAD + 1);
+  SNGRID->I2GRIDGEN_LCERR = SNGRID->I2GRIDGEN_LCMAG + (NWD+1) ;
+
+  printf("\t %s: mapped %d I2 words from %s\n", fnam, NWD, mmapFile);
+  fflush(stdout);
+
+  return 1;
+
+} // end mmap_I2_SNGRID
+
+// ==================================
+int write_mmap_I2_SNGRID(char *sngridFile, int NWD, SNGRID_DEF *SNGRID) {
+
+  // Created Oct 2026
+  // Write I2 arrays read from FITS file to binary file for 
+  // mmap_I2_SNGRID. Write to temp file and rename so that concurrent 
+  // jobs never map a partial file. Returns 1 on success; returns 0 
+  // (with message) if file cannot be written, e.g., read-only 
+  // grid area; in that case the FITS read is used.
+
+  char mmapFile[MXPATHLEN], tmpFile[MXPATHLEN];
+  struct stat statFits ;
+  SNGRID_MMAP_HEAD_DEF HEAD ;
+  size_t NW = (size_t)(NWD+1), NWR = 0 ;
+  FILE  *fp ;
+  char   fnam[] = "write_mmap_I2_SNGRID" ;
+
+  // ------------ BEGIN --------------
+
+  if ( stat(sngridFile, &statFits) != 0 ) { return 0; }
+
+  sprintf(mmapFile, "%s.%s",    sngridFile, SUFFIX_SNGRID_MMAP);
+  sprintf(tmpFile,  "%s.tmp%d", mmapFile, (int)getpid() );
+
+  fp = fopen(tmpFile, "wb");
+  if ( !fp ) {
+    printf("\t %s: cannot write %s -> use FITS read\n", fnam, mmapFile);
+    fflush(stdout);
+    return 0;
+  }
+
+  memset(&HEAD, 0, sizeof(HEAD));
+  HEAD.MAGIC      = MAGIC_SNGRID_MMAP ;
+  HEAD.IVERSION   = SNGRID->IVERSION ;
+  HEAD.NWD        = NWD ;
+  HEAD.FITS_SIZE  = (long long)statFits.st_size ;
+  HEAD.FITS_MTIME = (long long)statFits.st_mtime ;
+
+  SNGRID->I2GRIDGEN_LCMAG[0] = SNGRID->I2GRIDGEN_LCERR[0] = 0 ;
+  fwrite(&HEAD, sizeof(HEAD), 1, fp);
+  NWR += fwrite(SNGRID->I2GRIDGEN_LCMAG, sizeof(short), NW, fp);
+  NWR += fwrite(SNGRID->I2GRIDGEN_LCERR, sizeof(short), NW, fp);
+
+  if ( fclose(fp) != 0 || NWR != 2*NW || rename(tmpFile, mmapFile) != 0 ) {
+    printf("\t %s: failed to write %s -> use FITS read\n", 
+	   fnam, mmapFile);
+    fflush(stdout);
+    remove(tmpFile);
+    return 0;
+  }
+
+  printf("\t %s: wrote %s\n", fnam, mmapFile);
+  fflush(stdout);
+  return 1;
+
+} // end write_mmap_I2_SNGRID
+
 // ==================================
 void check_fitserror(char *comment, int status) {
 
@@ -26,6 +26,12 @@
       the PHOT data stream. For sims, add TEXPOSE([FIELD]) keys in 
       global header to automatically fill TEXPOSE in data.
 
+  Oct 15 2026: 
+    + band -> map index and uniform log10(flux) segment tables are 
+      built at init (init_TABLE_NONLIN), so get_flux_scale_NONLIN is
+      O(1) without string search or sprintf per call.
+    + GET_NONLIN_BATCH evaluates all epochs of an event.
+
 ======================================================= */
 
 #include <stdio.h>
@@ -167,6 +173,9 @@ void INIT_NONLIN(char *inFile) {
   NONLIN_README.LINE[NLINE][0] = 0 ; NLINE++ ;
   NONLIN_README.NLINE = NLINE ;
 
+  // prepare fast lookup tables (Oct 2026)
+  init_TABLE_NONLIN();
+
   //  debugexit(fnam); // xxx REMOVE
   return ;
 
@@ -176,6 +185,59 @@ void INIT_NONLIN(char *inFile) {
 void   init_nonlin__(char *inFile) { INIT_NONLIN(inFile); }
 
 
+// =====================================
+void init_TABLE_NONLIN(void) {
+
+  // Created Oct 2026
+  // Build lookup tables for get_flux_scale_NONLIN:
+  //  + IMAP_NONLIN_BAND[band char] = first map whose FILTERS 
+  //    contains band (same as strstr search), or -1.
+  //  + for each map, uniform grid in log10(flux) over map range,
+  //    with ISEG_TABLE[k] = map segment containing start of cell k.
+  //    Lookup then needs only a short forward step from ISEG_TABLE,
+  //    and uses the same linear interpolation as interp_1DFUN.
+
+  int  imap, ic, k, iseg, N ;
+  double *LOGF, XMIN, XMAX, x ;
+  char  *ptrFilters ;
+
+  // ------------ BEGIN ------------
+
+  for(ic=0; ic < MXCHAR_BAND_NONLIN; ic++ ) { IMAP_NONLIN_BAND[ic] = -1; }
+
+  for(imap=0; imap < NMAP_NONLIN; imap++ ) {
+
+    ptrFilters = NONLIN_MAP[imap].FILTERS ;
+    for(ic=0; ic < strlen(ptrFilters); ic++ ) {
+      k = (int)ptrFilters[ic] ;
+      if ( k <= 0 || k >= MXCHAR_BAND_NONLIN ) { continue; }
+      if ( IMAP_NONLIN_BAND[k] < 0 ) { IMAP_NONLIN_BAND[k] = imap; }
+    }
+
+    N    = NONLIN_MAP[imap].MAPSIZE ;
+    LOGF = NONLIN_MAP[imap].MAPVAL[0] ;
+    NONLIN_MAP[imap].INV_DLOGF = 0.0 ;
+    if ( N < 2 ) { continue; } // use interp_1DFUN
+
+    XMIN = LOGF[0];  XMAX = LOGF[N-1];
+    NONLIN_MAP[imap].LOGF_MIN  = XMIN ;
+    NONLIN_MAP[imap].LOGF_MAX  = XMAX ;
+    if ( XMAX <= XMIN ) { continue; }
+    NONLIN_MAP[imap].INV_DLOGF = (double)NBIN_TABLE_NONLIN/(XMAX-XMIN);
+
+    iseg = 0 ;
+    for(k=0; k < NBIN_TABLE_NONLIN; k++ ) {
+      x = XMIN + (double)k / NONLIN_MAP[imap].INV_DLOGF ;
+      while ( iseg < N-2 && x >= LOGF[iseg+1] ) { iseg++ ; }
+      NONLIN_MAP[imap].ISEG_TABLE[k] = (short)iseg ;
+    }
+  }
+
+  return ;
+
+} // end init_TABLE_NONLIN
+
+
 void check_OPTMASK_NONLIN(){
     char fnam[] = "check_OPTMASK_NONLIN" ;
     
@@ -419,39 +481,107 @@ double get_nonlin__(char *CCID, char *cfilt, double *Texpose, double *NEA, doubl
   return(F_scale);
 }
 
+
+// ====================================
+void GET_NONLIN_BATCH(char *CCID, int NOBS, char *BANDLIST, 
+		      double *TEXPOSE, double *NEA, double *FPE_LIST, 
+		      double *MAG, double *SCALE_LIST) {
+
+  // Created Oct 2026
+  // Evaluate GET_NONLIN for all NOBS epochs of an event:
+  //   BANDLIST[o]       = 1-char band for obs o (no null terminators)
+  //   FPE_LIST[3*o+i]   = Fpe(source,sky,galaxy) for obs o
+  //   SCALE_LIST[o]     = output F_meas/F_true
+  // Epochs in bands without a map are skipped here (scale=1) 
+  // before any per-epoch work.
+
+  int  o ;
+  char cfilt[2] ;
+
+  // ------------ BEGIN ------------
+
+  for(o=0; o < NOBS; o++ ) {
+    SCALE_LIST[o] = 1.0 ;
+    if ( NMAP_NONLIN == 0 ) { continue; }
+    if ( (unsigned char)BANDLIST[o] >= MXCHAR_BAND_NONLIN ) { continue; }
+    if ( IMAP_NONLIN_BAND[(int)BANDLIST[o]] < 0 ) { continue; }
+    cfilt[0] = BANDLIST[o];  cfilt[1] = 0 ;
+    SCALE_LIST[o] = GET_NONLIN(CCID, cfilt, TEXPOSE[o], NEA[o], 
+			       &FPE_LIST[3*o], MAG[o]);
+  }
+
+  return ;
+
+} // end GET_NONLIN_BATCH
+
+void get_nonlin_batch__(char *CCID, int *NOBS, char *BANDLIST, 
+			double *TEXPOSE, double *NEA, double *FPE_LIST, 
+			double *MAG, double *SCALE_LIST) {
+  GET_NONLIN_BATCH(CCID, *NOBS, BANDLIST, TEXPOSE, NEA, FPE_LIST,
+		   MAG, SCALE_LIST);
+}
+
 // =============================
 double get_flux_scale_NONLIN(char *cfilt, double flux) {
 
   // Return F(+nonlin) / F(perfect linearity)
+  // Oct 15 2026: find map from IMAP_NONLIN_BAND table (no strstr),
+  //              and interpolate with get_flux_scale_NONLIN_MAP.
+
+  int  imap, ic = (int)cfilt[0] ;
+
+  // ---------- BEGIN ---------
 
   if ( flux <= 0.0 ) { return 1.000; }
+  if ( ic <= 0 || ic >= MXCHAR_BAND_NONLIN ) { return 0.0 ; }
+
+  imap = IMAP_NONLIN_BAND[ic] ;
+  if ( imap < 0 ) { return 0.0 ; } // no map for this band
+
+  return get_flux_scale_NONLIN_MAP(imap, flux);
   
-  double log10_flux = log10(flux);
-  double f_scale = 0.0 ;
+} // end get_flux_scale_NONLIN
+
+
+// =============================
+double get_flux_scale_NONLIN_MAP(int imap, double flux) {
+
+  // Created Oct 2026
+  // Return F(+nonlin) / F(perfect linearity) for map imap,
+  // using uniform-grid segment table from init_TABLE_NONLIN.
+  // Linear interpolation is the same as interp_1DFUN; flux outside 
+  // the map range (or tiny maps) goes to interp_1DFUN, which aborts 
+  // with the usual message.
+
+  NONLIN_DEF *MAP = &NONLIN_MAP[imap] ;
+  int    N = MAP->MAPSIZE, k, iseg ;
+  double log10_flux, *LOGF, *FSCALE, frac ;
   int    OPT_INTERP = 1;  // 1=linear interp
-  int    imap ;
-  char  *ptrFilters, msg[100] ;
-  char fnam[] = "get_flux_scale_NONLIN";
+  char   msg[100] ;
+  char   fnam[] = "get_flux_scale_NONLIN_MAP";
 
   // ---------- BEGIN ---------
 
-  // find which map contains *cfilt.
-  for(imap=0; imap < NMAP_NONLIN; imap++ ) {
-    ptrFilters = NONLIN_MAP[imap].FILTERS ;
+  if ( flux <= 0.0 ) { return 1.000; }
+  log10_flux = log10(flux);
+
+  if ( MAP->INV_DLOGF <= 0.0 || 
+       log10_flux < MAP->LOGF_MIN || log10_flux > MAP->LOGF_MAX ) {
+    sprintf(msg,"%s: imap=%d Flux = %le", fnam, imap, flux);
+    return interp_1DFUN(OPT_INTERP, log10_flux, N,
+			MAP->MAPVAL[0], // log10(flux)
+			MAP->MAPVAL[1], // F_scale
+			msg ) ;
+  }
 
-    if ( strstr(ptrFilters,cfilt) != NULL )  {
-      sprintf(msg,"%s: band=%s imap=%d Flux = %le", 
-	      fnam, cfilt, imap, flux);
+  LOGF   = MAP->MAPVAL[0] ;
+  FSCALE = MAP->MAPVAL[1] ;
+  k = (int)( (log10_flux - MAP->LOGF_MIN) * MAP->INV_DLOGF );
+  if ( k >= NBIN_TABLE_NONLIN ) { k = NBIN_TABLE_NONLIN-1; }
+  iseg = MAP->ISEG_TABLE[k] ;
+  while ( iseg < N-2 && log10_flux > LOGF[iseg+1] ) { iseg++ ; }
 
-      f_scale = interp_1DFUN(OPT_INTERP, log10_flux,
-			     NONLIN_MAP[imap].MAPSIZE,
-			     NONLIN_MAP[imap].MAPVAL[0], // log10(flux)
-			     NONLIN_MAP[imap].MAPVAL[1], // F_scale
-			     msg ) ;
-      return f_scale;
-    }
-  }  // end imap loop
+  frac = (log10_flux - LOGF[iseg]) / (LOGF[iseg+1] - LOGF[iseg]) ;
+  return FSCALE[iseg] + frac*(FSCALE[iseg+1] - FSCALE[iseg]) ;
 
-  return f_scale ;
-  
-} // end get_flux_scale_NONLIN
+} // end get_flux_scale_NONLIN_MAP
@@ -8,6 +8,8 @@
 #define OPTMASK_NONLIN_PER_PIX  8  // nonlin map provided for each pixel (will convert to total flux)
 #define OPTMASK_NONLIN_DUMPFLAG   1024  // dump flag
 #define OPTMASK_NONLIN_DEBUGFLAG  2048  // internal test/debug flag
+#define NBIN_TABLE_NONLIN  256  // uniform log10(flux) cells for lookup
+#define MXCHAR_BAND_NONLIN 128  // band-char index for map lookup
 
 
 char MODELNAME_NONLIN[100];
@@ -20,8 +22,15 @@ typedef struct {
   char   FILTERS[MXFILTINDX];
   int    MAPSIZE ;
   double MAPVAL[2][MXBIN_NONLIN];  // definition depends on MODEL
+
+  // uniform-grid lookup table built at init (Oct 2026):
+  // ISEG_TABLE[k] = map segment containing start of cell k.
+  double LOGF_MIN, LOGF_MAX, INV_DLOGF ;
+  short  ISEG_TABLE[NBIN_TABLE_NONLIN];
 } NONLIN_DEF ;
 
+int IMAP_NONLIN_BAND[MXCHAR_BAND_NONLIN]; // map index vs. band char; -1=none
+
 
 NONLIN_DEF  *NONLIN_MAP ;
 
@@ -41,6 +50,15 @@ double GET_NONLIN(char *CCID, char *cfilt, double Texpose, double NEA, double *F
 double get_nonlin__(char *CCID, char *cfilt, double *Texpose, double *NEA, double *Fpe_list,
 		    double *genmag);
 
+void   GET_NONLIN_BATCH(char *CCID, int NOBS, char *BANDLIST, 
+			double *TEXPOSE, double *NEA, double *FPE_LIST, 
+			double *MAG, double *SCALE_LIST);
+void   get_nonlin_batch__(char *CCID, int *NOBS, char *BANDLIST, 
+			  double *TEXPOSE, double *NEA, double *FPE_LIST, 
+			  double *MAG, double *SCALE_LIST);
+
 void check_OPTMASK_NONLIN(void) ;
+void   init_TABLE_NONLIN(void);
 double get_flux_scale_NONLIN(char *cfilt, double flux);
+double get_flux_scale_NONLIN_MAP(int imap, double flux);
 
@@ -3,6 +3,10 @@
 // Initial use is for wfit.c to read npz-formatted covariance file 
 // from create_covariance.py.
 // Use package from https://github.com/rogersce/cnpy
+//
+// Oct 15 2026: read "cov" member without loading entire npz into memory;
+//   mmap for uncompressed member, or stream-inflate for compressed
+//   member, and convert float utria directly into output array.
 
 #include <stdio.h>
 #include <string.h>
@@ -11,6 +15,9 @@
 #include <unistd.h>
 #include <time.h>
 #include <math.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "sntools_npz.h"
 #include "cnpy.h"
@@ -27,66 +34,254 @@ int read_npz_covmat(char *npz_file, double *array1d) {
   // The cov in npz file is float (4 byte) and upper triangular half
   // to save disk space. 
   // However, the returned cov is the full N x N in double precision.
+  //
+  // Oct 15 2026: 
+  //   only "nsn" is read with cnpy; "cov" is converted directly into
+  //   array1d (see read_npz_covmat_direct) to avoid transient copies 
+  //   of the full cov. Fall back to cnpy::npz_load if direct read
+  //   is not possible (e.g., zip64 member).
 
-  int k0, k1, j1du=0, j1d_tmp, NSN;
-  double cov;
-  bool CHECK_COV_LOADING = false;   int *n_cov_load;
-  char fnam[] = "read_npz_covmat" ;
+  int NSN;
+  //  char fnam[] = "read_npz_covmat" ;
 
   // ------------ BEGIN --------------
 
-  // load the entire npz file
-  cnpy::npz_t  my_npz = cnpy::npz_load(npz_file);
-
   // pick off NSN
-  cnpy::NpyArray nsn_npz = my_npz["nsn"];
+  cnpy::NpyArray nsn_npz = cnpy::npz_load(npz_file, "nsn");
   NSN = *nsn_npz.data<int>();
 
+  if ( read_npz_covmat_direct(npz_file, NSN, array1d) == 0 ) 
+    { return NSN; }
+
+  // - - - - - - - - 
+  // legacy: load the entire npz file
+  cnpy::npz_t  my_npz = cnpy::npz_load(npz_file);
+
   // read upper-triangle part of cov
   cnpy::NpyArray cov_utri_npz = my_npz["cov"];
   float *cov_utri = cov_utri_npz.data<float>() ;
 
-  // - - - - - - -
   // load full NSN x NSN output array and convert float to double
+  UTRIA_FILL_NPZ_DEF FILL;
+  init_utria_fill_npz(NSN, array1d, &FILL);
+  fill_utria_npz(cov_utri, (size_t)NSN*(NSN+1)/2, &FILL);
+
+  // - - - -
+  return NSN;
+
+} // read_npz_array
+
+
+// ====================================================
+void init_utria_fill_npz(int NSN, double *array1d, UTRIA_FILL_NPZ_DEF *FILL) {
+  // Created Oct 2026
+  FILL->NSN = NSN;  FILL->k0 = FILL->k1 = 0;
+  FILL->NFILL = 0;  FILL->array1d = array1d ;
+} // end init_utria_fill_npz
+
+void fill_utria_npz(float *cov_utri, size_t N, UTRIA_FILL_NPZ_DEF *FILL) {
 
-  if ( CHECK_COV_LOADING ) { 
-    n_cov_load = (int*) malloc( NSN*NSN * sizeof(int) );
-    for(j1d_tmp = 0; j1d_tmp < NSN*NSN; j1d_tmp++ ) { n_cov_load[j1d_tmp] = false; }
+  // Created Oct 2026
+  // Load next N upper-triangle floats cov_utri into full NSN x NSN 
+  // double array. Row/column are carried in FILL so that utria
+  // can be passed in arbitrary chunks (e.g., while inflating).
+
+  int    NSN = FILL->NSN ;
+  int    k0  = FILL->k0, k1 = FILL->k1 ;
+  size_t MXFILL = (size_t)NSN*(NSN+1)/2 ;
+  size_t i;
+  double cov, *array1d = FILL->array1d ;
+
+  // ------------ BEGIN ------------
+
+  if ( FILL->NFILL + N > MXFILL ) { N = MXFILL - FILL->NFILL; }
+
+  for(i=0; i < N; i++ ) {
+    cov = (double)cov_utri[i];
+    array1d[(size_t)k0*NSN + k1] = cov;
+    array1d[(size_t)k1*NSN + k0] = cov;
+    k1++ ;
+    if ( k1 == NSN ) { k0++ ; k1 = k0; }
   }
 
-  for (k0=0; k0 < NSN; k0++ ) {
-    for (k1=k0; k1 < NSN; k1++ ) {
-      cov    = cov_utri[j1du];
-       
-      j1d_tmp = k0*NSN + k1;
-      array1d[j1d_tmp] = (double)cov ;
-      if ( CHECK_COV_LOADING ) { n_cov_load[j1d_tmp]++ ; }
-
-      if ( k0 != k1 ) {
-	j1d_tmp = k1*NSN + k0;
-	array1d[j1d_tmp] = (double)cov ;
-	if ( CHECK_COV_LOADING ) { n_cov_load[j1d_tmp]++ ; }
-      }
+  FILL->k0 = k0;  FILL->k1 = k1;  FILL->NFILL += N;
+  return ;
+
+} // end fill_utria_npz
+
+
+// ====================================================
+int read_npz_covmat_direct(char *npz_file, int NSN, double *array1d) {
+
+  // Created Oct 2026
+  // Locate "cov.npy" member in npz (zip) file and convert its float
+  // utria directly into array1d:
+  //  * uncompressed member (np.savez) -> mmap file and read in place.
+  //  * deflated member (np.savez_compressed) -> inflate in chunks.
+  // Neither the compressed nor the uncompressed member is held in 
+  // memory. Returns 0 on success; -1 if caller should fall back to 
+  // cnpy::npz_load.
+
+  FILE *fp ;
+  unsigned char hdr[30];
+  uint16_t name_len, extra_len, compr_method ;
+  uint32_t compr_bytes, uncompr_bytes ;
+  long     data_offset = -1 ;
+  size_t   NUTRIA = (size_t)NSN*(NSN+1)/2 ;
+  char     varname[200];
+  int      istat = -1 ;
+  UTRIA_FILL_NPZ_DEF FILL;
+  char c1err[200], c2err[200];
+  char fnam[] = "read_npz_covmat_direct" ;
+
+  // ------------ BEGIN ------------
+
+  fp = fopen(npz_file,"rb");
+  if ( !fp ) { return -1; }
+
+  while ( fread(hdr, 1, 30, fp) == 30 ) {
+    if ( hdr[2] != 0x03 || hdr[3] != 0x04 ) { break; } // global header
 
-      j1du+=1 ;
+    memcpy(&compr_method,  &hdr[8],  2);
+    memcpy(&compr_bytes,   &hdr[18], 4);
+    memcpy(&uncompr_bytes, &hdr[22], 4);
+    memcpy(&name_len,      &hdr[26], 2);
+    memcpy(&extra_len,     &hdr[28], 2);
+    if ( name_len >= sizeof(varname) ) { break; }
+    if ( fread(varname, 1, name_len, fp) != name_len ) { break; }
+    varname[name_len] = 0;
+    fseek(fp, extra_len, SEEK_CUR);
+
+    if ( strcmp(varname,"cov.npy") == 0 ) 
+      { data_offset = ftell(fp);  break; }
+
+    fseek(fp, compr_bytes, SEEK_CUR);
+  }
+
+  // zip64 members have 0xFFFFFFFF sizes; leave those to cnpy
+  if ( data_offset < 0 || compr_bytes == 0xFFFFFFFF ) 
+    { fclose(fp); return -1; }
+
+  init_utria_fill_npz(NSN, array1d, &FILL);
+
+  if ( compr_method == 0 ) {
+    // - - - - uncompressed: mmap - - - -
+    int    fd = fileno(fp);
+    struct stat st;
+    long   page = sysconf(_SC_PAGESIZE);
+    long   map_offset = (data_offset/page)*page ;
+    size_t map_len ;
+    unsigned char *map, *npy ;
+    size_t  npy_hdr ;
+
+    fstat(fd, &st);
+    map_len = (size_t)st.st_size - map_offset ;
+    map     = (unsigned char*)mmap(NULL, map_len, PROT_READ, MAP_PRIVATE, 
+				   fd, map_offset);
+    if ( map != MAP_FAILED ) {
+      madvise(map, map_len, MADV_SEQUENTIAL);
+      npy = map + (data_offset - map_offset);
+      npy_hdr = header_len_npy(npy, uncompr_bytes);
+      if ( npy_hdr > 0 && uncompr_bytes - npy_hdr >= 4*NUTRIA ) {
+	fill_utria_npz((float*)(npy+npy_hdr), NUTRIA, &FILL);
+	istat = 0 ;
+      }
+      munmap(map, map_len);
     }
   }
+  else if ( compr_method == 8 ) {
+    // - - - - deflate: inflate in chunks - - - - 
+    size_t   CHUNK = 16*1024*1024 ;
+    unsigned char *ibuf = (unsigned char*)malloc(CHUNK);
+    unsigned char *obuf = (unsigned char*)malloc(CHUNK);
+    size_t   nleft = compr_bytes, nobuf = 0, nread, npy_hdr = 0, nfloat ;
+    bool     DONE_HDR = false ;
+    int      zerr = Z_OK ;
+    z_stream zs ;
 
+    memset(&zs, 0, sizeof(zs));
+    inflateInit2(&zs, -MAX_WBITS);
 
-  // - - - - - - - -
+    while ( zerr != Z_STREAM_END ) {
+      if ( zs.avail_in == 0 && nleft > 0 ) {
+	nread = fread(ibuf, 1, (nleft < CHUNK ? nleft : CHUNK), fp);
+	if ( nread == 0 ) { break; }
+	nleft -= nread ;
+	zs.next_in  = ibuf;  zs.avail_in = nread;
+      }
+      zs.next_out  = obuf + nobuf ;
+      zs.avail_out = CHUNK - nobuf ;
+      zerr = inflate(&zs, Z_NO_FLUSH);
+      if ( zerr != Z_OK && zerr != Z_STREAM_END ) { break; }
+      nobuf = CHUNK - zs.avail_out ;
 
-  if ( CHECK_COV_LOADING ) {    
-    for(j1d_tmp = 0; j1d_tmp < NSN*NSN; j1d_tmp++ ) {
-      int n = n_cov_load[j1d_tmp] ;
-      if ( n != 1 ) {
-	printf(" xxx %s ERROR: j1d=%d  n_cov_load = %d \n",
-	       fnam, j1d_tmp, n ); fflush(stdout);
+      if ( !DONE_HDR ) {
+	npy_hdr = header_len_npy(obuf, nobuf);
+	if ( npy_hdr == 0 ) { 
+	  if ( nobuf >= 4096 ) { break; } // invalid npy header
+	  continue; 
+	}
+	nobuf -= npy_hdr ;
+	memmove(obuf, obuf+npy_hdr, nobuf);
+	DONE_HDR = true ;
       }
+
+      nfloat = nobuf/4 ;
+      fill_utria_npz((float*)obuf, nfloat, &FILL);
+      nobuf -= 4*nfloat ;
+      memmove(obuf, obuf+4*nfloat, nobuf); // keep partial float
     }
+
+    inflateEnd(&zs);
+    free(ibuf); free(obuf);
+    if ( FILL.NFILL == NUTRIA ) { istat = 0; }
   }
 
-  // - - - -
-  return NSN;
+  fclose(fp);
 
-} // read_npz_array
+  if ( istat == 0 && FILL.NFILL != NUTRIA ) {
+    sprintf(c1err,"Loaded %zu cov elements, but expected %zu",
+	    FILL.NFILL, NUTRIA);
+    sprintf(c2err,"Check %s", npz_file);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  return istat ;
+
+} // end read_npz_covmat_direct
+
+
+// ====================================================
+size_t header_len_npy(unsigned char *buf, size_t nbuf) {
+
+  // Created Oct 2026
+  // Return total header length (magic + version + len + dict) of 
+  // npy buffer, or 0 if buf does not yet contain the full header
+  // or if array is not little-endian 4-byte float in C order.
+
+  uint16_t len16;
+  uint32_t len32;
+  size_t   NHDR, NSKIP;
+  char     dict[4096];
+
+  // ------------ BEGIN ------------
+
+  if ( nbuf < 12 ) { return 0; }
+  if ( buf[0] != 0x93 || memcmp(buf+1,"NUMPY",5) != 0 ) { return 0; }
+
+  if ( buf[6] == 1 ) 
+    { memcpy(&len16, buf+8, 2); NSKIP = 10; NHDR = NSKIP + len16; }
+  else
+    { memcpy(&len32, buf+8, 4); NSKIP = 12; NHDR = NSKIP + len32; }
+
+  if ( nbuf < NHDR || NHDR >= sizeof(dict) ) { return 0; }
+
+  // dict string starts after magic+version+len (which may contain 0 bytes)
+  memcpy(dict, buf+NSKIP, NHDR-NSKIP);  dict[NHDR-NSKIP] = 0;
+  if ( strstr(dict,"<f4") == NULL ) { return 0; }
+  if ( strstr(dict,"'fortran_order': True") != NULL ) 
+    { /* symmetric utria order differs; let cnpy path handle it */ return 0; }
+
+  return NHDR;
 
+} // end header_len_npy
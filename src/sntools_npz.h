@@ -3,11 +3,26 @@
 
 
 
+#include <stdint.h>
+
+#define SEV_FATAL  4      // must match value in sntools.h, for errmsg call
+
+// Oct 2026: carry row/col while filling full cov from float utria chunks
+typedef struct {
+  int     NSN, k0, k1 ;
+  size_t  NFILL ;
+  double *array1d ;
+} UTRIA_FILL_NPZ_DEF ;
+
 #ifdef __cplusplus
 extern"C" {
 #endif
 
   int read_npz_covmat(char *npz_file, double *array1d);
+  int read_npz_covmat_direct(char *npz_file, int NSN, double *array1d);
+  void init_utria_fill_npz(int NSN, double *array1d, UTRIA_FILL_NPZ_DEF *FILL);
+  void fill_utria_npz(float *cov_utri, size_t N, UTRIA_FILL_NPZ_DEF *FILL);
+  size_t header_len_npy(unsigned char *buf, size_t nbuf);
 
   void  errmsg ( int isev, int iprompt, char *fnam, char *msg1, char *msg2 );
   void  print_banner ( const char *banner ) ;
@@ -76,6 +76,22 @@
  Nov 04 2023: add VBOSE arg to CDTOPDIR_OUTPUT to enable codes to
               suppress output for long batch jobs.
 
+ Oct 14 2026: add columnar binary table format (SNBIN); see
+              sntools_output_bin.c. Write with TABLEFILE_OPEN option
+              'bin' (and optional 'compress'); read via SNBIN suffix.
+
+ Oct 15 2026: new SNTABLE_READPREP_CUT to select rows while reading
+              TEXT and SNBIN tables; SNTABLE_DUMP_CUT passes cuts
+              to SNTABLE_DUMP_VALUES.
+
+ Oct 15 2026: ROOT write options zlevel=, basket=, autoflush= and imt=
+              in TABLEFILE_OPEN STRINGOPT (ROOTFILE_OPT).
+
+ Oct 15 2026: AUTOSTORE lookups use a CCID hash index per stored file
+              instead of a loop over rows; new batch lookup
+              SNTABLE_AUTOSTORE_READ_LIST; optMask += 8 keeps previous
+              autostores after reads.
+
 ************************************************/
 
 #include <stdio.h>
@@ -106,6 +122,10 @@
 #include "sntools_output_marz.c"
 #endif
 
+#ifdef USE_BIN
+#include "sntools_output_bin.c"
+#endif
+
 
 // ===============================================
 void SNTABLE_DEBUG_DUMP(char *fnam, int idump) {
@@ -144,6 +164,11 @@ void TABLEFILE_INIT(void) {
   OUTLIER_INFO.USEFLAG = 0 ;
   NLINE_TABLECOMMENT = 0 ;
 
+  ROOTFILE_OPT.ZLEVEL      = -1 ;
+  ROOTFILE_OPT.BASKET      =  0 ;
+  ROOTFILE_OPT.AUTOFLUSH   =  0 ;
+  ROOTFILE_OPT.NTHREAD_IMT =  0 ;
+
   for(o=0; o < MXOPENFLAG; o++ ) {
     sprintf(STRING_TABLEFILE_OPENFLAG[o],"%s", U) ; 
     for(t=0; t < MXTABLEFILETYPE; t++ ) {
@@ -170,6 +195,7 @@ void TABLEFILE_INIT(void) {
   // xxx  s = STRING_TABLEFILE_TYPE[IFILETYPE_HBOOK] ;  sprintf(s,"HBOOK");
   s = STRING_TABLEFILE_TYPE[IFILETYPE_ROOT]  ;  sprintf(s,"ROOT");
   s = STRING_TABLEFILE_TYPE[IFILETYPE_TEXT]  ;  sprintf(s,"TEXT");
+  s = STRING_TABLEFILE_TYPE[IFILETYPE_BIN]   ;  sprintf(s,"SNBIN");
 
   s = STRING_TABLEFILE_OPENFLAG[OPENFLAG_NULL]  ;  sprintf(s,"NULL");
   s = STRING_TABLEFILE_OPENFLAG[OPENFLAG_NEW]   ;  sprintf(s,"NEW" );
@@ -178,14 +204,17 @@ void TABLEFILE_INIT(void) {
   // xxx  s = STRING_IDTABLE_SNANA[IFILETYPE_HBOOK] ; sprintf(s,"7100");
   s = STRING_IDTABLE_SNANA[IFILETYPE_ROOT]  ; sprintf(s,"SNANA");
   s = STRING_IDTABLE_SNANA[IFILETYPE_TEXT]  ; sprintf(s,"SNANA");
+  s = STRING_IDTABLE_SNANA[IFILETYPE_BIN]   ; sprintf(s,"SNANA");
 
   // xxx   s = STRING_IDTABLE_FITRES[IFILETYPE_HBOOK] ; sprintf(s,"7788"  );
   s = STRING_IDTABLE_FITRES[IFILETYPE_ROOT]  ; sprintf(s,"FITRES");
   s = STRING_IDTABLE_FITRES[IFILETYPE_TEXT]  ; sprintf(s,"FITRES");
+  s = STRING_IDTABLE_FITRES[IFILETYPE_BIN]   ; sprintf(s,"FITRES");
 
   // xxx  s = STRING_IDTABLE_OUTLIER[IFILETYPE_HBOOK] ; sprintf(s,"7800"  );
   s = STRING_IDTABLE_OUTLIER[IFILETYPE_ROOT]  ; sprintf(s,"OUTLIER");
   s = STRING_IDTABLE_OUTLIER[IFILETYPE_TEXT]  ; sprintf(s,"OUTLIER");
+  s = STRING_IDTABLE_OUTLIER[IFILETYPE_BIN]   ; sprintf(s,"OUTLIER");
 
   // useful string for cast manipulations
   sprintf(CCAST_TABLEVAR," CISF---D-------L--" );
@@ -206,6 +235,12 @@ void TABLEFILE_INIT(void) {
   FILEPREFIX_TEXT[0] = 0 ;
 #endif
 
+#ifdef USE_BIN
+  FILEPREFIX_BIN[0] = 0 ;
+  COMPRESS_BIN      = 0 ;
+  READINFO_BIN.FP   = NULL ;
+#endif
+
 } // end of TABLEFILE_INIT
 
 void tablefile_init__(void) {  TABLEFILE_INIT();  }
@@ -217,6 +252,10 @@ int get_TABLEFILE_TYPE(char *FILENAME) {
   if ( ISFILE_ROOT (FILENAME) ) { return IFILETYPE_ROOT ; }
 #endif
 
+#ifdef USE_BIN
+  if ( ISFILE_BIN (FILENAME) ) { return IFILETYPE_BIN ; }
+#endif
+
 #ifdef USE_ROOT
   if ( ISFILE_TEXT (FILENAME) ) { return IFILETYPE_TEXT ; }
 #endif
@@ -250,6 +289,13 @@ int TABLEFILE_OPEN(char *FILENAME, char *STRINGOPT) {
   //   STRINGOPT = 'new'       ! open new file, use suffix for file-type
   //   STRINGOPT = 'READ q'    ! open existing file, quiet mode
   //   STRINGOPT = 'NEW ROOT'  ! open new root file, ignore suffix.
+  //   STRINGOPT = 'NEW zlevel=4 basket=256000 imt=4'  ! ROOT tuning
+  //
+  // ROOT write options (KEY=VALUE; Oct 2026):
+  // -  zlevel=N     -> compression level 0-9
+  // -  basket=N     -> basket size in bytes for each branch
+  // -  autoflush=N  -> flush baskets every N entries (N<0: -N bytes)
+  // -  imt=N        -> N threads for ROOT implicit multi-threading
   //
   // Finally, at any given time 1 NEW and 1 OLD file can be
   // opened for each file type so that reading and writing
@@ -261,7 +307,7 @@ int TABLEFILE_OPEN(char *FILENAME, char *STRINGOPT) {
   // Jul 13 2020: declare *ENV and *FMT (used if HBOOK is NOT defined)
 
   int  OPEN_FLAG, TYPE_FLAG, OPT_Q, USE_CURRENT, IERR ;
-  char *ptrtok, local_STRINGOPT[80], ctmp[20], *FMT, ENV[200] ;
+  char *ptrtok, local_STRINGOPT[200], ctmp[40], *FMT, ENV[200] ;
   char fnam[] = "TABLEFILE_OPEN" ;
 
   // ---------------------- BEGIN ---------------------
@@ -278,6 +324,9 @@ int TABLEFILE_OPEN(char *FILENAME, char *STRINGOPT) {
   // define extensions
   char key_root[]  = "root";
   char key_text[]  = "text" ;
+  char key_bin[]   = "bin" ;
+  char key_compress[] = "compress" ;  // for bin only
+  int  OPT_COMPRESS = 0 ;
 
   sprintf(local_STRINGOPT,"%s", STRINGOPT);
   ptrtok = strtok(local_STRINGOPT," "); // split string
@@ -300,6 +349,15 @@ int TABLEFILE_OPEN(char *FILENAME, char *STRINGOPT) {
     else if ( strcmp_ignoreCase(ctmp,key_text) == 0 ) 
       { TYPE_FLAG = IFILETYPE_TEXT ; }
 
+    else if ( strcmp_ignoreCase(ctmp,key_bin) == 0 ) 
+      { TYPE_FLAG = IFILETYPE_BIN ; }
+
+    else if ( strcmp_ignoreCase(ctmp,key_compress) == 0 ) 
+      { OPT_COMPRESS = 1 ; }
+
+    else if ( strchr(ctmp,'=') != NULL ) 
+      { parse_ROOTFILE_OPT(ctmp, STRINGOPT); }
+
     else {
       sprintf(MSGERR1,"Invalid option '%s'", ctmp);
       sprintf(MSGERR2,"in STRINGOPT = '%s' ", STRINGOPT);
@@ -333,6 +391,11 @@ int TABLEFILE_OPEN(char *FILENAME, char *STRINGOPT) {
     if ( TYPE_FLAG > 0 ) { goto ISFILE_DONE ; }
 #endif
 
+#ifdef USE_BIN
+    if ( ISFILE_BIN(FILENAME) )  {  TYPE_FLAG = IFILETYPE_BIN ; }
+    if ( TYPE_FLAG > 0 ) { goto ISFILE_DONE ; }
+#endif
+
 #ifdef USE_TEXT
     // Oct 2014: this works for read-mode only because for writing
     // FILENAME is a prefix.
@@ -438,6 +501,19 @@ int TABLEFILE_OPEN(char *FILENAME, char *STRINGOPT) {
   }
 #endif
 
+#ifdef USE_BIN
+  if ( TYPE_FLAG == IFILETYPE_BIN ) {
+    if ( OPEN_FLAG == OPENFLAG_NEW ) {
+      char *PREFIX = FILENAME ;
+      INIT_BINFILES(PREFIX, OPT_COMPRESS) ; 
+      NOPEN_TABLEFILE++ ;
+      IERR = 0 ;
+    }
+    else 
+      { OPEN_BINFILE(FILENAME); }
+  }
+#endif
+
 #ifdef USE_MARZ
   if ( TYPE_FLAG == IFILETYPE_MARZ ) {
     OPEN_MARZFILE(FILENAME, &IERR);
@@ -459,6 +535,42 @@ int TABLEFILE_OPEN(char *FILENAME, char *STRINGOPT) {
 int  tablefile_open__(char *FILENAME, char *STRINGOPT) {
   return TABLEFILE_OPEN(FILENAME,STRINGOPT);
 }
+
+
+// ===================================
+void parse_ROOTFILE_OPT(char *KEYVAL, char *STRINGOPT) {
+
+  // Created Oct 2026
+  // Parse KEY=VALUE option from TABLEFILE_OPEN and store in
+  // ROOTFILE_OPT; used by OPEN_ROOTFILE and when trees are booked.
+  // Abort on unknown key.
+
+  char KEY[40], *ptrVal ;
+  char fnam[] = "parse_ROOTFILE_OPT" ;
+
+  // ---------------- BEGIN --------------
+
+  sprintf(KEY, "%s", KEYVAL);
+  ptrVal  = strchr(KEY,'=');
+  *ptrVal = 0 ;  ptrVal++ ;
+
+  if ( strcmp_ignoreCase(KEY,(char*)"zlevel") == 0 ) 
+    { sscanf(ptrVal, "%d", &ROOTFILE_OPT.ZLEVEL); }
+  else if ( strcmp_ignoreCase(KEY,(char*)"basket") == 0 ) 
+    { sscanf(ptrVal, "%d", &ROOTFILE_OPT.BASKET); }
+  else if ( strcmp_ignoreCase(KEY,(char*)"autoflush") == 0 ) 
+    { sscanf(ptrVal, "%lld", &ROOTFILE_OPT.AUTOFLUSH); }
+  else if ( strcmp_ignoreCase(KEY,(char*)"imt") == 0 ) 
+    { sscanf(ptrVal, "%d", &ROOTFILE_OPT.NTHREAD_IMT); }
+  else {
+    sprintf(MSGERR1,"Invalid option '%s'", KEYVAL);
+    sprintf(MSGERR2,"in STRINGOPT = '%s' ", STRINGOPT);
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2); 
+  }
+
+  return ;
+
+} // end parse_ROOTFILE_OPT
 		      
 
 // ===================================
@@ -520,6 +632,11 @@ void TABLEFILE_CLOSE(char *FILENAME) {
     { CLOSE_TEXTFILE(); }
 #endif
 
+#ifdef USE_BIN
+  if(TYPE_FLAG == IFILETYPE_BIN ) 
+    { CLOSE_BINFILE(); }
+#endif
+
   
 #ifdef USE_MARZ
   if(TYPE_FLAG == IFILETYPE_MARZ ) 
@@ -598,6 +715,11 @@ void SNTABLE_CREATE(int IDTABLE, char *NAME, char *TEXT_FORMAT) {
   if ( USE ) { SNTABLE_CREATE_TEXT(IDTABLE,NAME,TEXT_FORMAT);  } 
 #endif
 
+#ifdef USE_BIN
+  USE = USE_TABLEFILE[OPENFLAG_NEW][IFILETYPE_BIN] ;
+  if ( USE ) { SNTABLE_CREATE_BIN(IDTABLE,NAME,TEXT_FORMAT);  } 
+#endif
+
  
   fflush(stdout);
 
@@ -632,6 +754,11 @@ void SNTABLE_FILL(int IDTABLE ) {
   if ( USE ) { SNTABLE_FILL_TEXT(IDTABLE); }
 #endif
 
+#ifdef USE_BIN
+  USE = USE_TABLEFILE[OPENFLAG_NEW][IFILETYPE_BIN] ; 
+  if ( USE ) { SNTABLE_FILL_BIN(IDTABLE); }
+#endif
+
 
 } // end of SNTABLE_FILL
 
@@ -706,6 +833,13 @@ void SNTABLE_ADDCOL(int IDTABLE, char *BLOCK, void* PTRVAR,
     { SNTABLE_ADDCOL_TEXT(IDTABLE, PTRVAR, &ADDCOL_VARDEF); }
 #endif
 
+#ifdef USE_BIN
+  // same column subset as TEXT
+  USE = USE_TABLEFILE[OPENFLAG_NEW][IFILETYPE_BIN] ; 
+  if ( USE && USE4TEXT ) 
+    { SNTABLE_ADDCOL_BIN(IDTABLE, PTRVAR, &ADDCOL_VARDEF); }
+#endif
+
   return;
 } // end of SNTABLE_ADDCOL
 
@@ -1057,6 +1191,7 @@ int SNTABLE_READPREP(int IFILETYPE, char *TABLENAME) {
   READTABLE_POINTERS.IFILETYPE = IFILETYPE_NULL ;
   READTABLE_POINTERS.NROW      = 0 ;
   READTABLE_POINTERS.FP_DUMP   = NULL ;
+  READTABLE_POINTERS.NCUT      = 0 ;
   for(ivar=0; ivar < MXVAR_TABLE; ivar++ ) {
     READTABLE_POINTERS.NPTR[ivar] = 0 ;
     sprintf(READTABLE_POINTERS.VARNAME[ivar], "unknown");
@@ -1090,6 +1225,12 @@ int SNTABLE_READPREP(int IFILETYPE, char *TABLENAME) {
   }
 #endif
 
+#ifdef USE_BIN
+  if ( IFILETYPE == IFILETYPE_BIN ) {
+    NVAR = SNTABLE_READPREP_BIN(); 
+  }
+#endif
+
   // store file type and name of table
   READTABLE_POINTERS.NVAR_TOT  = NVAR ;
   READTABLE_POINTERS.IFILETYPE = IFILETYPE ;
@@ -1504,6 +1645,12 @@ int SNTABLE_READ_EXEC(void) {
     NROW = SNTABLE_READ_EXEC_TEXT();
   }
 #endif
+
+#ifdef USE_BIN
+  if ( IFILETYPE == IFILETYPE_BIN ) {
+    NROW = SNTABLE_READ_EXEC_BIN();
+  }
+#endif
   
   // sanity check
   if ( NROW == -777 ) {
@@ -1525,6 +1672,94 @@ int SNTABLE_READ_EXEC(void) {
 
 } // end of  SNTABLE_READ_EXEC
 
+
+// ============================================
+int SNTABLE_READPREP_CUT(char *varName, double cutMin, double cutMax) {
+
+  // Created Oct 2026
+  // Call after SNTABLE_READPREP to select rows with
+  //   cutMin <= varName <= cutMax
+  // while the table is parsed, so that rejected rows are never
+  // stored (or dumped). varName need not be on the READ-list.
+  // Implemented for TEXT and SNBIN tables only.
+  // Function returns absolute IVAR index of varName.
+
+  int  IFILETYPE = READTABLE_POINTERS.IFILETYPE ;
+  int  NCUT      = READTABLE_POINTERS.NCUT ;
+  int  ivar, IVAR = -9 ;
+  char fnam[] = "SNTABLE_READPREP_CUT" ;
+
+  // ------------ BEGIN -------------
+
+  if ( IFILETYPE != IFILETYPE_TEXT && IFILETYPE != IFILETYPE_BIN ) {
+    sprintf(MSGERR1,"Cannot apply cut on %s for %s table",
+	    varName, STRING_TABLEFILE_TYPE[IFILETYPE] );
+    sprintf(MSGERR2,"Row cuts are implemented only for TEXT and SNBIN.");
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2); 
+  }
+
+  if ( NCUT >= MXCUT_READTABLE ) {
+    sprintf(MSGERR1,"NCUT exceeds bound MXCUT_READTABLE=%d", 
+	    MXCUT_READTABLE );
+    sprintf(MSGERR2,"Check cut on %s", varName);
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2); 
+  }
+
+  for(ivar=0; ivar < READTABLE_POINTERS.NVAR_TOT; ivar++ ) {
+    if ( strcmp(READTABLE_POINTERS.VARNAME[ivar],varName) == 0 ) 
+      { IVAR = ivar; break; }
+  }
+
+  if ( IVAR < 0 ) {
+    sprintf(MSGERR1,"Cannot find cut-variable '%s'", varName);
+    sprintf(MSGERR2,"in table = '%s'", READTABLE_POINTERS.TABLENAME );
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2); 
+  }
+
+  READTABLE_POINTERS.IVAR_CUT[NCUT]  = IVAR ;
+  READTABLE_POINTERS.CUTWIN[NCUT][0] = cutMin ;
+  READTABLE_POINTERS.CUTWIN[NCUT][1] = cutMax ;
+  READTABLE_POINTERS.NCUT++ ;
+
+  printf("\t Select rows with %g <= %s <= %g \n", 
+	 cutMin, varName, cutMax);
+  fflush(stdout);
+
+  return IVAR ;
+
+} // end SNTABLE_READPREP_CUT
+
+bool pass_cuts_READTABLE(int icut, double DVAL) {
+  return ( DVAL >= READTABLE_POINTERS.CUTWIN[icut][0] &&
+	   DVAL <= READTABLE_POINTERS.CUTWIN[icut][1] ) ;
+} // end pass_cuts_READTABLE
+
+// ============================================
+void SNTABLE_DUMP_CUT(char *varName, double cutMin, double cutMax) {
+
+  // Created Oct 2026
+  // Store cut to be applied in the next call to SNTABLE_DUMP_VALUES,
+  // which calls SNTABLE_READPREP (and thus resets READTABLE_POINTERS).
+
+  int  NCUT = DUMPCUT_INFO.NCUT ;
+  char fnam[] = "SNTABLE_DUMP_CUT" ;
+
+  // ------------ BEGIN -------------
+
+  if ( NCUT >= MXCUT_READTABLE ) {
+    sprintf(MSGERR1,"NCUT exceeds bound MXCUT_READTABLE=%d", 
+	    MXCUT_READTABLE );
+    sprintf(MSGERR2,"Check cut on %s", varName);
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2); 
+  }
+
+  sprintf(DUMPCUT_INFO.VARNAME[NCUT], "%s", varName);
+  DUMPCUT_INFO.CUTWIN[NCUT][0] = cutMin ;
+  DUMPCUT_INFO.CUTWIN[NCUT][1] = cutMax ;
+  DUMPCUT_INFO.NCUT++ ;
+
+} // end SNTABLE_DUMP_CUT
+
 // =====================================
 void SNTABLE_LIST(char *FILENAME) {
 
@@ -1658,6 +1893,8 @@ int SNTABLE_DUMP_VALUES(char *FILENAME, char *TABLENAME,
   //
   // Jul 22 2017: if LINEKEY == "IGNORE:" then write out char BAND
   // Oct 31 2019: give better error message if NPTFIT is missing.
+  // Oct 15 2026: apply cuts from SNTABLE_DUMP_CUT while reading,
+  //              and skip TABLEFILE_CLOSE for TEXT & SNBIN.
 
   int  NREAD = 0 ;
   char msg[80] ;
@@ -1713,6 +1950,13 @@ int SNTABLE_DUMP_VALUES(char *FILENAME, char *TABLENAME,
   }
 
 
+  // Oct 2026: row cuts evaluated while reading
+  for(ivar=0; ivar < DUMPCUT_INFO.NCUT; ivar++ ) {
+    SNTABLE_READPREP_CUT(DUMPCUT_INFO.VARNAME[ivar], 
+			 DUMPCUT_INFO.CUTWIN[ivar][0], 
+			 DUMPCUT_INFO.CUTWIN[ivar][1] );
+  }
+
   // store misc info.
   READTABLE_POINTERS.FP_DUMP   = FP_OUTFILE ;
   sprintf(READTABLE_POINTERS.LINEKEY_DUMP,"%s", LINEKEY_DUMP);
@@ -1721,8 +1965,10 @@ int SNTABLE_DUMP_VALUES(char *FILENAME, char *TABLENAME,
   // do the read & write
   NREAD = SNTABLE_READ_EXEC();
 
-  // close file that was read.
-  TABLEFILE_CLOSE(FILENAME);
+  // close file that was read; TEXT and SNBIN readers already
+  // closed the file at the end of SNTABLE_READ_EXEC.
+  if ( IFILETYPE != IFILETYPE_TEXT && IFILETYPE != IFILETYPE_BIN ) 
+    { TABLEFILE_CLOSE(FILENAME); }
 
   return NREAD ;
 
@@ -1896,7 +2142,8 @@ int SNTABLE_AUTOSTORE_INIT(char *fileName, char *tableName,
   //  *varList   : comma-separated list of variables to read/store
   //               varList = 'ALL' --> read everything.
   //   optMask   : mask of options (was vboseflag)
-  //      1=print, 2=abort if no varname matches, 4=append next file
+  //      1=print, 2=abort if no varname matches, 4=append next file,
+  //      8=keep previous autostores after reads (implies 4)
   //
   // Output:
   //   Function returns number of table entries/rows.
@@ -1922,8 +2169,14 @@ int SNTABLE_AUTOSTORE_INIT(char *fileName, char *tableName,
   // Oct 14 2020: 
   //   + fix ABORT feature if no variable name matches
   //   + use catVarList_with_comma util
+  //
+  // Oct 15 2026: 
+  //   + build CCID hash index for SNTABLE_AUTOSTORE_READ
+  //   + optMask & 8 -> keep (append to) previous autostores even 
+  //     after SNTABLE_AUTOSTORE_READ calls, so that several autostore
+  //     users can co-exist.
 
-  bool APPEND_FLAG, ABORT_FLAG;
+  bool APPEND_FLAG, ABORT_FLAG, KEEP_FLAG ;
   int  IFILETYPE, NF, ICAST, UNIQUE ;
   int  NVAR_USR, ivar, NROW, i, indx ;
   char *ptrtok, *tmpVar, varName_withCast[MXCHAR_VARNAME];
@@ -1940,13 +2193,23 @@ int SNTABLE_AUTOSTORE_INIT(char *fileName, char *tableName,
   if ( CALLED_TABLEFILE_INIT != 740 ) { TABLEFILE_INIT();  }
   printf("   %s\n", fnam); fflush(stdout);
 
-  // May 2022:
-  // after reading autostore, reset NFILE for different autostore usage
-  if ( NREAD_AUTOSTORE > 0 ) { NFILE_AUTOSTORE = NREAD_AUTOSTORE = 0; } 
-
   // check option to store multiple files
   ABORT_FLAG  = ( optMask & 2 ) ;
   APPEND_FLAG = ( optMask & 4 ) ; // append more variables
+  KEEP_FLAG   = ( optMask & 8 ) ; // keep previous autostores
+  if ( KEEP_FLAG ) { APPEND_FLAG = true; }
+
+  // May 2022:
+  // after reading autostore, reset NFILE for different autostore usage
+  if ( NREAD_AUTOSTORE > 0 && !KEEP_FLAG ) 
+    { NFILE_AUTOSTORE = NREAD_AUTOSTORE = 0; } 
+
+  if ( NFILE_AUTOSTORE >= MXFILE_AUTOSTORE && APPEND_FLAG ) {
+    sprintf(MSGERR1,"Cannot autostore more than MXFILE_AUTOSTORE=%d files",
+	    MXFILE_AUTOSTORE);
+    sprintf(MSGERR2,"Check %s", fileName);
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2); 
+  }
   if ( APPEND_FLAG || NFILE_AUTOSTORE==0 ) { NFILE_AUTOSTORE++ ; }
 	
 
@@ -2099,6 +2362,8 @@ int SNTABLE_AUTOSTORE_INIT(char *fileName, char *tableName,
     SNTABLE_AUTOSTORE[NF].LENCCID[i] = strlen(ptrCCID);
   } 
 
+  hash_autostore(NF);
+
   // init LASTREAD quantities
   LASTREAD_AUTOSTORE.IFILE = -9;
   LASTREAD_AUTOSTORE.IROW  = -9;
@@ -2365,10 +2630,13 @@ void SNTABLE_AUTOSTORE_READ(char *CCID, char *VARNAME, int *ISTAT,
   //
   // Oct 20 2020:
   //   + do NOT abort on missing varname; instead, return ISTAT = -2
+  //
+  // Oct 15 2026: find row with IROW_AUTOSTORE (hash) instead of
+  //              string-compare loop over all rows.
 
   int IVAR_READ, IFILE_READ, ivar, i ;
-  int NVAR_USR, NROW_TOT, ICAST, LENCCID, IROW ;
-  char *tmpCCID, *tmpVar;
+  int NVAR_USR, ICAST, IROW ;
+  char *tmpVar;
   
   char fnam[] = "SNTABLE_AUTOSTORE_READ" ;
 
@@ -2394,8 +2662,6 @@ void SNTABLE_AUTOSTORE_READ(char *CCID, char *VARNAME, int *ISTAT,
  FIND_CCID:
 
   ICAST    = SNTABLE_AUTOSTORE[IFILE_READ].ICAST_READ[IVAR_READ] ;    
-  NROW_TOT = SNTABLE_AUTOSTORE[IFILE_READ].NROW ; // total number of rows read
-  LENCCID  = strlen(CCID);
 
   // if IFILE and CCID are the same as last time, 
   // skip slow check of all CCIDs
@@ -2405,13 +2671,7 @@ void SNTABLE_AUTOSTORE_READ(char *CCID, char *VARNAME, int *ISTAT,
   if (IS_SAME_FILE && IS_SAME_CCID ) 
     { IROW =  LASTREAD_AUTOSTORE.IROW ;  goto SET_OUTVAL; }
 
-  // do slow loop over each row and do CCID string match each row.
-  for(i=0; i < NROW_TOT; i++ ) {
-    tmpCCID = SNTABLE_AUTOSTORE[IFILE_READ].CCID[i] ;
-    if ( tmpCCID[0] != CCID[0] ) { continue ; } // quick check first char
-    if ( strcmp(tmpCCID,CCID) == 0 )  { IROW = i ;  goto SET_OUTVAL ; }
-  }
-
+  IROW = IROW_AUTOSTORE(IFILE_READ, CCID);
   if ( IROW < 0 ) { return ; } // could not find CCID
 
  SET_OUTVAL:
@@ -2440,6 +2700,123 @@ void sntable_autostore_read__(char *CCID, char *varName, int *ISTAT,
 }
 
 
+
+// =================================================
+void SNTABLE_AUTOSTORE_READ_LIST(char *VARNAME, int NCID, char **CCID_LIST,
+				 int *ISTAT_LIST, double *DVAL_LIST) {
+
+  // Created Oct 2026
+  // Batch version of SNTABLE_AUTOSTORE_READ for numeric VARNAME:
+  // varName is searched once, then each CCID_LIST[i] is found
+  // with the hash index.
+  // Output ISTAT_LIST[i] is the same as ISTAT for 
+  // SNTABLE_AUTOSTORE_READ; DVAL_LIST[i] is set only if ISTAT=0.
+
+  int i, ivar, IVAR_READ = -9, IFILE_READ = -9, IROW ;
+  char fnam[] = "SNTABLE_AUTOSTORE_READ_LIST" ;
+
+  // ------------- BEGIN --------------
+
+  NREAD_AUTOSTORE++ ;
+
+  for(i=0; i < NFILE_AUTOSTORE && IVAR_READ < 0; i++ ) {
+    for(ivar=0; ivar < SNTABLE_AUTOSTORE[i].NVAR; ivar++ ) {
+      if ( strcmp(SNTABLE_AUTOSTORE[i].VARNAME[ivar],VARNAME) == 0 ) 
+	{ IVAR_READ = ivar ; IFILE_READ = i ;  break; }
+    }
+  }
+
+  if ( IVAR_READ < 0 ) {
+    for(i=0; i < NCID; i++ ) { ISTAT_LIST[i] = -2; }
+    return ;
+  }
+
+  if ( SNTABLE_AUTOSTORE[IFILE_READ].ICAST_READ[IVAR_READ] == ICAST_C ) {
+    sprintf(MSGERR1,"Cannot batch-read string variable %s", VARNAME);
+    sprintf(MSGERR2,"Use SNTABLE_AUTOSTORE_READ for strings.");
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2); 
+  }
+
+  for(i=0; i < NCID; i++ ) {
+    IROW = IROW_AUTOSTORE(IFILE_READ, CCID_LIST[i]);
+    if ( IROW < 0 ) { ISTAT_LIST[i] = -1;  continue; }
+    ISTAT_LIST[i] = 0 ;
+    DVAL_LIST[i]  = SNTABLE_AUTOSTORE[IFILE_READ].DVAL[IVAR_READ][IROW];
+  }
+
+  return ;
+
+} // end SNTABLE_AUTOSTORE_READ_LIST
+
+
+// =================================================
+unsigned int hashval_autostore(char *CCID) {
+  // FNV-1a string hash
+  unsigned int h = 2166136261u ;
+  unsigned char *c ;
+  for(c = (unsigned char*)CCID; *c; c++ ) { h ^= *c;  h *= 16777619u; }
+  return h ;
+} // end hashval_autostore
+
+// =================================================
+void hash_autostore(int IFILE) {
+
+  // Created Oct 2026
+  // Build open-addressing hash index CCID -> row for autostore IFILE.
+  // For a repeated CCID, the first row is kept (same as the original 
+  // row-loop search in SNTABLE_AUTOSTORE_READ).
+
+  int  NROW  = SNTABLE_AUTOSTORE[IFILE].NROW ;
+  int  NHASH = 16, MASK, irow, islot, jrow ;
+  char *ccid ;
+
+  // ------------ BEGIN -------------
+
+  while ( NHASH < 2*NROW ) { NHASH *= 2; }
+  MASK = NHASH - 1 ;
+
+  if ( SNTABLE_AUTOSTORE[IFILE].NHASH > 0 ) 
+    { free(SNTABLE_AUTOSTORE[IFILE].HASH_IROW); }
+  SNTABLE_AUTOSTORE[IFILE].NHASH     = NHASH ;
+  SNTABLE_AUTOSTORE[IFILE].HASH_IROW = (int*)malloc(NHASH*sizeof(int));
+  for(islot=0; islot < NHASH; islot++ ) 
+    { SNTABLE_AUTOSTORE[IFILE].HASH_IROW[islot] = -1; }
+
+  for(irow=0; irow < NROW; irow++ ) {
+    ccid  = SNTABLE_AUTOSTORE[IFILE].CCID[irow] ;
+    islot = hashval_autostore(ccid) & MASK ;
+    while ( (jrow = SNTABLE_AUTOSTORE[IFILE].HASH_IROW[islot]) >= 0 ) {
+      if ( strcmp(SNTABLE_AUTOSTORE[IFILE].CCID[jrow],ccid) == 0 ) 
+	{ break; }
+      islot = (islot+1) & MASK ;
+    }
+    if ( jrow < 0 ) { SNTABLE_AUTOSTORE[IFILE].HASH_IROW[islot] = irow; }
+  }
+
+} // end hash_autostore
+
+// =================================================
+int IROW_AUTOSTORE(int IFILE, char *CCID) {
+
+  // Created Oct 2026
+  // Return row index of CCID in autostore IFILE, or -9 if not found.
+
+  int  NHASH = SNTABLE_AUTOSTORE[IFILE].NHASH ;
+  int  islot, irow ;
+
+  if ( NHASH == 0 ) { return -9; }
+
+  islot = hashval_autostore(CCID) & (NHASH-1) ;
+  while ( (irow = SNTABLE_AUTOSTORE[IFILE].HASH_IROW[islot]) >= 0 ) {
+    if ( strcmp(SNTABLE_AUTOSTORE[IFILE].CCID[irow],CCID) == 0 ) 
+      { return irow; }
+    islot = (islot+1) & (NHASH-1) ;
+  }
+  return -9 ;
+
+} // end IROW_AUTOSTORE
+
+
 void fetch_autostore_ccid(int ifile, int isn, char *ccid) {
   // Created Jan 4 2021
   // If autostore CID names are not known, pass indices here to
@@ -2465,6 +2842,13 @@ void SNTABLE_VARNAMES(char *FILENAME, char *VARNAMES) {
 
   // ------- BEGIN ---------
 
+#ifdef USE_BIN
+  if ( ISFILE_BIN(FILENAME) ) {
+    SNTABLE_VARNAMES_BIN(FILENAME, VARNAMES);
+    return ;
+  }
+#endif
+
 #ifdef USE_TEXT
   ISOPEN_DEJA = USE_TABLEFILE[OPENFLAG_READ][IFILETYPE_TEXT] ;
   ISTYPE_TEXT = ISFILE_TEXT(FILENAME); 
@@ -2518,6 +2902,14 @@ int SNTABLE_NEVT(char *FILENAME, char *TABLENAME) {
   }
 #endif
 
+#ifdef USE_BIN
+  ISOPEN_DEJA = USE_TABLEFILE[OPENFLAG_READ][IFILETYPE_BIN] ;
+  if ( ISOPEN_DEJA || ISFILE_BIN(FILENAME) ) {
+    NEVT = SNTABLE_NEVT_BIN(FILENAME); 
+    return(NEVT);
+  }
+#endif
+
 #ifdef USE_TEXT
   ISOPEN_DEJA = USE_TABLEFILE[OPENFLAG_READ][IFILETYPE_TEXT] ;
   ISTYPE_TEXT = ISFILE_TEXT(FILENAME); 
@@ -32,6 +32,11 @@
 
  Aug 29 2025: MXVAR_TABLE -> 800 (was 400)
 
+ Oct 14 2026: add USE_BIN and IFILETYPE_BIN for columnar binary tables
+ Oct 15 2026: READTABLE_POINTERS row cuts (NCUT, IVAR_CUT, CUTWIN)
+              applied while reading TEXT and SNBIN tables.
+ Oct 15 2026: SNTABLE_AUTOSTORE CCID hash index (NHASH, HASH_IROW).
+
 *******************************************/
 
 
@@ -41,6 +46,7 @@
 #define USE_ROOT    
 #define USE_TEXT  // always leave this on; same logic as for ROOT, ...
 #define USE_MARZ  // always leave this on
+#define USE_BIN   // columnar binary tables (SNBIN); requires zlib
 
 // ---------------------------------------
 // flags to identify TABLEFILE_TYPE 
@@ -50,7 +56,8 @@
 #define IFILETYPE_ROOT   2
 #define IFILETYPE_TEXT   3
 #define IFILETYPE_MARZ   4
-#define MXTABLEFILETYPE  5
+#define IFILETYPE_BIN    5   // columnar binary (Oct 2026)
+#define MXTABLEFILETYPE  6
 
 #define MXCHAR_FILENAME  300
 #define MXCHAR_VARLIST   2000  
@@ -99,6 +106,15 @@ int  FIRSTCALL_TABLEFILE_OPEN[MXTABLEFILETYPE];
 int  NLINE_TABLECOMMENT ;
 char LINE_TABLECOMMENT[MXLINE_TABLECOMMENT][MXCHAR_FILENAME];
 
+// Oct 2026: optional ROOT write tuning via KEY=VALUE in TABLEFILE_OPEN 
+// STRINGOPT; e.g., 'new zlevel=4 basket=256000 autoflush=-30000000 imt=4'
+struct {
+  int       ZLEVEL ;       // compression level (0-9); -1 -> ROOT default
+  int       BASKET ;       // basket size (bytes) per branch; 0 -> default
+  long long AUTOFLUSH ;    // >0: entries, <0: bytes; 0 -> ROOT default
+  int       NTHREAD_IMT ;  // >0 -> ROOT implicit multi-thread compression
+} ROOTFILE_OPT ;
+
 
 // -------------------------------------
 // define a few things from sntools.h so that we don't have to
@@ -136,6 +152,8 @@ typedef struct {
 char ADDCOL_VARLIST_LAST[MXCHAR_VARLIST];
 
 
+#define MXCUT_READTABLE 20  // max row cuts applied while reading
+
 // Oct 14 2014: define struct for storing pointers to read table
 struct READTABLE_POINTERS {
 
@@ -169,8 +187,21 @@ struct READTABLE_POINTERS {
   int    MXLEN ;     // max size of PTRVAL_X arrays (for internal check)
   int    NROW;       // number of rows read from table
 
+  // optional row cuts evaluated while parsing (Oct 2026);
+  // rows failing any cut are not stored or dumped.
+  int    NCUT ;
+  int    IVAR_CUT[MXCUT_READTABLE];
+  double CUTWIN[MXCUT_READTABLE][2];
+
 } READTABLE_POINTERS ;
 
+// cuts requested before SNTABLE_DUMP_VALUES (which calls READPREP)
+struct DUMPCUT_INFO {
+  int    NCUT ;
+  char   VARNAME[MXCUT_READTABLE][MXCHAR_VARNAME];
+  double CUTWIN[MXCUT_READTABLE][2];
+} DUMPCUT_INFO ;
+
 
 // -------------------------------------------------
 // SNLCPAK global declarations for light curves
@@ -345,6 +376,10 @@ struct SNTABLE_AUTOSTORE {
   double  **DVAL ;
   char    ***CVAL ;
 
+  // Oct 2026: open-addressing hash of CCID -> row (first row per CCID)
+  int     NHASH ;      // table size (power of 2), or 0
+  int     *HASH_IROW ; // row index for each slot, -1 -> empty
+
 } SNTABLE_AUTOSTORE[MXFILE_AUTOSTORE] ;
 
 
@@ -399,6 +434,7 @@ extern"C" {
 
   int  TABLEFILE_OPEN(char *FILENAME, char *STRINGOPT); // return file type
   int  tablefile_open__(char *FILENAME, char *STRINGOPT);
+  void parse_ROOTFILE_OPT(char *KEYVAL, char *STRINGOPT);
 
   void TABLEFILE_CLOSE(char *FILENAME) ;
   void tablefile_close__(char *FILENAME) ;
@@ -484,6 +520,9 @@ extern"C" {
   int sntable_readprep_vardef1(char *VARNAME_withCast, void *ptr, 
 			       int mxlen, int vboseflag, char *varName_noCast);
   int SNTABLE_READ_EXEC(void);
+  int  SNTABLE_READPREP_CUT(char *varName, double cutMin, double cutMax);
+  bool pass_cuts_READTABLE(int icut, double DVAL);
+  void SNTABLE_DUMP_CUT(char *varName, double cutMin, double cutMax);
 
   int  IVAR_READTABLE_POINTER(char *varName) ;
   void load_READTABLE_POINTER(int IROW, int IVAR, double DVAL, char *CVAL) ;
@@ -507,6 +546,12 @@ extern"C" {
   void sntable_autostore_read__(char *CCID, char *varName, int *ISTAT,
 				double *DVAL, char *CVAL);  // output value
   
+  void SNTABLE_AUTOSTORE_READ_LIST(char *varName, int NCID, char **CCID_LIST,
+				   int *ISTAT_LIST, double *DVAL_LIST);
+  int  IROW_AUTOSTORE(int IFILE, char *CCID);
+  void hash_autostore(int IFILE);
+  unsigned int hashval_autostore(char *CCID);
+
   void fetch_autostore_ccid(int ifile, int isn, char *ccid);
   void fetch_autostore_ccid__(int *ifile, int *isn, char *ccid);
 
@@ -608,6 +653,7 @@ extern"C" {
   int ISFILE_ROOT(char *fileName);
   int ISFILE_TEXT(char *fileName);
   int ISFILE_MARZ(char *fileName);
+  int ISFILE_BIN(char *fileName);
 				 
 #ifdef __cplusplus
 }          
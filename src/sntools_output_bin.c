@@ -0,0 +1,919 @@
+// **********************************************
+// Created Oct 2026
+//
+// Functions to write and read columnar binary tables (SNBIN format).
+// Intended for large FITRES/SNANA tables (e.g., biasCor) where
+// printf-formatting every value on write, and parsing every word
+// on read, dominates the I/O time for TEXT tables.
+// Columns are the same subset as for TEXT (USE4TEXT); values are
+// stored with their native cast so that there is no precision loss
+// from text formatting.
+//
+// File layout (native byte order):
+//   char  MAGIC[8]                 "SNBIN01"
+//   int   NVAR, COMPRESS, NROW_CHUNK, NCHAR_VARNAMES, NCOMMENT
+//   int   ICAST[NVAR]
+//   char  VARNAMES[NCHAR_VARNAMES] space-separated, as in TEXT header
+//   NCOMMENT x { int LEN ;  char COMMENT[LEN] }
+//   then chunks of up to NROW_CHUNK rows:
+//      int NROW
+//      NVAR x { int NBYTE_RAW, NBYTE_FILE; char DATA[NBYTE_FILE] }
+//   Each column block is contiguous with fixed width per cast;
+//   char columns have MXCHAR_STRING_BIN bytes per row.
+//   COMPRESS=1 -> each column block is zlib-compressed.
+//
+// Write: TABLEFILE_OPEN(PREFIX, "new bin") or ("new bin compress");
+//        file name is [PREFIX].[TBNAME].SNBIN, or PREFIX if it
+//        contains a dot (same as TEXT).
+// Read:  TABLEFILE_OPEN(FILE,"read") recognizes SNBIN suffix,
+//        then SNTABLE_READPREP, SNTABLE_READPREP_VARDEF and
+//        SNTABLE_READ_EXEC as for TEXT. Only requested columns are
+//        decoded; other column blocks are skipped with fseek.
+//
+// **********************************************
+
+#include <zlib.h>
+
+#define MXTABLE_BIN       10
+#define MXCHAR_STRING_BIN 40      // bytes per char-column value
+#define NROW_CHUNK_BIN    4096    // rows per chunk
+#define MAGIC_BIN         "SNBIN01"
+#define SUFFIX_BIN        "SNBIN"
+
+char FILEPREFIX_BIN[MXCHAR_FILENAME];
+int  COMPRESS_BIN ;    // set by TABLEFILE_OPEN 'compress' option
+
+// structure for writing table
+struct TABLEINFO_BIN {
+  int    NTABLE ;
+  int    IDTABLE[MXTABLE_BIN] ;
+  char   TBNAME[MXTABLE_BIN][40] ;
+  char   FILENAME[MXTABLE_BIN][MXCHAR_FILENAME] ;
+  FILE  *FP[MXTABLE_BIN] ;
+  int    SKIP[MXTABLE_BIN] ;          // TEXT_FORMAT='none' -> skip
+
+  int    NVAR[MXTABLE_BIN] ;
+  char  *VARLIST[MXTABLE_BIN] ;       // space-separated VARNAMES
+  int   *ICAST[MXTABLE_BIN] ;
+  void **PTRVAR[MXTABLE_BIN] ;        // pointer to each variable
+
+  int    NFILL[MXTABLE_BIN] ;         // total rows
+  int    NROW_BUF[MXTABLE_BIN] ;      // rows in current chunk buffer
+  char **BUF[MXTABLE_BIN] ;           // column buffer per var
+} TABLEINFO_BIN ;
+
+
+// structure for reading table
+struct READINFO_BIN {
+  FILE *FP ;
+  char  FILENAME[MXCHAR_FILENAME];
+  int   NVAR, COMPRESS, NROW_CHUNK ;
+  int   ICAST[MXVAR_TABLE];
+  long  OFFSET_DATA ;   // file offset of first chunk
+} READINFO_BIN ;
+
+
+// -----------------------------
+
+#ifdef __cplusplus
+extern"C" {
+#endif
+
+  int  ISFILE_BIN(char *fileName) ;
+  int  NBYTE_ICAST_BIN(int ICAST);
+
+  void INIT_BINFILES(char *PREFIX, int COMPRESS) ;
+  void SNTABLE_CREATE_BIN(int IDTABLE, char *TBNAME, char *TEXT_FORMAT);
+  void SNTABLE_ADDCOL_BIN(int IDTABLE, void *PTRVAR,
+			  SNTABLE_ADDCOL_VARDEF *ADDCOL_VARDEF) ;
+  void SNTABLE_FILL_BIN(int IDTABLE);
+  int  ITABLE_BIN(int IDTABLE, char *FUNNAM, int OPT_ABORT ) ;
+  void SNTABLE_WRITE_HEADER_BIN(int ITAB);
+  void SNTABLE_FLUSH_BIN(int ITAB);
+  void CLOSE_BINFILE(void);
+
+  void OPEN_BINFILE(char *FILENAME);
+  void read_header_BIN(FILE *fp, char *FILENAME, int OPT_STORE);
+  int  read_column_BIN(int NBYTE_RAW, int NBYTE_FILE, char *BUF,
+		       char *BUF_Z, char *callFun);
+  int  SNTABLE_NEVT_BIN(char *FILENAME);
+  void SNTABLE_VARNAMES_BIN(char *FILENAME, char *VARNAMES);
+  int  SNTABLE_READPREP_BIN(void);
+  int  SNTABLE_READ_EXEC_BIN(void);
+  double dval_BIN(int ICAST, char *BUF, int irow);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+// =============================================
+//
+//   BEGIN FUNCTIONS
+//
+// =============================================
+
+int ISFILE_BIN(char *fileName) {
+
+  // returns 1 if suffix corresponds to SNBIN table file
+
+#define NSUFFIX_BIN 2
+  int   isuf ;
+  char  SUFFIX_BIN_LIST[NSUFFIX_BIN][8] = { ".SNBIN" , ".snbin"  } ;
+
+  if ( strlen(fileName) == 0 ) { return 0; }
+  for ( isuf=0; isuf<NSUFFIX_BIN; isuf++ ) {
+    if ( strstr(fileName, SUFFIX_BIN_LIST[isuf] ) != NULL )  { return 1 ; }
+  }
+  return 0;
+
+} // end of ISFILE_BIN
+
+
+// =============================================
+int NBYTE_ICAST_BIN(int ICAST) {
+  // return number of bytes per row for this cast
+  if ( ICAST == ICAST_D ) { return sizeof(double); }
+  if ( ICAST == ICAST_F ) { return sizeof(float);  }
+  if ( ICAST == ICAST_I ) { return sizeof(int);    }
+  if ( ICAST == ICAST_S ) { return sizeof(short int); }
+  if ( ICAST == ICAST_L ) { return sizeof(long long int); }
+  if ( ICAST == ICAST_C ) { return MXCHAR_STRING_BIN ; }
+  return 0 ;
+} // end NBYTE_ICAST_BIN
+
+
+// =============================================
+void INIT_BINFILES(char *PREFIX, int COMPRESS) {
+
+  // store prefix and compress flag; as for TEXT, table files
+  // are opened at the SNTABLE_CREATE stage.
+
+  sprintf(FILEPREFIX_BIN, "%s", PREFIX);
+  COMPRESS_BIN          = COMPRESS ;
+  TABLEINFO_BIN.NTABLE  = 0 ;
+
+} // end of INIT_BINFILES
+
+
+// ============================================
+void SNTABLE_CREATE_BIN(int IDTABLE, char *TBNAME, char *TEXT_FORMAT) {
+
+  // open binary file for this table and allocate column info.
+  // TEXT_FORMAT is used only to skip tables with format 'none'.
+
+  int  NTAB, MX = MXVAR_TABLE ;
+  char FILENAME[MXCHAR_FILENAME];
+  char fnam[] = "SNTABLE_CREATE_BIN" ;
+
+  // --------- BEGIN ---------
+
+  NTAB = TABLEINFO_BIN.NTABLE ;
+  if ( NTAB >= MXTABLE_BIN ) {
+    sprintf(MSGERR1, "NTABLE=%d exceeds bound MXTABLE_BIN=%d",
+	    NTAB+1, MXTABLE_BIN);
+    sprintf(MSGERR2, "IDTABLE=%d  TBNAME=%s", IDTABLE, TBNAME);
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+  }
+  TABLEINFO_BIN.NTABLE++ ;
+
+  if ( strchr(FILEPREFIX_BIN,'.') == NULL )
+    { sprintf(FILENAME, "%s.%s.%s", FILEPREFIX_BIN, TBNAME, SUFFIX_BIN); }
+  else
+    { sprintf(FILENAME, "%s", FILEPREFIX_BIN); }
+
+  TABLEINFO_BIN.IDTABLE[NTAB]  = IDTABLE ;
+  TABLEINFO_BIN.NFILL[NTAB]    = 0 ;
+  TABLEINFO_BIN.NROW_BUF[NTAB] = 0 ;
+  TABLEINFO_BIN.NVAR[NTAB]     = 0 ;
+  TABLEINFO_BIN.FP[NTAB]       = NULL ;
+  sprintf(TABLEINFO_BIN.TBNAME[NTAB],   "%s", TBNAME);
+  sprintf(TABLEINFO_BIN.FILENAME[NTAB], "%s", FILENAME);
+
+  TABLEINFO_BIN.SKIP[NTAB] = ( strcmp(TEXT_FORMAT,"none") == 0 ) ;
+  if ( TABLEINFO_BIN.SKIP[NTAB] ) { return ; }
+
+  printf("  %s: init %s SNBIN-table (COMPRESS=%d) \n",
+	 fnam, TBNAME, COMPRESS_BIN); fflush(stdout);
+
+  TABLEINFO_BIN.FP[NTAB] = fopen(FILENAME, "wb");
+  if ( !TABLEINFO_BIN.FP[NTAB] ) {
+    sprintf(MSGERR1, "Could not open SNBIN FILE = ");
+    sprintf(MSGERR2, "%s", FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+  }
+
+  TABLEINFO_BIN.VARLIST[NTAB]    = (char*) malloc(MXCHAR_VARLIST*4);
+  TABLEINFO_BIN.VARLIST[NTAB][0] = 0 ;
+  TABLEINFO_BIN.ICAST[NTAB]   = (int*)   malloc(MX * sizeof(int)   );
+  TABLEINFO_BIN.PTRVAR[NTAB]  = (void**) malloc(MX * sizeof(void*) );
+  TABLEINFO_BIN.BUF[NTAB]     = (char**) malloc(MX * sizeof(char*) );
+
+} // end of SNTABLE_CREATE_BIN
+
+
+// =============================================
+void SNTABLE_ADDCOL_BIN(int IDTABLE, void *PTRVAR,
+			SNTABLE_ADDCOL_VARDEF *ADDCOL_VARDEF) {
+
+  // store column name, cast and pointer, and allocate chunk buffer.
+
+  int  ITAB, IVAR, ivar, ICAST, NBYTE, LENV ;
+  char VARNAME[MXCHAR_VARNAME], *varList ;
+  char fnam[] = "SNTABLE_ADDCOL_BIN" ;
+
+  // ------------- BEGIN --------------
+
+  ITAB = ITABLE_BIN(IDTABLE, fnam, 1 );
+  if ( TABLEINFO_BIN.SKIP[ITAB] ) { return ; }
+
+  if ( TABLEINFO_BIN.NFILL[ITAB] > 0 ) {
+    sprintf(MSGERR1, "Cannot add column '%s' after first fill",
+	    ADDCOL_VARDEF->VARLIST_ORIG );
+    sprintf(MSGERR2, "IDTABLE = %d", IDTABLE );
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+  }
+
+  for(ivar=0 ; ivar < ADDCOL_VARDEF->NVAR; ivar++ ) {
+
+    IVAR = TABLEINFO_BIN.NVAR[ITAB] ;
+    if ( IVAR >= MXVAR_TABLE ) { continue ; }
+    TABLEINFO_BIN.NVAR[ITAB]++ ;
+
+    // same VARNAME convention as TEXT
+    sprintf(VARNAME, "%s", ADDCOL_VARDEF->VARNAME[ivar] );
+    if ( strcmp(VARNAME,"CCID") == 0 )  { sprintf(VARNAME,"CID") ; }
+
+    varList = TABLEINFO_BIN.VARLIST[ITAB] ;
+    LENV    = strlen(varList) + strlen(VARNAME) + 1 ;
+    if ( LENV >= MXCHAR_VARLIST*4 ) {
+      sprintf(MSGERR1, "len(VARLIST)=%d exceeds bound", LENV);
+      sprintf(MSGERR2, "after adding VARNAME='%s'", VARNAME );
+      errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+    }
+    if ( IVAR > 0 ) { strcat(varList," "); }
+    strcat(varList,VARNAME);
+
+    ICAST = ADDCOL_VARDEF->ICAST[ivar] ;
+    NBYTE = NBYTE_ICAST_BIN(ICAST);
+    if ( NBYTE == 0 ) {
+      sprintf(MSGERR1, "Unknown ICAST=%d for VARNAME='%s'", ICAST, VARNAME);
+      sprintf(MSGERR2, "IDTABLE = %d", IDTABLE );
+      errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+    }
+    TABLEINFO_BIN.ICAST[ITAB][IVAR] = ICAST ;
+
+    if ( ICAST == ICAST_C )
+      { TABLEINFO_BIN.PTRVAR[ITAB][IVAR] = PTRVAR ; }
+    else
+      { TABLEINFO_BIN.PTRVAR[ITAB][IVAR] = (char*)PTRVAR + NBYTE*ivar ; }
+
+    TABLEINFO_BIN.BUF[ITAB][IVAR] = (char*)malloc(NROW_CHUNK_BIN*NBYTE);
+
+  } // end ivar
+
+} // end of SNTABLE_ADDCOL_BIN
+
+
+// =============================================
+int ITABLE_BIN(int IDTABLE, char *FUNNAM, int OPT_ABORT ) {
+
+  // return sparse table index for IDTABLE
+  int i, ITAB = -9 ;
+  char fnam[] = "ITABLE_BIN" ;
+
+  for(i=0; i < TABLEINFO_BIN.NTABLE ; i++ ) {
+    if ( IDTABLE == TABLEINFO_BIN.IDTABLE[i] ) { ITAB = i ; }
+  }
+
+  if ( ITAB < 0 && OPT_ABORT > 0 ) {
+    sprintf(MSGERR1, "%s could not find SNBIN table with ", FUNNAM );
+    sprintf(MSGERR2, "IDTABLE = %d", IDTABLE );
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+  }
+
+  return ITAB ;
+
+} // end of ITABLE_BIN
+
+
+// ==================================================
+void SNTABLE_FILL_BIN(int IDTABLE) {
+
+  // copy current value of each column into chunk buffer;
+  // write chunk when buffer is full.
+  // Header is written on first fill, as for TEXT.
+
+  int  ITAB, IVAR, NVAR, ICAST, NBYTE, IROW ;
+  char *BUF, *STR ;
+  char fnam[] = "SNTABLE_FILL_BIN" ;
+
+  // ------------- BEGIN ------------
+
+  ITAB = ITABLE_BIN(IDTABLE, fnam, 1);
+  if ( TABLEINFO_BIN.SKIP[ITAB] ) { return ; }
+
+  if ( TABLEINFO_BIN.NFILL[ITAB] == 0 ) { SNTABLE_WRITE_HEADER_BIN(ITAB); }
+
+  NVAR = TABLEINFO_BIN.NVAR[ITAB];
+  IROW = TABLEINFO_BIN.NROW_BUF[ITAB];
+
+  for ( IVAR=0; IVAR < NVAR ; IVAR++ ) {
+    ICAST = TABLEINFO_BIN.ICAST[ITAB][IVAR] ;
+    NBYTE = NBYTE_ICAST_BIN(ICAST);
+    BUF   = TABLEINFO_BIN.BUF[ITAB][IVAR] + IROW*NBYTE ;
+    if ( ICAST == ICAST_C ) {
+      STR = (char*)TABLEINFO_BIN.PTRVAR[ITAB][IVAR] ;
+      memset(BUF, 0, NBYTE);
+      strncpy(BUF, STR, NBYTE-1);
+      trim_blank_spaces(BUF);
+    }
+    else
+      { memcpy(BUF, TABLEINFO_BIN.PTRVAR[ITAB][IVAR], NBYTE); }
+  }
+
+  TABLEINFO_BIN.NROW_BUF[ITAB]++ ;
+  TABLEINFO_BIN.NFILL[ITAB]++ ;
+
+  if ( TABLEINFO_BIN.NROW_BUF[ITAB] == NROW_CHUNK_BIN )
+    { SNTABLE_FLUSH_BIN(ITAB); }
+
+} // end of SNTABLE_FILL_BIN
+
+
+// =============================================
+void SNTABLE_WRITE_HEADER_BIN(int ITAB) {
+
+  // write MAGIC, dimensions, casts, VARNAMES and comments.
+
+  FILE *FP     = TABLEINFO_BIN.FP[ITAB] ;
+  int  NVAR    = TABLEINFO_BIN.NVAR[ITAB];
+  char *VARLIST = TABLEINFO_BIN.VARLIST[ITAB];
+  int  NCHAR   = strlen(VARLIST) + 1 ;
+  int  NROWC   = NROW_CHUNK_BIN ;
+  int  NCOMMENT, iline, LEN ;
+  char MAGIC[8], COMMENT[MXCHAR_VERSION_PHOTOMETRY+40];
+  char fnam[] = "SNTABLE_WRITE_HEADER_BIN" ;
+
+  // ------------- BEGIN --------------
+
+  // comments are the same as the TEXT header
+  bool WROTE_VERSION_PHOTOMETRY = false;
+  for(iline=0; iline < NLINE_TABLECOMMENT; iline++ ) {
+    if ( strstr(LINE_TABLECOMMENT[iline],KEYNAME_VERSION_PHOTOMETRY) != NULL )
+      { WROTE_VERSION_PHOTOMETRY = true; }
+  }
+  NCOMMENT = NLINE_TABLECOMMENT + 2 ;
+  if ( strlen(SNTABLE_VERSION_PHOTOMETRY) > 0 && !WROTE_VERSION_PHOTOMETRY)
+    { NCOMMENT++ ; }
+
+  memset(MAGIC, 0, 8);  sprintf(MAGIC, "%s", MAGIC_BIN);
+  fwrite(MAGIC,     1,           8,    FP);
+  fwrite(&NVAR,     sizeof(int), 1,    FP);
+  fwrite(&COMPRESS_BIN, sizeof(int), 1, FP);
+  fwrite(&NROWC,    sizeof(int), 1,    FP);
+  fwrite(&NCHAR,    sizeof(int), 1,    FP);
+  fwrite(&NCOMMENT, sizeof(int), 1,    FP);
+  fwrite(TABLEINFO_BIN.ICAST[ITAB], sizeof(int), NVAR, FP);
+  fwrite(VARLIST,   1,           NCHAR, FP);
+
+  for(iline=0; iline < NCOMMENT; iline++ ) {
+    if ( iline < NLINE_TABLECOMMENT )
+      { sprintf(COMMENT, "%s", LINE_TABLECOMMENT[iline]); }
+    else if ( iline == NLINE_TABLECOMMENT )
+      { sprintf(COMMENT, "SNANA_VERSION: %s", SNANA_VERSION); }
+    else if ( iline == NLINE_TABLECOMMENT+1 )
+      { sprintf(COMMENT, "TABLE_NAME: %s", TABLEINFO_BIN.TBNAME[ITAB]); }
+    else
+      { sprintf(COMMENT, "%s %s", KEYNAME_VERSION_PHOTOMETRY,
+		SNTABLE_VERSION_PHOTOMETRY); }
+    LEN = strlen(COMMENT) + 1 ;
+    fwrite(&LEN,    sizeof(int), 1,   FP);
+    fwrite(COMMENT, 1,           LEN, FP);
+  }
+
+  if ( ferror(FP) ) {
+    sprintf(MSGERR1, "Error writing header for");
+    sprintf(MSGERR2, "%s", TABLEINFO_BIN.FILENAME[ITAB]);
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+  }
+
+} // end SNTABLE_WRITE_HEADER_BIN
+
+
+// =============================================
+void SNTABLE_FLUSH_BIN(int ITAB) {
+
+  // write buffered rows as one chunk; each column is one block.
+
+  FILE *FP   = TABLEINFO_BIN.FP[ITAB] ;
+  int  NROW  = TABLEINFO_BIN.NROW_BUF[ITAB];
+  int  NVAR  = TABLEINFO_BIN.NVAR[ITAB];
+  int  IVAR, NBYTE_RAW, NBYTE_FILE, istat ;
+  uLongf LEN_Z ;
+  char *BUF, *BUF_Z = NULL ;
+  char fnam[] = "SNTABLE_FLUSH_BIN" ;
+
+  // ------------- BEGIN --------------
+
+  if ( NROW == 0 ) { return ; }
+
+  if ( COMPRESS_BIN )
+    { BUF_Z = (char*)malloc(compressBound(NROW_CHUNK_BIN*MXCHAR_STRING_BIN)); }
+
+  fwrite(&NROW, sizeof(int), 1, FP);
+
+  for(IVAR=0; IVAR < NVAR; IVAR++ ) {
+    BUF       = TABLEINFO_BIN.BUF[ITAB][IVAR];
+    NBYTE_RAW = NROW * NBYTE_ICAST_BIN(TABLEINFO_BIN.ICAST[ITAB][IVAR]);
+
+    if ( COMPRESS_BIN ) {
+      LEN_Z = compressBound(NBYTE_RAW);
+      istat = compress2((Bytef*)BUF_Z, &LEN_Z, (Bytef*)BUF, NBYTE_RAW,
+			Z_BEST_SPEED);
+      if ( istat != Z_OK ) {
+	sprintf(MSGERR1, "zlib compress2 error = %d for IVAR=%d", istat, IVAR);
+	sprintf(MSGERR2, "%s", TABLEINFO_BIN.FILENAME[ITAB]);
+	errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+      }
+      NBYTE_FILE = (int)LEN_Z ;  BUF = BUF_Z;
+    }
+    else
+      { NBYTE_FILE = NBYTE_RAW ; }
+
+    fwrite(&NBYTE_RAW,  sizeof(int), 1, FP);
+    fwrite(&NBYTE_FILE, sizeof(int), 1, FP);
+    fwrite(BUF, 1, NBYTE_FILE, FP);
+  }
+
+  if ( ferror(FP) ) {
+    sprintf(MSGERR1, "Error writing chunk of %d rows for", NROW);
+    sprintf(MSGERR2, "%s", TABLEINFO_BIN.FILENAME[ITAB]);
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+  }
+
+  if ( BUF_Z ) { free(BUF_Z); }
+  TABLEINFO_BIN.NROW_BUF[ITAB] = 0 ;
+
+} // end SNTABLE_FLUSH_BIN
+
+
+// =============================================
+void CLOSE_BINFILE(void) {
+
+  // flush remaining rows and close output SNBIN files.
+  // Empty tables still get a header so that they can be read.
+
+  int itab, ivar;
+
+  // read-mode file that was never read with SNTABLE_READ_EXEC
+  if ( READINFO_BIN.FP != NULL )
+    { fclose(READINFO_BIN.FP);  READINFO_BIN.FP = NULL ; }
+
+  for(itab=0; itab < TABLEINFO_BIN.NTABLE; itab++ ) {
+    if ( TABLEINFO_BIN.SKIP[itab] ) { continue ; }
+    if ( TABLEINFO_BIN.FP[itab] == NULL ) { continue ; }
+    if ( TABLEINFO_BIN.NFILL[itab] == 0 ) { SNTABLE_WRITE_HEADER_BIN(itab); }
+    SNTABLE_FLUSH_BIN(itab);
+    fclose(TABLEINFO_BIN.FP[itab]);
+    TABLEINFO_BIN.FP[itab] = NULL ;
+
+    for(ivar=0; ivar < TABLEINFO_BIN.NVAR[itab]; ivar++ )
+      { free(TABLEINFO_BIN.BUF[itab][ivar]); }
+    free(TABLEINFO_BIN.BUF[itab]);
+    free(TABLEINFO_BIN.PTRVAR[itab]);
+    free(TABLEINFO_BIN.ICAST[itab]);
+    free(TABLEINFO_BIN.VARLIST[itab]);
+
+    printf("   Close SNBIN table %s with %d rows \n",
+	   TABLEINFO_BIN.TBNAME[itab], TABLEINFO_BIN.NFILL[itab] );
+    fflush(stdout);
+  }
+
+  TABLEINFO_BIN.NTABLE = 0 ;
+
+} // end CLOSE_BINFILE
+
+
+// =============================================
+//            READ FUNCTIONS
+// =============================================
+
+void OPEN_BINFILE(char *FILENAME) {
+
+  // open SNBIN file for reading and read header.
+
+  char fnam[] = "OPEN_BINFILE" ;
+
+  // ---------- BEGIN ----------
+
+  READINFO_BIN.FP = fopen(FILENAME, "rb");
+  if ( !READINFO_BIN.FP ) {
+    sprintf(MSGERR1, "Could not open SNBIN file to read: ");
+    sprintf(MSGERR2, "%s", FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+  }
+  sprintf(READINFO_BIN.FILENAME, "%s", FILENAME);
+
+  printf("   %s: %s \n", fnam, FILENAME);  fflush(stdout);
+
+  read_header_BIN(READINFO_BIN.FP, FILENAME, 1);
+
+} // end OPEN_BINFILE
+
+
+// =============================================
+void read_header_BIN(FILE *fp, char *FILENAME, int OPT_STORE) {
+
+  // read header of SNBIN file and store dimensions in READINFO_BIN.
+  // OPT_STORE=1 -> also store VARNAMES and casts in READTABLE_POINTERS,
+  //                and VERSION_PHOTOMETRY in SNTABLE_VERSION_PHOTOMETRY.
+  // On return, fp points to first chunk.
+
+  int  NVAR, NCHAR, NCOMMENT, iline, LEN, ivar, NRD=0 ;
+  char MAGIC[8], *VARLIST, *COMMENT, *ptrtok ;
+  char fnam[] = "read_header_BIN" ;
+
+  // ---------- BEGIN ----------
+
+  NRD += fread(MAGIC, 1, 8, fp);
+  if ( NRD != 8 || strcmp(MAGIC,MAGIC_BIN) != 0 ) {
+    sprintf(MSGERR1, "Invalid SNBIN header (expect MAGIC='%s') for",
+	    MAGIC_BIN);
+    sprintf(MSGERR2, "%s", FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+  }
+
+  fread(&NVAR,                    sizeof(int), 1, fp);
+  fread(&READINFO_BIN.COMPRESS,   sizeof(int), 1, fp);
+  fread(&READINFO_BIN.NROW_CHUNK, sizeof(int), 1, fp);
+  fread(&NCHAR,                   sizeof(int), 1, fp);
+  fread(&NCOMMENT,                sizeof(int), 1, fp);
+
+  if ( NVAR <= 0 || NVAR > MXVAR_TABLE ) {
+    sprintf(MSGERR1, "Invalid NVAR=%d (MXVAR_TABLE=%d) in",
+	    NVAR, MXVAR_TABLE);
+    sprintf(MSGERR2, "%s", FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+  }
+  READINFO_BIN.NVAR = NVAR ;
+  fread(READINFO_BIN.ICAST, sizeof(int), NVAR, fp);
+
+  VARLIST = (char*) malloc(NCHAR+1);
+  fread(VARLIST, 1, NCHAR, fp);  VARLIST[NCHAR] = 0 ;
+
+  if ( OPT_STORE ) {
+    ivar = 0 ;
+    ptrtok = strtok(VARLIST," ");
+    while ( ptrtok != NULL && ivar < NVAR ) {
+      sprintf(READTABLE_POINTERS.VARNAME[ivar],"%s", ptrtok);
+      READTABLE_POINTERS.ICAST_READ[ivar]  = READINFO_BIN.ICAST[ivar] ;
+      READTABLE_POINTERS.ICAST_STORE[ivar] = READINFO_BIN.ICAST[ivar] ;
+      ptrtok = strtok(NULL," ");   ivar++ ;
+    }
+  }
+  free(VARLIST);
+
+  for(iline=0; iline < NCOMMENT; iline++ ) {
+    fread(&LEN, sizeof(int), 1, fp);
+    COMMENT = (char*) malloc(LEN+1);
+    fread(COMMENT, 1, LEN, fp);  COMMENT[LEN] = 0 ;
+    ptrtok = strstr(COMMENT,KEYNAME_VERSION_PHOTOMETRY) ;
+    if ( OPT_STORE && ptrtok != NULL ) {
+      ptrtok += strlen(KEYNAME_VERSION_PHOTOMETRY);
+      trim_blank_spaces(ptrtok);
+      LEN = strlen(SNTABLE_VERSION_PHOTOMETRY) + strlen(ptrtok);
+      if ( LEN >= MXCHAR_VERSION_PHOTOMETRY ) {
+	sprintf(MSGERR1,"len(SNTABLE_VERSION_PHOTOMETRY) = %d exceeds "
+		"bound of %d", LEN, MXCHAR_VERSION_PHOTOMETRY );
+	sprintf(MSGERR2,"%s", "Check MXCHAR_VERSION_PHOTOMETRY");
+	errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2 );
+      }
+      catVarList_with_comma(SNTABLE_VERSION_PHOTOMETRY,ptrtok);
+    }
+    free(COMMENT);
+  }
+
+  READINFO_BIN.OFFSET_DATA = ftell(fp);
+
+} // end read_header_BIN
+
+
+// =============================================
+int read_column_BIN(int NBYTE_RAW, int NBYTE_FILE, char *BUF,
+		    char *BUF_Z, char *callFun) {
+
+  // read one column block from READINFO_BIN.FP into BUF;
+  // uncompress if needed. Returns 1 on success.
+
+  FILE  *fp = READINFO_BIN.FP ;
+  uLongf LEN ;
+  int    istat ;
+  char   fnam[] = "read_column_BIN" ;
+
+  if ( NBYTE_RAW == NBYTE_FILE && !READINFO_BIN.COMPRESS ) {
+    if ( fread(BUF, 1, NBYTE_RAW, fp) != (size_t)NBYTE_RAW ) { return 0; }
+    return 1;
+  }
+
+  if ( fread(BUF_Z, 1, NBYTE_FILE, fp) != (size_t)NBYTE_FILE ) { return 0; }
+  LEN   = NBYTE_RAW ;
+  istat = uncompress((Bytef*)BUF, &LEN, (Bytef*)BUF_Z, NBYTE_FILE);
+  if ( istat != Z_OK || (int)LEN != NBYTE_RAW ) {
+    sprintf(MSGERR1, "zlib uncompress error=%d (LEN=%d, expect %d)",
+	    istat, (int)LEN, NBYTE_RAW );
+    sprintf(MSGERR2, "called from %s for %s", callFun, READINFO_BIN.FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+  }
+  return 1;
+
+} // end read_column_BIN
+
+
+// =============================================
+int SNTABLE_NEVT_BIN(char *FILENAME) {
+
+  // return number of rows by reading chunk headers only.
+  // If FILENAME is blank, use already-opened file and rewind
+  // to first chunk.
+
+  int  NROW_TOT = 0, NROW, ivar, NBYTE[2], LENF = strlen(FILENAME) ;
+  FILE *fp ;
+
+  // ---------- BEGIN ----------
+
+  if ( LENF > 0 ) {
+    fp = fopen(FILENAME, "rb");
+    if ( !fp ) { return 0 ; }
+    read_header_BIN(fp, FILENAME, 0);
+  }
+  else {
+    fp = READINFO_BIN.FP ;
+    fseek(fp, READINFO_BIN.OFFSET_DATA, SEEK_SET);
+  }
+
+  while ( fread(&NROW, sizeof(int), 1, fp) == 1 ) {
+    NROW_TOT += NROW ;
+    for(ivar=0; ivar < READINFO_BIN.NVAR; ivar++ ) {
+      if ( fread(NBYTE, sizeof(int), 2, fp) != 2 ) { goto DONE; }
+      fseek(fp, NBYTE[1], SEEK_CUR);
+    }
+  }
+
+ DONE:
+  if ( LENF > 0 )
+    { fclose(fp); }
+  else
+    { fseek(fp, READINFO_BIN.OFFSET_DATA, SEEK_SET); }
+
+  return NROW_TOT ;
+
+} // end SNTABLE_NEVT_BIN
+
+
+// =============================================
+void SNTABLE_VARNAMES_BIN(char *FILENAME, char *VARNAMES) {
+
+  // return space-separated VARNAMES, excluding first (CID/GALID)
+  // column, as in SNTABLE_VARNAMES_TEXT.
+
+  int  NVAR_SAVE = READTABLE_POINTERS.NVAR_TOT ;
+  int  ivar ;
+  FILE *fp  = fopen(FILENAME, "rb");
+  char fnam[] = "SNTABLE_VARNAMES_BIN" ;
+
+  // ---------- BEGIN ----------
+
+  VARNAMES[0] = 0 ;
+  if ( !fp ) { TABLEFILE_noFile_ABORT(fnam,FILENAME); }
+  read_header_BIN(fp, FILENAME, 1);
+  fclose(fp);
+
+  for(ivar=1; ivar < READINFO_BIN.NVAR; ivar++ ) {
+    if ( ivar > 1 ) { strcat(VARNAMES," "); }
+    strcat(VARNAMES, READTABLE_POINTERS.VARNAME[ivar]);
+  }
+  READTABLE_POINTERS.NVAR_TOT = NVAR_SAVE ;
+
+} // end SNTABLE_VARNAMES_BIN
+
+
+// =============================================
+int SNTABLE_READPREP_BIN(void) {
+  // VARNAMES and casts are already stored by OPEN_BINFILE;
+  // re-load them here because SNTABLE_READPREP resets them.
+  FILE *fp = READINFO_BIN.FP ;
+  fseek(fp, 0, SEEK_SET);
+  read_header_BIN(fp, READINFO_BIN.FILENAME, 1);
+  return READINFO_BIN.NVAR ;
+} // end SNTABLE_READPREP_BIN
+
+
+// =============================================
+double dval_BIN(int ICAST, char *BUF, int irow) {
+  // return value in row irow of column buffer BUF as double
+  if ( ICAST == ICAST_D ) { return ((double*)BUF)[irow] ; }
+  if ( ICAST == ICAST_F ) { return (double)((float*)BUF)[irow] ; }
+  if ( ICAST == ICAST_I ) { return (double)((int*)BUF)[irow] ; }
+  if ( ICAST == ICAST_S ) { return (double)((short int*)BUF)[irow] ; }
+  if ( ICAST == ICAST_L ) { return (double)((long long int*)BUF)[irow] ; }
+  return 0.0 ;
+} // end dval_BIN
+
+
+// =============================================
+int SNTABLE_READ_EXEC_BIN(void) {
+
+  // read all chunks and fill pointers passed previously to
+  // SNTABLE_READPREP_VARDEF. Only columns with NPTR>0 are decoded;
+  // other column blocks are skipped with fseek.
+  // Integer/long columns are copied without conversion
+  // through double when the stored and read-back casts match.
+  // If FP_DUMP is set (SNTABLE_DUMP_VALUES), write each row to FP_DUMP.
+  // Rows failing READTABLE_POINTERS cuts are skipped (Oct 15 2026);
+  // cut columns are decoded even if they are not on the READ-list.
+  // Function returns number of rows read (after cuts).
+
+  FILE *fp       = READINFO_BIN.FP ;
+  FILE *FP_DUMP  = READTABLE_POINTERS.FP_DUMP ;
+  int  NVAR_TOT  = READINFO_BIN.NVAR ;
+  int  NVAR_READ = READTABLE_POINTERS.NVAR_READ ;
+  int  MXLEN     = READTABLE_POINTERS.MXLEN ;
+  int  NCUT      = READTABLE_POINTERS.NCUT ;
+  int  NROW_TOT  = 0, NROW, NKEEP, ivar, i, irow, isn, nptr, icut ;
+  int  ICAST_READ, ICAST_STORE, NBYTE_CAST, MXBYTE, NBYTE[2], *IROW_KEEP ;
+  char **BUF, *BUF_Z, *STR, LINE[MXCHAR_VARLIST*4] ;
+  bool PASS ;
+  char fnam[] = "SNTABLE_READ_EXEC_BIN" ;
+
+  // ------------ BEGIN -----------
+
+  MXBYTE = READINFO_BIN.NROW_CHUNK * MXCHAR_STRING_BIN ;
+  BUF    = (char**) malloc(NVAR_TOT * sizeof(char*));
+  BUF_Z  = (char* ) malloc(compressBound(MXBYTE));
+  IROW_KEEP = (int*) malloc(READINFO_BIN.NROW_CHUNK * sizeof(int));
+  for(ivar=0; ivar < NVAR_TOT; ivar++ ) {
+    BUF[ivar] = NULL ;
+    if ( READTABLE_POINTERS.NPTR[ivar] > 0 )
+      { BUF[ivar] = (char*)malloc(MXBYTE); }
+  }
+  for(icut=0; icut < NCUT; icut++ ) {
+    ivar = READTABLE_POINTERS.IVAR_CUT[icut] ;
+    if ( BUF[ivar] == NULL ) { BUF[ivar] = (char*)malloc(MXBYTE); }
+  }
+
+  fseek(fp, READINFO_BIN.OFFSET_DATA, SEEK_SET);
+
+  while ( fread(&NROW, sizeof(int), 1, fp) == 1 ) {
+
+    if ( NROW < 0 || NROW > READINFO_BIN.NROW_CHUNK ) { goto TRUNCATED; }
+
+    // read (or skip) each column block
+    for(ivar=0; ivar < NVAR_TOT; ivar++ ) {
+      if ( fread(NBYTE, sizeof(int), 2, fp) != 2 ) { goto TRUNCATED; }
+      if ( BUF[ivar] == NULL )
+	{ fseek(fp, NBYTE[1], SEEK_CUR);  continue ; }
+      if ( NBYTE[0] > MXBYTE ) { goto TRUNCATED; }
+      if ( !read_column_BIN(NBYTE[0], NBYTE[1], BUF[ivar], BUF_Z, fnam) )
+	{ goto TRUNCATED; }
+    }
+
+    // apply cuts: IROW_KEEP = output index within chunk, or -1
+    NKEEP = 0 ;
+    for(irow=0; irow < NROW; irow++ ) {
+      PASS = true ;
+      for(icut=0; icut < NCUT && PASS; icut++ ) {
+	ivar = READTABLE_POINTERS.IVAR_CUT[icut] ;
+	ICAST_READ = READINFO_BIN.ICAST[ivar] ;
+	if ( ICAST_READ == ICAST_C )
+	  { PASS = pass_cuts_READTABLE(icut, 
+			atof(BUF[ivar]+irow*MXCHAR_STRING_BIN)); }
+	else
+	  { PASS = pass_cuts_READTABLE(icut, 
+			dval_BIN(ICAST_READ,BUF[ivar],irow)); }
+      }
+      IROW_KEEP[irow] = -1 ;
+      if ( PASS ) { IROW_KEEP[irow] = NKEEP;  NKEEP++ ; }
+    }
+
+    if ( MXLEN > 0 && NROW_TOT + NKEEP > MXLEN ) {
+      sprintf(MSGERR1, "NROW=%d exceeds user-defined array bound=%d",
+	      NROW_TOT+NKEEP, MXLEN );
+      sprintf(MSGERR2, "for %s", READINFO_BIN.FILENAME);
+      errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+    }
+
+    // - - - - - - - - - - - -
+    // dump mode: one text line per row
+    if ( FP_DUMP != NULL ) {
+      for(irow=0; irow < NROW; irow++ ) {
+	if ( IROW_KEEP[irow] < 0 ) { continue; }
+	sprintf(LINE,"%s", READTABLE_POINTERS.LINEKEY_DUMP);
+	for ( i = 0; i < NVAR_READ; i++ ) {
+	  ivar       = READTABLE_POINTERS.PTRINDEX[i] ;
+	  ICAST_READ = READINFO_BIN.ICAST[ivar] ;
+	  if ( ICAST_READ == ICAST_C )
+	    { load_DUMPLINE_STR(LINE, BUF[ivar] + irow*MXCHAR_STRING_BIN); }
+	  else
+	    { load_DUMPLINE(0, LINE, dval_BIN(ICAST_READ,BUF[ivar],irow)); }
+	}
+	fprintf(FP_DUMP,"%s\n", LINE);
+      }
+      NROW_TOT += NKEEP ;
+      continue ;
+    }
+
+    // - - - - - - - - - - - -
+    // fill user arrays column by column
+    for ( i = 0; i < NVAR_READ; i++ ) {
+      ivar        = READTABLE_POINTERS.PTRINDEX[i] ;
+      ICAST_READ  = READINFO_BIN.ICAST[ivar] ;
+      ICAST_STORE = READTABLE_POINTERS.ICAST_STORE[ivar] ;
+      NBYTE_CAST  = NBYTE_ICAST_BIN(ICAST_READ);
+
+      for(nptr=0; nptr < READTABLE_POINTERS.NPTR[ivar]; nptr++ ) {
+
+	// fast path: same cast and no cuts -> block copy
+	if ( ICAST_READ == ICAST_STORE && ICAST_STORE != ICAST_C &&
+	     NCUT == 0 ) {
+	  void *PTR = NULL ;
+	  if (ICAST_STORE==ICAST_D)
+	    { PTR = &READTABLE_POINTERS.PTRVAL_D[nptr][ivar][NROW_TOT]; }
+	  if (ICAST_STORE==ICAST_F)
+	    { PTR = &READTABLE_POINTERS.PTRVAL_F[nptr][ivar][NROW_TOT]; }
+	  if (ICAST_STORE==ICAST_I)
+	    { PTR = &READTABLE_POINTERS.PTRVAL_I[nptr][ivar][NROW_TOT]; }
+	  if (ICAST_STORE==ICAST_S)
+	    { PTR = &READTABLE_POINTERS.PTRVAL_S[nptr][ivar][NROW_TOT]; }
+	  if (ICAST_STORE==ICAST_L)
+	    { PTR = &READTABLE_POINTERS.PTRVAL_L[nptr][ivar][NROW_TOT]; }
+	  memcpy(PTR, BUF[ivar], NROW*NBYTE_CAST);
+	  continue ;
+	}
+
+	for(irow=0; irow < NROW; irow++ ) {
+	  if ( IROW_KEEP[irow] < 0 ) { continue; }
+	  isn = NROW_TOT + IROW_KEEP[irow] ;
+	  if ( ICAST_STORE == ICAST_C ) {
+	    if ( ICAST_READ == ICAST_C )
+	      { STR = BUF[ivar] + irow*MXCHAR_STRING_BIN ;
+		sprintf(READTABLE_POINTERS.PTRVAL_C[nptr][ivar][isn],"%s",STR);}
+	    else
+	      { sprintf(READTABLE_POINTERS.PTRVAL_C[nptr][ivar][isn],"%.8g",
+			dval_BIN(ICAST_READ,BUF[ivar],irow) ); }
+	    continue ;
+	  }
+
+	  double DVAL ;
+	  if ( ICAST_READ == ICAST_C )
+	    { DVAL = atof(BUF[ivar] + irow*MXCHAR_STRING_BIN); }
+	  else
+	    { DVAL = dval_BIN(ICAST_READ, BUF[ivar], irow); }
+
+	  if ( ICAST_STORE == ICAST_D )
+	    { READTABLE_POINTERS.PTRVAL_D[nptr][ivar][isn] = DVAL ; }
+	  else if ( ICAST_STORE == ICAST_F )
+	    { READTABLE_POINTERS.PTRVAL_F[nptr][ivar][isn] = (float)DVAL ; }
+	  else if ( ICAST_STORE == ICAST_I )
+	    { READTABLE_POINTERS.PTRVAL_I[nptr][ivar][isn] = (int)DVAL ; }
+	  else if ( ICAST_STORE == ICAST_S )
+	    { READTABLE_POINTERS.PTRVAL_S[nptr][ivar][isn] = (short int)DVAL;}
+	  else if ( ICAST_STORE == ICAST_L )
+	    { READTABLE_POINTERS.PTRVAL_L[nptr][ivar][isn] =
+		(long long int)DVAL ; }
+	  else {
+	    sprintf(MSGERR1,"Unknown ICAST=%d  var[%d]=%s  nptr=%d",
+		    ICAST_STORE, ivar, READTABLE_POINTERS.VARNAME[ivar], nptr);
+	    sprintf(MSGERR2,"See ICAST_  parameters in sntools_output.h");
+	    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2 );
+	  }
+	} // end irow
+      } // end nptr
+    } // end i loop
+
+    NROW_TOT += NKEEP ;
+
+  } // end chunk loop
+
+  goto CLEANUP ;
+
+ TRUNCATED:
+  sprintf(MSGERR1,"Truncated or corrupt SNBIN chunk after %d rows", NROW_TOT);
+  sprintf(MSGERR2,"in %s", READINFO_BIN.FILENAME);
+  errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2 );
+
+ CLEANUP:
+  for(ivar=0; ivar < NVAR_TOT; ivar++ )
+    { if ( BUF[ivar] ) { free(BUF[ivar]); } }
+  free(BUF);  free(BUF_Z);  free(IROW_KEEP);
+
+  fclose(fp);  READINFO_BIN.FP = NULL ;
+
+  // reset flags to allow opening another file (same as TEXT)
+  NAME_TABLEFILE[OPENFLAG_READ][IFILETYPE_BIN][0] = 0 ;
+  USE_TABLEFILE[OPENFLAG_READ][IFILETYPE_BIN]     = 0;
+
+  return NROW_TOT ;
+
+} // end SNTABLE_READ_EXEC_BIN
+
@@ -45,6 +45,12 @@
 
  Jun 20 2019: fix dump-output to include comma for csv format.
 
+ Oct 15 2026: 
+   + apply ROOTFILE_OPT (compression level, basket size, auto-flush,
+     implicit MT) from TABLEFILE_OPEN; see SET_TREEOPT_ROOT.
+   + SNLCPAK CFILTOBS strings are one contiguous buffer reused for 
+     each SN, instead of one 2-byte malloc per epoch.
+
 ***************************************************/
 
 #include "TROOT.h"
@@ -115,6 +121,7 @@ struct SNLCPAK_TREEDATA {
   double *MJD_D ;  // added Feb 2016
   int   *IFILTOBS, *IREJECT, *IFLAGDATA;
   char  **CFILTOBS ;
+  char  *CFILTOBS_BUF ; // contiguous storage for CFILTOBS (Oct 2026)
 
   // quantities vs. filter index  (0 to NSURVEY_FILTERS-1)
   int     NFILT ;
@@ -156,6 +163,7 @@ extern"C" {
 #endif
 
   void OPEN_ROOTFILE(char *FILENAME, char *COPT, int *IERR);
+  void SET_TREEOPT_ROOT(TTree *tree, int OPT);
   void CLOSE_ROOTFILE(char *FILENAME, int OPENFLAG);
 
   void SNTABLE_CREATE_ROOT(int IDTABLE, char *name);
@@ -223,6 +231,7 @@ extern"C" {
 void OPEN_ROOTFILE(char *FILENAME, char *COPT, int *IERR) {
 
   // Feb 2013: wrapper to initialize file for root.
+  // Oct 15 2026: apply ROOTFILE_OPT.ZLEVEL and NTHREAD_IMT for new file.
 
   int LVBOSE = 1 ;
   char cstat[12], banner[80] ;
@@ -234,9 +243,18 @@ void OPEN_ROOTFILE(char *FILENAME, char *COPT, int *IERR) {
   if ( strchr(COPT,'N') != NULL )  { 
     sprintf(cstat,"RECREATE"); //   new file; clobber old one 
     ROOT_OPENFLAG    = OPENFLAG_NEW ;
+
+#ifdef R__USE_IMT
+    if ( ROOTFILE_OPT.NTHREAD_IMT > 0 ) 
+      { ROOT::EnableImplicitMT(ROOTFILE_OPT.NTHREAD_IMT); }
+#endif
+
     TFILE_ROOT_NEW   = new TFile(FILENAME,cstat);
     SNLCPAK_USE_ROOT = true ;  
 
+    if ( ROOTFILE_OPT.ZLEVEL >= 0 ) 
+      { TFILE_ROOT_NEW->SetCompressionLevel(ROOTFILE_OPT.ZLEVEL); }
+
     NH_ROOT[1]  = 0 ;  // 1D histos
     NH_ROOT[2]  = 0 ;  // 2D histos
     NTABLE_ROOT = 0;   // tables (Trees)
@@ -251,7 +269,13 @@ void OPEN_ROOTFILE(char *FILENAME, char *COPT, int *IERR) {
   if ( LVBOSE ) {
     sprintf(banner,"OPEN_ROOTFILE: use  %s  mode:", cstat ) ;
     print_banner(banner);
-    printf("   Opened %s\n", FILENAME); fflush(stdout);
+    printf("   Opened %s\n", FILENAME); 
+    if ( ROOT_OPENFLAG == OPENFLAG_NEW ) {
+      printf("   ROOT options: zlevel=%d basket=%d autoflush=%lld imt=%d\n",
+	     ROOTFILE_OPT.ZLEVEL, ROOTFILE_OPT.BASKET, 
+	     ROOTFILE_OPT.AUTOFLUSH, ROOTFILE_OPT.NTHREAD_IMT);
+    }
+    fflush(stdout);
   }
 
 
@@ -320,10 +344,33 @@ void SNTABLE_CREATE_ROOT(int IDTABLE, char *name) {
   sprintf(title,"%s table, ID = %d", name, IDTABLE);  
   SNTable_ROOT[i]     = new TTree(name,title) ;
   SNTABLE_ROOT_MAP[i] = IDTABLE ;
+  SET_TREEOPT_ROOT(SNTable_ROOT[i], 1); // auto-flush
  
 } // end of  SNTABLE_CREATE_ROOT" 
 
 
+// ===============================================================
+void SET_TREEOPT_ROOT(TTree *tree, int OPT) {
+
+  // Created Oct 2026
+  // Apply ROOTFILE_OPT to tree:
+  //   OPT=1 -> auto-flush (call when tree is created)
+  //   OPT=2 -> basket size for all existing branches (call after
+  //            branches are defined; repeat calls are harmless)
+
+  // ---------------- BEGIN ---------------
+
+  if ( OPT == 1 && ROOTFILE_OPT.AUTOFLUSH != 0 ) 
+    { tree->SetAutoFlush((Long64_t)ROOTFILE_OPT.AUTOFLUSH); }
+
+  if ( OPT == 2 && ROOTFILE_OPT.BASKET > 0 ) 
+    { tree->SetBasketSize("*", ROOTFILE_OPT.BASKET); }
+
+  return ;
+
+} // end SET_TREEOPT_ROOT
+
+
 // ===============================================================
 void SNTABLE_ADDCOL_ROOT(int IDTABLE, void *PTRVAR, 
 			 SNTABLE_ADDCOL_VARDEF *ADDCOL_VARDEF) {
@@ -419,6 +466,8 @@ void SNTABLE_ADDCOL_ROOT(int IDTABLE, void *PTRVAR,
     }
   }
 
+  SET_TREEOPT_ROOT(SNTable_ROOT[ITABLE], 2); // basket size (Oct 2026)
+
 }  // end of SNTABLE_ADDCOL_ROOT
 
 
@@ -1395,6 +1444,7 @@ void SNLCPAK_makeTree_ROOT(int ipak) {
 
   // define new TTree
   SNLCPAK_TREE[ipak] = new TTree(TREE_NAME, TREE_TITLE) ;
+  SET_TREEOPT_ROOT(SNLCPAK_TREE[ipak], 1);
 
   SNLCPAK_TREE[ipak]->Branch( "CCID", SNLCPAK_OUTPUT.CCID, "CCID/C"  ) ;
 
@@ -1403,6 +1453,7 @@ void SNLCPAK_makeTree_ROOT(int ipak) {
   SNLCPAK_Branch_lightCurve(ipak);  // light curve info
   SNLCPAK_Branch_filter(ipak);      // filter info: MJD, NDOF, CHI2
 
+  SET_TREEOPT_ROOT(SNLCPAK_TREE[ipak], 2);
 
 
 
@@ -1586,6 +1637,9 @@ void SNLCPAK_FILL_ROOT(void) {
 // --------------------------------------
 void  SNLCPAK_MALLOC_TREEDATA(void) {
 
+  // One-time alloc of buffers that are re-used for each SN.
+  // Oct 15 2026: CFILTOBS strings point into one contiguous buffer.
+
   int MEM_F, MEM_I, MEM_D, MEM_C ;
   int NFILT, NEP, i ;
   // ------------- BEGIN ---------------
@@ -1617,9 +1671,10 @@ void  SNLCPAK_MALLOC_TREEDATA(void) {
   SNLCPAK_TREEDATA.CHISQ_F   = (float*)malloc( MEM_F ) ;
   SNLCPAK_TREEDATA.IFLAGDATA = (int  *)malloc( MEM_I ) ;
 
-  SNLCPAK_TREEDATA.CFILTOBS   = (char**)malloc( MEM_C ) ;
+  SNLCPAK_TREEDATA.CFILTOBS     = (char**)malloc( MEM_C ) ;
+  SNLCPAK_TREEDATA.CFILTOBS_BUF = (char* )malloc( 2*NEP*sizeof(char) ) ;
   for(i=0; i < NEP; i++ ) 
-    { SNLCPAK_TREEDATA.CFILTOBS[i]  = (char*)malloc( 2*sizeof(char) ) ; }
+    { SNLCPAK_TREEDATA.CFILTOBS[i] = &SNLCPAK_TREEDATA.CFILTOBS_BUF[2*i]; }
 
   // -------
   MEM_D = NFILT * sizeof(double);
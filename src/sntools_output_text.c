@@ -24,6 +24,11 @@
 // Jan 4 2021: MXCHAR_LINE -> 3200 (was 2500)
 // Sep 07 2021: abort if found too few variables (SNTABLE_READ_EXEC_TEXT)
 // Jan 07 2025: MXCHAR_LINE -> 4000 (was 3200)
+// Oct 14 2026: fast table read: buffered line reader (no line-length
+//              limit), in-place tokenizer, and exact fast-path float
+//              parser; used by SNTABLE_READ_EXEC_TEXT & SNTABLE_NEVT_TEXT.
+// Oct 15 2026: SNTABLE_READ_EXEC_TEXT applies READTABLE_POINTERS cuts
+//              while parsing, and writes FP_DUMP rows directly.
 // **********************************************
 
 char FILEPREFIX_TEXT[100];
@@ -49,6 +54,8 @@ char FILEPREFIX_TEXT[100];
 #define MSKOPT_PARSE_WORDS_STRING 2 // must match same param in sntools.h
 #define MSKOPT_PARSE_WORDS_IGNORECOMMA 4 
 
+#define MXCHAR_READBUF_TEXT  4194304  // initial read-buffer size (grows)
+
 FILE *PTRFILE_TEXT ;                   // generic ascii file pointer
 char FILENAME_TEXT[MXCHAR_FILENAME];   // name of opened text file
 int  GZIPFLAG_TEXT;                    // gzipped or not
@@ -62,6 +69,13 @@ int  NVAR_LCPLOT, NVAR_LCPLOT_REQ, NVAR_SPECPLOT ;
 char VARNAME_SNLC[MXEPVAR_TEXT][40] ; 
 char VARDEF_SNLC[MXEPVAR_TEXT][80] ; // short definition
 
+// buffered line reader for fast table read (Oct 2026)
+struct {
+  char *BUF ;   // holds NBUF bytes read with fread
+  long  MXBUF, NBUF, IPOS ;  // alloc size, bytes in BUF, next line start
+  int   ENDFILE ;
+} READBUF_TEXT ;
+
 
 // structure for writing table.
 struct TABLEINFO_TEXT {
@@ -146,6 +160,12 @@ extern"C" {
 
   int validRowKey_TEXT(char *string) ;
 
+  void  init_nextLine_TEXT(void);
+  void  end_nextLine_TEXT(void);
+  char *nextLine_TEXT(FILE *fp);
+  char *nextWord_TEXT(char **ptr);
+  double fast_strtod_TEXT(char *str, char **endptr);
+
   // misc. sntools functions
   void  readint(FILE *fp, int nint, int *list) ;
   void  readchar(FILE *fp, char *clist) ;
@@ -956,10 +976,11 @@ int SNTABLE_NEVT_TEXT(char *FILENAME) {
   // Dec 20 2017: huge speed-up reading lines instead of words.
   //
   // Apr 17 2019: rewind -> snana_rewind
+  // Oct 14 2026: use nextLine_TEXT buffered reader
 
   int NROW, LENF, GZIPFLAG ;
   FILE *fp ;
-  char  LINE[MXCHAR_LINE], *ptrtok ;
+  char  *ptrline, *ptrtok ;
   char fnam[] = "SNTABLE_NEVT_TEXT" ;
 
   // ------------ BEGIN --------------
@@ -979,10 +1000,13 @@ int SNTABLE_NEVT_TEXT(char *FILENAME) {
     errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
   }
 
-  while ( fgets(LINE,MXCHAR_LINE, fp) != NULL ) {
-    ptrtok = strtok(LINE, " ");
+  // Oct 2026: buffered read; check only first word of each line
+  init_nextLine_TEXT();
+  while ( (ptrline = nextLine_TEXT(fp)) != NULL ) {
+    ptrtok = nextWord_TEXT(&ptrline);
     if ( validRowKey_TEXT(ptrtok) ) { NROW++ ; }
   }
+  end_nextLine_TEXT();
 
 
   //  printf(" xxx %s: LENF=%d FILENAME=%s \n", fnam, LENF, FILENAME);
@@ -1184,7 +1208,7 @@ int SNTABLE_READ_EXEC_TEXT(void) {
   // Oct 2014:  
   // Execute ascii read over all rows and fill
   // pointers passed previously to SNTABLE_READPREP_VARDEF.
-  // Functions returns number of rows read. 
+  // Function returns number of rows read. 
   //
   // July 29 2016: abort on NVAR key with different value.
   // Dec  20 2017: use fgets to reduce read-time 
@@ -1192,14 +1216,32 @@ int SNTABLE_READ_EXEC_TEXT(void) {
   // Sep  07 2021: abort if ivar < NVAR_TOT 
   //    (e.g., if split jobs with different NVAR are merged)
   //
+  // Oct 14 2026: 
+  //   + read with nextLine_TEXT (large fread buffer) instead of fgets,
+  //     and split words in place with nextWord_TEXT instead of
+  //     strtok + sprintf.
+  //   + convert only words on READ-list, once per word, using
+  //     fast_strtod_TEXT instead of two sscanf calls.
+  //     Long-long columns still use long double (strtold) so that
+  //     64-bit integer IDs are exact.
+  //
+  // Oct 15 2026:
+  //   + evaluate READTABLE_POINTERS cuts after parsing each row;
+  //     rejected rows are skipped and not counted in NROW.
+  //   + if FP_DUMP is set (SNTABLE_DUMP_VALUES), write each row
+  //     to FP_DUMP instead of filling user pointers.
+  //
 
-  int NROW = 0 ;
-  int i, iwd, ivar, isn, ICAST, nptr, NWD_LINE ;
+  int NROW = 0, NROW_ALL = 0 ;
+  int NCUT = READTABLE_POINTERS.NCUT ;
+  int i, ivar, isn, ICAST, nptr, icut ;
+  bool PASS ;
 
-  char ctmp[MXCHAR_FILENAME], LINE[MXCHAR_LINE], *ptrtok, cvar[300];
-  char KEYNAME_ID[40];
-  long double DVAR[MXVAR_TABLE];
-  char        CVAR[MXVAR_TABLE][60];
+  char *LINE, *ptrline, *ptrtok, *ptrend ;
+  char KEYNAME_ID[40], *DUMPLINE = NULL ;
+  FILE *FP_DUMP  = READTABLE_POINTERS.FP_DUMP ;
+  long double  DVAR[MXVAR_TABLE];
+  char        *CVAR[MXVAR_TABLE];  // pointers to words in LINE
   
   int  NVAR_TOT  = READTABLE_POINTERS.NVAR_TOT ;  // all variables
   int  NVAR_READ = READTABLE_POINTERS.NVAR_READ ; // subset to read
@@ -1211,59 +1253,105 @@ int SNTABLE_READ_EXEC_TEXT(void) {
   // get key name of ID varname such as CID, GALID, etc.
   sprintf(KEYNAME_ID,"%s", READTABLE_POINTERS.VARNAME[0] ); 
 
-  while ( fgets(LINE, MXCHAR_LINE, FP ) != NULL ) {
+  // check PTRINDEX once rather than for every row
+  for ( i = 0; i < NVAR_READ; i++ ) {
+    ivar  = READTABLE_POINTERS.PTRINDEX[i] ;
+    if ( ivar < 0 || ivar >= MXVAR_TABLE ) {
+      sprintf(MSGERR1,"Invalid PTRINDEX[%d] = %d", i, ivar );
+      sprintf(MSGERR2,"PTRINDEX must be %d to %d", 0, MXVAR_TABLE-1 );
+      errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2 );
+    }
+  }
+
+  CVAR[0] = KEYNAME_ID ;
+  init_nextLine_TEXT();
+
+  if ( FP_DUMP != NULL ) 
+    { DUMPLINE = (char*)malloc(MXCHAR_VARNAME*(NVAR_READ+2)*sizeof(char)); }
+
+  while ( (LINE = nextLine_TEXT(FP)) != NULL ) {
 
     // check first word in the line
-    ptrtok = strtok(LINE, " ");
-    sprintf(ctmp, "%s", ptrtok);
-    if ( ctmp[0] == '#' ) { continue ; }  // skip comment lines
+    ptrline = LINE;
+    ptrtok  = nextWord_TEXT(&ptrline);
+    if ( ptrtok[0] == '#' ) { continue ; }  // skip comment lines
 
-    if ( !validRowKey_TEXT(ctmp)  ) { continue ; }
+    if ( !validRowKey_TEXT(ptrtok)  ) { continue ; }
 
     // if we get here, we have a valid ROW key so read rest of row.
 
-    NROW++ ;   
+    NROW_ALL++ ;   
+
+    ivar = 0 ;
+    while ( ivar < NVAR_TOT ) { 
+      ptrtok = nextWord_TEXT(&ptrline);
+      if ( ptrtok[0] == 0 ) { break; }
+      CVAR[ivar] = ptrtok ;
 
-    ptrtok = strtok(NULL," " ); ivar=0 ;
-    while ( ptrtok != NULL && ivar < NVAR_TOT) { 
       // Dec 20 2017: extract only variables on READ-list
+      // Oct 14 2026: convert once here; strings are used via CVAR.
+      //              DVAR is unchanged if word is not a number.
       if ( READTABLE_POINTERS.NPTR[ivar] > 0 ) {      
-	sprintf(cvar,"%s",   ptrtok );      
-	sscanf(cvar, "%Lf",  &DVAR[ivar] );
-	sscanf(cvar, "%s",   CVAR[ivar] );
+	ICAST = READTABLE_POINTERS.ICAST_STORE[ivar] ;
+	if ( ICAST == ICAST_L ) {
+	  long double ld = strtold(ptrtok, &ptrend);
+	  if ( ptrend != ptrtok ) { DVAR[ivar] = ld ; }
+	}
+	else if ( ICAST != ICAST_C ) {
+	  double d = fast_strtod_TEXT(ptrtok, &ptrend);
+	  if ( ptrend != ptrtok ) { DVAR[ivar] = (long double)d ; }
+	}
       }
-      ptrtok = strtok(NULL," " );
       ivar++ ;
     }
 
     // - - - - -
 
-    if ( NROW>1 && ivar < NVAR_TOT ) {
+    if ( NROW_ALL>1 && ivar < NVAR_TOT ) {
       sprintf(MSGERR1,"Exepcted %d values, but found %d", NVAR_TOT, ivar);
       sprintf(MSGERR2,"Check CID = %s", CVAR[0]);
       errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2 );
     }
 
-    if ( fmodf( (float)(NROW), 100000. ) == 0 && NROW > 0 )  { 
+    if ( fmodf( (float)(NROW_ALL), 100000. ) == 0 )  { 
       printf("\t Reading table row %d  (%s=%s) \n", 
-	     NROW, KEYNAME_ID, CVAR[0] );  fflush(stdout);
+	     NROW_ALL, KEYNAME_ID, CVAR[0] );  fflush(stdout);
+    }
+
+    // Oct 2026: row cuts; cut-variables need not be on READ-list
+    PASS = true ;
+    for(icut=0; icut < NCUT && PASS; icut++ ) {
+      ivar = READTABLE_POINTERS.IVAR_CUT[icut] ;
+      if ( ivar >= NVAR_TOT || ivar >= MXVAR_TABLE ) { continue; }
+      PASS = pass_cuts_READTABLE(icut, fast_strtod_TEXT(CVAR[ivar],&ptrend));
+    }
+    if ( !PASS ) { continue ; }
+
+    NROW++ ;
+
+    if ( FP_DUMP != NULL ) {
+      sprintf(DUMPLINE,"%s", READTABLE_POINTERS.LINEKEY_DUMP);
+      for ( i = 0; i < NVAR_READ; i++ ) {
+	ivar  = READTABLE_POINTERS.PTRINDEX[i] ;
+	ICAST = READTABLE_POINTERS.ICAST_STORE[ivar] ;     
+	if ( ICAST == ICAST_C ) 
+	  { load_DUMPLINE_STR(DUMPLINE, CVAR[ivar]); }
+	else
+	  { load_DUMPLINE(0, DUMPLINE, (double)DVAR[ivar]); }
+      }
+      fprintf(FP_DUMP,"%s\n", DUMPLINE);
+      continue ;
     }
 
 
     // set user arrays via pointer
+    isn = NROW - 1;  // isn is a C-like index
+
     for ( i = 0; i < NVAR_READ; i++ ) {
       
       ivar  = READTABLE_POINTERS.PTRINDEX[i] ; // starts at 1
       ICAST = READTABLE_POINTERS.ICAST_STORE[ivar] ;     
-      
-	if ( ivar < 0 || ivar >= MXVAR_TABLE ) {
-	  sprintf(MSGERR1,"Invalid PTRINDEX[%d] = %d", i, ivar );
-	  sprintf(MSGERR2,"PTRINDEX must be %d to %d", 0, MXVAR_TABLE-1 );
-	  errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2 );
-	}
     
-	isn = NROW - 1;  // isn is a C-like index
-
 	for(nptr=0; nptr<READTABLE_POINTERS.NPTR[ivar]; nptr++ ) {
 
 	  if ( ICAST == ICAST_D )  { 
@@ -1300,8 +1388,10 @@ int SNTABLE_READ_EXEC_TEXT(void) {
 	
       } // end of i loop      
 
-  } // end fscanf 
+  } // end nextLine 
   
+  end_nextLine_TEXT();
+  if ( DUMPLINE != NULL ) { free(DUMPLINE); }
 
   if ( GZIPFLAG_TEXT ) { pclose(FP); } else { fclose(FP); }
 
@@ -1341,6 +1431,173 @@ int validRowKey_TEXT(char *string) {
   return 0 ;
 } // validRowKey_TEXT
 
+
+// =========================================
+void init_nextLine_TEXT(void) {
+  // Created Oct 2026
+  // Prepare buffered line reader; call before first nextLine_TEXT.
+  READBUF_TEXT.MXBUF   = MXCHAR_READBUF_TEXT ;
+  READBUF_TEXT.BUF     = (char*)malloc(READBUF_TEXT.MXBUF+1);
+  READBUF_TEXT.NBUF    = 0 ;
+  READBUF_TEXT.IPOS    = 0 ;
+  READBUF_TEXT.ENDFILE = 0 ;
+} // end init_nextLine_TEXT
+
+void end_nextLine_TEXT(void) {
+  free(READBUF_TEXT.BUF);  READBUF_TEXT.BUF = NULL ;
+  READBUF_TEXT.MXBUF = READBUF_TEXT.NBUF = READBUF_TEXT.IPOS = 0 ;
+} // end end_nextLine_TEXT
+
+// =========================================
+char *nextLine_TEXT(FILE *fp) {
+
+  // Created Oct 2026
+  // Return pointer to next line of fp, with <CR> replaced by null;
+  // return NULL at end of file.
+  // Lines are read in large blocks with fread, so there is no
+  // per-line stdio overhead and no limit on line length
+  // (buffer grows if a single line exceeds the buffer).
+  // Returned line is valid until the next call, and it may be
+  // modified in place (e.g., by nextWord_TEXT).
+
+  char *LINE, *PTR_NL ;
+  long  NLEFT, NRD ;
+
+  while ( 1 ) {
+
+    NLEFT = READBUF_TEXT.NBUF - READBUF_TEXT.IPOS ;
+    LINE  = READBUF_TEXT.BUF  + READBUF_TEXT.IPOS ;
+    if ( NLEFT > 0 ) {
+      PTR_NL = (char*)memchr(LINE, '\n', NLEFT);
+      if ( PTR_NL != NULL ) {
+	*PTR_NL = 0 ;
+	READBUF_TEXT.IPOS += (PTR_NL - LINE) + 1 ;
+	return LINE ;
+      }
+    }
+
+    if ( READBUF_TEXT.ENDFILE ) {
+      if ( NLEFT <= 0 ) { return NULL; }
+      // last line without <CR>
+      READBUF_TEXT.BUF[READBUF_TEXT.NBUF] = 0 ;
+      READBUF_TEXT.IPOS = READBUF_TEXT.NBUF ;
+      return LINE ;
+    }
+
+    // move partial line to start of buffer, and grow buffer if
+    // partial line fills the whole buffer.
+    if ( READBUF_TEXT.IPOS > 0 ) {
+      memmove(READBUF_TEXT.BUF, LINE, NLEFT);
+      READBUF_TEXT.NBUF = NLEFT;  READBUF_TEXT.IPOS = 0 ;
+    }
+    if ( READBUF_TEXT.NBUF == READBUF_TEXT.MXBUF ) {
+      READBUF_TEXT.MXBUF *= 2 ;
+      READBUF_TEXT.BUF = (char*)realloc(READBUF_TEXT.BUF, 
+					READBUF_TEXT.MXBUF+1);
+    }
+
+    NRD = fread(READBUF_TEXT.BUF + READBUF_TEXT.NBUF, 1, 
+		READBUF_TEXT.MXBUF - READBUF_TEXT.NBUF, fp);
+    if ( NRD <= 0 ) { READBUF_TEXT.ENDFILE = 1; }
+    READBUF_TEXT.NBUF += NRD ;
+  }
+
+} // end nextLine_TEXT
+
+// =========================================
+char *nextWord_TEXT(char **ptr) {
+
+  // Created Oct 2026
+  // Return next blank-separated word starting at *ptr, 
+  // null-terminate it in place, and advance *ptr past it.
+  // Returns pointer to empty string when there are no more words.
+  // Blank = space, tab, or <CR> (\r) from DOS files.
+
+  char *s = *ptr, *word ;
+
+  while ( *s == ' ' || *s == '\t' || *s == '\r' ) { s++ ; }
+  word = s ;
+  while ( *s != 0 && *s != ' ' && *s != '\t' && *s != '\r' ) { s++ ; }
+  if ( *s != 0 ) { *s = 0 ; s++ ; }
+  *ptr = s ;
+  return word ;
+
+} // end nextWord_TEXT
+
+// =========================================
+double fast_strtod_TEXT(char *str, char **endptr) {
+
+  // Created Oct 2026
+  // Fast replacement for strtod for the typical table value,
+  // e.g., 0.123456, -12.5, 3.2e-05.
+  // If mantissa has <= 15 significant digits and |exponent| <= 22,
+  // both the integer mantissa and 10^|exponent| are exact doubles,
+  // so a single multiply or divide is correctly rounded and the
+  // result is identical to strtod. All other cases (nan, inf, hex, 
+  // long mantissa, large exponent, trailing junk) call strtod.
+
+  static const double POW10[23] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10,
+    1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21,
+    1e22 } ;
+
+  char *s = str ;
+  unsigned long long MANT = 0 ;
+  int  NEG = 0, NDIG = 0, NSIG = 0, EXP10 = 0, EXP = 0, NEG_EXP = 0 ;
+  double VAL ;
+
+  if      ( *s == '-' ) { NEG = 1; s++ ; }
+  else if ( *s == '+' ) { s++ ; }
+
+  while ( *s >= '0' && *s <= '9' ) {
+    if ( MANT > 0 || *s != '0' ) { NSIG++ ; }
+    MANT = MANT*10 + (*s - '0');  NDIG++ ;  s++ ;
+    if ( NSIG > 15 ) { goto SLOW; }
+  }
+  if ( *s == '.' ) {
+    s++ ;
+    while ( *s >= '0' && *s <= '9' ) {
+      if ( MANT > 0 || *s != '0' ) { NSIG++ ; }
+      MANT = MANT*10 + (*s - '0');  NDIG++ ;  EXP10-- ;  s++ ;
+      if ( NSIG > 15 ) { goto SLOW; }
+    }
+  }
+  if ( NDIG == 0 ) { goto SLOW; }
+
+  if ( *s == 'e' || *s == 'E' ) {
+    s++ ;
+    if      ( *s == '-' ) { NEG_EXP = 1; s++ ; }
+    else if ( *s == '+' ) { s++ ; }
+    if ( *s < '0' || *s > '9' ) { goto SLOW; }
+    while ( *s >= '0' && *s <= '9' ) {
+      EXP = EXP*10 + (*s - '0');  s++ ;
+      if ( EXP > 999 ) { goto SLOW; }
+    }
+    if ( NEG_EXP ) { EXP = -EXP; }
+    EXP10 += EXP ;
+  }
+
+  // must end at a word boundary; otherwise let strtod decide.
+  if ( *s != 0 && *s != ' ' && *s != '\t' && *s != '\r' && *s != '\n' )
+    { goto SLOW; }
+
+  if ( MANT == 0 )
+    { VAL = 0.0 ; }
+  else if ( EXP10 >= 0 && EXP10 <= 22 )
+    { VAL = (double)MANT * POW10[EXP10] ; }
+  else if ( EXP10 < 0 && EXP10 >= -22 )
+    { VAL = (double)MANT / POW10[-EXP10] ; }
+  else
+    { goto SLOW; }
+
+  *endptr = s ;
+  return ( NEG ? -VAL : VAL ) ;
+
+ SLOW:
+  return strtod(str, endptr);
+
+} // end fast_strtod_TEXT
+
 // ====================================
 int ICAST_for_textVar(char *varName) {
 
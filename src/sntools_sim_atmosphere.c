@@ -15,6 +15,9 @@
   - fluctuations in pressure, temperature, pwv 
   - noise model for RA,DEC precision
 
+  Oct 15 2026: without site fluctuations, compute_DCR_angle uses
+               DCR tables prepared once by init_dcr_table_atmos.
+
  ****************************************/
 
 #include "sntools.h"
@@ -73,6 +76,7 @@ void INIT_ATMOSPHERE(void) {
   ATMOS_INFO.PWV_AVG         = SURVEY_INFO.pwv_atmos[ID] ;
 
   ATMOS_INFO.SNRMIN = 3.0 ;
+  ATMOS_INFO.DCR_TABLE_INIT = false ;
 
   printf("\t Sigma(temperature/Pressure/PWV) = %.1f C / %.1f mmHg / %.1f mmHg\n\n",
 	 INPUTS_ATMOSPHERE.SIGMA_SITE_TEMP,
@@ -702,6 +706,11 @@ double compute_DCR_angle(int ep, int DUMPFLAG) {
   // Inputs:
   //  ep         : epoch index
   //  DUMPFLAG   : optional dump flag
+  //
+  // Oct 15 2026: if there are no site fluctuations, use tables from
+  //   init_dcr_table_atmos: DCR = 206265*tan(zenith)*(<n-1>_SED - <n-1>_CAL)
+  //   where <n-1>_CAL is pre-computed and <n-1>_SED needs only
+  //   pre-computed SED-interp bins and weights.
 
   double DCR_SED_WGTED    = 999.0 ; // init output
   double LAMAVG_SED_WGTED =   0.0 ; // init output
@@ -751,48 +760,73 @@ double compute_DCR_angle(int ep, int DUMPFLAG) {
   double lam, trans, sedFlux, calFlux, ST, DCR_lam; 
   int    ilam ;
 
-  for(ilam=0; ilam < NLAM_FILTER; ilam++ ) {
-    lam   = FILTER_SEDMODEL[IFILT].lam[ilam];
-    trans = FILTER_SEDMODEL[IFILT].transSN[ilam];
+  if ( !INPUTS_ATMOSPHERE.APPLY_SIGMA_SITE ) {
 
-    // interpolate SED flux 
-    sedFlux = interp_1DFUN(1, lam, NLAM_SED, ptrLAMSED, ptrFLUXSED, fnam);
+    if ( !ATMOS_INFO.DCR_TABLE_INIT ) { init_dcr_table_atmos(); }
 
-    // calstar flux already interpolated and stored on filter-lam grid
-    calFlux = ATMOS_INFO.FLUX_CALSTAR[IFILT_OBS][ilam]; 
+    int    *IBIN_SED = ATMOS_INFO.IBIN_SED[IFILT_OBS] ;
+    double *FRAC_SED = ATMOS_INFO.FRAC_SED[IFILT_OBS] ;
+    double *WGT_LAM  = ATMOS_INFO.WGT_LAM[IFILT_OBS] ;
+    double *WGT_DCR  = ATMOS_INFO.WGT_DCR[IFILT_OBS] ;
+    double *TRANS    = FILTER_SEDMODEL[IFILT].transSN ;
+    double  DCR_CAL  = ATMOS_INFO.DCR_CAL[IFILT_OBS] ;
+    int     j ;
 
-    if ( INPUTS_ATMOSPHERE.APPLY_SIGMA_SITE ) 
-      { n_site = compute_index_refrac_atmos(lam, DUMPFLAG);  }
-    else
-      { n_site = ATMOS_INFO.n_SITE_LIST[IFILT_OBS][ilam] ; }
+    for(ilam=0; ilam < NLAM_FILTER; ilam++ ) {
+      j        = IBIN_SED[ilam];
+      sedFlux  = ptrFLUXSED[j] + FRAC_SED[ilam]*(ptrFLUXSED[j+1]-ptrFLUXSED[j]);
+      sum0_SED += ( sedFlux * WGT_LAM[ilam] ) ;
+      sum1_SED += ( sedFlux * WGT_DCR[ilam] ) ;
+      sum0_LAM += ( sedFlux * TRANS[ilam] ) ;
+    }
+
+    if ( sum0_SED > 0.0 && DCR_CAL > 0.0 ) {
+      DCR_SED_WGTED    = FAC_DCR * tan_ZENITH * (sum1_SED/sum0_SED - DCR_CAL);
+      LAMAVG_SED_WGTED = sum0_SED / sum0_LAM ;
+    }
+  }
+  else {
+    for(ilam=0; ilam < NLAM_FILTER; ilam++ ) {
+      lam   = FILTER_SEDMODEL[IFILT].lam[ilam];
+      trans = FILTER_SEDMODEL[IFILT].transSN[ilam];
 
-    DCR_lam = FAC_DCR * (n_site-1.0) * tan_ZENITH ; // arcsec
+      // interpolate SED flux 
+      sedFlux = interp_1DFUN(1, lam, NLAM_SED, ptrLAMSED, ptrFLUXSED, fnam);
 
-    ST      = sedFlux * trans ;
-    sum0_SED += ( ST * lam ) ;
-    sum1_SED += ( ST * lam * DCR_lam );
+      // calstar flux already interpolated and stored on filter-lam grid
+      calFlux = ATMOS_INFO.FLUX_CALSTAR[IFILT_OBS][ilam]; 
 
-    sum0_LAM += ( ST );
-    sum1_LAM += ( ST * lam);
+      // random site fluctuations for each wave bin
+      n_site = compute_index_refrac_atmos(lam, DUMPFLAG);
 
-    ST      = calFlux * trans ;
-    sum0_CAL += ( ST * lam ) ;
-    sum1_CAL += ( ST * lam * DCR_lam );
+      DCR_lam = FAC_DCR * (n_site-1.0) * tan_ZENITH ; // arcsec
 
-  } // end ilam loop
+      ST      = sedFlux * trans ;
+      sum0_SED += ( ST * lam ) ;
+      sum1_SED += ( ST * lam * DCR_lam );
+
+      sum0_LAM += ( ST );
+      sum1_LAM += ( ST * lam);
+
+      ST      = calFlux * trans ;
+      sum0_CAL += ( ST * lam ) ;
+      sum1_CAL += ( ST * lam * DCR_lam );
+
+    } // end ilam loop
   
-  if ( sum0_SED > 0.0 && sum0_CAL > 0.0 ) { 
-    double DCR_SED    = sum1_SED/sum0_SED ;  // transient 
-    double DCR_CAL    = sum1_CAL/sum0_CAL;   // avg calib star
-    DCR_SED_WGTED     = DCR_SED - DCR_CAL ; 
-    LAMAVG_SED_WGTED  = sum1_LAM / sum0_LAM ;
-
-    /* xxx
-    printf(" xxx %s: DCR[SED,CAL,net] = %f %f %f  \n",
-	   fnam, DCR_SED, DCR_CAL, DCR ); fflush(stdout);
-    debugexit(fnam);
-    */
-  }
+    if ( sum0_SED > 0.0 && sum0_CAL > 0.0 ) { 
+      double DCR_SED    = sum1_SED/sum0_SED ;  // transient 
+      double DCR_CAL    = sum1_CAL/sum0_CAL;   // avg calib star
+      DCR_SED_WGTED     = DCR_SED - DCR_CAL ; 
+      LAMAVG_SED_WGTED  = sum1_LAM / sum0_LAM ;
+
+      /* xxx
+      printf(" xxx %s: DCR[SED,CAL,net] = %f %f %f  \n",
+  	   fnam, DCR_SED, DCR_CAL, DCR ); fflush(stdout);
+      debugexit(fnam);
+      */
+    }
+  } // end APPLY_SIGMA_SITE
 
 
   if ( DUMPFLAG ) {
@@ -809,6 +843,74 @@ double compute_DCR_angle(int ep, int DUMPFLAG) {
 } // end compute_DCR_angle
 
 
+// ==========================
+void init_dcr_table_atmos(void) {
+
+  // Created Oct 2026
+  // Called on first DCR computation (after spectrograph/SED wave grid 
+  // is defined) when there are no site fluctuations.
+  // For each band, store on filter-lam grid:
+  //   + SED wave bin and interp fraction (replaces binary search per
+  //     filter-lam bin per epoch),
+  //   + trans*lam and trans*lam*(n_site-1) weights,
+  //   + calStar <n-1> (does not depend on epoch).
+  // Airmass enters only as overall tan(zenith) factor.
+
+  int    NLAM_SED  = INPUTS_SPECTRO.NBIN_LAM;
+  double *LAMSED   = INPUTS_SPECTRO.LAMAVG_LIST;
+  int    ifilt, ifilt_obs, ilam, NLAM, IBIN ;
+  double lam, trans, n_site, calFlux, sum0_CAL, sum1_CAL ;
+  char fnam[] = "init_dcr_table_atmos" ;
+
+  // ------------ BEGIN ----------
+
+  for(ifilt=1; ifilt <= NFILT_SEDMODEL; ifilt++ ) {
+    ifilt_obs = FILTER_SEDMODEL[ifilt].ifilt_obs;
+    NLAM      = FILTER_SEDMODEL[ifilt].NLAM;
+
+    ATMOS_INFO.IBIN_SED[ifilt_obs] = (int   *)malloc(NLAM*sizeof(int));
+    ATMOS_INFO.FRAC_SED[ifilt_obs] = (double*)malloc(NLAM*sizeof(double));
+    ATMOS_INFO.WGT_LAM[ifilt_obs]  = (double*)malloc(NLAM*sizeof(double));
+    ATMOS_INFO.WGT_DCR[ifilt_obs]  = (double*)malloc(NLAM*sizeof(double));
+
+    sum0_CAL = sum1_CAL = 0.0 ;
+    for(ilam=0; ilam < NLAM; ilam++ ) {
+      lam     = FILTER_SEDMODEL[ifilt].lam[ilam];
+      trans   = FILTER_SEDMODEL[ifilt].transSN[ilam];
+      n_site  = ATMOS_INFO.n_SITE_LIST[ifilt_obs][ilam] ;
+      calFlux = ATMOS_INFO.FLUX_CALSTAR[ifilt_obs][ilam]; 
+
+      // same bin search & abort as in interp_1DFUN
+      IBIN = quickBinSearch(lam, NLAM_SED, LAMSED, fnam, fnam);
+      if ( IBIN < 0 || IBIN >= NLAM_SED-1 ) {
+	sprintf(c1err,"Invalid SED wave bin %d (NBIN=%d) for lam=%.1f", 
+		IBIN, NLAM_SED, lam );
+	sprintf(c2err,"Check band %s", FILTER_SEDMODEL[ifilt].name);
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+      }
+
+      ATMOS_INFO.IBIN_SED[ifilt_obs][ilam] = IBIN ;
+      ATMOS_INFO.FRAC_SED[ifilt_obs][ilam] = 
+	(lam - LAMSED[IBIN]) / (LAMSED[IBIN+1] - LAMSED[IBIN]) ;
+      ATMOS_INFO.WGT_LAM[ifilt_obs][ilam]  = trans * lam ;
+      ATMOS_INFO.WGT_DCR[ifilt_obs][ilam]  = trans * lam * (n_site-1.0) ;
+
+      sum0_CAL += ( calFlux * trans * lam ) ;
+      sum1_CAL += ( calFlux * trans * lam * (n_site-1.0) ) ;
+    }
+
+    if ( sum0_CAL > 0.0 ) 
+      { ATMOS_INFO.DCR_CAL[ifilt_obs] = sum1_CAL / sum0_CAL ; }
+    else
+      { ATMOS_INFO.DCR_CAL[ifilt_obs] = -9.0 ; }
+  }
+
+  ATMOS_INFO.DCR_TABLE_INIT = true ;
+
+  return;
+
+} // end init_dcr_table_atmos
+
 // ==========================
 void test_compute_dcr(void) {
 
@@ -1,5 +1,6 @@
 
 // Created Jun 2023
+// Oct 15 2026: add DCR tables in ATMOS_INFO (see init_dcr_table_atmos)
 
 #define COORD_SHIFT_NULL_ARCSEC 99.0
 #define COORD_SHIFT_NULL_DEG    99.0/3600.0 // 99 arcsec  
@@ -55,6 +56,16 @@ struct {
 
   double SNRMIN; // min SNR to include in RA/DEC avg
 
+  // Oct 2026: DCR tables on filter-lam grid (no site fluctuations).
+  // DCR is linear in tan(zenith), so airmass dependence is exact
+  // and per-epoch DCR needs only one SED-weighted sum per band.
+  bool    DCR_TABLE_INIT ;
+  int    *IBIN_SED[MXFILTINDX];  // SED lam bin containing each filter lam
+  double *FRAC_SED[MXFILTINDX];  // interp fraction within SED lam bin
+  double *WGT_LAM[MXFILTINDX];   // trans * lam
+  double *WGT_DCR[MXFILTINDX];   // trans * lam * (n_site-1)
+  double  DCR_CAL[MXFILTINDX];   // calstar <n-1>; DCR = 206265*tanz*<n-1>
+
   // info per event
   // GENLC struct in snlc_sim.h stores RA/DEC per obs;
   // here keep track of avg coord per band and over all obs.
@@ -90,6 +101,7 @@ double compute_DCR_angle_approx(double LAM, double tan_ZENITH,
 				int IFILT_OBS, int DUMPFLAG); // xxx mark delete
 
 double compute_DCR_angle(int ep, int DUMPFLAG);
+void   init_dcr_table_atmos(void);
 
 double compute_index_refrac_atmos(double LAM, int DUMPFLAG) ;
 
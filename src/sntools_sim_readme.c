@@ -663,6 +663,12 @@ void README_DOCANA_OUTPUT_SUMMARY(int *iline) {
     i++; cptr = VERSION_INFO.README_DOC[i] ;
     sprintf(cptr,"%sNREJECT_CRAZYFLUX:  %d ", pad, NGEN_REJECT.CRAZYFLUX);
   }
+
+  if ( NGEN_REJECT.PRESCREEN > 0 ) {
+    i++; cptr = VERSION_INFO.README_DOC[i] ;
+    sprintf(cptr,"%sNREJECT_PRESCREEN:  %d   # SNRMAX upper bound before LC gen", 
+	    pad, NGEN_REJECT.PRESCREEN);
+  }
   
   // check for wrong host info
   if ( !IGNOREFILE(INPUTS.WRONGHOST_FILE) ) {
@@ -1220,6 +1226,10 @@ void readme_docana_misc(int *iline, char *pad) {
   VERSION_INFO_load(&i, pad, "RANSEED:", noComment, 
 		    lenkey, true, nval1, &dval, 0.0,1.0E9, -1.0); 
 
+  dval = (double)INPUTS.RANDOM_COUNTER ;
+  VERSION_INFO_load(&i, pad, "RANDOM_COUNTER:", noComment, 
+		    lenkey, true, nval1, &dval, 0.0,1.0E9, 0.0); 
+
   dval = (double)INPUTS.DEBUG_FLAG ;
   VERSION_INFO_load(&i, pad, "DEBUG_FLAG:", noComment, 
 		    lenkey, true, nval1, &dval, 0.0,1.0E9, -1.0); 
@@ -1380,6 +1390,14 @@ void readme_docana_output(int *iline, char *pad) {
   dval = (double)INPUTS.CIDRAN_MAX ;
   VERSION_INFO_load(&i, pad, "CIDRAN_MAX:", noComment, 
 		    lenkey, true, nval1, &dval, 0.0,1.0E9, -1.0); 
+
+  dval = (double)INPUTS.CIDRAN_METHOD ;
+  VERSION_INFO_load(&i, pad, "CIDRAN_METHOD:", noComment, 
+		    lenkey, true, nval1, &dval, 0.0,10.0, 1.0); 
+
+  dval = (double)INPUTS.CIDRAN_SEED ;
+  VERSION_INFO_load(&i, pad, "CIDRAN_SEED:", noComment, 
+		    lenkey, true, nval1, &dval, -1.0E9,1.0E9, 0.0); 
  
   if ( INPUTS.NCIDRAN_SKIPLIST > 0 ) {
     i++; cptr = VERSION_INFO.README_DOC[i] ;
@@ -42,6 +42,13 @@
       of ZP vs. Texpose. Works much better with sparse Texpose grid.
       [issue found by comparing SNR against D.Rubin]
 
+  Oct 15 2026:
+    + new getSNR_spectrograph_LIST to compute SNR for all wave bins
+      of a spectrum in one pass. Texpose interpolation weights are
+      computed once per (TEXPOSE_S,TEXPOSE_T) and the interpolated
+      ZP & SQSIGSKY are cached in SNR_SPECTRO_CACHE for re-use by
+      subsequent spectra with the same exposure times.
+
 *********************************************************/
 
 #include "fitsio.h"
@@ -594,6 +601,7 @@ void malloc_spectrograph(int OPT, int NBIN_LAM, int NBIN_TEXPOSE) {
   // ------------ BEGIN ---------------
 
   if ( OPT > 0 ) {
+    SNR_SPECTRO_CACHE.VALID      = false ; // Oct 2026
     INPUTS_SPECTRO.LAMMIN_LIST   = (double*) malloc(MEML0);
     INPUTS_SPECTRO.LAMMAX_LIST   = (double*) malloc(MEML0);
     INPUTS_SPECTRO.LAMAVG_LIST   = (double*) malloc(MEML0);
@@ -1622,6 +1630,224 @@ double getSNR_spectrograph(int ILAM, double TEXPOSE_S, double TEXPOSE_T,
 } // end getSNR_spectrograph
 
 
+// ====================================================
+void getSNR_spectrograph_LIST(int ILAM_MIN, int ILAM_MAX,
+			      double TEXPOSE_S, double TEXPOSE_T,
+			      bool ALLOW_TEXTRAP, bool *USE_LIST, 
+			      double *GENMAG_LIST, double *SNR_LIST,
+			      double *ERRFRAC_T_LIST ) {
+
+  // Created Oct 2026
+  // Batched version of getSNR_spectrograph for wave bins
+  // ILAM_MIN to ILAM_MAX of one spectrum. Input GENMAG_LIST and 
+  // output SNR_LIST & ERRFRAC_T_LIST are indexed by ILAM.
+  // If USE_LIST != NULL, bins with USE_LIST[ILAM]=F are skipped 
+  // and their outputs are not modified.
+  //
+  // The Texpose interpolation of ZP and SQSIGSKY does not depend on
+  // GENMAG, so it is evaluated once per (TEXPOSE_S,TEXPOSE_T) in 
+  // fill_SNR_SPECTRO_CACHE; here the per-bin work is only the
+  // source-flux Poisson term. Results are identical to calling
+  // getSNR_spectrograph for each bin.
+
+  int    NBT = INPUTS_SPECTRO.NBIN_TEXPOSE ;
+  int    ILAM ;
+  double SNR, ZP_S, SQ_S, SQ_T, SQ_SUM, Flux, FluxErr, ERRFRAC_T ;
+  double TEXTRAP_SCALE ;
+  //  char fnam[] = "getSNR_spectrograph_LIST" ;
+
+  // -------------- BEGIN --------------
+
+  if ( NBT == 1 ) {
+    // interp_1DFUN has special NBIN=1 logic; keep it.
+    for(ILAM=ILAM_MIN; ILAM <= ILAM_MAX; ILAM++ ) {
+      if ( USE_LIST != NULL && !USE_LIST[ILAM] ) { continue; }
+      SNR_LIST[ILAM] = 
+	getSNR_spectrograph(ILAM, TEXPOSE_S, TEXPOSE_T, ALLOW_TEXTRAP,
+			    GENMAG_LIST[ILAM], &ERRFRAC_T_LIST[ILAM] );
+    }
+    return ;
+  }
+
+  fill_SNR_SPECTRO_CACHE(TEXPOSE_S, TEXPOSE_T, ALLOW_TEXTRAP);
+  TEXTRAP_SCALE = SNR_SPECTRO_CACHE.TEXTRAP_SCALE ;
+
+  for(ILAM=ILAM_MIN; ILAM <= ILAM_MAX; ILAM++ ) {
+
+    if ( USE_LIST != NULL && !USE_LIST[ILAM] ) { continue; }
+
+    SNR = ERRFRAC_T = 0.0 ;
+    if ( INPUTS_SPECTRO.ZP[ILAM][0] < 0.0 ) 
+      { SNR_LIST[ILAM] = ERRFRAC_T_LIST[ILAM] = 0.0 ; continue; }
+
+    ZP_S    = SNR_SPECTRO_CACHE.ZP_S[ILAM] ;
+    SQ_S    = SNR_SPECTRO_CACHE.SQ_S[ILAM] ;
+    SQ_T    = SNR_SPECTRO_CACHE.SQ_T[ILAM] ;
+
+    Flux    = pow(TEN, -0.4*(GENMAG_LIST[ILAM]-ZP_S) ) ; // in p.e.
+    SQ_SUM  = (SQ_S + SQ_T + Flux);
+    if ( SQ_SUM >= 0.0 ) 
+      {  FluxErr = sqrt(SQ_SUM);  SNR = Flux/FluxErr ;  }
+    else
+      { FluxErr = -9.0 ; }
+
+    SNR *= TEXTRAP_SCALE ;
+
+    if ( SQ_T >= 0.0 ) {  ERRFRAC_T = sqrt(SQ_T)/FluxErr ; } 
+
+    if ( isnan(SNR) ) {
+      // re-compute with scalar function to get dump and abort
+      getSNR_spectrograph(ILAM, TEXPOSE_S, TEXPOSE_T, ALLOW_TEXTRAP,
+			  GENMAG_LIST[ILAM], &ERRFRAC_T);
+    }
+
+    SNR_LIST[ILAM]       = SNR ;
+    ERRFRAC_T_LIST[ILAM] = ERRFRAC_T ;
+  }
+
+  return ;
+
+} // end getSNR_spectrograph_LIST
+
+
+// ====================================================
+void fill_SNR_SPECTRO_CACHE(double TEXPOSE_S, double TEXPOSE_T,
+			    bool ALLOW_TEXTRAP) {
+
+  // Created Oct 2026
+  // For input exposure times, fill SNR_SPECTRO_CACHE arrays
+  // ZP_S, SQ_S and SQ_T vs. ILAM using the same linear Texpose 
+  // interpolation as getSNR_spectrograph. The interpolation bin and
+  // weight are found once for each Texpose axis instead of a
+  // binary search per ILAM bin. If exposure times match the
+  // previous call, return immediately.
+
+  int    NBLAM  = INPUTS_SPECTRO.NBIN_LAM ;
+  int    NBT    = INPUTS_SPECTRO.NBIN_TEXPOSE ;
+  double Tmin   = INPUTS_SPECTRO.TEXPOSE_LIST[0] ;
+  double Tmax   = INPUTS_SPECTRO.TEXPOSE_LIST[NBT-1] ;
+  double TEXPOSE_S_local = TEXPOSE_S ;
+  bool   DO_TEMPLATE = ( TEXPOSE_T > 0.01 );
+  int    IBIN_LZS, IBIN_S, IBIN_LZT=0, IBIN_T=0, ILAM ;
+  double FRAC_LZS, FRAC_S, FRAC_LZT=0.0, FRAC_T=0.0 ;
+  double *ZP, *SQSIG, ZP_S, ZP_T, SQ_T ;
+  int    MEMD ;
+  char fnam[] = "fill_SNR_SPECTRO_CACHE" ;
+  char errmsg_ZP_S[] = "fill_SNR_SPECTRO_CACHE(ZP_S)";
+  char errmsg_ZP_T[] = "fill_SNR_SPECTRO_CACHE(ZP_T)";
+  char errmsg_SQ_S[] = "fill_SNR_SPECTRO_CACHE(SQ_S)";
+  char errmsg_SQ_T[] = "fill_SNR_SPECTRO_CACHE(SQ_T)";
+
+  // -------------- BEGIN --------------
+
+  if ( SNR_SPECTRO_CACHE.NBIN_LAM != NBLAM ) {
+    MEMD = NBLAM * sizeof(double);
+    if ( SNR_SPECTRO_CACHE.NBIN_LAM > 0 ) {
+      free(SNR_SPECTRO_CACHE.ZP_S);
+      free(SNR_SPECTRO_CACHE.SQ_S);
+      free(SNR_SPECTRO_CACHE.SQ_T);
+    }
+    SNR_SPECTRO_CACHE.ZP_S     = (double*) malloc(MEMD);
+    SNR_SPECTRO_CACHE.SQ_S     = (double*) malloc(MEMD);
+    SNR_SPECTRO_CACHE.SQ_T     = (double*) malloc(MEMD);
+    SNR_SPECTRO_CACHE.NBIN_LAM = NBLAM ;
+    SNR_SPECTRO_CACHE.VALID    = false ;
+  }
+
+  if ( SNR_SPECTRO_CACHE.VALID && 
+       SNR_SPECTRO_CACHE.TEXPOSE_S == TEXPOSE_S &&
+       SNR_SPECTRO_CACHE.TEXPOSE_T == TEXPOSE_T ) { return; }
+
+  SNR_SPECTRO_CACHE.TEXTRAP_SCALE = 1.0 ;
+  if ( ALLOW_TEXTRAP ) {
+    if ( TEXPOSE_S < Tmin ) { TEXPOSE_S_local = Tmin + 0.00001 ; }
+    if ( TEXPOSE_S > Tmax ) { TEXPOSE_S_local = Tmax - 0.00001 ; }
+    if ( TEXPOSE_S_local != TEXPOSE_S ) {
+      SNR_SPECTRO_CACHE.TEXTRAP_SCALE = sqrt(TEXPOSE_S / TEXPOSE_S_local);
+    }
+  }
+  else if ( TEXPOSE_S < Tmin  || TEXPOSE_S > Tmax ) {
+    sprintf(c1err,"Invalid TEXPOSE_S = %f", TEXPOSE_S );
+    sprintf(c2err,"Valid TEXPOSE_S range: %.2f to %.2f \n", Tmin, Tmax);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  get_interpWgt_TEXPOSE(log10(TEXPOSE_S_local), 
+			INPUTS_SPECTRO.LOGTEXPOSE_LIST,
+			&IBIN_LZS, &FRAC_LZS, errmsg_ZP_S);
+  get_interpWgt_TEXPOSE(TEXPOSE_S_local, INPUTS_SPECTRO.TEXPOSE_LIST,
+			&IBIN_S, &FRAC_S, errmsg_SQ_S);
+  if ( DO_TEMPLATE ) {
+    get_interpWgt_TEXPOSE(log10(TEXPOSE_T), INPUTS_SPECTRO.LOGTEXPOSE_LIST,
+			  &IBIN_LZT, &FRAC_LZT, errmsg_ZP_T);
+    get_interpWgt_TEXPOSE(TEXPOSE_T, INPUTS_SPECTRO.TEXPOSE_LIST,
+			  &IBIN_T, &FRAC_T, errmsg_SQ_T);
+  }
+
+  for(ILAM=0; ILAM < NBLAM; ILAM++ ) {
+    ZP    = INPUTS_SPECTRO.ZP[ILAM] ;
+    SQSIG = INPUTS_SPECTRO.SQSIGSKY[ILAM] ;
+    if ( ZP[0] < 0.0 ) {
+      SNR_SPECTRO_CACHE.ZP_S[ILAM] = SNR_SPECTRO_CACHE.SQ_S[ILAM] = 0.0 ;
+      SNR_SPECTRO_CACHE.SQ_T[ILAM] = 0.0 ;
+      continue ;
+    }
+
+    ZP_S = ZP[IBIN_LZS] + FRAC_LZS*(ZP[IBIN_LZS+1] - ZP[IBIN_LZS]) ;
+    SNR_SPECTRO_CACHE.ZP_S[ILAM] = ZP_S ;
+    SNR_SPECTRO_CACHE.SQ_S[ILAM] = 
+      SQSIG[IBIN_S] + FRAC_S*(SQSIG[IBIN_S+1] - SQSIG[IBIN_S]) ;
+
+    SQ_T = 0.0 ;
+    if ( DO_TEMPLATE ) {
+      ZP_T  = ZP[IBIN_LZT] + FRAC_LZT*(ZP[IBIN_LZT+1] - ZP[IBIN_LZT]) ;
+      SQ_T  = SQSIG[IBIN_T] + FRAC_T*(SQSIG[IBIN_T+1] - SQSIG[IBIN_T]) ;
+      SQ_T *= pow( TEN, 0.8*(ZP_S-ZP_T) ) ; // see getSNR_spectrograph
+    }
+    SNR_SPECTRO_CACHE.SQ_T[ILAM] = SQ_T ;
+  }
+
+  SNR_SPECTRO_CACHE.TEXPOSE_S = TEXPOSE_S ;
+  SNR_SPECTRO_CACHE.TEXPOSE_T = TEXPOSE_T ;
+  SNR_SPECTRO_CACHE.VALID     = true ;
+
+  return ;
+
+} // end fill_SNR_SPECTRO_CACHE
+
+
+// ====================================================
+void get_interpWgt_TEXPOSE(double val, double *VAL_LIST, int *IBIN,
+			   double *FRAC, char *abort_comment) {
+
+  // Created Oct 2026
+  // Return Texpose bin *IBIN and linear-interp fraction *FRAC 
+  // such that f(val) = f[IBIN] + FRAC*(f[IBIN+1]-f[IBIN]),
+  // matching interp_1DFUN with OPT_INTERP_LINEAR.
+
+  int  NBT  = INPUTS_SPECTRO.NBIN_TEXPOSE ;
+  int  ibin ;
+  char fnam[] = "get_interpWgt_TEXPOSE" ;
+
+  // -------------- BEGIN --------------
+
+  ibin = quickBinSearch(val, NBT, VAL_LIST, abort_comment, fnam );
+
+  if ( ibin < 0 || ibin >= NBT-1 ) {
+    sprintf(c1err,"quickBinSearch returned invalid IBIN=%d (NBIN=%d)", 
+	    ibin, NBT );
+    sprintf(c2err,"Check '%s'", abort_comment);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+  }
+
+  *IBIN = ibin ;
+  *FRAC = (val - VAL_LIST[ibin]) / (VAL_LIST[ibin+1] - VAL_LIST[ibin]);
+
+  return ;
+
+} // end get_interpWgt_TEXPOSE
+
+
 int IMJD_GENSPEC(double MJD) {
   // Created July 2023
   // return IMJD index such that MJD_LIST[IMJD] = MJD       
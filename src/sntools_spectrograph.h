@@ -69,6 +69,17 @@ struct {
 #define MXVALUES_SPECBIN  10+2*MXTEXPOSE_SPECTROGRAPH
 double  VALUES_SPECBIN[MXVALUES_SPECBIN];
 
+// Oct 2026: Texpose-interpolated quantities vs. ILAM for the last
+// (TEXPOSE_S,TEXPOSE_T) pair; re-used by getSNR_spectrograph_LIST
+// while consecutive spectra have the same exposure times.
+struct {
+  int    NBIN_LAM ;              // number of allocated ILAM bins
+  bool   VALID ;                 // T -> arrays below are filled
+  double TEXPOSE_S, TEXPOSE_T ;  // exposure times for filled arrays
+  double TEXTRAP_SCALE ;         // sqrt(TEXPOSE_S/TEXPOSE_S_local)
+  double *ZP_S, *SQ_S, *SQ_T ;   // SQ_T is already scaled to ZP_S
+} SNR_SPECTRO_CACHE ;
+
 
 // ------ GENERATED SPECTRA ------                                                        
 struct {
@@ -106,6 +117,7 @@ struct {
   double *GENFLUX_PEAK ; // GENFLUX at PEAKMJD; needed for HOSTSNFRAC option
   double *GENMAG_PEAK ;  
   double  SCALE_FLAM_HOST_CONTAM[MXSPEC]; // fraction of host spec included in SN spec
+  double  SCALE_HOSTSNFRAC ; // HOSTSNFRAC scale, same for each SN spec in event
 
   // observed (noisy) flux vs [NMJD][ILAM] 
   double  *OBSFLUX_LIST[MXSPEC] ;     // obs flux with noise
@@ -140,6 +152,7 @@ struct {
   double *RANGauss_NOISE_TEMPLATE ; 
 
   bool IS_MALLOC[MXSPEC] ;
+  int  NMJD_MALLOC ; // sim: number of spectra with malloc'ed lambda arrays
 
 } GENSPEC ;
 
@@ -170,6 +183,15 @@ void get_FILTERtrans_spectrograph(double *LMIN, double *LMAX, int MXLAM,
 
 double getSNR_spectrograph(int ilam, double Texpose_S, double Texpose_T, 
 			   bool ALLOW_TEXTRAP,double genMag,double *ERRFRAC_T);
+void   getSNR_spectrograph_LIST(int ILAM_MIN, int ILAM_MAX,
+				double Texpose_S, double Texpose_T,
+				bool ALLOW_TEXTRAP, bool *USE_LIST,
+				double *genMag_LIST, double *SNR_LIST,
+				double *ERRFRAC_T_LIST);
+void   fill_SNR_SPECTRO_CACHE(double Texpose_S, double Texpose_T,
+			      bool ALLOW_TEXTRAP);
+void   get_interpWgt_TEXPOSE(double val, double *VAL_LIST, int *IBIN,
+			     double *FRAC, char *abort_comment);
 
 void check_SNR_SPECTROGRAPH(int l, int t);
 
@@ -11,12 +11,21 @@
     start adding code to read LOGMASS_LENS and LOGMASS_ERR_LENS
     to enable selecting appropriate LENS galaxy as observed host.
 
+  Oct 15 2026 - 
+    + optional binary cache of lens library (STRONGLENS_CACHEFILE)
+    + get_stronglens finds ZSRC window from sorted index instead of
+      two loops over entire library for each event. Default pick is
+      still in library order; STRONGLENS_ORDER_ZSRC=1 picks directly
+      from the ZSRC-sorted window.
+    + fix malloc size for IDLENS (long long)
+
  ***************************************/
 
 
 #include "sntools.h"
 #include "sntools_stronglens.h"
 #include "sntools_host.h" 
+#include <sys/stat.h>
 
 double prob_stronglens(double z) {
 
@@ -34,10 +43,16 @@ double prob_stronglens(double z) {
 } // end prob_stronglens
 
 // ==========================================
-void init_stronglens(char *MODEL_FILE) {
+void init_stronglens(char *MODEL_FILE, char *CACHE_FILE, int ORDER_ZSRC) {
 
   // Initialize strong lens model by reading MODEL_FILE and
   // storing contents.
+  //
+  // Oct 15 2026: if CACHE_FILE is valid for MODEL_FILE, read binary
+  //   cache instead of parsing text; else parse text and write cache.
+  //   Then build ZSRC-sorted index for get_stronglens.
+  //   ORDER_ZSRC=1 -> get_stronglens picks lens in ZSRC order
+  //   instead of library order.
 
   FILE *fp;
   char fnam[] = "init_stronglens";
@@ -53,6 +68,7 @@ void init_stronglens(char *MODEL_FILE) {
 
   INPUTS_STRONGLENS.USE_FLAG = 0 ;
   INPUTS_STRONGLENS.NCALL    = 0 ;
+  INPUTS_STRONGLENS.ORDER_ZSRC = ORDER_ZSRC ;
   if ( IGNOREFILE(MODEL_FILE) ) { return; }
 
   sprintf(BANNER,"%s", fnam);
@@ -72,6 +88,12 @@ void init_stronglens(char *MODEL_FILE) {
   printf("\t Read strong lens model from\n\t %s\n", MODEL_FILE);
   fflush(stdout);
 
+  if ( read_stronglens_cache(CACHE_FILE, FULLNAME_MODEL_FILE) ) {
+    fclose(fp);
+    init_stronglens_zindex();
+    return ;
+  }
+
   // estimate NLENS with upper bound; e.g., read number of lines in file,
   // or read NLENS key from library.  Then allocate memory.
   int NROWS = nrow_read(MODEL_FILE,fnam);
@@ -347,6 +369,10 @@ void init_stronglens(char *MODEL_FILE) {
 
   INPUTS_STRONGLENS.NLENS = i-1;
   //printf("%i\n",INPUTS_STRONGLENS.NLENS);
+
+  write_stronglens_cache(CACHE_FILE, FULLNAME_MODEL_FILE);
+  init_stronglens_zindex();
+
   return ;
 
 } // end init_stronglens
@@ -363,13 +389,14 @@ void malloc_stronglens(int NLENS) {
   int MEMFF = NLENS * sizeof(float*);
   int MEMF  = NLENS * sizeof(float);
   int MEMI  = NLENS * sizeof(int);
+  int MEML  = NLENS * sizeof(long long int);
     
   int i;  
   char fnam[] = "malloc_stronglens";
 
   // ------------ BEGIN --------------
 
-  INPUTS_STRONGLENS.IDLENS            = (long long int  *) malloc(MEMI);
+  INPUTS_STRONGLENS.IDLENS            = (long long int  *) malloc(MEML);
   INPUTS_STRONGLENS.ZLENS             = (float*) malloc(MEMF);
   INPUTS_STRONGLENS.LOGMASS_LENS      = (float*) malloc(MEMF);
   INPUTS_STRONGLENS.LOGMASS_ERR_LENS  = (float*) malloc(MEMF);
@@ -395,6 +422,222 @@ void malloc_stronglens(int NLENS) {
 
 } // end malloc_stronglens
 
+
+// ===================================
+int read_stronglens_cache(char *CACHE_FILE, char *MODEL_FILE) {
+
+  // Created Oct 2026
+  // If CACHE_FILE exists and was written from MODEL_FILE with 
+  // same size & modification time, read lens library from binary
+  // CACHE_FILE and return 1. Otherwise return 0 (parse text).
+
+  FILE   *fp;
+  struct stat st ;
+  char   magic[20];
+  long long SIZE_MODEL, SIZE_CACHE, MTIME_MODEL, MTIME_CACHE ;
+  int    NLENS, i, NIMG, nrd = 0, nexp = 0 ;
+  char   fnam[] = "read_stronglens_cache" ;
+
+  // ------------ BEGIN --------------
+
+  if ( IGNOREFILE(CACHE_FILE) ) { return 0 ; }
+  if ( stat(MODEL_FILE,&st) != 0 ) { return 0 ; }
+  SIZE_MODEL = (long long)st.st_size ;  MTIME_MODEL = (long long)st.st_mtime;
+
+  fp = fopen(CACHE_FILE,"rb");
+  if ( !fp ) { return 0 ; }
+
+  nrd += fread(magic, sizeof(char), 20, fp);
+  nrd += fread(&SIZE_CACHE,  sizeof(long long), 1, fp);
+  nrd += fread(&MTIME_CACHE, sizeof(long long), 1, fp);
+  nrd += fread(&NLENS,       sizeof(int), 1, fp);
+  magic[19] = 0 ;
+  if ( nrd != 23 || strcmp(magic,MAGIC_STRONGLENS_CACHE) != 0 ||
+       SIZE_CACHE != SIZE_MODEL || MTIME_CACHE != MTIME_MODEL ) {
+    printf("\t Ignore stale/invalid SL cache %s\n", CACHE_FILE);
+    fflush(stdout);
+    fclose(fp);  return 0 ;
+  }
+
+  malloc_stronglens(NLENS+1);
+  INPUTS_STRONGLENS.NLENS = NLENS ;
+
+  nrd  = fread(INPUTS_STRONGLENS.IDLENS,   sizeof(long long), NLENS, fp);
+  nrd += fread(INPUTS_STRONGLENS.ZLENS,    sizeof(float), NLENS, fp);
+  nrd += fread(INPUTS_STRONGLENS.LOGMASS_LENS,     sizeof(float),NLENS,fp);
+  nrd += fread(INPUTS_STRONGLENS.LOGMASS_ERR_LENS, sizeof(float),NLENS,fp);
+  nrd += fread(INPUTS_STRONGLENS.XGAL_SRC, sizeof(float), NLENS, fp);
+  nrd += fread(INPUTS_STRONGLENS.YGAL_SRC, sizeof(float), NLENS, fp);
+  nrd += fread(INPUTS_STRONGLENS.ZSRC,     sizeof(float), NLENS, fp);
+  nrd += fread(INPUTS_STRONGLENS.NIMG,     sizeof(int),   NLENS, fp);
+  nexp = 8*NLENS ;
+
+  for(i=0; i < NLENS; i++ ) {
+    NIMG  = INPUTS_STRONGLENS.NIMG[i];
+    if ( NIMG < 0 || NIMG > MXIMG_STRONGLENS ) { break; }
+    nrd  += fread(INPUTS_STRONGLENS.XIMG_SRC[i], sizeof(float), NIMG, fp);
+    nrd  += fread(INPUTS_STRONGLENS.YIMG_SRC[i], sizeof(float), NIMG, fp);
+    nrd  += fread(INPUTS_STRONGLENS.DELAY[i],    sizeof(float), NIMG, fp);
+    nrd  += fread(INPUTS_STRONGLENS.MAGNIF[i],   sizeof(float), NIMG, fp);
+    nexp += 4*NIMG ;
+  }
+  fclose(fp);
+
+  if ( nrd != nexp ) {
+    sprintf(c1err,"Read %d of %d expected items (NLENS=%d)", 
+	    nrd, nexp, NLENS);
+    sprintf(c2err,"Check or remove SL cache %s", CACHE_FILE);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+  }
+
+  printf("\t Read %d lenses from binary cache %s\n", NLENS, CACHE_FILE);
+  fflush(stdout);
+  return 1 ;
+
+} // end read_stronglens_cache
+
+// ===================================
+void write_stronglens_cache(char *CACHE_FILE, char *MODEL_FILE) {
+
+  // Created Oct 2026
+  // Write lens library to binary CACHE_FILE for faster init in later
+  // jobs; header stores MODEL_FILE size and modification time to
+  // detect stale cache.
+
+  FILE   *fp;
+  struct stat st ;
+  char   magic[20];
+  long long SIZE_MODEL, MTIME_MODEL ;
+  int    NLENS = INPUTS_STRONGLENS.NLENS, i, NIMG ;
+  // char   fnam[] = "write_stronglens_cache" ;
+
+  // ------------ BEGIN --------------
+
+  if ( IGNOREFILE(CACHE_FILE) ) { return ; }
+  if ( stat(MODEL_FILE,&st) != 0 ) { return ; }
+  SIZE_MODEL = (long long)st.st_size ;  MTIME_MODEL = (long long)st.st_mtime;
+
+  fp = fopen(CACHE_FILE,"wb");
+  if ( !fp ) {
+    printf("\t WARNING: cannot write SL cache %s\n", CACHE_FILE);
+    fflush(stdout);  return ;
+  }
+
+  memset(magic, 0, sizeof(magic));
+  sprintf(magic, "%s", MAGIC_STRONGLENS_CACHE);
+  fwrite(magic, sizeof(char), 20, fp);
+  fwrite(&SIZE_MODEL,  sizeof(long long), 1, fp);
+  fwrite(&MTIME_MODEL, sizeof(long long), 1, fp);
+  fwrite(&NLENS,       sizeof(int), 1, fp);
+
+  fwrite(INPUTS_STRONGLENS.IDLENS,   sizeof(long long), NLENS, fp);
+  fwrite(INPUTS_STRONGLENS.ZLENS,    sizeof(float), NLENS, fp);
+  fwrite(INPUTS_STRONGLENS.LOGMASS_LENS,     sizeof(float), NLENS, fp);
+  fwrite(INPUTS_STRONGLENS.LOGMASS_ERR_LENS, sizeof(float), NLENS, fp);
+  fwrite(INPUTS_STRONGLENS.XGAL_SRC, sizeof(float), NLENS, fp);
+  fwrite(INPUTS_STRONGLENS.YGAL_SRC, sizeof(float), NLENS, fp);
+  fwrite(INPUTS_STRONGLENS.ZSRC,     sizeof(float), NLENS, fp);
+  fwrite(INPUTS_STRONGLENS.NIMG,     sizeof(int),   NLENS, fp);
+
+  for(i=0; i < NLENS; i++ ) {
+    NIMG = INPUTS_STRONGLENS.NIMG[i];
+    fwrite(INPUTS_STRONGLENS.XIMG_SRC[i], sizeof(float), NIMG, fp);
+    fwrite(INPUTS_STRONGLENS.YIMG_SRC[i], sizeof(float), NIMG, fp);
+    fwrite(INPUTS_STRONGLENS.DELAY[i],    sizeof(float), NIMG, fp);
+    fwrite(INPUTS_STRONGLENS.MAGNIF[i],   sizeof(float), NIMG, fp);
+  }
+  fclose(fp);
+
+  printf("\t Wrote %d lenses to binary cache %s\n", NLENS, CACHE_FILE);
+  fflush(stdout);
+
+} // end write_stronglens_cache
+
+// ===================================
+void init_stronglens_zindex(void) {
+
+  // Created Oct 2026
+  // Sort library by ZSRC, and store pointers from uniform z-bins
+  // into sorted list so that get_stronglens finds the ZSRC window
+  // in O(1) instead of looping over entire library.
+
+  int    NLENS = INPUTS_STRONGLENS.NLENS ;
+  int    NZBIN = NZBIN_ZINDEX_STRONGLENS ;
+  int    j, iz, ORDER_SORT = +1 ;
+  double ZMIN, DZ, zbin ;
+  // char fnam[] = "init_stronglens_zindex" ;
+
+  // ------------ BEGIN --------------
+
+  INPUTS_STRONGLENS.ISORT_ZSRC   = (int  *)malloc((NLENS+1)*sizeof(int));
+  INPUTS_STRONGLENS.ZSRC_SORT    = (float*)malloc((NLENS+1)*sizeof(float));
+  INPUTS_STRONGLENS.IZPTR_ZINDEX = (int  *)malloc((NZBIN+1)*sizeof(int));
+  INPUTS_STRONGLENS.NZBIN_ZINDEX = NZBIN ;
+
+  if ( NLENS <= 0 ) {
+    INPUTS_STRONGLENS.ZMIN_ZINDEX = 0.0 ;  INPUTS_STRONGLENS.DZ_ZINDEX = 1.0;
+    for(iz=0; iz <= NZBIN; iz++ ) { INPUTS_STRONGLENS.IZPTR_ZINDEX[iz]=0; }
+    return ;
+  }
+
+  sortFloat(NLENS, INPUTS_STRONGLENS.ZSRC, ORDER_SORT, 
+	    INPUTS_STRONGLENS.ISORT_ZSRC);
+  for(j=0; j < NLENS; j++ ) {
+    INPUTS_STRONGLENS.ZSRC_SORT[j] = 
+      INPUTS_STRONGLENS.ZSRC[INPUTS_STRONGLENS.ISORT_ZSRC[j]] ;
+  }
+
+  ZMIN = (double)INPUTS_STRONGLENS.ZSRC_SORT[0] ;
+  DZ   = ((double)INPUTS_STRONGLENS.ZSRC_SORT[NLENS-1] - ZMIN) / 
+    (double)NZBIN ;
+  if ( DZ <= 0.0 ) { DZ = 1.0 ; }
+  INPUTS_STRONGLENS.ZMIN_ZINDEX = ZMIN ;
+  INPUTS_STRONGLENS.DZ_ZINDEX   = DZ ;
+
+  j = 0 ;
+  for(iz=0; iz <= NZBIN; iz++ ) {
+    zbin = ZMIN + DZ*(double)iz ;
+    while ( j < NLENS && (double)INPUTS_STRONGLENS.ZSRC_SORT[j] < zbin ) 
+      { j++ ; }
+    INPUTS_STRONGLENS.IZPTR_ZINDEX[iz] = j ;
+  }
+
+} // end init_stronglens_zindex
+
+// ===================================
+int index_stronglens_zindex(double z, int OPT) {
+
+  // Created Oct 2026
+  // Return first sorted entry with
+  //   ZSRC >= z  (OPT=0)  or   ZSRC > z  (OPT=1)
+  // Returns NLENS if there is no such entry.
+
+  int    NLENS = INPUTS_STRONGLENS.NLENS ;
+  int    NZBIN = INPUTS_STRONGLENS.NZBIN_ZINDEX ;
+  double ZMIN  = INPUTS_STRONGLENS.ZMIN_ZINDEX ;
+  double DZ    = INPUTS_STRONGLENS.DZ_ZINDEX ;
+  float  *ZSORT = INPUTS_STRONGLENS.ZSRC_SORT ;
+  int    iz, j ;
+  double x ;
+
+  // ------------ BEGIN --------------
+
+  x  = (z - ZMIN)/DZ ;
+  iz = 0 ;
+  if ( x > 0.0 ) { iz = ( x < (double)NZBIN ) ? (int)x : NZBIN ; }
+  if ( iz > 0 && ZMIN + DZ*(double)iz > z ) { iz-- ; } // round-off
+
+  // all entries before IZPTR have ZSRC < ZMIN + iz*DZ <= z
+  j = INPUTS_STRONGLENS.IZPTR_ZINDEX[iz] ;
+  if ( OPT == 0 ) 
+    { while ( j < NLENS && (double)ZSORT[j] <  z ) { j++ ; } }
+  else
+    { while ( j < NLENS && (double)ZSORT[j] <= z ) { j++ ; } }
+
+  return j ;
+
+} // end index_stronglens_zindex
+
 // ==========================================
 void get_stronglens(double zSN, double *hostpar, int DUMPFLAG,
 		    EVENT_STRONGLENS_DEF *EVENT_SL ) {
@@ -421,12 +664,16 @@ void get_stronglens(double zSN, double *hostpar, int DUMPFLAG,
   //  YGAL_SRC   
   //
   // July 1 2022: pass new output args LOGMASS[_ERR]_LENS
+  // Oct 15 2026: find lenses within ZSRC tolerance from ZSRC-sorted
+  //    index (O(1)) instead of two loops over entire library.
+  //    Default pick is in library order as before, so results are
+  //    unchanged. If ORDER_ZSRC is set, pick directly from the
+  //    ZSRC-sorted window (faster, but different lens per random).
   //
 
-  int    NLENS_LIB = INPUTS_STRONGLENS.NLENS;
-  int    NIMG_local=0, img,i,j, numLens ;
+  int    NIMG_local=0, img, j, j0, j1, numLens, ilens ;
   long long int IDLENS_local;
-  double FlatRan, ZSRC, ZSRC_MINTOL, ZSRC_MAXTOL ;
+  double FlatRan, ZSRC_MINTOL, ZSRC_MAXTOL ;
   double zLENS_local, LOGMASS_local, LOGMASS_ERR_local, zSRC_local ;
 
   char fnam[] = "get_stronglens" ;
@@ -445,29 +692,29 @@ void get_stronglens(double zSN, double *hostpar, int DUMPFLAG,
   ZSRC_MINTOL = 0.99 * zSN ;
   ZSRC_MAXTOL = 1.01 * zSN ;
 
-  numLens = 0;
-  for(i=0; i < NLENS_LIB; i++) {
-    ZSRC = INPUTS_STRONGLENS.ZSRC[i] ;
-    if ( ZSRC>=ZSRC_MINTOL && ZSRC<=ZSRC_MAXTOL ) { numLens++; }
-  }
+  // sorted entries j0 <= j < j1 are within ZSRC tolerance
+  j0      = index_stronglens_zindex(ZSRC_MINTOL, 0);
+  j1      = index_stronglens_zindex(ZSRC_MAXTOL, 1);
+  numLens = j1 - j0 ;
 
-  if ( numLens==0 ) {
+  if ( numLens <= 0 ) {
     // printf("WARNING: No lens in library matches zSRC= %f\n", zSN);
     return;
   }
 
-
-  int possible_lenses[numLens];
-  j = 0;
-  for(i=0; i < NLENS_LIB; ++i) {
-    ZSRC = INPUTS_STRONGLENS.ZSRC[i];
-    if( ZSRC >= ZSRC_MINTOL && ZSRC <= ZSRC_MAXTOL) {
-      possible_lenses[j] = i ;
-      j++ ;
-    }
+  ilens = (int)( FlatRan*(numLens-1) ) ;
+  int random_lens_index ;
+  if ( INPUTS_STRONGLENS.ORDER_ZSRC ) {
+    random_lens_index = INPUTS_STRONGLENS.ISORT_ZSRC[j0+ilens] ;
+  }
+  else {
+    // sort window by library index to preserve library order
+    int possible_lenses[numLens], isort_lib[numLens];
+    for(j=0; j < numLens; j++ ) 
+      { possible_lenses[j] = INPUTS_STRONGLENS.ISORT_ZSRC[j0+j]; }
+    sortInt(numLens, possible_lenses, +1, isort_lib);
+    random_lens_index = possible_lenses[isort_lib[ilens]] ;
   }
-
-  int random_lens_index = possible_lenses[ (int)( FlatRan*(numLens-1) ) ];
 
   IDLENS_local  = INPUTS_STRONGLENS.IDLENS[random_lens_index];
   zLENS_local   = (double)INPUTS_STRONGLENS.ZLENS[random_lens_index];
@@ -39,8 +39,19 @@ struct {
   int ICOL_XGAL_SRC, ICOL_YGAL_SRC;
   int ICOL_MAGNIF, ICOL_DELAY;
 
+  // Oct 2026: ZSRC-sorted index for O(1) lens selection
+  int   *ISORT_ZSRC ;   // library index for each sorted entry
+  float *ZSRC_SORT ;    // sorted ZSRC
+  int    NZBIN_ZINDEX ;
+  double ZMIN_ZINDEX, DZ_ZINDEX ;
+  int   *IZPTR_ZINDEX ; // first sorted entry with ZSRC >= ZMIN + iz*DZ
+  int    ORDER_ZSRC ;   // 1 -> pick lens in ZSRC order (default=library)
+
 } INPUTS_STRONGLENS;
 
+#define NZBIN_ZINDEX_STRONGLENS 2000  // z-bins to point into sorted ZSRC
+#define MAGIC_STRONGLENS_CACHE  "SL_CACHE_V1"
+
 typedef struct {                                                                  
   long long int IDLENS; 
   int    NIMG; 
@@ -55,8 +66,12 @@ typedef struct {
 } EVENT_STRONGLENS_DEF ;  
 
 // function declarations
-void init_stronglens(char *MODEL_FILE);
+void init_stronglens(char *MODEL_FILE, char *CACHE_FILE, int ORDER_ZSRC);
 void malloc_stronglens(int NLENS);
+int  read_stronglens_cache(char *CACHE_FILE, char *MODEL_FILE);
+void write_stronglens_cache(char *CACHE_FILE, char *MODEL_FILE);
+void init_stronglens_zindex(void);
+int  index_stronglens_zindex(double z, int OPT);
 
 void get_stronglens(double zSN, double *hostpar, int LDMP,
 		    EVENT_STRONGLENS_DEF *EVENT_STRONGLENS) ;
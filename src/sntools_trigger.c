@@ -50,6 +50,21 @@
 
  Aug 09 2024: add logic to read and apply optional REQUIRE key in SPECEFF map.
  Aug 19 2024: replace c_get[60] with c_get[100] in a few places
+ Oct 14 2026: 
+   + batch PIPELINE efficiencies per event (GETEFF_PIPELINE_BATCH) with
+     DETECT map resolved once per filter.
+   + return early from gen_SEARCHEFF_PIPELINE if trigger is required and
+     there are too few detection periods to satisfy SEARCHEFF_LOGIC.
+ Oct 15 2026:
+   + SPEC map variables are bound at init to direct pointers into
+     SEARCHEFF_DATA (init_SEARCHEFF_BIND), and FIELDLIST=ALL maps skip
+     per-event field matching.
+   + gen_SEARCHEFF_SPEC_zHOST evaluates SPEC and zHOST efficiencies
+     in a single call from gen_SEARCHEFF.
+   + PHOTPROB: band & field matches bound at init and cached per event
+     (getMap_for_PHOTPROB), map variables use stored IVARABS instead 
+     of string lookup per obs, and random PHOTPROB is drawn from CDF 
+     with binary search (invCDF_PHOTPROB).
 
 ************************************/
 
@@ -142,6 +157,9 @@ void init_SEARCHEFF(char *SURVEY, int APPLYMASK_SEARCHEFF ) {
   // init prob of getting zHOST for unconfirmed SN
   init_SEARCHEFF_zHOST(SURVEY); // May 2014 
 
+  // bind map variables & fields for event loop (Oct 2026)
+  init_SEARCHEFF_BIND();
+
   // Mar 2018: check that user SEARCHEFF mask is possible
   check_APPLYMASK_SEARCHEFF(SURVEY,APPLYMASK_SEARCHEFF);
 
@@ -149,6 +167,73 @@ void init_SEARCHEFF(char *SURVEY, int APPLYMASK_SEARCHEFF ) {
 }  // end of init_SEARCHEFF
 
 
+// *************************************
+void init_SEARCHEFF_BIND(void) {
+
+  // Created Oct 2026
+  // After all maps are read, bind each SPECEFF variable to a direct 
+  // pointer into SEARCHEFF_DATA (scalar variables only; mags and 
+  // colors use filter indices from assign_SPECEFF), and flag maps 
+  // with FIELDLIST=ALL so that event loop skips field-string matching.
+  // For PHOTPROB maps, also store which filters match FILTERLIST.
+
+  int NMAP_SPEC     = INPUTS_SEARCHEFF.NMAP_SPEC ;
+  int NMAP_zHOST    = INPUTS_SEARCHEFF.NMAP_zHOST ;
+  int NMAP_PHOTPROB = INPUTS_SEARCHEFF.NMAP_PHOTPROB ;
+  int imap, ivar, NVAR, IVARTYPE, ifilt ;
+  double *PTR ;
+  char *FILT_TMP, FILT[2] ;
+
+  // ------------ BEGIN ------------
+
+  for(imap=0; imap < NMAP_SPEC; imap++ ) {
+    SEARCHEFF_SPEC[imap].FIELD_ALL = 
+      ( strcmp(SEARCHEFF_SPEC[imap].FIELDLIST,ALL) == 0 );
+    NVAR = SEARCHEFF_SPEC[imap].GRIDMAP.NDIM ;
+    for(ivar=0; ivar < NVAR; ivar++ ) {
+      IVARTYPE = SEARCHEFF_SPEC[imap].IVARTYPE[ivar];
+      PTR = NULL ;
+      if ( IVARTYPE == IVARTYPE_SPECEFF_REDSHIFT ) 
+	{ PTR = &SEARCHEFF_DATA.REDSHIFT ; }
+      else if ( IVARTYPE == IVARTYPE_SPECEFF_PEAKMJD ) 
+	{ PTR = &SEARCHEFF_DATA.PEAKMJD ; }
+      else if ( IVARTYPE == IVARTYPE_SPECEFF_DTPEAK ) 
+	{ PTR = &SEARCHEFF_DATA.DTPEAK_MIN ; }
+      else if ( IVARTYPE == IVARTYPE_SPECEFF_DTSEASON_PEAK ) 
+	{ PTR = &SEARCHEFF_DATA.DTSEASON_PEAK ; }
+      else if ( IVARTYPE == IVARTYPE_SPECEFF_LOGMASS ) 
+	{ PTR = &SEARCHEFF_DATA.LOGMASS ; }
+      else if ( IVARTYPE == IVARTYPE_SPECEFF_SALT2mB ) 
+	{ PTR = &SEARCHEFF_DATA.SALT2mB ; }
+      else if ( IVARTYPE == IVARTYPE_SPECEFF_SALT2x1 ) 
+	{ PTR = &SEARCHEFF_DATA.SALT2x1 ; }
+      else if ( IVARTYPE == IVARTYPE_SPECEFF_SALT2c ) 
+	{ PTR = &SEARCHEFF_DATA.SALT2c ; }
+      SEARCHEFF_SPEC[imap].PTRVAR[ivar] = PTR ;
+    }
+  }
+
+  for(imap=0; imap < NMAP_zHOST; imap++ ) {
+    SEARCHEFF_zHOST[imap].FIELD_ALL = 
+      ( strcmp(SEARCHEFF_zHOST[imap].FIELDLIST,ALL) == 0 );
+  }
+
+  for(imap=0; imap < NMAP_PHOTPROB; imap++ ) {
+    SEARCHEFF_PHOTPROB[imap].FIELD_ALL = 
+      ( strcmp(SEARCHEFF_PHOTPROB[imap].FIELDLIST,ALL) == 0 );
+    FILT_TMP = SEARCHEFF_PHOTPROB[imap].FILTERLIST ;
+    for(ifilt=0; ifilt < MXFILTINDX; ifilt++ ) {
+      sprintf(FILT, "%c", FILTERSTRING[ifilt] );
+      SEARCHEFF_PHOTPROB[imap].MATCH_FILT[ifilt] = 
+	( strcmp(FILT_TMP,ALL) == 0 || 
+	  (FILT[0] != 0 && strstr(FILT_TMP,FILT) != NULL) ) ;
+    }
+  }
+
+  return ;
+
+} // end init_SEARCHEFF_BIND
+
 // *************************************
 void  check_APPLYMASK_SEARCHEFF(char *SURVEY, int APPLYMASK_SEARCHEFF_USER) {
 
@@ -236,6 +321,7 @@ void  check_APPLYMASK_SEARCHEFF(char *SURVEY, int APPLYMASK_SEARCHEFF_USER) {
     { sprintf(ctmp,"No trigger requirements"); }
 
   strcat(COMMENT_README_SEARCHEFF[0],ctmp);
+  INPUTS_SEARCHEFF.APPLYMASK_USER = APPLYMASK_SEARCHEFF_USER ;
 
   if ( INPUTS_SEARCHEFF.APPLY_DETECT_SINGLE ) {
     sprintf(COMMENT_README_SEARCHEFF[1],
@@ -1769,15 +1855,11 @@ int gen_SEARCHEFF ( int ID                  // (I) identifier
 
 
   // ------------------------------------
-  // if detected by pipeline, check if spec-confirmed
+  // if detected by pipeline, check if spec-confirmed, 
+  // and if not spec-confirmed, check for spec zHOST
   if ( LFIND1_PIPELINE )  { 
-    LFIND2_SPEC = gen_SEARCHEFF_SPEC(ID, EFF_SPEC) ;  // return EFF_SPEC
-  }
-
-
-  // if not spec-confirmed, check for spec zHOST
-  if ( LFIND1_PIPELINE && LFIND2_SPEC == 0 )  { 
-    LFIND3_zHOST = gen_SEARCHEFF_zHOST(ID,EFF_zHOST) ; // return EFF_zHOST
+    gen_SEARCHEFF_SPEC_zHOST(ID, &LFIND2_SPEC, &LFIND3_zHOST, 
+			     EFF_SPEC, EFF_zHOST );
   }
 
   // --- set return bit-MASK ---- 
@@ -1833,6 +1915,12 @@ int gen_SEARCHEFF_PIPELINE(int ID, MJD_DETECT_DEF *MJD_DETECT) {
   //
   // Oct 18 2021: load MJD_DETECT-FIRST[LAST]
   //
+  // Oct 14 2026: 
+  //  + compute EFF for all obs in GETEFF_PIPELINE_BATCH
+  //  + if PIPELINE trigger is required (APPLY_SEARCHEFF_OPT), return 0
+  //    before evaluating EFF when number of detection periods is
+  //    less than SEARCHEFF_LOGIC.NMJD (trigger is impossible).
+  //
 
   int NMJD_DETECT, NDETECT, imask, NOBS, MARK, DETECT_MARK, IMAP ;
   int IFILTOBS, obs, OVP, obsLast, istore, LFIND, FIRST=0;
@@ -1889,6 +1977,30 @@ int gen_SEARCHEFF_PIPELINE(int ID, MJD_DETECT_DEF *MJD_DETECT) {
   
   NDETECT = IFILTOBS_MASK = LFIND = DETECT_MARK = 0 ;
   OBS_PHOTPROB.NSTORE = 0 ;
+  for(IFILTOBS=0; IFILTOBS < MXFILTINDX; IFILTOBS++ ) 
+    { OBS_PHOTPROB.IMAP_FILT[IFILTOBS] = IMAP_PHOTPROB_UNSET; }
+
+  // NMJD_DETECT increments at most once per detection period, so
+  // skip EFF evaluation if trigger is required and impossible.
+  if ( INPUTS_SEARCHEFF.APPLYMASK_USER & APPLYMASK_SEARCHEFF_PIPELINE ) {
+    int NPERIOD = 0 ;
+    for(obs = 0 ; obs < NOBS; obs++ ) {
+      if ( SEARCHEFF_DATA.MAG[obs] == MAG_UNDEFINED ) { continue ; }
+      NPERIOD += OBSMARKER_DETECT[obs] ;
+    }
+    if ( NPERIOD < SEARCHEFF_LOGIC.NMJD ) {
+      for(obs = 0 ; obs < NOBS; obs++ ) {
+	OBS_PHOTPROB.IMAP_LIST[obs]    = -9;
+	SEARCHEFF_DATA.detectFlag[obs] = 0; 
+      }
+      if ( LDMP ) 
+	{ printf(" xxx NPERIOD=%d < NMJD -> no trigger\n", NPERIOD); }
+      return LFIND ;
+    }
+  }
+
+  // compute pipeline efficiency for all obs
+  GETEFF_PIPELINE_BATCH();
 
   // loop over each epoch and determine if there is a detection,
   // and also if there is a PHOTPROB measurement.
@@ -1901,7 +2013,7 @@ int gen_SEARCHEFF_PIPELINE(int ID, MJD_DETECT_DEF *MJD_DETECT) {
 
     IFILTOBS = SEARCHEFF_DATA.IFILTOBS[obs] ;
     RAN      = SEARCHEFF_RANDOMS.FLAT_PIPELINE[obs] ;
-    EFF      = GETEFF_PIPELINE_DETECT(obs); // compute effic
+    EFF      = SEARCHEFF_BATCH.EFF[obs]; // from GETEFF_PIPELINE_BATCH
     DETECT_FLAG =  ( RAN < EFF ) ;
 
     // Jul 2022 check resolving nearby source 
@@ -2066,6 +2178,88 @@ void dumpLine_PIPELINE_PHOTPROB(void) {
 }  // dumpLine_PIPELINE_PHOTPROB
 
 
+// ***************************************
+void GETEFF_PIPELINE_BATCH(void) {
+
+  // Created Oct 2026
+  // Evaluate pipeline detection efficiency for all obs of this event
+  // and store in SEARCHEFF_BATCH.EFF[obs]. The DETECT map for each
+  // filter is resolved on first use and re-used for the remaining obs,
+  // instead of a string-match over all maps for every obs.
+  // EFF is not evaluated for MAG_UNDEFINED obs.
+
+  int NOBS = SEARCHEFF_DATA.NOBS ;
+  int obs, ifilt_obs ;
+  // char fnam[] = "GETEFF_PIPELINE_BATCH" ;
+
+  // --------- BEGIN ----------
+
+  for(ifilt_obs=0; ifilt_obs < MXFILTINDX; ifilt_obs++ ) 
+    { SEARCHEFF_BATCH.IMAP_FILTER[ifilt_obs] = IMAP_UNRESOLVED_SEARCHEFF; }
+
+  for(obs = 0 ; obs < NOBS; obs++ ) {
+    SEARCHEFF_BATCH.EFF[obs] = 0.0 ;
+    if ( SEARCHEFF_DATA.MAG[obs] == MAG_UNDEFINED ) { continue ; }
+    SEARCHEFF_BATCH.EFF[obs] = GETEFF_PIPELINE_DETECT(obs);
+  }
+
+  return ;
+
+} // end GETEFF_PIPELINE_BATCH
+
+
+// ***************************************
+int IMAP_PIPELINE_DETECT(int ifilt_obs) {
+
+  // Created Oct 2026 (code moved from GETEFF_PIPELINE_DETECT)
+  // Return index of PIPELINE/DETECT map for this filter and the
+  // [optional] FIELD of this event; return IMAP_NONE_SEARCHEFF
+  // if there is no map for this filter.
+  // Result is stored in SEARCHEFF_BATCH.IMAP_FILTER so that map
+  // matching is done once per filter per event.
+
+  int  NMAP = INPUTS_SEARCHEFF.NMAP_DETECT ;
+  int  imap, IMAP, NMAP_FOUND=0 ;
+  bool MATCH_FILTER, MATCH_FIELD;
+  char cfilt[4], *field_map, *filt_map;
+  char fnam[] = "IMAP_PIPELINE_DETECT" ;
+
+  // --------- BEGIN ----------
+
+  IMAP = SEARCHEFF_BATCH.IMAP_FILTER[ifilt_obs] ;
+  if ( IMAP != IMAP_UNRESOLVED_SEARCHEFF ) { return IMAP; }
+
+  IMAP = IMAP_NONE_SEARCHEFF ;
+  sprintf(cfilt,"%c", FILTERSTRING[ifilt_obs] );
+
+  for(imap=0; imap < NMAP; imap++ ) {
+    field_map     = SEARCHEFF_DETECT[imap].FIELDLIST;
+    filt_map      = SEARCHEFF_DETECT[imap].FILTERLIST ;
+    MATCH_FILTER  = ( strstr(filt_map,cfilt) != NULL );
+    if ( strlen(field_map) > 0 ) 
+      { MATCH_FIELD   = MATCH_SEARCHEFF_FIELD(field_map); }
+    else
+      { MATCH_FIELD = true; }
+
+    if ( MATCH_FILTER && MATCH_FIELD ) 	
+      {  IMAP = imap;   NMAP_FOUND++; }
+  }
+
+  if ( NMAP_FOUND > 1 ) {
+    sprintf(c1err,
+	    "Found %d PIPELINE/DETECT maps for ifilt_obs=%d(%s)",
+	    NMAP_FOUND, ifilt_obs, cfilt);
+    sprintf(c2err,"Check EFF maps in %s", 
+	    INPUTS_SEARCHEFF.PIPELINE_EFF_FILE );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err) ; 
+  }
+
+  SEARCHEFF_BATCH.IMAP_FILTER[ifilt_obs] = IMAP ;
+  return IMAP ;
+
+} // end IMAP_PIPELINE_DETECT
+
+
 // ***************************************
 double GETEFF_PIPELINE_DETECT(int obs) {
 
@@ -2079,6 +2273,7 @@ double GETEFF_PIPELINE_DETECT(int obs) {
   // Feb 15 2022: add more info for isnan abort.
   // Jun 15 2022: check opt for single-exposure detections instead of coadd
   // Nov 30 2022: check for FIELD dependence
+  // Oct 14 2026: map lookup moved to IMAP_PIPELINE_DETECT (once per filter)
 
   int NMAP                = INPUTS_SEARCHEFF.NMAP_DETECT ;
   int APPLY_DETECT_SINGLE = INPUTS_SEARCHEFF.APPLY_DETECT_SINGLE ;
@@ -2087,11 +2282,10 @@ double GETEFF_PIPELINE_DETECT(int obs) {
   double EFF_atmax, EFF_atmin, VAL_atmax, VAL_atmin, VAL ;
   double ZERO = 0.0, ONE  = 1.0 ;
 
-  int CID, ifilt_obs, NPE_SAT, NBIN_EFF, imap, IMAP, NMAP_FOUND=0;
+  int CID, ifilt_obs, NPE_SAT, NBIN_EFF, IMAP ;
   int OPT_INTERP  = 1;   // 1=linear;  2=quadratic
-  bool MATCH_FILTER, MATCH_FIELD;
 
-  char cfilt[4], *field_map, *filt_map;
+  char cfilt[4] ;
   char fnam[] ="GETEFF_PIPELINE_DETECT" ;
 
   // ---------- BEGIN ---------
@@ -2103,39 +2297,17 @@ double GETEFF_PIPELINE_DETECT(int obs) {
   EFF       = 0.0 ;
 
   // find map corresponding to filter and [optional] FIELD
-  ifilt_obs = SEARCHEFF_DATA.IFILTOBS[obs] ;  IMAP=-9;
+  ifilt_obs = SEARCHEFF_DATA.IFILTOBS[obs] ;
   sprintf(cfilt,"%c", FILTERSTRING[ifilt_obs] );
-
-  for(imap=0; imap < NMAP; imap++ ) {
-    field_map     = SEARCHEFF_DETECT[imap].FIELDLIST;
-    filt_map      = SEARCHEFF_DETECT[imap].FILTERLIST ;
-    MATCH_FILTER  = ( strstr(filt_map,cfilt) != NULL );
-    if ( strlen(field_map) > 0 ) 
-      { MATCH_FIELD   = MATCH_SEARCHEFF_FIELD(field_map); }
-    else
-      { MATCH_FIELD = true; }
-
-    if ( MATCH_FILTER && MATCH_FIELD ) 	
-      {  IMAP = imap;   NMAP_FOUND++; }
-  }
+  IMAP      = IMAP_PIPELINE_DETECT(ifilt_obs);
 
   // if no maps are found for this filter, there are two possibilities:
   // 1) there are no maps at all --> return EFF=1
   // 2) there are maps for other bands -> return EFF=0
-  if ( NMAP_FOUND == 0 ) { 
+  if ( IMAP == IMAP_NONE_SEARCHEFF ) { 
     if ( NMAP == 0 ) { return(ONE); }  else { return(ZERO); }
   }
 
-
-  if ( NMAP_FOUND > 1 ) {
-    sprintf(c1err,
-	    "Found %d PIPELINE/DETECT maps for ifilt_obs=%d(%s)",
-	    NMAP_FOUND, ifilt_obs, cfilt);
-    sprintf(c2err,"Check EFF maps in %s", 
-	    INPUTS_SEARCHEFF.PIPELINE_EFF_FILE );
-    errmsg(SEV_FATAL, 0, fnam, c1err, c2err) ; 
-  }
-
   CID       = SEARCHEFF_DATA.CID ;
   NBIN_EFF  = SEARCHEFF_DETECT[IMAP].NBIN;
   SNR       = SEARCHEFF_DATA.SNR_CALC[obs] ;
@@ -2232,48 +2404,26 @@ void setObs_for_PHOTPROB(int DETECT_FLAG, int obs) {
   //    DETECT_FLAG = 0 if no detection
   //    obs         = observer index for SEARCHEFF_DATA array
   //   
+  // Oct 15 2026: map is found once per filter per event (getMap_for_PHOTPROB)
   
   int   NMAP       = INPUTS_SEARCHEFF.NMAP_PHOTPROB ;
   int   IFILTOBS   = SEARCHEFF_DATA.IFILTOBS[obs] ;
-  char  *FIELD     = SEARCHEFF_DATA.FIELDNAME ; 
 
   int  NSTORE = OBS_PHOTPROB.NSTORE;
-  int  imap, IMAP, NMATCH;
-  bool MATCH_FIELD, MATCH_FILT ;
-  char FILT[2], *FIELD_TMP, *FILT_TMP;
-  char fnam[]      = "setObs_for_PHOTPROB" ;
+  int  IMAP ;
 
   // ------------ BEGIN ------------
 
   if ( NMAP == 0 ) { return ; }
 
-
-  sprintf(FILT, "%c", FILTERSTRING[IFILTOBS] );
-
-  // find map for this filter and field.
-  NMATCH = 0 ;  IMAP=-9;
-  for(imap=0; imap < NMAP; imap++ ) {
-    MATCH_FIELD = MATCH_FILT = false ;
-    FIELD_TMP  = SEARCHEFF_PHOTPROB[imap].FIELDLIST;
-    FILT_TMP   = SEARCHEFF_PHOTPROB[imap].FILTERLIST ;
-
-    MATCH_FIELD = MATCH_SEARCHEFF_FIELD(FIELD_TMP); // Feb 2021
-
-    if ( strcmp(FILT_TMP,ALL) ==0 )        { MATCH_FILT=1; }
-    if ( strstr(FILT_TMP,FILT ) != NULL  ) { MATCH_FILT=1; }
-
-    if ( MATCH_FIELD && MATCH_FILT ) { IMAP = imap;  NMATCH++ ; }
-
-  } // end imap loop
-
-  if(NMATCH==0 )  { return; }
-
-  if(NMATCH > 1 ) {
-    sprintf(c1err,"%d matches to PHOTPROB map invalid.", NMATCH );
-    sprintf(c2err,"FIELD='%s'  FILT='%s' ", FIELD, FILT);
-    errmsg(SEV_FATAL, 0, fnam, c1err, c2err) ; 
+  IMAP = OBS_PHOTPROB.IMAP_FILT[IFILTOBS] ;
+  if ( IMAP == IMAP_PHOTPROB_UNSET ) {
+    IMAP = getMap_for_PHOTPROB(IFILTOBS);
+    OBS_PHOTPROB.IMAP_FILT[IFILTOBS] = IMAP ;
   }
 
+  if ( IMAP < 0 ) { return; }
+
   // check if PHOTPROB map requires a detection
   if ( DETECT_FLAG==0 && SEARCHEFF_PHOTPROB[IMAP].REQUIRE_DETECTION )
     { return; }
@@ -2292,6 +2442,46 @@ void setObs_for_PHOTPROB(int DETECT_FLAG, int obs) {
 }  // end setObs_for_PHOTPROB" ;
 
 
+// *************************************
+int getMap_for_PHOTPROB(int IFILTOBS) {
+
+  // Created Oct 2026 (code moved from setObs_for_PHOTPROB)
+  // Return PHOTPROB map index for this filter and current event field,
+  // or -9 if there is no map. Abort if more than one map matches.
+  // Filter matches are bound at init (init_SEARCHEFF_BIND).
+
+  int   NMAP       = INPUTS_SEARCHEFF.NMAP_PHOTPROB ;
+  char  *FIELD     = SEARCHEFF_DATA.FIELDNAME ; 
+  int  imap, IMAP, NMATCH;
+  bool MATCH_FIELD ;
+  char fnam[]      = "getMap_for_PHOTPROB" ;
+
+  // ------------ BEGIN ------------
+
+  NMATCH = 0 ;  IMAP=-9;
+  for(imap=0; imap < NMAP; imap++ ) {
+    if ( !SEARCHEFF_PHOTPROB[imap].MATCH_FILT[IFILTOBS] ) { continue; }
+
+    if ( SEARCHEFF_PHOTPROB[imap].FIELD_ALL ) 
+      { MATCH_FIELD = true; }
+    else
+      { MATCH_FIELD = MATCH_SEARCHEFF_FIELD(SEARCHEFF_PHOTPROB[imap].FIELDLIST); }
+
+    if ( MATCH_FIELD ) { IMAP = imap;  NMATCH++ ; }
+
+  } // end imap loop
+
+  if(NMATCH > 1 ) {
+    sprintf(c1err,"%d matches to PHOTPROB map invalid.", NMATCH );
+    sprintf(c2err,"FIELD='%s'  FILT='%c' ", FIELD, FILTERSTRING[IFILTOBS]);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err) ; 
+  }
+
+  return IMAP ;
+
+} // end getMap_for_PHOTPROB
+
+
 // ***************************************************
 void setRan_for_PHOTPROB(void) {
 
@@ -2473,10 +2663,7 @@ double get_PIPELINE_PHOTPROB(int istore) {
   // Finally, use linear interpolation to pick random PHOTPROB 
   // from PHOTPROB CDF.  Note that NFUN+1 includes the zero bin
   // because the zero bin is not stored in the GRIDMAP.
-  
-  double *ptrCDF  = PHOTPROB_CDF ;
-  double *ptrVAL  = SEARCHEFF_PHOTPROB[IMAP].PHOTPROB_CDFBINS ;
-  PHOTPROB = interp_1DFUN(1, RANCDF, NFUN+1, ptrCDF, ptrVAL, fnam);
+  PHOTPROB = invCDF_PHOTPROB(IMAP, RANCDF, PHOTPROB_CDF);
 
 
   LDMP = 0 ; // ( fabs(SEARCHEFF_DATA.SNR_CALC[obs]-8.0) < 0.1 );
@@ -2517,6 +2704,63 @@ double get_PIPELINE_PHOTPROB(int istore) {
 }  // end get_PIPELINE_PHOTPROB
 
 
+// ***************************************************
+double invCDF_PHOTPROB(int IMAP, double RANCDF, double *PHOTPROB_CDF) {
+
+  // Created Oct 2026
+  // Return PHOTPROB for random RANCDF using inverse of PHOTPROB_CDF,
+  // which has NFUN+1 values (including zero bin) at PHOTPROB_CDFBINS.
+  // Binary search for first CDF bin >= RANCDF, then linear interp;
+  // same result as interp_1DFUN, but without per-call string overhead.
+  // RANCDF outside CDF range goes to interp_1DFUN for the usual abort.
+
+  int    NFUN    = SEARCHEFF_PHOTPROB[IMAP].NFUN_CDF ;
+  double *ptrVAL = SEARCHEFF_PHOTPROB[IMAP].PHOTPROB_CDFBINS ;
+  int    ilo, ihi, imid ;
+  double cdf0, cdf1, frac ;
+  char fnam[] = "invCDF_PHOTPROB" ;
+
+  // ------------ BEGIN --------------
+
+  if ( NFUN < 1 || RANCDF < PHOTPROB_CDF[0] || RANCDF > PHOTPROB_CDF[NFUN] ) 
+    { return interp_1DFUN(1, RANCDF, NFUN+1, PHOTPROB_CDF, ptrVAL, fnam); }
+
+  // find smallest ihi in [1,NFUN] with RANCDF <= CDF[ihi]
+  ilo = 1;  ihi = NFUN ;
+  while ( ilo < ihi ) {
+    imid = (ilo + ihi) / 2 ;
+    if ( RANCDF <= PHOTPROB_CDF[imid] ) { ihi = imid; }
+    else                                { ilo = imid + 1; }
+  }
+
+  cdf0 = PHOTPROB_CDF[ihi-1];  cdf1 = PHOTPROB_CDF[ihi];
+  frac = (RANCDF - cdf0) / (cdf1 - cdf0) ;
+  return ptrVAL[ihi-1] + frac * ( ptrVAL[ihi] - ptrVAL[ihi-1] ) ;
+
+} // end invCDF_PHOTPROB
+
+
+// ***************************************************
+void gen_SEARCHEFF_SPEC_zHOST(int ID, int *LFIND_SPEC, int *LFIND_zHOST,
+			      double *EFF_SPEC, double *EFF_zHOST) {
+
+  // Created Oct 2026
+  // Evaluate SPEC and zHOST efficiencies for pipeline-detected event
+  // in one call. zHOST is evaluated only if not spec-confirmed.
+  // Outputs are the same as calling gen_SEARCHEFF_SPEC and then
+  // gen_SEARCHEFF_zHOST.
+
+  // ------------ BEGIN ------------
+
+  *LFIND_zHOST = 0 ;
+  *LFIND_SPEC  = gen_SEARCHEFF_SPEC(ID, EFF_SPEC) ;
+  if ( *LFIND_SPEC == 0 ) 
+    { *LFIND_zHOST = gen_SEARCHEFF_zHOST(ID, EFF_zHOST) ; }
+
+  return ;
+
+} // end gen_SEARCHEFF_SPEC_zHOST
+
 // ***************************************************
 int gen_SEARCHEFF_SPEC(int ID, double *EFF_SPEC) {
 
@@ -2527,6 +2771,7 @@ int gen_SEARCHEFF_SPEC(int ID, double *EFF_SPEC) {
   // Jun 02 2018: check opton to force EFF_SPEC=0
   // Jun 08 2018: check BOOLEAN OR/AND logic for EFF.
   // Aug 09 2024: check for REQUIRED map (e.g., PEAKMJD or DTPEAK)
+  // Oct 15 2026: use PTRVAR bindings for scalar variables
   
   int  NMAP        = INPUTS_SEARCHEFF.NMAP_SPEC ;
   int  BOOLEAN_OR  = SEARCHEFF_SPEC_INFO.BOOLEAN_OR  ;
@@ -2578,12 +2823,17 @@ int gen_SEARCHEFF_SPEC(int ID, double *EFF_SPEC) {
 
     // check if current field goes with this map
     FIELD_MAP = SEARCHEFF_SPEC[imap].FIELDLIST ;
-    MATCH = MATCH_SEARCHEFF_FIELD(FIELD_MAP);  // Feb 2021
+    MATCH = SEARCHEFF_SPEC[imap].FIELD_ALL || 
+      MATCH_SEARCHEFF_FIELD(FIELD_MAP);  // Feb 2021
     
     // determine list of variables
     NVAR = SEARCHEFF_SPEC[imap].GRIDMAP.NDIM ;
     for ( ivar=0; ivar < NVAR; ivar++ )  {
-      VARDATA[ivar] = LOAD_SPECEFF_VAR(imap,ivar);
+      double *PTR = SEARCHEFF_SPEC[imap].PTRVAR[ivar] ;
+      if ( PTR != NULL ) 
+	{ VARDATA[ivar] = *PTR ; }
+      else
+	{ VARDATA[ivar] = LOAD_SPECEFF_VAR(imap,ivar); }
       if ( LDMP ) {
 	char *VARNAME = SEARCHEFF_SPEC[imap].VARNAMES[ivar] ;	
 	printf(" xxx %s: imap=%d  load ivar=%d:  %s = %f \n",
@@ -2765,7 +3015,8 @@ double interp_SEARCHEFF_zHOST(void) {
 
     field_map  = SEARCHEFF_zHOST[imap].FIELDLIST ;
     field_data = SEARCHEFF_DATA.FIELDNAME ;
-    MATCH_FIELD = MATCH_SEARCHEFF_FIELD(field_map);
+    MATCH_FIELD = SEARCHEFF_zHOST[imap].FIELD_ALL ||
+      MATCH_SEARCHEFF_FIELD(field_map);
 
     PEAKMJD_RANGE = SEARCHEFF_zHOST[imap].PEAKMJD_RANGE ;
     PEAKMJD       = SEARCHEFF_DATA.PEAKMJD ;
@@ -2779,7 +3030,7 @@ double interp_SEARCHEFF_zHOST(void) {
       IGAL = SNHOSTGAL.IGAL ;
       for(ivar=0; ivar < NVAR; ivar++ ) {
 	ivar_HOSTLIB  = SEARCHEFF_zHOST[imap].IVAR_HOSTLIB[ivar] ;
-	VARDATA[ivar] = HOSTLIB.VALUE_ZSORTED[ivar_HOSTLIB][IGAL] ;
+	VARDATA[ivar] = get_VALUE_ZSORTED_HOSTLIB(ivar_HOSTLIB,IGAL);
       }
       
       istat = interp_GRIDMAP(&SEARCHEFF_zHOST[imap].GRIDMAP, VARDATA, 
@@ -2957,6 +3208,7 @@ double LOAD_PHOTPROB_VAR(int OBS, int IMAP, int IVAR) {
   // OBS is the observation index.
   //
   // Feb 14 2020: add REDSHIFT dependence
+  // Oct 15 2026: use IVARABS stored at init instead of VARNAME lookup
 
   double VALMIN  = SEARCHEFF_PHOTPROB[IMAP].VALMIN[IVAR] ;
   double VALMAX  = SEARCHEFF_PHOTPROB[IMAP].VALMAX[IVAR] ;
@@ -2977,7 +3229,7 @@ double LOAD_PHOTPROB_VAR(int OBS, int IMAP, int IVAR) {
   if ( SNR < 0.1 ) { SNR=0.1; }
 
   VARNAME = SEARCHEFF_PHOTPROB[IMAP].VARNAMES[IVAR] ;
-  IVARABS = IVARABS_SEARCHEFF_PHOTPROB(VARNAME) ;
+  IVARABS = SEARCHEFF_PHOTPROB[IMAP].IVARABS[IVAR] ;
 
   if ( IVARABS == IVARABS_PHOTPROB_SNR ) 
     { VAL = SNR ; }
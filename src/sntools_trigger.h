@@ -16,6 +16,8 @@
 
   Sep 02 2025: MXMAP_SEARCHEFF_SPEC = 20 -> 50 (for ATLAS)
 
+  Oct 15 2026: add PTRVAR and FIELD_ALL bindings for SPEC & zHOST maps
+
  **************************************************/
 
 
@@ -148,6 +150,8 @@ struct  {
 
   int RESTORE_DES5YR; // Oct 15 2025
 
+  int APPLYMASK_USER ; // APPLY_SEARCHEFF_OPT arg (Oct 2026)
+
 } INPUTS_SEARCHEFF ;
 
 
@@ -184,6 +188,10 @@ struct {
   double PHOTPROB_CDFBINS[MXVAR_SEARCHEFF_PHOTPROB] ;
   GRIDMAP_DEF GRIDMAP; 
 
+  // bound at init (Oct 2026)
+  bool FIELD_ALL ;                 // FIELDLIST=ALL -> skip field match
+  bool MATCH_FILT[MXFILTINDX] ;    // true if IFILTOBS is in FILTERLIST
+
   int NLINE_README;
   char README[4][MXPATHLEN];
 
@@ -197,8 +205,11 @@ struct {
   int    OBS_LIST[MXOBS_PHOTPROB];  // obs index for SEARCHEFF_DATA
   double RAN_LIST[MXOBS_PHOTPROB];  // list of ran[0,1]
   int    OBSINV_LIST[MXOBS_TRIGGER];  // local index vs [obs]
+  int    IMAP_FILT[MXFILTINDX];  // map vs. IFILTOBS for current event
 } OBS_PHOTPROB;
 
+#define IMAP_PHOTPROB_UNSET  -99  // IMAP_FILT not yet evaluated for event
+
 
 #define MXMASK_SEARCHEFF_LOGIC 10 // max number of logic conditions
 struct SEARCHEFF_LOGIC {
@@ -226,6 +237,10 @@ struct {
   int IFILTOBS_HOSTMAG[MXVAR_SEARCHEFF_SPEC]; 
   int IFILTOBS_SBMAG[MXVAR_SEARCHEFF_SPEC]; 
 
+  // bindings set once at init (Oct 2026)
+  double *PTRVAR[MXVAR_SEARCHEFF_SPEC]; // -> SEARCHEFF_DATA scalar, or NULL
+  bool   FIELD_ALL ;                    // FIELDLIST = ALL -> skip match
+
   GRIDMAP_DEF GRIDMAP ;
 
 } SEARCHEFF_SPEC[MXMAP_SEARCHEFF_SPEC] ;
@@ -247,6 +262,7 @@ struct {
   double PEAKMJD_RANGE[2]; // PEAKMJD range for each map (7/2020)
   char VARNAMES_HOSTLIB[MXVAR_SEARCHEFF_zHOST][40] ; 
   int  IVAR_HOSTLIB[MXVAR_SEARCHEFF_zHOST] ; // points to HOSTLIB ivar
+  bool FIELD_ALL ;      // FIELDLIST = ALL -> skip match (Oct 2026)
   GRIDMAP_DEF  GRIDMAP ;
 } SEARCHEFF_zHOST[MXMAP_SEARCHEFF_zHOST] ;
 
@@ -312,6 +328,18 @@ struct {
 } SEARCHEFF_RANDOMS ;
 
 
+// Oct 2026: per-event batch for pipeline detection efficiency.
+// DETECT map is resolved once per filter per event (map choice depends
+// only on filter and event FIELD), and EFF is evaluated for all obs
+// before the detection loop.
+#define IMAP_UNRESOLVED_SEARCHEFF  -1
+#define IMAP_NONE_SEARCHEFF        -9
+struct {
+  int    IMAP_FILTER[MXFILTINDX] ;  // DETECT map per filter
+  double EFF[MXOBS_TRIGGER] ;       // EFF(obs) from GETEFF_PIPELINE_DETECT
+} SEARCHEFF_BATCH ;
+
+
 // ============== FUNCTION PROTOTYPES ===============
 
 void   init_SEARCHEFF(char *SURVEY, int APPLYMASK_SEARCHEFF );
@@ -331,12 +359,15 @@ int  readMap_SEARCHEFF_PHOTPROB(FILE *fp,  char *key);
 int  malloc_NEXTMAP_SEARCHEFF_DETECT(void);
 
 void   check_APPLYMASK_SEARCHEFF(char *SURVEY, int APPLYMASK_SEARCHEFF);
+void   init_SEARCHEFF_BIND(void);
 
 int    gen_SEARCHEFF(int ID, double *EFF_SPEC, double *EFF_zHOST, 
 		     MJD_DETECT_DEF *MJD_DETECT );
 int    gen_SEARCHEFF_PIPELINE(int ID, MJD_DETECT_DEF *MJD_DETECT );
 int    gen_SEARCHEFF_SPEC(int ID, double *EFF_SPEC );
 int    gen_SEARCHEFF_zHOST(int ID, double *EFF_zHOST );
+void   gen_SEARCHEFF_SPEC_zHOST(int ID, int *LFIND_SPEC, int *LFIND_zHOST,
+				double *EFF_SPEC, double *EFF_zHOST);
 int    gen_SEARCHEFF_DEBUG(char *what, double RAN, double *EFF);
 double interp_SEARCHEFF_zHOST_LEGACY(void);
 double interp_SEARCHEFF_zHOST(void);
@@ -347,10 +378,14 @@ double LOAD_SPECEFF_VAR(int imap, int ivar);
 void   LOAD_PHOTPROB_CDF(int NVAR_CDF, double *WGTLIST );
 double LOAD_PHOTPROB_VAR(int OBS, int IMAP, int IVAR) ;
 double GETEFF_PIPELINE_DETECT(int obs);
+void   GETEFF_PIPELINE_BATCH(void);
+int    IMAP_PIPELINE_DETECT(int ifilt_obs);
 
 void   setObs_for_PHOTPROB(int DETECT_FLAG, int obs);
 void   setRan_for_PHOTPROB(void) ;
 double get_PIPELINE_PHOTPROB(int obs);
+double invCDF_PHOTPROB(int IMAP, double RANCDF, double *PHOTPROB_CDF);
+int    getMap_for_PHOTPROB(int IFILTOBS);
 double get_PIPELINE_PHOTPROB_Obsolete(int DETECT_FLAG, int obs);
 void   dumpLine_PIPELINE_PHOTPROB(void);
 
@@ -9,6 +9,8 @@
  HOSTLIB-WEAKLENS_DMU.
 
  Oct 2021: require DOCANA at top of weak lensing map file.
+ Oct 2026: tabulate inverse-CDF on uniform prob grid at init
+           so that gen_lensDMU draws are O(1).
 
  ******************/
 
@@ -31,6 +33,7 @@ void init_lensDMU(void) {
   // Oct 10 2021: require DOCANA
   // Apr 12 2024: apply bound checks on NZ and NDUM (number of bins)
   // Feb 04 2025: refactor to use INPUTS_WEAKLENS global input & print more info
+  // Oct 15 2026: call init_lensDMU_ICDF
 
   char  *PROBMAP_FILE = INPUTS_WEAKLENS.PROBMAP_FILE ;
   double DMUSCALE     = INPUTS_WEAKLENS.DMUSCALE ;
@@ -235,6 +238,8 @@ void init_lensDMU(void) {
   LENSING_PROBMAP.dmuMIN =  LENSING_PROBMAP.dmu_LIST[0] ;
   LENSING_PROBMAP.dmuMAX =  LENSING_PROBMAP.dmu_LIST[NDMU-1] ;
 
+  init_lensDMU_ICDF();
+
   // print summary 
   printf("\t Done initializing Prob(%.3f < DeltaMU < %.3f) \n",
 	 LENSING_PROBMAP.dmu_LIST[0], LENSING_PROBMAP.dmu_LIST[NDMU-1] );
@@ -253,6 +258,92 @@ void init_lensDMU(void) {
 } // end init_lensDMU
 
 
+// =====================================================
+void init_lensDMU_ICDF(void) {
+
+  // Created Oct 2026
+  // For each z bin, tabulate DMU at uniform cumulative prob
+  // u_k = k/NBIN_ICDF, and store FUNPROB bin containing each u_k.
+  // If u_k and u_k+1 are in the same FUNPROB bin, DMU is linear in u
+  // between them, so get_lensDMU_ICDF interpolation is exact; 
+  // otherwise a short local search is done from IBIN_ICDF.
+
+  int NZ    = LENSING_PROBMAP.NBIN_z ;
+  int NDMU  = LENSING_PROBMAP.NBIN_dmu ;
+  int NBIN  = 4*NDMU ;
+  int iz, k, j ;
+  double u, p0, p1, *FUNPROB, *FUNDMU ;
+  // char fnam[] = "init_lensDMU_ICDF" ;
+
+  // -------------- BEGIN --------------
+
+  LENSING_PROBMAP.NBIN_ICDF = NBIN ;
+  LENSING_PROBMAP.DMU_ICDF  = (double**) malloc(NZ * sizeof(double*));
+  LENSING_PROBMAP.IBIN_ICDF = (int   **) malloc(NZ * sizeof(int*));
+
+  for(iz=0; iz < NZ; iz++ ) {
+    LENSING_PROBMAP.DMU_ICDF[iz]  = (double*)malloc((NBIN+1)*sizeof(double));
+    LENSING_PROBMAP.IBIN_ICDF[iz] = (int   *)malloc((NBIN+1)*sizeof(int));
+    FUNPROB = LENSING_PROBMAP.FUNPROB[iz] ;
+    FUNDMU  = LENSING_PROBMAP.FUNDMU[iz] ;
+
+    j = 0 ;
+    for(k=0; k <= NBIN; k++ ) {
+      u = (double)k / (double)NBIN ;
+      while ( j < NDMU-2 && FUNPROB[j+1] <= u ) { j++ ; }
+      p0 = FUNPROB[j];  p1 = FUNPROB[j+1];
+      LENSING_PROBMAP.IBIN_ICDF[iz][k] = j ;
+      if ( p1 > p0 ) 
+	{ LENSING_PROBMAP.DMU_ICDF[iz][k] = 
+	    FUNDMU[j] + (u-p0)/(p1-p0) * (FUNDMU[j+1]-FUNDMU[j]) ; }
+      else
+	{ LENSING_PROBMAP.DMU_ICDF[iz][k] = FUNDMU[j+1] ; }
+    }
+  }
+
+  printf("\t Tabulated inverse-CDF with %d prob bins per z bin\n", NBIN);
+  fflush(stdout);
+
+} // end init_lensDMU_ICDF
+
+
+// =====================================================
+double get_lensDMU_ICDF(int iz, double ran1) {
+
+  // Created Oct 2026
+  // Return DMU for cumulative prob ran1 in z-bin iz;
+  // same as linear interp_1DFUN on FUNPROB -> FUNDMU.
+
+  int    NBIN  = LENSING_PROBMAP.NBIN_ICDF ;
+  int    NDMU  = LENSING_PROBMAP.NBIN_dmu ;
+  int    *IBIN = LENSING_PROBMAP.IBIN_ICDF[iz] ;
+  double *DMU  = LENSING_PROBMAP.DMU_ICDF[iz] ;
+  double *FUNPROB, *FUNDMU ;
+  double x, p0, p1 ;
+  int    k, j ;
+
+  // -------------- BEGIN --------------
+
+  x = ran1 * (double)NBIN ;
+  k = (int)x ;
+  if ( k >= NBIN ) { k = NBIN-1; }
+  if ( k < 0     ) { k = 0 ; }
+
+  if ( IBIN[k] == IBIN[k+1] )
+    { return DMU[k] + (x-(double)k)*(DMU[k+1]-DMU[k]) ; }
+
+  // grid cell spans FUNPROB node(s): local search from IBIN[k]
+  FUNPROB = LENSING_PROBMAP.FUNPROB[iz] ;
+  FUNDMU  = LENSING_PROBMAP.FUNDMU[iz] ;
+  j = IBIN[k] ;
+  while ( j < NDMU-2 && FUNPROB[j+1] <= ran1 ) { j++ ; }
+  p0 = FUNPROB[j];  p1 = FUNPROB[j+1];
+  if ( p1 <= p0 ) { return FUNDMU[j+1]; }
+  return FUNDMU[j] + (ran1-p0)/(p1-p0) * (FUNDMU[j+1]-FUNDMU[j]) ;
+
+} // end get_lensDMU_ICDF
+
+
 // =====================================================
 double gen_lensDMU_smear(double lensDMU) {
 
@@ -288,6 +379,8 @@ double gen_lensDMU( double z, double ran1, int DUMP_FLAG ) {
   //  ran1 = random number from 0 to 1
   //
   // Feb 16 2022; pass DUMP_FLAG arg
+  // Oct 15 2026: bisection for z-bin, and get_lensDMU_ICDF 
+  //   instead of binary search in interp_1DFUN.
 
   double lensDMU = 0.0 ;  // default  
   double zMIN = LENSING_PROBMAP.zMIN ;
@@ -295,10 +388,9 @@ double gen_lensDMU( double z, double ran1, int DUMP_FLAG ) {
   int    NBIN_dmu = LENSING_PROBMAP.NBIN_dmu ;
   int    NBIN_z   = LENSING_PROBMAP.NBIN_z ;
 
-  int OPT_INTERP = OPT_INTERP_LINEAR ;
-  double ztmp, z0, z1, zScale = 0.0 ;
+  double z0, z1, zScale = 0.0 ;
   double DMU0=-9.0, DMU1=-9.0, zFac=-9.0 ;
-  int    iz, iz0, iz1;
+  int    iz, iz0, iz1, izlo, izhi;
   char fnam[] = "gen_lensDMU" ;
 
   // -------------- BEGIN ------------- 
@@ -319,10 +411,13 @@ double gen_lensDMU( double z, double ran1, int DUMP_FLAG ) {
   }
   else {
     zScale = -9.0 ;
-    for(iz=0; iz < NBIN_z-1; iz++ ) {
-      ztmp = LENSING_PROBMAP.z_LIST[iz] ;
-      if ( ztmp < z ) { iz0=iz; iz1=iz0+1; }
+    // largest iz <= NBIN_z-2 with z_LIST[iz] < z
+    izlo = 0;  izhi = NBIN_z-2 ;
+    while ( izlo < izhi ) {
+      iz = (izlo + izhi + 1)/2 ;
+      if ( LENSING_PROBMAP.z_LIST[iz] < z ) { izlo = iz; } else { izhi = iz-1; }
     }
+    iz0 = izlo;  iz1 = iz0 + 1 ;
   }
 
 
@@ -335,25 +430,16 @@ double gen_lensDMU( double z, double ran1, int DUMP_FLAG ) {
   z0 = LENSING_PROBMAP.z_LIST[iz0] ;
   z1 = LENSING_PROBMAP.z_LIST[iz1] ;
 
-  double *ptrPROB[2], *ptrDMU[2] ;
-  ptrPROB[0] = LENSING_PROBMAP.FUNPROB[iz0] ;
-  ptrPROB[1] = LENSING_PROBMAP.FUNPROB[iz1] ;
-  ptrDMU[0]  = LENSING_PROBMAP.FUNDMU[iz0] ;
-  ptrDMU[1]  = LENSING_PROBMAP.FUNDMU[iz1] ;
-
   // - - - - - - - - - - - - - - - - - - - 
   if ( zScale > 0.0  ) {
     // scale lensDMU by zScale
-    lensDMU = interp_1DFUN(OPT_INTERP, ran1, NBIN_dmu,
-			   ptrPROB[0], ptrDMU[0], fnam );
+    lensDMU  = get_lensDMU_ICDF(iz0, ran1);
     lensDMU *= zScale ;
   }
   else {
     // interpolate lensDMU between two z bins
-    DMU0 = interp_1DFUN(OPT_INTERP, ran1, NBIN_dmu,
-			ptrPROB[0], ptrDMU[0], fnam );
-    DMU1 = interp_1DFUN(OPT_INTERP, ran1, NBIN_dmu,
-			ptrPROB[1], ptrDMU[1], fnam );
+    DMU0 = get_lensDMU_ICDF(iz0, ran1);
+    DMU1 = get_lensDMU_ICDF(iz1, ran1);
 
     zFac    = (z - z0)/(z1-z0);
     lensDMU = DMU0 + (DMU1-DMU0)*zFac ;
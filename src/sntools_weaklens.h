@@ -20,6 +20,12 @@ struct {
   double **FUNPROB ;  // DMU(SUMprob) in iz,imu bins
   double **FUNDMU ;
 
+  // Oct 2026: inverse-CDF on uniform grid of cumulative prob, 
+  // u_k = k/NBIN_ICDF, for O(1) draws in gen_lensDMU
+  int      NBIN_ICDF ;
+  double **DMU_ICDF ;   // [iz][k] = DMU(u_k) 
+  int    **IBIN_ICDF ;  // [iz][k] = FUNPROB bin containing u_k
+
   double zMIN, zMAX, dmuMIN, dmuMAX;
 } LENSING_PROBMAP ;
 
@@ -28,3 +34,5 @@ struct {
 void   init_lensDMU(void) ;
 double gen_lensDMU(double z, double ran1, int DUMP_FLAG);
 double gen_lensDMU_smear(double lensDMU);
+void   init_lensDMU_ICDF(void);
+double get_lensDMU_ICDF(int iz, double ran1);
@@ -18,6 +18,10 @@
      PROB_WRONGHOST_POLY key, and to also allow legacy input
      of 3rd-order poly with space-sep coefficients.
 
+ Oct 15 2026:
+   + z-binned index into ZTRUE-sorted list so that gen_zHOST finds
+     the ZTRUE window in O(1) instead of scanning the list.
+
 ***********************************************************/
 
 /*
@@ -205,11 +209,75 @@ void INIT_WRONGHOST(char *inFile, double ZMIN, double ZMAX) {
   free(tmpZMATCH);
   free(INDEX_SORT);
 
+  init_WRONGHOST_ZINDEX();
+
   return;
 
 } // end init_WRONGHOST
 
 
+// =====================================
+void init_WRONGHOST_ZINDEX(void) {
+
+  // Created Oct 2026
+  // Store pointers from uniform ZTRUE bins into ZTRUE-sorted list.
+
+  int    NLIST = WRONGHOST.NLIST ;
+  int    NBIN  = NBIN_ZINDEX_WRONGHOST ;
+  int    ibin, j ;
+  double ZMIN, DZ, zbin ;
+
+  // ---------- BEGIN ------------
+
+  WRONGHOST.IZPTR_ZINDEX = (int*) malloc( (NBIN+1)*sizeof(int) );
+  WRONGHOST.NBIN_ZINDEX  = NBIN ;
+
+  ZMIN = DZ = 0.0 ;
+  if ( NLIST > 0 ) {
+    ZMIN = WRONGHOST.ZTRUE_LIST[0] ;
+    DZ   = (WRONGHOST.ZTRUE_LIST[NLIST-1] - ZMIN) / (double)NBIN ;
+  }
+  if ( DZ <= 0.0 ) { DZ = 1.0 ; }
+  WRONGHOST.ZMIN_ZINDEX = ZMIN ;
+  WRONGHOST.DZ_ZINDEX   = DZ ;
+
+  j = 0 ;
+  for(ibin=0; ibin <= NBIN; ibin++ ) {
+    zbin = ZMIN + DZ*(double)ibin ;
+    while ( j < NLIST && WRONGHOST.ZTRUE_LIST[j] < zbin ) { j++ ; }
+    WRONGHOST.IZPTR_ZINDEX[ibin] = j ;
+  }
+
+} // end init_WRONGHOST_ZINDEX
+
+
+// =====================================
+int index_WRONGHOST_ZINDEX(double z) {
+
+  // Created Oct 2026
+  // Return first index with ZTRUE_LIST > z, or NLIST if none.
+
+  int    NLIST = WRONGHOST.NLIST ;
+  int    NBIN  = WRONGHOST.NBIN_ZINDEX ;
+  double ZMIN  = WRONGHOST.ZMIN_ZINDEX ;
+  double DZ    = WRONGHOST.DZ_ZINDEX ;
+  double x ;
+  int    ibin = 0, j ;
+
+  // ---------- BEGIN ------------
+
+  x = (z - ZMIN)/DZ ;
+  if ( x > 0.0 ) { ibin = ( x < (double)NBIN ) ? (int)x : NBIN ; }
+  if ( ibin > 0 && ZMIN + DZ*(double)ibin > z ) { ibin-- ; } // round-off
+
+  // entries before IZPTR have ZTRUE < ZMIN + ibin*DZ <= z
+  j = WRONGHOST.IZPTR_ZINDEX[ibin] ;
+  while ( j < NLIST && WRONGHOST.ZTRUE_LIST[j] <= z ) { j++ ; }
+  return j ;
+
+} // end index_WRONGHOST_ZINDEX
+
+
 double gen_zHOST(int CID, double zSN, int *hostMatch) {
 
   // Dec 2015
@@ -234,6 +302,10 @@ double gen_zHOST(int CID, double zSN, int *hostMatch) {
   //   + refactor to use parse_GENPOLY
   //   + minor fix to iz loop to find iz_start & iz_end
   //
+  // Oct 15 2026: find coarse ZTRUE > zSN entry from z-binned index
+  //   instead of scanning list in steps of NZJUMP_WRONGHOST; 
+  //   iz_start & iz_end (and therefore zHOST) are unchanged.
+  //
 
   int    NLIST = WRONGHOST.NLIST ;
   double zHOST = zSN ;
@@ -263,35 +335,20 @@ double gen_zHOST(int CID, double zSN, int *hostMatch) {
 
 #define NZJUMP_WRONGHOST 50  // junp this many z bins for rough ZTRUE check
 
-  int PAST_END = 0 ;
-  int iz, iz_start, iz_end, N_NEAR;
+  int iz, iz_start, iz_end, N_NEAR, j;
   int iz_list[5*NZJUMP_WRONGHOST] ;
   double ZTRUE, ZMATCH, DZ ;
 
-  iz_start = iz_end = -9 ; iz=0;
-  //  for ( iz=0; iz < NLIST ; iz+= NZJUMP_WRONGHOST ) {
-  while ( iz < NLIST ) {
-    ZTRUE = WRONGHOST.ZTRUE_LIST[iz] ;
-
-    // xxxxxxx
-    if ( CID == -52304 && ZTRUE > 0.44 ) {
-      printf(" xxx iz=%d of %d: ZTRUE=%.5f  zSN=%.5f \n",
-	     iz, NLIST, ZTRUE, zSN); fflush(stdout);
-    }
-    // xxxxx
-
-    if ( ZTRUE > zSN ) {
-      iz_start = iz - 2*NZJUMP_WRONGHOST ;
-      iz_end   = iz + 1*NZJUMP_WRONGHOST ;
-      goto SEARCH2_ZTRUE ;
-    }
-    
-    iz += NZJUMP_WRONGHOST ;
-    if ( iz >= NLIST && !PAST_END )  { iz = NLIST-1;  PAST_END++; }
-
-  } // end iz
-
- SEARCH2_ZTRUE:
+  // legacy scan checked iz = 0, NZJUMP, 2*NZJUMP ... and then NLIST-1,
+  // stopping at first ZTRUE > zSN; get same iz from first such entry j.
+  iz_start = iz_end = -9 ; 
+  j  = index_WRONGHOST_ZINDEX(zSN);
+  iz = NZJUMP_WRONGHOST * ( (j + NZJUMP_WRONGHOST - 1)/NZJUMP_WRONGHOST );
+  if ( iz >= NLIST && j < NLIST ) { iz = NLIST-1; }
+  if ( iz < NLIST ) {
+    iz_start = iz - 2*NZJUMP_WRONGHOST ;
+    iz_end   = iz + 1*NZJUMP_WRONGHOST ;
+  }
   
   if ( iz_start == -9 || iz_end == -9 ) {
     print_preAbort_banner(fnam);
@@ -14,11 +14,20 @@ struct {
   int     NLIST ;
   double *ZTRUE_LIST  ;
   double *ZMATCH_LIST ;
+
+  // Oct 2026: pointers from uniform ZTRUE bins into sorted list
+  int     NBIN_ZINDEX ;
+  double  ZMIN_ZINDEX, DZ_ZINDEX ;
+  int    *IZPTR_ZINDEX ;  // first entry with ZTRUE >= ZMIN + ibin*DZ
   
 } WRONGHOST  ;
 
+#define NBIN_ZINDEX_WRONGHOST 1000
+
 // ------------------------------------------------------------
 // prototype functions
 void    INIT_WRONGHOST(char *inFile, double ZMIN, double ZMAX);
 double  gen_zHOST(int CID, double zSN, int *istat ) ;
+void    init_WRONGHOST_ZINDEX(void);
+int     index_WRONGHOST_ZINDEX(double z);
 
@@ -37,6 +37,9 @@ void init_zPDF_spline(int N_Q, double* percentile_list, double* zphot_q_list,
   // Mar 25,2024: return mean and RMS
   // May 30 2024: return error_flag!=0  on bad quantiles instead of aborting;
   //              allows calling code to reject event and move on.
+  // Oct 15 2026: re-use gsl spline & accelerator from previous call if
+  //              N_Q and method_spline are unchanged (instead of malloc
+  //              for every event without free); free pdf_store.
   //
 
   char fnam[] = "init_zPDF_spline";
@@ -49,10 +52,23 @@ void init_zPDF_spline(int N_Q, double* percentile_list, double* zphot_q_list,
   // ------ BEGIN ---------
  
   *error_flag = 0; // init output 
-    
-  zPDF_spline.acc    = gsl_interp_accel_alloc();
 
-  if (strcmp(method_spline,METHOD_SPLINE_LINEAR)==0 ){
+  bool REUSE_SPLINE = ( zPDF_spline.N_Q_ALLOC == N_Q &&
+			strcmp(zPDF_spline.method_spline,method_spline)==0 );
+
+  if ( REUSE_SPLINE ) {
+    gsl_interp_accel_reset(zPDF_spline.acc);
+  }
+  else if ( zPDF_spline.N_Q_ALLOC > 0 ) {
+    gsl_spline_free(zPDF_spline.spline);
+    gsl_interp_accel_free(zPDF_spline.acc);
+    zPDF_spline.N_Q_ALLOC = 0 ;
+  }
+
+  if ( REUSE_SPLINE ) {
+    // nothing to allocate
+  }
+  else if (strcmp(method_spline,METHOD_SPLINE_LINEAR)==0 ){
     zPDF_spline.spline = gsl_spline_alloc(gsl_interp_linear, N_Q);     // Linear
   }
   else if (strcmp(method_spline,METHOD_SPLINE_CUBIC)==0){
@@ -74,6 +90,11 @@ void init_zPDF_spline(int N_Q, double* percentile_list, double* zphot_q_list,
 	    METHOD_SPLINE_LINEAR, METHOD_SPLINE_CUBIC, METHOD_SPLINE_STEFFEN);
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
   }
+
+  if ( !REUSE_SPLINE ) {
+    zPDF_spline.acc       = gsl_interp_accel_alloc();
+    zPDF_spline.N_Q_ALLOC = N_Q ;
+  }
     
   sprintf(zPDF_spline.method_spline, "%s", method_spline);
   zPDF_spline.zmin   = zphot_q_list[0];
@@ -136,7 +157,7 @@ void init_zPDF_spline(int N_Q, double* percentile_list, double* zphot_q_list,
   // - - - - 
   double zmin, zmax, dz, z, pdf, pdf_max = 0.0;
   int iz = 0; 
-  double *pdf_store = (double*)malloc((NBIN_SPLINE+1)*sizeof(double));
+  double *pdf_store = (double*)malloc((NBIN_SPLINE+2)*sizeof(double));
   //double pdf_store[40];
   zmin = zphot_q_list[0] ;
   zmax = zphot_q_list[N_Q-1] ;
@@ -172,7 +193,7 @@ void init_zPDF_spline(int N_Q, double* percentile_list, double* zphot_q_list,
   if(LDMP) {
   printf("XXX %s std = %le \n",fnam,*std_dev);
   }
-  //free(pdf_store);
+  free(pdf_store);
     
   zPDF_spline.pdf_max = pdf_max;
 
@@ -15,6 +15,7 @@ struct{
   gsl_spline       *spline;
   double zmin, zmax, dz; // dz used for derivative calculation
   double pdf_max ;
+  int    N_Q_ALLOC ; // N_Q for allocated spline; re-used if N_Q/method same
 } zPDF_spline ;
 
 
@@ -38,6 +38,16 @@
 
  Oct 2019: revived again for DES5YR analysis.
 
+ Oct 15 2026: 
+   - fill_MIGRATION_TABLE no longer searches the stored fit-bins for 
+     every SIMACC event; it appends the (gen,fit) bin pair to MIGPAIR.
+     After the event loop, build_MIGRATION_TABLE sorts the pairs and
+     compacts each run into one sparse migration entry, so the table 
+     is built in O(N log N) instead of O(N*NMIGBIN).
+   - CONTAIN_FRAC is computed once from the final sums.
+   - unfolding iteration uses flat fit-bin index and PSIM=XFIT/XGEN
+     cached per migration entry (set_MIGRATION_CACHE).
+
 *************/
 
 #include <stdio.h>
@@ -64,6 +74,9 @@ void malloc_ARRAY(int itype, int NSN);
 void fill_TABLE(int itype);  // store data in binned table
 void fill_MIGRATION_TABLE(int IZACC, int IB1ACC, int IB2ACC,
 			  int IZFIT, int IB1FIT, int IB2FIT, double WGTGEN ) ;
+void build_MIGRATION_TABLE(void);
+int  compare_MIGPAIR(const void *a, const void *b);
+void set_MIGRATION_CACHE(void);
 
 void  SET_TABLEBINS(char *string, int ipar);
 void  SET_INDEXMAP(void);
@@ -211,12 +224,28 @@ typedef struct MIGRATION_TABLE_DEF {
   short int IBIN2_NEAR[MAXMIGBIN];  // idem
   double    NSIMFIT_NEAR[MAXMIGBIN];  // SIMACC entries in this bin
   double    NSIMFIT_NEAR_SUM;
+
+  // Oct 2026: set once after table is built (set_MIGRATION_CACHE)
+  int       *INDEX_NEAR;            // INDEXMAP of fit bin
+  double    *PSIM_NEAR;             // NSIMFIT_NEAR/XGEN
 } MIGRATION_TABLE_DEF;
 
 MIGRATION_TABLE_DEF ***MIGRATION_TABLE;
 MIGRATION_TABLE_DEF **MIGRATION_TABLE_SUMZ;
 
 //MIGRATION_TABLE_DEF MIGRATION_TABLE[MAXZBIN][MAXBIN][MAXBIN]; 
+
+// Oct 2026: (gen,fit) pairs stored during fill_TABLE(SIMACC), 
+// then sorted & compacted into MIGRATION_TABLE.
+typedef struct {
+  int    INDEX_ACC, INDEX_FIT ;  // INDEXMAP for gen and fit bins
+  double WGT ;
+} MIGPAIR_DEF ;
+
+struct {
+  int NPAIR, NPAIR_ALLOC ;
+  MIGPAIR_DEF *LIST ;
+} MIGPAIR ;
 //MIGRATION_TABLE_DEF MIGRATION_TABLE_SUMZ[MAXBIN][MAXBIN]; 
 
 struct BINDUMP {
@@ -284,6 +313,7 @@ int main(int argc, char **argv) {
   rd_fitres(ITYPE_SIMACC,ITYPE_SIMFIT);
   fill_TABLE(ITYPE_SIMFIT);
   fill_TABLE(ITYPE_SIMACC); 
+  set_MIGRATION_CACHE();
 
 
   // --------------------------------
@@ -611,6 +641,8 @@ void init_unfold(void) {
   print_banner(fnam);
 
   PSUM_UNFOLD = 0.0 ;
+  MIGPAIR.NPAIR = MIGPAIR.NPAIR_ALLOC = 0 ;
+  MIGPAIR.LIST  = NULL ;
   for ( itype=0; itype < MAXTYPE; itype++ ) {
     TABLE[itype].N_OVERFLOW = 0. ;
     TABLE[itype].N_FILLED   = 0. ;
@@ -661,12 +693,16 @@ void init_unfold(void) {
 	  MIGRATION_TABLE_SUMZ[i1][i2].NMIGBIN      = 0 ;
 	  MIGRATION_TABLE_SUMZ[i1][i2].CONTAIN_FRAC = 0.0 ;
 	  MIGRATION_TABLE_SUMZ[i1][i2].NSIMFIT_NEAR_SUM = 0.0 ;
+	  MIGRATION_TABLE_SUMZ[i1][i2].INDEX_NEAR       = NULL ;
+	  MIGRATION_TABLE_SUMZ[i1][i2].PSIM_NEAR        = NULL ;
 	}
  
 	PSIM_SUM[iz][i1][i2]                     = 0.0 ;
 	MIGRATION_TABLE[iz][i1][i2].NMIGBIN      = 0 ;
 	MIGRATION_TABLE[iz][i1][i2].CONTAIN_FRAC = 0.0 ;
 	MIGRATION_TABLE[iz][i1][i2].NSIMFIT_NEAR_SUM  = 0.0 ;
+	MIGRATION_TABLE[iz][i1][i2].INDEX_NEAR        = NULL ;
+	MIGRATION_TABLE[iz][i1][i2].PSIM_NEAR         = NULL ;
 
 
 	for ( j=0; j<MAXMIGBIN; j++ ) {
@@ -990,6 +1026,8 @@ void fill_TABLE(int itype) {
 
   } // end if 'i' loop over ARRAY
 
+  if ( LMIGBIN ) { build_MIGRATION_TABLE(); }
+
 
   printf("  fill_TABLE(%s): filled %d table entries (%d overflow)\n",
 	 INPUTS.TYPENAME[itype], (int)TABLE[itype].N_FILLED, 
@@ -1037,8 +1075,8 @@ void fill_MIGRATION_TABLE(int IZACC, int IB1ACC, int IB2ACC,
   int NBZ = INPUTS.NBIN_PAR[IPAR_Z];
   int NB1 = INPUTS.NBIN_PAR[IPAR_1];
   int NB2 = INPUTS.NBIN_PAR[IPAR_2];
-  double RSQDIF, DIFZ, DIF1, DIF2, x1, x2 ;
-  int  LDMP,NMIGBIN, IFIT_USED, ifit, izfit, ib1fit, ib2fit, INDEX ;
+  double RSQDIF, DIFZ, DIF1, DIF2 ;
+  int  LDMP ;
   char fnam[] = "fill_MIGRATION_TABLE";
 
   // -------------- BEGIN --------------
@@ -1085,79 +1123,171 @@ void fill_MIGRATION_TABLE(int IZACC, int IB1ACC, int IB2ACC,
   }
 
 
-  NMIGBIN = MIGRATION_TABLE[IZACC][IB1ACC][IB2ACC].NMIGBIN;
-
-  // check if this FIT-bin is already stored;
-  IFIT_USED = -1 ;
-  for ( ifit=0; ifit < NMIGBIN; ifit++ ) {
-    izfit  = MIGRATION_TABLE[IZACC][IB1ACC][IB2ACC].IBINZ_NEAR[ifit] ;
-    ib1fit = MIGRATION_TABLE[IZACC][IB1ACC][IB2ACC].IBIN1_NEAR[ifit] ;
-    ib2fit = MIGRATION_TABLE[IZACC][IB1ACC][IB2ACC].IBIN2_NEAR[ifit] ;
-    if (  izfit == IZFIT && ib1fit == IB1FIT && ib2fit == IB2FIT ) 
-      { IFIT_USED = ifit ; }
+  // Oct 2026: store (gen,fit) pair; sparse table is built from
+  // sorted pairs in build_MIGRATION_TABLE after all events are read.
+  if ( MIGPAIR.NPAIR >= MIGPAIR.NPAIR_ALLOC ) {
+    MIGPAIR.NPAIR_ALLOC += ARRAY[ITYPE_SIMACC].N + 1000 ;
+    MIGPAIR.LIST = (MIGPAIR_DEF*)realloc(MIGPAIR.LIST, 
+				 MIGPAIR.NPAIR_ALLOC*sizeof(MIGPAIR_DEF));
   }
+  MIGPAIR.LIST[MIGPAIR.NPAIR].INDEX_ACC = INDEXMAP[IZACC][IB1ACC][IB2ACC];
+  MIGPAIR.LIST[MIGPAIR.NPAIR].INDEX_FIT = INDEXMAP[IZFIT][IB1FIT][IB2FIT];
+  MIGPAIR.LIST[MIGPAIR.NPAIR].WGT       = WGTGEN ;
+  MIGPAIR.NPAIR++ ;
+
+ SKIPPY:
+  return ;
+
+} // end of fill_MIGRATION_TABLE
 
 
-  if ( IFIT_USED < 0 ) {
-    IFIT_USED = NMIGBIN ;
-    MIGRATION_TABLE[IZACC][IB1ACC][IB2ACC].NMIGBIN = NMIGBIN+1 ;
-    MIGRATION_TABLE[IZACC][IB1ACC][IB2ACC].IBINZ_NEAR[NMIGBIN] = IZFIT ;
-    MIGRATION_TABLE[IZACC][IB1ACC][IB2ACC].IBIN1_NEAR[NMIGBIN] = IB1FIT ;
-    MIGRATION_TABLE[IZACC][IB1ACC][IB2ACC].IBIN2_NEAR[NMIGBIN] = IB2FIT ;
+// ===================================
+int compare_MIGPAIR(const void *a, const void *b) {
+  // Created Oct 2026: qsort by gen bin, then fit bin
+  const MIGPAIR_DEF *A = (const MIGPAIR_DEF*)a ;
+  const MIGPAIR_DEF *B = (const MIGPAIR_DEF*)b ;
+  if ( A->INDEX_ACC != B->INDEX_ACC ) 
+    { return ( A->INDEX_ACC < B->INDEX_ACC ) ? -1 : 1 ; }
+  if ( A->INDEX_FIT != B->INDEX_FIT ) 
+    { return ( A->INDEX_FIT < B->INDEX_FIT ) ? -1 : 1 ; }
+  return 0 ;
+} // end compare_MIGPAIR
 
-    if ( LDMP ) printf("\t NMIGBIN=%d for IZ,IB1,IunfoB2(FIT)=%d,%d,%d \n",
-		       NMIGBIN, IZFIT, IB1FIT,IB2FIT );
+
+// ===================================
+void build_MIGRATION_TABLE(void) {
+
+  // Created Oct 2026
+  // Sort the (gen,fit) pairs from fill_MIGRATION_TABLE and compact
+  // each run of identical pairs into one migration entry of the gen 
+  // bin. Replaces the per-event search over stored fit bins.
+  // Fit bins for each gen bin are stored in increasing INDEXMAP order.
+  // Then set containment fractions from the final sums.
+
+  int NBZ = INPUTS.NBIN_PAR[IPAR_Z];
+  int NB1 = INPUTS.NBIN_PAR[IPAR_1];
+  int NB2 = INPUTS.NBIN_PAR[IPAR_2];
+  int NPAIR = MIGPAIR.NPAIR ;
+  int ipair, jpair, IACC, IFIT, IZ, I1, I2, NMIGBIN, INDEX ;
+  double SUMWGT, x1, x2 ;
+  MIGRATION_TABLE_DEF *MIG ;
+  char fnam[] = "build_MIGRATION_TABLE" ;
+
+  // ------------- BEGIN ------------
+
+  if ( NPAIR > 0 ) 
+    { qsort(MIGPAIR.LIST, NPAIR, sizeof(MIGPAIR_DEF), compare_MIGPAIR); }
+
+  ipair = 0 ;
+  while ( ipair < NPAIR ) {
+    IACC   = MIGPAIR.LIST[ipair].INDEX_ACC ;
+    IFIT   = MIGPAIR.LIST[ipair].INDEX_FIT ;
+    SUMWGT = 0.0 ;
+    jpair  = ipair ;
+    while ( jpair < NPAIR && 
+	    MIGPAIR.LIST[jpair].INDEX_ACC == IACC &&
+	    MIGPAIR.LIST[jpair].INDEX_FIT == IFIT ) 
+      { SUMWGT += MIGPAIR.LIST[jpair].WGT ;  jpair++ ; }
+
+    IZ = INDEXMAP_INV[IACC].IZ ;
+    I1 = INDEXMAP_INV[IACC].I1 ;
+    I2 = INDEXMAP_INV[IACC].I2 ;
+    MIG     = &MIGRATION_TABLE[IZ][I1][I2] ;
+    NMIGBIN = MIG->NMIGBIN ;
 
     if ( NMIGBIN >= MAXMIGBIN ) {
       sprintf(c1err,"NMIGBIN=%d exceeds array bound for", NMIGBIN);
       sprintf(c2err,"IZ,I1,I2(ACC)=%d %d %d   IZ,I1,I2(FIT)=%d %d %d ",
-	      IZACC, IB1ACC, IB2ACC,  IZFIT, IB1FIT, IB2FIT );
+	      IZ, I1, I2, INDEXMAP_INV[IFIT].IZ, 
+	      INDEXMAP_INV[IFIT].I1, INDEXMAP_INV[IFIT].I2 );
       errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
     }
 
-    /*
-    printf(" xxx %s(%d,%d,%d): increment NMIGBIN = %d \n", 
-	   fnam, IZACC, IB1ACC, IB2ACC, NMIGBIN+1); fflush(stdout);
-    */
+    MIG->IBINZ_NEAR[NMIGBIN]   = INDEXMAP_INV[IFIT].IZ ;
+    MIG->IBIN1_NEAR[NMIGBIN]   = INDEXMAP_INV[IFIT].I1 ;
+    MIG->IBIN2_NEAR[NMIGBIN]   = INDEXMAP_INV[IFIT].I2 ;
+    MIG->NSIMFIT_NEAR[NMIGBIN] = SUMWGT ;
+    MIG->NSIMFIT_NEAR_SUM     += SUMWGT ;
+    MIG->NMIGBIN               = NMIGBIN + 1 ;
 
-    //    NMIGBIN++ ;
+    // sum over z-bins 
+    MIGRATION_TABLE_SUMZ[I1][I2].NSIMFIT_NEAR[NMIGBIN] += SUMWGT ;
+    MIGRATION_TABLE_SUMZ[I1][I2].NSIMFIT_NEAR_SUM      += SUMWGT ;
+
+    ipair = jpair ;
   }
 
-  if ( IFIT_USED < 0 ) {
-    sprintf(c1err,"IFIT_USED not set");
-    sprintf(c2err,"IZ,IB1,IB2 = %d,%d,%d(ACC) and  %d,%d,%d(FIT)",
-	    IZACC,IB1ACC,IB2ACC,  IZFIT,IB1FIT,IB2FIT);
-    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  free(MIGPAIR.LIST);
+  MIGPAIR.LIST = NULL ;  MIGPAIR.NPAIR = MIGPAIR.NPAIR_ALLOC = 0 ;
+
+  // containment fraction per z bin, and again integrated over z
+  for ( IZ=0; IZ < NBZ; IZ++ ) {
+    for ( I1=0; I1 < NB1; I1++ ) {
+      for ( I2=0; I2 < NB2; I2++ ) {
+	MIG = &MIGRATION_TABLE[IZ][I1][I2] ;
+	if ( MIG->NMIGBIN == 0 ) { continue ; }
+	INDEX = INDEXMAP[IZ][I1][I2] ;
+	x1 = MIG->NSIMFIT_NEAR_SUM;
+	x2 = TABLE[ITYPE_SIMACC].ENTRIES[INDEX];
+	if ( x2 > 0.0 ) { MIG->CONTAIN_FRAC = x1/x2 ; }
+
+	if ( IZ > 0 ) { continue ; }
+	MIG   = &MIGRATION_TABLE_SUMZ[I1][I2] ;
+	x1 = MIG->NSIMFIT_NEAR_SUM;
+	x2 = TABLE[ITYPE_SIMACC].ENTRIES_SUMZ[INDEX];
+	if ( x2 > 0.0 ) { MIG->CONTAIN_FRAC = x1/x2 ; }
+      }
+    }
   }
 
-  // increment number of entries for this ACC+FIT
-  MIGRATION_TABLE[IZACC][IB1ACC][IB2ACC].NSIMFIT_NEAR[IFIT_USED] += WGTGEN ;
-  MIGRATION_TABLE[IZACC][IB1ACC][IB2ACC].NSIMFIT_NEAR_SUM        += WGTGEN ;
+  printf("\t %s: %d SIMACC events -> sparse migration entries\n", 
+	 fnam, NPAIR );
+  fflush(stdout);
+
+} // end build_MIGRATION_TABLE
 
-  // sum over z-bins 
-  MIGRATION_TABLE_SUMZ[IB1ACC][IB2ACC].NSIMFIT_NEAR[IFIT_USED] += WGTGEN ;
-  MIGRATION_TABLE_SUMZ[IB1ACC][IB2ACC].NSIMFIT_NEAR_SUM        += WGTGEN ;
 
+// ===================================
+void set_MIGRATION_CACHE(void) {
 
-  // update containment fraction per z bin
-  INDEX = INDEXMAP[IZACC][IB1ACC][IB2ACC] ;
-  x1 = MIGRATION_TABLE[IZACC][IB1ACC][IB2ACC].NSIMFIT_NEAR_SUM;
-  x2 = TABLE[ITYPE_SIMACC].ENTRIES[INDEX];
-  if ( x2 > 0.0 ) 
-    { MIGRATION_TABLE[IZACC][IB1ACC][IB2ACC].CONTAIN_FRAC = x1/x2 ; }
+  // Created Oct 2026
+  // Migration entries and SIMGEN entries are fixed for all unfolding
+  // iterations, so store the flat fit-bin index and PSIM = XFIT/XGEN
+  // once for each migration entry; PSIM_ADD and UNFOLD_ADD then avoid
+  // the 3D index lookup and division in every iteration.
 
-  // ... and again integrated over z bins
-  INDEX = INDEXMAP[0][IB1ACC][IB2ACC] ;
-  x1 = MIGRATION_TABLE_SUMZ[IB1ACC][IB2ACC].NSIMFIT_NEAR_SUM;
-  x2 = TABLE[ITYPE_SIMACC].ENTRIES_SUMZ[INDEX];
-  if ( x2 > 0.0 ) 
-    { MIGRATION_TABLE_SUMZ[IB1ACC][IB2ACC].CONTAIN_FRAC = x1/x2 ; }
+  int NBZ = INPUTS.NBIN_PAR[IPAR_Z];
+  int NB1 = INPUTS.NBIN_PAR[IPAR_1];
+  int NB2 = INPUTS.NBIN_PAR[IPAR_2];
+  int IZ, I1, I2, imig, NMIGBIN, INDEX ;
+  double XGEN ;
+  MIGRATION_TABLE_DEF *MIG ;
 
+  // ------------- BEGIN ------------
 
- SKIPPY:
-  x1 = 0.0;  // dummy 
+  for ( IZ=0; IZ < NBZ; IZ++ ) {
+    for ( I1=0; I1 < NB1; I1++ ) {
+      for ( I2=0; I2 < NB2; I2++ ) {
+	MIG     = &MIGRATION_TABLE[IZ][I1][I2] ;
+	NMIGBIN = MIG->NMIGBIN ;
+	if ( NMIGBIN == 0 ) { continue ; }
+	INDEX = INDEXMAP[IZ][I1][I2] ;
+	XGEN  = TABLE[ITYPE_SIMGEN].ENTRIES[INDEX] ;
+	MIG->INDEX_NEAR = (int*)   malloc(NMIGBIN*sizeof(int));
+	MIG->PSIM_NEAR  = (double*)malloc(NMIGBIN*sizeof(double));
+	for ( imig=0; imig < NMIGBIN; imig++ ) {
+	  MIG->INDEX_NEAR[imig] = INDEXMAP[MIG->IBINZ_NEAR[imig]]
+	    [MIG->IBIN1_NEAR[imig]][MIG->IBIN2_NEAR[imig]] ;
+	  if ( XGEN > 0.0 ) 
+	    { MIG->PSIM_NEAR[imig] = MIG->NSIMFIT_NEAR[imig] / XGEN ; }
+	  else
+	    { MIG->PSIM_NEAR[imig] = 0.0 ; }
+	}
+      }
+    }
+  }
 
-} // end of fill_MIGRATION_TABLE
+} // end set_MIGRATION_CACHE
 
 
 // ======================================
@@ -1212,7 +1342,7 @@ void PSIM_ADD (int IZ, int IBIN1, int IBIN2) {
 
   int iz, ibin1, ibin2, NMIGBIN, imig;
   int i, INDEX, IFLAG_DUMP ;
-  double PSIM, XFIT, XGEN, XACC, P0 ;
+  double PSIM, XGEN, XACC, P0 ;
 
   // --------------- BEGIN ----------------
 
@@ -1231,8 +1361,7 @@ void PSIM_ADD (int IZ, int IBIN1, int IBIN2) {
 
   for ( imig=0; imig < NMIGBIN ; imig++ ) {
 
-    XFIT = MIGRATION_TABLE[IZ][IBIN1][IBIN2].NSIMFIT_NEAR[imig];
-    PSIM = XFIT / XGEN ;      
+    PSIM = MIGRATION_TABLE[IZ][IBIN1][IBIN2].PSIM_NEAR[imig]; // XFIT/XGEN
 
     // extract fitted indices
     iz      = MIGRATION_TABLE[IZ][IBIN1][IBIN2].IBINZ_NEAR[imig] ;
@@ -1285,7 +1414,7 @@ void UNFOLD_ADD (int IZ, int IBIN1, int IBIN2) {
 
   int iz, ibin1, ibin2, INDEX, index, NMIGBIN, imig, i ,IFLAG_DUMP ;
   double PSIM, P0, PSIM_WGT, EFFSIM ;
-  double XDATA, XGEN, XFIT, XTMP, XACC, PROB_MIG, PRODUCT    ;
+  double XDATA, XGEN, XTMP, XACC, PROB_MIG, PRODUCT    ;
   char fnam[] = "UNFOLD_ADD";
 
   // --------------- BEGIN ----------------
@@ -1328,14 +1457,13 @@ void UNFOLD_ADD (int IZ, int IBIN1, int IBIN2) {
     ibin1   = MIGRATION_TABLE[IZ][IBIN1][IBIN2].IBIN1_NEAR[imig] ;
     ibin2   = MIGRATION_TABLE[IZ][IBIN1][IBIN2].IBIN2_NEAR[imig] ;
 
-    index   = INDEXMAP[iz][ibin1][ibin2] ; 
+    index   = MIGRATION_TABLE[IZ][IBIN1][IBIN2].INDEX_NEAR[imig] ; 
     XDATA   = TABLE[ITYPE_DATA].ENTRIES[index] ;
     if ( XDATA <= 0.0 ) { continue ; }
 
     if ( IFLAG_DUMP ) { DMP_UNFOLD(IZ, IBIN1, IBIN2, imig); }
 
-    XFIT = MIGRATION_TABLE[IZ][IBIN1][IBIN2].NSIMFIT_NEAR[imig];
-    PSIM = XFIT / XGEN ;      
+    PSIM = MIGRATION_TABLE[IZ][IBIN1][IBIN2].PSIM_NEAR[imig]; // XFIT/XGEN
 
     if ( INPUTS.DOMIGRATION_FLAG  )
       { PSIM_WGT = PSIM_SUM[iz][ibin1][ibin2]; }
@@ -199,6 +199,32 @@
 
  Nov 7 2025: new input -outfile_prob1d to give 1D marginalized PDF and CDF
 
+ Oct 14 2026: new input -nthread <n> to split chi2 grid scan over pthreads.
+              rz-interp arrays are now local to get_chi2_fit so that
+              each thread has its own copy.
+
+ Oct 14 2026: new input -nstep_coarse <n> computes chi2 on coarse grid
+              and refines only cells within -dchi2_refine of chi2min;
+              remaining bins are interpolated.
+
+ Oct 14 2026: new input -chi2_cholesky to compute chi2 from Cholesky
+              factor of COV (or COVINV) with BLAS triangular solves,
+              and batched solves (many grid bins at once) in grid scan.
+
+ Oct 14 2026: speed_flag_chi2 += 8 (opt-in) -> for each cosmology, tabulate
+              1/E(z) integral in DZBIN_HzINV_TABLE bins (sntools_cosmology)
+              and evaluate r(z) from table instead of z-integral per SN.
+
+ Oct 15 2026: sync_HD_LIST uses batch CID hash utils (match_cid_hash_load,
+              match_cid_hash_list).
+
+ Oct 15 2026: new input -hd_list -> 1st arg is a text file listing HD
+              files (e.g., BBC realizations) with the same redshift bins.
+              mucov is read and factorized once; if only the diagonal
+              (stat) errors change, the diagonal is updated and COV is
+              re-factorized without re-reading cov file. 
+              See wfit_batch_driver.
+
 *****************************************************************************/
 
 #include <stdlib.h>
@@ -206,6 +232,11 @@
 #include <math.h>
 #include <time.h>
 #include <string.h>
+#include <pthread.h>
+
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_cblas.h>
+#include <gsl/gsl_errno.h>
 
 #include "fitsio.h"
 #include "longnam.h"
@@ -224,6 +255,16 @@
 #define SPEED_MASK_INTERP       1  // interplate r(z) and mu_cos(z)
 #define SPEED_MASK_SKIP_OFFDIAG 2  // skip off-diag calc if chi2(diag)>threshold
 #define SPEED_MASK_STOP_DIAG    4  // stop diag calc if chi2(diag)>threshold (4.08.2025)
+#define SPEED_MASK_ZTABLE       8  // tabulate 1/E(z) integral per cosmology (Oct 2026)
+#define MXTHREAD_WFIT 64  // max -nthread for chi2 grid scan (Oct 2026)
+#define DEFAULT_dchi2_refine  25.0 // for -nstep_coarse (Oct 2026)
+#define MXBATCH_CHOL          64   // max grid bins per batched Cholesky solve
+
+// flattened grid bin index <-> (i=w0, kk=wa, j=omm) indices
+#define GRID_BIN(i,kk,j)  ( ((i)*INPUTS.wa_steps + (kk))*INPUTS.omm_steps + (j) )
+#define GRID_IND(ibin,i,kk,j) { (j) = (ibin) % INPUTS.omm_steps ; \
+    (kk) = ((ibin)/INPUTS.omm_steps) % INPUTS.wa_steps ;	      \
+    (i)  = (ibin) / (INPUTS.omm_steps*INPUTS.wa_steps) ; }
 #define SPEED_FLAG_CHI2_DEFAULT  SPEED_MASK_INTERP + SPEED_MASK_SKIP_OFFDIAG // +SPEED_MASK_STOP_DIAG ??
 #define SPEED_NSIG_MULTIPLIER_DEFAULT 15
 #define PROBSUM_1SIGMA  0.683
@@ -290,7 +331,13 @@ struct INPUTS {
   bool  USE_SPEED_INTERP;       // internal: intero r(z) and mu(z)
   bool  USE_SPEED_SKIP_OFFDIAG; // internal: skip off-diag calc if chi2(diag)>threshold
   bool  USE_SPEED_STOP_DIAG;    // internal: stop diag calc when chi2>threshold
+  bool  USE_SPEED_ZTABLE;       // internal: r(z) from HzINV_TABLE
   double speed_nsig_multiplier;  // NSIG multiplier to skip off-diag calc
+  int   nthread;  // number of threads for chi2 grid scan (default=1)
+  int    nstep_coarse; // >1 -> coarse grid + adaptive refine (Oct 2026)
+  double dchi2_refine; // refine coarse cells within this dchi2 of min
+  bool   use_chi2_cholesky; // chi2 from Cholesky factor (Oct 2026)
+  bool   use_hd_list;  // 1st arg is list of HD files (Oct 2026)
 
   int fitnumber;   // default=1; legacy for iterative fit after sigint calc
 
@@ -361,10 +408,17 @@ struct  {
   // define variables interpolate rz for large samples
   int     n_exec_interp; // number of interpolate calls for r(z) and mu_cos(z)
   int     n_logz_interp; // number of logz bins for interpolation
+  double  zmax_ztable;   // zmax for HzINV_TABLE (SPEED_MASK_ZTABLE)
   double *logz_list_interp, *z_list_interp, logz_bin_interp; 
-  double *rz_list_interp, *mucos_list_interp;
   double  rz_dif_max ;
 
+  // for threaded chi2 grid scan (Oct 2026)
+  int     nbin_list_grid ;  // number of grid bins in ibin_list_grid
+  int    *ibin_list_grid ;  // list of bins to process
+  int     ilist_grid_next ; // next ibin_list_grid index to process
+  int     nbin_grid_done ;  // number of grid bins done (for stdout update)
+  time_t  t0_grid ;        // start time for grid scan
+
   // - - - -
   double *omm_val,  *w0_val,  *wa_val;
   double *omm_prob, *w0_prob, *wa_prob;
@@ -394,6 +448,12 @@ struct  {
 
   COVMAT_DEF MUCOV[2]; // up to two cov matrices
   COVMAT_DEF MUCOV_FINAL ;
+
+  // Cholesky factor for -chi2_cholesky option (Oct 2026)
+  bool    CHOL_ISINV ;  // true -> factor is for COVINV, else for COV
+  double *MUCOV_CHOL ;  // lower-triangle L, COV (or COVINV) = L*L^T
+  double *CHOL_ONE ;    // L^-1 * [1,1,...]  (or L^T*[1,...] for COVINV)
+  double  CHOL_CSUM ;   // CHOL_ONE . CHOL_ONE = 1^T COVINV 1
   
   double w0_ran,   wa_ran,   omm_ran;
   double w0_final, wa_final, omm_final, chi2_final ;
@@ -436,6 +496,18 @@ typedef struct {
 HD_DEF HD_LIST[2];
 HD_DEF HD_FINAL ;  // differs for HDIBC
 
+// Oct 2026: batch of HD files with -hd_list option
+struct {
+  int    NHD ;
+  char   **HD_file_list ;
+  char   outFile_orig[4][MXCHAR_FILENAME]; // user output names
+  int    NSN, NSN_ORIG;      // reference from 1st HD
+  bool   *pass_cut ;         // reference cuts (NSN_ORIG)
+  double *z ;                // reference redshifts (NSN)
+  double *mu_sqsig_cov ;     // stat errors currently included in MUCOV
+  int    NREFAC ;            // number of HDs that needed COV re-factor
+} HD_BATCH ;
+
 Cosparam COSPAR_SIM ; // cosmo params from simulated data 
 Cosparam COSPAR_LCDM; // w0,wa = -1,0
 
@@ -528,14 +600,36 @@ void sync_HD_LIST(HD_DEF *HD_REF, HD_DEF *HD, COVMAT_DEF *MUCOV);
 void sync_HD_redshifts(HD_DEF *HD0, HD_DEF *HD1) ;
 void compute_MUCOV_FINAL();
 void invert_mucovar(COVMAT_DEF *COV, double sqmurms_add);
+void cholesky_mucovar(COVMAT_DEF *COV);
+void chol_transform_mucov(int NB, double *D);
+void get_chi2sums_cholesky(int NB, double *D, double *chi_hat, double *Bsum);
 void check_invertMatrix(int N, double *COV, double *COVINV );
 void set_stepsizes(void);
 void set_Ndof(void);
 void init_rz_interp(HD_DEF *HD);
-void exec_rz_interp(int k, Cosparam *cospar, double *rz, double *dmu);
+void exec_rz_interp(int k, Cosparam *cospar,
+		    double *rz_list_interp, double *mucos_list_interp,
+		    double *rz, double *dmu);
 void check_refit(void);
+void init_workspace_fit(void);
+void wfit_exec_fit(void);
+void wfit_batch_driver(void);
+void read_hd_list(char *listFile);
+void set_outFiles_batch(int ihd);
+void store_ref_HD_batch(HD_DEF *HD);
+void check_HD_batch(int ihd, HD_DEF *HD);
+bool update_mucov_diag_batch(HD_DEF *HD);
 
 void wfit_minimize(void);
+void wfit_scan_grid(int NBIN, int *IBIN_LIST);
+void *wfit_scan_grid_thread(void *arg);
+void wfit_scan_grid_bin(int ibin, double *z_list, double *mu_list, 
+			double *f_interp_list);
+void wfit_scan_grid_batch(int NBIN, int *IBIN_LIST, double *z_list,
+			  double *mu_list, double *f_interp_list);
+void update_stdout_grid(void);
+void wfit_scan_grid_adaptive(void);
+int  set_grid_nodes_coarse(int nstep, int stride, int *nodes);
 void prep_speed_skip_offdiag(double extchi_tmp);
 void wfit_normalize(void);
 void wfit_marginalize(void);
@@ -549,6 +643,13 @@ void wfit_Covariance(void);
 void get_chi2_fit(double w0, double wa, double OM, double sqmurms_add,
 		  double *z_list, double *mu_list, double *f_interp_list,
 		  double *muresid_avg, double *chi2sn, double *chi2tot );
+void fill_rz_interp(Cosparam *cpar, HzINV_TABLE_DEF *TABLE,
+		    double *rz_list_interp, double *mucos_list_interp);
+void   fill_codist_table(Cosparam *cpar, HzINV_TABLE_DEF *TABLE);
+double codist_table(double z, Cosparam *cpar, HzINV_TABLE_DEF *TABLE);
+double get_mu_obs_HD(int k, double mu_cos, double *f_interp, int LDMP);
+void fill_dmu_list(Cosparam *cpar, double *z_obs_list, double *mu_obs_list,
+		   double *f_interp_list, double *dmu_list);
 void getname(char *basename, char *tempname, int nrun);
 
 double get_DMU_chi2wOM(double z, double rz, double mu); 
@@ -653,7 +754,9 @@ int main(int argc,char *argv[]){
   printf("# =============================================== \n");
   printf(" SNANA_DIR = %s \n", getenv("SNANA_DIR") );
 
-  while (INPUTS.fitnumber <= 1) {
+  if ( INPUTS.use_hd_list ) { wfit_batch_driver(); }
+
+  while (INPUTS.fitnumber <= 1 && !INPUTS.use_hd_list ) {
 
     /************************/
     /*** Read in the data ***/
@@ -689,42 +792,8 @@ int main(int argc,char *argv[]){
       invert_mucovar(&WORKSPACE.MUCOV_FINAL, INPUTS.sqsnrms);
     }
     
-    // compute grid step size per floated variable
-    set_stepsizes();
-
-    // compute number of degrees of freedom
-    set_Ndof(); 
-
-    printf("\n# ======================================= \n");
-    print_cputime(t_start, STRING_CPUTIME_INIT, UNIT_TIME_SECOND, 0);
-    printf(" cospar blind flag = %d \n", INPUTS.blind); fflush(stdout);
-    t_end_init = time(NULL);
- 
-    // minimize chi2 on a grid
-    wfit_minimize(); 
-    
-    // Normalize probability distributions 
-    wfit_normalize();
-
-    wfit_marginalize();  // marginalize
-
-    // get uncertainties
-    wfit_uncertainty();
-      
-    // determine "final" quantities, including sigma_mu^int
-    wfit_final();
-
-    // Compute covriance with fitted parameters
-    wfit_Covariance();
-    
-    // estimate FoM
-    wfit_FoM();
-
-    
-    t_end_fit = time(NULL);
-
-    // call driver routine for output(s)
-    WRITE_OUTPUT_DRIVER();
+    // fit and write output
+    wfit_exec_fit();
 
     // --------------------------------------------------
     // check option to repeat fit with updated snrms = sigmu_int
@@ -765,6 +834,10 @@ void init_stuff(void) {
 
   INPUTS.speed_flag_chi2       = SPEED_FLAG_CHI2_DEFAULT ;
   INPUTS.speed_nsig_multiplier = SPEED_NSIG_MULTIPLIER_DEFAULT;
+  INPUTS.nthread               = 1 ;
+  INPUTS.nstep_coarse          = 0 ;
+  INPUTS.dchi2_refine          = DEFAULT_dchi2_refine ;
+  INPUTS.use_chi2_cholesky     = false ;
 
   INPUTS.OMEGA_MATTER_SIM = OMEGA_MATTER_DEFAULT ;
   INPUTS.w0_SIM           = w0_DEFAULT ;
@@ -830,12 +903,31 @@ void init_stuff(void) {
   sprintf(varname_wa,  "wa" );
   sprintf(varname_omm, "OM" );
 
+  INPUTS.use_hd_list = false ;
+  HD_BATCH.NHD = 0 ;
+
   // - - - - -
   // WORKSPACE
 
   WORKSPACE.MUCOV[0].NDIM = 0;
   WORKSPACE.MUCOV[1].NDIM = 0;
 
+  init_workspace_fit();
+
+  return ;
+
+} // end init_stuff
+
+
+// ================================
+void init_workspace_fit(void) {
+
+  // Created Oct 2026 [moved from init_stuff]
+  // init WORKSPACE quantities that are accumulated in each fit;
+  // called once per HD in batch mode (-hd_list).
+
+  // ------------ BEGIN -----------
+
   WORKSPACE.snchi_min  = 1.0e20 ;
   WORKSPACE.extchi_min = 1.0e20 ;
 
@@ -850,10 +942,9 @@ void init_stuff(void) {
   WORKSPACE.chi2atmin   =  0.0 ;
   WORKSPACE.NWARN = 0 ;
 
-
   return ;
 
-} // end init_stuff
+} // end init_workspace_fit
 
 
 // ==================================
@@ -908,8 +999,14 @@ void print_wfit_help(void) {
     "   -ndump_mucov\t dump this many rows/columns of MUCOV and MUCOVINV",
     "   -varname_muerr\t column name with distance errors (default=MUERR)",
     "   -refit\tfit once for sigint then refit with snrms=sigint.", 
-    "   -speed_flag_chi2   +=1->interp trick, +=2->skip offdiag, +=4->stop diag",
+    "   -speed_flag_chi2   +=1->interp trick, +=2->skip offdiag, +=4->stop diag, +=8->z-table",
     "   -speed_nsig_multiplier  Skip off-diag chi2 calc if nsig(diag) > nsig_mult (default=15)",
+    "   -nthread\t number of threads for chi2 grid scan (default=1)",
+    "   -nstep_coarse\t coarse grid spacing (bins); refine only near chi2min",
+    "   -dchi2_refine\t refine coarse cells with dchi2 < this (default=25)",
+    "   -chi2_cholesky\t chi2 via Cholesky factor of COV instead of COVINV sums",
+    "   -hd_list\t 1st arg is text file with list of HD files (same z bins)",
+    "           \t fit each HD in one job; mucov is read/factorized once",
     "   -debug_flag 91\t compare calc mu(wfit) vs. mu(sim)",
     "   -muerr_ideal  replace all mu with mu_true + Gauss(0,muerr);",
     "                 e.g.,  muerr_ideal 0.1,0.01,0.05 -> "
@@ -1219,6 +1316,21 @@ void parse_args(int argc, char **argv) {
       else if (strcasecmp(argv[iarg]+1,"speed_nsig_multiplier")==0) // 9/19/2025
 	{ INPUTS.speed_nsig_multiplier = atof(argv[++iarg]); }      
 
+      else if (strcasecmp(argv[iarg]+1,"nthread")==0) // Oct 2026
+	{ INPUTS.nthread = atoi(argv[++iarg]); }      
+
+      else if (strcasecmp(argv[iarg]+1,"nstep_coarse")==0) // Oct 2026
+	{ INPUTS.nstep_coarse = atoi(argv[++iarg]); }      
+
+      else if (strcasecmp(argv[iarg]+1,"dchi2_refine")==0) // Oct 2026
+	{ INPUTS.dchi2_refine = atof(argv[++iarg]); }      
+
+      else if (strcasecmp(argv[iarg]+1,"chi2_cholesky")==0) // Oct 2026
+	{ INPUTS.use_chi2_cholesky = true ; }      
+
+      else if (strcasecmp(argv[iarg]+1,"hd_list")==0) // Oct 2026
+	{ INPUTS.use_hd_list = true ; }      
+
       else {
 	printf("Bad arg: %s\n", argv[iarg]);
 	exit(EXIT_ERRCODE_wfit);
@@ -1232,6 +1344,7 @@ void parse_args(int argc, char **argv) {
 	   
   INPUTS.USE_SPEED_SKIP_OFFDIAG = (INPUTS.speed_flag_chi2 & SPEED_MASK_SKIP_OFFDIAG) > 0;
   INPUTS.USE_SPEED_STOP_DIAG    = (INPUTS.speed_flag_chi2 & SPEED_MASK_STOP_DIAG   ) > 0;
+  INPUTS.USE_SPEED_ZTABLE       = (INPUTS.speed_flag_chi2 & SPEED_MASK_ZTABLE      ) > 0;
 
   printf(" ****************************************\n");
   if ( INPUTS.dofit_w0wa )  { 
@@ -2205,31 +2318,30 @@ void sync_HD_LIST(HD_DEF *HD_REF,
   // Re-define HD and MUCOV to include only those elements in HD_REF.
   //
 
+  // Oct 15 2026: use batch hash utils to load and match CID lists.
+
   int NSN_REF = HD_REF->NSN ;
   int MEMB    = sizeof(bool) * (NSN_REF + 100);
   bool  *SYNC_LIST = (bool*) malloc(MEMB);
-  int ilist0 = 0, ilist1=1, NREMOVE=0 ;
-  int iref, i,  idum;
-  char *cid;
+  int   *IREF_LIST = (int *) malloc(sizeof(int) * (HD->NSN + 1));
+  int NREMOVE=0 ;
+  int i ;
   char fnam[] = "sync_HD_LIST" ;
   
   // ------------ BEGIN -----------
 
   match_cid_hash("", -1,0); // reset hash table
 
-  for(iref=0; iref < NSN_REF; iref++ ) {
-    cid = HD_REF->cid[iref] ;
-    idum = match_cid_hash(cid,ilist0,iref);  // load hash table
-  }
+  match_cid_hash_load(NSN_REF, HD_REF->cid, 0);       // load hash table
+  match_cid_hash_list(HD->NSN, HD->cid, IREF_LIST);   // match HD list
   
   // loop over  HD and set SYNC_LIST
   for(i=0; i < HD->NSN; i++ ) {
-    cid  = HD->cid[i] ;
-    iref = match_cid_hash(cid,ilist1,i);
     SYNC_LIST[i] = false; 
-    if ( iref >= 0 )  { SYNC_LIST[i] = true; }
-    else              { NREMOVE++ ; }
+    if ( IREF_LIST[i] >= 0 )  { SYNC_LIST[i] = true; }
+    else                      { NREMOVE++ ; }
   }
+  free(IREF_LIST);
 
   printf("\t %s: remove %d SN from HD and MUCOV \n", fnam, NREMOVE);
   fflush(stdout);
@@ -3012,6 +3124,7 @@ void init_rz_interp(HD_DEF *HD) {
   // ----------- BEGIN ------------
 
   WORKSPACE.n_exec_interp = 0;
+  WORKSPACE.zmax_ztable   = zmax + 0.1 ; // Oct 2026: margin for z-shifts
 
   if ( NSN > 500 ) 
     { INPUTS.USE_SPEED_INTERP  = (INPUTS.speed_flag_chi2 & SPEED_MASK_INTERP )>0; }
@@ -3040,8 +3153,6 @@ void init_rz_interp(HD_DEF *HD) {
   WORKSPACE.logz_bin_interp   = logz_bin ;
   WORKSPACE.logz_list_interp  = (double*)malloc(MEMD);
   WORKSPACE.z_list_interp     = (double*)malloc(MEMD);
-  WORKSPACE.rz_list_interp    = (double*)malloc(MEMD);
-  WORKSPACE.mucos_list_interp = (double*)malloc(MEMD);
   
   printf("\n# ========================================================= \n");
   printf(" load %d logz bins (%.5f <= z <= %.5f) to interpolate rz(z)\n", 
@@ -3064,11 +3175,17 @@ void init_rz_interp(HD_DEF *HD) {
 
 } // end init_rz_interp
 
-void exec_rz_interp(int k, Cosparam *cparloc, double *rz, double *mucos) {
+void exec_rz_interp(int k, Cosparam *cparloc, 
+		    double *rz_list_interp, double *mucos_list_interp,
+		    double *rz, double *mucos) {
 
   // Created Apr 22 2022
   // return interpolated rz and dmu for SN index k
   // cparloc is used only as a diagnostic for first few chi2 loops.
+  //
+  // Oct 14 2026: pass rz_list_interp and mucos_list_interp as args
+  //   (filled by caller) instead of global WORKSPACE arrays.
+  //   Skip diagnostic when called from threaded grid scan.
 
   int    n_logz   = WORKSPACE.n_logz_interp;
   double logz_min = WORKSPACE.logz_list_interp[0];
@@ -3097,27 +3214,28 @@ void exec_rz_interp(int k, Cosparam *cparloc, double *rz, double *mucos) {
   if ( iz < n_logz-1 ) {
     frac = (logz - WORKSPACE.logz_list_interp[iz])/logz_bin;
 
-    rz0    = WORKSPACE.rz_list_interp[iz];
-    rz1    = WORKSPACE.rz_list_interp[iz+1];
+    rz0    = rz_list_interp[iz];
+    rz1    = rz_list_interp[iz+1];
     rz_loc = rz0 + frac*(rz1-rz0); 
 
-    mucos0    = WORKSPACE.mucos_list_interp[iz];
-    mucos1    = WORKSPACE.mucos_list_interp[iz+1];
+    mucos0    = mucos_list_interp[iz];
+    mucos1    = mucos_list_interp[iz+1];
     mucos_loc = mucos0 + frac*(mucos1-mucos0); 
   }
   else {
-    rz_loc    = WORKSPACE.rz_list_interp[iz];    // last z-bin
-    mucos_loc = WORKSPACE.mucos_list_interp[iz]; // last z-bin
+    rz_loc    = rz_list_interp[iz];    // last z-bin
+    mucos_loc = mucos_list_interp[iz]; // last z-bin
   }
   
   // load output function args
   *rz    = rz_loc;
   *mucos = mucos_loc;
 
-  if ( k == HD0->NSN-1 ) { WORKSPACE.n_exec_interp++ ; }
+  if ( k == HD0->NSN-1 && INPUTS.nthread == 1 ) 
+    { WORKSPACE.n_exec_interp++ ; }
 
   // print diagnostic for first few events.
-  int LDMP = (WORKSPACE.n_exec_interp < 5) ;
+  int LDMP = (WORKSPACE.n_exec_interp < 5 && INPUTS.nthread == 1 ) ;
   if ( LDMP ) {
     if ( k==0 ) { WORKSPACE.rz_dif_max = 0.0 ; }    
     rz_exact   = codist(HD0->z[k], cparloc);
@@ -3162,6 +3280,338 @@ void check_refit(void) {
 
 } // end check_refit
 
+// ==================================
+void wfit_exec_fit(void) {
+
+  // Created Oct 2026 [moved from main]
+  // Fit cosmology parameters for HD_LIST and MUCOV already prepared,
+  // and write outputs.
+
+  // ----------- BEGIN ------------
+
+  // compute grid step size per floated variable
+  set_stepsizes();
+
+  // compute number of degrees of freedom
+  set_Ndof(); 
+
+  printf("\n# ======================================= \n");
+  print_cputime(t_start, STRING_CPUTIME_INIT, UNIT_TIME_SECOND, 0);
+  printf(" cospar blind flag = %d \n", INPUTS.blind); fflush(stdout);
+  t_end_init = time(NULL);
+ 
+  // minimize chi2 on a grid
+  wfit_minimize(); 
+    
+  // Normalize probability distributions 
+  wfit_normalize();
+
+  wfit_marginalize();  // marginalize
+
+  // get uncertainties
+  wfit_uncertainty();
+      
+  // determine "final" quantities, including sigma_mu^int
+  wfit_final();
+
+  // Compute covriance with fitted parameters
+  wfit_Covariance();
+    
+  // estimate FoM
+  wfit_FoM();
+    
+  t_end_fit = time(NULL);
+
+  // call driver routine for output(s)
+  WRITE_OUTPUT_DRIVER();
+
+  return ;
+
+} // end wfit_exec_fit
+
+
+// ==================================
+void wfit_batch_driver(void) {
+
+  // Created Oct 2026
+  // Fit each HD file listed in HD_infile_list[0] (-hd_list option).
+  // All HDs must have the same redshift bins (e.g., BBC realizations)
+  // so that the same mucov applies. The mucov file is read once; 
+  // for mucovsys, stat errors from each HD are swapped into the COV 
+  // diagonal and COV is re-factorized only if they change.
+  // Per-HD cost is then the chi2 grid scan (which can use -nthread).
+
+  int  ihd, f, NHD ;
+  bool REFAC ;
+  char fnam[] = "wfit_batch_driver" ;
+
+  // ----------- BEGIN ------------
+
+  if ( INPUTS.USE_HDIBC || INPUTS.NMUCOV > 1 ) {
+    sprintf(c1err,"-hd_list does not work with HDIBC (2 HDs or 2 COVs)");
+    sprintf(c2err,"Run HDIBC fits separately.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+  if ( INPUTS.fitnumber != 1 ) {
+    sprintf(c1err,"-hd_list does not work with -refit");
+    sprintf(c2err,"Remove one of these options.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  read_hd_list(INPUTS.HD_infile_list[0]);
+  NHD = HD_BATCH.NHD ;
+
+  sprintf(HD_BATCH.outFile_orig[0], "%s", INPUTS.outFile_cospar);
+  sprintf(HD_BATCH.outFile_orig[1], "%s", INPUTS.outFile_resid);
+  sprintf(HD_BATCH.outFile_orig[2], "%s", INPUTS.outFile_chi2grid);
+  sprintf(HD_BATCH.outFile_orig[3], "%s", INPUTS.outFile_prob1d);
+  HD_BATCH.NREFAC = 0 ;
+
+  for(ihd=0; ihd < NHD; ihd++ ) {
+
+    printf("\n# ############################################### \n");
+    printf(" %s: fit HD %d of %d : %s\n", 
+	   fnam, ihd+1, NHD, HD_BATCH.HD_file_list[ihd] );
+    printf("# ############################################### \n");
+    fflush(stdout);
+
+    sprintf(INPUTS.HD_infile_list[0], "%s", HD_BATCH.HD_file_list[ihd]);
+    set_outFiles_batch(ihd);
+    init_workspace_fit();
+
+    if ( ihd == 0 ) {
+      read_HD(0, INPUTS.HD_infile_list[0], &HD_LIST[0]); 
+      init_rz_interp(&HD_LIST[0]);
+      set_priors();
+      for(f=0; f < INPUTS.NMUCOV; f++ ) 
+	{ read_mucov(INPUTS.mucov_file[f], f, &WORKSPACE.MUCOV[f] ); }
+      store_ref_HD_batch(&HD_LIST[0]);
+      REFAC = ( INPUTS.use_mucov > 0 );
+    }
+    else {
+      malloc_HDarrays(-1, HD_LIST[0].NSN_ORIG, &HD_LIST[0]);
+      free(temp0_list); free(temp1_list); free(temp2_list);
+      read_HD(0, INPUTS.HD_infile_list[0], &HD_LIST[0]); 
+      check_HD_batch(ihd, &HD_LIST[0]);
+      REFAC = update_mucov_diag_batch(&HD_LIST[0]);
+      if ( REFAC ) 
+	{ HD_BATCH.NREFAC++ ;  malloc_COVMAT(-1, &WORKSPACE.MUCOV_FINAL); }
+      else
+	{ printf("\t Re-use factorized mucov (same stat errors)\n"); }
+    }
+
+    if ( REFAC ) {
+      compute_MUCOV_FINAL();
+      invert_mucovar(&WORKSPACE.MUCOV_FINAL, INPUTS.sqsnrms);
+    }
+
+    wfit_exec_fit();
+
+  } // end ihd
+
+  printf("\n %s: finished %d HD fits; %d needed mucov re-factorization.\n",
+	 fnam, NHD, HD_BATCH.NREFAC );
+  fflush(stdout);
+
+  return ;
+
+} // end wfit_batch_driver
+
+
+// ==================================
+void read_hd_list(char *listFile) {
+
+  // Created Oct 2026
+  // Read list of HD files (one per line; blank and # lines ignored)
+  // into HD_BATCH.HD_file_list.
+
+  FILE *fp;
+  int  MXHD = 100, NHD = 0 ;
+  char LINE[MXCHAR_FILENAME+10], HD_file[MXCHAR_FILENAME];
+  char fnam[] = "read_hd_list" ;
+
+  // ----------- BEGIN ------------
+
+  fp = fopen(listFile,"rt");
+  if ( !fp ) {
+    sprintf(c1err,"Could not open HD list file:");
+    sprintf(c2err,"%s", listFile);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  HD_BATCH.HD_file_list = (char**) malloc(MXHD * sizeof(char*));
+
+  while ( fgets(LINE, MXCHAR_FILENAME, fp) != NULL ) {
+    HD_file[0] = 0;
+    sscanf(LINE, "%s", HD_file);
+    if ( strlen(HD_file) == 0 || HD_file[0] == '#' ) { continue; }
+
+    if ( NHD == MXHD ) {
+      MXHD *= 2;
+      HD_BATCH.HD_file_list = 
+	(char**) realloc(HD_BATCH.HD_file_list, MXHD * sizeof(char*));
+    }
+    HD_BATCH.HD_file_list[NHD] = (char*) malloc(MXCHAR_FILENAME);
+    sprintf(HD_BATCH.HD_file_list[NHD], "%s", HD_file);
+    NHD++ ;
+  }
+  fclose(fp);
+
+  if ( NHD == 0 ) {
+    sprintf(c1err,"Found no HD files in list file");
+    sprintf(c2err,"%s", listFile);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  HD_BATCH.NHD = NHD;
+  printf("   Read %d HD files from %s\n", NHD, listFile);
+  fflush(stdout);
+
+  return ;
+
+} // end read_hd_list
+
+
+// ==================================
+void set_outFiles_batch(int ihd) {
+
+  // Created Oct 2026
+  // Set output file names for ihd-th HD in batch mode.
+  // Default cospar name is [HD].cospar (same as one-HD mode);
+  // user-specified output names get suffix _[ihd] inserted before 
+  // the last dot, e.g., wfit.cospar -> wfit_0003.cospar.
+
+  char *outFile_list[4] = 
+    { INPUTS.outFile_cospar, INPUTS.outFile_resid,
+      INPUTS.outFile_chi2grid, INPUTS.outFile_prob1d } ;
+  char *orig, *dot, base[MXCHAR_FILENAME] ;
+  int  i;
+
+  // ----------- BEGIN ------------
+
+  for(i=0; i < 4; i++ ) {
+    orig = HD_BATCH.outFile_orig[i] ;
+    if ( strlen(orig) == 0 || IGNOREFILE(orig) ) 
+      { sprintf(outFile_list[i], "%s", orig); continue; }
+
+    sprintf(base, "%s", orig);
+    dot = strrchr(base,'.');
+    if ( dot != NULL && strchr(dot,'/') == NULL ) {
+      *dot = 0 ;
+      sprintf(outFile_list[i], "%s_%04d.%s", base, ihd, dot+1);
+    }
+    else
+      { sprintf(outFile_list[i], "%s_%04d", base, ihd); }
+  }
+
+  return ;
+
+} // end set_outFiles_batch
+
+
+// ==================================
+void store_ref_HD_batch(HD_DEF *HD) {
+
+  // Created Oct 2026
+  // Store cuts, redshifts and stat errors of 1st HD in batch;
+  // stat errors are those added to MUCOV diagonal in read_mucov.
+
+  int NSN = HD->NSN, NSN_ORIG = HD->NSN_ORIG, i;
+
+  // ----------- BEGIN ------------
+
+  HD_BATCH.NSN      = NSN ;
+  HD_BATCH.NSN_ORIG = NSN_ORIG ;
+  HD_BATCH.pass_cut     = (bool  *) malloc(NSN_ORIG * sizeof(bool)  );
+  HD_BATCH.z            = (double*) malloc(NSN      * sizeof(double));
+  HD_BATCH.mu_sqsig_cov = (double*) malloc(NSN      * sizeof(double));
+
+  for(i=0; i < NSN_ORIG; i++ ) { HD_BATCH.pass_cut[i] = HD->pass_cut[i]; }
+  for(i=0; i < NSN; i++ ) {
+    HD_BATCH.z[i]            = HD->z[i] ;
+    HD_BATCH.mu_sqsig_cov[i] = HD->mu_sqsig[i] ;
+  }
+
+  return ;
+
+} // end store_ref_HD_batch
+
+
+// ==================================
+void check_HD_batch(int ihd, HD_DEF *HD) {
+
+  // Created Oct 2026
+  // Abort if HD does not have same rows/cuts/redshifts as 1st HD
+  // in batch, since mucov is only read once.
+
+  int  NSN = HD->NSN, i ;
+  char fnam[] = "check_HD_batch" ;
+
+  // ----------- BEGIN ------------
+
+  if ( HD->NSN_ORIG != HD_BATCH.NSN_ORIG || NSN != HD_BATCH.NSN ) {
+    sprintf(c1err,"NSN(orig,cut) = %d,%d for HD %d, but %d,%d for 1st HD",
+	    HD->NSN_ORIG, NSN, ihd, HD_BATCH.NSN_ORIG, HD_BATCH.NSN );
+    sprintf(c2err,"-hd_list requires the same z bins in every HD.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  for(i=0; i < HD->NSN_ORIG; i++ ) {
+    if ( HD->pass_cut[i] != HD_BATCH.pass_cut[i] ) {
+      sprintf(c1err,"pass_cut differs for row %d in HD %d", i, ihd);
+      sprintf(c2err,"-hd_list requires the same z bins in every HD.");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+  }
+
+  for(i=0; i < NSN; i++ ) {
+    if ( fabs(HD->z[i] - HD_BATCH.z[i]) > 1.0E-6 ) {
+      sprintf(c1err,"z=%f for CID=%s in HD %d, but z=%f for 1st HD",
+	      HD->z[i], HD->cid[i], ihd, HD_BATCH.z[i]);
+      sprintf(c2err,"-hd_list requires the same z bins in every HD.");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+  }
+
+  return ;
+
+} // end check_HD_batch
+
+
+// ==================================
+bool update_mucov_diag_batch(HD_DEF *HD) {
+
+  // Created Oct 2026
+  // For mucovsys, read_mucov adds HD stat errors (mu_sqsig) to the
+  // COV diagonal. Swap in stat errors from this HD and return true 
+  // if any changed, in which case COV must be re-factorized.
+  // For mucovtot_inv (stat already included) or no cov, return false.
+
+  COVMAT_DEF *MUCOV = &WORKSPACE.MUCOV[0];
+  int    NSN = HD->NSN, i, kk, NDIF = 0 ;
+  double dif ;
+
+  // ----------- BEGIN ------------
+
+  if ( INPUTS.use_mucov != FLAG_MUCOVSYS ) { return false; }
+
+  for(i=0; i < NSN; i++ ) {
+    dif = HD->mu_sqsig[i] - HD_BATCH.mu_sqsig_cov[i] ;
+    if ( dif == 0.0 ) { continue; }
+    kk = i*NSN + i;
+    MUCOV->ARRAY1D[kk] += dif ;
+    HD_BATCH.mu_sqsig_cov[i] = HD->mu_sqsig[i] ;
+    NDIF++ ;
+  }
+
+  if ( NDIF > 0 ) 
+    { printf("\t Update %d stat errors on mucov diagonal.\n", NDIF); }
+
+  return ( NDIF > 0 );
+
+} // end update_mucov_diag_batch
+
+
 // ==================================
 void wfit_minimize(void) {
 
@@ -3172,6 +3622,10 @@ void wfit_minimize(void) {
   // Apr 8 2025: 
   //  + for SPEED flag, replace cpar_fixed with COSPAR_SIM
   //  + check for new STOP_DIAG speed trick
+  //
+  // Oct 14 2026: move chi2 grid loop into wfit_scan_grid, with
+  //              option to distribute bins over nthread pthreads,
+  //              and option for adaptive coarse-to-fine grid.
 
   int Ndof                 = WORKSPACE.Ndof;
   double sig_chi2min_naive = WORKSPACE.sig_chi2min_naive ;
@@ -3181,11 +3635,9 @@ void wfit_minimize(void) {
   bool   USE_SPEED_STOP_DIAG    = INPUTS.USE_SPEED_STOP_DIAG ;
   bool   USE_SPEED_TRICK        = ( USE_SPEED_SKIP_OFFDIAG || USE_SPEED_STOP_DIAG);
 
-  Cosparam cpar;
   // xxx mark  Cosparam cpar_fixed;
   double snchi_tmp, extchi_tmp, mures_tmp ;
 
-  bool UPDATE_STDOUT;
   int  i, kk, j;
   int  imin = -9, kmin = -9, jmin = -9;
   char fnam[] = "wfit_minimize" ;
@@ -3193,7 +3645,6 @@ void wfit_minimize(void) {
   // ---------- BEGIN --------------
 
   int NBTOT = INPUTS.w0_steps * INPUTS.wa_steps * INPUTS.omm_steps;
-  int NB=0;
 
   printf("\n# ======================================= \n");
   printf(" %s: Get prob at %d grid points, and approx mimimized values \n", 
@@ -3201,6 +3652,7 @@ void wfit_minimize(void) {
   printf("\t USE_SPEED_INTERP       = %d \n", INPUTS.USE_SPEED_INTERP);
   printf("\t USE_SPEED_SKIP_OFFDIAG = %d \n", INPUTS.USE_SPEED_SKIP_OFFDIAG);
   printf("\t USE_SPEED_STOP_DIAG    = %d \n", INPUTS.USE_SPEED_STOP_DIAG);
+  printf("\t USE_SPEED_ZTABLE       = %d \n", INPUTS.USE_SPEED_ZTABLE);
   fflush(stdout);
     
   // prep speed trick
@@ -3234,26 +3686,28 @@ void wfit_minimize(void) {
   }
 
   // - - - - - - - - 
-  time_t t0 = time(NULL);  // monitor time to build prob grid
+  // Oct 2026: compute chi2 on full grid, or on coarse grid with 
+  //   adaptive refinement near chi2 minimum.
+  WORKSPACE.t0_grid = time(NULL);  // monitor time to build prob grid
 
-  cpar.mushift = 0.0;
+  if ( INPUTS.nstep_coarse > 1 ) {
+    wfit_scan_grid_adaptive();
+  }
+  else {
+    int ibin, *IBIN_LIST = (int*)malloc(NBTOT * sizeof(int));
+    for ( ibin=0; ibin < NBTOT; ibin++ ) { IBIN_LIST[ibin] = ibin; }
+    wfit_scan_grid(NBTOT, IBIN_LIST);
+    free(IBIN_LIST);
+  }
 
+  // Keep track of minimum chi2; loop order matches
+  // original serial scan so that ties pick the same bin.
   for( i=0; i < INPUTS.w0_steps; i++){
-    cpar.w0 = INPUTS.w0_min + i*INPUTS.w0_stepsize;
     for( kk=0; kk < INPUTS.wa_steps; kk++){    
-      cpar.wa = (INPUTS.wa_min + kk*INPUTS.wa_stepsize);
       for(j=0; j < INPUTS.omm_steps; j++){
-	cpar.omm = INPUTS.omm_min + j*INPUTS.omm_stepsize; 
-	cpar.ome = 1 - cpar.omm;
-	
-	get_chi2_fit ( cpar.w0, cpar.wa, cpar.omm, INPUTS.sqsnrms, 
-		       temp0_list, temp1_list, temp2_list,
-		       &mures_tmp, &snchi_tmp, &extchi_tmp ); 
+	snchi_tmp  = WORKSPACE.snchi3d[i][kk][j] ;
+	extchi_tmp = WORKSPACE.extchi3d[i][kk][j] ;
 
-	WORKSPACE.snchi3d[i][kk][j]  = snchi_tmp ; 
-	WORKSPACE.extchi3d[i][kk][j] = extchi_tmp ;
-	  
-	// Keep track of minimum chi2 
 	if(snchi_tmp < WORKSPACE.snchi_min) 
 	  { WORKSPACE.snchi_min = snchi_tmp ; }
 	
@@ -3261,22 +3715,6 @@ void wfit_minimize(void) {
 	  WORKSPACE.extchi_min = extchi_tmp ;  
 	  imin=i; jmin=j; kmin=kk; 
 	}
-
-	// stdout update with timing information
-	NB++;
-	if ( NB < 1000 ) 
-	  { UPDATE_STDOUT = ( NB % 100 == 0 ); }
-	else if ( NB < 10000 ) 
-	  { UPDATE_STDOUT = ( NB % 1000 == 0 ); }
-	else
-	  { UPDATE_STDOUT = ( NB % 10000 == 0 ); }
-
-	if ( UPDATE_STDOUT || NB==NBTOT ) {
-	  char comment[60];
-	  sprintf(comment, "chi2 bin %8d of %8d", NB, NBTOT); 
-	  print_elapsed_time(t0, comment, UNIT_TIME_SECOND);
-	}
-
       } // j loop
     }  // end of k-loop
   }  // end of i-loop
@@ -3305,6 +3743,400 @@ void wfit_minimize(void) {
 } // end wfit_minimize
 
 
+
+// =============================
+void wfit_scan_grid(int NBIN, int *IBIN_LIST) {
+
+  // Created Oct 2026
+  // Compute chi2 for the NBIN grid bins in IBIN_LIST, where each
+  // bin index is ibin = (i*wa_steps + kk)*omm_steps + j.
+  // For nthread>1, chunks of the list are distributed dynamically
+  // among pthreads.
+  // With -chi2_cholesky, bins are processed in batches of MXBATCH_CHOL
+  // so that chi2 uses matrix-matrix triangular solves.
+
+  int  nthread   = INPUTS.nthread ;
+  bool USE_BATCH = INPUTS.use_chi2_cholesky && INPUTS.use_mucov ;
+  int  ilist;
+  char fnam[] = "wfit_scan_grid" ;
+
+  // ---------- BEGIN ----------
+
+  WORKSPACE.nbin_list_grid  = NBIN ;
+  WORKSPACE.ibin_list_grid  = IBIN_LIST ;
+  WORKSPACE.ilist_grid_next = 0 ;
+  WORKSPACE.nbin_grid_done  = 0 ;
+
+  if ( nthread > 1 && NBIN < nthread*INPUTS.omm_steps ) 
+    { nthread = 1; } // not worth threading a tiny list
+
+  if ( nthread <= 1 ) {
+    if ( USE_BATCH ) {
+      for ( ilist=0; ilist < NBIN; ilist += MXBATCH_CHOL ) {
+	int nb = ( NBIN-ilist < MXBATCH_CHOL ) ? NBIN-ilist : MXBATCH_CHOL;
+	wfit_scan_grid_batch(nb, &IBIN_LIST[ilist],
+			     temp0_list, temp1_list, temp2_list); 
+      }
+    }
+    else {
+      for ( ilist=0; ilist < NBIN; ilist++ ) {
+	wfit_scan_grid_bin(IBIN_LIST[ilist], 
+			   temp0_list, temp1_list, temp2_list); 
+      }
+    }
+  }
+  else if ( nthread <= MXTHREAD_WFIT ) {
+    pthread_t thread[MXTHREAD_WFIT];
+    int t;
+    printf("\t Split chi2 grid scan into %d threads. \n", nthread);
+    fflush(stdout);
+    for ( t=0; t < nthread; t++ ) 
+      { pthread_create(&thread[t], NULL, wfit_scan_grid_thread, NULL); }
+    for ( t=0; t < nthread; t++ ) 
+      { pthread_join(thread[t], NULL); }
+  }
+  else {
+    sprintf(c1err,"nthread=%d exceeds bound", nthread);
+    sprintf(c2err,"Check -nthread arg; MXTHREAD_WFIT = %d", MXTHREAD_WFIT);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  return ;
+
+} // end wfit_scan_grid
+
+// =============================
+void *wfit_scan_grid_thread(void *arg) {
+
+  // Created Oct 2026
+  // pthread driver for chi2 grid scan: each thread grabs the next
+  // chunk of WORKSPACE.ibin_list_grid until all bins are done. 
+  // Each thread uses its own temp lists for get_chi2_fit outputs.
+
+  int  NBIN      = WORKSPACE.nbin_list_grid ;
+  int  NCHUNK    = INPUTS.omm_steps ;
+  bool USE_BATCH = INPUTS.use_chi2_cholesky && INPUTS.use_mucov ;
+  int MEMD   = (HD_LIST[0].NSN + 10) * sizeof(double) ;
+  double *z_list        = (double*)malloc(MEMD);
+  double *mu_list       = (double*)malloc(MEMD);
+  double *f_interp_list = (double*)malloc(MEMD);
+  int ilist, ilist_last;
+
+  // ---------- BEGIN ----------
+
+  while ( 1 ) {
+    ilist = __atomic_fetch_add(&WORKSPACE.ilist_grid_next, NCHUNK, 
+			       __ATOMIC_RELAXED);
+    if ( ilist >= NBIN ) { break; }
+    ilist_last = ilist + NCHUNK;
+    if ( ilist_last > NBIN ) { ilist_last = NBIN; }
+    if ( USE_BATCH ) {
+      int nb;
+      for ( ; ilist < ilist_last; ilist += nb ) {
+	nb = ilist_last - ilist ;
+	if ( nb > MXBATCH_CHOL ) { nb = MXBATCH_CHOL; }
+	wfit_scan_grid_batch(nb, &WORKSPACE.ibin_list_grid[ilist],
+			     z_list, mu_list, f_interp_list);
+      }
+    }
+    else {
+      for ( ; ilist < ilist_last; ilist++ ) {
+	wfit_scan_grid_bin(WORKSPACE.ibin_list_grid[ilist],
+			   z_list, mu_list, f_interp_list);
+      }
+    }
+  }
+
+  free(z_list);  free(mu_list);  free(f_interp_list);
+
+  return NULL;
+
+} // end wfit_scan_grid_thread
+
+// =============================
+void wfit_scan_grid_bin(int ibin, double *z_list, double *mu_list, 
+			double *f_interp_list) {
+
+  // Created Oct 2026
+  // Compute chi2 for grid bin ibin = (i*wa_steps + kk)*omm_steps + j.
+  // Results are stored in WORKSPACE.snchi3d and extchi3d; 
+  // min chi2 is found later by caller.
+  // Called serially, or from wfit_scan_grid_thread.
+
+  int  j     = ibin % INPUTS.omm_steps ;
+  int  kk    = (ibin / INPUTS.omm_steps) % INPUTS.wa_steps ;
+  int  i     = ibin / (INPUTS.omm_steps * INPUTS.wa_steps) ;
+  double snchi_tmp, extchi_tmp, mures_tmp ;
+  Cosparam cpar;
+
+  // ---------- BEGIN ----------
+
+  cpar.mushift = 0.0;
+  cpar.w0      = INPUTS.w0_min + i*INPUTS.w0_stepsize;
+  cpar.wa      = (INPUTS.wa_min + kk*INPUTS.wa_stepsize);
+  cpar.omm     = INPUTS.omm_min + j*INPUTS.omm_stepsize; 
+  cpar.ome     = 1 - cpar.omm;
+	
+  get_chi2_fit ( cpar.w0, cpar.wa, cpar.omm, INPUTS.sqsnrms, 
+		 z_list, mu_list, f_interp_list,
+		 &mures_tmp, &snchi_tmp, &extchi_tmp ); 
+
+  WORKSPACE.snchi3d[i][kk][j]  = snchi_tmp ; 
+  WORKSPACE.extchi3d[i][kk][j] = extchi_tmp ;
+
+  update_stdout_grid();
+
+  return ;
+
+} // end wfit_scan_grid_bin
+
+// =============================
+void wfit_scan_grid_batch(int NBIN, int *IBIN_LIST, double *z_list,
+			  double *mu_list, double *f_interp_list) {
+
+  // Created Oct 2026
+  // Batched version of wfit_scan_grid_bin for -chi2_cholesky option:
+  // residual vectors for NBIN (<= MXBATCH_CHOL) grid bins are stored as
+  // columns of one NSN x NBIN matrix, and chi2 sums for all bins are
+  // computed with one triangular matrix solve (BLAS level-3).
+
+  int    NSN = HD_LIST[0].NSN ;
+  double *DMU_BATCH = (double*) malloc(NSN*NBIN*sizeof(double));
+  double *dmu_list  = (double*) malloc(NSN*sizeof(double));
+  double chi_hat[MXBATCH_CHOL], Bsum[MXBATCH_CHOL];
+  double Csum, chi2sn, chi2_om, chi2_cmb, chi2_bao, chi2_rd ;
+  Cosparam cpar[MXBATCH_CHOL];
+  int    b, k, i, kk, j, ibin ;
+
+  // ---------- BEGIN ----------
+
+  for(b=0; b < NBIN; b++ ) {
+    ibin = IBIN_LIST[b];
+    GRID_IND(ibin, i, kk, j);
+    cpar[b].mushift = 0.0;
+    cpar[b].w0      = INPUTS.w0_min  + i*INPUTS.w0_stepsize;
+    cpar[b].wa      = INPUTS.wa_min  + kk*INPUTS.wa_stepsize;
+    cpar[b].omm     = INPUTS.omm_min + j*INPUTS.omm_stepsize; 
+    cpar[b].ome     = 1 - cpar[b].omm;
+
+    fill_dmu_list(&cpar[b], z_list, mu_list, f_interp_list, dmu_list);
+    for(k=0; k < NSN; k++ ) { DMU_BATCH[k*NBIN+b] = dmu_list[k]; }
+  }
+
+  get_chi2sums_cholesky(NBIN, DMU_BATCH, chi_hat, Bsum);
+
+  // analytic H0 marginalization and priors, as in get_chi2_fit
+  Csum = WORKSPACE.CHOL_CSUM + 1./SQSIG_MUOFF ;
+  for(b=0; b < NBIN; b++ ) {
+    ibin = IBIN_LIST[b];
+    GRID_IND(ibin, i, kk, j);
+    chi2sn = chi_hat[b] - Bsum[b]*Bsum[b]/Csum ;
+    get_chi2_priors(&cpar[b], &chi2_om, &chi2_cmb, &chi2_bao, &chi2_rd);
+
+    WORKSPACE.snchi3d[i][kk][j]  = chi2sn ; 
+    WORKSPACE.extchi3d[i][kk][j] = chi2sn + 
+      (chi2_om + chi2_cmb + chi2_bao + chi2_rd);
+
+    update_stdout_grid();
+  }
+
+  free(DMU_BATCH);  free(dmu_list);
+
+  return ;
+
+} // end wfit_scan_grid_batch
+
+// =============================
+void update_stdout_grid(void) {
+
+  // Created Oct 2026 (moved from grid loop in wfit_minimize)
+  // Increment number of grid bins done, and periodically
+  // print stdout update with timing information.
+
+  int  NBTOT = WORKSPACE.nbin_list_grid ;
+  int  NB ;
+  bool UPDATE_STDOUT;
+
+  NB = __atomic_add_fetch(&WORKSPACE.nbin_grid_done, 1, __ATOMIC_RELAXED);
+  if ( NB < 1000 ) 
+    { UPDATE_STDOUT = ( NB % 100 == 0 ); }
+  else if ( NB < 10000 ) 
+    { UPDATE_STDOUT = ( NB % 1000 == 0 ); }
+  else
+    { UPDATE_STDOUT = ( NB % 10000 == 0 ); }
+
+  if ( UPDATE_STDOUT || NB==NBTOT ) {
+    char comment[60];
+    sprintf(comment, "chi2 bin %8d of %8d", NB, NBTOT); 
+    print_elapsed_time(WORKSPACE.t0_grid, comment, UNIT_TIME_SECOND);
+  }
+
+  return ;
+
+} // end update_stdout_grid
+
+// =============================
+void wfit_scan_grid_adaptive(void) {
+
+  // Created Oct 2026
+  // Coarse-to-fine alternative to computing chi2 on every grid bin.
+  //  1) compute chi2 on coarse nodes spaced by nstep_coarse bins
+  //     (last bin in each dimension is always a node).
+  //  2) for each coarse cell with any corner chi2 within dchi2_refine
+  //     of the coarse min chi2 (SN-only or SN+prior), compute chi2 
+  //     for all fine bins in the cell.
+  //  3) fill remaining fine bins with trilinear interpolation of
+  //     coarse chi2; these bins have negligible probability.
+  // Output chi2 maps are on the same fine grid as a full scan, so that
+  // marginalization, uncertainty and FoM functions are unchanged.
+
+  int    stride  = INPUTS.nstep_coarse ;
+  double dchi2   = INPUTS.dchi2_refine ;
+  int    NSTEP[3]  = { INPUTS.w0_steps, INPUTS.wa_steps, INPUTS.omm_steps };
+  int    NBTOT     = NSTEP[0] * NSTEP[1] * NSTEP[2] ;
+  int    *NODE[3], NNODE[3], NCELL[3];
+  int    LO[3], HI[3], c[3], ind[3], d, ibin, ilist, NBIN, NEVAL ;
+  int    i, kk, j, corner ;
+  double snchi_min = 1.0E20, extchi_min = 1.0E20, frac[3];
+  double snchi_dif, extchi_dif, dif_min, wgt, snchi, extchi ;
+  bool   *DONE ;
+  int    *IBIN_LIST ;
+
+  // ---------- BEGIN ----------
+
+  for(d=0; d < 3; d++ ) {
+    NODE[d]  = (int*)malloc( (NSTEP[d]/stride + 2) * sizeof(int) ) ;
+    NNODE[d] = set_grid_nodes_coarse(NSTEP[d], stride, NODE[d]);
+    NCELL[d] = ( NNODE[d] > 1 ) ? NNODE[d]-1 : 1 ;
+  }
+
+  DONE      = (bool*)calloc(NBTOT, sizeof(bool));
+  IBIN_LIST = (int*) malloc(NBTOT * sizeof(int));
+
+  printf("   Adaptive grid: coarse nodes (w0,wa,omm) = %d x %d x %d ; "
+	 "refine cells within dchi2=%.1f \n",
+	 NNODE[0], NNODE[1], NNODE[2], dchi2 );
+  fflush(stdout);
+
+  // - - - - coarse pass - - - - -
+  NBIN = 0 ;
+  for(c[0]=0; c[0] < NNODE[0]; c[0]++ ) {
+    for(c[1]=0; c[1] < NNODE[1]; c[1]++ ) {
+      for(c[2]=0; c[2] < NNODE[2]; c[2]++ ) {
+	ibin = GRID_BIN(NODE[0][c[0]], NODE[1][c[1]], NODE[2][c[2]]);
+	IBIN_LIST[NBIN++] = ibin;  DONE[ibin] = true ;
+      }
+    }
+  }
+  wfit_scan_grid(NBIN, IBIN_LIST);
+  NEVAL = NBIN ;
+
+  for(ilist=0; ilist < NBIN; ilist++ ) {
+    ibin = IBIN_LIST[ilist];
+    GRID_IND(ibin, i, kk, j);
+    snchi  = WORKSPACE.snchi3d[i][kk][j] ;
+    extchi = WORKSPACE.extchi3d[i][kk][j] ;
+    if ( snchi  < snchi_min  ) { snchi_min  = snchi;  }
+    if ( extchi < extchi_min ) { extchi_min = extchi; }
+  }
+
+  // - - - - refine pass - - - - -
+  NBIN = 0 ;
+  for(c[0]=0; c[0] < NCELL[0]; c[0]++ ) {
+    for(c[1]=0; c[1] < NCELL[1]; c[1]++ ) {
+      for(c[2]=0; c[2] < NCELL[2]; c[2]++ ) {
+
+	for(d=0; d < 3; d++ ) {
+	  LO[d] = NODE[d][c[d]];
+	  HI[d] = NODE[d][ (NNODE[d] > 1) ? c[d]+1 : c[d] ];
+	}
+
+	// find min chi2 among 8 cell corners
+	dif_min = 1.0E20 ;
+	for(corner=0; corner < 8; corner++ ) {
+	  for(d=0; d < 3; d++ ) 
+	    { ind[d] = ( corner & (1<<d) ) ? HI[d] : LO[d] ; }
+	  snchi_dif  = WORKSPACE.snchi3d[ind[0]][ind[1]][ind[2]] - snchi_min;
+	  extchi_dif = WORKSPACE.extchi3d[ind[0]][ind[1]][ind[2]]- extchi_min;
+	  if ( snchi_dif  < dif_min ) { dif_min = snchi_dif ; }
+	  if ( extchi_dif < dif_min ) { dif_min = extchi_dif ; }
+	}
+	if ( dif_min > dchi2 ) { continue; }
+
+	for(i=LO[0]; i <= HI[0]; i++ ) {
+	  for(kk=LO[1]; kk <= HI[1]; kk++ ) {
+	    for(j=LO[2]; j <= HI[2]; j++ ) {
+	      ibin = GRID_BIN(i,kk,j);
+	      if ( DONE[ibin] ) { continue; }
+	      IBIN_LIST[NBIN++] = ibin;  DONE[ibin] = true ;
+	    }
+	  }
+	}
+
+      }
+    }
+  } // end c[0]
+
+  wfit_scan_grid(NBIN, IBIN_LIST);
+  NEVAL += NBIN ;
+
+  // - - - - interpolate chi2 for remaining bins - - - - -
+  for(ibin=0; ibin < NBTOT; ibin++ ) {
+    if ( DONE[ibin] ) { continue; }
+    GRID_IND(ibin, ind[0], ind[1], ind[2] );
+
+    for(d=0; d < 3; d++ ) {
+      c[d] = ind[d] / stride ;
+      if ( c[d] > NNODE[d]-2 ) { c[d] = NNODE[d]-2; }
+      if ( c[d] < 0          ) { c[d] = 0; }
+      LO[d] = NODE[d][c[d]];
+      HI[d] = NODE[d][ (NNODE[d] > 1) ? c[d]+1 : c[d] ];
+      frac[d] = ( HI[d] > LO[d] ) ? 
+	(double)(ind[d]-LO[d]) / (double)(HI[d]-LO[d]) : 0.0 ;
+    }
+
+    snchi = extchi = 0.0 ;
+    for(corner=0; corner < 8; corner++ ) {
+      int icor[3];
+      wgt = 1.0 ;
+      for(d=0; d < 3; d++ ) {
+	if ( corner & (1<<d) ) { icor[d] = HI[d]; wgt *= frac[d]; }
+	else                   { icor[d] = LO[d]; wgt *= (1.0-frac[d]); }
+      }
+      if ( wgt == 0.0 ) { continue; }
+      snchi  += wgt * WORKSPACE.snchi3d[icor[0]][icor[1]][icor[2]] ;
+      extchi += wgt * WORKSPACE.extchi3d[icor[0]][icor[1]][icor[2]] ;
+    }
+    WORKSPACE.snchi3d[ind[0]][ind[1]][ind[2]]  = snchi ;
+    WORKSPACE.extchi3d[ind[0]][ind[1]][ind[2]] = extchi ;
+  }
+
+  printf("   Adaptive grid: computed chi2 for %d of %d bins (%.1f%%) \n",
+	 NEVAL, NBTOT, 100.0*(double)NEVAL/(double)NBTOT );
+  fflush(stdout);
+
+  for(d=0; d < 3; d++ ) { free(NODE[d]); }
+  free(DONE);  free(IBIN_LIST);
+
+  return ;
+
+} // end wfit_scan_grid_adaptive
+
+// =============================
+int set_grid_nodes_coarse(int nstep, int stride, int *nodes) {
+
+  // Created Oct 2026
+  // Load coarse grid node indices (every stride bins) for fine grid 
+  // with nstep bins; last bin is always a node. Function returns
+  // number of nodes.
+
+  int i, nnode = 0 ;
+  for(i=0; i < nstep; i += stride ) { nodes[nnode++] = i; }
+  if ( nodes[nnode-1] != nstep-1 ) { nodes[nnode++] = nstep-1; }
+  return nnode ;
+
+} // end set_grid_nodes_coarse
+
 // =============================
 void prep_speed_skip_offdiag(double chi2min_approx) {
 
@@ -4014,6 +4846,7 @@ void set_HzFUN_for_wfit(double H0, double OM, double OE, double w0, double wa,
 void invert_mucovar(COVMAT_DEF *MUCOV, double sqmurms_add) {
 
   // Mar 2023 - refactor to pass COVMAT struct
+  // Oct 14 2026: check option to invert using Cholesky decomposition
   //
   int  NSN    = MUCOV->NDIM ;
   int  i;
@@ -4027,6 +4860,7 @@ void invert_mucovar(COVMAT_DEF *MUCOV, double sqmurms_add) {
   if ( INPUTS.use_mucov == FLAG_MUCOVTOT_INV ) {
     printf("\t COV already inverted, so nothing to invert here.\n");
     fflush(stdout);
+    if ( INPUTS.use_chi2_cholesky ) { cholesky_mucovar(MUCOV); }
     return;
   }
 
@@ -4050,7 +4884,10 @@ void invert_mucovar(COVMAT_DEF *MUCOV, double sqmurms_add) {
     for(i=0; i < NSN*NSN; i++ ) { MUCOV_ORIG[i] = MUCOV->ARRAY1D[i]; }
   }
   
-  invertMatrix( NSN, NSN, MUCOV->ARRAY1D ) ;
+  if ( INPUTS.use_chi2_cholesky ) 
+    { cholesky_mucovar(MUCOV); }  // also replaces COV with COVINV
+  else
+    { invertMatrix( NSN, NSN, MUCOV->ARRAY1D ) ; }
 
   print_elapsed_time(t0, "invert matrix", UNIT_TIME_SECOND);
 
@@ -4079,6 +4916,140 @@ void invert_mucovar(COVMAT_DEF *MUCOV, double sqmurms_add) {
 
 } // end of invert_mucovar
 
+// =========================================
+void cholesky_mucovar(COVMAT_DEF *MUCOV) {
+
+  // Created Oct 2026
+  // Store Cholesky factor L of MUCOV->ARRAY1D in WORKSPACE.MUCOV_CHOL.
+  // If ARRAY1D is a covariance (COV = L*L^T), ARRAY1D is overwritten
+  // with COVINV computed from L; this is more stable than LU inverse.
+  // If ARRAY1D is already COVINV (mucovtot_inv_file), COVINV = L*L^T
+  // and ARRAY1D is not modified.
+  // Also store L^-1 * 1 (or L^T * 1) used for H0 marginalization.
+
+  int    NSN   = MUCOV->NDIM ;
+  int    NMAT  = NSN * NSN ;
+  bool   ISINV = ( INPUTS.use_mucov == FLAG_MUCOVTOT_INV );
+  int    i, status ;
+  gsl_error_handler_t *handler_orig ;
+  gsl_matrix_view      mview ;
+  char fnam[] = "cholesky_mucovar" ;
+
+  // ---------- BEGIN -----------
+
+  printf("\t Cholesky decomposition of %d x %d %s \n",
+	 NSN, NSN, (ISINV ? "COVINV" : "COV") );
+  fflush(stdout);
+
+  if ( WORKSPACE.MUCOV_CHOL != NULL ) 
+    { free(WORKSPACE.MUCOV_CHOL); free(WORKSPACE.CHOL_ONE); } // refit
+
+  WORKSPACE.CHOL_ISINV = ISINV ;
+  WORKSPACE.MUCOV_CHOL = (double*) malloc(NMAT * sizeof(double) );
+  WORKSPACE.CHOL_ONE   = (double*) malloc(NSN  * sizeof(double) );
+  for(i=0; i < NMAT; i++ ) { WORKSPACE.MUCOV_CHOL[i] = MUCOV->ARRAY1D[i]; }
+
+  mview        = gsl_matrix_view_array(WORKSPACE.MUCOV_CHOL, NSN, NSN);
+  handler_orig = gsl_set_error_handler_off();
+  status       = gsl_linalg_cholesky_decomp1(&mview.matrix);
+  gsl_set_error_handler(handler_orig);
+
+  if ( status != GSL_SUCCESS ) {
+    sprintf(c1err,"Cholesky decomposition failed (status=%d)", status);
+    sprintf(c2err,"%s is not positive definite.", 
+	    (ISINV ? "COVINV" : "COV") );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  if ( !ISINV ) {
+    gsl_matrix_view mview_inv ;
+    for(i=0; i < NMAT; i++ ) { MUCOV->ARRAY1D[i] = WORKSPACE.MUCOV_CHOL[i]; }
+    mview_inv = gsl_matrix_view_array(MUCOV->ARRAY1D, NSN, NSN);
+    gsl_linalg_cholesky_invert(&mview_inv.matrix);
+  }
+
+  for(i=0; i < NSN; i++ ) { WORKSPACE.CHOL_ONE[i] = 1.0 ; }
+  chol_transform_mucov(1, WORKSPACE.CHOL_ONE);
+  WORKSPACE.CHOL_CSUM = cblas_ddot(NSN, WORKSPACE.CHOL_ONE, 1, 
+				   WORKSPACE.CHOL_ONE, 1);
+
+  return ;
+
+} // end cholesky_mucovar
+
+// =========================================
+void chol_transform_mucov(int NB, double *D) {
+
+  // Created Oct 2026
+  // In-place transform of NB residual vectors stored in 
+  // NSN x NB row-major matrix D (D[k*NB+b], b = vector index) 
+  // such that |D_b|^2 = dmu_b^T COVINV dmu_b :
+  //   COV    = L*L^T  ->  D <- L^-1 D   (triangular solve)
+  //   COVINV = L*L^T  ->  D <- L^T  D   (triangular multiply)
+  // NB=1 uses BLAS level-2; NB>1 uses level-3 for batch of grid bins.
+
+  int    NSN = WORKSPACE.MUCOV_FINAL.NDIM ;
+  double *L  = WORKSPACE.MUCOV_CHOL ;
+
+  // ---------- BEGIN -----------
+
+  if ( WORKSPACE.CHOL_ISINV ) {
+    if ( NB == 1 ) {
+      cblas_dtrmv(CblasRowMajor, CblasLower, CblasTrans, CblasNonUnit,
+		  NSN, L, NSN, D, 1);
+    }
+    else {
+      cblas_dtrmm(CblasRowMajor, CblasLeft, CblasLower, CblasTrans, 
+		  CblasNonUnit, NSN, NB, 1.0, L, NSN, D, NB);
+    }
+  }
+  else {
+    if ( NB == 1 ) {
+      cblas_dtrsv(CblasRowMajor, CblasLower, CblasNoTrans, CblasNonUnit,
+		  NSN, L, NSN, D, 1);
+    }
+    else {
+      cblas_dtrsm(CblasRowMajor, CblasLeft, CblasLower, CblasNoTrans, 
+		  CblasNonUnit, NSN, NB, 1.0, L, NSN, D, NB);
+    }
+  }
+
+  return ;
+
+} // end chol_transform_mucov
+
+// =========================================
+void get_chi2sums_cholesky(int NB, double *D, double *chi_hat, double *Bsum) {
+
+  // Created Oct 2026
+  // For NB residual vectors in NSN x NB row-major matrix D, 
+  // return for each vector b
+  //   chi_hat[b] = dmu^T COVINV dmu
+  //   Bsum[b]    = 1^T   COVINV dmu    (Eq. A.11 of Goliath 2001)
+  // Csum (Eq. A.12) does not depend on dmu and is WORKSPACE.CHOL_CSUM.
+  // Input D is overwritten.
+
+  int NSN = WORKSPACE.MUCOV_FINAL.NDIM ;
+  int k, b;
+  double *Dk ;
+
+  // ---------- BEGIN -----------
+
+  chol_transform_mucov(NB, D);
+
+  for(b=0; b < NB; b++ ) { chi_hat[b] = 0.0 ; }
+  for(k=0; k < NSN; k++ ) {
+    Dk = &D[k*NB] ;
+    for(b=0; b < NB; b++ ) { chi_hat[b] += Dk[b] * Dk[b]; }
+  }
+
+  cblas_dgemv(CblasRowMajor, CblasTrans, NSN, NB, 1.0, D, NB,
+	      WORKSPACE.CHOL_ONE, 1, 0.0, Bsum, 1);
+
+  return ;
+
+} // end get_chi2sums_cholesky
+
 
 // =========================================
 void check_invertMatrix(int N, double *COV, double *COVINV ) {
@@ -4145,12 +5116,18 @@ void get_chi2_fit (
   //
   // Apr 8 2025: 
   //   + implement additional STOP_DIAG speedup by bailing on chi2_diag calc early
+  //
+  // Oct 14 2026: 
+  //   + rz-interp arrays are local (instead of WORKSPACE)
+  //     so that this function is thread-safe.
+  //   + check option to compute chi2 from Cholesky factor
 
   bool USE_SPEED_INTERP       = INPUTS.USE_SPEED_INTERP ;
   bool USE_SPEED_SKIP_OFFDIAG = INPUTS.USE_SPEED_SKIP_OFFDIAG ;
   bool USE_SPEED_STOP_DIAG    = INPUTS.USE_SPEED_STOP_DIAG ;
   int  use_mucov = INPUTS.use_mucov ;
   int  N_NONZERO_OFFDIAG = WORKSPACE.MUCOV[0].N_NONZERO_OFFDIAG; 
+  bool USE_CHOLESKY = INPUTS.use_chi2_cholesky && use_mucov ;
 
   int  NSN       = HD_LIST[0].NSN;
   int  Ndof      = WORKSPACE.Ndof ;
@@ -4165,21 +5142,18 @@ void get_chi2_fit (
   double  chi2_prior = 0.0, chi2_h0marg ;
   double *rz_list  = (double*) malloc(NSN * sizeof(double) );
   double *dmu_list = (double*) malloc(NSN * sizeof(double) );
+  double *rz_list_interp = NULL, *mucos_list_interp = NULL;
   Cosparam cparloc;
   int k, k0, k1, N0, N1, k1min, n_count=0 ;
   
   HD_DEF *HD0 = &HD_LIST[0];
-  HD_DEF *HD1 = &HD_LIST[1];
-
-  double mushift0 = HD0->cospar_biasCor.mushift ;
-  double mushift1 = HD1->cospar_biasCor.mushift ;
 
   bool do_offdiag=false,  skip_offdiag;
 
   // rz-interp variables
-  int n_logz, iz;
+  int n_logz;
   double z ;
-  double mu_obs0, mu_obs1, f_interp;
+  double f_interp;
   int LDMP = 
     INPUTS.debug_flag == 919 && 
     fabs(OM-0.316) < 0.001    && 
@@ -4200,18 +5174,21 @@ void get_chi2_fit (
 
   Bsum = Csum = chi_hat = 0.0 ;
 
+  // Oct 2026: tabulate 1/E(z) integral once for this cosmology
+  HzINV_TABLE_DEF ZTABLE;  ZTABLE.NZBIN = 0 ;
+  fill_codist_table(&cparloc, &ZTABLE);
+
   // Apr 2022: check option to interpolate rz(z) [speed trick]
   if ( USE_SPEED_INTERP ) {
     n_logz   = WORKSPACE.n_logz_interp;
-    for(iz=0; iz < n_logz; iz++ ) {
-      z   = WORKSPACE.z_list_interp[iz];
-      rz  = codist(z, &cparloc); 
-      mu_cos = get_mu_cos(z,rz);  // theory mu
-      WORKSPACE.rz_list_interp[iz]    = rz;
-      WORKSPACE.mucos_list_interp[iz] = mu_cos ;
-    }
+    rz_list_interp    = (double*) malloc(n_logz * sizeof(double) );
+    mucos_list_interp = (double*) malloc(n_logz * sizeof(double) );
+    fill_rz_interp(&cparloc, &ZTABLE, rz_list_interp, mucos_list_interp);
   }
 
+  // Oct 2026: Cholesky option needs full dmu_list -> no early stop
+  if ( USE_CHOLESKY ) { USE_SPEED_STOP_DIAG = false; }
+
   // Compute diag part first and precompute rz in each z bin to 
   // avoid redundant calculations when using covariance matrix.
 
@@ -4220,48 +5197,23 @@ void get_chi2_fit (
     z = HD0->z[k] ;
 
     if ( USE_SPEED_INTERP )  { 
-      exec_rz_interp(k, &cparloc, &rz, &mu_cos); 
+      exec_rz_interp(k, &cparloc, rz_list_interp, mucos_list_interp,
+		     &rz, &mu_cos); 
     }
     else { 
       // brute force calculation of theory distance
-      rz     = codist(z, &cparloc);
+      rz     = codist_table(z, &cparloc, &ZTABLE);
       mu_cos = get_mu_cos(z, rz) ;
     }
 
     rz_list[k]  = rz ;
 
-    if ( INPUTS.USE_HDIBC ) {
-
-      // interpolate two HDs
-      double mu_bcor0 = HD0->mu_cospar_biascor[k] + mushift0 ;
-      double mu_bcor1 = HD1->mu_cospar_biascor[k] + mushift1 ;
-
-      // LDMP = ( fabs(OM-0.3) < 0.1 && fabs(w0+1.0)<0.5 && fabs(wa)<0.5 );
-      if ( LDMP ) {
-	printf(" xxx --------------------------------------------- \n");
-	printf(" xxx %s: z=%.3f  mu_cos=%.3f   mu_bcor = %.3f %.3f \n",
-	       fnam, z, mu_cos, mu_bcor0, mu_bcor1 ); 
-	printf(" xxx %s: cospar(fit) OM,OE,w0,wa = %.3f %.3f %.3f %.3f \n",
-	       fnam, OM, OE, w0, wa );
-	fflush(stdout);
-	debugexit(fnam);
-      }
-
-      mu_obs0 = HD0->mu[k] ;
-      mu_obs1 = HD1->mu[k] ;
-      f_interp = (mu_cos - mu_bcor0) / (mu_bcor1 - mu_bcor0) ;
-
-      // avoid too much extrapolation
-      if ( f_interp < -0.5 ) { f_interp = -0.5; }
-      if ( f_interp >  1.5 ) { f_interp =  1.5; }
-
-      mu_obs = mu_obs0 + f_interp * ( mu_obs1 - mu_obs0 );
-    }
-    else {
-      // conventional : just one HD from one biasCor sim
-      mu_obs = HD0->mu[k];
-      f_interp = 0.0 ;
+    if ( LDMP && INPUTS.USE_HDIBC ) {
+      printf(" xxx %s: cospar(fit) OM,OE,w0,wa = %.3f %.3f %.3f %.3f \n",
+	     fnam, OM, OE, w0, wa );
+      fflush(stdout);
     }
+    mu_obs = get_mu_obs_HD(k, mu_cos, &f_interp, LDMP);
 
     z_obs_list[k]    = z;      // Oct 23 2024 RK    
     mu_obs_list[k]   = mu_obs; // Oct 23 2024 RK
@@ -4305,13 +5257,18 @@ void get_chi2_fit (
 
   } // end k
 
+  // Oct 2026: replace diag and off-diag sums with Cholesky solve
+  if ( USE_CHOLESKY ) {
+    get_chi2sums_cholesky(1, dmu_list, &chi_hat, &Bsum);
+    Csum = WORKSPACE.CHOL_CSUM ;
+  }
   
   // - - - - - -
   // check for adding off-diagonal terms from cov matrix.
   // If chi_hat(diag) is already > 10 sigma above naive chi2 -> 
   // skip off-diag computation to save time.
 
-  if ( use_mucov && N_NONZERO_OFFDIAG > 0 ) { 
+  if ( use_mucov && N_NONZERO_OFFDIAG > 0 && !USE_CHOLESKY ) { 
     if ( USE_SPEED_SKIP_OFFDIAG ) {
       chi_tmp     = chi_hat - Bsum*Bsum/Csum ;
       nsig_chi2  = (chi_tmp - chi_hat_naive ) / sig_chi2min_naive ;
@@ -4388,11 +5345,182 @@ void get_chi2_fit (
 
   free(rz_list);
   free(dmu_list);
+  if ( USE_SPEED_INTERP ) { free(rz_list_interp); free(mucos_list_interp); }
+  free_HzINV_TABLE(&ZTABLE);
 
   return ;
 
 }  // end of get_chi2_fit
 
+// =======================
+void fill_codist_table(Cosparam *cpar, HzINV_TABLE_DEF *TABLE) {
+
+  // Created Oct 2026
+  // If SPEED_MASK_ZTABLE is set, fill table of 1/E(z) and its
+  // cumulative integral for cosmology cpar; then codist_table
+  // evaluates r(z) with no further calls to EofZ. Uses wfit's
+  // own one_over_EofZ (with radiation) so that results match codist.
+  // If option is off, TABLE->NZBIN=0 and codist_table -> codist.
+
+  int    k;
+  double z;
+
+  // ---------- BEGIN ----------
+
+  TABLE->NZBIN = 0 ;
+  if ( !INPUTS.USE_SPEED_ZTABLE ) { return; }
+
+  malloc_HzINV_TABLE(WORKSPACE.zmax_ztable, DZBIN_HzINV_TABLE, TABLE);
+
+  for(k=0; k < TABLE->NZGRID; k++ ) {
+    z = TABLE->ZGRID[k];
+    TABLE->EINV[k] = one_over_EofZ(z, cpar);
+  }
+
+  integrate_HzINV_TABLE(TABLE);
+
+  return ;
+
+} // end fill_codist_table
+
+// =======================
+double codist_table(double z, Cosparam *cpar, HzINV_TABLE_DEF *TABLE) {
+
+  // Created Oct 2026
+  // Return dimensionless comoving distance from TABLE;
+  // fall back to exact codist if there is no table or z is out of range.
+
+  if ( TABLE->NZBIN > 0 && z >= 0.0 && z <= TABLE->ZMAX ) 
+    { return eval_HzINV_TABLE(z, TABLE); }
+  else
+    { return codist(z, cpar); }
+
+} // end codist_table
+
+// =======================
+void fill_rz_interp(Cosparam *cpar, HzINV_TABLE_DEF *TABLE,
+		    double *rz_list_interp, double *mucos_list_interp) {
+
+  // Created Oct 2026 (moved from get_chi2_fit)
+  // Evaluate rz and mu_cos on logz grid used by exec_rz_interp.
+  // Input TABLE is from fill_codist_table (NZBIN=0 -> exact codist).
+
+  int    n_logz = WORKSPACE.n_logz_interp;
+  int    iz;
+  double z, rz;
+
+  for(iz=0; iz < n_logz; iz++ ) {
+    z   = WORKSPACE.z_list_interp[iz];
+    rz  = codist_table(z, cpar, TABLE); 
+    rz_list_interp[iz]    = rz;
+    mucos_list_interp[iz] = get_mu_cos(z,rz);  // theory mu
+  }
+  return ;
+
+} // end fill_rz_interp
+
+// =======================
+double get_mu_obs_HD(int k, double mu_cos, double *f_interp, int LDMP) {
+
+  // Created Oct 2026 (moved from get_chi2_fit)
+  // Return observed mu for SN index k. For HDIBC, interpolate
+  // between two HDs based on mu_cos; otherwise return HD mu.
+  // Output *f_interp is the HDIBC interpolation fraction.
+
+  HD_DEF *HD0 = &HD_LIST[0];
+  HD_DEF *HD1 = &HD_LIST[1];
+  double mu_obs, mu_obs0, mu_obs1, f ;
+  char fnam[] = "get_mu_obs_HD" ;
+
+  // ---------- BEGIN ----------
+
+  if ( INPUTS.USE_HDIBC ) {
+
+    // interpolate two HDs
+    double mu_bcor0 = HD0->mu_cospar_biascor[k] + HD0->cospar_biasCor.mushift;
+    double mu_bcor1 = HD1->mu_cospar_biascor[k] + HD1->cospar_biasCor.mushift;
+
+    if ( LDMP ) {
+      printf(" xxx --------------------------------------------- \n");
+      printf(" xxx %s: z=%.3f  mu_cos=%.3f   mu_bcor = %.3f %.3f \n",
+	     fnam, HD0->z[k], mu_cos, mu_bcor0, mu_bcor1 ); 
+      fflush(stdout);
+      debugexit(fnam);
+    }
+
+    mu_obs0 = HD0->mu[k] ;
+    mu_obs1 = HD1->mu[k] ;
+    f       = (mu_cos - mu_bcor0) / (mu_bcor1 - mu_bcor0) ;
+
+    // avoid too much extrapolation
+    if ( f < -0.5 ) { f = -0.5; }
+    if ( f >  1.5 ) { f =  1.5; }
+
+    mu_obs = mu_obs0 + f * ( mu_obs1 - mu_obs0 );
+  }
+  else {
+    // conventional : just one HD from one biasCor sim
+    mu_obs = HD0->mu[k];
+    f      = 0.0 ;
+  }
+
+  *f_interp = f;
+  return mu_obs ;
+
+} // end get_mu_obs_HD
+
+// =======================
+void fill_dmu_list(Cosparam *cpar, double *z_obs_list, double *mu_obs_list,
+		   double *f_interp_list, double *dmu_list) {
+
+  // Created Oct 2026
+  // Fill dmu_list = mu_obs - mu_cos for all SN at cosmology cpar.
+  // Used by batched Cholesky chi2 in wfit_scan_grid_batch; 
+  // same calculation as the diagonal loop in get_chi2_fit.
+
+  int     NSN    = HD_LIST[0].NSN ;
+  int     n_logz = WORKSPACE.n_logz_interp ;
+  bool    USE_SPEED_INTERP = INPUTS.USE_SPEED_INTERP ;
+  double *rz_list_interp = NULL, *mucos_list_interp = NULL;
+  double  z, rz, mu_cos, mu_obs, f_interp;
+  int     k;
+
+  // ---------- BEGIN ----------
+
+  HzINV_TABLE_DEF ZTABLE;
+  fill_codist_table(cpar, &ZTABLE);
+
+  if ( USE_SPEED_INTERP ) {
+    rz_list_interp    = (double*) malloc(n_logz * sizeof(double) );
+    mucos_list_interp = (double*) malloc(n_logz * sizeof(double) );
+    fill_rz_interp(cpar, &ZTABLE, rz_list_interp, mucos_list_interp);
+  }
+
+  for(k=0; k < NSN; k++ ) {
+    z = HD_LIST[0].z[k] ;
+    if ( USE_SPEED_INTERP )  { 
+      exec_rz_interp(k, cpar, rz_list_interp, mucos_list_interp,
+		     &rz, &mu_cos); 
+    }
+    else { 
+      rz     = codist_table(z, cpar, &ZTABLE);
+      mu_cos = get_mu_cos(z, rz) ;
+    }
+
+    mu_obs = get_mu_obs_HD(k, mu_cos, &f_interp, 0);
+    z_obs_list[k]    = z;
+    mu_obs_list[k]   = mu_obs;
+    f_interp_list[k] = f_interp;
+    dmu_list[k]      = mu_obs - mu_cos; 
+  }
+
+  if ( USE_SPEED_INTERP ) { free(rz_list_interp); free(mucos_list_interp); }
+  free_HzINV_TABLE(&ZTABLE);
+
+  return ;
+
+} // end fill_dmu_list
+
 // =======================
 void get_chi2_priors(Cosparam *cpar, double *chi2_om, double *chi2_cmb,
 		     double *chi2_bao, double *chi2_rd) {
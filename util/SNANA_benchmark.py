@@ -0,0 +1,293 @@
+#!/usr/bin/env python
+#
+# Created Oct 2026
+# Performance benchmarks for SNANA codes (companion to SNANA_code_tests.py).
+# Each benchmark task is run serially on the local node (no batch
+# submit, so that timing is not polluted by other jobs), and the
+# following is written to a YAML-formatted result file:
+#   wall time, cpu time, peak RSS, number of events, events/sec,
+#   and per-stage timers (TIME_STAGE_* keys) from the job YAML output.
+#
+# Usage:
+#   SNANA_benchmark.py                       ! run default list
+#   SNANA_benchmark.py -l <listFile>         ! private list of tasks
+#   SNANA_benchmark.py --ref <oldResults>    ! flag regressions vs. old run
+#   SNANA_benchmark.py --ref <old> --tol 0.2 ! regression if >20% slower
+#
+# The list file contains one task file per line (same convention
+# as SNANA_code_tests.LIST). Each task file has keys
+#    BENCHJOB:        snlc_sim.exe
+#    BENCHJOB_ARGS:   BENCHINPUT RANSEED 12345 NGENTOT_LC 2000
+#    BENCHINPUT:      SIM_SALT2_HOSTLIB.INPUT [other files to copy]
+#    BENCH_YAML:      BENCH_SALT2.YAML   ! optional YAML summary from job
+#    BENCH_NEVT_KEY:  NGENLC_TOT         ! optional YAML key for N events
+#
+# BENCHINPUT string in BENCHJOB_ARGS is replaced with the 1st input file.
+# Seeds must be fixed in BENCHJOB_ARGS (or input file) so that every
+# run generates exactly the same events.
+#
+# Representative workloads in the default list:
+#   SALT2 sim with HOSTLIB, SIMSED sim, BBC fit with biasCor,
+#   wfit w0wa grid, snlc_fit SALT2 light curve fits.
+#
+#       HISTORY
+#
+
+import os, sys, shutil, time, argparse, subprocess
+
+SNANA_TESTS_DIR  = os.environ.get('SNANA_TESTS', '.')
+TASK_DIR         = f"{SNANA_TESTS_DIR}/benchmarks"
+INPUT_DIR        = f"{SNANA_TESTS_DIR}/inputs"
+LIST_FILE_DEFAULT  = f"{SNANA_TESTS_DIR}/SNANA_benchmark.LIST"
+RESULT_FILE_DEFAULT = 'BENCHMARK_RESULTS.YAML'
+WORK_DIR_DEFAULT    = 'BENCHMARK_WORK'
+TOL_DEFAULT         = 0.15    # regression if >15% slower (or bigger RSS)
+
+# ========================================================
+def parse_args():
+
+    parser = argparse.ArgumentParser()
+
+    msg = f"list of benchmark task files (default={LIST_FILE_DEFAULT})"
+    parser.add_argument("-l", "--list_file", help=msg, type=str,
+                        default=LIST_FILE_DEFAULT)
+
+    msg = f"output result file (default={RESULT_FILE_DEFAULT})"
+    parser.add_argument("-o", "--outfile", help=msg, type=str,
+                        default=RESULT_FILE_DEFAULT)
+
+    msg = f"work dir for running tasks (default={WORK_DIR_DEFAULT})"
+    parser.add_argument("--workdir", help=msg, type=str,
+                        default=WORK_DIR_DEFAULT)
+
+    msg = "previous result file to check for regressions"
+    parser.add_argument("--ref", help=msg, type=str, default=None)
+
+    msg = f"fractional tolerance for regression (default={TOL_DEFAULT})"
+    parser.add_argument("--tol", help=msg, type=float, default=TOL_DEFAULT)
+
+    msg = "number of repeats per task; best wall time is reported"
+    parser.add_argument("--nrepeat", help=msg, type=int, default=1)
+
+    args = parser.parse_args()
+    return args
+
+# ========================================================
+def parse_listfile(list_file):
+
+    task_list = []
+    if not os.path.exists(list_file):
+        sys.exit(f"\n ERROR: cannot find list file {list_file}")
+
+    with open(list_file,"rt") as f:
+        for line in f:
+            words = line.split()
+            if len(words) == 0      : continue
+            if words[0][0] == '#'   : continue
+            task_file = words[0]
+            if '/' not in task_file:
+                task_file = f"{TASK_DIR}/{task_file}"
+            task_list.append(parse_taskfile(task_file))
+
+    return task_list
+
+# ========================================================
+def parse_taskfile(task_file):
+
+    task = {
+        'NAME'         : os.path.basename(task_file),
+        'BENCHJOB'     : '',
+        'BENCHJOB_ARGS': '',
+        'BENCHINPUT'   : [],
+        'BENCH_YAML'   : None,
+        'BENCH_NEVT_KEY' : None
+    }
+
+    if not os.path.exists(task_file):
+        sys.exit(f"\n ERROR: cannot find task file {task_file}")
+
+    with open(task_file,"rt") as f:
+        for line in f:
+            words = line.split()
+            if len(words) < 2 : continue
+            key = words[0].rstrip(':')
+            if key == 'BENCHJOB':
+                task[key] = words[1]
+            elif key == 'BENCHJOB_ARGS':
+                task[key] = ' '.join(words[1:])
+            elif key == 'BENCHINPUT':
+                task[key] = words[1:]
+            elif key in [ 'BENCH_YAML', 'BENCH_NEVT_KEY' ] :
+                task[key] = words[1]
+
+    if len(task['BENCHJOB']) == 0 :
+        sys.exit(f"\n ERROR: missing BENCHJOB key in {task_file}")
+
+    return task
+
+# ========================================================
+def read_job_yaml(yaml_file):
+    # read simple 'KEY: value' lines written by SNANA codes
+    info = {}
+    if yaml_file is None or not os.path.exists(yaml_file):
+        return info
+    with open(yaml_file,"rt") as f:
+        for line in f:
+            words = line.split()
+            if len(words) < 2 or not words[0].endswith(':') : continue
+            try:
+                info[words[0].rstrip(':')] = float(words[1])
+            except ValueError:
+                info[words[0].rstrip(':')] = words[1]
+    return info
+
+# ========================================================
+def run_task(task, args):
+
+    name    = task['NAME']
+    workdir = f"{args.workdir}/{name}"
+    if os.path.exists(workdir): shutil.rmtree(workdir)
+    os.makedirs(workdir)
+
+    for infile in task['BENCHINPUT']:
+        src = infile if '/' in infile else f"{INPUT_DIR}/{infile}"
+        shutil.copy(src, workdir)
+
+    job_args = task['BENCHJOB_ARGS']
+    if len(task['BENCHINPUT']) > 0 :
+        infile0 = os.path.basename(task['BENCHINPUT'][0])
+        if 'BENCHINPUT' in job_args:
+            job_args = job_args.replace('BENCHINPUT', infile0)
+        elif len(job_args) == 0 :
+            job_args = infile0
+
+    cmd     = f"{task['BENCHJOB']} {job_args}"
+    log     = f"{name}.LOG"
+    result  = { 'STATUS' : 'FAIL' }
+    print(f"   Run {name}: {cmd}")
+    sys.stdout.flush()
+
+    wall_best = 1.0E12
+    for irep in range(0,args.nrepeat):
+        t0 = time.time()
+        with open(f"{workdir}/{log}","wt") as flog:
+            proc = subprocess.Popen(cmd.split(), cwd=workdir,
+                                    stdout=flog, stderr=subprocess.STDOUT)
+            pid, istat, ru = os.wait4(proc.pid, 0)
+        wall = time.time() - t0
+
+        if istat != 0 :
+            print(f"\t ERROR: {name} failed; see {workdir}/{log}")
+            return result
+
+        if wall < wall_best :
+            wall_best = wall
+            result = {
+                'STATUS'    : 'PASS',
+                'WALLTIME'  : wall,
+                'CPUTIME'   : ru.ru_utime + ru.ru_stime,
+                'MAXRSS_MB' : ru.ru_maxrss/1024.0,   # ru_maxrss is KB on linux
+            }
+
+    yaml_file = None
+    if task['BENCH_YAML'] is not None :
+        yaml_file = f"{workdir}/{task['BENCH_YAML']}"
+    job_info = read_job_yaml(yaml_file)
+
+    nevt_key = task['BENCH_NEVT_KEY']
+    if nevt_key is not None and nevt_key in job_info :
+        nevt = job_info[nevt_key]
+        result['NEVT']        = int(nevt)
+        result['EVT_PER_SEC'] = nevt / max(result['WALLTIME'],1.0E-6)
+
+    for key,val in job_info.items():
+        if key.startswith('TIME_STAGE_') or key.startswith('NCALL_STAGE_'):
+            result[key] = val
+
+    print(f"\t --> {result['WALLTIME']:.2f} sec, " \
+          f"{result['MAXRSS_MB']:.1f} MB")
+    return result
+
+# ========================================================
+def write_results(outfile, task_list, result_list):
+
+    with open(outfile,"wt") as f:
+        f.write(f"SNANA_DIR:  {os.environ.get('SNANA_DIR','UNKNOWN')}\n")
+        f.write(f"HOSTNAME:   {os.uname()[1]}\n")
+        f.write(f"DATE:       {time.strftime('%Y-%m-%d %H:%M')}\n")
+        f.write(f"BENCHMARKS:\n")
+        for task, result in zip(task_list, result_list):
+            f.write(f"  {task['NAME']}:\n")
+            for key,val in result.items():
+                if isinstance(val,float):
+                    f.write(f"    {key}: {val:.4f}\n")
+                else:
+                    f.write(f"    {key}: {val}\n")
+
+    print(f"\n Wrote benchmark results to {outfile}")
+
+# ========================================================
+def read_results(ref_file):
+    # read result file from write_results (without yaml module)
+    results = {}
+    name    = None
+    with open(ref_file,"rt") as f:
+        for line in f:
+            if line.startswith('    ') and name is not None :
+                words = line.split()
+                key   = words[0].rstrip(':')
+                try:
+                    results[name][key] = float(words[1])
+                except ValueError:
+                    results[name][key] = words[1]
+            elif line.startswith('  ') :
+                name = line.split()[0].rstrip(':')
+                results[name] = {}
+    return results
+
+# ========================================================
+def check_regressions(ref_file, tol, task_list, result_list):
+
+    ref = read_results(ref_file)
+    nreg = 0
+    print(f"\n Compare with {ref_file} (tol={tol}) ")
+
+    for task, result in zip(task_list, result_list):
+        name = task['NAME']
+        if name not in ref or result['STATUS'] != 'PASS' : continue
+        for key in [ 'WALLTIME', 'CPUTIME', 'MAXRSS_MB' ] :
+            if key not in ref[name] : continue
+            old = ref[name][key];  new = result[key]
+            ratio = new / max(old,1.0E-6)
+            flag  = ''
+            if ratio > 1.0 + tol :
+                flag = ' <== REGRESSION'
+                nreg += 1
+            print(f"   {name:28s} {key:10s} {old:10.2f} -> {new:10.2f} " \
+                  f"({ratio:.3f}){flag}")
+
+    return nreg
+
+# ========================================================
+if __name__ == "__main__":
+
+    args = parse_args()
+    task_list = parse_listfile(args.list_file)
+    print(f" Found {len(task_list)} benchmark tasks in {args.list_file}")
+
+    result_list = []
+    for task in task_list:
+        result_list.append(run_task(task, args))
+
+    write_results(args.outfile, task_list, result_list)
+
+    nfail = sum(1 for r in result_list if r['STATUS'] != 'PASS')
+    nreg  = 0
+    if args.ref is not None :
+        nreg = check_regressions(args.ref, args.tol, task_list, result_list)
+
+    print(f"\n Done: {nfail} failed tasks, {nreg} regressions.")
+    if nfail > 0 or nreg > 0 :
+        sys.exit(1)
+
+# === END ===